@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Flag di wamrc per un device: target, CPU, FPU e ABI dal banner HELLO
+dell'agent (risposta anche a INFO), più i livelli di ottimizzazione e i
+bounds check scelti dal gateway.
+
+    HELLO device_id=nucleo_f746zg rtos=Zephyr runtime=WAMR fw_version=1.1.0
+          isa=thumbv7em cpu=cortex-m7 fpu=fpv5-sp-d16 abi=eabi aot=1
+
+isa è il --target di wamrc sui Cortex-M e su x86_64; sui RISC-V
+(isa=rv32imac) diventa --target=riscv32 più le estensioni in
+--cpu-features. fpu=none vuol dire FPU assente o spenta (CONFIG_FPU=n):
+il codice AOT non deve usare istruzioni VFP, che con il coprocessore
+disabilitato vanno in UsageFault, quindi --cpu-features=-fpregs anche se
+la CPU ne ha una. abi segue l'invokeNative di WAMR (eabihf solo con
+WAMR_BUILD_TARGET THUMBV7_VFP): è l'ABI con cui WAMR chiama le funzioni
+AOT, non quella del firmware.
+
+Senza HELLO (firmware vecchio, niente INFO) restano i flag di prima,
+--target=thumbv7em --target-abi=eabi senza CPU: codice generico, con la
+virgola mobile in software.
+
+    python aot_target.py --board nucleo_f446re          # flag su stdout
+    python aot_target.py --hello "HELLO ... isa=thumbv7em cpu=cortex-m4 ..."
+"""
+import argparse
+import sys
+
+# Default del gateway (misurati con bench_sweep.py aot): -O3, size level 3
+# (modello di codice small, quello che il loader AOT rilocalizza su Thumb)
+# e bounds check attivi, perché sugli MCU non c'è la MPU a isolare i moduli
+OPT_LEVEL = 3
+SIZE_LEVEL = 3
+BOUNDS_CHECKS = True
+
+# Flag storici, per firmware che non mandano isa/cpu
+LEGACY = {"isa": "thumbv7em", "abi": "eabi"}
+
+# fpu (HELLO) -> --cpu-features LLVM. Il default della CPU M7 in LLVM è
+# FPv5 a doppia precisione: le M7 a singola (F746) vanno limitate con -fp64
+FPU_FEATURES = {
+    "none": ["-fpregs"],
+    "fpv4-sp-d16": ["+vfp4d16sp"],
+    "fpv5-sp-d16": ["+fp-armv8d16sp", "-fp64"],
+    "fpv5-d16": ["+fp-armv8d16"],
+}
+
+# Board note senza chiedere al device (build script, sweep su QEMU): gli
+# stessi campi che mette il firmware nel HELLO
+BOARDS = {
+    "nucleo_f446re": {"isa": "thumbv7em", "cpu": "cortex-m4", "fpu": "fpv4-sp-d16", "abi": "eabi"},
+    "nucleo_f746zg": {"isa": "thumbv7em", "cpu": "cortex-m7", "fpu": "fpv5-sp-d16", "abi": "eabi"},
+    "nrf52840dk/nrf52840": {"isa": "thumbv7em", "cpu": "cortex-m4", "fpu": "fpv4-sp-d16", "abi": "eabi"},
+    "mps2/an385": {"isa": "thumbv7m", "cpu": "cortex-m3", "fpu": "none", "abi": "eabi"},
+    "mps2/an500": {"isa": "thumbv7em", "cpu": "cortex-m7", "fpu": "fpv5-d16", "abi": "eabi"},
+    "qemu_cortex_m3": {"isa": "thumbv7m", "cpu": "cortex-m3", "fpu": "none", "abi": "eabi"},
+}
+FAMILIES = {"f4": "nucleo_f446re", "f7": "nucleo_f746zg"}
+
+
+def parse_hello(line: str) -> dict:
+    """campi chiave=valore di una riga HELLO (o di una qualsiasi risposta dell'agent)"""
+    fields = {}
+    for tok in line.split()[1:]:
+        key, sep, val = tok.partition("=")
+        if sep:
+            fields[key] = val
+    return fields
+
+
+def riscv_args(isa: str) -> list[str]:
+    """rv32imafc -> riscv32, ABI ilp32/ilp32f/ilp32d, estensioni in --cpu-features"""
+    xlen = isa[2:4]
+    exts = isa[5:]
+    abi = ("ilp32" if xlen == "32" else "lp64") + ("d" if "d" in exts else "f" if "f" in exts else "")
+    features = ",".join("+" + e for e in exts if e in "mafdc")
+    args = [f"--target=riscv{xlen}", f"--target-abi={abi}", f"--cpu=generic-rv{xlen}"]
+    return args + ([f"--cpu-features={features}"] if features else [])
+
+
+def target_args(info: dict) -> list[str]:
+    """--target, --target-abi, --cpu, --cpu-features per i campi del HELLO"""
+    isa = info.get("isa") or LEGACY["isa"]
+    cpu = info.get("cpu", "")
+    fpu = info.get("fpu", "")
+    if isa.startswith("rv"):
+        return riscv_args(isa)
+    args = [f"--target={isa}"]
+    if isa.startswith(("thumb", "arm")):
+        args.append(f"--target-abi={info.get('abi') or LEGACY['abi']}")
+    if cpu and cpu not in ("unknown", "generic"):
+        args.append(f"--cpu={cpu}")
+        if fpu in FPU_FEATURES and isa.startswith("thumb"):
+            args.append("--cpu-features=" + ",".join(FPU_FEATURES[fpu]))
+    return args
+
+
+def wamrc_args(info: dict, opt_level: int | None = None, size_level: int | None = None,
+               bounds_checks: bool | None = None) -> list[str]:
+    """tutti i flag di wamrc prima di -o; None = default del gateway"""
+    opt = OPT_LEVEL if opt_level is None else opt_level
+    size = SIZE_LEVEL if size_level is None else size_level
+    bounds = BOUNDS_CHECKS if bounds_checks is None else bounds_checks
+    return target_args(info) + [f"--opt-level={opt}", f"--size-level={size}",
+                                f"--bounds-checks={int(bounds)}"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag di wamrc per un device o una board")
+    src = parser.add_mutually_exclusive_group(required=True)
+    src.add_argument("--board", choices=sorted(BOARDS))
+    src.add_argument("--family", choices=sorted(FAMILIES), help="Alias di nucleo_f446re/nucleo_f746zg")
+    src.add_argument("--hello", help="Riga HELLO dell'agent")
+    parser.add_argument("--opt-level", type=int)
+    parser.add_argument("--size-level", type=int)
+    parser.add_argument("--bounds-checks", type=int, choices=(0, 1))
+    args = parser.parse_args()
+
+    if args.hello:
+        info = parse_hello(args.hello)
+    else:
+        info = BOARDS[args.board or FAMILIES[args.family]]
+    bounds = None if args.bounds_checks is None else bool(args.bounds_checks)
+    print(" ".join(wamrc_args(info, args.opt_level, args.size_level, bounds)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -69,6 +69,8 @@ M3Result  EmitOp  (IM3Compilation o, IM3Operation i_operation)
         }
     }
 
+    o->lastOp.op = NULL;
+
     return result;
 }
 
@@ -0,0 +1,867 @@
+unsigned char kernels_bench_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x11, 0x04, 0x60,
+  0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x60, 0x00, 0x01, 0x7f, 0x60, 0x02,
+  0x7f, 0x7f, 0x00, 0x03, 0x17, 0x16, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02,
+  0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x03,
+  0x02, 0x00, 0x01, 0x02, 0x04, 0x05, 0x01, 0x70, 0x01, 0x01, 0x01, 0x05,
+  0x04, 0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x01, 0x7f, 0x01, 0x41, 0x80,
+  0x20, 0x0b, 0x07, 0xa6, 0x02, 0x16, 0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x02, 0x00, 0x08, 0x66, 0x69, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x09, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x01, 0x0c, 0x66, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x73, 0x75, 0x6d, 0x00, 0x02, 0x08, 0x69, 0x69, 0x72, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x03, 0x09, 0x69, 0x69, 0x72, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x00, 0x04, 0x0c, 0x69, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x05, 0x0b, 0x6d, 0x61, 0x74, 0x6d,
+  0x75, 0x6c, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x06, 0x0c, 0x6d, 0x61,
+  0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x07,
+  0x0f, 0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x08, 0x0a, 0x63, 0x72, 0x63, 0x33, 0x32,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x09, 0x0b, 0x63, 0x72, 0x63, 0x33,
+  0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x0a, 0x0e, 0x63, 0x72,
+  0x63, 0x33, 0x32, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x00, 0x0b, 0x08, 0x61, 0x65, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00,
+  0x0c, 0x09, 0x61, 0x65, 0x73, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00,
+  0x0d, 0x0c, 0x61, 0x65, 0x73, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+  0x75, 0x6d, 0x00, 0x0e, 0x09, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x0f, 0x0a, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x00, 0x10, 0x0d, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x12, 0x08, 0x71, 0x31,
+  0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x13, 0x09, 0x71, 0x31, 0x35,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x14, 0x0c, 0x71, 0x31, 0x35,
+  0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x15, 0x0a,
+  0xfc, 0x48, 0x16, 0xab, 0x03, 0x01, 0x02, 0x7f, 0x41, 0x00, 0x42, 0xf1,
+  0xe1, 0xc3, 0xdf, 0x93, 0x9e, 0xbc, 0xb8, 0x3b, 0x37, 0x03, 0xf8, 0xa2,
+  0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xf1, 0xe1, 0xc3, 0xe3, 0xd3, 0x96,
+  0xad, 0x9a, 0x3c, 0x37, 0x03, 0xf0, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00,
+  0x42, 0xb5, 0xe9, 0xd2, 0xe5, 0xf3, 0xd2, 0xa5, 0xcb, 0x3c, 0x37, 0x03,
+  0xe8, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xf1, 0xe1, 0xc3, 0xe7,
+  0xb3, 0xda, 0xb4, 0xe9, 0x3c, 0x37, 0x03, 0xe0, 0xa2, 0x80, 0x80, 0x00,
+  0x41, 0x00, 0x42, 0x97, 0xad, 0xda, 0xe8, 0x83, 0xf1, 0xe1, 0x83, 0x3d,
+  0x37, 0x03, 0xd8, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xb5, 0xe9,
+  0xd2, 0xe9, 0xe3, 0xb4, 0xe9, 0x92, 0x3d, 0x37, 0x03, 0xd0, 0xa2, 0x80,
+  0x80, 0x00, 0x41, 0x00, 0x42, 0xd3, 0xa5, 0xcb, 0xea, 0xc3, 0xf8, 0xf0,
+  0xa1, 0x3d, 0x37, 0x03, 0xc8, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42,
+  0xf1, 0xe1, 0xc3, 0xeb, 0xa3, 0xbc, 0xf8, 0xb0, 0x3d, 0x37, 0x03, 0xc0,
+  0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xe2, 0xc3, 0x87, 0xeb, 0x93,
+  0x9e, 0xbc, 0xb8, 0x3d, 0x37, 0x03, 0xb8, 0xa2, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x42, 0xc4, 0x87, 0x8f, 0xea, 0xb3, 0xda, 0xb4, 0xa9, 0x3d, 0x37,
+  0x03, 0xb0, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xa6, 0xcb, 0x96,
+  0xe9, 0xd3, 0x96, 0xad, 0x9a, 0x3d, 0x37, 0x03, 0xa8, 0xa2, 0x80, 0x80,
+  0x00, 0x41, 0x00, 0x42, 0x88, 0x8f, 0x9e, 0xe8, 0xf3, 0xd2, 0xa5, 0x8b,
+  0x3d, 0x37, 0x03, 0xa0, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xd3,
+  0xa5, 0xcb, 0xe6, 0x93, 0x9e, 0xbc, 0xf8, 0x3c, 0x37, 0x03, 0x98, 0xa2,
+  0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0x97, 0xad, 0xda, 0xe4, 0xd3, 0x96,
+  0xad, 0xda, 0x3c, 0x37, 0x03, 0x90, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00,
+  0x42, 0xb5, 0xe9, 0xd2, 0xe1, 0x93, 0x9e, 0xbc, 0xb8, 0x3c, 0x37, 0x03,
+  0x88, 0xa2, 0x80, 0x80, 0x00, 0x41, 0x00, 0x42, 0xf1, 0xe1, 0xc3, 0xdb,
+  0x93, 0x9e, 0xbc, 0xf8, 0x3b, 0x37, 0x03, 0x80, 0xa2, 0x80, 0x80, 0x00,
+  0x41, 0x01, 0x21, 0x00, 0x41, 0x88, 0x77, 0x21, 0x01, 0x02, 0x40, 0x03,
+  0x40, 0x20, 0x01, 0x41, 0xf8, 0xab, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00,
+  0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03,
+  0x6a, 0x22, 0x00, 0x41, 0x08, 0x76, 0xb2, 0x43, 0x00, 0x00, 0x00, 0x34,
+  0x94, 0x43, 0x00, 0x00, 0x80, 0xbf, 0x92, 0x38, 0x02, 0x00, 0x20, 0x01,
+  0x45, 0x0d, 0x01, 0x20, 0x01, 0x41, 0xfc, 0xab, 0x80, 0x80, 0x00, 0x6a,
+  0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb,
+  0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x08, 0x76, 0xb2, 0x43, 0x00, 0x00,
+  0x00, 0x34, 0x94, 0x43, 0x00, 0x00, 0x80, 0xbf, 0x92, 0x38, 0x02, 0x00,
+  0x20, 0x01, 0x41, 0x08, 0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b,
+  0xca, 0x07, 0x02, 0x20, 0x7d, 0x02, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x2a, 0x02, 0xfc, 0xa2, 0x80, 0x80,
+  0x00, 0x21, 0x01, 0x41, 0x00, 0x2a, 0x02, 0xf8, 0xa2, 0x80, 0x80, 0x00,
+  0x21, 0x02, 0x41, 0x00, 0x2a, 0x02, 0xf4, 0xa2, 0x80, 0x80, 0x00, 0x21,
+  0x03, 0x41, 0x00, 0x2a, 0x02, 0xf0, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x04,
+  0x41, 0x00, 0x2a, 0x02, 0xec, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x05, 0x41,
+  0x00, 0x2a, 0x02, 0xe8, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x06, 0x41, 0x00,
+  0x2a, 0x02, 0xe4, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x07, 0x41, 0x00, 0x2a,
+  0x02, 0xe0, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x08, 0x41, 0x00, 0x2a, 0x02,
+  0xdc, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x09, 0x41, 0x00, 0x2a, 0x02, 0xd8,
+  0xa2, 0x80, 0x80, 0x00, 0x21, 0x0a, 0x41, 0x00, 0x2a, 0x02, 0xd4, 0xa2,
+  0x80, 0x80, 0x00, 0x21, 0x0b, 0x41, 0x00, 0x2a, 0x02, 0xd0, 0xa2, 0x80,
+  0x80, 0x00, 0x21, 0x0c, 0x41, 0x00, 0x2a, 0x02, 0xcc, 0xa2, 0x80, 0x80,
+  0x00, 0x21, 0x0d, 0x41, 0x00, 0x2a, 0x02, 0xc8, 0xa2, 0x80, 0x80, 0x00,
+  0x21, 0x0e, 0x41, 0x00, 0x2a, 0x02, 0xc4, 0xa2, 0x80, 0x80, 0x00, 0x21,
+  0x0f, 0x41, 0x00, 0x2a, 0x02, 0xc0, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x10,
+  0x41, 0x00, 0x2a, 0x02, 0xbc, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x11, 0x41,
+  0x00, 0x2a, 0x02, 0xb8, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x12, 0x41, 0x00,
+  0x2a, 0x02, 0xb4, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x13, 0x41, 0x00, 0x2a,
+  0x02, 0xb0, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x14, 0x41, 0x00, 0x2a, 0x02,
+  0xac, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x15, 0x41, 0x00, 0x2a, 0x02, 0xa8,
+  0xa2, 0x80, 0x80, 0x00, 0x21, 0x16, 0x41, 0x00, 0x2a, 0x02, 0xa4, 0xa2,
+  0x80, 0x80, 0x00, 0x21, 0x17, 0x41, 0x00, 0x2a, 0x02, 0xa0, 0xa2, 0x80,
+  0x80, 0x00, 0x21, 0x18, 0x41, 0x00, 0x2a, 0x02, 0x9c, 0xa2, 0x80, 0x80,
+  0x00, 0x21, 0x19, 0x41, 0x00, 0x2a, 0x02, 0x98, 0xa2, 0x80, 0x80, 0x00,
+  0x21, 0x1a, 0x41, 0x00, 0x2a, 0x02, 0x94, 0xa2, 0x80, 0x80, 0x00, 0x21,
+  0x1b, 0x41, 0x00, 0x2a, 0x02, 0x90, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x1c,
+  0x41, 0x00, 0x2a, 0x02, 0x8c, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x1d, 0x41,
+  0x00, 0x2a, 0x02, 0x88, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x1e, 0x41, 0x00,
+  0x2a, 0x02, 0x84, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x1f, 0x41, 0x00, 0x2a,
+  0x02, 0x80, 0xa2, 0x80, 0x80, 0x00, 0x21, 0x20, 0x41, 0x00, 0x21, 0x21,
+  0x03, 0x40, 0x41, 0x00, 0x21, 0x22, 0x03, 0x40, 0x20, 0x22, 0x41, 0x80,
+  0xac, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x20, 0x20, 0x22, 0x41, 0x80, 0xa3,
+  0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x92, 0x20, 0x1f, 0x20, 0x22, 0x41, 0x84, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x1e, 0x20, 0x22, 0x41, 0x88,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x1d,
+  0x20, 0x22, 0x41, 0x8c, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x1c, 0x20, 0x22, 0x41, 0x90, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x1b, 0x20, 0x22, 0x41, 0x94,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x1a,
+  0x20, 0x22, 0x41, 0x98, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x19, 0x20, 0x22, 0x41, 0x9c, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x18, 0x20, 0x22, 0x41, 0xa0,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x17,
+  0x20, 0x22, 0x41, 0xa4, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x16, 0x20, 0x22, 0x41, 0xa8, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x15, 0x20, 0x22, 0x41, 0xac,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x14,
+  0x20, 0x22, 0x41, 0xb0, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x13, 0x20, 0x22, 0x41, 0xb4, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x12, 0x20, 0x22, 0x41, 0xb8,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x11,
+  0x20, 0x22, 0x41, 0xbc, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x10, 0x20, 0x22, 0x41, 0xc0, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x0f, 0x20, 0x22, 0x41, 0xc4,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x0e,
+  0x20, 0x22, 0x41, 0xc8, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x0d, 0x20, 0x22, 0x41, 0xcc, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x0c, 0x20, 0x22, 0x41, 0xd0,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x0b,
+  0x20, 0x22, 0x41, 0xd4, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x0a, 0x20, 0x22, 0x41, 0xd8, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x09, 0x20, 0x22, 0x41, 0xdc,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x08,
+  0x20, 0x22, 0x41, 0xe0, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x07, 0x20, 0x22, 0x41, 0xe4, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x06, 0x20, 0x22, 0x41, 0xe8,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x05,
+  0x20, 0x22, 0x41, 0xec, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x04, 0x20, 0x22, 0x41, 0xf0, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x03, 0x20, 0x22, 0x41, 0xf4,
+  0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x20, 0x02,
+  0x20, 0x22, 0x41, 0xf8, 0xa3, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x94, 0x92, 0x20, 0x01, 0x20, 0x22, 0x41, 0xfc, 0xa3, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x94, 0x92, 0x38, 0x02, 0x00, 0x20, 0x22, 0x41,
+  0x04, 0x6a, 0x22, 0x22, 0x41, 0x80, 0x08, 0x47, 0x0d, 0x00, 0x0b, 0x20,
+  0x21, 0x41, 0xff, 0x01, 0x71, 0x41, 0x02, 0x74, 0x41, 0xfc, 0xa3, 0x80,
+  0x80, 0x00, 0x6a, 0x41, 0x00, 0x2a, 0x02, 0xfc, 0xb3, 0x80, 0x80, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x38, 0x02, 0x00, 0x20, 0x21, 0x41,
+  0x01, 0x6a, 0x22, 0x21, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x0b,
+  0x68, 0x01, 0x03, 0x7f, 0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00,
+  0x41, 0x80, 0x78, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x41, 0x80, 0xb4,
+  0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x22, 0x02, 0x41, 0xff, 0x01,
+  0x71, 0x20, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02,
+  0x41, 0x08, 0x76, 0x41, 0xff, 0x01, 0x71, 0x73, 0x41, 0x93, 0x83, 0x80,
+  0x08, 0x6c, 0x20, 0x02, 0x41, 0x10, 0x76, 0x41, 0xff, 0x01, 0x71, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41, 0x18, 0x76, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x01, 0x41, 0x04,
+  0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b, 0x20, 0x00, 0x0b, 0xcb, 0x01, 0x01,
+  0x02, 0x7f, 0x41, 0x00, 0x41, 0x00, 0x36, 0x02, 0x90, 0xb4, 0x80, 0x80,
+  0x00, 0x41, 0x00, 0x41, 0x00, 0x36, 0x02, 0x80, 0xb4, 0x80, 0x80, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x36, 0x02, 0x98, 0xb4, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x41, 0x00, 0x36, 0x02, 0xa0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00,
+  0x41, 0x00, 0x36, 0x02, 0xb0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41,
+  0x00, 0x36, 0x02, 0xc0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x00,
+  0x36, 0x02, 0xc8, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x00, 0x36,
+  0x02, 0xd0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x02, 0x21, 0x00, 0x41, 0x80,
+  0x78, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x41, 0xe0, 0xbc, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf,
+  0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x08, 0x76, 0xb2, 0x43,
+  0x00, 0x00, 0x00, 0x34, 0x94, 0x43, 0x00, 0x00, 0x80, 0xbf, 0x92, 0x38,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xe4, 0xbc, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x08, 0x76, 0xb2, 0x43, 0x00, 0x00, 0x00,
+  0x34, 0x94, 0x43, 0x00, 0x00, 0x80, 0xbf, 0x92, 0x38, 0x02, 0x00, 0x20,
+  0x01, 0x41, 0x08, 0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b, 0x0b, 0xda, 0x03,
+  0x04, 0x01, 0x7f, 0x08, 0x7d, 0x01, 0x7f, 0x09, 0x7d, 0x02, 0x40, 0x20,
+  0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x41, 0x00,
+  0x2a, 0x02, 0xd0, 0xb4, 0x80, 0x80, 0x00, 0x21, 0x02, 0x41, 0x00, 0x2a,
+  0x02, 0xc8, 0xb4, 0x80, 0x80, 0x00, 0x21, 0x03, 0x41, 0x00, 0x2a, 0x02,
+  0xc0, 0xb4, 0x80, 0x80, 0x00, 0x21, 0x04, 0x41, 0x00, 0x2a, 0x02, 0xb0,
+  0xb4, 0x80, 0x80, 0x00, 0x21, 0x05, 0x41, 0x00, 0x2a, 0x02, 0xa0, 0xb4,
+  0x80, 0x80, 0x00, 0x21, 0x06, 0x41, 0x00, 0x2a, 0x02, 0x98, 0xb4, 0x80,
+  0x80, 0x00, 0x21, 0x07, 0x41, 0x00, 0x2a, 0x02, 0x90, 0xb4, 0x80, 0x80,
+  0x00, 0x21, 0x08, 0x41, 0x00, 0x2a, 0x02, 0x80, 0xb4, 0x80, 0x80, 0x00,
+  0x21, 0x09, 0x03, 0x40, 0x41, 0x80, 0x78, 0x21, 0x0a, 0x03, 0x40, 0x20,
+  0x0a, 0x41, 0xe0, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x0a, 0x41, 0xe0,
+  0xbc, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x0b, 0x43, 0xfd,
+  0x25, 0x8a, 0x3d, 0x94, 0x22, 0x0c, 0x20, 0x09, 0x92, 0x22, 0x0d, 0x43,
+  0xfd, 0x25, 0x8a, 0x3d, 0x94, 0x22, 0x0e, 0x20, 0x07, 0x92, 0x22, 0x0f,
+  0x43, 0xfd, 0x25, 0x8a, 0x3d, 0x94, 0x22, 0x10, 0x20, 0x05, 0x92, 0x22,
+  0x11, 0x43, 0xfd, 0x25, 0x8a, 0x3d, 0x94, 0x22, 0x12, 0x20, 0x03, 0x92,
+  0x22, 0x13, 0x38, 0x02, 0x00, 0x20, 0x08, 0x20, 0x0b, 0x43, 0xfe, 0x25,
+  0x0a, 0x3e, 0x94, 0x20, 0x0d, 0x43, 0x2f, 0x4d, 0x92, 0x3f, 0x94, 0x92,
+  0x92, 0x21, 0x09, 0x20, 0x06, 0x20, 0x0d, 0x43, 0xfe, 0x25, 0x0a, 0x3e,
+  0x94, 0x20, 0x0f, 0x43, 0x2f, 0x4d, 0x92, 0x3f, 0x94, 0x92, 0x92, 0x21,
+  0x07, 0x20, 0x04, 0x20, 0x0f, 0x43, 0xfe, 0x25, 0x0a, 0x3e, 0x94, 0x20,
+  0x11, 0x43, 0x2f, 0x4d, 0x92, 0x3f, 0x94, 0x92, 0x92, 0x21, 0x05, 0x20,
+  0x02, 0x20, 0x11, 0x43, 0xfe, 0x25, 0x0a, 0x3e, 0x94, 0x20, 0x13, 0x43,
+  0x2f, 0x4d, 0x92, 0x3f, 0x94, 0x92, 0x92, 0x21, 0x03, 0x20, 0x12, 0x20,
+  0x13, 0x43, 0xbb, 0x5a, 0xd3, 0x3e, 0x94, 0x93, 0x22, 0x13, 0x21, 0x02,
+  0x20, 0x10, 0x20, 0x11, 0x43, 0xbb, 0x5a, 0xd3, 0x3e, 0x94, 0x93, 0x22,
+  0x11, 0x21, 0x04, 0x20, 0x0e, 0x20, 0x0f, 0x43, 0xbb, 0x5a, 0xd3, 0x3e,
+  0x94, 0x93, 0x22, 0x0f, 0x21, 0x06, 0x20, 0x0c, 0x20, 0x0d, 0x43, 0xbb,
+  0x5a, 0xd3, 0x3e, 0x94, 0x93, 0x22, 0x0d, 0x21, 0x08, 0x20, 0x0a, 0x41,
+  0x04, 0x6a, 0x22, 0x0a, 0x0d, 0x00, 0x0b, 0x20, 0x13, 0x21, 0x02, 0x20,
+  0x11, 0x21, 0x04, 0x20, 0x0f, 0x21, 0x06, 0x20, 0x0d, 0x21, 0x08, 0x20,
+  0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b,
+  0x41, 0x00, 0x20, 0x0d, 0x38, 0x02, 0x90, 0xb4, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x20, 0x09, 0x38, 0x02, 0x80, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00,
+  0x20, 0x07, 0x38, 0x02, 0x98, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x20,
+  0x0f, 0x38, 0x02, 0xa0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x20, 0x05,
+  0x38, 0x02, 0xb0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x20, 0x11, 0x38,
+  0x02, 0xc0, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x20, 0x03, 0x38, 0x02,
+  0xc8, 0xb4, 0x80, 0x80, 0x00, 0x41, 0x00, 0x20, 0x13, 0x38, 0x02, 0xd0,
+  0xb4, 0x80, 0x80, 0x00, 0x0b, 0x0b, 0x68, 0x01, 0x03, 0x7f, 0x41, 0xc5,
+  0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x41, 0x80, 0x78, 0x21, 0x01, 0x03,
+  0x40, 0x20, 0x01, 0x41, 0xe0, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02,
+  0x00, 0x22, 0x02, 0x41, 0xff, 0x01, 0x71, 0x20, 0x00, 0x73, 0x41, 0x93,
+  0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41, 0x08, 0x76, 0x41, 0xff, 0x01,
+  0x71, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41, 0x10,
+  0x76, 0x41, 0xff, 0x01, 0x71, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c,
+  0x20, 0x02, 0x41, 0x18, 0x76, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c,
+  0x21, 0x00, 0x20, 0x01, 0x41, 0x04, 0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b,
+  0x20, 0x00, 0x0b, 0xfd, 0x09, 0x01, 0x02, 0x7f, 0x41, 0x03, 0x21, 0x00,
+  0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x41, 0xe0, 0xd4, 0x80,
+  0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xe4,
+  0xd4, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xe8, 0xd4, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00,
+  0x20, 0x01, 0x41, 0xec, 0xd4, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xf0, 0xd4, 0x80, 0x80, 0x00, 0x6a, 0x41,
+  0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xf4, 0xd4, 0x80, 0x80, 0x00,
+  0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xe0, 0xc4, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xe0, 0xcc, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xe4, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xe4, 0xcc, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xe8, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xe8, 0xcc, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xec, 0xc4, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xec, 0xcc, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xf0, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xf0, 0xcc, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xf4, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xf4, 0xcc, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xf8, 0xc4, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xf8, 0xd4, 0x80, 0x80, 0x00, 0x6a, 0x41,
+  0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xfc, 0xd4, 0x80, 0x80, 0x00,
+  0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x80, 0xd5, 0x80,
+  0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x84,
+  0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x88, 0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00,
+  0x20, 0x01, 0x41, 0x8c, 0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0xf8, 0xcc, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0xfc, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xfc, 0xcc, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x80, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x80, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x84, 0xc5, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x84, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x88, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x88, 0xcd, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x8c, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x8c, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x90, 0xc5, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x90, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x90, 0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36, 0x02, 0x00,
+  0x20, 0x01, 0x41, 0x94, 0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x98, 0xd5, 0x80, 0x80, 0x00, 0x6a, 0x41,
+  0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x9c, 0xd5, 0x80, 0x80, 0x00,
+  0x6a, 0x41, 0x00, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x94, 0xc5, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x94, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x98, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0x98, 0xcd, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41,
+  0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x9c, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x00, 0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x9c, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x14, 0x76, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41, 0xc0, 0x00, 0x6a,
+  0x22, 0x01, 0x41, 0x80, 0x08, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0xf4, 0x04,
+  0x01, 0x14, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00,
+  0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x41, 0xe0, 0xd4, 0x80, 0x80, 0x00,
+  0x21, 0x02, 0x41, 0x00, 0x21, 0x03, 0x03, 0x40, 0x20, 0x03, 0x41, 0x06,
+  0x74, 0x22, 0x04, 0x41, 0x9c, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02,
+  0x00, 0x21, 0x05, 0x20, 0x04, 0x41, 0x98, 0xc5, 0x80, 0x80, 0x00, 0x6a,
+  0x28, 0x02, 0x00, 0x21, 0x06, 0x20, 0x04, 0x41, 0x94, 0xc5, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x07, 0x20, 0x04, 0x41, 0x90, 0xc5,
+  0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x08, 0x20, 0x04, 0x41,
+  0x8c, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x09, 0x20,
+  0x04, 0x41, 0x88, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21,
+  0x0a, 0x20, 0x04, 0x41, 0x84, 0xc5, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02,
+  0x00, 0x21, 0x0b, 0x20, 0x04, 0x41, 0x80, 0xc5, 0x80, 0x80, 0x00, 0x6a,
+  0x28, 0x02, 0x00, 0x21, 0x0c, 0x20, 0x04, 0x41, 0xfc, 0xc4, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x0d, 0x20, 0x04, 0x41, 0xf8, 0xc4,
+  0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x0e, 0x20, 0x04, 0x41,
+  0xf4, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x0f, 0x20,
+  0x04, 0x41, 0xf0, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21,
+  0x10, 0x20, 0x04, 0x41, 0xec, 0xc4, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02,
+  0x00, 0x21, 0x11, 0x20, 0x04, 0x41, 0xe8, 0xc4, 0x80, 0x80, 0x00, 0x6a,
+  0x28, 0x02, 0x00, 0x21, 0x12, 0x20, 0x04, 0x41, 0xe4, 0xc4, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x13, 0x20, 0x04, 0x41, 0xe0, 0xc4,
+  0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x14, 0x41, 0x00, 0x21,
+  0x04, 0x03, 0x40, 0x20, 0x02, 0x20, 0x04, 0x6a, 0x20, 0x04, 0x41, 0xa0,
+  0xd4, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x05, 0x6c, 0x20,
+  0x04, 0x41, 0xe0, 0xd3, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20,
+  0x06, 0x6c, 0x20, 0x04, 0x41, 0xa0, 0xd3, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x20, 0x07, 0x6c, 0x20, 0x04, 0x41, 0xe0, 0xd2, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x08, 0x6c, 0x20, 0x04, 0x41, 0xa0,
+  0xd2, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x09, 0x6c, 0x20,
+  0x04, 0x41, 0xe0, 0xd1, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20,
+  0x0a, 0x6c, 0x20, 0x04, 0x41, 0xa0, 0xd1, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x20, 0x0b, 0x6c, 0x20, 0x04, 0x41, 0xe0, 0xd0, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x0c, 0x6c, 0x20, 0x04, 0x41, 0xa0,
+  0xd0, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x0d, 0x6c, 0x20,
+  0x04, 0x41, 0xe0, 0xcf, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20,
+  0x0e, 0x6c, 0x20, 0x04, 0x41, 0xa0, 0xcf, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x20, 0x0f, 0x6c, 0x20, 0x04, 0x41, 0xe0, 0xce, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x10, 0x6c, 0x20, 0x04, 0x41, 0xa0,
+  0xce, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x11, 0x6c, 0x20,
+  0x04, 0x41, 0xe0, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x20,
+  0x12, 0x6c, 0x20, 0x04, 0x41, 0xa0, 0xcd, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x20, 0x13, 0x6c, 0x20, 0x04, 0x41, 0xe0, 0xcc, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x20, 0x14, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a,
+  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x36,
+  0x02, 0x00, 0x20, 0x04, 0x41, 0x04, 0x6a, 0x22, 0x04, 0x41, 0xc0, 0x00,
+  0x47, 0x0d, 0x00, 0x0b, 0x20, 0x02, 0x41, 0xc0, 0x00, 0x6a, 0x21, 0x02,
+  0x20, 0x03, 0x41, 0x01, 0x6a, 0x22, 0x03, 0x41, 0x10, 0x47, 0x0d, 0x00,
+  0x0b, 0x20, 0x01, 0x41, 0x0f, 0x71, 0x41, 0x06, 0x74, 0x20, 0x01, 0x41,
+  0x02, 0x76, 0x41, 0x3c, 0x71, 0x72, 0x41, 0xe0, 0xc4, 0x80, 0x80, 0x00,
+  0x6a, 0x22, 0x04, 0x20, 0x04, 0x28, 0x02, 0x00, 0x41, 0x00, 0x28, 0x02,
+  0xdc, 0xdc, 0x80, 0x80, 0x00, 0x41, 0xff, 0x1f, 0x71, 0x73, 0x36, 0x02,
+  0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47, 0x0d,
+  0x00, 0x0b, 0x0b, 0x0b, 0x68, 0x01, 0x03, 0x7f, 0x41, 0xc5, 0xbb, 0xf2,
+  0x88, 0x78, 0x21, 0x00, 0x41, 0x80, 0x78, 0x21, 0x01, 0x03, 0x40, 0x20,
+  0x01, 0x41, 0xe0, 0xdc, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x22,
+  0x02, 0x41, 0xff, 0x01, 0x71, 0x20, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80,
+  0x08, 0x6c, 0x20, 0x02, 0x41, 0x08, 0x76, 0x41, 0xff, 0x01, 0x71, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41, 0x10, 0x76, 0x41,
+  0xff, 0x01, 0x71, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02,
+  0x41, 0x18, 0x76, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00,
+  0x20, 0x01, 0x41, 0x04, 0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b, 0x20, 0x00,
+  0x0b, 0xfc, 0x02, 0x01, 0x04, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x41, 0xe0,
+  0xdc, 0x80, 0x80, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00,
+  0x41, 0x01, 0x76, 0x22, 0x02, 0x41, 0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73,
+  0x20, 0x02, 0x20, 0x00, 0x41, 0x01, 0x71, 0x1b, 0x22, 0x02, 0x41, 0x01,
+  0x76, 0x22, 0x03, 0x41, 0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73, 0x20, 0x03,
+  0x20, 0x02, 0x41, 0x01, 0x71, 0x1b, 0x22, 0x02, 0x41, 0x01, 0x76, 0x22,
+  0x03, 0x41, 0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73, 0x20, 0x03, 0x20, 0x02,
+  0x41, 0x01, 0x71, 0x1b, 0x22, 0x02, 0x41, 0x01, 0x76, 0x22, 0x03, 0x41,
+  0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73, 0x20, 0x03, 0x20, 0x02, 0x41, 0x01,
+  0x71, 0x1b, 0x22, 0x02, 0x41, 0x01, 0x76, 0x22, 0x03, 0x41, 0xa0, 0x86,
+  0xe2, 0xed, 0x7e, 0x73, 0x20, 0x03, 0x20, 0x02, 0x41, 0x01, 0x71, 0x1b,
+  0x22, 0x02, 0x41, 0x01, 0x76, 0x22, 0x03, 0x41, 0xa0, 0x86, 0xe2, 0xed,
+  0x7e, 0x73, 0x20, 0x03, 0x20, 0x02, 0x41, 0x01, 0x71, 0x1b, 0x22, 0x02,
+  0x41, 0x01, 0x76, 0x22, 0x03, 0x41, 0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73,
+  0x20, 0x03, 0x20, 0x02, 0x41, 0x01, 0x71, 0x1b, 0x22, 0x02, 0x41, 0x01,
+  0x76, 0x22, 0x03, 0x41, 0xa0, 0x86, 0xe2, 0xed, 0x7e, 0x73, 0x20, 0x03,
+  0x20, 0x02, 0x41, 0x01, 0x71, 0x1b, 0x36, 0x02, 0x00, 0x20, 0x01, 0x41,
+  0x04, 0x6a, 0x21, 0x01, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x22, 0x00, 0x41,
+  0x80, 0x02, 0x47, 0x0d, 0x00, 0x0b, 0x41, 0x80, 0x78, 0x21, 0x00, 0x41,
+  0x04, 0x21, 0x01, 0x03, 0x40, 0x20, 0x00, 0x41, 0xe0, 0xec, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x01, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf,
+  0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x01, 0x41, 0x18, 0x76, 0x3a, 0x00,
+  0x00, 0x20, 0x00, 0x41, 0xe1, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x01,
+  0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03,
+  0x6a, 0x22, 0x01, 0x41, 0x18, 0x76, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41,
+  0xe2, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x01, 0x41, 0x8d, 0xcc, 0xe5,
+  0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x01, 0x41,
+  0x18, 0x76, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0xe3, 0xec, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x01, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf,
+  0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x01, 0x41, 0x18, 0x76, 0x3a, 0x00,
+  0x00, 0x20, 0x00, 0x41, 0x04, 0x6a, 0x22, 0x00, 0x0d, 0x00, 0x0b, 0x41,
+  0x00, 0x41, 0x00, 0x36, 0x02, 0xe0, 0xec, 0x80, 0x80, 0x00, 0x0b, 0xa6,
+  0x01, 0x01, 0x03, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d,
+  0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x41, 0x80, 0x78, 0x21, 0x02,
+  0x41, 0x7f, 0x21, 0x03, 0x03, 0x40, 0x20, 0x03, 0x41, 0xff, 0x01, 0x71,
+  0x20, 0x02, 0x41, 0xe0, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x73, 0x41, 0x02, 0x74, 0x41, 0xe0, 0xdc, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x20, 0x03, 0x41, 0x08, 0x76, 0x73, 0x22, 0x03, 0x41, 0xff,
+  0x01, 0x71, 0x20, 0x02, 0x41, 0xe1, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x02, 0x74, 0x41, 0xe0, 0xdc, 0x80, 0x80, 0x00,
+  0x6a, 0x28, 0x02, 0x00, 0x20, 0x03, 0x41, 0x08, 0x76, 0x73, 0x21, 0x03,
+  0x20, 0x02, 0x41, 0x02, 0x6a, 0x22, 0x02, 0x0d, 0x00, 0x0b, 0x20, 0x01,
+  0x41, 0xff, 0x07, 0x71, 0x41, 0xe0, 0xe4, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x03, 0x41, 0x7f, 0x73, 0x22, 0x02, 0x3a, 0x00, 0x00, 0x20, 0x01, 0x41,
+  0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b, 0x41, 0x00,
+  0x20, 0x02, 0x36, 0x02, 0xe0, 0xec, 0x80, 0x80, 0x00, 0x0b, 0x0b, 0x0b,
+  0x00, 0x41, 0x00, 0x28, 0x02, 0xe0, 0xec, 0x80, 0x80, 0x00, 0x0b, 0xcf,
+  0x03, 0x01, 0x09, 0x7f, 0x41, 0x00, 0x42, 0x88, 0x92, 0xa8, 0xd8, 0xc0,
+  0xa1, 0x83, 0x87, 0x0f, 0x37, 0x03, 0xc8, 0x80, 0x81, 0x80, 0x00, 0x41,
+  0x00, 0x42, 0x80, 0x82, 0x88, 0x98, 0xc0, 0xa0, 0x81, 0x83, 0x07, 0x37,
+  0x03, 0xc0, 0x80, 0x81, 0x80, 0x00, 0x41, 0x0c, 0x21, 0x00, 0x41, 0x0c,
+  0x21, 0x01, 0x41, 0x01, 0x21, 0x02, 0x03, 0x40, 0x20, 0x00, 0x41, 0xc3,
+  0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x03, 0x20, 0x00,
+  0x41, 0xc2, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x04,
+  0x20, 0x00, 0x41, 0xc1, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x21, 0x05, 0x02, 0x40, 0x02, 0x40, 0x20, 0x00, 0x41, 0x04, 0x6a, 0x22,
+  0x06, 0x41, 0x0c, 0x71, 0x45, 0x0d, 0x00, 0x20, 0x01, 0x21, 0x07, 0x20,
+  0x04, 0x21, 0x08, 0x0c, 0x01, 0x0b, 0x20, 0x05, 0x41, 0x80, 0xa0, 0x80,
+  0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x02, 0x73, 0x21, 0x07, 0x20,
+  0x03, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x08, 0x20, 0x04, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x21, 0x05, 0x20, 0x01, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0,
+  0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x03, 0x20, 0x02, 0x41,
+  0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x20,
+  0x02, 0x41, 0x01, 0x74, 0x73, 0x21, 0x02, 0x0b, 0x20, 0x00, 0x41, 0xc4,
+  0x80, 0x81, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0xb4, 0x80, 0x81, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x07, 0x73, 0x22, 0x01, 0x3a, 0x00,
+  0x00, 0x20, 0x00, 0x41, 0xc5, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x20, 0x00,
+  0x41, 0xb5, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x05,
+  0x73, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0xc6, 0x80, 0x81, 0x80, 0x00,
+  0x6a, 0x20, 0x00, 0x41, 0xb6, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x20, 0x08, 0x73, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0xc7, 0x80,
+  0x81, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0xb7, 0x80, 0x81, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x20, 0x03, 0x73, 0x3a, 0x00, 0x00, 0x20, 0x06,
+  0x21, 0x00, 0x20, 0x06, 0x41, 0xac, 0x01, 0x49, 0x0d, 0x00, 0x0b, 0x41,
+  0x03, 0x21, 0x00, 0x03, 0x40, 0x20, 0x00, 0x41, 0xf0, 0xec, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x00, 0x41, 0x0f, 0x71, 0x41, 0x11, 0x6c, 0x20, 0x00,
+  0x41, 0x7d, 0x6a, 0x22, 0x03, 0x41, 0x04, 0x76, 0x22, 0x06, 0x73, 0x3a,
+  0x00, 0x00, 0x20, 0x00, 0x41, 0xef, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x20,
+  0x00, 0x41, 0x7f, 0x6a, 0x41, 0x0e, 0x71, 0x41, 0x11, 0x6c, 0x20, 0x06,
+  0x73, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0xee, 0xec, 0x80, 0x80, 0x00,
+  0x6a, 0x20, 0x00, 0x41, 0x7e, 0x6a, 0x41, 0x0d, 0x71, 0x41, 0x11, 0x6c,
+  0x20, 0x06, 0x73, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0xed, 0xec, 0x80,
+  0x80, 0x00, 0x6a, 0x20, 0x03, 0x41, 0x0c, 0x71, 0x41, 0x11, 0x6c, 0x20,
+  0x06, 0x73, 0x3a, 0x00, 0x00, 0x20, 0x00, 0x41, 0x04, 0x6a, 0x22, 0x00,
+  0x41, 0x83, 0x02, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0xb3, 0x0e, 0x01, 0x3f,
+  0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00,
+  0x21, 0x01, 0x41, 0x00, 0x2d, 0x00, 0xcf, 0x80, 0x81, 0x80, 0x00, 0x21,
+  0x02, 0x41, 0x00, 0x2d, 0x00, 0xce, 0x80, 0x81, 0x80, 0x00, 0x21, 0x03,
+  0x41, 0x00, 0x2d, 0x00, 0xcd, 0x80, 0x81, 0x80, 0x00, 0x21, 0x04, 0x41,
+  0x00, 0x2d, 0x00, 0xcc, 0x80, 0x81, 0x80, 0x00, 0x21, 0x05, 0x41, 0x00,
+  0x2d, 0x00, 0xcb, 0x80, 0x81, 0x80, 0x00, 0x21, 0x06, 0x41, 0x00, 0x2d,
+  0x00, 0xca, 0x80, 0x81, 0x80, 0x00, 0x21, 0x07, 0x41, 0x00, 0x2d, 0x00,
+  0xc9, 0x80, 0x81, 0x80, 0x00, 0x21, 0x08, 0x41, 0x00, 0x2d, 0x00, 0xc8,
+  0x80, 0x81, 0x80, 0x00, 0x21, 0x09, 0x41, 0x00, 0x2d, 0x00, 0xc7, 0x80,
+  0x81, 0x80, 0x00, 0x21, 0x0a, 0x41, 0x00, 0x2d, 0x00, 0xc6, 0x80, 0x81,
+  0x80, 0x00, 0x21, 0x0b, 0x41, 0x00, 0x2d, 0x00, 0xc5, 0x80, 0x81, 0x80,
+  0x00, 0x21, 0x0c, 0x41, 0x00, 0x2d, 0x00, 0xc4, 0x80, 0x81, 0x80, 0x00,
+  0x21, 0x0d, 0x41, 0x00, 0x2d, 0x00, 0xc3, 0x80, 0x81, 0x80, 0x00, 0x21,
+  0x0e, 0x41, 0x00, 0x2d, 0x00, 0xc2, 0x80, 0x81, 0x80, 0x00, 0x21, 0x0f,
+  0x41, 0x00, 0x2d, 0x00, 0xc1, 0x80, 0x81, 0x80, 0x00, 0x21, 0x10, 0x41,
+  0x00, 0x2d, 0x00, 0xc0, 0x80, 0x81, 0x80, 0x00, 0x21, 0x11, 0x03, 0x40,
+  0x41, 0x00, 0x21, 0x12, 0x03, 0x40, 0x20, 0x12, 0x41, 0x04, 0x74, 0x22,
+  0x13, 0x41, 0xff, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x14, 0x2d, 0x00,
+  0x00, 0x20, 0x02, 0x73, 0x21, 0x15, 0x20, 0x13, 0x41, 0xfe, 0xec, 0x80,
+  0x80, 0x00, 0x6a, 0x22, 0x16, 0x2d, 0x00, 0x00, 0x20, 0x03, 0x73, 0x21,
+  0x17, 0x20, 0x13, 0x41, 0xfd, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x18,
+  0x2d, 0x00, 0x00, 0x20, 0x04, 0x73, 0x21, 0x19, 0x20, 0x13, 0x41, 0xfc,
+  0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x1a, 0x2d, 0x00, 0x00, 0x20, 0x05,
+  0x73, 0x21, 0x1b, 0x20, 0x13, 0x41, 0xfb, 0xec, 0x80, 0x80, 0x00, 0x6a,
+  0x22, 0x1c, 0x2d, 0x00, 0x00, 0x20, 0x06, 0x73, 0x21, 0x1d, 0x20, 0x13,
+  0x41, 0xfa, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x1e, 0x2d, 0x00, 0x00,
+  0x20, 0x07, 0x73, 0x21, 0x1f, 0x20, 0x13, 0x41, 0xf9, 0xec, 0x80, 0x80,
+  0x00, 0x6a, 0x22, 0x20, 0x2d, 0x00, 0x00, 0x20, 0x08, 0x73, 0x21, 0x21,
+  0x20, 0x13, 0x41, 0xf8, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x22, 0x2d,
+  0x00, 0x00, 0x20, 0x09, 0x73, 0x21, 0x23, 0x20, 0x13, 0x41, 0xf7, 0xec,
+  0x80, 0x80, 0x00, 0x6a, 0x22, 0x24, 0x2d, 0x00, 0x00, 0x20, 0x0a, 0x73,
+  0x21, 0x25, 0x20, 0x13, 0x41, 0xf6, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22,
+  0x26, 0x2d, 0x00, 0x00, 0x20, 0x0b, 0x73, 0x21, 0x27, 0x20, 0x13, 0x41,
+  0xf5, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x28, 0x2d, 0x00, 0x00, 0x20,
+  0x0c, 0x73, 0x21, 0x29, 0x20, 0x13, 0x41, 0xf4, 0xec, 0x80, 0x80, 0x00,
+  0x6a, 0x22, 0x2a, 0x2d, 0x00, 0x00, 0x20, 0x0d, 0x73, 0x21, 0x2b, 0x20,
+  0x13, 0x41, 0xf3, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x2c, 0x2d, 0x00,
+  0x00, 0x20, 0x0e, 0x73, 0x21, 0x2d, 0x20, 0x13, 0x41, 0xf2, 0xec, 0x80,
+  0x80, 0x00, 0x6a, 0x22, 0x2e, 0x2d, 0x00, 0x00, 0x20, 0x0f, 0x73, 0x21,
+  0x2f, 0x20, 0x13, 0x41, 0xf1, 0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x30,
+  0x2d, 0x00, 0x00, 0x20, 0x10, 0x73, 0x21, 0x31, 0x20, 0x13, 0x41, 0xf0,
+  0xec, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x32, 0x2d, 0x00, 0x00, 0x20, 0x11,
+  0x73, 0x21, 0x33, 0x41, 0x01, 0x21, 0x34, 0x41, 0x00, 0x21, 0x13, 0x03,
+  0x40, 0x20, 0x1d, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x35, 0x20, 0x27, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x36, 0x20, 0x31, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x1d, 0x20, 0x1b, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x1b, 0x20, 0x25, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x27, 0x20, 0x2f, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x2f, 0x20, 0x19, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x25, 0x20, 0x23, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x23, 0x20, 0x2d, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x19, 0x20, 0x17, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x17, 0x20, 0x21, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x2d, 0x20, 0x2b, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x2b, 0x20, 0x15, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x15, 0x20, 0x1f, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x1f, 0x20, 0x29, 0x41, 0xff, 0x01, 0x71, 0x41, 0x80, 0xa0, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21, 0x31, 0x20, 0x33, 0x41, 0xff, 0x01,
+  0x71, 0x41, 0x80, 0xa0, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x21,
+  0x33, 0x02, 0x40, 0x02, 0x40, 0x20, 0x34, 0x41, 0x09, 0x4d, 0x0d, 0x00,
+  0x20, 0x35, 0x21, 0x21, 0x20, 0x36, 0x21, 0x29, 0x20, 0x27, 0x21, 0x35,
+  0x20, 0x2f, 0x21, 0x36, 0x20, 0x19, 0x21, 0x27, 0x20, 0x17, 0x21, 0x2f,
+  0x20, 0x15, 0x21, 0x37, 0x20, 0x1f, 0x21, 0x38, 0x0c, 0x01, 0x0b, 0x20,
+  0x35, 0x20, 0x1b, 0x73, 0x22, 0x21, 0x41, 0x01, 0x74, 0x20, 0x1d, 0x20,
+  0x1b, 0x73, 0x22, 0x39, 0x20, 0x36, 0x73, 0x22, 0x37, 0x73, 0x20, 0x21,
+  0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71,
+  0x73, 0x21, 0x21, 0x20, 0x35, 0x20, 0x39, 0x73, 0x20, 0x35, 0x20, 0x36,
+  0x73, 0x22, 0x29, 0x41, 0x01, 0x74, 0x73, 0x20, 0x29, 0x41, 0x18, 0x74,
+  0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x29,
+  0x20, 0x36, 0x20, 0x1d, 0x73, 0x22, 0x36, 0x41, 0x01, 0x74, 0x20, 0x1d,
+  0x73, 0x20, 0x37, 0x20, 0x35, 0x73, 0x22, 0x3a, 0x73, 0x20, 0x36, 0x41,
+  0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73,
+  0x21, 0x1d, 0x20, 0x27, 0x20, 0x23, 0x73, 0x22, 0x35, 0x41, 0x01, 0x74,
+  0x20, 0x25, 0x20, 0x23, 0x73, 0x22, 0x3b, 0x20, 0x2f, 0x73, 0x22, 0x37,
+  0x73, 0x20, 0x35, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76,
+  0x41, 0x1b, 0x71, 0x73, 0x21, 0x35, 0x20, 0x27, 0x20, 0x3b, 0x73, 0x20,
+  0x27, 0x20, 0x2f, 0x73, 0x22, 0x36, 0x41, 0x01, 0x74, 0x73, 0x20, 0x36,
+  0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71,
+  0x73, 0x21, 0x36, 0x20, 0x2f, 0x20, 0x25, 0x73, 0x22, 0x2f, 0x41, 0x01,
+  0x74, 0x20, 0x25, 0x73, 0x20, 0x37, 0x20, 0x27, 0x73, 0x22, 0x3c, 0x73,
+  0x20, 0x2f, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41,
+  0x1b, 0x71, 0x73, 0x21, 0x25, 0x20, 0x19, 0x20, 0x2b, 0x73, 0x22, 0x27,
+  0x41, 0x01, 0x74, 0x20, 0x2d, 0x20, 0x2b, 0x73, 0x22, 0x3d, 0x20, 0x17,
+  0x73, 0x22, 0x37, 0x73, 0x20, 0x27, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75,
+  0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x27, 0x20, 0x19, 0x20,
+  0x3d, 0x73, 0x20, 0x19, 0x20, 0x17, 0x73, 0x22, 0x2f, 0x41, 0x01, 0x74,
+  0x73, 0x20, 0x2f, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76,
+  0x41, 0x1b, 0x71, 0x73, 0x21, 0x2f, 0x20, 0x17, 0x20, 0x2d, 0x73, 0x22,
+  0x17, 0x41, 0x01, 0x74, 0x20, 0x2d, 0x73, 0x20, 0x37, 0x20, 0x19, 0x73,
+  0x22, 0x3e, 0x73, 0x20, 0x17, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41,
+  0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x2d, 0x20, 0x15, 0x20, 0x33,
+  0x73, 0x22, 0x17, 0x41, 0x01, 0x74, 0x20, 0x31, 0x20, 0x33, 0x73, 0x22,
+  0x19, 0x20, 0x1f, 0x73, 0x22, 0x3f, 0x73, 0x20, 0x17, 0x41, 0x18, 0x74,
+  0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x37,
+  0x20, 0x15, 0x20, 0x19, 0x73, 0x20, 0x15, 0x20, 0x1f, 0x73, 0x22, 0x17,
+  0x41, 0x01, 0x74, 0x73, 0x20, 0x17, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75,
+  0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x38, 0x20, 0x1f, 0x20,
+  0x31, 0x73, 0x22, 0x17, 0x41, 0x01, 0x74, 0x20, 0x31, 0x73, 0x20, 0x3f,
+  0x20, 0x15, 0x73, 0x22, 0x15, 0x73, 0x20, 0x17, 0x41, 0x18, 0x74, 0x41,
+  0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x21, 0x31, 0x20,
+  0x39, 0x41, 0x01, 0x74, 0x20, 0x1b, 0x73, 0x20, 0x39, 0x41, 0x18, 0x74,
+  0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x20, 0x3a,
+  0x73, 0x21, 0x1b, 0x20, 0x3b, 0x41, 0x01, 0x74, 0x20, 0x23, 0x73, 0x20,
+  0x3b, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b,
+  0x71, 0x73, 0x20, 0x3c, 0x73, 0x21, 0x23, 0x20, 0x3d, 0x41, 0x01, 0x74,
+  0x20, 0x2b, 0x73, 0x20, 0x3d, 0x41, 0x18, 0x74, 0x41, 0x18, 0x75, 0x41,
+  0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x20, 0x3e, 0x73, 0x21, 0x2b, 0x20,
+  0x19, 0x41, 0x01, 0x74, 0x20, 0x33, 0x73, 0x20, 0x19, 0x41, 0x18, 0x74,
+  0x41, 0x18, 0x75, 0x41, 0x07, 0x76, 0x41, 0x1b, 0x71, 0x73, 0x20, 0x15,
+  0x73, 0x21, 0x33, 0x0b, 0x20, 0x34, 0x41, 0x01, 0x6a, 0x21, 0x34, 0x20,
+  0x13, 0x41, 0xdf, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20,
+  0x21, 0x73, 0x21, 0x15, 0x20, 0x13, 0x41, 0xde, 0x80, 0x81, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x20, 0x29, 0x73, 0x21, 0x17, 0x20, 0x13, 0x41,
+  0xdd, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x1d, 0x73,
+  0x21, 0x19, 0x20, 0x13, 0x41, 0xdc, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x20, 0x1b, 0x73, 0x21, 0x1b, 0x20, 0x13, 0x41, 0xdb, 0x80,
+  0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x35, 0x73, 0x21, 0x1d,
+  0x20, 0x13, 0x41, 0xda, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x20, 0x36, 0x73, 0x21, 0x1f, 0x20, 0x13, 0x41, 0xd9, 0x80, 0x81, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x25, 0x73, 0x21, 0x21, 0x20, 0x13,
+  0x41, 0xd8, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x23,
+  0x73, 0x21, 0x23, 0x20, 0x13, 0x41, 0xd7, 0x80, 0x81, 0x80, 0x00, 0x6a,
+  0x2d, 0x00, 0x00, 0x20, 0x27, 0x73, 0x21, 0x25, 0x20, 0x13, 0x41, 0xd6,
+  0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x2f, 0x73, 0x21,
+  0x27, 0x20, 0x13, 0x41, 0xd5, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x20, 0x2d, 0x73, 0x21, 0x29, 0x20, 0x13, 0x41, 0xd4, 0x80, 0x81,
+  0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x2b, 0x73, 0x21, 0x2b, 0x20,
+  0x13, 0x41, 0xd3, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20,
+  0x37, 0x73, 0x21, 0x2d, 0x20, 0x13, 0x41, 0xd2, 0x80, 0x81, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x20, 0x38, 0x73, 0x21, 0x2f, 0x20, 0x13, 0x41,
+  0xd1, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x20, 0x31, 0x73,
+  0x21, 0x31, 0x20, 0x13, 0x41, 0xd0, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x20, 0x33, 0x73, 0x21, 0x33, 0x20, 0x13, 0x41, 0x10, 0x6a,
+  0x22, 0x13, 0x41, 0xa0, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x20, 0x14, 0x20,
+  0x15, 0x3a, 0x00, 0x00, 0x20, 0x16, 0x20, 0x17, 0x3a, 0x00, 0x00, 0x20,
+  0x18, 0x20, 0x19, 0x3a, 0x00, 0x00, 0x20, 0x1a, 0x20, 0x1b, 0x3a, 0x00,
+  0x00, 0x20, 0x1c, 0x20, 0x1d, 0x3a, 0x00, 0x00, 0x20, 0x1e, 0x20, 0x1f,
+  0x3a, 0x00, 0x00, 0x20, 0x20, 0x20, 0x21, 0x3a, 0x00, 0x00, 0x20, 0x22,
+  0x20, 0x23, 0x3a, 0x00, 0x00, 0x20, 0x24, 0x20, 0x25, 0x3a, 0x00, 0x00,
+  0x20, 0x26, 0x20, 0x27, 0x3a, 0x00, 0x00, 0x20, 0x28, 0x20, 0x29, 0x3a,
+  0x00, 0x00, 0x20, 0x2a, 0x20, 0x2b, 0x3a, 0x00, 0x00, 0x20, 0x2c, 0x20,
+  0x2d, 0x3a, 0x00, 0x00, 0x20, 0x2e, 0x20, 0x2f, 0x3a, 0x00, 0x00, 0x20,
+  0x30, 0x20, 0x31, 0x3a, 0x00, 0x00, 0x20, 0x32, 0x20, 0x33, 0x3a, 0x00,
+  0x00, 0x20, 0x12, 0x41, 0x01, 0x6a, 0x22, 0x12, 0x41, 0x10, 0x47, 0x0d,
+  0x00, 0x0b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47,
+  0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x6f, 0x01, 0x02, 0x7f, 0x41, 0xc5, 0xbb,
+  0xf2, 0x88, 0x78, 0x21, 0x00, 0x41, 0x80, 0x7e, 0x21, 0x01, 0x03, 0x40,
+  0x20, 0x00, 0x20, 0x01, 0x41, 0xf0, 0xee, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41,
+  0xf1, 0xee, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93,
+  0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0xf2, 0xee, 0x80, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20,
+  0x01, 0x41, 0xf3, 0xee, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x01, 0x41, 0x04,
+  0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b, 0x20, 0x00, 0x0b, 0x5b, 0x01, 0x01,
+  0x7f, 0x41, 0x00, 0x21, 0x00, 0x41, 0x00, 0x41, 0x05, 0x36, 0x02, 0xf0,
+  0xee, 0x80, 0x80, 0x00, 0x03, 0x40, 0x20, 0x00, 0x41, 0x98, 0xef, 0x80,
+  0x80, 0x00, 0x6a, 0x42, 0x00, 0x37, 0x03, 0x00, 0x20, 0x00, 0x41, 0x90,
+  0xef, 0x80, 0x80, 0x00, 0x6a, 0x42, 0x00, 0x37, 0x03, 0x00, 0x20, 0x00,
+  0x41, 0x88, 0xef, 0x80, 0x80, 0x00, 0x6a, 0x42, 0x00, 0x37, 0x03, 0x00,
+  0x20, 0x00, 0x41, 0x80, 0xef, 0x80, 0x80, 0x00, 0x6a, 0x42, 0x00, 0x37,
+  0x03, 0x00, 0x20, 0x00, 0x41, 0x20, 0x6a, 0x22, 0x00, 0x41, 0x80, 0x08,
+  0x47, 0x0d, 0x00, 0x0b, 0x0b, 0xcb, 0x01, 0x01, 0x03, 0x7f, 0x02, 0x40,
+  0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03,
+  0x40, 0x41, 0x00, 0x28, 0x02, 0xf0, 0xee, 0x80, 0x80, 0x00, 0x21, 0x02,
+  0x41, 0x80, 0x78, 0x21, 0x03, 0x03, 0x40, 0x20, 0x03, 0x41, 0x80, 0xf7,
+  0x80, 0x80, 0x00, 0x6a, 0x20, 0x02, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c,
+  0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x02, 0x36, 0x02, 0x00,
+  0x20, 0x03, 0x41, 0x84, 0xf7, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x02, 0x41,
+  0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a,
+  0x22, 0x02, 0x36, 0x02, 0x00, 0x20, 0x03, 0x41, 0x88, 0xf7, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x02, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf,
+  0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x02, 0x36, 0x02, 0x00, 0x20, 0x03,
+  0x41, 0x8c, 0xf7, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x02, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x02,
+  0x36, 0x02, 0x00, 0x20, 0x03, 0x41, 0x10, 0x6a, 0x22, 0x03, 0x0d, 0x00,
+  0x0b, 0x41, 0x00, 0x20, 0x02, 0x36, 0x02, 0xf0, 0xee, 0x80, 0x80, 0x00,
+  0x41, 0x80, 0xef, 0x80, 0x80, 0x00, 0x41, 0x80, 0x02, 0x10, 0x91, 0x80,
+  0x80, 0x80, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00,
+  0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x8c, 0x03, 0x01, 0x0b, 0x7f, 0x02,
+  0x40, 0x20, 0x01, 0x41, 0x11, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x20, 0x00,
+  0x41, 0x7c, 0x6a, 0x21, 0x02, 0x20, 0x01, 0x41, 0x7f, 0x6a, 0x21, 0x03,
+  0x20, 0x00, 0x20, 0x01, 0x41, 0x01, 0x74, 0x41, 0x7c, 0x71, 0x6a, 0x28,
+  0x02, 0x00, 0x21, 0x04, 0x41, 0x00, 0x21, 0x05, 0x03, 0x40, 0x20, 0x02,
+  0x20, 0x05, 0x41, 0x02, 0x74, 0x6a, 0x21, 0x06, 0x20, 0x05, 0x21, 0x07,
+  0x03, 0x40, 0x20, 0x07, 0x41, 0x01, 0x6a, 0x21, 0x07, 0x20, 0x06, 0x41,
+  0x04, 0x6a, 0x22, 0x06, 0x28, 0x02, 0x00, 0x22, 0x08, 0x20, 0x04, 0x49,
+  0x0d, 0x00, 0x0b, 0x20, 0x07, 0x41, 0x7f, 0x6a, 0x21, 0x05, 0x20, 0x00,
+  0x20, 0x03, 0x41, 0x02, 0x74, 0x6a, 0x21, 0x09, 0x20, 0x03, 0x21, 0x0a,
+  0x03, 0x40, 0x20, 0x0a, 0x41, 0x7f, 0x6a, 0x21, 0x0a, 0x20, 0x09, 0x28,
+  0x02, 0x00, 0x21, 0x0b, 0x20, 0x09, 0x41, 0x7c, 0x6a, 0x22, 0x0c, 0x21,
+  0x09, 0x20, 0x0b, 0x20, 0x04, 0x4b, 0x0d, 0x00, 0x0b, 0x02, 0x40, 0x20,
+  0x05, 0x20, 0x0a, 0x41, 0x01, 0x6a, 0x22, 0x03, 0x4a, 0x0d, 0x00, 0x20,
+  0x06, 0x20, 0x0b, 0x36, 0x02, 0x00, 0x20, 0x0c, 0x41, 0x04, 0x6a, 0x20,
+  0x08, 0x36, 0x02, 0x00, 0x20, 0x07, 0x21, 0x05, 0x20, 0x0a, 0x21, 0x03,
+  0x0b, 0x20, 0x05, 0x20, 0x03, 0x4c, 0x0d, 0x00, 0x0b, 0x02, 0x40, 0x02,
+  0x40, 0x20, 0x03, 0x41, 0x01, 0x6a, 0x22, 0x09, 0x20, 0x01, 0x20, 0x05,
+  0x6b, 0x22, 0x01, 0x4e, 0x0d, 0x00, 0x20, 0x00, 0x20, 0x09, 0x10, 0x91,
+  0x80, 0x80, 0x80, 0x00, 0x20, 0x00, 0x20, 0x05, 0x41, 0x02, 0x74, 0x6a,
+  0x21, 0x00, 0x0c, 0x01, 0x0b, 0x20, 0x00, 0x20, 0x05, 0x41, 0x02, 0x74,
+  0x6a, 0x20, 0x01, 0x10, 0x91, 0x80, 0x80, 0x80, 0x00, 0x20, 0x09, 0x21,
+  0x01, 0x0b, 0x20, 0x01, 0x41, 0x10, 0x4a, 0x0d, 0x00, 0x0b, 0x0b, 0x02,
+  0x40, 0x20, 0x01, 0x41, 0x02, 0x48, 0x0d, 0x00, 0x20, 0x00, 0x21, 0x04,
+  0x41, 0x01, 0x21, 0x0b, 0x03, 0x40, 0x20, 0x00, 0x20, 0x0b, 0x41, 0x02,
+  0x74, 0x6a, 0x28, 0x02, 0x00, 0x21, 0x06, 0x20, 0x04, 0x21, 0x09, 0x20,
+  0x0b, 0x21, 0x07, 0x02, 0x40, 0x03, 0x40, 0x20, 0x09, 0x28, 0x02, 0x00,
+  0x22, 0x0a, 0x20, 0x06, 0x4d, 0x0d, 0x01, 0x20, 0x09, 0x41, 0x04, 0x6a,
+  0x20, 0x0a, 0x36, 0x02, 0x00, 0x20, 0x09, 0x41, 0x7c, 0x6a, 0x21, 0x09,
+  0x20, 0x07, 0x41, 0x7f, 0x6a, 0x22, 0x07, 0x41, 0x01, 0x6a, 0x41, 0x01,
+  0x4a, 0x0d, 0x00, 0x0b, 0x41, 0x00, 0x21, 0x07, 0x0b, 0x20, 0x00, 0x20,
+  0x07, 0x41, 0x02, 0x74, 0x6a, 0x20, 0x06, 0x36, 0x02, 0x00, 0x20, 0x04,
+  0x41, 0x04, 0x6a, 0x21, 0x04, 0x20, 0x0b, 0x41, 0x01, 0x6a, 0x22, 0x0b,
+  0x20, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0xf5, 0x01, 0x01, 0x06,
+  0x7f, 0x41, 0x00, 0x21, 0x00, 0x41, 0x84, 0x78, 0x21, 0x01, 0x41, 0x00,
+  0x28, 0x02, 0x80, 0xef, 0x80, 0x80, 0x00, 0x22, 0x02, 0x21, 0x03, 0x02,
+  0x40, 0x03, 0x40, 0x20, 0x03, 0x20, 0x01, 0x41, 0x80, 0xf7, 0x80, 0x80,
+  0x00, 0x6a, 0x28, 0x02, 0x00, 0x22, 0x04, 0x4b, 0x0d, 0x01, 0x20, 0x04,
+  0x20, 0x01, 0x41, 0x84, 0xf7, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00,
+  0x22, 0x03, 0x4b, 0x0d, 0x01, 0x20, 0x03, 0x20, 0x01, 0x41, 0x88, 0xf7,
+  0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x22, 0x04, 0x4b, 0x0d, 0x01,
+  0x20, 0x04, 0x20, 0x01, 0x41, 0x8c, 0xf7, 0x80, 0x80, 0x00, 0x6a, 0x28,
+  0x02, 0x00, 0x22, 0x05, 0x4b, 0x0d, 0x01, 0x20, 0x05, 0x20, 0x01, 0x41,
+  0x90, 0xf7, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x22, 0x03, 0x4b,
+  0x0d, 0x01, 0x20, 0x01, 0x41, 0x14, 0x6a, 0x22, 0x01, 0x0d, 0x00, 0x0b,
+  0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x41, 0x04, 0x21, 0x01,
+  0x03, 0x40, 0x20, 0x02, 0x41, 0xff, 0x01, 0x71, 0x20, 0x00, 0x73, 0x41,
+  0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41, 0x08, 0x76, 0x41, 0xff,
+  0x01, 0x71, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x02, 0x41,
+  0x10, 0x76, 0x41, 0xff, 0x01, 0x71, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08,
+  0x6c, 0x20, 0x02, 0x41, 0x18, 0x76, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08,
+  0x6c, 0x21, 0x00, 0x20, 0x01, 0x41, 0x80, 0x08, 0x46, 0x0d, 0x01, 0x20,
+  0x01, 0x41, 0x80, 0xef, 0x80, 0x80, 0x00, 0x6a, 0x28, 0x02, 0x00, 0x21,
+  0x02, 0x20, 0x01, 0x41, 0x04, 0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b,
+  0x20, 0x00, 0x0b, 0xd1, 0x02, 0x01, 0x02, 0x7f, 0x41, 0x00, 0x41, 0x01,
+  0x3a, 0x00, 0x90, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a,
+  0x00, 0x80, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00,
+  0x94, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xa0,
+  0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xa8, 0xf7,
+  0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xb0, 0xf7, 0x80,
+  0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xb4, 0xf7, 0x80, 0x80,
+  0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xc0, 0xf7, 0x80, 0x80, 0x00,
+  0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0xd0, 0xf7, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x41, 0x01, 0x3a, 0x00, 0xe0, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00,
+  0x41, 0x01, 0x3a, 0x00, 0xe4, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41,
+  0x01, 0x3a, 0x00, 0xf0, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01,
+  0x3a, 0x00, 0xf8, 0xf7, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a,
+  0x00, 0x80, 0xf8, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00,
+  0x84, 0xf8, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x01, 0x3a, 0x00, 0x90,
+  0xf8, 0x80, 0x80, 0x00, 0x41, 0x06, 0x21, 0x00, 0x41, 0xe8, 0x7b, 0x21,
+  0x01, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x41, 0xb8, 0xfc, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf,
+  0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41, 0x10, 0x76, 0x3b, 0x01,
+  0x00, 0x20, 0x01, 0x41, 0xba, 0xfc, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00,
+  0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03,
+  0x6a, 0x22, 0x00, 0x41, 0x10, 0x76, 0x3b, 0x01, 0x00, 0x20, 0x01, 0x41,
+  0xbc, 0xfc, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc, 0xe5,
+  0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00, 0x41,
+  0x10, 0x76, 0x3b, 0x01, 0x00, 0x20, 0x01, 0x45, 0x0d, 0x01, 0x20, 0x01,
+  0x41, 0xbe, 0xfc, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x00, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x00,
+  0x41, 0x10, 0x76, 0x3b, 0x01, 0x00, 0x20, 0x01, 0x41, 0x08, 0x6a, 0x21,
+  0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b, 0x8e, 0x05, 0x01, 0x13, 0x7f, 0x02,
+  0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x80, 0x10, 0x41,
+  0x00, 0x41, 0x00, 0x2d, 0x00, 0x90, 0xf8, 0x80, 0x80, 0x00, 0x1b, 0x21,
+  0x01, 0x41, 0x80, 0x12, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0x84, 0xf8,
+  0x80, 0x80, 0x00, 0x1b, 0x21, 0x02, 0x41, 0x80, 0x14, 0x41, 0x00, 0x41,
+  0x00, 0x2d, 0x00, 0x80, 0xf8, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x03, 0x41,
+  0x80, 0x16, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0xf8, 0xf7, 0x80, 0x80,
+  0x00, 0x1b, 0x21, 0x04, 0x41, 0x80, 0x18, 0x41, 0x00, 0x41, 0x00, 0x2d,
+  0x00, 0xf0, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x05, 0x41, 0x80, 0x1a,
+  0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0xe4, 0xf7, 0x80, 0x80, 0x00, 0x1b,
+  0x21, 0x06, 0x41, 0x80, 0x1c, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0xe0,
+  0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x07, 0x41, 0x80, 0x1e, 0x41, 0x00,
+  0x41, 0x00, 0x2d, 0x00, 0xd0, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x08,
+  0x41, 0x80, 0x1e, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0xc0, 0xf7, 0x80,
+  0x80, 0x00, 0x1b, 0x21, 0x09, 0x41, 0x80, 0x1c, 0x41, 0x00, 0x41, 0x00,
+  0x2d, 0x00, 0xb4, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x0a, 0x41, 0x80,
+  0x1a, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0xb0, 0xf7, 0x80, 0x80, 0x00,
+  0x1b, 0x21, 0x0b, 0x41, 0x80, 0x18, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00,
+  0xa8, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x0c, 0x41, 0x80, 0x16, 0x41,
+  0x00, 0x41, 0x00, 0x2d, 0x00, 0xa0, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21,
+  0x0d, 0x41, 0x80, 0x14, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0x94, 0xf7,
+  0x80, 0x80, 0x00, 0x1b, 0x21, 0x0e, 0x41, 0x80, 0x12, 0x41, 0x00, 0x41,
+  0x00, 0x2d, 0x00, 0x90, 0xf7, 0x80, 0x80, 0x00, 0x1b, 0x21, 0x0f, 0x41,
+  0x80, 0x10, 0x41, 0x00, 0x41, 0x00, 0x2d, 0x00, 0x80, 0xf7, 0x80, 0x80,
+  0x00, 0x1b, 0x21, 0x10, 0x41, 0x00, 0x21, 0x11, 0x03, 0x40, 0x41, 0x00,
+  0x21, 0x12, 0x03, 0x40, 0x20, 0x12, 0x41, 0xc0, 0xfc, 0x80, 0x80, 0x00,
+  0x6a, 0x20, 0x01, 0x20, 0x12, 0x41, 0xbe, 0xf8, 0x80, 0x80, 0x00, 0x6a,
+  0x2e, 0x01, 0x00, 0x6c, 0x20, 0x02, 0x20, 0x12, 0x41, 0xbc, 0xf8, 0x80,
+  0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x03, 0x20, 0x12, 0x41,
+  0xba, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x04,
+  0x20, 0x12, 0x41, 0xb8, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00,
+  0x6c, 0x20, 0x05, 0x20, 0x12, 0x41, 0xb6, 0xf8, 0x80, 0x80, 0x00, 0x6a,
+  0x2e, 0x01, 0x00, 0x6c, 0x20, 0x06, 0x20, 0x12, 0x41, 0xb4, 0xf8, 0x80,
+  0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x07, 0x20, 0x12, 0x41,
+  0xb2, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x08,
+  0x20, 0x12, 0x41, 0xb0, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00,
+  0x6c, 0x20, 0x09, 0x20, 0x12, 0x41, 0xae, 0xf8, 0x80, 0x80, 0x00, 0x6a,
+  0x2e, 0x01, 0x00, 0x6c, 0x20, 0x0a, 0x20, 0x12, 0x41, 0xac, 0xf8, 0x80,
+  0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x0b, 0x20, 0x12, 0x41,
+  0xaa, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x0c,
+  0x20, 0x12, 0x41, 0xa8, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00,
+  0x6c, 0x20, 0x0d, 0x20, 0x12, 0x41, 0xa6, 0xf8, 0x80, 0x80, 0x00, 0x6a,
+  0x2e, 0x01, 0x00, 0x6c, 0x20, 0x0e, 0x20, 0x12, 0x41, 0xa4, 0xf8, 0x80,
+  0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x0f, 0x20, 0x12, 0x41,
+  0xa2, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x6c, 0x20, 0x10,
+  0x20, 0x12, 0x41, 0xa0, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00,
+  0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+  0x6a, 0x6a, 0x6a, 0x6a, 0x41, 0x0f, 0x75, 0x22, 0x13, 0x41, 0x80, 0x80,
+  0x7e, 0x20, 0x13, 0x41, 0x80, 0x80, 0x7e, 0x4a, 0x1b, 0x22, 0x13, 0x41,
+  0xff, 0xff, 0x01, 0x20, 0x13, 0x41, 0xff, 0xff, 0x01, 0x48, 0x1b, 0x3b,
+  0x01, 0x00, 0x20, 0x12, 0x41, 0x02, 0x6a, 0x22, 0x12, 0x41, 0x80, 0x04,
+  0x47, 0x0d, 0x00, 0x0b, 0x20, 0x11, 0x41, 0xff, 0x01, 0x71, 0x41, 0x01,
+  0x74, 0x41, 0xbe, 0xf8, 0x80, 0x80, 0x00, 0x6a, 0x41, 0x00, 0x2e, 0x01,
+  0xbe, 0x80, 0x81, 0x80, 0x00, 0x41, 0x01, 0x76, 0x3b, 0x01, 0x00, 0x20,
+  0x11, 0x41, 0x01, 0x6a, 0x22, 0x11, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b,
+  0x0b, 0x0b, 0x6f, 0x01, 0x02, 0x7f, 0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78,
+  0x21, 0x00, 0x41, 0x80, 0x7c, 0x21, 0x01, 0x03, 0x40, 0x20, 0x00, 0x20,
+  0x01, 0x41, 0xc0, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0xc1, 0x80, 0x81,
+  0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08,
+  0x6c, 0x20, 0x01, 0x41, 0xc2, 0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0xc3,
+  0x80, 0x81, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83,
+  0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x01, 0x41, 0x04, 0x6a, 0x22, 0x01,
+  0x0d, 0x00, 0x0b, 0x20, 0x00, 0x0b, 0x0b, 0x88, 0x02, 0x01, 0x00, 0x41,
+  0x80, 0x20, 0x0b, 0x80, 0x02, 0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f,
+  0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9,
+  0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72,
+  0xc0, 0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5,
+  0xf1, 0x71, 0xd8, 0x31, 0x15, 0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05,
+  0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c,
+  0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f,
+  0x84, 0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe,
+  0x39, 0x4a, 0x4c, 0x58, 0xcf, 0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33,
+  0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40,
+  0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3,
+  0xd2, 0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e,
+  0x3d, 0x64, 0x5d, 0x19, 0x73, 0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90,
+  0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a,
+  0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4,
+  0x79, 0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4,
+  0xea, 0x65, 0x7a, 0xae, 0x08, 0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4,
+  0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5,
+  0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d,
+  0x9e, 0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87,
+  0xe9, 0xce, 0x55, 0x28, 0xdf, 0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42,
+  0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16, 0x00, 0xd1, 0x02,
+  0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x13, 0x12, 0x6b, 0x65, 0x72, 0x6e,
+  0x65, 0x6c, 0x73, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x2e, 0x77, 0x61,
+  0x73, 0x6d, 0x01, 0x94, 0x02, 0x16, 0x00, 0x08, 0x66, 0x69, 0x72, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x01, 0x09, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x02, 0x0c, 0x66, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x03, 0x08, 0x69, 0x69, 0x72, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x04, 0x09, 0x69, 0x69, 0x72, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x05, 0x0c, 0x69, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x06, 0x0b, 0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x07, 0x0c, 0x6d, 0x61, 0x74, 0x6d, 0x75,
+  0x6c, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x08, 0x0f, 0x6d, 0x61, 0x74,
+  0x6d, 0x75, 0x6c, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x09, 0x0a, 0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x0a, 0x0b, 0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x0b, 0x0e, 0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x0c, 0x08, 0x61, 0x65, 0x73, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x0d, 0x09, 0x61, 0x65, 0x73, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x0e, 0x0c, 0x61, 0x65, 0x73, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x0f, 0x09, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x10, 0x0a, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x11, 0x0a, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x5f, 0x73,
+  0x6f, 0x72, 0x74, 0x12, 0x0d, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x13, 0x08, 0x71, 0x31, 0x35, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x14, 0x09, 0x71, 0x31, 0x35, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x15, 0x0c, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x07, 0x12, 0x01, 0x00, 0x0f, 0x5f, 0x5f,
+  0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x09, 0x0a, 0x01, 0x00, 0x07, 0x2e, 0x72, 0x6f, 0x64, 0x61, 0x74,
+  0x61, 0x00, 0x2d, 0x09, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x72,
+  0x73, 0x01, 0x0c, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64,
+  0x2d, 0x62, 0x79, 0x01, 0x0c, 0x44, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x20,
+  0x63, 0x6c, 0x61, 0x6e, 0x67, 0x06, 0x31, 0x34, 0x2e, 0x30, 0x2e, 0x36
+};
+unsigned int kernels_bench_wasm_len = 10368;
@@ -64,6 +64,28 @@ M3CompilationScope;
 
 typedef M3CompilationScope *        IM3CompilationScope;
 
+// an emitted operation that the next one can still be fused into (see EmitFusableOp)
+typedef struct M3FusableOp
+{
+    IM3Operation                    op;
+    pc_t                            pc;                 // where op is in the code page
+    pc_t                            end;                // past its immediates
+}
+M3FusableOp;
+
+#define d_m3HasSecondRegisters          (d_m3HasReg1 || d_m3HasFp1)
+
+// a register value PreserveRegisterIfOccupied moved to a slot: while the value stays on the stack untouched,
+// the move can still become a copy to the second register of the same kind (see UseSecondRegister)
+typedef struct M3PreservedRegister
+{
+    IM3Operation                    op;                 // the SetSlot, maybe fused into the operation before it
+    pc_t                            pc;
+    u16                             stackIndex;
+    u16                             slot;
+}
+M3PreservedRegister;
+
 typedef struct
 {
     IM3Runtime          runtime;
@@ -107,9 +129,18 @@ typedef struct
 
     u16                 slotMaxAllocatedIndexPlusOne;
 
+#if d_m3HasSecondRegisters
+    u16                 regStackIndexPlusOne        [4];    // r0, fp0, r1, fp1
+
+    M3PreservedRegister preserved                   [2];    // r0, fp0
+#else
     u16                 regStackIndexPlusOne        [2];
+#endif
 
     m3opcode_t          previousOpcode;
+
+    M3FusableOp         lastOp;                     // the last operation emitted, if by EmitFusableOp
+    M3FusableOp         fusable;                    // lastOp of the previous opcode: only that can take in an operation of this one
 }
 M3Compilation;
 
@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+Confronto tra due insiemi di risultati (schema in bench_results.py) e
+generazione delle tabelle di benchmarks/README.md.
+
+    python bench_compare.py diff base.jsonl new.jsonl [--threshold 2] [--alpha 0.05]
+    python bench_compare.py render benchmarks/results/*.jsonl [--readme benchmarks/README.md] [--check]
+
+diff: accoppia le misure con la stessa chiave (bench_results.key; se un
+file ne contiene più d'una vale l'ultima) e per ognuna riporta la variazione
+della mediana e un p-value. Il test è un t di Welch sulle mediane: l'errore
+standard della mediana è stimato come 1.2533 * 1.4826 * MAD / sqrt(n) (MAD
+scalata a sigma, efficienza asintotica della mediana), i gradi di libertà
+con Welch-Satterthwaite; niente scipy, la t di Student passa dalla beta
+incompleta. Una misura è una regressione se peggiora di almeno --threshold
+per cento con p < --alpha; con n < 2 o senza MAD il p non è calcolabile e
+conta solo la soglia. Un checksum diverso è sempre segnalato: il kernel non
+calcola più la stessa cosa. Con --fail-on-regression esce con 1 se c'è
+almeno una regressione o un checksum diverso (per la CI).
+
+render: sostituisce le righe dati delle tabelle racchiuse tra
+
+    <!-- results target=f446re kernel=fft size=1024 unit=cycles baseline=baremetal/native/native -->
+    | Environment | Runtime / Mode | ... |
+    |---|---|---|---|
+    ...
+    <!-- /results -->
+
+tenendo intestazione e separatore. Filtri: target, os, runtime, mode,
+kernel, module, size, unit; baseline=os/runtime/mode è la riga a 1.00×;
+env="..." sostituisce il nome dell'ambiente (es. "Linux (WSL2)"). Le
+righe sono ordinate per runtime e poi per ambiente; per ogni chiave vale il
+record più recente tra quelli dati. --check non scrive e esce con 1 se il README
+non è aggiornato.
+"""
+import argparse
+import math
+import re
+import shlex
+import sys
+from pathlib import Path
+
+from bench_results import LOWER_IS_BETTER, key, key_str, load
+
+# sigma = 1.4826 * MAD (normale); SE(mediana) = 1.2533 * sigma / sqrt(n)
+MAD_TO_SE = 1.2533 * 1.4826
+
+
+# t di Student senza scipy: P(|T| > t) = I_x(df/2, 1/2) con x = df / (df + t^2)
+
+def _betacf(a: float, b: float, x: float) -> float:
+    """frazione continua della beta incompleta (Lentz)"""
+    tiny = 1e-300
+    qab, qap, qam = a + b, a + 1.0, a - 1.0
+    c, d = 1.0, 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        for aa in (m * (b - m) * x / ((qam + m2) * (a + m2)),
+                   -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))):
+            d = 1.0 + aa * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + aa / c
+            c = c if abs(c) > tiny else tiny
+            h *= d * c
+        if abs(d * c - 1.0) < 1e-14:
+            break
+    return h
+
+
+def _betai(a: float, b: float, x: float) -> float:
+    """beta incompleta regolarizzata I_x(a, b)"""
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    bt = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+                  + a * math.log(x) + b * math.log1p(-x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return bt * _betacf(a, b, x) / a
+    return 1.0 - bt * _betacf(b, a, 1.0 - x) / b
+
+
+def t_pvalue(t: float, df: float) -> float:
+    """p-value bilaterale della t di Student"""
+    return _betai(df / 2.0, 0.5, df / (df + t * t))
+
+
+def median_test(a: dict, b: dict) -> float | None:
+    """p-value della differenza tra le mediane di due stats, None se non calcolabile"""
+    na, nb = a.get("n", 1), b.get("n", 1)
+    if na < 2 or nb < 2 or a.get("mad") is None or b.get("mad") is None:
+        return None
+    va = (MAD_TO_SE * a["mad"]) ** 2 / na
+    vb = (MAD_TO_SE * b["mad"]) ** 2 / nb
+    diff = b["median"] - a["median"]
+    if va + vb == 0.0:
+        # misure senza dispersione (cicli esatti sugli MCU): conta solo se cambiano
+        return 0.0 if diff else 1.0
+    df = (va + vb) ** 2 / (va * va / (na - 1) + vb * vb / (nb - 1))
+    return t_pvalue(diff / math.sqrt(va + vb), df)
+
+
+def latest(records) -> dict:
+    """chiave -> ultimo record con quella chiave"""
+    out = {}
+    for rec in records:
+        out[key(rec)] = rec
+    return out
+
+
+# diff
+
+def diff(base: dict, new: dict, threshold: float, alpha: float) -> list[dict]:
+    rows = []
+    for k in sorted(base.keys() | new.keys(), key=lambda k: tuple(str(x) for x in k)):
+        a, b = base.get(k), new.get(k)
+        row = {"key": k, "base": a, "new": b, "verdict": None, "p": None, "delta_pct": None}
+        if a is None or b is None:
+            row["verdict"] = "nuovo" if a is None else "rimosso"
+            rows.append(row)
+            continue
+        ma, mb = a["stats"]["median"], b["stats"]["median"]
+        row["delta_pct"] = (mb - ma) / ma * 100.0 if ma else None
+        row["p"] = median_test(a["stats"], b["stats"])
+        worse = (mb > ma) == LOWER_IS_BETTER[a["unit"]]
+        significant = row["p"] is None or row["p"] < alpha
+        if a.get("checksum") and b.get("checksum") and a["checksum"] != b["checksum"]:
+            row["verdict"] = "CHECKSUM"
+        elif row["delta_pct"] is None or abs(row["delta_pct"]) < threshold or mb == ma:
+            row["verdict"] = "="
+        elif not significant:
+            row["verdict"] = "~"
+        else:
+            row["verdict"] = "peggio" if worse else "meglio"
+        rows.append(row)
+    return rows
+
+
+def _num(v) -> str:
+    return "-" if v is None else (f"{v:.0f}" if abs(v) >= 100 else f"{v:.3g}")
+
+
+def print_diff(rows, markdown: bool):
+    table = []
+    for r in rows:
+        a, b = r["base"], r["new"]
+        table.append((
+            key_str(r["key"]),
+            _num(a["stats"]["median"]) if a else "-",
+            _num(b["stats"]["median"]) if b else "-",
+            "-" if r["delta_pct"] is None else f"{r['delta_pct']:+.2f}%",
+            "n/d" if r["p"] is None else f"{r['p']:.3g}",
+            r["verdict"],
+        ))
+    head = ("misura", "base", "nuovo", "delta", "p", "esito")
+    if markdown:
+        print("| " + " | ".join(head) + " |")
+        print("|---|---:|---:|---:|---:|---|")
+        for t in table:
+            print("| " + " | ".join(t) + " |")
+        return
+    widths = [max(len(str(x)) for x in col) for col in zip(head, *table)]
+    for t in [head] + table:
+        print("  ".join(str(x).ljust(w) if i in (0, 5) else str(x).rjust(w)
+                        for i, (x, w) in enumerate(zip(t, widths))))
+
+
+# render
+
+OS_ORDER = ["baremetal", "freertos", "zephyr", "linux"]
+OS_LABEL = {"baremetal": "Bare-metal", "freertos": "FreeRTOS", "zephyr": "Zephyr", "linux": "Linux"}
+RUNTIME_ORDER = [
+    ("native", "native"), ("wasm3", "interp"), ("wamr", "interp"), ("wamr", "fast-interp"),
+    ("wamr", "aot"), ("wamr", "fast-jit"), ("wamr", "jit"), ("wamr", "multi-tier"),
+]
+RUNTIME_LABEL = {
+    ("native", "native"): "Native C",
+    ("wasm3", "interp"): "wasm3 (interpreter)",
+    ("wamr", "interp"): "WAMR (interpreter)",
+    ("wamr", "fast-interp"): "WAMR (fast interpreter)",
+    ("wamr", "aot"): "WAMR (AOT)",
+    ("wamr", "fast-jit"): "WAMR (Fast JIT)",
+    ("wamr", "jit"): "WAMR (LLVM JIT)",
+    ("wamr", "multi-tier"): "WAMR (multi-tier JIT)",
+}
+FILTERS = ("target", "os", "runtime", "mode", "kernel", "module", "size", "unit")
+
+RE_BLOCK = re.compile(r"(<!--\s*results\s+(.*?)\s*-->\n)(.*?)(<!--\s*/results\s*-->)", re.S)
+
+
+def _value(v: float, unit: str) -> str:
+    if unit == "hz":
+        for div, suffix in ((1e6, "MHz"), (1e3, "kHz"), (1.0, "Hz")):
+            if v >= div:
+                return f"{v / div:.3g} {suffix}"
+    if v >= 100:
+        return f"{v:,.0f}".replace(",", " ")
+    return f"{v:.3g}"
+
+
+def _ratio(x: float) -> str:
+    return f"{x:.2f}×" if x < 100 else f"{x:.1f}×"
+
+
+def _order(rec):
+    os_ = rec["os"]
+    rt = (rec["runtime"], rec["mode"])
+    return (RUNTIME_ORDER.index(rt) if rt in RUNTIME_ORDER else len(RUNTIME_ORDER), rt,
+            OS_ORDER.index(os_) if os_ in OS_ORDER else len(OS_ORDER), os_)
+
+
+def render_block(opts: dict, records) -> list[str]:
+    sel = []
+    for rec in records:
+        if all(str(rec.get(f) if f != "module" else (rec.get("module") or "").split(".", 1)[0])
+               == opts[f] for f in FILTERS if f in opts):
+            sel.append(rec)
+    if not sel:
+        raise ValueError(f"nessun record per {opts}")
+    sel.sort(key=_order)
+    base = None
+    if "baseline" in opts:
+        b_os, b_rt, b_mode = opts["baseline"].split("/")
+        base = next((r for r in sel if (r["os"], r["runtime"], r["mode"]) == (b_os, b_rt, b_mode)),
+                    None)
+        if base is None:
+            raise ValueError(f"baseline {opts['baseline']} assente per {opts}")
+    rows = []
+    for rec in sel:
+        v = rec["stats"]["median"]
+        env = opts.get("env", OS_LABEL.get(rec["os"], rec["os"]))
+        label = RUNTIME_LABEL.get((rec["runtime"], rec["mode"]), f"{rec['runtime']} ({rec['mode']})")
+        row = f"| {env} | {label} | **{_value(v, rec['unit'])}** |"
+        if base is not None:
+            bv = base["stats"]["median"]
+            ratio = v / bv if LOWER_IS_BETTER[rec["unit"]] else bv / v
+            row += f" **{_ratio(ratio)}** |"
+        rows.append(row)
+    return rows
+
+
+def render(text: str, records) -> str:
+    records = list(latest(records).values())
+
+    def repl(m):
+        opts = dict(kv.split("=", 1) for kv in shlex.split(m[2]))
+        lines = m[3].splitlines()
+        # intestazione e separatore della tabella restano quelli scritti a mano
+        head = [ln for ln in lines if ln.startswith("|")][:2]
+        if len(head) < 2:
+            raise ValueError(f"blocco results senza intestazione: {m[1].strip()}")
+        return m[1] + "\n".join(head + render_block(opts, records)) + "\n" + m[4]
+
+    return RE_BLOCK.sub(repl, text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Confronto dei risultati e tabelle del README")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("diff", help="Confronta due insiemi di risultati")
+    p.add_argument("base", help="File .jsonl di riferimento")
+    p.add_argument("new", help="File .jsonl da confrontare")
+    p.add_argument("--threshold", type=float, default=2.0,
+                   help="Variazione minima della mediana in percento (default 2)")
+    p.add_argument("--alpha", type=float, default=0.05, help="Livello di significatività")
+    p.add_argument("--only-changes", action="store_true", help="Nasconde le misure invariate")
+    p.add_argument("--markdown", action="store_true", help="Tabella markdown (commenti alle PR)")
+    p.add_argument("--fail-on-regression", action="store_true",
+                   help="Esce con 1 se c'è una regressione o un checksum diverso")
+
+    p = sub.add_parser("render", help="Rigenera le tabelle racchiuse nei marcatori results")
+    p.add_argument("files", nargs="+", help="File .jsonl (in ordine: vale l'ultimo record)")
+    p.add_argument("--readme", default=str(Path(__file__).resolve().parent / "benchmarks" / "README.md"))
+    p.add_argument("--check", action="store_true", help="Non scrive: esce con 1 se il README cambierebbe")
+
+    args = parser.parse_args()
+
+    if args.cmd == "diff":
+        rows = diff(latest(load([args.base])), latest(load([args.new])), args.threshold, args.alpha)
+        shown = [r for r in rows if not args.only_changes or r["verdict"] != "="]
+        print_diff(shown, args.markdown)
+        bad = [r for r in rows if r["verdict"] in ("peggio", "CHECKSUM")]
+        better = sum(1 for r in rows if r["verdict"] == "meglio")
+        print(f"\n{len(rows)} misure: {len(bad)} regressioni, {better} miglioramenti", file=sys.stderr)
+        return 1 if bad and args.fail_on_regression else 0
+
+    readme = Path(args.readme)
+    text = readme.read_text()
+    try:
+        out = render(text, load(args.files))
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 1
+    if out == text:
+        return 0
+    if args.check:
+        print(f"{readme}: tabelle non aggiornate (bench_compare.py render)", file=sys.stderr)
+        return 1
+    readme.write_text(out)
+    print(f"{readme}: tabelle aggiornate", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""
+Benchmark MCU su target emulati (QEMU, Renode): stesse app FFT di Zephyr
+(zephyrproject/z_*_fft_f4|f7), senza scheda né oscilloscopio, con metrica
+in istruzioni eseguite e risultati nello schema di bench_results.py.
+
+Le app compilate con BENCH_EMU misurano con k_cycle_get_32 e stampano la
+frequenza del contatore ("Clock: N Hz"). Il tempo virtuale dei due
+emulatori avanza con le istruzioni eseguite, non col tempo dell'host:
+  QEMU    -icount shift=S,align=off,sleep=off: 2^S ns per istruzione
+  Renode  PerformanceInMips M (zephyrproject/bench_emu/*.resc): M milioni
+          di istruzioni per secondo virtuale
+quindi istruzioni = cicli * (istruzioni per secondo virtuale) / Clock, e la
+misura è deterministica: due run dello stesso ELF danno gli stessi numeri,
+MAD compresa. A fine run si legge anche il totale delle istruzioni
+eseguite (QEMU: plugin libinsn; Renode: cpu ExecutedInstructions), salvato
+in extra.run_insns.
+
+    west build -b mps2/an385 zephyrproject/z_wasm3_fft_f4 -d build/emu_wasm3
+    python bench_emu.py qemu --board mps2/an385 --elf build/emu_wasm3/zephyr/zephyr.elf \\
+        -o benchmarks/results/emu.jsonl
+
+    west build -b nucleo_f446re zephyrproject/z_wamr_aot_fft_f4 -d build/renode_aot -- -DBENCH_EMU=ON
+    python bench_emu.py renode --family f4 --elf build/renode_aot/zephyr/zephyr.elf \\
+        -o benchmarks/results/emu.jsonl
+
+Le istruzioni non sono cicli (niente wait state, pipeline, cache): servono a
+confrontare interpreti e AOT e a vedere le regressioni, i cicli veri restano
+quelli delle schede.
+"""
+import argparse
+import os
+import re
+import signal
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from pathlib import Path
+
+from bench_results import git_sha, parse_uart, write
+
+REPO = Path(__file__).resolve().parent
+RENODE_DIR = REPO / "zephyrproject" / "bench_emu"
+
+# board Zephyr -> (macchina QEMU, CPU)
+QEMU_BOARDS = {
+    "mps2/an385": ("mps2-an385", "cortex-m3"),
+    "mps2/an500": ("mps2-an500", "cortex-m7"),
+    "qemu_cortex_m3": ("lm3s6965evb", "cortex-m3"),
+}
+# famiglia -> (script Renode, PerformanceInMips dello script)
+RENODE_FAMILIES = {
+    "f4": ("stm32f4_bench.resc", 180),
+    "f7": ("stm32f7_bench.resc", 216),
+}
+
+DONE = "BENCH DONE"
+RE_CLOCK = re.compile(r"^Clock: (\d+) Hz")
+RE_INSNS = re.compile(r"insns:\s*(\d+)")
+RE_NUMBER = re.compile(r"^\s*(0x[0-9a-fA-F]+|\d+)\s*$", re.M)
+
+# campi di stats in cicli (cv_pct, n e outliers non cambiano)
+SCALED = ("median", "mad", "min", "mean", "stddev", "ci95")
+
+
+def wait_done(lines, verbose: bool) -> list[str]:
+    """righe UART fino a DONE; l'iteratore finisce all'uscita dell'emulatore o al timeout"""
+    out = []
+    for line in lines:
+        if verbose:
+            print(line, file=sys.stderr)
+        out.append(line)
+        if line.strip() == DONE:
+            return out
+    raise TimeoutError(f"'{DONE}' non arrivato ({len(out)} righe lette)")
+
+
+def run_qemu(args) -> tuple[list[str], int | None, float]:
+    machine, cpu = QEMU_BOARDS[args.board]
+    cmd = [args.qemu, "-machine", machine, "-cpu", cpu, "-display", "none",
+           "-monitor", "none", "-serial", "stdio", "-kernel", args.elf,
+           "-icount", f"shift={args.shift},align=off,sleep=off"]
+    insn_log = None
+    if args.insn_plugin:
+        insn_log = tempfile.NamedTemporaryFile(prefix="bench_emu_", suffix=".log", delete=False)
+        insn_log.close()
+        cmd += ["-plugin", f"{args.insn_plugin},inline=on", "-d", "plugin", "-D", insn_log.name]
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stdin=subprocess.DEVNULL,
+                            text=True, errors="replace")
+    # al timeout QEMU muore, stdout si chiude e wait_done smette di aspettare
+    timer = threading.Timer(args.timeout, proc.kill)
+    timer.start()
+    try:
+        uart = wait_done((ln.rstrip("\r\n") for ln in proc.stdout), args.verbose)
+    finally:
+        timer.cancel()
+        # SIGTERM: QEMU esce pulito e libinsn scrive il totale
+        proc.send_signal(signal.SIGTERM)
+        proc.wait(timeout=10)
+    total = None
+    if insn_log:
+        text = Path(insn_log.name).read_text(errors="replace")
+        os.unlink(insn_log.name)
+        m = RE_INSNS.search(text)
+        total = int(m[1]) if m else None
+    return uart, total, 1e9 / (1 << args.shift)
+
+
+def renode_monitor(port: int, commands, timeout: float = 10.0) -> str:
+    """comandi al monitor di Renode (--port), ritorna l'output grezzo"""
+    out = b""
+    with socket.create_connection(("127.0.0.1", port), timeout=timeout) as s:
+        s.settimeout(1.0)
+        for cmd in commands:
+            s.sendall(cmd.encode() + b"\n")
+            time.sleep(0.5)
+            try:
+                while chunk := s.recv(65536):
+                    out += chunk
+            except socket.timeout:
+                pass
+    # via le sequenze ANSI del prompt
+    return re.sub(r"\x1b\[[0-9;]*[A-Za-z]", "", out.decode(errors="replace")).replace("\r", "")
+
+
+def run_renode(args) -> tuple[list[str], int | None, float]:
+    script, mips = RENODE_FAMILIES[args.family]
+    log = Path(tempfile.mkdtemp(prefix="bench_emu_")) / "uart.log"
+    log.touch()
+    # le variabili vanno impostate prima dello script (?= non le sovrascrive)
+    resc = log.with_name("run.resc")
+    resc.write_text(f"$bin=@{Path(args.elf).resolve()}\n$log=@{log}\n"
+                    f"include @{RENODE_DIR / script}\nstart\n")
+    proc = subprocess.Popen([args.renode, "--disable-xwt", "--console", "--port", str(args.port),
+                             str(resc)], cwd=RENODE_DIR, stdin=subprocess.DEVNULL,
+                            stdout=subprocess.DEVNULL if not args.verbose else None)
+
+    def lines():
+        """segue il file del backend UART come tail -f"""
+        deadline = time.monotonic() + args.timeout
+        buf = ""
+        with open(log, errors="replace") as f:
+            while proc.poll() is None and time.monotonic() < deadline:
+                chunk = f.read()
+                if not chunk:
+                    time.sleep(0.2)
+                    continue
+                buf += chunk
+                *done, buf = buf.split("\n")
+                for line in done:
+                    yield line.rstrip("\r")
+
+    total = None
+    try:
+        uart = wait_done(lines(), args.verbose)
+        out = renode_monitor(args.port, ["mach set 0", "pause", "sysbus.cpu ExecutedInstructions"])
+        m = RE_NUMBER.findall(out)
+        total = int(m[-1], 0) if m else None
+        renode_monitor(args.port, ["quit"])
+    finally:
+        try:
+            proc.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            proc.kill()
+    return uart, total, mips * 1e6
+
+
+def to_insns(records, insns_per_cycle: float, extra: dict):
+    for rec in records:
+        rec["stats"] = {k: (v * insns_per_cycle if k in SCALED else v)
+                        for k, v in rec["stats"].items()}
+        rec["unit"] = "insns"
+        rec["extra"].update(extra)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark MCU su QEMU/Renode, in istruzioni eseguite")
+    sub = parser.add_subparsers(dest="emulator", required=True)
+
+    p = sub.add_parser("qemu", help="Board QEMU di Zephyr")
+    p.add_argument("--board", required=True, choices=sorted(QEMU_BOARDS))
+    p.add_argument("--shift", type=int, default=0,
+                   help="-icount shift: 2^shift ns virtuali per istruzione (default 0)")
+    p.add_argument("--qemu", default="qemu-system-arm")
+    p.add_argument("--insn-plugin", help="libinsn.so di QEMU per il totale delle istruzioni")
+
+    p = sub.add_parser("renode", help="STM32F4/F7 su Renode (build nucleo con -DBENCH_EMU=ON)")
+    p.add_argument("--family", required=True, choices=sorted(RENODE_FAMILIES))
+    p.add_argument("--renode", default="renode")
+    p.add_argument("--port", type=int, default=1234, help="Porta del monitor di Renode")
+
+    for p in sub.choices.values():
+        p.add_argument("--elf", required=True, help="zephyr.elf dell'app FFT")
+        p.add_argument("--target", help="Default: qemu-<macchina> o renode-stm32<famiglia>")
+        p.add_argument("--timeout", type=float, default=1800.0, help="Secondi di host")
+        p.add_argument("--compiler")
+        p.add_argument("--flags")
+        p.add_argument("--log", help="Salva qui il log UART")
+        p.add_argument("-o", "--out", default="-", help="File .jsonl (in append, '-' = stdout)")
+        p.add_argument("--verbose", action="store_true", help="Mostra l'UART mentre gira")
+
+    args = parser.parse_args()
+
+    if args.emulator == "qemu":
+        target = args.target or "qemu-" + QEMU_BOARDS[args.board][0]
+        emu_extra = {"emulator": "qemu", "board": args.board, "icount_shift": args.shift}
+        run = run_qemu
+    else:
+        target = args.target or f"renode-stm32{args.family}"
+        emu_extra = {"emulator": "renode", "mips": RENODE_FAMILIES[args.family][1]}
+        run = run_renode
+
+    try:
+        uart, total, ips = run(args)
+    except (OSError, TimeoutError, subprocess.TimeoutExpired) as e:
+        print(f"{args.emulator}: {e}", file=sys.stderr)
+        return 1
+    if args.log:
+        Path(args.log).write_text("\n".join(uart) + "\n")
+
+    clock = next((int(m[1]) for ln in uart if (m := RE_CLOCK.match(ln.strip()))), None)
+    if clock is None:
+        print("manca 'Clock: N Hz': l'ELF non è compilato con BENCH_EMU", file=sys.stderr)
+        return 1
+
+    base = {"source": "bench_emu", "target": target, "compiler": args.compiler,
+            "flags": args.flags, "git_sha": git_sha()}
+    try:
+        records = parse_uart(uart, base, fft_size=1024, iters=10, hostcall_iters=1000,
+                             rounds=20, startup_rounds=10)
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 1
+    if not records:
+        print("nessun risultato nel log UART", file=sys.stderr)
+        return 1
+    to_insns(records, ips / clock, {**emu_extra, "clock_hz": clock,
+                                     "insns_per_cycle": ips / clock, "run_insns": total})
+    write(args.out, records)
+    print(f"{len(records)} record, {total if total is not None else '?'} istruzioni in totale",
+          file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,487 @@
+#!/usr/bin/env python3
+"""
+Footprint flash/RAM per configurazione, dai prodotti della build invece che
+a mano: la tabella di benchmarks/README.md ("Memory usage") più la
+ripartizione per componente (kernel, runtime wasm, agent, modulo incluso).
+
+Per ogni build si leggono, se ci sono:
+  *.elf                     totali, dalle section header (come `size`):
+                            flash = sezioni allocate con contenuto (text,
+                            rodata, immagine di data), RAM statica = sezioni
+                            scrivibili o NOBITS (data, bss, noinit)
+  *.map                     linker map di GNU ld (zephyr/zephyr.map o
+                            Debug/<progetto>.map di STM32CubeIDE): byte per
+                            file oggetto, da cui la ripartizione
+  rom.json / ram.json       output di `west build -t rom_report / ram_report`
+                            (size_report di Zephyr, da DWARF): se presenti
+                            sostituiscono il .map nella ripartizione
+e dal log UART dell'app (opzionale) i numeri che a compile time non ci sono:
+  Footprint: heap_live=N heap_peak=N stack_used=N stack_size=N
+                            app FFT Zephyr wasm3/WAMR: picco dell'heap del
+                            runtime e watermark dello stack del thread che
+                            esegue il modulo (CONFIG_INIT_STACKS)
+  STATUS_OK ... wamr_highmark=N ...
+                            agent (firmware/): highmark del pool WAMR da
+                            wasm_runtime_get_mem_alloc_info
+
+    west build -b nucleo_f446re zephyrproject/z_wasm3_fft_f4 -d build/wasm3_f4
+    west build -d build/wasm3_f4 -t rom_report && west build -d build/wasm3_f4 -t ram_report
+    python bench_footprint.py build/wasm3_f4 build/wamr_interp_f4 build/wamr_aot_f4 \\
+        --uart build/wasm3_f4=wasm3_f4.log --detail --markdown
+
+    python bench_footprint.py frt=freertos/frt_wasm3_fft_f4/Debug      # STM32CubeIDE
+
+La RAM statica comprende già i buffer preallocati (pool WAMR, heap di Zephyr
+con CONFIG_HEAP_MEM_POOL_SIZE): heap e stack misurati dicono quanto di quei
+buffer serve davvero, non vanno sommati.
+"""
+import argparse
+import json
+import re
+import struct
+import sys
+from pathlib import Path
+
+from bench_results import BANNERS
+
+# ---------------------------------------------------------------- ELF
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+
+def elf_sections(path) -> list[dict]:
+    """section header di un ELF 32/64 bit: name, type, flags, addr, size"""
+    data = Path(path).read_bytes()
+    if data[:4] != b"\x7fELF":
+        raise ValueError(f"{path}: non è un ELF")
+    is64 = data[4] == 2
+    end = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x3A)
+        fmt = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x2E)
+        fmt = end + "IIIIIIIIII"
+    raw = [struct.unpack_from(fmt, data, shoff + i * shentsize) for i in range(shnum)]
+    strtab = raw[shstrndx]
+    names = data[strtab[4]:strtab[4] + strtab[5]]
+    out = []
+    for name, typ, flags, addr, _off, size, *_ in raw:
+        out.append({"name": names[name:names.index(b"\0", name)].decode(),
+                    "type": typ, "flags": flags, "addr": addr, "size": size})
+    return out
+
+
+def elf_totals(path) -> dict:
+    flash = ram = 0
+    alloc = {}
+    for s in elf_sections(path):
+        if not s["flags"] & SHF_ALLOC or s["size"] == 0:
+            continue
+        alloc[s["name"]] = s
+        if s["type"] != SHT_NOBITS:
+            flash += s["size"]
+        if s["type"] == SHT_NOBITS or s["flags"] & SHF_WRITE:
+            ram += s["size"]
+    return {"flash": flash, "ram": ram, "sections": alloc}
+
+
+# ---------------------------------------------------------------- .map
+
+RE_REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S+))?\s*$")
+RE_OUT = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$")
+RE_IN = re.compile(r"^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*?)\s*$")
+RE_CONT = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*?))?\s*$")
+RE_CONT_OUT = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$")
+
+# se manca l'ELF: sezioni che non finiscono sul target e sezioni senza contenuto
+NOT_ALLOC = re.compile(r"^\.(debug|comment|ARM\.attributes|stab|gnu\.attributes|symtab|strtab|shstrtab)")
+NOBITS = re.compile(r"^\.?(bss|noinit|heap|_user_heap_stack|tbss)")
+
+
+def map_entries(path, alloc: dict | None = None) -> list[dict]:
+    """righe della linker map: section, out, obj, flash (byte), ram (byte).
+
+    Le regioni con attributo 'w' sono RAM, le altre flash. Un'uscita con
+    "load address" in flash (.data, .ramfunc) conta nelle due; il tipo delle
+    sezioni (NOBITS) viene dall'ELF, se c'è."""
+    regions = []
+    entries = []
+    out_name = None         # sezione di uscita corrente
+    out_flash = out_ram = False
+    pending = None          # nome su una riga, numeri sulla successiva
+    pending_out = False
+    state = None
+
+    def region_of(addr):
+        for origin, length, is_ram in regions:
+            if origin <= addr < origin + length:
+                return is_ram
+        return None
+
+    def start_out(name, addr, lma):
+        nonlocal out_name, out_flash, out_ram
+        out_name = name
+        if alloc is not None:
+            sec = alloc.get(name)
+            if sec is None:
+                out_flash = out_ram = False
+                return
+            nobits = sec["type"] == SHT_NOBITS
+            write = bool(sec["flags"] & SHF_WRITE)
+        elif NOT_ALLOC.match(name):
+            out_flash = out_ram = False
+            return
+        else:
+            nobits = write = bool(NOBITS.match(name))
+        if not regions:
+            out_ram, out_flash = nobits or write, not nobits
+            return
+        vma_ram = region_of(addr)
+        lma_ram = region_of(lma) if lma is not None else vma_ram
+        out_ram = nobits or vma_ram is True
+        out_flash = not nobits and lma_ram is False
+
+    def add_in(section, addr, size, obj):
+        if size == 0 or not (out_flash or out_ram):
+            return
+        entries.append({"section": section, "out": out_name, "obj": obj.strip(), "addr": addr,
+                        "size": size, "flash": out_flash, "ram": out_ram})
+
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Memory Configuration"):
+                state = "regions"
+                continue
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            if state == "regions":
+                m = RE_REGION.match(line)
+                if m and m[1] not in ("Name", "*default*"):
+                    regions.append((int(m[2], 16), int(m[3], 16), "w" in (m[4] or "")))
+                continue
+            if state != "map":
+                continue
+
+            if pending is not None:
+                if pending_out:
+                    m = RE_CONT_OUT.match(line)
+                    if m:
+                        start_out(pending, int(m[1], 16), int(m[3], 16) if m[3] else None)
+                else:
+                    m = RE_CONT.match(line)
+                    if m and m[3]:
+                        add_in(pending, int(m[1], 16), int(m[2], 16), m[3])
+                pending = None
+                if m:
+                    continue
+
+            if line and not line[0].isspace():
+                m = RE_OUT.match(line)
+                if m:
+                    start_out(m[1], int(m[2], 16), int(m[4], 16) if m[4] else None)
+                elif " " not in line.strip() and not line.startswith(("LOAD", "OUTPUT", "START", "END")):
+                    pending, pending_out = line.strip(), True
+                continue
+            if line.startswith(" *fill*"):
+                parts = line.split()
+                if len(parts) >= 3:
+                    add_in("*fill*", int(parts[1], 16), int(parts[2], 16), "*fill*")
+                continue
+            m = RE_IN.match(line)
+            if m:
+                add_in(m[1], int(m[2], 16), int(m[3], 16), m[4])
+                continue
+            if re.match(r"^ [.A-Za-z_]\S*$", line) and not line.startswith(" *"):
+                pending, pending_out = line[1:], False
+    # le stringhe fuse (.rodata.*.str1.1) compaiono con la dimensione prima
+    # della fusione e si sovrappongono: ogni byte va al primo che lo copre
+    entries.sort(key=lambda e: (e["out"], e["addr"]))
+    prev_out, prev_end = None, 0
+    for e in entries:
+        if e["out"] != prev_out:
+            prev_out, prev_end = e["out"], 0
+        end = e["addr"] + e["size"]
+        size = max(0, end - max(e["addr"], prev_end))
+        prev_end = max(prev_end, end)
+        e["flash"] = size if e["flash"] else 0
+        e["ram"] = size if e["ram"] else 0
+    return entries
+
+
+# ---------------------------------------------------------------- size_report
+
+def size_report_leaves(path):
+    """foglie di rom.json/ram.json: (percorso, simbolo, byte)"""
+    tree = json.loads(Path(path).read_text())["symbols"]
+
+    def walk(node, parents):
+        children = node.get("children")
+        if not children:
+            yield "/".join(parents), node.get("name", ""), node.get("size", 0)
+            return
+        for child in children:
+            yield from walk(child, parents + [node.get("name", "")])
+
+    yield from walk(tree, [])
+
+
+# ---------------------------------------------------------------- componenti
+
+# array di xxd -i (fft_bench_wasm, toggle_aot, ..._len): solo tra i dati, le
+# funzioni dei runtime finiscono spesso in _wasm
+MODULE_SYMBOL = re.compile(r"(?:^|[._])\w+_(wasm|aot)(_len)?$")
+DATA_SECTION = re.compile(r"^\.?(rodata|data|sdata)\b")
+
+# (regex sul percorso dell'oggetto o sul nome del file, componente); vince la prima
+RULES = [
+    # wasm3
+    (r"(^|[/(])m3_exec\.", "wasm3/exec"),
+    (r"(^|[/(])m3_(compile|emit|code)\.", "wasm3/compile"),
+    (r"(^|[/(])m3_(parse|module|bind)\.", "wasm3/parse"),
+    (r"(^|[/(])m3_", "wasm3/core"),
+    # WAMR
+    (r"(core/iwasm/interpreter|(^|[/(])wasm_(interp_\w+|loader|mini_loader|runtime)\.)", "wamr/interp"),
+    (r"(core/iwasm/aot|(^|[/(])aot_\w+\.)", "wamr/aot"),
+    (r"(core/iwasm/libraries/libc-builtin|libc_builtin_wrapper)", "wamr/libc-builtin"),
+    (r"(core/shared/mem-alloc|(^|[/(])(ems_\w+|mem_alloc)\.)", "wamr/mem-alloc"),
+    (r"(core/shared/(platform|utils)|(^|[/(])(bh_\w+|zephyr_(platform|thread|time|file|socket)|"
+     r"runtime_timer|posix_\w+)\.)", "wamr/platform"),
+    (r"(core/iwasm/common|(^|[/(])(wasm_\w+|invokeNative\w*)\.)", "wamr/common"),
+    # librerie C e del compilatore
+    (r"(lib(c|c_nano|m|g|gcc|nosys|stdc\+\+|picolibc|c\+\+)\.a|(^|/)crt\w*\.o|lib/libc/|"
+     r"liblib__libc__\w+\.a|newlib|picolibc)", "libc"),
+    # FreeRTOS (STM32CubeIDE)
+    (r"(FreeRTOS|(^|[/(])(tasks|queue|list|timers|port|heap_\d|event_groups|stream_buffer|"
+     r"croutine|cmsis_os2?)\.o)", "freertos"),
+    # HAL/CMSIS
+    (r"(HAL_Driver|hal_stm32|modules/hal|(^|[/(])(stm32\w+_(hal|ll)\w*|system_stm32\w+|"
+     r"startup_stm32\w+|stm32\w+_it|stm32\w+_hal_msp|syscalls|sysmem)\.o)", "hal"),
+    # Zephyr
+    (r"(zephyr/(kernel|arch|drivers|soc|subsys|lib|boards|misc)|zephyr_final\.dir|isr_tables|libkernel\.a|libzephyr\.a|"
+     r"libarch__\w+\.a|libdrivers__\w+\.a|libsoc__\w+\.a|libsubsys__\w+\.a|libos\.a|"
+     r"liblib__\w+\.a|libisr_tables\.a|libcortex_m\w*\.a|libarm\w*\.a|ZEPHYR_BASE|"
+     r"(^|/)kernel/|(^|/)arch/)", "zephyr"),
+    # firmware dell'orchestratore
+    (r"zephyrproject/firmware", "agent"),
+    # app: libapp.a di Zephyr, Core/Src di CubeIDE
+    (r"(libapp\.a|(^|/)app/|Core/Src|(^|/)src/)", "app"),
+]
+RULES = [(re.compile(rx), comp) for rx, comp in RULES]
+
+
+def component(obj: str, symbol: str = "", app: str = "app") -> str:
+    """symbol: nome della sezione di ingresso (.map) o del simbolo (size_report)"""
+    for rx, comp in RULES:
+        if rx.search(obj):
+            if comp.startswith(("wasm3/", "wamr/")):
+                return comp
+            break
+    else:
+        comp = "other"
+    if MODULE_SYMBOL.search(symbol):
+        return "module"
+    return app if comp == "app" else comp
+
+
+COMPONENT_ORDER = ["zephyr", "freertos", "hal", "libc", "wasm3/core", "wasm3/parse",
+                   "wasm3/compile", "wasm3/exec", "wamr/common", "wamr/interp", "wamr/aot",
+                   "wamr/mem-alloc", "wamr/platform", "wamr/libc-builtin", "agent", "app",
+                   "module", "other"]
+
+
+def breakdown_map(entries, app: str) -> dict:
+    out = {}
+    for e in entries:
+        # con -fdata-sections il simbolo è nel nome della sezione (.rodata.fft_bench_wasm)
+        comp = component(e["obj"], e["section"] if DATA_SECTION.match(e["section"]) else "", app)
+        c = out.setdefault(comp, {"flash": 0, "ram": 0})
+        c["flash"] += e["flash"]
+        c["ram"] += e["ram"]
+    return out
+
+
+def breakdown_reports(rom: Path | None, ram: Path | None, app: str) -> dict:
+    out = {}
+    for path, field in ((rom, "flash"), (ram, "ram")):
+        if not path:
+            continue
+        for parents, symbol, size in size_report_leaves(path):
+            comp = component(parents, symbol, app)
+            out.setdefault(comp, {"flash": 0, "ram": 0})[field] += size
+    return out
+
+
+# ---------------------------------------------------------------- UART
+
+RE_FOOTPRINT = re.compile(r"^Footprint:((?:\s+\w+=\d+)+)\s*$")
+RE_STATUS = re.compile(r"^STATUS_OK\b.*\bwamr_total=(\d+).*\bwamr_highmark=(\d+)")
+RE_STACK_FREE = re.compile(r":stack_free=(\d+)")
+
+
+def parse_uart(lines) -> dict:
+    """ultimi valori di Footprint/STATUS_OK nel log, più il banner dell'app"""
+    rt = {}
+    for line in lines:
+        line = line.strip()
+        if line in BANNERS and "banner" not in rt:
+            rt["banner"] = line
+        elif (m := RE_FOOTPRINT.match(line)):
+            rt.update({k: int(v) for k, v in (kv.split("=") for kv in m[1].split())})
+        elif (m := RE_STATUS.match(line)):
+            rt["pool_size"], rt["heap_peak"] = int(m[1]), int(m[2])
+            free = [int(x) for x in RE_STACK_FREE.findall(line)]
+            if free:
+                rt["stack_free_min"] = min(free)
+    return rt
+
+
+# ---------------------------------------------------------------- build
+
+def find_one(build: Path, patterns) -> Path | None:
+    for pattern in patterns:
+        hits = sorted(build.glob(pattern))
+        if hits:
+            return hits[0]
+    return None
+
+
+def analyze(build: Path, app: str, uart: Path | None) -> dict:
+    if build.is_file():
+        elf, build = build, build.parent
+    else:
+        elf = find_one(build, ["zephyr/zephyr.elf", "*.elf", "zephyr/*.elf"])
+    mapf = find_one(build, ["zephyr/zephyr.map", "*.map", "zephyr/*.map"])
+    rom = find_one(build, ["rom.json", "zephyr/rom.json"])
+    ram = find_one(build, ["ram.json", "zephyr/ram.json"])
+    if not (elf or mapf):
+        raise FileNotFoundError(f"{build}: né .elf né .map")
+
+    res = {"build": str(build), "elf": str(elf) if elf else None,
+           "map": str(mapf) if mapf else None}
+    alloc = None
+    if elf:
+        tot = elf_totals(elf)
+        res["flash"], res["ram"] = tot["flash"], tot["ram"]
+        alloc = tot["sections"]
+    entries = map_entries(mapf, alloc) if mapf else []
+    if not elf:
+        res["flash"] = sum(e["flash"] for e in entries)
+        res["ram"] = sum(e["ram"] for e in entries)
+
+    if rom or ram:
+        res["source"] = "size_report"
+        res["components"] = breakdown_reports(rom, ram, app)
+    elif entries:
+        res["source"] = "map"
+        res["components"] = breakdown_map(entries, app)
+    else:
+        res["source"] = "elf"
+        res["components"] = {}
+    if uart:
+        res["runtime"] = parse_uart(Path(uart).read_text(errors="replace").splitlines())
+    return res
+
+
+# ---------------------------------------------------------------- output
+
+def kib(n) -> str:
+    return f"{n / 1024:.2f} KiB" if n is not None else "-"
+
+
+def table(rows, markdown: bool) -> list[str]:
+    if markdown:
+        out = ["| " + " | ".join(rows[0]) + " |",
+               "|---|" + "---:|" * (len(rows[0]) - 1)]
+        out += ["| " + " | ".join(r) + " |" for r in rows[1:]]
+        return out
+    widths = [max(len(r[i]) for r in rows) for i in range(len(rows[0]))]
+    return ["  ".join(c.ljust(w) if i == 0 else c.rjust(w)
+                      for i, (c, w) in enumerate(zip(r, widths))) for r in rows]
+
+
+def summary(results, markdown: bool) -> list[str]:
+    rows = [["Configuration", "Flash (ROM)", "Static RAM", "Heap peak", "Stack peak"]]
+    for name, r in results:
+        rt = r.get("runtime", {})
+        stack = rt.get("stack_used")
+        if stack is not None and rt.get("stack_size"):
+            stack_s = f"{kib(stack)} / {kib(rt['stack_size'])}"
+        else:
+            stack_s = kib(stack)
+        rows.append([name, kib(r["flash"]), kib(r["ram"]), kib(rt.get("heap_peak")), stack_s])
+    return table(rows, markdown)
+
+
+def detail(name, r, markdown: bool) -> list[str]:
+    comps = r["components"]
+    order = [c for c in COMPONENT_ORDER if c in comps] + sorted(set(comps) - set(COMPONENT_ORDER))
+    rows = [[f"{name} ({r['source']})", "Flash", "RAM"]]
+    for c in order:
+        if comps[c]["flash"] or comps[c]["ram"]:
+            rows.append([c, kib(comps[c]["flash"]), kib(comps[c]["ram"])])
+    rows.append(["total", kib(sum(c["flash"] for c in comps.values())),
+                 kib(sum(c["ram"] for c in comps.values()))])
+    return table(rows, markdown)
+
+
+def split_spec(spec: str) -> tuple[str | None, str]:
+    """'nome=percorso' o 'percorso'"""
+    name, sep, path = spec.partition("=")
+    return (name, path) if sep and not Path(spec).exists() else (None, spec)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Footprint flash/RAM per build (ELF, .map, rom/ram_report)")
+    parser.add_argument("builds", nargs="+", metavar="[NOME=]BUILD",
+                        help="Cartella di build (Zephyr o Debug/ di CubeIDE) o file .elf")
+    parser.add_argument("--uart", action="append", default=[], metavar="[NOME=]LOG",
+                        help="Log UART della build con lo stesso nome (o dell'unica build)")
+    parser.add_argument("--app", default="app",
+                        help="Componente a cui attribuire il codice dell'app (es. agent per firmware/)")
+    parser.add_argument("--detail", action="store_true", help="Ripartizione per componente")
+    parser.add_argument("--markdown", action="store_true")
+    parser.add_argument("--json", metavar="FILE", help="Scrive anche i risultati in JSON")
+    args = parser.parse_args()
+
+    builds = [split_spec(b) for b in args.builds]
+    uarts = {}
+    for spec in args.uart:
+        name, path = split_spec(spec)
+        if name is None:
+            if len(builds) != 1:
+                parser.error("--uart senza nome vale solo con una build")
+            name = builds[0][0] or builds[0][1]
+        uarts[name] = path
+
+    results = []
+    for name, path in builds:
+        label = name or path
+        try:
+            r = analyze(Path(path), args.app, uarts.get(label))
+        except (OSError, ValueError, struct.error) as e:
+            print(e, file=sys.stderr)
+            return 1
+        # senza nome: il banner dell'app nel log, poi la cartella
+        if name is None:
+            name = r.get("runtime", {}).get("banner") or Path(path).name
+        results.append((name, r))
+
+    print("\n".join(summary(results, args.markdown)))
+    if args.detail:
+        for name, r in results:
+            print()
+            print("\n".join(detail(name, r, args.markdown)))
+    if args.json:
+        Path(args.json).write_text(json.dumps({name: r for name, r in results}, indent=2) + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""
+Profili di operazioni degli interpreti: quante volte ogni kernel esegue
+ogni operazione (op di wasm3, opcode di WAMR) e ogni coppia di operazioni
+consecutive, per capire dove un interprete perde sull'altro e quali coppie
+conviene fondere in una superistruzione.
+
+    python bench_opprof.py report  prof.jsonl uart.log ... [--kernel fft] [--runtime wasm3-prof] [--top 15]
+    python bench_opprof.py compare prof.jsonl ... [--kernel fft] [--top 10]
+    python bench_opprof.py pairs   prof.jsonl ... [--runtime wasm3-prof] [--top 30]
+
+Ingressi: i record di linux_bench --opcode-profile (build con
+-DLINUX_BENCH_OPCODE_PROFILE=ON) e i log UART delle app Zephyr compilate
+con -DOPCODE_PROFILE=ON, dove lo stesso record sta su una riga che inizia
+con "opprof ". Le altre righe dei log si ignorano. Un record:
+
+    {"source": "linux_bench" | "zephyr", "target": "host-x86_64" | board,
+     "runtime", "kernel", "module", "size", "iterations", "reps",
+     "ops": {op: esecuzioni}, "pairs": {"op op_successiva": esecuzioni},
+     "total": somma di ops, "dropped": coppie fuori dalla tabella}
+
+I conteggi coprono i round misurati (reps round da iterations iterazioni)
+e si riportano per iterazione, così host e MCU si confrontano anche con
+iters diversi.
+
+report: per ogni (target, runtime, kernel, size) le operazioni per
+iterazione e le più eseguite con la loro quota. compare: per ogni kernel
+le operazioni per iterazione dei vari runtime, in rapporto al primo, con
+le operazioni principali di ognuno: il numero di dispatch spiega buona parte
+della distanza tra interpreti (a parità di costo per dispatch). pairs: le
+coppie più frequenti di un runtime sommando le quote dei kernel, così ogni
+kernel pesa uguale anche se esegue molte più operazioni degli altri.
+"""
+import argparse
+import json
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+PREFIX = "opprof "
+
+
+def load(paths) -> list[dict]:
+    """record da file JSON Lines o log UART, nell'ordine"""
+    records = []
+    for path in paths:
+        for n, line in enumerate(Path(path).read_text(errors="replace").splitlines(), 1):
+            line = line.strip()
+            if line.startswith(PREFIX):
+                line = line[len(PREFIX):]
+            elif not line.startswith("{"):
+                continue
+            try:
+                rec = json.loads(line)
+            except json.JSONDecodeError as e:
+                print(f"{path}:{n}: record troncato ({e.msg})", file=sys.stderr)
+                continue
+            if "ops" in rec:
+                records.append(rec)
+    return records
+
+
+def key(rec) -> tuple:
+    return (rec.get("target", "?"), rec["runtime"], rec["kernel"], rec.get("size"))
+
+
+def key_str(k) -> str:
+    target, runtime, kernel, size = k
+    return f"{target} {runtime} {kernel}" + (f"@{size}" if size else "")
+
+
+def per_iter(rec) -> float:
+    """esecuzioni misurate per iterazione del kernel"""
+    return max(1, rec["iterations"] * rec["reps"])
+
+
+def latest(records, runtime=None, kernel=None) -> dict:
+    """chiave -> ultimo record con quella chiave, filtrati per runtime/kernel"""
+    out = {}
+    for rec in records:
+        if runtime and rec["runtime"] != runtime:
+            continue
+        if kernel and rec["kernel"] != kernel:
+            continue
+        out[key(rec)] = rec
+    return out
+
+
+def top(counts: dict, n: int) -> list[tuple[str, int]]:
+    return sorted(counts.items(), key=lambda kv: (-kv[1], kv[0]))[:n]
+
+
+def _num(v: float) -> str:
+    return f"{v:,.0f}".replace(",", " ") if v >= 100 else f"{v:.3g}"
+
+
+# report
+
+def report(records: dict, n: int):
+    for k, rec in sorted(records.items(), key=lambda kv: tuple(str(x) for x in kv[0])):
+        total = sum(rec["ops"].values()) or 1
+        div = per_iter(rec)
+        print(f"{key_str(k)}: {_num(total / div)} op/iterazione, {len(rec['ops'])} op distinte"
+              + (f", {rec['dropped']} coppie perse" if rec.get("dropped") else ""))
+        for op, c in top(rec["ops"], n):
+            print(f"  {op:<40} {_num(c / div):>12} {100.0 * c / total:6.2f}%")
+        pairs_total = sum(rec["pairs"].values()) or 1
+        for pair, c in top(rec["pairs"], min(n, 5)):
+            print(f"  {pair:<60} {100.0 * c / pairs_total:6.2f}% delle coppie")
+        print()
+
+
+# compare
+
+def compare(records: dict, n: int):
+    groups = defaultdict(list)
+    for (target, runtime, kernel, size), rec in records.items():
+        groups[(target, kernel, size)].append(rec)
+    for (target, kernel, size), recs in sorted(groups.items(), key=lambda kv: tuple(str(x) for x in kv[0])):
+        recs.sort(key=lambda r: r["runtime"])
+        base = sum(recs[0]["ops"].values()) / per_iter(recs[0]) or 1.0
+        print(f"{target} {kernel}" + (f"@{size}" if size else ""))
+        for rec in recs:
+            total = sum(rec["ops"].values()) or 1
+            ops = total / per_iter(rec)
+            main = ", ".join(f"{op} {100.0 * c / total:.0f}%" for op, c in top(rec["ops"], n))
+            print(f"  {rec['runtime']:<24} {_num(ops):>12} op/it  {ops / base:5.2f}×  {main}")
+        print()
+
+
+# pairs
+
+def pairs(records: dict, n: int):
+    by_runtime = defaultdict(lambda: defaultdict(float))
+    kernels = defaultdict(set)
+    for (target, runtime, kernel, size), rec in records.items():
+        total = sum(rec["pairs"].values())
+        if not total:
+            continue
+        kernels[runtime].add((target, kernel, size))
+        for pair, c in rec["pairs"].items():
+            by_runtime[runtime][pair] += c / total
+    for runtime in sorted(by_runtime):
+        weights = by_runtime[runtime]
+        num = len(kernels[runtime])
+        print(f"{runtime}: coppie più frequenti su {num} kernel (quota media)")
+        for pair, w in top(weights, n):
+            print(f"  {pair:<60} {100.0 * w / num:6.2f}%")
+        print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Profili di operazioni di wasm3 e WAMR")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+    for name, help_ in (("report", "Operazioni e coppie principali per kernel"),
+                        ("compare", "Operazioni per iterazione dei runtime a confronto"),
+                        ("pairs", "Coppie candidate a superistruzione per runtime")):
+        p = sub.add_parser(name, help=help_)
+        p.add_argument("files", nargs="+", help="File .jsonl di linux_bench o log UART")
+        p.add_argument("--runtime", help="Solo questo runtime (es. wasm3-prof, wamr-interp)")
+        p.add_argument("--kernel", help="Solo questo kernel (es. fft, hc_void)")
+        p.add_argument("--top", type=int, default=15 if name != "compare" else 3,
+                       help="Voci per gruppo")
+
+    args = parser.parse_args()
+    records = latest(load(args.files), args.runtime, args.kernel)
+    if not records:
+        print("nessun record opprof", file=sys.stderr)
+        return 1
+    {"report": report, "compare": compare, "pairs": pairs}[args.cmd](records, args.top)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
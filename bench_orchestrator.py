@@ -0,0 +1,477 @@
+#!/usr/bin/env python3
+"""
+Generatore di carico e benchmark di latenza per il percorso di orchestrazione
+host -> gateway -> device.
+
+Pilota un mix configurabile di status/start/load/stop verso un gateway, in
+open-loop (rate target, latenze corrette per coordinated omission: il tempo
+parte dall'istante *previsto* di invio, non da quando un worker si libera)
+oppure in closed-loop (concorrenza fissa). Riporta throughput e
+p50/p99/p999 e scrive un JSON per il tracking delle regressioni; con
+--results aggiunge un record per operazione all'archivio di bench_results.py
+(kernel "orchestrator:<op>", size = rate o concorrenza).
+
+Esempio, tutto in locale contro 8 device simulati (linux/linux_agent_sim):
+
+    python bench_orchestrator.py --spawn-gateway --spawn-sim 8 \\
+        --sim-arg=--baud=115200 \\
+        --mix status=70,start=20,load=5,stop=5 --rate 20 --duration 30 \\
+        --module wasm/math_ops/math_ops.wasm --json bench.json
+"""
+import argparse
+import binascii
+import json
+import os
+import random
+import socket
+import statistics
+import subprocess
+import sys
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+from bench_results import git_sha, make_record
+from bench_results import write as write_results
+from host import send_request
+
+
+OPS = ("status", "start", "load", "stop")
+PERCENTILES = (50.0, 90.0, 99.0, 99.9)
+
+
+# Mix e payload
+
+def parse_mix(text: str) -> dict:
+    mix = {}
+    for part in text.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        name, sep, weight = part.partition("=")
+        name = name.strip()
+        if name not in OPS:
+            raise ValueError(f"operazione sconosciuta nel mix: {name}")
+        mix[name] = float(weight) if sep else 1.0
+    if not mix or sum(mix.values()) <= 0:
+        raise ValueError("mix vuoto")
+    return mix
+
+
+class RequestFactory:
+    """Costruisce (payload, blob, timeout) per ogni operazione del mix."""
+
+    def __init__(self, args, blob: bytes | None):
+        self.args = args
+        self.blob = blob
+        self.blob_crc = (f"{binascii.crc32(blob) & 0xFFFFFFFF:08x}"
+                         if blob is not None else None)
+
+    def build(self, op: str, device: str):
+        a = self.args
+        if op == "status":
+            return {"cmd": "status", "device": device}, None, a.timeout
+        if op == "start":
+            payload = {
+                "cmd": "start",
+                "device": device,
+                "module_id": a.module_id,
+                "func_args": a.func_args or "",
+                "wait_result": True,
+                "result_timeout": a.timeout,
+            }
+            if a.func:
+                payload["func_name"] = a.func
+            return payload, None, a.timeout + 5.0
+        if op == "stop":
+            payload = {
+                "cmd": "stop",
+                "device": device,
+                "module_id": a.module_id,
+                "result_timeout": a.timeout,
+            }
+            return payload, None, a.timeout + 5.0
+        if op == "load":
+            payload = {
+                "cmd": "load",
+                "device": device,
+                "module_id": a.module_id,
+                "blob_size": len(self.blob),
+                "blob_crc32": self.blob_crc,
+                "replace": True,
+            }
+            if a.enc != "raw":
+                payload["enc"] = a.enc
+            # il blob è sempre lo stesso: con delta il load si ridurrebbe a
+            # una patch di pochi byte, quindi va chiesto esplicitamente
+            if not a.delta:
+                payload["delta"] = False
+            return payload, self.blob, a.timeout + 20.0
+        raise ValueError(op)
+
+
+# Registrazione campioni
+
+class Recorder:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.samples = []   # (op, intended, started, finished, ok, error)
+
+    def add(self, op, intended, started, finished, ok, error):
+        with self.lock:
+            self.samples.append((op, intended, started, finished, ok, error))
+
+
+def percentile(sorted_vals, p: float) -> float | None:
+    # nearest-rank: con pochi campioni p999 coincide col massimo, ed è giusto così
+    if not sorted_vals:
+        return None
+    k = max(0, min(len(sorted_vals) - 1,
+                   int(-(-p * len(sorted_vals) // 100)) - 1))
+    return sorted_vals[k]
+
+
+def summarize(samples, window_s: float) -> dict:
+    lat = sorted((f - i) * 1000.0 for _, i, _, f, ok, _ in samples if ok)
+    svc = sorted((f - s) * 1000.0 for _, _, s, f, ok, _ in samples if ok)
+    errors = sum(1 for s in samples if not s[4])
+    out = {
+        "count": len(samples),
+        "ok": len(lat),
+        "errors": errors,
+        "throughput_rps": (len(lat) / window_s) if window_s > 0 else 0.0,
+        "latency_ms": {
+            "mean": (sum(lat) / len(lat)) if lat else None,
+            "min": lat[0] if lat else None,
+            "max": lat[-1] if lat else None,
+        },
+        "service_ms": {
+            "p50": percentile(svc, 50.0),
+            "p99": percentile(svc, 99.0),
+        },
+    }
+    for p in PERCENTILES:
+        key = "p" + (f"{p:g}".replace(".", ""))
+        out["latency_ms"][key] = percentile(lat, p)
+    first_errors = {}
+    for s in samples:
+        if not s[4] and s[5] and s[5] not in first_errors:
+            first_errors[s[5]] = True
+            if len(first_errors) >= 5:
+                break
+    if first_errors:
+        out["sample_errors"] = list(first_errors)
+    return out
+
+
+# Esecuzione di una singola richiesta
+
+def do_request(args, factory, recorder, op, device, intended):
+    payload, blob, timeout = factory.build(op, device)
+    started = time.perf_counter()
+    ok, error = False, None
+    try:
+        resp = send_request(args.gw_host, args.gw_port, payload,
+                            blob=blob, timeout=timeout)
+        if resp is None:
+            error = "nessuna risposta dal gateway"
+        elif resp.get("ok"):
+            ok = True
+        else:
+            error = str(resp.get("error", resp))[:160]
+    except OSError as e:
+        error = f"{type(e).__name__}: {e}"
+    finished = time.perf_counter()
+    recorder.add(op, intended, started, finished, ok, error)
+
+
+def op_sequence(mix: dict, seed: int):
+    rng = random.Random(seed)
+    names = list(mix)
+    weights = [mix[n] for n in names]
+    while True:
+        yield rng.choices(names, weights)[0]
+
+
+def run_open_loop(args, factory, recorder, mix, devices):
+    """Arrivi a rate fisso (o poissoniani); latenza misurata dall'istante previsto."""
+    ops = op_sequence(mix, args.seed)
+    rng = random.Random(args.seed + 1)
+    total_s = args.warmup + args.duration
+    period = 1.0 / args.rate
+    with ThreadPoolExecutor(max_workers=args.max_inflight) as pool:
+        t0 = time.perf_counter()
+        intended = t0
+        i = 0
+        while intended - t0 < total_s:
+            now = time.perf_counter()
+            if intended > now:
+                time.sleep(intended - now)
+            pool.submit(do_request, args, factory, recorder,
+                        next(ops), devices[i % len(devices)], intended)
+            i += 1
+            if args.arrival == "poisson":
+                intended += rng.expovariate(args.rate)
+            else:
+                intended += period
+    return t0
+
+
+def run_closed_loop(args, factory, recorder, mix, devices):
+    """Concorrenza fissa: ogni worker invia la richiesta successiva appena riceve la risposta."""
+    ops = op_sequence(mix, args.seed)
+    ops_lock = threading.Lock()
+    t0 = time.perf_counter()
+    deadline = t0 + args.warmup + args.duration
+
+    def worker(idx):
+        device = devices[idx % len(devices)]
+        while True:
+            now = time.perf_counter()
+            if now >= deadline:
+                return
+            with ops_lock:
+                op = next(ops)
+            do_request(args, factory, recorder, op, device, now)
+
+    threads = [threading.Thread(target=worker, args=(k,), daemon=True)
+               for k in range(args.concurrency)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return t0
+
+
+# Gateway locale
+
+def wait_port(host: str, port: int, timeout: float) -> bool:
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        try:
+            with socket.create_connection((host, port), timeout=0.5):
+                return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def spawn_gateway(args):
+    gw = Path(__file__).resolve().parent / "gateway.py"
+    cmd = [sys.executable, str(gw), "--host", args.gw_host, "--port", str(args.gw_port)]
+    for spec in args.device_endpoint:
+        cmd += ["--device-endpoint", spec]
+    if args.spawn_sim:
+        cmd += ["--spawn-sim", str(args.spawn_sim)]
+        cmd += [f"--sim-arg={a}" for a in args.sim_arg]
+    cmd += args.gateway_arg
+    print("avvio gateway:", " ".join(cmd), file=sys.stderr)
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL,
+                            stderr=None if args.verbose else subprocess.DEVNULL)
+    if not wait_port(args.gw_host, args.gw_port, args.spawn_timeout):
+        proc.terminate()
+        raise RuntimeError("il gateway non ha aperto la porta in tempo")
+    return proc
+
+
+# Report
+
+def results_records(report: dict, measured) -> list[dict]:
+    """un record bench_results per operazione: latenza end-to-end in ms"""
+    cfg = report["config"]
+    open_loop = cfg["mode"] == "open"
+    records = []
+    for op in cfg["mix"]:
+        lat = sorted((f - i) * 1000.0 for o, i, _, f, ok, _ in measured if ok and o == op)
+        if not lat:
+            continue
+        med = statistics.median(lat)
+        r = report["per_op"][op]
+        records.append(make_record(
+            source="bench_orchestrator", git_sha=report["git_sha"],
+            target="sim" if cfg["spawn_sim"] else ",".join(cfg["devices"]),
+            os="host", runtime="gateway", mode=cfg["mode"],
+            kernel=f"orchestrator:{op}", module=cfg["module"],
+            size=cfg["rate"] if open_loop else cfg["concurrency"], unit="ms",
+            stats={"n": len(lat), "median": med,
+                   "mad": statistics.median(abs(x - med) for x in lat),
+                   "min": lat[0], "mean": statistics.fmean(lat)},
+            checksum=None,
+            extra={"p99_ms": r["latency_ms"]["p99"], "p999_ms": r["latency_ms"]["p999"],
+                   "max_ms": lat[-1], "errors": r["errors"],
+                   "throughput_rps": r["throughput_rps"], "enc": cfg["enc"],
+                   "delta": cfg["delta"], "devices": len(cfg["devices"])},
+        ))
+    return records
+
+
+def print_report(report: dict):
+    cfg = report["config"]
+    mode = (f"open-loop {cfg['rate']:g} req/s ({cfg['arrival']})"
+            if cfg["mode"] == "open" else f"closed-loop c={cfg['concurrency']}")
+    print(f"\nbench_orchestrator: {mode}, {cfg['duration']:g}s "
+          f"(+{cfg['warmup']:g}s warmup), device={','.join(cfg['devices'])}")
+    hdr = f"{'op':<8}{'ok':>7}{'err':>6}{'rps':>9}{'p50':>10}{'p99':>10}{'p999':>10}{'max':>10}"
+    print(hdr)
+    print("-" * len(hdr))
+    def ms(v):
+        return f"{v:>10.2f}" if v is not None else f"{'-':>10}"
+
+    rows = [("all", report["overall"])] + sorted(report["per_op"].items())
+    for name, r in rows:
+        lat = r["latency_ms"]
+        print(f"{name:<8}{r['ok']:>7}{r['errors']:>6}{r['throughput_rps']:>9.2f}"
+              f"{ms(lat['p50'])}{ms(lat['p99'])}{ms(lat['p999'])}{ms(lat['max'])}")
+    print("(latenze in ms" + (", corrette per coordinated omission)"
+                              if cfg["mode"] == "open" else ")"))
+    for e in report["overall"].get("sample_errors", []):
+        print("  errore:", e)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Load generator e benchmark di latenza host -> gateway -> device"
+    )
+    parser.add_argument("--gw-host", default="127.0.0.1", help="Hostname o IP del gateway")
+    parser.add_argument("--gw-port", type=int, default=9000, help="Porta TCP del gateway")
+    parser.add_argument("--device", action="append",
+                        help="ID logico del device (ripetibile: round-robin; "
+                             "default con --spawn-sim: tutti i simulatori)")
+    parser.add_argument("--mix", default="status=1",
+                        help='Pesi delle operazioni, es. "status=70,start=20,load=5,stop=5"')
+
+    g_mode = parser.add_mutually_exclusive_group()
+    g_mode.add_argument("--rate", type=float,
+                        help="Open-loop: richieste/s target (latenze corrette per coordinated omission)")
+    g_mode.add_argument("--concurrency", type=int,
+                        help="Closed-loop: numero di client concorrenti (default 1)")
+    parser.add_argument("--arrival", choices=["uniform", "poisson"], default="uniform",
+                        help="Distribuzione degli arrivi in open-loop")
+    parser.add_argument("--max-inflight", type=int, default=256,
+                        help="Richieste contemporanee massime in open-loop")
+    parser.add_argument("--duration", type=float, default=10.0, help="Durata misura (s)")
+    parser.add_argument("--warmup", type=float, default=2.0, help="Warmup escluso dalle statistiche (s)")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--timeout", type=float, default=10.0, help="Timeout per richiesta (s)")
+
+    parser.add_argument("--module", help="File .wasm/.aot usato da load (e precaricato per start/stop)")
+    parser.add_argument("--module-id", default="bench")
+    parser.add_argument("--func", default="add", help="Funzione chiamata da start")
+    parser.add_argument("--func-args", default="a=1,b=2")
+    parser.add_argument("--enc", choices=["raw", "lz4"], default="raw",
+                        help="Codifica del blob per load (enc del protocollo LOAD)")
+    parser.add_argument("--delta", action="store_true",
+                        help="Consenti LOAD delta=1 rispetto all'immagine già caricata")
+    parser.add_argument("--no-preload", action="store_true",
+                        help="Non caricare il modulo prima della misura")
+
+    parser.add_argument("--spawn-gateway", action="store_true",
+                        help="Avvia gateway.py in locale per la durata del bench")
+    parser.add_argument("--device-endpoint", action="append", default=[],
+                        metavar="NOME=ENDPOINT", help="Passato al gateway avviato con --spawn-gateway")
+    parser.add_argument("--spawn-sim", type=int, default=0, metavar="N",
+                        help="Con --spawn-gateway: il gateway avvia N agent_sim (sim0..simN-1)")
+    parser.add_argument("--sim-arg", action="append", default=[],
+                        help="Argomento per ogni agent_sim, es. --sim-arg=--baud=115200 (ripetibile)")
+    parser.add_argument("--gateway-arg", action="append", default=[],
+                        help="Argomento extra per il gateway avviato (ripetibile)")
+    parser.add_argument("--spawn-timeout", type=float, default=10.0)
+
+    parser.add_argument("--json", help="Scrive il report JSON in questo file ('-' = stdout)")
+    parser.add_argument("--results", help="Aggiunge i record bench_results a questo .jsonl")
+    parser.add_argument("--verbose", action="store_true")
+    args = parser.parse_args()
+
+    try:
+        mix = parse_mix(args.mix)
+    except ValueError as e:
+        parser.error(str(e))
+    if args.rate is None and args.concurrency is None:
+        args.concurrency = 1
+    if args.rate is not None and args.rate <= 0:
+        parser.error("--rate deve essere > 0")
+    if args.spawn_sim and not args.spawn_gateway:
+        parser.error("--spawn-sim richiede --spawn-gateway")
+    if not args.device:
+        if not args.spawn_sim:
+            parser.error("serve almeno un --device")
+        args.device = [f"sim{i}" for i in range(args.spawn_sim)]
+
+    blob = None
+    if args.module:
+        blob = Path(args.module).read_bytes()
+    elif "load" in mix or (not args.no_preload and ("start" in mix or "stop" in mix)):
+        parser.error("il mix contiene load/start/stop: serve --module")
+
+    gw_proc = spawn_gateway(args) if args.spawn_gateway else None
+    try:
+        factory = RequestFactory(args, blob)
+        devices = args.device
+
+        if blob is not None and not args.no_preload:
+            for device in devices:
+                payload, b, timeout = factory.build("load", device)
+                resp = send_request(args.gw_host, args.gw_port, payload, blob=b, timeout=timeout)
+                if not resp or not resp.get("ok"):
+                    print(f"preload su {device} fallito: {resp}", file=sys.stderr)
+                    return 2
+
+        recorder = Recorder()
+        if args.rate is not None:
+            t0 = run_open_loop(args, factory, recorder, mix, devices)
+        else:
+            t0 = run_closed_loop(args, factory, recorder, mix, devices)
+    finally:
+        if gw_proc is not None:
+            gw_proc.terminate()
+            gw_proc.wait(timeout=5)
+
+    measure_start = t0 + args.warmup
+    measured = [s for s in recorder.samples if s[1] >= measure_start]
+    if measured:
+        window = max(s[3] for s in measured) - measure_start
+    else:
+        window = 0.0
+
+    report = {
+        "tool": "bench_orchestrator",
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+        "git_sha": git_sha(),
+        "config": {
+            "mode": "open" if args.rate is not None else "closed",
+            "rate": args.rate,
+            "arrival": args.arrival,
+            "concurrency": args.concurrency,
+            "duration": args.duration,
+            "warmup": args.warmup,
+            "mix": mix,
+            "devices": devices,
+            "spawn_sim": args.spawn_sim,
+            "module": os.path.basename(args.module) if args.module else None,
+            "module_size": len(blob) if blob is not None else None,
+            "enc": args.enc,
+            "delta": args.delta,
+            "gateway": f"{args.gw_host}:{args.gw_port}",
+            "coordinated_omission_corrected": args.rate is not None,
+        },
+        "window_s": window,
+        "overall": summarize(measured, window),
+        "per_op": {op: summarize([s for s in measured if s[0] == op], window)
+                   for op in mix},
+    }
+
+    print_report(report)
+    if args.json:
+        text = json.dumps(report, indent=2)
+        if args.json == "-":
+            print(text)
+        else:
+            Path(args.json).write_text(text + "\n")
+    if args.results:
+        write_results(args.results, results_records(report, measured))
+    return 0 if report["overall"]["errors"] == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,327 @@
+#!/usr/bin/env python3
+"""
+Archivio dei risultati dei benchmark: uno schema comune (JSON Lines, un
+record per misura) scritto da tutti gli harness. bench_compare.py confronta
+due insiemi di record e rigenera le tabelle di benchmarks/README.md.
+
+Chi scrive i record:
+  linux_bench --format results      direttamente, con SHA git, compilatore e
+                                    flag della build
+  bench_results.py uart LOG ...     dal log UART delle app MCU (bare-metal,
+                                    FreeRTOS, Zephyr): report FFT, righe delle
+                                    suite e fasi di avvio
+  bench_orchestrator.py --results   latenze host -> gateway -> device
+
+Record (SCHEMA_VERSION 1), un oggetto JSON per riga:
+  schema, source, date, git_sha      date (UTC ISO 8601) e SHA possono essere null
+  target      scheda o host: "f446re", "f746zg", "host-x86_64", ...
+  os          baremetal | freertos | zephyr | linux | (altro per gli harness di sistema)
+  runtime     native | wasm3 | wamr | gateway
+  mode        native | interp | fast-interp | aot | jit | fast-jit | multi-tier | ...
+  compiler, flags                    stringhe o null
+  kernel      "fft", "crc32", "hc_void", "startup:<fase>", "orchestrator:<op>", ...
+  module      file del modulo o null
+  size        N del kernel o null
+  iterations  iterazioni per round: le statistiche sono per iterazione
+  unit        cycles | insns | ns | ms | hz (hz: più alto è meglio; insns:
+              istruzioni eseguite sui target emulati, vedi bench_emu.py)
+  stats       n e median; mad, min, mean, stddev, ci95, cv_pct, outliers
+              se l'harness li ha (senza mad il confronto non dà la significatività)
+  memory      byte: peak_bytes, live_bytes, flash, static_ram, ... ({} se non misurata)
+  checksum    "0x%08x" o null
+  extra       campi liberi dell'harness
+
+La chiave di confronto è (target, os, runtime, mode, modulo senza
+estensione, kernel, size, unit): due record con la stessa chiave misurano
+la stessa cosa.
+
+    python bench_results.py uart zephyr_wamr_aot_f446re.log --target f446re \\
+        --compiler "arm-none-eabi-gcc 12.3" --flags "-O2" -o benchmarks/results/f446re.jsonl
+    python bench_results.py show benchmarks/results/*.jsonl
+"""
+import argparse
+import json
+import re
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+SCHEMA_VERSION = 1
+
+REQUIRED = ("schema", "source", "target", "os", "runtime", "mode", "kernel",
+            "iterations", "unit", "stats")
+UNITS = ("cycles", "insns", "ns", "ms", "hz")
+LOWER_IS_BETTER = {"cycles": True, "insns": True, "ns": True, "ms": True, "hz": False}
+
+
+def git_sha() -> str | None:
+    try:
+        res = subprocess.run(["git", "rev-parse", "HEAD"], capture_output=True,
+                             text=True, cwd=Path(__file__).resolve().parent)
+        return res.stdout.strip() or None
+    except OSError:
+        return None
+
+
+def make_record(**fields) -> dict:
+    """record completo: i campi non dati prendono i default dello schema"""
+    rec = {
+        "schema": SCHEMA_VERSION,
+        "source": None,
+        "date": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "git_sha": None,
+        "target": None,
+        "os": None,
+        "runtime": None,
+        "mode": None,
+        "compiler": None,
+        "flags": None,
+        "kernel": None,
+        "module": None,
+        "size": None,
+        "iterations": 1,
+        "unit": None,
+        "stats": {},
+        "memory": {},
+        "checksum": None,
+        "extra": {},
+    }
+    rec.update(fields)
+    return rec
+
+
+def validate(rec: dict) -> list[str]:
+    problems = [f"manca {k}" for k in REQUIRED if rec.get(k) is None]
+    if rec.get("schema") not in (None, SCHEMA_VERSION):
+        problems.append(f"schema {rec['schema']} non supportato (atteso {SCHEMA_VERSION})")
+    if rec.get("unit") is not None and rec["unit"] not in UNITS:
+        problems.append(f"unit {rec['unit']} sconosciuta")
+    stats = rec.get("stats") or {}
+    for k in ("n", "median"):
+        if k not in stats:
+            problems.append(f"manca stats.{k}")
+    return problems
+
+
+def key(rec: dict) -> tuple:
+    module = rec.get("module")
+    stem = module.split(".", 1)[0] if module else None
+    return (rec["target"], rec["os"], rec["runtime"], rec["mode"], stem,
+            rec["kernel"], rec.get("size"), rec["unit"])
+
+
+def key_str(k: tuple) -> str:
+    target, os_, runtime, mode, stem, kernel, size, unit = k
+    name = f"{stem}:{kernel}" if stem else kernel
+    if size is not None:
+        name += f"@{size}"
+    return f"{target}/{os_}/{runtime}-{mode} {name} [{unit}]"
+
+
+def load(paths) -> list[dict]:
+    """record di uno o più file .jsonl, nell'ordine; un record non valido è un errore"""
+    records = []
+    for path in paths:
+        text = sys.stdin.read() if str(path) == "-" else Path(path).read_text()
+        for lineno, line in enumerate(text.splitlines(), 1):
+            line = line.strip()
+            if not line:
+                continue
+            rec = json.loads(line)
+            problems = validate(rec)
+            if problems:
+                raise ValueError(f"{path}:{lineno}: " + ", ".join(problems))
+            records.append(rec)
+    return records
+
+
+def write(path, records, append: bool = True):
+    text = "".join(json.dumps(r, separators=(",", ":")) + "\n" for r in records)
+    if str(path) == "-":
+        sys.stdout.write(text)
+        return
+    with open(path, "a" if append else "w") as f:
+        f.write(text)
+
+
+# Log UART delle app MCU
+
+# banner stampato prima del report FFT -> (os, runtime, mode)
+BANNERS = {
+    "Bare metal": ("baremetal", "native", "native"),
+    "Baremetal + wasm3": ("baremetal", "wasm3", "interp"),
+    "FreeRTOS": ("freertos", "native", "native"),
+    "FreeRTOS + wasm3": ("freertos", "wasm3", "interp"),
+    "Zephyr": ("zephyr", "native", "native"),
+    "Zephyr + wasm3": ("zephyr", "wasm3", "interp"),
+    "Zephyr + WAMR": ("zephyr", "wamr", "interp"),
+    "Zephyr + WAMR(AOT)": ("zephyr", "wamr", "aot"),
+}
+
+# bench_stats_print
+RE_ROUNDS = re.compile(r"^Rounds: (\d+) \(outliers (\d+)\)$")
+RE_MEDIAN = re.compile(r"^Median cycles per FFT: (\d+)$")
+RE_MAD = re.compile(r"^MAD: (\d+)\s+Min: (\d+)$")
+RE_MEAN = re.compile(r"^Mean: (\d+) \+- (\d+) \(95% CI\)$")
+RE_CV = re.compile(r"^CV: (\d+)\.(\d)%$")
+RE_RESULT = re.compile(r"^RESULT: (OK|FAIL)")
+# kernel di suites_bench (wasm/suites, SUITES_NAMES): le altre righe sono
+# di kernels_bench o, con il prefisso hc_, di hostcall_bench
+SUITES_KERNELS = ("coremark", "dhrystone")
+SUITES_PREFIX = "pb_"
+
+# bench_stats_print_row (suite dei kernel, host call, suite di WAMR e varianti
+# FFT, queste come "kernel@n")
+RE_ROW = re.compile(r"^(\S+)\s+median (\d+)\s+MAD (\d+)\s+min (\d+)\s+CV (\d+)\.(\d)%"
+                    r"\s+checksum (0x[0-9a-fA-F]+)$")
+# fasi di avvio
+RE_STARTUP = re.compile(r"^(\S+)\s+(\S+)\s+median (\d+)\s+MAD (\d+)\s+min (\d+)"
+                        r"\s+peak (\d+) B\s+\((\d+) B\)$")
+
+
+def parse_uart(lines, base: dict, fft_size: int, iters: int, hostcall_iters: int,
+               rounds: int, startup_rounds: int) -> list[dict]:
+    """
+    Record da un log UART (anche più run di fila). Il banner del report FFT
+    fissa os/runtime/mode per le righe che seguono; senza banner valgono
+    quelli di base (--os/--runtime/--mode).
+    """
+    records = []
+    ctx = {k: base.get(k) for k in ("os", "runtime", "mode")}
+    fft = None
+
+    def emit(**fields):
+        rec = make_record(**{**base, **ctx, **fields})
+        problems = validate(rec)
+        if problems:
+            raise ValueError(f"{fields.get('kernel')}: " + ", ".join(problems)
+                             + " (banner mancante? usare --os/--runtime/--mode)")
+        records.append(rec)
+
+    for raw in lines:
+        line = raw.strip()
+        if line in BANNERS:
+            ctx = dict(zip(("os", "runtime", "mode"), BANNERS[line]))
+            continue
+
+        m = RE_ROUNDS.match(line)
+        if m:
+            fft = {"n": int(m[1]), "outliers": int(m[2])}
+            continue
+        if fft is not None:
+            if (m := RE_MEDIAN.match(line)):
+                fft["median"] = int(m[1])
+            elif (m := RE_MAD.match(line)):
+                fft["mad"], fft["min"] = int(m[1]), int(m[2])
+            elif (m := RE_MEAN.match(line)):
+                fft["mean"], fft["ci95"] = int(m[1]), int(m[2])
+            elif (m := RE_CV.match(line)):
+                fft["cv_pct"] = int(m[1]) + int(m[2]) / 10
+                emit(kernel="fft", module="fft_bench", size=fft_size, iterations=iters,
+                     unit="cycles", stats=fft)
+                fft = None
+            continue
+        if (m := RE_RESULT.match(line)) and records:
+            records[-1]["extra"]["result"] = m[1]
+            continue
+
+        m = RE_ROW.match(line)
+        if m:
+            # "fft_r2@256": variante del modulo FFT alla taglia dopo la @
+            kernel, _, size = m[1].partition("@")
+            hostcall = kernel.startswith("hc_")
+            if size:
+                module = "fft_bench"
+            elif hostcall:
+                module = "hostcall_bench"
+            elif kernel in SUITES_KERNELS or kernel.startswith(SUITES_PREFIX):
+                module = "suites_bench"
+            else:
+                module = "kernels_bench"
+            emit(kernel=kernel, module=module, size=int(size) if size else None,
+                 iterations=hostcall_iters if hostcall else iters, unit="cycles",
+                 stats={"n": rounds, "median": int(m[2]), "mad": int(m[3]),
+                        "min": int(m[4]), "cv_pct": int(m[5]) + int(m[6]) / 10},
+                 checksum=m[7].lower())
+            continue
+
+        m = RE_STARTUP.match(line)
+        if m:
+            emit(kernel=f"startup:{m[2]}", module=m[1], iterations=1, unit="cycles",
+                 stats={"n": startup_rounds, "median": int(m[3]), "mad": int(m[4]),
+                        "min": int(m[5])},
+                 memory={"peak_bytes": int(m[6])}, extra={"module_bytes": int(m[7])})
+    return records
+
+
+def show(records):
+    rows = [(key_str(key(r)), r["stats"]["median"], r["stats"].get("mad"), r.get("checksum") or "",
+             (r.get("git_sha") or "")[:12], r.get("date") or "") for r in records]
+    width = max([len(r[0]) for r in rows] + [3])
+    print(f"{'misura':<{width}} {'mediana':>14} {'MAD':>10}  {'checksum':<10} {'sha':<12} data")
+    for name, med, mad, cks, sha, date in rows:
+        mad = "-" if mad is None else f"{mad:.1f}"
+        print(f"{name:<{width}} {med:>14.1f} {mad:>10}  {cks:<10} {sha:<12} {date}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Archivio dei risultati dei benchmark")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("uart", help="Converte un log UART delle app MCU in record")
+    p.add_argument("log", help="Log UART ('-' = stdin)")
+    p.add_argument("--target", required=True, help="Scheda, es. f446re, f746zg")
+    p.add_argument("--os", help="Se il log non ha il banner: baremetal, freertos, zephyr")
+    p.add_argument("--runtime", help="Se il log non ha il banner: native, wasm3, wamr")
+    p.add_argument("--mode", help="Se il log non ha il banner: native, interp, aot")
+    p.add_argument("--compiler")
+    p.add_argument("--flags")
+    p.add_argument("--git-sha", help="Default: HEAD del repository")
+    p.add_argument("--fft-size", type=int, default=1024, help="N della FFT (FFT_N)")
+    p.add_argument("--iters", type=int, default=10, help="FFT/kernel per round (NUM_ITER)")
+    p.add_argument("--hostcall-iters", type=int, default=1000,
+                   help="Chiamate per round (HOSTCALL_MCU_ITERS)")
+    p.add_argument("--rounds", type=int, default=20, help="Round misurati (NUM_ROUNDS)")
+    p.add_argument("--startup-rounds", type=int, default=10, help="STARTUP_ROUNDS")
+    p.add_argument("-o", "--out", default="-", help="File .jsonl (in append, '-' = stdout)")
+
+    p = sub.add_parser("show", help="Elenca i record")
+    p.add_argument("files", nargs="+")
+
+    p = sub.add_parser("check", help="Valida i record")
+    p.add_argument("files", nargs="+")
+
+    args = parser.parse_args()
+
+    if args.cmd == "uart":
+        text = sys.stdin.read() if args.log == "-" else Path(args.log).read_text(errors="replace")
+        base = {"source": "uart", "target": args.target, "os": args.os,
+                "runtime": args.runtime, "mode": args.mode, "compiler": args.compiler,
+                "flags": args.flags, "git_sha": args.git_sha or git_sha()}
+        try:
+            records = parse_uart(text.splitlines(), base, args.fft_size, args.iters,
+                                 args.hostcall_iters, args.rounds, args.startup_rounds)
+        except ValueError as e:
+            parser.error(str(e))
+        if not records:
+            print("nessun risultato nel log", file=sys.stderr)
+            return 1
+        write(args.out, records)
+        print(f"{len(records)} record", file=sys.stderr)
+        return 0
+
+    try:
+        records = load(args.files)
+    except (ValueError, json.JSONDecodeError) as e:
+        print(e, file=sys.stderr)
+        return 1
+    if args.cmd == "show":
+        show(records)
+    else:
+        print(f"{len(records)} record validi")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
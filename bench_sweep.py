@@ -0,0 +1,447 @@
+#!/usr/bin/env python3
+"""
+Sweep delle opzioni di build di un runtime: ricompila per ogni
+configurazione, fa girare la suite e tabula velocità contro memoria, per
+scegliere le impostazioni di produzione con i numeri.
+
+  wasm3   le d_m3* di m3_config.h (WASM3_CONFIGS):
+          Linux   un plugin bench_wasm3-<config>.so per configurazione
+                  (LINUX_BENCH_WASM3_VARIANTS di linux_bench), tutti nello
+                  stesso run di --suite; memoria = codice del plugin e picco
+                  di m3_Malloc all'avvio di fft_bench (--startup)
+          Zephyr  (--zephyr) zephyrproject/z_wasm3_fft_f4 con -DWASM3_DEFS
+                  su QEMU (bench_emu.py), in istruzioni; memoria = flash e
+                  RAM statica dell'ELF, picco heap e stack dalla riga
+                  "Footprint:" (bench_footprint.py)
+  wamr    profili dell'interprete (WAMR_PROFILES): classico o fast,
+          WASM_ENABLE_LABELS_AS_VALUES, WAMR_BUILD_MINI_LOADER,
+          WAMR_DISABLE_HW_BOUND_CHECK, WAMR_BUILD_SIMD, heap dell'app:
+          Linux   un plugin bench_wamr-<profilo>.so per profilo
+                  (LINUX_BENCH_WAMR_VARIANTS); classic e fast sono i
+                  wamr-interp e wamr-fast-interp di sempre
+          Zephyr  (--zephyr) zephyrproject/z_wamr_interp_fft_f4 con le
+                  WAMR_BUILD_* come -D e le definizioni C in -DWAMR_DEFS
+          L'heap globale di WAMR (WAMR_BUILD_GLOBAL_HEAP_SIZE) non c'entra:
+          le app FFT e il plugin usano Alloc_With_Allocator, quindi il pool
+          non viene allocato; la RAM che dipende dalla configurazione è
+          l'heap dell'app dentro la memoria lineare di ogni istanza
+          (CONFIG_APP_HEAP_SIZE su Zephyr, WAMR_HEAP_SIZE su Linux), che
+          classic-heap porta a --app-heap. Il bound check hardware esiste
+          solo sui target a 64 bit: su Thumb i profili *-swbound coincidono
+          con gli altri. fast-simd scarica SIMDe a configure time; se una
+          variante non compila, la riga lo dice e le altre girano lo stesso.
+  aot     flag di wamrc (AOT_PROFILES) per la board di --board, solo su
+          QEMU: zephyrproject/z_wamr_aot_fft_f7 con wasm/fft/mcu/
+          fft_bench.wasm ricompilato per profilo e passato all'app in
+          -DBENCH_AOT_HEADER. "generic" sono i flag di prima (solo
+          --target), "default" quelli che il gateway ricava dal HELLO
+          (aot_target.py); gli altri cambiano un flag alla volta.
+
+    python bench_sweep.py wasm3 --markdown -o benchmarks/results/sweep_wasm3.jsonl
+    python bench_sweep.py wasm3 --configs default,unchecked,slots64 --zephyr --board mps2/an385
+    python bench_sweep.py wamr --configs classic,fast,fast-nolav --zephyr
+    python bench_sweep.py aot --board mps2/an500 --markdown
+
+Velocità: media geometrica, sui kernel misurati da entrambe, del rapporto
+tra la mediana della configurazione e quella della base ("default" per
+wasm3, "classic" per WAMR, "generic" per aot; < 1 = più veloce). Un kernel che fallisce o
+cambia checksum viene segnalato: le configurazioni "unchecked" non devono
+cambiare i risultati, solo i tempi. I record vanno nello schema di
+bench_results.py con mode = configurazione (Linux: runtime
+<runtime>-<config>), quindi bench_compare.py diff li confronta tra commit
+diversi.
+"""
+import argparse
+import json
+import math
+import subprocess
+import sys
+from pathlib import Path
+
+import aot_target
+import bench_emu
+import bench_footprint
+from bench_results import git_sha, parse_uart, write
+
+REPO = Path(__file__).resolve().parent
+LINUX_BENCH = REPO / "linux" / "linux_bench"
+VARIANT_VARS = ("LINUX_BENCH_WASM3_VARIANTS", "LINUX_BENCH_WAMR_VARIANTS")
+
+# configurazione -> d_m3*; {fixed_heap} dipende dal target (--fixed-heap)
+WASM3_CONFIGS = {
+    "default": [],
+    "slots64": ["d_m3Use32BitSlots=0"],
+    "nobounds": ["d_m3SkipMemoryBoundsCheck=1"],
+    "nostackcheck": ["d_m3SkipStackCheck=1"],
+    "unchecked": ["d_m3SkipMemoryBoundsCheck=1", "d_m3SkipStackCheck=1"],
+    "stack256": ["d_m3MaxFunctionStackHeight=256"],
+    "page1k": ["d_m3CodePageAlignSize=1024"],
+    "fixedheap": ["d_m3FixedHeap={fixed_heap}"],
+    "super": ["d_m3EnableSuperinstructions=1"],
+    "fuseslot": ["d_m3FuseSetSlot=1"],
+    "reg1": ["d_m3HasReg1=1"],
+    "fp1": ["d_m3HasFp1=1"],
+    "reg1fp1": ["d_m3HasReg1=1", "d_m3HasFp1=1"],
+}
+
+# profilo -> opzioni: WAMR_* sono opzioni CMake di WAMR, il resto definizioni
+# C; {heap_def}={app_heap} è l'heap dell'app (--app-heap)
+WAMR_PROFILES = {
+    "classic": ["WAMR_BUILD_FAST_INTERP=0"],
+    "classic-nolav": ["WAMR_BUILD_FAST_INTERP=0", "WASM_ENABLE_LABELS_AS_VALUES=0"],
+    "classic-mini": ["WAMR_BUILD_FAST_INTERP=0", "WAMR_BUILD_MINI_LOADER=1"],
+    "classic-swbound": ["WAMR_BUILD_FAST_INTERP=0", "WAMR_DISABLE_HW_BOUND_CHECK=1"],
+    "classic-heap": ["WAMR_BUILD_FAST_INTERP=0", "{heap_def}={app_heap}"],
+    "fast": ["WAMR_BUILD_FAST_INTERP=1"],
+    "fast-nolav": ["WAMR_BUILD_FAST_INTERP=1", "WASM_ENABLE_LABELS_AS_VALUES=0"],
+    "fast-mini": ["WAMR_BUILD_FAST_INTERP=1", "WAMR_BUILD_MINI_LOADER=1"],
+    "fast-swbound": ["WAMR_BUILD_FAST_INTERP=1", "WAMR_DISABLE_HW_BOUND_CHECK=1"],
+    "fast-simd": ["WAMR_BUILD_FAST_INTERP=1", "WAMR_BUILD_SIMD=1"],
+}
+
+# profilo -> argomenti di aot_target.wamrc_args; "target" sceglie i campi
+# della board: legacy = solo isa/abi, nofpu = CPU senza FPU
+AOT_PROFILES = {
+    "generic": {"target": "legacy"},
+    "cpu": {"target": "nofpu"},
+    "default": {},
+    "O2": {"opt_level": 2},
+    "O1": {"opt_level": 1},
+    "size1": {"size_level": 1},
+    "nobounds": {"bounds_checks": False},
+}
+
+
+def run(cmd, check: bool = True, **kw) -> subprocess.CompletedProcess:
+    """log delle build su stderr, così su stdout restano solo le tabelle"""
+    print("+ " + " ".join(str(c) for c in cmd), file=sys.stderr)
+    kw.setdefault("stdout", sys.stderr)
+    return subprocess.run(cmd, check=check, text=True, **kw)
+
+
+def bench_records(cmd) -> list[dict]:
+    """record di linux_bench --format results; un'uscita non zero (CV oltre
+    --max-cv, kernel falliti o moduli mancanti) non butta le righe buone"""
+    p = run(cmd, check=False, stdout=subprocess.PIPE)
+    if p.returncode != 0:
+        print(f"linux_bench: uscita {p.returncode}, tengo le righe scritte", file=sys.stderr)
+    return [json.loads(ln) for ln in p.stdout.splitlines() if ln.startswith("{")]
+
+
+def mode_of(plugin: str) -> str:
+    """mode dei record di linux_bench: il nome del plugin dopo il primo '-'"""
+    return plugin.split("-", 1)[1] if "-" in plugin else "interp"
+
+
+def kernel_key(rec) -> tuple:
+    return rec["kernel"], rec["module"], rec["size"]
+
+
+def compare(by_config: dict, base_name: str) -> dict:
+    """per configurazione: rapporto (media geometrica) sulla base, kernel mancanti e checksum diversi"""
+    base = {kernel_key(r): r for r in by_config.get(base_name, [])}
+    out = {}
+    for name, recs in by_config.items():
+        mine = {kernel_key(r): r for r in recs}
+        logs = [math.log(mine[k]["stats"]["median"] / base[k]["stats"]["median"])
+                for k in mine.keys() & base.keys() if base[k]["stats"]["median"] > 0
+                and mine[k]["stats"]["median"] > 0]
+        out[name] = {
+            "ratio": math.exp(sum(logs) / len(logs)) if logs else None,
+            "kernels": len(mine),
+            "missing": sorted("%s:%s" % k[:2] for k in base.keys() - mine.keys()),
+            "checksum": sorted("%s:%s" % k[:2] for k in mine.keys() & base.keys()
+                               if mine[k].get("checksum") != base[k].get("checksum")),
+        }
+    return out
+
+
+def heap_str(peak, defs: list[str]) -> str:
+    """con d_m3FixedHeap m3_GetHeapStats non conta: vale la dimensione del buffer"""
+    fixed = next((d.split("=", 1)[1] for d in defs if d.startswith("d_m3FixedHeap=")), None)
+    if fixed is not None:
+        return bench_footprint.kib(int(fixed, 0)) + " (fixed)"
+    return bench_footprint.kib(peak)
+
+
+def ratio_str(r) -> str:
+    return f"{r:.3f}x" if r is not None else "-"
+
+
+def notes(c) -> str:
+    parts = []
+    if c["missing"]:
+        parts.append(f"{len(c['missing'])} kernel falliti")
+    if c["checksum"]:
+        parts.append("checksum diverso: " + ", ".join(c["checksum"]))
+    return "; ".join(parts)
+
+
+# ---------------------------------------------------------------- Linux
+
+def linux_sweep(args, rt, names) -> tuple[list[dict], list[list[str]]]:
+    """tutte le configurazioni come plugin dello stesso linux_bench; una
+    variante che non compila resta fuori (le altre girano lo stesso)"""
+    build = Path(args.build_dir)
+    plugin = {n: rt["plugins"].get(n, f"{rt['prefix']}-{n}") for n in names}
+    variants = {n: f"{n}:{','.join(rt['settings'](n, 'linux'))}"
+                for n in names if n not in rt["plugins"]}
+
+    def configure(ok):
+        # le varianti dell'altro runtime, rimaste in cache, non servono
+        others = [f"-D{v}=" for v in VARIANT_VARS if v != rt["cache_var"]]
+        run(["cmake", "-S", LINUX_BENCH, "-B", build, "-DCMAKE_BUILD_TYPE=Release", *others,
+             f"-D{rt['cache_var']}=" + ";".join(variants[n] for n in ok)])
+
+    configure(variants)
+    failed = [n for n in variants
+              if run(["cmake", "--build", build, "-j", str(args.jobs), "--target",
+                      rt["target"](plugin[n])], check=False).returncode != 0]
+    for n in failed:
+        print(f"{n}: build fallita", file=sys.stderr)
+    if failed:
+        configure([n for n in variants if n not in failed])
+    run(["cmake", "--build", build, "-j", str(args.jobs)])
+
+    built = [n for n in names if n not in failed]
+    bench = [build / "linux_bench", "--runtime", ",".join(plugin[n] for n in built),
+             "--format", "results", "--reps", str(args.reps), *args.bench_args]
+    records = bench_records(bench + ["--suite"])
+    startup = bench_records(bench + ["--startup", "--startup-module", "fft_bench:fft_init"])
+
+    mode = {mode_of(plugin[n]): n for n in built}
+    by_config = {n: [] for n in built}
+    for rec in records:
+        by_config[mode[rec["mode"]]].append(rec)
+    heap = {mode[r["mode"]]: r["memory"].get("peak_bytes")
+            for r in startup if r["kernel"] == "startup:total"}
+    cmp = compare(by_config, rt["base"])
+
+    rows = [["Config", rt["options"], f"Speed vs {rt['base']}", "FFT ns/iter", "Plugin code",
+             "Heap peak (fft_bench)", "Notes"]]
+    for n in names:
+        defs = rt["settings"](n, "linux")
+        if n in failed:
+            rows.append([n, " ".join(defs) or "-", "-", "-", "-", "-", "build fallita"])
+            continue
+        fft = next((r for r in by_config[n] if r["kernel"] == "fft"), None)
+        so = build / "plugins" / f"bench_{plugin[n]}.so"
+        code = bench_footprint.elf_totals(so)["flash"] if so.exists() else None
+        rows.append([n, " ".join(defs) or "-", ratio_str(cmp[n]["ratio"]),
+                     f"{fft['stats']['median']:.0f}" if fft else "-",
+                     bench_footprint.kib(code), heap_str(heap.get(n), defs), notes(cmp[n])])
+    for rec in records + startup:
+        rec["extra"]["sweep"] = mode[rec["mode"]]
+    return records + startup, rows
+
+
+# ---------------------------------------------------------------- Zephyr (QEMU)
+
+def zephyr_sweep(args, rt, names) -> tuple[list[dict], list[list[str]]]:
+    app = REPO / args.zephyr_app
+    machine = bench_emu.QEMU_BOARDS[args.board][0]
+    records, by_config, foot = [], {}, {}
+    for n in names:
+        build = Path(args.build_dir) / f"zephyr-{rt['prefix']}-{n}"
+        defs = rt["settings"](n, "zephyr")
+        try:
+            run(["west", "build", "-p", "auto", "-b", args.board, "-d", build, app,
+                 "--", *rt["zephyr_args"](n, defs, build)])
+        except subprocess.CalledProcessError:
+            print(f"{n}: build fallita", file=sys.stderr)
+            by_config[n], foot[n] = [], {"build_failed": True}
+            continue
+        emu = argparse.Namespace(board=args.board, qemu=args.qemu, elf=str(build / "zephyr" / "zephyr.elf"),
+                                 shift=0, insn_plugin=None, timeout=args.timeout, verbose=False)
+        try:
+            uart, _total, ips = bench_emu.run_qemu(emu)
+        except (OSError, TimeoutError, subprocess.TimeoutExpired) as e:
+            print(f"{n}: {e}", file=sys.stderr)
+            uart, ips = [], None
+        clock = next((int(m[1]) for ln in uart if (m := bench_emu.RE_CLOCK.match(ln.strip()))), None)
+        base = {"source": "bench_sweep", "target": f"qemu-{machine}", "git_sha": git_sha(),
+                "flags": " ".join(defs) or None}
+        recs = parse_uart(uart, base, fft_size=1024, iters=10, hostcall_iters=1000,
+                          rounds=20, startup_rounds=10) if clock else []
+        bench_emu.to_insns(recs, ips / clock if clock else 1.0,
+                           {"emulator": "qemu", "board": args.board, "sweep": n})
+        # stesso mode del plugin Linux della configurazione
+        for rec in recs:
+            rec["mode"] = mode_of(rt["plugins"].get(n, f"{rt['prefix']}-{n}"))
+        records += recs
+        by_config[n] = [r for r in recs if not r["kernel"].startswith("startup:")]
+        fp = bench_footprint.analyze(build, "app", None)
+        fp["runtime"] = bench_footprint.parse_uart(uart)
+        foot[n] = fp
+
+    cmp = compare(by_config, rt["base"])
+    rows = [["Config", f"Speed vs {rt['base']}", "FFT insns", "Flash (ROM)", "Static RAM", "Heap peak",
+             "Stack peak", "Notes"]]
+    for n in names:
+        fp = foot[n]
+        if fp.get("build_failed"):
+            rows.append([n, "-", "-", "-", "-", "-", "-", "build fallita"])
+            continue
+        fft = next((r for r in by_config[n] if r["kernel"] == "fft"), None)
+        rt_fp = fp["runtime"]
+        rows.append([n, ratio_str(cmp[n]["ratio"]), f"{fft['stats']['median']:.0f}" if fft else "-",
+                     bench_footprint.kib(fp["flash"]), bench_footprint.kib(fp["ram"]),
+                     heap_str(rt_fp.get("heap_peak"), rt["settings"](n, "zephyr")),
+                     bench_footprint.kib(rt_fp.get("stack_used")),
+                     notes(cmp[n]) or ("" if by_config[n] else "nessun risultato")])
+    return records, rows
+
+
+# ---------------------------------------------------------------- runtime
+
+def wasm3_runtime(args) -> dict:
+    heap = {"linux": args.fixed_heap, "zephyr": args.zephyr_fixed_heap}
+    return {
+        "configs": WASM3_CONFIGS, "base": "default", "prefix": "wasm3", "options": "d_m3*",
+        "plugins": {"default": "wasm3"},
+        "cache_var": "LINUX_BENCH_WASM3_VARIANTS",
+        "target": lambda plugin: "bench_" + plugin.replace("-", "_"),
+        "settings": lambda n, where: [d.format(fixed_heap=heap[where]) for d in WASM3_CONFIGS[n]],
+        "zephyr_args": lambda n, defs, build: ["-DWASM3_DEFS=" + ";".join(defs)],
+    }
+
+
+def wamr_zephyr_args(n, defs: list[str], build) -> list[str]:
+    """WAMR_* come opzioni CMake dell'app, il resto in WAMR_DEFS"""
+    opts = [d for d in defs if d.startswith("WAMR_")]
+    cdefs = [d for d in defs if not d.startswith("WAMR_")]
+    return [f"-D{d}" for d in opts] + (["-DWAMR_DEFS=" + ";".join(cdefs)] if cdefs else [])
+
+
+def wamr_runtime(args) -> dict:
+    heap_def = {"linux": "WAMR_HEAP_SIZE", "zephyr": "CONFIG_APP_HEAP_SIZE"}
+    return {
+        "configs": WAMR_PROFILES, "base": "classic", "prefix": "wamr", "options": "Options",
+        # i due interpreti standard di linux_bench, senza ricompilare
+        "plugins": {"classic": "wamr-interp", "fast": "wamr-fast-interp"},
+        "cache_var": "LINUX_BENCH_WAMR_VARIANTS",
+        "target": lambda plugin: "wamr_" + plugin.split("-", 1)[1],
+        "settings": lambda n, where: [d.format(heap_def=heap_def[where], app_heap=args.app_heap)
+                                      for d in WAMR_PROFILES[n]],
+        "zephyr_args": wamr_zephyr_args,
+    }
+
+
+def aot_flags(args, n: str) -> list[str]:
+    info = aot_target.BOARDS[args.board]
+    prof = dict(AOT_PROFILES[n])
+    target = prof.pop("target", None)
+    if target == "legacy":
+        info = {"isa": info["isa"], "abi": info["abi"]}
+    elif target == "nofpu":
+        info = {**info, "fpu": "none"}
+    return aot_target.wamrc_args(info, **prof)
+
+
+def c_array(name: str, data: bytes) -> str:
+    """come xxd -i, che genera i fft_bench_aot.h dei build.sh"""
+    rows = [", ".join(f"0x{b:02x}" for b in data[i:i + 12]) for i in range(0, len(data), 12)]
+    return (f"unsigned char {name}[] = {{\n  " + ",\n  ".join(rows) + "\n};\n"
+            f"unsigned int {name}_len = {len(data)};\n")
+
+
+def aot_zephyr_args(args, n, defs: list[str], build: Path) -> list[str]:
+    """wamrc con i flag del profilo, header accanto alla build (west -p la
+    cancellerebbe); un errore di wamrc conta come build fallita"""
+    out = build.with_name(build.name + "-aot")
+    out.mkdir(parents=True, exist_ok=True)
+    run([args.wamrc, *defs, "-o", out / "fft_bench.aot", args.wasm])
+    header = out / "fft_bench_aot.h"
+    header.write_text(c_array("fft_bench_aot", (out / "fft_bench.aot").read_bytes()))
+    return [f"-DBENCH_AOT_HEADER={header}"]
+
+
+def aot_runtime(args) -> dict:
+    return {
+        "configs": AOT_PROFILES, "base": "generic", "prefix": "wamr-aot", "options": "wamrc",
+        "plugins": {}, "cache_var": None, "target": None,
+        "settings": lambda n, where: aot_flags(args, n),
+        "zephyr_args": lambda n, defs, build: aot_zephyr_args(args, n, defs, build),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Sweep delle opzioni di build dei runtime")
+    sub = parser.add_subparsers(dest="runtime", required=True)
+
+    p = sub.add_parser("wasm3", help="d_m3* di m3_config.h")
+    p.add_argument("--configs", default=",".join(WASM3_CONFIGS),
+                   help=f"Configurazioni separate da virgola (default: tutte: {', '.join(WASM3_CONFIGS)})")
+    p.add_argument("--fixed-heap", type=int, default=64 << 20,
+                   help="d_m3FixedHeap di fixedheap su Linux (default 64 MiB)")
+    p.add_argument("--zephyr-fixed-heap", type=int, default=96 << 10,
+                   help="d_m3FixedHeap di fixedheap su Zephyr (default 96 KiB)")
+    p.add_argument("--zephyr-app", default="zephyrproject/z_wasm3_fft_f4")
+
+    p = sub.add_parser("wamr", help="Opzioni di build di WAMR (interprete)")
+    p.add_argument("--configs", default=",".join(WAMR_PROFILES),
+                   help=f"Profili separati da virgola (default: tutti: {', '.join(WAMR_PROFILES)})")
+    p.add_argument("--app-heap", type=int, default=0,
+                   help="Heap dell'app per istanza di classic-heap (default 0: solo la memoria del modulo)")
+    p.add_argument("--zephyr-app", default="zephyrproject/z_wamr_interp_fft_f4")
+
+    p = sub.add_parser("aot", help="Flag di wamrc per la board (solo Zephyr su QEMU)")
+    p.add_argument("--configs", default=",".join(AOT_PROFILES),
+                   help=f"Profili separati da virgola (default: tutti: {', '.join(AOT_PROFILES)})")
+    p.add_argument("--wasm", default=str(REPO / "wasm" / "fft" / "mcu" / "fft_bench.wasm"),
+                   help="Modulo da compilare (default: quello MCU di wasm/fft/build.sh)")
+    p.add_argument("--wamrc", default="wamrc")
+    p.add_argument("--zephyr-app", default="zephyrproject/z_wamr_aot_fft_f7")
+
+    for p in sub.choices.values():
+        p.add_argument("--build-dir", default=str(REPO / "build" / "sweep"),
+                       help="Build di linux_bench e delle app Zephyr (una per configurazione)")
+        p.add_argument("--jobs", type=int, default=4)
+        p.add_argument("--reps", type=int, default=10)
+        p.add_argument("--bench-args", nargs=argparse.REMAINDER, default=[],
+                       help="Altri argomenti per linux_bench (es. --cpu 2 --iters 50), in fondo")
+        p.add_argument("--no-linux", action="store_true", help="Salta linux_bench")
+        p.add_argument("--zephyr", action="store_true", help="Anche l'app Zephyr su QEMU (serve west)")
+        p.add_argument("--board", default="mps2/an385", choices=sorted(bench_emu.QEMU_BOARDS))
+        p.add_argument("--qemu", default="qemu-system-arm")
+        p.add_argument("--timeout", type=float, default=1800.0)
+        p.add_argument("--markdown", action="store_true")
+        p.add_argument("-o", "--out", help="Record per bench_results.py (.jsonl, in append)")
+
+    sub.choices["aot"].set_defaults(board="mps2/an500")
+
+    args = parser.parse_args()
+    if args.runtime == "aot":
+        # i flag di wamrc sono per l'MCU: niente linux_bench
+        args.no_linux, args.zephyr = True, True
+        if not Path(args.wasm).exists():
+            parser.error(f"{args.wasm} non c'è: prima wasm/fft/build.sh")
+    rt = {"wasm3": wasm3_runtime, "wamr": wamr_runtime, "aot": aot_runtime}[args.runtime](args)
+    names = [n.strip() for n in args.configs.split(",") if n.strip()]
+    unknown = [n for n in names if n not in rt["configs"]]
+    if unknown:
+        parser.error("configurazioni sconosciute: " + ", ".join(unknown))
+    if rt["base"] not in names:
+        names.insert(0, rt["base"])
+
+    records = []
+    try:
+        if not args.no_linux:
+            recs, rows = linux_sweep(args, rt, names)
+            records += recs
+            print("\n".join(bench_footprint.table(rows, args.markdown)))
+        if args.zephyr:
+            recs, rows = zephyr_sweep(args, rt, names)
+            records += recs
+            print()
+            print("\n".join(bench_footprint.table(rows, args.markdown)))
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(e, file=sys.stderr)
+        return 1
+    if args.out:
+        write(args.out, records)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
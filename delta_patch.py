@@ -0,0 +1,159 @@
+"""
+Patch binari per LOAD delta=1: ricostruiscono la nuova immagine a partire
+da quella già caricata nello slot (decoder: firmware/src/delta_stream.c).
+
+Formato: sequenza di operazioni, ognuna introdotta da un varint LEB128
+v = (len << 2) | op:
+  op 0 ADD       seguono len byte letterali
+  op 1 COPY_OLD  segue un varint zigzag: offset nel vecchio relativo alla
+                 fine dell'ultima COPY_OLD (spostamenti piccoli = 1 byte)
+  op 2 COPY_NEW  segue un varint dist: copia len byte da pos-dist nella
+                 nuova immagine (stile LZ77, sovrapposizione ammessa)
+
+Le copie sono eseguite dal thread del LOAD, che intanto non svuota il ring
+della UART: la loro lunghezza è limitata a MAX_COPY byte per non riempirlo.
+"""
+
+OP_ADD = 0
+OP_COPY_OLD = 1
+OP_COPY_NEW = 2
+
+KEY_LEN = 8          # byte indicizzati per cercare i match
+MIN_COPY = 8         # sotto questa lunghezza conviene ADD
+MAX_COPY = 1024      # budget di copia per singola operazione
+MAX_CANDIDATES = 4
+
+
+def _varint(out: bytearray, v: int):
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return
+
+
+def _zigzag(v: int) -> int:
+    return (v << 1) if v >= 0 else ((-v << 1) - 1)
+
+
+def _match_len(a: bytes, ai: int, b: bytes, bi: int, limit: int) -> int:
+    n = 0
+    # confronto a blocchi, poi byte per byte
+    while n + 64 <= limit and a[ai + n:ai + n + 64] == b[bi + n:bi + n + 64]:
+        n += 64
+    while n < limit and a[ai + n] == b[bi + n]:
+        n += 1
+    return n
+
+
+def encode(old: bytes, new: bytes) -> bytes:
+    out = bytearray()
+    n = len(new)
+
+    idx_old = {}
+    for j in range(0, len(old) - KEY_LEN + 1):
+        lst = idx_old.setdefault(old[j:j + KEY_LEN], [])
+        if len(lst) < MAX_CANDIDATES:
+            lst.append(j)
+    idx_new = {}
+
+    old_expect = 0
+    lit_start = 0
+    i = 0
+
+    def flush_literals(end):
+        if end > lit_start:
+            _varint(out, ((end - lit_start) << 2) | OP_ADD)
+            out.extend(new[lit_start:end])
+
+    while i <= n - KEY_LEN:
+        key = new[i:i + KEY_LEN]
+        best_len, best_op, best_arg = 0, None, 0
+
+        cands = idx_old.get(key, [])
+        if (old_expect + KEY_LEN <= len(old)
+                and old[old_expect:old_expect + KEY_LEN] == key):
+            cands = [old_expect] + cands
+        for c in cands:
+            L = _match_len(old, c, new, i, min(len(old) - c, n - i))
+            if L > best_len:
+                best_len, best_op, best_arg = L, OP_COPY_OLD, c
+
+        c = idx_new.get(key)
+        if c is not None:
+            L = _match_len(new, c, new, i, n - i)
+            if L > best_len:
+                best_len, best_op, best_arg = L, OP_COPY_NEW, c
+
+        if best_len < MIN_COPY:
+            idx_new[key] = i
+            i += 1
+            continue
+
+        flush_literals(i)
+        done = 0
+        while done < best_len:
+            chunk = min(MAX_COPY, best_len - done)
+            _varint(out, (chunk << 2) | best_op)
+            if best_op == OP_COPY_OLD:
+                src = best_arg + done
+                _varint(out, _zigzag(src - old_expect))
+                old_expect = src + chunk
+            else:
+                _varint(out, i + done - (best_arg + done))
+            done += chunk
+
+        for j in range(i, min(i + best_len, n - KEY_LEN + 1)):
+            idx_new[new[j:j + KEY_LEN]] = j
+        i += best_len
+        lit_start = i
+
+    flush_literals(n)
+    return bytes(out)
+
+
+def apply(old: bytes, patch: bytes, size: int) -> bytes:
+    """Decoder di riferimento, stessa semantica di delta_stream.c."""
+    out = bytearray()
+    p = 0
+    old_pos = 0
+
+    def read_varint():
+        nonlocal p
+        v = shift = 0
+        while True:
+            b = patch[p]
+            p += 1
+            v |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return v
+
+    while p < len(patch):
+        v = read_varint()
+        op, length = v & 3, v >> 2
+        if op == OP_ADD:
+            out += patch[p:p + length]
+            p += length
+        elif op == OP_COPY_OLD:
+            z = read_varint()
+            off = old_pos + ((z >> 1) if not z & 1 else -((z + 1) >> 1))
+            if off < 0 or off + length > len(old):
+                raise ValueError("COPY_OLD fuori dal vecchio")
+            out += old[off:off + length]
+            old_pos = off + length
+        elif op == OP_COPY_NEW:
+            dist = read_varint()
+            if dist == 0 or dist > len(out):
+                raise ValueError("COPY_NEW non valido")
+            start = len(out) - dist
+            for k in range(length):
+                out.append(out[start + k])
+        else:
+            raise ValueError("op sconosciuta")
+    if len(out) != size:
+        raise ValueError(f"dimensione ricostruita {len(out)} != {size}")
+    return bytes(out)
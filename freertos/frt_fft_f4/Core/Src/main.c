@@ -23,6 +23,11 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "twiddle1024.h"
+#include <stdio.h>
+#define BENCH_STATS_PRINTF printf   // report su UART (printf -> _write -> huart2)
+#include "bench_stats.h"
+#include "kernels_bench.h"
+#include "fft_bench.h"   // varianti del modulo FFT (fft_bench_wasm.c)
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -33,7 +38,10 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define N_FFT          1024      // Dimensione FFT (reale)
-#define NUM_ITER       100      // Numero di iterazioni per il benchmark
+#define NUM_ITER       10       // FFT per round
+#define WARMUP_ROUNDS  2        // round scartati
+#define NUM_ROUNDS     20       // round misurati
+#define MAX_CV_PERMILLE 20      // oltre il 2% di CV la misura non vale
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -56,8 +64,12 @@ const osThreadAttr_t defaultTask_attributes = {
 static float buf[2 * N_FFT];
 
 
+// Risultati visibili dal debugger (mediana dei round misurati)
 volatile uint32_t total_cycles = 0;
 volatile uint32_t avg_cycles   = 0;
+// Cicli di ogni round misurato e statistiche
+static uint64_t round_cycles[NUM_ROUNDS];
+static bench_stats_t stats;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -72,7 +84,7 @@ void StartDefaultTask(void *argument);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-static void fft_init(void)
+static void fft_native_init(void)
 {
     for (int i = 0; i < N_FFT; ++i) {
         float x = (float)i;
@@ -134,7 +146,7 @@ static void fft_radix2(float *b)
     }
 }
 
-void fft_bench(int iterations)
+static void fft_native_bench(int iterations)
 {
     for (int k = 0; k < iterations; ++k) {
         fft_radix2(buf);
@@ -162,14 +174,80 @@ static void DWT_Init(void) {
 
 void run_benchmark(void) {
 	DWT_Init();
-	fft_init();
 
-	uint32_t start = DWT->CYCCNT;
-	fft_bench(NUM_ITER);
-	uint32_t end   = DWT->CYCCNT;
+	for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+		fft_native_init();   // stesso input a ogni round
 
-	total_cycles = end - start;
-	avg_cycles   = total_cycles / NUM_ITER;
+		uint32_t start = DWT->CYCCNT;
+		fft_native_bench(NUM_ITER);
+		uint32_t end   = DWT->CYCCNT;
+
+		if (r >= WARMUP_ROUNDS) {
+			round_cycles[r - WARMUP_ROUNDS] = end - start;
+		}
+	}
+
+	bench_stats_compute(round_cycles, NUM_ROUNDS, &stats);
+	total_cycles = (uint32_t)stats.median;
+	avg_cycles   = (uint32_t)(stats.median / NUM_ITER);
+}
+
+//------------------------------
+// Suite di kernel (wasm/kernels)
+//------------------------------
+// Stessi round della FFT; init una sola volta, così il checksum finale
+// coincide con quello dei runtime wasm e di linux_bench a parità di round.
+static uint64_t suite_cycles[NUM_ROUNDS];
+
+void run_suite(void)
+{
+    bench_stats_t st;
+
+    for (int k = 0; k < KERNELS_SUITE_LEN; k++) {
+        const kernel_desc_t *kd = &kernels_suite[k];
+
+        kd->init();
+        for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+            uint32_t start = DWT->CYCCNT;
+            kd->bench(NUM_ITER);
+            uint32_t end   = DWT->CYCCNT;
+
+            if (r >= WARMUP_ROUNDS) {
+                suite_cycles[r - WARMUP_ROUNDS] = end - start;
+            }
+        }
+        bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+        bench_stats_print_row(kd->name, &st, NUM_ITER, kd->checksum());
+    }
+}
+
+// Varianti del modulo FFT alle taglie MCU (fft_bench.h), come nei runtime
+// wasm: una riga "fft_r2@256" ecc., init(n) una volta per taglia.
+void run_fft_variants(void)
+{
+    static const int32_t sizes[FFT_MCU_SIZES_LEN] = { FFT_MCU_SIZES };
+    bench_stats_t st;
+    char row[32];
+
+    for (int k = 0; k < FFT_VARIANT_LEN; k++) {
+        const fft_variant_desc_t *vd = &fft_variants[k];
+
+        for (int s = 0; s < FFT_MCU_SIZES_LEN; s++) {
+            snprintf(row, sizeof(row), "%s@%ld", vd->name, (long)sizes[s]);
+            vd->init(sizes[s]);
+            for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+                uint32_t start = DWT->CYCCNT;
+                vd->bench(NUM_ITER);
+                uint32_t end   = DWT->CYCCNT;
+
+                if (r >= WARMUP_ROUNDS) {
+                    suite_cycles[r - WARMUP_ROUNDS] = end - start;
+                }
+            }
+            bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+            bench_stats_print_row(row, &st, NUM_ITER, vd->checksum());
+        }
+    }
 }
 /* USER CODE END 0 */
 
@@ -379,8 +457,10 @@ void StartDefaultTask(void *argument)
 	run_benchmark();
 
 	printf("FreeRTOS\r\n");
-	printf("Total cycles: %lu\r\n", (unsigned long)total_cycles);
-	printf("Avg cycles per FFT: %lu\r\n", (unsigned long)avg_cycles);
+	bench_stats_print("cycles per FFT", &stats, NUM_ITER);
+	bench_stats_check(&stats, MAX_CV_PERMILLE);
+	run_fft_variants();
+	run_suite();
 	/* Infinite loop */
 	for(;;)
 	{
@@ -0,0 +1,86 @@
+#ifndef KERNELS_BENCH_H
+#define KERNELS_BENCH_H
+
+#include <stdint.h>
+
+/*
+ * Suite di kernel embedded oltre alla FFT. Stesso sorgente per la build
+ * nativa (MCU, Linux .so) e per il modulo wasm (wasm/kernels/build.sh).
+ *
+ * Ogni kernel K esporta:
+ *   K_init()              prepara i dati (non misurato)
+ *   K_bench(iterations)   il carico misurato
+ *   K_checksum()          hash dell'output: deve coincidere tra nativo e
+ *                         ogni runtime wasm a parità di init/bench
+ */
+
+#if defined(__wasm__) || defined(__wasm)
+#  define WASM_EXPORT(name) __attribute__((export_name(name)))
+#else
+#  define WASM_EXPORT(name)
+#endif
+
+/* nomi nell'ordine di esecuzione della suite */
+#define KERNELS_SUITE_NAMES "fir", "iir", "matmul", "crc32", "aes", "sort", "q15"
+#define KERNELS_SUITE_LEN   7
+
+/* varianti SIMD128 (build con -DBENCH_SIMD, modulo kernels_bench_simd) */
+#define KERNELS_SIMD_NAMES  "fir_simd", "matmul_simd", "q15_simd"
+#define KERNELS_SIMD_LEN    3
+
+void     fir_init(void);
+void     fir_bench(int32_t iterations);
+uint32_t fir_checksum(void);
+
+void     iir_init(void);
+void     iir_bench(int32_t iterations);
+uint32_t iir_checksum(void);
+
+void     matmul_init(void);
+void     matmul_bench(int32_t iterations);
+uint32_t matmul_checksum(void);
+
+void     crc32_init(void);
+void     crc32_bench(int32_t iterations);
+uint32_t crc32_checksum(void);
+
+void     aes_init(void);
+void     aes_bench(int32_t iterations);
+uint32_t aes_checksum(void);
+
+void     sort_init(void);
+void     sort_bench(int32_t iterations);
+uint32_t sort_checksum(void);
+
+void     q15_init(void);
+void     q15_bench(int32_t iterations);
+uint32_t q15_checksum(void);
+
+#ifdef BENCH_SIMD
+/* stessi dati, init e checksum dello scalare: i checksum devono coincidere */
+void     fir_simd_init(void);
+void     fir_simd_bench(int32_t iterations);
+uint32_t fir_simd_checksum(void);
+
+void     matmul_simd_init(void);
+void     matmul_simd_bench(int32_t iterations);
+uint32_t matmul_simd_checksum(void);
+
+void     q15_simd_init(void);
+void     q15_simd_bench(int32_t iterations);
+uint32_t q15_simd_checksum(void);
+#endif
+
+#if !(defined(__wasm__) || defined(__wasm))
+/* tabella per i runner nativi (MCU): stesso ordine di KERNELS_SUITE_NAMES */
+typedef struct {
+    const char *name;
+    void     (*init)(void);
+    void     (*bench)(int32_t iterations);
+    uint32_t (*checksum)(void);
+} kernel_desc_t;
+
+extern const kernel_desc_t kernels_suite[KERNELS_SUITE_LEN];
+#endif
+
+#endif /* KERNELS_BENCH_H */
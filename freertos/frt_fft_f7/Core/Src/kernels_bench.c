@@ -0,0 +1,613 @@
+#include <stdint.h>
+
+#include "kernels_bench.h"
+#ifdef BENCH_SIMD
+#include "bench_simd.h"
+#endif
+
+/*
+ * Kernel della suite. Niente libc (il modulo wasm è -nostdlib) e dati
+ * piccoli: tutto sta in una pagina wasm da 64 KB insieme allo stack.
+ *
+ * Ogni K_bench(n) ripete il kernel n volte facendo dipendere ogni giro dal
+ * precedente (retroazione sull'input o stato persistente), così né il
+ * compilatore nativo né wamrc possono eliminare i giri ripetuti.
+ *
+ * Le somme float non devono essere contratte in FMA, altrimenti il
+ * checksum nativo (es. GCC su Cortex-M4F) diverge da quello wasm.
+ */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+/* ---------------------------------------------------------
+ * Utilità comuni
+ * --------------------------------------------------------- */
+
+/* LCG di Numerical Recipes: stessa sequenza su ogni target */
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+/* float in [-1, 1) a partire da 24 bit casuali */
+static float lcg_float(uint32_t *state)
+{
+    return (float)(int32_t)(lcg_next(state) >> 8) / 8388608.0f - 1.0f;
+}
+
+/* FNV-1a a 32 bit su parole da 32 bit */
+static uint32_t fnv1a_words(const uint32_t *w, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t v = w[i];
+        for (int b = 0; b < 4; ++b) {
+            h ^= (v >> (8 * b)) & 0xFFu;
+            h *= 16777619u;
+        }
+    }
+    return h;
+}
+
+static uint32_t fnv1a_bytes(const uint8_t *p, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; ++i) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t float_bits(float f)
+{
+    union { float f; uint32_t u; } v = { .f = f };
+    return v.u;
+}
+
+static uint32_t fnv1a_floats(const float *f, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t v = float_bits(f[i]);
+        for (int b = 0; b < 4; ++b) {
+            h ^= (v >> (8 * b)) & 0xFFu;
+            h *= 16777619u;
+        }
+    }
+    return h;
+}
+
+/* ---------------------------------------------------------
+ * FIR float, 32 tap su 256 campioni (MAC float, memory streaming)
+ * --------------------------------------------------------- */
+#define FIR_TAPS 32
+#define FIR_LEN  256
+
+static float fir_coef[FIR_TAPS];
+static float fir_in[FIR_LEN + FIR_TAPS - 1];
+static float fir_out[FIR_LEN];
+
+WASM_EXPORT("fir_init")
+void fir_init(void)
+{
+    uint32_t seed = 1;
+    /* finestra triangolare normalizzata: guadagno DC = 1 */
+    const float norm = 1.0f / (float)((FIR_TAPS / 2) * (FIR_TAPS / 2 + 1));
+    for (int k = 0; k < FIR_TAPS; ++k) {
+        int t = k < FIR_TAPS / 2 ? k + 1 : FIR_TAPS - k;
+        fir_coef[k] = (float)t * norm;
+    }
+    for (int i = 0; i < FIR_LEN + FIR_TAPS - 1; ++i) {
+        fir_in[i] = lcg_float(&seed);
+    }
+}
+
+WASM_EXPORT("fir_bench")
+void fir_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int n = 0; n < FIR_LEN; ++n) {
+            float acc = 0.0f;
+            for (int k = 0; k < FIR_TAPS; ++k) {
+                acc += fir_coef[k] * fir_in[n + k];
+            }
+            fir_out[n] = acc;
+        }
+        fir_in[FIR_TAPS - 1 + (it & (FIR_LEN - 1))] = 0.5f * fir_out[FIR_LEN - 1];
+    }
+}
+
+WASM_EXPORT("fir_checksum")
+uint32_t fir_checksum(void)
+{
+    return fnv1a_floats(fir_out, FIR_LEN);
+}
+
+/* ---------------------------------------------------------
+ * IIR float: 4 biquad in cascata, forma diretta II trasposta
+ * (catena di dipendenze serie, poca memoria)
+ * --------------------------------------------------------- */
+#define IIR_SECTIONS 4
+#define IIR_LEN      256
+
+/* passa-basso Butterworth fc = 0.1 fs, sezioni identiche */
+static const float iir_b[3] = { 0.06745527f, 0.13491055f, 0.06745527f };
+static const float iir_a[2] = { -1.1429805f, 0.4128016f };
+
+static float iir_state[IIR_SECTIONS][2];
+static float iir_in[IIR_LEN];
+static float iir_out[IIR_LEN];
+
+WASM_EXPORT("iir_init")
+void iir_init(void)
+{
+    uint32_t seed = 2;
+    for (int s = 0; s < IIR_SECTIONS; ++s) {
+        iir_state[s][0] = 0.0f;
+        iir_state[s][1] = 0.0f;
+    }
+    for (int i = 0; i < IIR_LEN; ++i) {
+        iir_in[i] = lcg_float(&seed);
+    }
+}
+
+WASM_EXPORT("iir_bench")
+void iir_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int n = 0; n < IIR_LEN; ++n) {
+            float x = iir_in[n];
+            for (int s = 0; s < IIR_SECTIONS; ++s) {
+                float y = iir_b[0] * x + iir_state[s][0];
+                iir_state[s][0] = iir_b[1] * x - iir_a[0] * y + iir_state[s][1];
+                iir_state[s][1] = iir_b[2] * x - iir_a[1] * y;
+                x = y;
+            }
+            iir_out[n] = x;
+        }
+    }
+}
+
+WASM_EXPORT("iir_checksum")
+uint32_t iir_checksum(void)
+{
+    return fnv1a_floats(iir_out, IIR_LEN);
+}
+
+/* ---------------------------------------------------------
+ * Moltiplicazione di matrici intere 16x16 (ALU intera + indirizzamento)
+ * --------------------------------------------------------- */
+#define MAT_N 16
+
+static uint32_t mat_a[MAT_N][MAT_N];
+static uint32_t mat_b[MAT_N][MAT_N];
+static uint32_t mat_c[MAT_N][MAT_N];
+
+WASM_EXPORT("matmul_init")
+void matmul_init(void)
+{
+    uint32_t seed = 3;
+    for (int i = 0; i < MAT_N; ++i) {
+        for (int j = 0; j < MAT_N; ++j) {
+            mat_a[i][j] = lcg_next(&seed) >> 20;
+            mat_b[i][j] = lcg_next(&seed) >> 20;
+            mat_c[i][j] = 0;
+        }
+    }
+}
+
+WASM_EXPORT("matmul_bench")
+void matmul_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int i = 0; i < MAT_N; ++i) {
+            for (int j = 0; j < MAT_N; ++j) {
+                uint32_t acc = 0;
+                for (int k = 0; k < MAT_N; ++k) {
+                    acc += mat_a[i][k] * mat_b[k][j];
+                }
+                mat_c[i][j] = acc;
+            }
+        }
+        mat_a[it & (MAT_N - 1)][(it >> 4) & (MAT_N - 1)] ^= mat_c[MAT_N - 1][MAT_N - 1] & 0xFFFu;
+    }
+}
+
+WASM_EXPORT("matmul_checksum")
+uint32_t matmul_checksum(void)
+{
+    return fnv1a_words(&mat_c[0][0], MAT_N * MAT_N);
+}
+
+/* ---------------------------------------------------------
+ * CRC32 (zlib) a tabella su 1 KB (load dipendenti da tabella)
+ * --------------------------------------------------------- */
+#define CRC_LEN 1024
+
+static uint32_t crc_table[256];
+static uint8_t  crc_buf[CRC_LEN];
+static uint32_t crc_value;
+
+WASM_EXPORT("crc32_init")
+void crc32_init(void)
+{
+    uint32_t seed = 4;
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1u) ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+        }
+        crc_table[i] = c;
+    }
+    for (int i = 0; i < CRC_LEN; ++i) {
+        crc_buf[i] = (uint8_t)(lcg_next(&seed) >> 24);
+    }
+    crc_value = 0;
+}
+
+WASM_EXPORT("crc32_bench")
+void crc32_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        uint32_t c = 0xFFFFFFFFu;
+        for (int i = 0; i < CRC_LEN; ++i) {
+            c = crc_table[(c ^ crc_buf[i]) & 0xFFu] ^ (c >> 8);
+        }
+        crc_value = c ^ 0xFFFFFFFFu;
+        crc_buf[it & (CRC_LEN - 1)] = (uint8_t)crc_value;
+    }
+}
+
+WASM_EXPORT("crc32_checksum")
+uint32_t crc32_checksum(void)
+{
+    return crc_value;
+}
+
+/* ---------------------------------------------------------
+ * AES-128 (FIPS-197), cifratura ECB di 16 blocchi: ogni giro cifra il
+ * testo cifrato del giro precedente (byte, S-box, xtime)
+ * --------------------------------------------------------- */
+#define AES_BLOCKS 16
+
+static const uint8_t aes_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static uint8_t aes_round_key[176];
+static uint8_t aes_buf[AES_BLOCKS * 16];
+
+static uint8_t aes_xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80u) ? 0x1Bu : 0x00u));
+}
+
+static void aes_key_expand(const uint8_t key[16])
+{
+    uint8_t rcon = 0x01;
+
+    for (int i = 0; i < 16; ++i) {
+        aes_round_key[i] = key[i];
+    }
+    for (int i = 16; i < 176; i += 4) {
+        uint8_t t0 = aes_round_key[i - 4], t1 = aes_round_key[i - 3];
+        uint8_t t2 = aes_round_key[i - 2], t3 = aes_round_key[i - 1];
+        if ((i & 15) == 0) {
+            uint8_t tmp = t0;
+            t0 = (uint8_t)(aes_sbox[t1] ^ rcon);
+            t1 = aes_sbox[t2];
+            t2 = aes_sbox[t3];
+            t3 = aes_sbox[tmp];
+            rcon = aes_xtime(rcon);
+        }
+        aes_round_key[i + 0] = aes_round_key[i - 16] ^ t0;
+        aes_round_key[i + 1] = aes_round_key[i - 15] ^ t1;
+        aes_round_key[i + 2] = aes_round_key[i - 14] ^ t2;
+        aes_round_key[i + 3] = aes_round_key[i - 13] ^ t3;
+    }
+}
+
+static void aes_encrypt_block(uint8_t s[16])
+{
+    for (int i = 0; i < 16; ++i) {
+        s[i] ^= aes_round_key[i];
+    }
+    for (int round = 1; round <= 10; ++round) {
+        uint8_t t[16];
+        /* SubBytes + ShiftRows (stato per colonne: s[4*c + r]) */
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                t[4 * c + r] = aes_sbox[s[4 * ((c + r) & 3) + r]];
+            }
+        }
+        if (round < 10) {
+            /* MixColumns */
+            for (int c = 0; c < 4; ++c) {
+                uint8_t *col = &t[4 * c];
+                uint8_t a0 = col[0], a1 = col[1], a2 = col[2], a3 = col[3];
+                uint8_t all = (uint8_t)(a0 ^ a1 ^ a2 ^ a3);
+                col[0] ^= (uint8_t)(all ^ aes_xtime((uint8_t)(a0 ^ a1)));
+                col[1] ^= (uint8_t)(all ^ aes_xtime((uint8_t)(a1 ^ a2)));
+                col[2] ^= (uint8_t)(all ^ aes_xtime((uint8_t)(a2 ^ a3)));
+                col[3] ^= (uint8_t)(all ^ aes_xtime((uint8_t)(a3 ^ a0)));
+            }
+        }
+        for (int i = 0; i < 16; ++i) {
+            s[i] = t[i] ^ aes_round_key[16 * round + i];
+        }
+    }
+}
+
+WASM_EXPORT("aes_init")
+void aes_init(void)
+{
+    /* chiave e primo blocco del vettore di test FIPS-197 C.1 */
+    uint8_t key[16];
+    for (int i = 0; i < 16; ++i) {
+        key[i] = (uint8_t)i;
+    }
+    aes_key_expand(key);
+    for (int i = 0; i < AES_BLOCKS * 16; ++i) {
+        aes_buf[i] = (uint8_t)(((i & 15) << 4) | (i & 15)) ^ (uint8_t)(i >> 4);
+    }
+}
+
+WASM_EXPORT("aes_bench")
+void aes_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int b = 0; b < AES_BLOCKS; ++b) {
+            aes_encrypt_block(&aes_buf[16 * b]);
+        }
+    }
+}
+
+WASM_EXPORT("aes_checksum")
+uint32_t aes_checksum(void)
+{
+    return fnv1a_bytes(aes_buf, AES_BLOCKS * 16);
+}
+
+/* ---------------------------------------------------------
+ * Ordinamento di 256 interi: quicksort ricorsivo + insertion sort
+ * (chiamate, branch dipendenti dai dati)
+ * --------------------------------------------------------- */
+#define SORT_LEN 256
+
+static uint32_t sort_buf[SORT_LEN];
+static uint32_t sort_seed;
+
+static void insertion_sort(uint32_t *a, int n)
+{
+    for (int i = 1; i < n; ++i) {
+        uint32_t v = a[i];
+        int j = i;
+        while (j > 0 && a[j - 1] > v) {
+            a[j] = a[j - 1];
+            --j;
+        }
+        a[j] = v;
+    }
+}
+
+/* ricorre sulla parte più piccola: profondità <= log2(SORT_LEN) */
+static void quick_sort(uint32_t *a, int n)
+{
+    while (n > 16) {
+        uint32_t pivot = a[n / 2];
+        int i = 0, j = n - 1;
+        while (i <= j) {
+            while (a[i] < pivot) ++i;
+            while (a[j] > pivot) --j;
+            if (i <= j) {
+                uint32_t t = a[i];
+                a[i] = a[j];
+                a[j] = t;
+                ++i;
+                --j;
+            }
+        }
+        if (j + 1 < n - i) {
+            quick_sort(a, j + 1);
+            a += i;
+            n -= i;
+        } else {
+            quick_sort(a + i, n - i);
+            n = j + 1;
+        }
+    }
+    insertion_sort(a, n);
+}
+
+WASM_EXPORT("sort_init")
+void sort_init(void)
+{
+    sort_seed = 5;
+    for (int i = 0; i < SORT_LEN; ++i) {
+        sort_buf[i] = 0;
+    }
+}
+
+WASM_EXPORT("sort_bench")
+void sort_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int i = 0; i < SORT_LEN; ++i) {
+            sort_buf[i] = lcg_next(&sort_seed);
+        }
+        quick_sort(sort_buf, SORT_LEN);
+    }
+}
+
+WASM_EXPORT("sort_checksum")
+uint32_t sort_checksum(void)
+{
+    /* un ordinamento sbagliato deve cambiare il checksum */
+    for (int i = 1; i < SORT_LEN; ++i) {
+        if (sort_buf[i - 1] > sort_buf[i]) {
+            return 0;
+        }
+    }
+    return fnv1a_words(sort_buf, SORT_LEN);
+}
+
+/* ---------------------------------------------------------
+ * FIR Q15 a 16 tap con saturazione (aritmetica fixed-point stile CMSIS)
+ * --------------------------------------------------------- */
+#define Q15_TAPS 16
+#define Q15_LEN  256
+
+static int16_t q15_coef[Q15_TAPS];
+static int16_t q15_in[Q15_LEN + Q15_TAPS - 1];
+static int16_t q15_out[Q15_LEN];
+
+static int16_t q15_sat(int32_t v)
+{
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (int16_t)v;
+}
+
+WASM_EXPORT("q15_init")
+void q15_init(void)
+{
+    uint32_t seed = 6;
+    /* coefficienti con somma > 1 in Q15: la saturazione scatta davvero */
+    for (int k = 0; k < Q15_TAPS; ++k) {
+        q15_coef[k] = (int16_t)(2048 + 256 * (k < Q15_TAPS / 2 ? k : Q15_TAPS - 1 - k));
+    }
+    for (int i = 0; i < Q15_LEN + Q15_TAPS - 1; ++i) {
+        q15_in[i] = (int16_t)(lcg_next(&seed) >> 16);
+    }
+}
+
+WASM_EXPORT("q15_bench")
+void q15_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int n = 0; n < Q15_LEN; ++n) {
+            int32_t acc = 0;
+            for (int k = 0; k < Q15_TAPS; ++k) {
+                acc += (int32_t)q15_coef[k] * q15_in[n + k];
+            }
+            q15_out[n] = q15_sat(acc >> 15);
+        }
+        q15_in[Q15_TAPS - 1 + (it & (Q15_LEN - 1))] = (int16_t)(q15_out[Q15_LEN - 1] >> 1);
+    }
+}
+
+WASM_EXPORT("q15_checksum")
+uint32_t q15_checksum(void)
+{
+    return fnv1a_bytes((const uint8_t *)q15_out, sizeof(q15_out));
+}
+
+#ifdef BENCH_SIMD
+/* ---------------------------------------------------------
+ * Varianti SIMD a 128 bit (wasm simd128 / SSE4.1 / NEON): ogni lane
+ * calcola un'uscita con le stesse operazioni dello scalare
+ * --------------------------------------------------------- */
+
+WASM_EXPORT("fir_simd_init")
+void fir_simd_init(void) { fir_init(); }
+
+WASM_EXPORT("fir_simd_bench")
+void fir_simd_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int n = 0; n < FIR_LEN; n += 4) {
+            bsimd_f32x4 acc = bsimd_splat_f32(0.0f);
+            for (int k = 0; k < FIR_TAPS; ++k) {
+                bsimd_f32x4 x = bsimd_load_f32(&fir_in[n + k]);
+                acc = bsimd_add_f32(acc, bsimd_mul_f32(bsimd_splat_f32(fir_coef[k]), x));
+            }
+            bsimd_store_f32(&fir_out[n], acc);
+        }
+        fir_in[FIR_TAPS - 1 + (it & (FIR_LEN - 1))] = 0.5f * fir_out[FIR_LEN - 1];
+    }
+}
+
+WASM_EXPORT("fir_simd_checksum")
+uint32_t fir_simd_checksum(void) { return fir_checksum(); }
+
+WASM_EXPORT("matmul_simd_init")
+void matmul_simd_init(void) { matmul_init(); }
+
+WASM_EXPORT("matmul_simd_bench")
+void matmul_simd_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int i = 0; i < MAT_N; ++i) {
+            for (int j = 0; j < MAT_N; j += 4) {
+                bsimd_i32x4 acc = bsimd_splat_i32(0);
+                for (int k = 0; k < MAT_N; ++k) {
+                    bsimd_i32x4 b = bsimd_load_i32(&mat_b[k][j]);
+                    acc = bsimd_add_i32(acc, bsimd_mul_i32(bsimd_splat_i32(mat_a[i][k]), b));
+                }
+                bsimd_store_i32(&mat_c[i][j], acc);
+            }
+        }
+        mat_a[it & (MAT_N - 1)][(it >> 4) & (MAT_N - 1)] ^= mat_c[MAT_N - 1][MAT_N - 1] & 0xFFFu;
+    }
+}
+
+WASM_EXPORT("matmul_simd_checksum")
+uint32_t matmul_simd_checksum(void) { return matmul_checksum(); }
+
+WASM_EXPORT("q15_simd_init")
+void q15_simd_init(void) { q15_init(); }
+
+/* 8 uscite per passo: accumulo a 32 bit, >> 15 e narrow con saturazione */
+WASM_EXPORT("q15_simd_bench")
+void q15_simd_bench(int32_t iterations)
+{
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int n = 0; n < Q15_LEN; n += 8) {
+            bsimd_i32x4 lo = bsimd_splat_i32(0);
+            bsimd_i32x4 hi = bsimd_splat_i32(0);
+            for (int k = 0; k < Q15_TAPS; ++k) {
+                bsimd_i32x4 c = bsimd_splat_i32(q15_coef[k]);
+                lo = bsimd_add_i32(lo, bsimd_mul_i32(c, bsimd_load_i16x4(&q15_in[n + k])));
+                hi = bsimd_add_i32(hi, bsimd_mul_i32(c, bsimd_load_i16x4(&q15_in[n + k + 4])));
+            }
+            bsimd_store_sat_i16x8(&q15_out[n], bsimd_sra_i32(lo, 15), bsimd_sra_i32(hi, 15));
+        }
+        q15_in[Q15_TAPS - 1 + (it & (Q15_LEN - 1))] = (int16_t)(q15_out[Q15_LEN - 1] >> 1);
+    }
+}
+
+WASM_EXPORT("q15_simd_checksum")
+uint32_t q15_simd_checksum(void) { return q15_checksum(); }
+#endif /* BENCH_SIMD */
+
+#if !(defined(__wasm__) || defined(__wasm))
+const kernel_desc_t kernels_suite[KERNELS_SUITE_LEN] = {
+    { "fir",    fir_init,    fir_bench,    fir_checksum    },
+    { "iir",    iir_init,    iir_bench,    iir_checksum    },
+    { "matmul", matmul_init, matmul_bench, matmul_checksum },
+    { "crc32",  crc32_init,  crc32_bench,  crc32_checksum  },
+    { "aes",    aes_init,    aes_bench,    aes_checksum    },
+    { "sort",   sort_init,   sort_bench,   sort_checksum   },
+    { "q15",    q15_init,    q15_bench,    q15_checksum    },
+};
+#endif
@@ -43,6 +43,7 @@ d_m3BeginExternC
 
 
 # if d_m3EnableOpProfiling
+                                    void        ProfileHit  (cstr_t i_operationName);
                                     d_m3RetSig  profileOp   (d_m3OpSig, cstr_t i_operationName);
 #   define nextOp()                 return profileOp (d_m3OpAllArgs, __FUNCTION__)
 # elif d_m3EnableOpTracing
@@ -52,7 +53,16 @@ d_m3BeginExternC
 #   define nextOp()                 nextOpDirect()
 # endif
 
+# if d_m3EnableOpProfiling
+#   undef  jumpOp
+#   define jumpOp(PC)               return profileOp ((pc_t)(PC), d_m3OpArgs, __FUNCTION__)
+// operations that run other operations (calls, function entry, loops) or leave by returning are counted
+// where they start instead of at nextOp (), so that counts and pairs follow the execution order
+#   define profileOpHere()          ProfileHit (__FUNCTION__)
+# else
 #define jumpOp(PC)                  jumpOpDirect(PC)
+#   define profileOpHere()          do {} while (0)
+# endif
 
 #if d_m3RecordBacktraces
     #define pushBacktraceFrame()            (PushBacktraceFrame (_mem->runtime, _pc - 1))
@@ -116,6 +126,26 @@ d_m3RetSig  Call  (d_m3OpSig)
 
 // TODO: OK, this needs some explanation here ;0
 
+// _rr: the operand below the top in the second register of the type, _r1 or _fp1 (d_m3HasReg1, d_m3HasFp1)
+#define d_m3RegisterPairOpMacro(RES, REG, REG1, TYPE, NAME, OP, ...) \
+d_m3Op(TYPE##_##NAME##_rr)                              \
+{                                                       \
+    OP((RES), ((TYPE) REG1), ((TYPE) REG), ##__VA_ARGS__); \
+    nextOp ();                                          \
+}
+
+#if d_m3HasReg1
+#   define d_m3RegisterPairOp__r0(RES, TYPE, NAME, OP, ...)     d_m3RegisterPairOpMacro (RES,  _r0,  _r1, TYPE, NAME, OP, ##__VA_ARGS__)
+#else
+#   define d_m3RegisterPairOp__r0(...)
+#endif
+
+#if d_m3HasFp1
+#   define d_m3RegisterPairOp__fp0(RES, TYPE, NAME, OP, ...)    d_m3RegisterPairOpMacro (RES, _fp0, _fp1, TYPE, NAME, OP, ##__VA_ARGS__)
+#else
+#   define d_m3RegisterPairOp__fp0(...)
+#endif
+
 #define d_m3CommutativeOpMacro(RES, REG, TYPE, NAME, OP, ...) \
 d_m3Op(TYPE##_##NAME##_rs)                              \
 {                                                       \
@@ -129,7 +159,8 @@ d_m3Op(TYPE##_##NAME##_ss)                              \
     TYPE operand1 = slot (TYPE);                        \
     OP((RES), operand1, operand2, ##__VA_ARGS__);       \
     nextOp ();                                          \
-}
+}                                                       \
+d_m3RegisterPairOp_##REG (RES, TYPE, NAME, OP, ##__VA_ARGS__)
 
 #define d_m3OpMacro(RES, REG, TYPE, NAME, OP, ...)      \
 d_m3Op(TYPE##_##NAME##_sr)                              \
@@ -534,11 +565,13 @@ d_m3Op  (Call)
 
     m3stack_t sp = _sp + stackOffset;
 
+    profileOpHere ();
+
     m3ret_t r = Call (callPC, sp, _mem, d_m3OpDefaultArgs);
     _mem = memory->mallocated;
 
     if (LIKELY(not r))
-        nextOp ();
+        nextOpDirect ();
     else
     {
         pushBacktraceFrame ();
@@ -559,6 +592,8 @@ d_m3Op  (CallIndirect)
 
     m3ret_t r = m3Err_none;
 
+    profileOpHere ();
+
     if (LIKELY(tableIndex < module->table0Size))
     {
         IM3Function function = module->table0 [tableIndex];
@@ -778,6 +813,8 @@ d_m3Op  (Entry)
     IM3Function function = immediate (IM3Function);
     IM3Memory memory = m3MemInfo (_mem);
 
+    profileOpHere ();
+
 #if d_m3SkipStackCheck
     if (true)
 #else
@@ -843,6 +880,8 @@ d_m3Op  (Loop)
 
     IM3Memory memory = m3MemInfo (_mem);
 
+    profileOpHere ();
+
     do
     {
 #if d_m3EnableStrace >= 3
@@ -942,6 +981,25 @@ d_m3SetRegisterSetSlot (f32, _fp0)
 d_m3SetRegisterSetSlot (f64, _fp0)
 #endif
 
+// a SetSlot the compiler turned into a move to the second register (UseSecondRegister in m3_compile.c):
+// the slot immediate stays, unread
+#define d_m3SetRegister1(TYPE, REG, REG1)   \
+d_m3Op  (SetRegister1_##TYPE)           \
+{                                       \
+    _pc++;                              \
+    REG1 = REG;                         \
+    nextOp ();                          \
+}
+
+#if d_m3HasReg1
+d_m3SetRegister1 (i32, _r0, _r1)
+d_m3SetRegister1 (i64, _r0, _r1)
+#endif
+#if d_m3HasFp1
+d_m3SetRegister1 (f32, _fp0, _fp1)
+d_m3SetRegister1 (f64, _fp0, _fp1)
+#endif
+
 d_m3Op (CopySlot_32)
 {
     u32 * dst = slot_ptr (u32);
@@ -1123,6 +1181,7 @@ d_m3Select_f (f64, _fp0, s, slot (i32))
 
 d_m3Op  (Return)
 {
+    profileOpHere ();
     m3StackCheck();
     return m3Err_none;
 }
@@ -1191,6 +1250,7 @@ d_m3Op  (ContinueLoop)
     // has the potential to increase its native-stack usage. (don't forget ContinueLoopIf too.)
 
     void * loopId = immediate (void *);
+    profileOpHere ();
     return loopId;
 }
 
@@ -1202,6 +1262,7 @@ d_m3Op  (ContinueLoopIf)
 
     if (condition)
     {
+        profileOpHere ();
         return loopId;
     }
     else nextOp ();
@@ -1353,6 +1414,270 @@ d_m3Load_i (i64, i32);
 d_m3Load_i (i64, u32);
 d_m3Load_i (i64, i64);
 
+
+//-----------------------
+// Superinstructions: an operation and the one the compiler emitted right after it, in a single dispatch.
+// The immediates of the second operation follow those of the first; NEXT is appended to the name of the
+// first and THEN (TYPE, RES) does the work of the second. The pairs are listed in c_fusedOps (m3_compile.c).
+
+#define d_m3ThenSetSlot(TYPE, RES)                      \
+    slot (TYPE) = (TYPE) (RES);                         \
+    nextOp ();
+
+// the fused SetRegister1: see d_m3SetRegister1
+#define d_m3ThenSetRegister1(TYPE, RES)                 \
+    _pc++;                                              \
+    d_m3Register1_##TYPE = (RES);                       \
+    nextOp ();
+
+#define d_m3Register1_i32                               _r1
+#define d_m3Register1_u32                               _r1
+#define d_m3Register1_f32                               _fp1
+#define d_m3Register1_f64                               _fp1
+
+#define d_m3ThenBranchIf(TYPE, RES)                     \
+    pc_t branch = immediate (pc_t);                     \
+    if ((i32) _r0)                                      \
+    {                                                   \
+        jumpOp (branch);                                \
+    }                                                   \
+    else nextOp ();
+
+#define d_m3ThenContinueLoopIf(TYPE, RES)               \
+    void * loopId = immediate (void *);                 \
+    if ((i32) _r0)                                      \
+    {                                                   \
+        profileOpHere ();                               \
+        return loopId;                                  \
+    }                                                   \
+    else nextOp ();
+
+#define d_m3FusedRegisterPairOpMacro(RES, REG, REG1, TYPE, NAME, NEXT, THEN, OP, ...) \
+d_m3Op(TYPE##_##NAME##_rr_##NEXT)                       \
+{                                                       \
+    OP((RES), ((TYPE) REG1), ((TYPE) REG), ##__VA_ARGS__); \
+    THEN (TYPE, RES)                                    \
+}
+
+#if d_m3HasReg1
+#   define d_m3FusedRegisterPairOp__r0(RES, TYPE, NAME, NEXT, THEN, OP, ...)   d_m3FusedRegisterPairOpMacro (RES,  _r0,  _r1, TYPE, NAME, NEXT, THEN, OP, ##__VA_ARGS__)
+#else
+#   define d_m3FusedRegisterPairOp__r0(...)
+#endif
+
+#if d_m3HasFp1
+#   define d_m3FusedRegisterPairOp__fp0(RES, TYPE, NAME, NEXT, THEN, OP, ...)  d_m3FusedRegisterPairOpMacro (RES, _fp0, _fp1, TYPE, NAME, NEXT, THEN, OP, ##__VA_ARGS__)
+#else
+#   define d_m3FusedRegisterPairOp__fp0(...)
+#endif
+
+#define d_m3FusedCommutativeOpMacro(RES, REG, TYPE, NAME, NEXT, THEN, OP, ...) \
+d_m3Op(TYPE##_##NAME##_rs_##NEXT)                       \
+{                                                       \
+    TYPE operand = slot (TYPE);                         \
+    OP((RES), operand, ((TYPE) REG), ##__VA_ARGS__);    \
+    THEN (TYPE, RES)                                    \
+}                                                       \
+d_m3Op(TYPE##_##NAME##_ss_##NEXT)                       \
+{                                                       \
+    TYPE operand2 = slot (TYPE);                        \
+    TYPE operand1 = slot (TYPE);                        \
+    OP((RES), operand1, operand2, ##__VA_ARGS__);       \
+    THEN (TYPE, RES)                                    \
+}                                                       \
+d_m3FusedRegisterPairOp_##REG (RES, TYPE, NAME, NEXT, THEN, OP, ##__VA_ARGS__)
+
+#define d_m3FusedOpMacro(RES, REG, TYPE, NAME, NEXT, THEN, OP, ...) \
+d_m3Op(TYPE##_##NAME##_sr_##NEXT)                       \
+{                                                       \
+    TYPE operand = slot (TYPE);                         \
+    OP((RES), ((TYPE) REG), operand, ##__VA_ARGS__);    \
+    THEN (TYPE, RES)                                    \
+}                                                       \
+d_m3FusedCommutativeOpMacro(RES, REG, TYPE, NAME, NEXT, THEN, OP, ##__VA_ARGS__)
+
+#define d_m3FusedUnaryMacro(RES, REG, TYPE, NAME, NEXT, THEN, OP, ...) \
+d_m3Op(TYPE##_##NAME##_r_##NEXT)                        \
+{                                                       \
+    OP((RES), (TYPE) REG, ##__VA_ARGS__);               \
+    THEN (TYPE, RES)                                    \
+}                                                       \
+d_m3Op(TYPE##_##NAME##_s_##NEXT)                        \
+{                                                       \
+    TYPE operand = slot (TYPE);                         \
+    OP((RES), operand, ##__VA_ARGS__);                  \
+    THEN (TYPE, RES)                                    \
+}
+
+#define d_m3FusedCommutativeOp_i(TYPE, NAME, NEXT, OP)  d_m3FusedCommutativeOpMacro ( _r0,  _r0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_OPER, OP)
+#define d_m3FusedOp_i(TYPE, NAME, NEXT, OP)             d_m3FusedOpMacro            ( _r0,  _r0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_OPER, OP)
+#define d_m3FusedOpFunc_i(TYPE, NAME, NEXT, OP)         d_m3FusedOpMacro            ( _r0,  _r0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_FUNC, OP)
+#define d_m3FusedUnaryOp_i(TYPE, NAME, NEXT, OP)        d_m3FusedUnaryMacro         ( _r0,  _r0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_UNARY, OP)
+#define d_m3FusedCommutativeOp_f(TYPE, NAME, NEXT, OP)  d_m3FusedCommutativeOpMacro (_fp0, _fp0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_OPER, OP)
+#define d_m3FusedOp_f(TYPE, NAME, NEXT, OP)             d_m3FusedOpMacro            (_fp0, _fp0, TYPE, NAME, NEXT, d_m3Then##NEXT, M3_OPER, OP)
+
+// the load of d_m3Load; ADDRESS () reads the immediates and sets 'operand'
+#define d_m3FusedLoadMacro(NAME, REG, DEST_TYPE, SRC_TYPE, ADDRESS, THEN) \
+d_m3Op(NAME)                                            \
+{                                                       \
+    d_m3TracePrepare                                    \
+    ADDRESS ()                                          \
+                                                        \
+    if (m3MemCheck(                                     \
+        operand + sizeof (SRC_TYPE) <= _mem->length     \
+    )) {                                                \
+        u8* src8 = m3MemData(_mem) + operand;           \
+        SRC_TYPE value;                                 \
+        memcpy(&value, src8, sizeof(value));            \
+        M3_BSWAP_##SRC_TYPE(value);                     \
+        REG = (DEST_TYPE)value;                         \
+        d_m3TraceLoad(DEST_TYPE, operand, REG);         \
+        THEN (DEST_TYPE, REG)                           \
+    } else d_outOfBounds;                               \
+}
+
+#define d_m3LoadAddress_r()                             \
+    u64 operand = (u32) _r0;                            \
+    operand += immediate (u32);
+
+#define d_m3LoadAddress_s()                             \
+    u64 operand = slot (u32);                           \
+    operand += immediate (u32);
+
+// i32.add of the address: the sum only feeds the load, so it isn't kept in _r0
+#define d_m3LoadAddress_Add_rs()                        \
+    u64 operand = (u32) (slot (u32) + (u32) _r0);       \
+    operand += immediate (u32);
+
+#define d_m3LoadAddress_Add_ss()                        \
+    u32 address2 = slot (u32);                          \
+    u32 address1 = slot (u32);                          \
+    u64 operand = (u32) (address1 + address2);          \
+    operand += immediate (u32);
+
+#define d_m3LoadAddress_Add_rr()                        \
+    u64 operand = (u32) ((u32) _r1 + (u32) _r0);        \
+    operand += immediate (u32);
+
+#define d_m3ThenNext(TYPE, RES)                         \
+    nextOp ();
+
+#if d_m3FuseSetSlot
+
+// NEXT is SetSlot, or SetRegister1 for the same operations with a second register (see d_m3SetRegister1)
+#define d_m3FusedLoad(REG, DEST_TYPE, SRC_TYPE, NEXT)                                                                       \
+d_m3FusedLoadMacro (DEST_TYPE##_Load_##SRC_TYPE##_r_##NEXT, REG, DEST_TYPE, SRC_TYPE, d_m3LoadAddress_r, d_m3Then##NEXT)  \
+d_m3FusedLoadMacro (DEST_TYPE##_Load_##SRC_TYPE##_s_##NEXT, REG, DEST_TYPE, SRC_TYPE, d_m3LoadAddress_s, d_m3Then##NEXT)
+
+#define d_m3FusedResultOps_i(NEXT)                      \
+d_m3FusedCommutativeOp_i (i32, Add,         NEXT, +)    \
+d_m3FusedCommutativeOp_i (i32, Multiply,    NEXT, *)    \
+d_m3FusedOp_i (i32, Subtract,               NEXT, -)    \
+d_m3FusedOpFunc_i (u32, ShiftLeft,          NEXT, OP_SHL_32) \
+d_m3FusedOpFunc_i (i32, ShiftRight,         NEXT, OP_SHR_32) \
+d_m3FusedOpFunc_i (u32, ShiftRight,         NEXT, OP_SHR_32) \
+d_m3FusedCommutativeOp_i (u32, And,         NEXT, &)    \
+d_m3FusedCommutativeOp_i (u32, Or,          NEXT, |)    \
+d_m3FusedCommutativeOp_i (u32, Xor,         NEXT, ^)    \
+d_m3FusedLoad (_r0, i32, i8,  NEXT)                     \
+d_m3FusedLoad (_r0, i32, u8,  NEXT)                     \
+d_m3FusedLoad (_r0, i32, i16, NEXT)                     \
+d_m3FusedLoad (_r0, i32, u16, NEXT)                     \
+d_m3FusedLoad (_r0, i32, i32, NEXT)
+
+// no Multiply + Add: as one C function the compiler may contract it into a fused multiply-add,
+// which rounds once instead of twice and so wouldn't give the result of the two Wasm instructions
+#define d_m3FusedResultOps_f(NEXT)                      \
+d_m3FusedCommutativeOp_f (f32, Add,         NEXT, +)    \
+d_m3FusedCommutativeOp_f (f32, Multiply,    NEXT, *)    \
+d_m3FusedOp_f (f32, Subtract,               NEXT, -)    \
+d_m3FusedCommutativeOp_f (f64, Add,         NEXT, +)    \
+d_m3FusedCommutativeOp_f (f64, Multiply,    NEXT, *)    \
+d_m3FusedOp_f (f64, Subtract,               NEXT, -)    \
+d_m3FusedLoad (_fp0, f32, f32, NEXT)                    \
+d_m3FusedLoad (_fp0, f64, f64, NEXT)
+
+d_m3FusedResultOps_i (SetSlot)
+#if d_m3HasFloat
+d_m3FusedResultOps_f (SetSlot)
+#endif
+#if d_m3HasReg1
+d_m3FusedResultOps_i (SetRegister1)
+#endif
+#if d_m3HasFp1
+d_m3FusedResultOps_f (SetRegister1)
+#endif
+
+#endif // d_m3FuseSetSlot
+
+#if d_m3FuseLoadAddress
+
+#define d_m3LoadAddFused(REG, DEST_TYPE, SRC_TYPE, ADD, THEN, SUFFIX) \
+d_m3FusedLoadMacro (i32_Add_##ADD##_##DEST_TYPE##_Load_##SRC_TYPE##SUFFIX, REG, DEST_TYPE, SRC_TYPE, d_m3LoadAddress_Add_##ADD, THEN)
+
+#if d_m3HasReg1
+#   define d_m3LoadAddRegisterPair(REG, DEST_TYPE, SRC_TYPE, THEN, SUFFIX)  d_m3LoadAddFused (REG, DEST_TYPE, SRC_TYPE, rr, THEN, SUFFIX)
+#else
+#   define d_m3LoadAddRegisterPair(...)
+#endif
+
+#define d_m3LoadAdd(REG, DEST_TYPE, SRC_TYPE, THEN, SUFFIX)                 \
+d_m3LoadAddFused (REG, DEST_TYPE, SRC_TYPE, rs, THEN, SUFFIX)              \
+d_m3LoadAddFused (REG, DEST_TYPE, SRC_TYPE, ss, THEN, SUFFIX)              \
+d_m3LoadAddRegisterPair (REG, DEST_TYPE, SRC_TYPE, THEN, SUFFIX)
+
+#define d_m3LoadAddOps_i(THEN, SUFFIX)                  \
+d_m3LoadAdd (_r0, i32, i8,  THEN, SUFFIX)              \
+d_m3LoadAdd (_r0, i32, u8,  THEN, SUFFIX)              \
+d_m3LoadAdd (_r0, i32, i16, THEN, SUFFIX)              \
+d_m3LoadAdd (_r0, i32, u16, THEN, SUFFIX)              \
+d_m3LoadAdd (_r0, i32, i32, THEN, SUFFIX)
+
+#define d_m3LoadAddOps_f(THEN, SUFFIX)                  \
+d_m3LoadAdd (_fp0, f32, f32, THEN, SUFFIX)              \
+d_m3LoadAdd (_fp0, f64, f64, THEN, SUFFIX)
+
+d_m3LoadAddOps_i (d_m3ThenNext, )
+#if d_m3HasFloat
+d_m3LoadAddOps_f (d_m3ThenNext, )
+#endif
+
+#if d_m3FuseSetSlot
+d_m3LoadAddOps_i (d_m3ThenSetSlot, _SetSlot)
+# if d_m3HasFloat
+d_m3LoadAddOps_f (d_m3ThenSetSlot, _SetSlot)
+# endif
+# if d_m3HasReg1
+d_m3LoadAddOps_i (d_m3ThenSetRegister1, _SetRegister1)
+# endif
+# if d_m3HasFp1
+d_m3LoadAddOps_f (d_m3ThenSetRegister1, _SetRegister1)
+# endif
+#endif
+
+#endif // d_m3FuseLoadAddress
+
+#if d_m3FuseCompareBranch
+
+#define d_m3FusedCompareBranch(MACRO, TYPE, NAME, OP)   \
+MACRO (TYPE, NAME, BranchIf, OP)                        \
+MACRO (TYPE, NAME, ContinueLoopIf, OP)
+
+d_m3FusedCompareBranch (d_m3FusedCommutativeOp_i,   i32, Equal,                 ==)
+d_m3FusedCompareBranch (d_m3FusedCommutativeOp_i,   i32, NotEqual,              !=)
+d_m3FusedCompareBranch (d_m3FusedOp_i,              i32, LessThan,              < )
+d_m3FusedCompareBranch (d_m3FusedOp_i,              i32, GreaterThan,           > )
+d_m3FusedCompareBranch (d_m3FusedOp_i,              i32, LessThanOrEqual,       <=)
+d_m3FusedCompareBranch (d_m3FusedOp_i,              i32, GreaterThanOrEqual,    >=)
+d_m3FusedCompareBranch (d_m3FusedOp_i,              u32, LessThan,              < )
+d_m3FusedCompareBranch (d_m3FusedOp_i,              u32, GreaterThan,           > )
+d_m3FusedCompareBranch (d_m3FusedOp_i,              u32, LessThanOrEqual,       <=)
+d_m3FusedCompareBranch (d_m3FusedOp_i,              u32, GreaterThanOrEqual,    >=)
+d_m3FusedCompareBranch (d_m3FusedUnaryOp_i,         i32, EqualToZero,           OP_EQZ)
+d_m3FusedCompareBranch (d_m3FusedCommutativeOp_i,   u32, And,                   &)
+
+#endif // d_m3FuseCompareBranch
+
 #define d_m3Store(REG, SRC_TYPE, DEST_TYPE)             \
 d_m3Op  (SRC_TYPE##_Store_##DEST_TYPE##_rs)             \
 {                                                       \
@@ -1480,7 +1805,13 @@ typedef struct M3ProfilerSlot
 }
 M3ProfilerSlot;
 
-void  ProfileHit  (cstr_t i_operationName);
+typedef struct M3ProfilerPairSlot
+{
+    cstr_t      opName;
+    cstr_t      nextName;
+    u64         hitCount;
+}
+M3ProfilerPairSlot;
 
 d_m3RetSig  profileOp  (d_m3OpSig, cstr_t i_operationName)
 {
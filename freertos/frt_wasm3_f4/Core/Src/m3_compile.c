@@ -39,6 +39,23 @@ static const IM3Operation c_setGlobalOps [] =    { NULL, op_SetGlobal_i32,
 static const IM3Operation c_setRegisterOps [] =  { NULL, op_SetRegister_i32,           op_SetRegister_i64,
                                                     FPOP(op_SetRegister_f32),     FPOP(op_SetRegister_f64) };
 
+#if d_m3HasReg1
+#   define REG1OP(x) x
+#else
+#   define REG1OP(x) NULL
+#endif
+
+#if d_m3HasFp1
+#   define FP1OP(x) x
+#else
+#   define FP1OP(x) NULL
+#endif
+
+#if d_m3HasSecondRegisters
+static const IM3Operation c_setRegister1Ops [] = { NULL, REG1OP(op_SetRegister1_i32),  REG1OP(op_SetRegister1_i64),
+                                                    FP1OP(op_SetRegister1_f32),   FP1OP(op_SetRegister1_f64) };
+#endif
+
 static const IM3Operation c_intSelectOps [2] [4] =      { { op_Select_i32_rss, op_Select_i32_srs, op_Select_i32_ssr, op_Select_i32_sss },
                                                           { op_Select_i64_rss, op_Select_i64_srs, op_Select_i64_ssr, op_Select_i64_sss } };
 #if d_m3HasFloat
@@ -48,6 +65,147 @@ static const IM3Operation c_fpSelectOps [2] [2] [3] = { { { op_Select_f32_sss, o
                                                           { op_Select_f64_rss, op_Select_f64_rrs, op_Select_f64_rsr } } };    // selector in reg
 #endif
 
+#define d_m3HasFusedOps (d_m3FuseSetSlot || d_m3FuseLoadAddress || d_m3FuseCompareBranch)
+
+#if d_m3HasFusedOps
+// superinstructions: 'first' followed by 'second' becomes 'fused' (see EmitFusableOp). the pairs are the
+// most frequent ones of the FFT and DSP kernels in the op profiles (bench_opprof.py pairs):
+//  - an op whose result goes to a local (local.set/tee) or is spilled to a slot: op + SetSlot
+//  - the address of a load computed by i32.add: i32.add + load
+//  - a compare feeding br_if: compare + BranchIf_r / ContinueLoopIf
+typedef struct M3FusedOp
+{
+    IM3Operation    first;
+    IM3Operation    second;
+    IM3Operation    fused;
+}
+M3FusedOp;
+
+#define d_fusedPair(FIRST, SECOND, NEXT)                { op_##FIRST, op_##SECOND, op_##FIRST##_##NEXT }
+#define d_fusedBinOp(OP, SECOND, NEXT)                  d_fusedPair (OP##_rs, SECOND, NEXT), d_fusedPair (OP##_sr, SECOND, NEXT), d_fusedPair (OP##_ss, SECOND, NEXT)
+#define d_fusedCommutativeBinOp(OP, SECOND, NEXT)       d_fusedPair (OP##_rs, SECOND, NEXT), d_fusedPair (OP##_ss, SECOND, NEXT)
+#define d_fusedUnaryOp(OP, SECOND, NEXT)                d_fusedPair (OP##_r, SECOND, NEXT), d_fusedPair (OP##_s, SECOND, NEXT)
+#define d_fusedLoadAddress(LOAD)                        d_fusedPair (i32_Add_rs, LOAD##_r, LOAD), d_fusedPair (i32_Add_ss, LOAD##_r, LOAD)
+#define d_fusedLoadAddressThen(LOAD, TYPE, NEXT)        d_fusedPair (i32_Add_rs_##LOAD, NEXT##_##TYPE, NEXT), d_fusedPair (i32_Add_ss_##LOAD, NEXT##_##TYPE, NEXT)
+#define d_fusedCompareBranch(LIST, OP)                  LIST (OP, BranchIf_r, BranchIf), LIST (OP, ContinueLoopIf, ContinueLoopIf)
+
+// the _rr operations of the second registers fuse like the others
+#if d_m3HasReg1
+#   define d_fusedRegisterPair_i(OP, SECOND, NEXT)      , d_fusedPair (OP##_rr, SECOND, NEXT)
+#   define d_fusedLoadAddressPair(LOAD, SECOND, NEXT)   , d_fusedPair (i32_Add_rr##LOAD, SECOND, NEXT)
+#else
+#   define d_fusedRegisterPair_i(OP, SECOND, NEXT)
+#   define d_fusedLoadAddressPair(LOAD, SECOND, NEXT)
+#endif
+
+#if d_m3HasFp1
+#   define d_fusedRegisterPair_f(OP, SECOND, NEXT)      , d_fusedPair (OP##_rr, SECOND, NEXT)
+#else
+#   define d_fusedRegisterPair_f(OP, SECOND, NEXT)
+#endif
+
+#define d_fusedBinOp_i(OP, SECOND, NEXT)                d_fusedBinOp (OP, SECOND, NEXT)             d_fusedRegisterPair_i (OP, SECOND, NEXT)
+#define d_fusedCommutativeBinOp_i(OP, SECOND, NEXT)     d_fusedCommutativeBinOp (OP, SECOND, NEXT)  d_fusedRegisterPair_i (OP, SECOND, NEXT)
+#define d_fusedBinOp_f(OP, SECOND, NEXT)                d_fusedBinOp (OP, SECOND, NEXT)             d_fusedRegisterPair_f (OP, SECOND, NEXT)
+#define d_fusedCommutativeBinOp_f(OP, SECOND, NEXT)     d_fusedCommutativeBinOp (OP, SECOND, NEXT)  d_fusedRegisterPair_f (OP, SECOND, NEXT)
+
+// NEXT is SetSlot or SetRegister1 (see UseSecondRegister)
+#define d_fusedResultOps_i(NEXT)                                        \
+    d_fusedCommutativeBinOp_i   (i32_Add,           NEXT##_i32, NEXT),  \
+    d_fusedCommutativeBinOp_i   (i32_Multiply,      NEXT##_i32, NEXT),  \
+    d_fusedBinOp_i              (i32_Subtract,      NEXT##_i32, NEXT),  \
+    d_fusedBinOp_i              (u32_ShiftLeft,     NEXT##_i32, NEXT),  \
+    d_fusedBinOp_i              (i32_ShiftRight,    NEXT##_i32, NEXT),  \
+    d_fusedBinOp_i              (u32_ShiftRight,    NEXT##_i32, NEXT),  \
+    d_fusedCommutativeBinOp_i   (u32_And,           NEXT##_i32, NEXT),  \
+    d_fusedCommutativeBinOp_i   (u32_Or,            NEXT##_i32, NEXT),  \
+    d_fusedCommutativeBinOp_i   (u32_Xor,           NEXT##_i32, NEXT),  \
+    d_fusedUnaryOp              (i32_Load_i8,       NEXT##_i32, NEXT),  \
+    d_fusedUnaryOp              (i32_Load_u8,       NEXT##_i32, NEXT),  \
+    d_fusedUnaryOp              (i32_Load_i16,      NEXT##_i32, NEXT),  \
+    d_fusedUnaryOp              (i32_Load_u16,      NEXT##_i32, NEXT),  \
+    d_fusedUnaryOp              (i32_Load_i32,      NEXT##_i32, NEXT)
+
+#define d_fusedResultOps_f(NEXT)                                        \
+    d_fusedCommutativeBinOp_f   (f32_Add,           NEXT##_f32, NEXT),  \
+    d_fusedCommutativeBinOp_f   (f32_Multiply,      NEXT##_f32, NEXT),  \
+    d_fusedBinOp_f              (f32_Subtract,      NEXT##_f32, NEXT),  \
+    d_fusedCommutativeBinOp_f   (f64_Add,           NEXT##_f64, NEXT),  \
+    d_fusedCommutativeBinOp_f   (f64_Multiply,      NEXT##_f64, NEXT),  \
+    d_fusedBinOp_f              (f64_Subtract,      NEXT##_f64, NEXT),  \
+    d_fusedUnaryOp              (f32_Load_f32,      NEXT##_f32, NEXT),  \
+    d_fusedUnaryOp              (f64_Load_f64,      NEXT##_f64, NEXT)
+
+#define d_fusedLoadAddress_i(LOAD)                      d_fusedLoadAddress (LOAD)   d_fusedLoadAddressPair (, LOAD##_r, LOAD)
+#define d_fusedLoadAddressThen_i(LOAD, TYPE, NEXT)      d_fusedLoadAddressThen (LOAD, TYPE, NEXT)   d_fusedLoadAddressPair (_##LOAD, NEXT##_##TYPE, NEXT)
+
+#define d_fusedLoadAddressOps_i(NEXT)                                   \
+    d_fusedLoadAddressThen_i (i32_Load_i8,  i32, NEXT),                 \
+    d_fusedLoadAddressThen_i (i32_Load_u8,  i32, NEXT),                 \
+    d_fusedLoadAddressThen_i (i32_Load_i16, i32, NEXT),                 \
+    d_fusedLoadAddressThen_i (i32_Load_u16, i32, NEXT),                 \
+    d_fusedLoadAddressThen_i (i32_Load_i32, i32, NEXT)
+
+#define d_fusedLoadAddressOps_f(NEXT)                                   \
+    d_fusedLoadAddressThen_i (f32_Load_f32, f32, NEXT),                 \
+    d_fusedLoadAddressThen_i (f64_Load_f64, f64, NEXT)
+
+static const M3FusedOp c_fusedOps [] =
+{
+# if d_m3FuseSetSlot
+    d_fusedResultOps_i (SetSlot),
+#   if d_m3HasFloat
+    d_fusedResultOps_f (SetSlot),
+#   endif
+#   if d_m3HasReg1
+    d_fusedResultOps_i (SetRegister1),
+#   endif
+#   if d_m3HasFp1
+    d_fusedResultOps_f (SetRegister1),
+#   endif
+# endif
+
+# if d_m3FuseLoadAddress
+#   if d_m3HasFloat
+    d_fusedLoadAddress_i (f32_Load_f32),
+    d_fusedLoadAddress_i (f64_Load_f64),
+#   endif
+    d_fusedLoadAddress_i (i32_Load_i8),
+    d_fusedLoadAddress_i (i32_Load_u8),
+    d_fusedLoadAddress_i (i32_Load_i16),
+    d_fusedLoadAddress_i (i32_Load_u16),
+    d_fusedLoadAddress_i (i32_Load_i32),
+#   if d_m3FuseSetSlot
+    d_fusedLoadAddressOps_i (SetSlot),
+#     if d_m3HasFloat
+    d_fusedLoadAddressOps_f (SetSlot),
+#     endif
+#     if d_m3HasReg1
+    d_fusedLoadAddressOps_i (SetRegister1),
+#     endif
+#     if d_m3HasFp1
+    d_fusedLoadAddressOps_f (SetRegister1),
+#     endif
+#   endif
+# endif
+
+# if d_m3FuseCompareBranch
+    d_fusedCompareBranch (d_fusedCommutativeBinOp_i,    i32_Equal),
+    d_fusedCompareBranch (d_fusedCommutativeBinOp_i,    i32_NotEqual),
+    d_fusedCompareBranch (d_fusedBinOp_i,               i32_LessThan),
+    d_fusedCompareBranch (d_fusedBinOp_i,               i32_GreaterThan),
+    d_fusedCompareBranch (d_fusedBinOp_i,               i32_LessThanOrEqual),
+    d_fusedCompareBranch (d_fusedBinOp_i,               i32_GreaterThanOrEqual),
+    d_fusedCompareBranch (d_fusedBinOp_i,               u32_LessThan),
+    d_fusedCompareBranch (d_fusedBinOp_i,               u32_GreaterThan),
+    d_fusedCompareBranch (d_fusedBinOp_i,               u32_LessThanOrEqual),
+    d_fusedCompareBranch (d_fusedBinOp_i,               u32_GreaterThanOrEqual),
+    d_fusedCompareBranch (d_fusedUnaryOp,               i32_EqualToZero),
+    d_fusedCompareBranch (d_fusedCommutativeBinOp_i,    u32_And),
+# endif
+};
+#endif // d_m3HasFusedOps
+
 static const u16 c_m3RegisterUnallocated = 0;
 static const u16 c_slotUnused = 0xffff;
 
@@ -90,10 +248,73 @@ void  ReleaseCompilationCodePage  (IM3Compilation o)
     ReleaseCodePage (o->runtime, o->page);
 }
 
+
+#if d_m3HasFusedOps
+IM3Operation  FindFusedOp  (IM3Operation i_first, IM3Operation i_second)
+{
+    for (u32 i = 0; i < M3_COUNT_OF (c_fusedOps); ++i)
+    {
+        if (c_fusedOps [i].first == i_first and c_fusedOps [i].second == i_second)
+            return c_fusedOps [i].fused;
+    }
+
+    return NULL;
+}
+#endif
+
+
+// emits i_operation or, when c_fusedOps pairs it with the operation right before it, rewrites that one into
+// the fused operation. the caller emits the immediates of i_operation either way: they follow those of the
+// first operation. only the previous opcode's operation is a candidate, so no label (a block end or a branch
+// continuation point) can fall between the two
+M3Result  EmitFusableOp  (IM3Compilation o, IM3Operation i_operation)
+{
+    M3Result result = m3Err_none;
+
+#if d_m3HasFusedOps
+    M3FusableOp * previous = & o->fusable;
+
+    if (o->page and previous->op and previous->end == GetPC (o))
+    {
+        IM3Operation fused = FindFusedOp (previous->op, i_operation);
+
+        if (fused)
+        {
+            * (IM3Operation *) previous->pc = fused;
+            previous->op = fused;
+            o->lastOp = * previous;
+
+            return result;
+        }
+    }
+#endif
+
+_   (EmitOp (o, i_operation));
+
+    if (o->page)
+    {
+        o->lastOp.op = i_operation;
+        o->lastOp.pc = GetPC (o) - 1;
+    }
+
+    _catch: return result;
+}
+
 bool  IsRegisterSlotAlias        (u16 i_slot)    { return (i_slot >= d_m3Reg0SlotAlias and i_slot != c_slotUnused); }
+#if d_m3HasSecondRegisters
+bool  IsFpRegisterSlotAlias      (u16 i_slot)    { return (i_slot == d_m3Fp0SlotAlias or i_slot == d_m3Fp1SlotAlias);   }
+bool  IsIntRegisterSlotAlias     (u16 i_slot)    { return (i_slot == d_m3Reg0SlotAlias or i_slot == d_m3Reg1SlotAlias); }
+bool  IsSecondRegisterSlotAlias  (u16 i_slot)    { return (i_slot == d_m3Reg1SlotAlias or i_slot == d_m3Fp1SlotAlias);  }
+
+// index into regStackIndexPlusOne
+u32   GetSlotAliasRegister       (u16 i_slot)    { return IsFpRegisterSlotAlias (i_slot) + 2 * IsSecondRegisterSlotAlias (i_slot); }
+#else
 bool  IsFpRegisterSlotAlias      (u16 i_slot)    { return (i_slot == d_m3Fp0SlotAlias);  }
 bool  IsIntRegisterSlotAlias     (u16 i_slot)    { return (i_slot == d_m3Reg0SlotAlias); }
 
+u32   GetSlotAliasRegister       (u16 i_slot)    { return IsFpRegisterSlotAlias (i_slot); }
+#endif
+
 u16 GetTypeNumSlots (u8 i_type)
 {
 #   if d_m3Use32BitSlots
@@ -395,14 +616,110 @@ M3Result  PreserveRegisterIfOccupied  (IM3Compilation o, u8 i_registerType)
 _       (AllocateSlots (o, & slot, type));
         o->wasmStack [stackIndex] = slot;
 
-_       (EmitOp (o, c_setSetOps [type]));
+_       (EmitFusableOp (o, c_setSetOps [type]));
         EmitSlotOffset (o, slot);
+
+#if d_m3HasSecondRegisters
+        if (o->page and c_setRegister1Ops [type])
+        {
+            M3PreservedRegister * preserved = & o->preserved [regSelect];
+
+            preserved->op = o->lastOp.op;
+            preserved->pc = o->lastOp.pc;
+            preserved->stackIndex = stackIndex;
+            preserved->slot = slot;
+        }
+#endif
     }
 
     _catch: return result;
 }
 
 
+#if d_m3HasSecondRegisters
+void  ClearPreservedRegisters  (IM3Compilation o)
+{
+    o->preserved [0].op = o->preserved [1].op = NULL;
+}
+
+
+// the SetSlot of a preserve, alone or fused, turned into the same operation setting the second register
+IM3Operation  GetSecondRegisterOp  (IM3Operation i_setSlot, u8 i_type)
+{
+    if (i_setSlot == c_setSetOps [i_type])
+        return c_setRegister1Ops [i_type];
+
+#   if d_m3FuseSetSlot
+    for (u32 i = 0; i < M3_COUNT_OF (c_fusedOps); ++i)
+    {
+        if (c_fusedOps [i].fused == i_setSlot and c_fusedOps [i].second == c_setSetOps [i_type])
+            return FindFusedOp (c_fusedOps [i].first, c_setRegister1Ops [i_type]);
+    }
+#   endif
+
+    return NULL;
+}
+
+
+// a binary operation with its top operand in _r0 (_fp0) and the other one in the slot of the last preserve of
+// that register: the preserve moves the value to _r1 (_fp1) instead and the operation is its _rr form. the
+// dispatches stay the same, the slot store and load go away. the preserve is still in straight code before
+// this opcode (the records don't survive the opcodes that branch or make labels, see KeepsPreservedRegisters)
+// and nothing has read the slot meanwhile, since the value is still on the stack
+bool  UseSecondRegister  (IM3Compilation o)
+{
+    i16 stackIndex = GetStackTopIndex (o) - 1;
+
+    if (stackIndex < o->block.blockStackIndex)
+        return false;
+
+    u8 type = GetStackTypeFromBottom (o, stackIndex);
+    u32 regSelect = IsFpType (type);
+    u16 slot = o->wasmStack [stackIndex];
+
+    M3PreservedRegister * preserved = & o->preserved [regSelect];
+
+    if (not preserved->op or preserved->stackIndex != stackIndex or preserved->slot != slot)
+        return false;
+
+    if (* (IM3Operation *) preserved->pc != preserved->op)
+        return false;
+
+    IM3Operation op = GetSecondRegisterOp (preserved->op, type);
+
+    if (not op)
+        return false;
+
+    * (IM3Operation *) preserved->pc = op;
+
+    if (o->lastOp.op and o->lastOp.pc == preserved->pc)
+        o->lastOp.op = op;
+    if (o->fusable.op and o->fusable.pc == preserved->pc)
+        o->fusable.op = op;
+
+    DeallocateSlot (o, slot, type);
+    o->wasmStack [stackIndex] = regSelect ? d_m3Fp1SlotAlias : d_m3Reg1SlotAlias;
+    AllocateRegister (o, 2 + regSelect, stackIndex);
+
+    preserved->op = NULL;
+
+    return true;
+}
+
+
+// opcodes the preserve records survive: no branch, no label, and they read only the values they pop
+bool  KeepsPreservedRegisters  (m3opcode_t i_opcode)
+{
+    return (i_opcode == 0x01                                            // nop
+        or  i_opcode == 0x1a                                            // drop
+        or  i_opcode == c_waOp_getLocal or i_opcode == c_waOp_setLocal  // not local.tee: it reads the top and keeps it
+        or  i_opcode == c_waOp_getGlobal or i_opcode == 0x24            // global.set
+        or (i_opcode >= 0x28 and i_opcode <= 0x3e)                      // loads, stores
+        or (i_opcode >= c_waOp_i32_const and i_opcode <= 0xc4));        // constants, numeric
+}
+#endif
+
+
 // all values must be in slots before entering loop, if, and else blocks
 // otherwise they'd end up preserve-copied in the block to probably different locations (if/else)
 M3Result  PreserveRegisters  (IM3Compilation o)
@@ -463,7 +780,7 @@ M3Result  Push  (IM3Compilation o, u8 i_type, u16 i_slot)
 
         if (IsRegisterSlotAlias (i_slot))
         {
-            u32 regSelect = IsFpRegisterSlotAlias (i_slot);
+            u32 regSelect = GetSlotAliasRegister (i_slot);
             AllocateRegister (o, regSelect, stackIndex);
         }
 
@@ -499,13 +816,21 @@ M3Result  Pop  (IM3Compilation o)
 
         if (IsRegisterSlotAlias (slot))
         {
-            u32 regSelect = IsFpRegisterSlotAlias (slot);
+            u32 regSelect = GetSlotAliasRegister (slot);
             DeallocateRegister (o, regSelect);
         }
         else if (slot >= o->slotFirstDynamicIndex)
         {
             DeallocateSlot (o, slot, type);
         }
+
+#if d_m3HasSecondRegisters
+        for (u32 i = 0; i < 2; ++i)
+        {
+            if (o->preserved [i].stackIndex == o->stackIndex)
+                o->preserved [i].op = NULL;
+        }
+#endif
     }
     else if (not IsStackPolymorphic (o))
         result = m3Err_functionStackUnderrun;
@@ -727,6 +1052,9 @@ void  PatchBranches  (IM3Compilation o)
     pc_t patches = o->block.patches;
     o->block.patches = NULL;
 
+    // pc is now a branch target: nothing emitted from here on can be fused into what comes before
+    o->lastOp.op = o->fusable.op = NULL;
+
     while (patches)
     {                                                           m3log (compile, "patching location: %p to pc: %p", patches, pc);
         pc_t next = * (pc_t *) patches;
@@ -753,7 +1081,7 @@ M3Result  CopyStackIndexToSlot  (IM3Compilation o, u16 i_destSlot, u16 i_stackIn
     }
     else op = Is64BitType (type) ? op_CopySlot_64 : op_CopySlot_32;
 
-_   (EmitOp (o, op));
+_   (EmitFusableOp (o, op));
     EmitSlotOffset (o, i_destSlot);
 
     if (not inRegister)
@@ -1364,7 +1692,7 @@ _               (EmitOp (o, op_ContinueLoop));
 _               (CopyStackTopToRegister (o, false));
 _               (PopType (o, c_m3Type_i32));
 
-_               (EmitOp (o, op_ContinueLoopIf));
+_               (EmitFusableOp (o, op_ContinueLoopIf));
                 EmitPointer (o, scope->pc);
             }
 
@@ -1400,7 +1728,7 @@ _               (EmitOp (o, op_ContinueLoopIf));
             {
                 IM3Operation op = IsStackTopInRegister (o) ? op_BranchIf_r : op_BranchIf_s;
 
-    _           (EmitOp (o, op));
+    _           (EmitFusableOp (o, op));
     _           (EmitSlotNumOfStackTopAndPop (o)); // condition
 
                 EmitPatchingBranchPointer (o, scope);
@@ -2050,6 +2378,12 @@ _           (PreserveRegisterIfOccupied (o, opInfo->type));
             {                                       d_m3Assert (i_opcode == 0x38 or i_opcode == 0x39);
                 op = opInfo->operations [3]; // _rr for fp.store
             }
+#if d_m3HasSecondRegisters
+            else if (opInfo->stackOffset == -1 and opInfo->operations [3] and UseSecondRegister (o))
+            {
+                op = opInfo->operations [3]; // _rr, second operand in _r1/_fp1
+            }
+#endif
         }
         else if (IsStackTopMinus1InRegister (o))
         {
@@ -2067,7 +2401,7 @@ _           (PreserveRegisterIfOccupied (o, opInfo->type));     // _ss
 
     if (op)
     {
-_       (EmitOp (o, op));
+_       (EmitFusableOp (o, op));
 
 _       (EmitSlotNumOfStackTopAndPop (o));
 
@@ -2147,9 +2481,19 @@ _   (Compile_Operator (o, i_opcode));
 
 #define d_emptyOpList                       { NULL,                     NULL,                       NULL,                       NULL }
 #define d_unaryOpList(TYPE, NAME)           { op_##TYPE##_##NAME##_r,   op_##TYPE##_##NAME##_s,     NULL,                       NULL }
-#define d_binOpList(TYPE, NAME)             { op_##TYPE##_##NAME##_rs,  op_##TYPE##_##NAME##_sr,    op_##TYPE##_##NAME##_ss,    NULL }
+#define d_binOpList(TYPE, NAME)             { op_##TYPE##_##NAME##_rs,  op_##TYPE##_##NAME##_sr,    op_##TYPE##_##NAME##_ss,    d_rrOp (TYPE, NAME) }
+#define d_storeOpList(TYPE, NAME)           { op_##TYPE##_##NAME##_rs,  op_##TYPE##_##NAME##_sr,    op_##TYPE##_##NAME##_ss,    NULL }
 #define d_storeFpOpList(TYPE, NAME)         { op_##TYPE##_##NAME##_rs,  op_##TYPE##_##NAME##_sr,    op_##TYPE##_##NAME##_ss,    op_##TYPE##_##NAME##_rr }
-#define d_commutativeBinOpList(TYPE, NAME)  { op_##TYPE##_##NAME##_rs,  NULL,                       op_##TYPE##_##NAME##_ss,    NULL }
+#define d_commutativeBinOpList(TYPE, NAME)  { op_##TYPE##_##NAME##_rs,  NULL,                       op_##TYPE##_##NAME##_ss,    d_rrOp (TYPE, NAME) }
+
+// _rr of the binary operations, with the second registers (see UseSecondRegister)
+#define d_rrOp(TYPE, NAME)                  d_rrOp_##TYPE (op_##TYPE##_##NAME##_rr)
+#define d_rrOp_i32(OP)                      REG1OP(OP)
+#define d_rrOp_u32(OP)                      REG1OP(OP)
+#define d_rrOp_i64(OP)                      REG1OP(OP)
+#define d_rrOp_u64(OP)                      REG1OP(OP)
+#define d_rrOp_f32(OP)                      FP1OP(OP)
+#define d_rrOp_f64(OP)                      FP1OP(OP)
 #define d_convertOpList(OP)                 { op_##OP##_r_r,            op_##OP##_r_s,              op_##OP##_s_r,              op_##OP##_s_s }
 
 
@@ -2207,17 +2551,17 @@ const M3OpInfo c_operations [] =
     M3OP( "i64.load32_s",       0,  i_64,   d_unaryOpList (i64, Load_i32),      Compile_Load_Store ),   // 0x34
     M3OP( "i64.load32_u",       0,  i_64,   d_unaryOpList (i64, Load_u32),      Compile_Load_Store ),   // 0x35
 
-    M3OP( "i32.store",          -2, none,   d_binOpList (i32, Store_i32),       Compile_Load_Store ),   // 0x36
-    M3OP( "i64.store",          -2, none,   d_binOpList (i64, Store_i64),       Compile_Load_Store ),   // 0x37
+    M3OP( "i32.store",          -2, none,   d_storeOpList (i32, Store_i32),     Compile_Load_Store ),   // 0x36
+    M3OP( "i64.store",          -2, none,   d_storeOpList (i64, Store_i64),     Compile_Load_Store ),   // 0x37
     M3OP_F( "f32.store",        -2, none,   d_storeFpOpList (f32, Store_f32),   Compile_Load_Store ),   // 0x38
     M3OP_F( "f64.store",        -2, none,   d_storeFpOpList (f64, Store_f64),   Compile_Load_Store ),   // 0x39
 
-    M3OP( "i32.store8",         -2, none,   d_binOpList (i32, Store_u8),        Compile_Load_Store ),   // 0x3a
-    M3OP( "i32.store16",        -2, none,   d_binOpList (i32, Store_i16),       Compile_Load_Store ),   // 0x3b
+    M3OP( "i32.store8",         -2, none,   d_storeOpList (i32, Store_u8),      Compile_Load_Store ),   // 0x3a
+    M3OP( "i32.store16",        -2, none,   d_storeOpList (i32, Store_i16),     Compile_Load_Store ),   // 0x3b
 
-    M3OP( "i64.store8",         -2, none,   d_binOpList (i64, Store_u8),        Compile_Load_Store ),   // 0x3c
-    M3OP( "i64.store16",        -2, none,   d_binOpList (i64, Store_i16),       Compile_Load_Store ),   // 0x3d
-    M3OP( "i64.store32",        -2, none,   d_binOpList (i64, Store_i32),       Compile_Load_Store ),   // 0x3e
+    M3OP( "i64.store8",         -2, none,   d_storeOpList (i64, Store_u8),      Compile_Load_Store ),   // 0x3c
+    M3OP( "i64.store16",        -2, none,   d_storeOpList (i64, Store_i16),     Compile_Load_Store ),   // 0x3d
+    M3OP( "i64.store32",        -2, none,   d_storeOpList (i64, Store_i32),     Compile_Load_Store ),   // 0x3e
 
     M3OP( "memory.size",        1,  i_32,   d_logOp (MemSize),                  Compile_Memory_Size ),  // 0x3f
     M3OP( "memory.grow",        1,  i_32,   d_logOp (MemGrow),                  Compile_Memory_Grow ),  // 0x40
@@ -2487,17 +2831,41 @@ _       (Read_opcode (& opcode, & o->wasm, o->wasmEnd));                log_opco
             }
         }
 
+        // the last operation of the previous opcode ends here. local.get and constants just push a slot
+        // (any emit clears lastOp): what was fusable before them still is for the opcode after
+        if (opcode == c_waOp_getLocal or (opcode >= c_waOp_i32_const and opcode <= c_waOp_f64_const))
+        {
+            o->fusable.op = NULL;
+        }
+        else
+        {
+            o->fusable = o->lastOp;
+            o->fusable.end = GetPC (o);
+            o->lastOp.op = NULL;
+        }
+
         IM3OpInfo opinfo = GetOpInfo (opcode);
 
         if (opinfo == NULL)
             _throw (ErrorCompile (m3Err_unknownOpcode, o, "opcode '%x' not available", opcode));
 
+#if d_m3HasSecondRegisters
+        bool keepsPreserved = KeepsPreservedRegisters (opcode);
+        if (not keepsPreserved)
+            ClearPreservedRegisters (o);
+#endif
+
         if (opinfo->compiler) {
 _           ((* opinfo->compiler) (o, opcode))
         } else {
 _           (Compile_Operator (o, opcode));
         }
 
+#if d_m3HasSecondRegisters
+        if (not keepsPreserved)
+            ClearPreservedRegisters (o);
+#endif
+
         o->previousOpcode = opcode;
 
         if (opcode == c_waOp_else)
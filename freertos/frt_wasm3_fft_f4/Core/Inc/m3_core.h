@@ -161,6 +161,8 @@ M3CodePageHeader;
 
 #define d_m3Reg0SlotAlias                   60000
 #define d_m3Fp0SlotAlias                    (d_m3Reg0SlotAlias + 2)
+#define d_m3Reg1SlotAlias                   (d_m3Reg0SlotAlias + 1)     // d_m3HasReg1
+#define d_m3Fp1SlotAlias                    (d_m3Fp0SlotAlias + 1)      // d_m3HasFp1
 
 #define d_m3MaxSaneTypesCount               100000
 #define d_m3MaxSaneFunctionsCount           100000
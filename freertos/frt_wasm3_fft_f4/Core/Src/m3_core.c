@@ -103,6 +103,72 @@ void *  m3_Realloc  (void * i_ptr, size_t i_newSize, size_t i_oldSize)
     return newPtr;
 }
 
+#elif d_m3HeapStats
+
+// Each block carries its size in a header, so that frees are accounted too
+#define M3_HEAP_HEADER      16
+
+static size_t heapLive = 0;
+static size_t heapPeak = 0;
+
+static void *  m3_HeapTrack  (u8 * i_block, size_t i_size)
+{
+    if (!i_block) return NULL;
+
+    * (size_t *) i_block = i_size;
+    heapLive += i_size;
+    if (heapLive > heapPeak) heapPeak = heapLive;
+
+    return i_block + M3_HEAP_HEADER;
+}
+
+void  m3_GetHeapStats  (size_t * o_live, size_t * o_peak)
+{
+    * o_live = heapLive;
+    * o_peak = heapPeak;
+}
+
+void  m3_ResetHeapPeak  (void)
+{
+    heapPeak = heapLive;
+}
+
+void *  m3_Malloc  (size_t i_size)
+{
+    return m3_HeapTrack ((u8 *) calloc (i_size + M3_HEAP_HEADER, 1), i_size);
+}
+
+void  m3_FreeImpl  (void * io_ptr)
+{
+    if (io_ptr)
+    {
+        u8 * block = (u8 *) io_ptr - M3_HEAP_HEADER;
+        heapLive -= * (size_t *) block;
+        free (block);
+    }
+}
+
+void *  m3_Realloc  (void * i_ptr, size_t i_newSize, size_t i_oldSize)
+{
+    if (UNLIKELY(i_newSize == i_oldSize)) return i_ptr;
+
+    u8 * block = i_ptr ? (u8 *) i_ptr - M3_HEAP_HEADER : NULL;
+    size_t blockSize = block ? * (size_t *) block : 0;
+
+    u8 * newBlock = (u8 *) realloc (block, i_newSize + M3_HEAP_HEADER);
+
+    if (LIKELY(newBlock))
+    {
+        heapLive -= blockSize;
+        u8 * newPtr = (u8 *) m3_HeapTrack (newBlock, i_newSize);
+        if (i_newSize > i_oldSize) {
+            memset (newPtr + i_oldSize, 0x0, i_newSize - i_oldSize);
+        }
+        return newPtr;
+    }
+    return NULL;
+}
+
 #else
 
 void *  m3_Malloc  (size_t i_size)
@@ -147,6 +213,18 @@ void *  m3_CopyMem  (const void * i_from, size_t i_size)
     return ptr;
 }
 
+#if d_m3FixedHeap || !d_m3HeapStats
+void  m3_GetHeapStats  (size_t * o_live, size_t * o_peak)
+{
+    * o_live = 0;
+    * o_peak = 0;
+}
+
+void  m3_ResetHeapPeak  (void)
+{
+}
+#endif
+
 //--------------------------------------------------------------------------------------------
 
 #if d_m3LogNativeStack
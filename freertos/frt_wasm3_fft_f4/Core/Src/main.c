@@ -39,6 +39,15 @@
 #endif
 
 #include "fft_bench.wasm.h"
+#include "fft_bench.h"        // varianti e taglie del modulo FFT
+#if __has_include("kernels_bench.wasm.h")
+#include "kernels_bench.wasm.h"   // generato da wasm/kernels/build.sh
+#define HAVE_KERNELS_SUITE 1
+#endif
+#include "kernels_bench.h"
+#include <stdio.h>
+#define BENCH_STATS_PRINTF printf   // report su UART (printf -> _write)
+#include "bench_stats.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -48,7 +57,10 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-#define NUM_ITER  100
+#define NUM_ITER  10       // FFT per round
+#define WARMUP_ROUNDS   2   // round scartati
+#define NUM_ROUNDS      20  // round misurati
+#define MAX_CV_PERMILLE 20  // oltre il 2% di CV la misura non vale
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -69,6 +81,9 @@ const osThreadAttr_t defaultTask_attributes = {
 /* USER CODE BEGIN PV */
 volatile uint32_t total_cycles_wasm = 0;
 volatile uint32_t avg_cycles_wasm   = 0;
+// Cicli di ogni round misurato e statistiche
+static uint64_t round_cycles[NUM_ROUNDS];
+static bench_stats_t stats;
 
 /* USER CODE END PV */
 
@@ -134,30 +149,37 @@ static void run_wasm_fft_benchmark(void) {
 	DWT_Init();
 	SysTick->CTRL = 0;    // disabilita SysTick (come nei test nativi)
 
-	// Inizializza il buffer dentro il modulo Wasm
-	r = m3_CallV(fn_init);
-	if (r) wasm_panic("m3_CallV(init_buffer)", r);
+	for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+		// Inizializza il buffer dentro il modulo Wasm (stesso input a ogni round)
+		r = m3_CallV(fn_init);
+		if (r) wasm_panic("m3_CallV(init_buffer)", r);
 
-	__disable_irq();
+		__disable_irq();
 
-	uint32_t start = DWT->CYCCNT;
+		uint32_t start = DWT->CYCCNT;
 
-	// bench(NUM_ITER) dentro Wasm
-	r = m3_CallV(fn_bench, (uint32_t)NUM_ITER);
-	if (r) {
-		__enable_irq();
-		wasm_panic("m3_CallV(bench)", r);
-	}
+		// bench(NUM_ITER) dentro Wasm
+		r = m3_CallV(fn_bench, (uint32_t)NUM_ITER);
+		if (r) {
+			__enable_irq();
+			wasm_panic("m3_CallV(bench)", r);
+		}
 
-	uint32_t end = DWT->CYCCNT;
+		uint32_t end = DWT->CYCCNT;
 
-	__enable_irq();
+		__enable_irq();
 
-	total_cycles_wasm = end - start;
-	avg_cycles_wasm   = total_cycles_wasm / NUM_ITER;
+		if (i >= WARMUP_ROUNDS) {
+			round_cycles[i - WARMUP_ROUNDS] = end - start;
+		}
+	}
+
+	bench_stats_compute(round_cycles, NUM_ROUNDS, &stats);
+	total_cycles_wasm = (uint32_t)stats.median;
+	avg_cycles_wasm   = (uint32_t)(stats.median / NUM_ITER);
 	printf("FreeRTOS + wasm3\r\n");
-	printf("Total cycles: %lu\r\n", (unsigned long)total_cycles_wasm);
-	printf("Avg cycles per FFT: %lu\r\n", (unsigned long)avg_cycles_wasm);
+	bench_stats_print("cycles per FFT", &stats, NUM_ITER);
+	bench_stats_check(&stats, MAX_CV_PERMILLE);
 
 
 	// cleanup opzionale (tanto poi non usciamo da main)
@@ -165,6 +187,105 @@ static void run_wasm_fft_benchmark(void) {
 	m3_FreeEnvironment(env);
 }
 
+//------------------------------
+// Suite di kernel (wasm/kernels)
+//------------------------------
+static uint64_t suite_cycles[NUM_ROUNDS];
+
+static IM3Function find_kernel_fn(IM3Runtime rt, const char *kernel, const char *suffix) {
+	char fname[32];
+	IM3Function fn = NULL;
+
+	snprintf(fname, sizeof(fname), "%s_%s", kernel, suffix);
+	M3Result r = m3_FindFunction(&fn, rt, fname);
+	if (r || !fn) wasm_panic(fname, r);
+	return fn;
+}
+
+// Un modulo di suite: stessi round della FFT; init una sola volta, così il
+// checksum finale coincide con quello nativo e di linux_bench a parità di round.
+// sizes: NULL se init non ha argomenti, altrimenti una riga "kernel@n" per
+// taglia, con init(n) che riparte dallo stesso input (varianti FFT).
+// stack: byte dello stack di wasm3.
+static void run_wasm_suite(const uint8_t *wasm, uint32_t wasm_len,
+		const char *const *names, int num, const uint32_t *sizes, int num_sizes,
+		uint32_t stack) {
+	M3Result r;
+	bench_stats_t st;
+
+	IM3Environment env = m3_NewEnvironment();
+	if (!env) wasm_panic("m3_NewEnvironment", "OOM");
+	IM3Runtime rt = m3_NewRuntime(env, stack, NULL);
+	if (!rt) wasm_panic("m3_NewRuntime", "OOM");
+
+	IM3Module mod = NULL;
+	r = m3_ParseModule(env, &mod,
+			wasm, wasm_len);
+	if (r) wasm_panic("m3_ParseModule(suite)", r);
+	r = m3_LoadModule(rt, mod);
+	if (r) wasm_panic("m3_LoadModule(suite)", r);
+
+	for (int k = 0; k < num; k++) {
+		IM3Function fn_init     = find_kernel_fn(rt, names[k], "init");
+		IM3Function fn_bench    = find_kernel_fn(rt, names[k], "bench");
+		IM3Function fn_checksum = find_kernel_fn(rt, names[k], "checksum");
+
+		for (int s = 0; s < (sizes ? num_sizes : 1); s++) {
+			char row[32];
+			uint32_t checksum = 0;
+
+			if (sizes) {
+				snprintf(row, sizeof(row), "%s@%lu", names[k], (unsigned long)sizes[s]);
+				r = m3_CallV(fn_init, sizes[s]);
+			} else {
+				snprintf(row, sizeof(row), "%s", names[k]);
+				r = m3_CallV(fn_init);
+			}
+			if (r) wasm_panic("m3_CallV(kernel init)", r);
+
+			for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+				__disable_irq();
+				uint32_t start = DWT->CYCCNT;
+				r = m3_CallV(fn_bench, (uint32_t)NUM_ITER);
+				uint32_t end = DWT->CYCCNT;
+				__enable_irq();
+				if (r) wasm_panic("m3_CallV(kernel bench)", r);
+
+				if (i >= WARMUP_ROUNDS) {
+					suite_cycles[i - WARMUP_ROUNDS] = end - start;
+				}
+			}
+
+			r = m3_CallV(fn_checksum);
+			if (!r) r = m3_GetResultsV(fn_checksum, &checksum);
+			if (r) wasm_panic("m3_CallV(kernel checksum)", r);
+
+			bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+			bench_stats_print_row(row, &st, NUM_ITER, checksum);
+		}
+	}
+
+	m3_FreeRuntime(rt);
+	m3_FreeEnvironment(env);
+}
+
+#ifdef HAVE_KERNELS_SUITE
+static void run_wasm_kernels_suite(void) {
+	static const char *const names[KERNELS_SUITE_LEN] = { KERNELS_SUITE_NAMES };
+	run_wasm_suite(kernels_bench_wasm, kernels_bench_wasm_len,
+			names, KERNELS_SUITE_LEN, NULL, 0, 1024);
+}
+#endif
+
+// Varianti del modulo FFT alle taglie MCU (fft_bench.h): righe "fft_r2@256"
+// ecc.; lo split-radix ricorsivo non sta nello stack da 1 KB di fft_bench.
+static void run_wasm_fft_variants(void) {
+	static const char *const names[FFT_VARIANT_LEN] = { FFT_VARIANT_NAMES };
+	static const uint32_t sizes[FFT_MCU_SIZES_LEN] = { FFT_MCU_SIZES };
+	run_wasm_suite(fft_bench_wasm, fft_bench_wasm_len,
+			names, FFT_VARIANT_LEN, sizes, FFT_MCU_SIZES_LEN, 4096);
+}
+
 int _write(int file, char *ptr, int len)
 {
 	HAL_UART_Transmit(&huart2, (uint8_t*)ptr, len, HAL_MAX_DELAY);
@@ -376,6 +497,12 @@ void StartDefaultTask(void *argument)
   /* USER CODE BEGIN 5 */
 
 	run_wasm_fft_benchmark();   // misura in wasm3
+	run_wasm_fft_variants();
+#ifdef HAVE_KERNELS_SUITE
+	run_wasm_kernels_suite();
+#else
+	printf("kernels suite: manca kernels_bench.wasm.h (wasm/kernels/build.sh)\r\n");
+#endif
 	/* Infinite loop */
 	for(;;)
 	{
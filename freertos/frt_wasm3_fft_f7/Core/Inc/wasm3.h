@@ -310,6 +310,17 @@ d_m3ErrorConst  (trapStackOverflow,             "[trap] stack overflow")
     void                m3_PrintM3Info              (void);
     void                m3_PrintProfilerInfo        (void);
 
+    // Op counts of a d_m3EnableOpProfiling build since the last m3_ResetProfilerInfo (): i_callback gets each operation
+    // with i_next NULL, then each pair of operations executed one after the other. Returns the hits left out because
+    // d_m3ProfilerSlotMask or d_m3ProfilerPairSlotMask is too small; without profiling there are no calls and it returns 0
+    typedef void     (* M3ProfilerCallback)     (void * i_userData, const char * i_op, const char * i_next, uint64_t i_count);
+    uint64_t            m3_ForEachProfilerCount     (M3ProfilerCallback i_callback, void * i_userData);
+    void                m3_ResetProfilerInfo        (void);
+
+    // Bytes allocated by wasm3 now and at peak since the last m3_ResetHeapPeak (); always 0 unless built with d_m3HeapStats
+    void                m3_GetHeapStats             (size_t * o_live, size_t * o_peak);
+    void                m3_ResetHeapPeak            (void);
+
     // The runtime owns the backtrace, do not free the backtrace you obtain. Returns NULL if there's no backtrace.
     IM3BacktraceInfo    m3_GetBacktrace             (IM3Runtime i_runtime);
 
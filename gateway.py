@@ -1,16 +1,24 @@
 #!/usr/bin/env python3
 import argparse
+import atexit
 import binascii
 import json
 import os
+import signal
 import socket
+import sys
 import threading
 import time
 import subprocess
 import tempfile
+from contextlib import contextmanager
 from pathlib import Path
 import binascii
 
+import aot_target
+import delta_patch
+import lz4_block
+
 try:
     import serial  # pyserial
 except ImportError:
@@ -26,14 +34,30 @@ DEVICE_ENDPOINTS = {
 }
 
 
+# Baudrate della UART verso l'agent (8N1: 10 bit per byte)
+UART_BAUDRATE = 115200
+
+# Simulatore software dell'agent (linux/linux_agent_sim)
+SIM_BIN_DEFAULT = str(Path(__file__).resolve().parent
+                      / "linux" / "linux_agent_sim" / "build" / "agent_sim")
+
+
 # Config compilatore 
 
 # clang o wasi-clang in PATH
 CLANG_BIN = "clang"   # o "wasi-clang"
 CLANG_TARGET = "wasm32-unknown-unknown"
 
-# wamrc di WAMR in PATH (per generare .aot)
+# wamrc di WAMR in PATH (per generare .aot); target, CPU e FPU vengono dal
+# HELLO del device (aot_target.py), ottimizzazione e bounds check da qui
 WAMRC_BIN = "wamrc"
+AOT_OPT_LEVEL = aot_target.OPT_LEVEL
+AOT_SIZE_LEVEL = aot_target.SIZE_LEVEL
+AOT_BOUNDS_CHECKS = aot_target.BOUNDS_CHECKS
+
+# llvm-profdata in PATH (mode aot_pgo: .profraw del device -> .profdata per
+# wamrc --use-prof-file), della stessa versione LLVM di wamrc
+LLVM_PROFDATA_BIN = "llvm-profdata"
 
 
 # Transport 
@@ -116,6 +140,52 @@ class Transport:
         print("<<", line)
         return line
 
+    def read_exact(self, n: int, timeout: float):
+        # Payload binario dopo una riga di intestazione (es. PGO_DATA size=N);
+        # read_line legge un byte alla volta, quindi non ne ha consumati
+        deadline = time.time() + timeout
+        buf = bytearray()
+        while len(buf) < n and time.time() < deadline:
+            try:
+                if self.ser is not None:
+                    chunk = self.ser.read(n - len(buf))
+                else:
+                    self.sock.settimeout(0.1)
+                    chunk = self.sock.recv(n - len(buf))
+                    if not chunk:
+                        return None
+            except socket.timeout:
+                continue
+            buf += chunk
+        return bytes(buf) if len(buf) == n else None
+
+
+# Un solo host alla volta per device: il protocollo verso l'agent è a righe
+# senza id di richiesta, quindi due sessioni concorrenti sullo stesso link
+# si mescolerebbero le risposte (e sulla seriale la open fallirebbe).
+
+_device_locks = {}
+_device_locks_guard = threading.Lock()
+
+
+def device_lock(device_port: str) -> threading.Lock:
+    with _device_locks_guard:
+        lock = _device_locks.get(device_port)
+        if lock is None:
+            lock = threading.Lock()
+            _device_locks[device_port] = lock
+        return lock
+
+
+@contextmanager
+def device_session(device_port: str):
+    with device_lock(device_port):
+        t = open_transport(device_port)
+        try:
+            yield t
+        finally:
+            t.close()
+
 
 def recv_exact(conn, n: int) -> bytes:
     buf = bytearray()
@@ -126,42 +196,135 @@ def recv_exact(conn, n: int) -> bytes:
         buf += chunk
     return bytes(buf)
 
+LOAD_ENCODINGS = ("raw", "lz4")
+
+# Errori del LOAD delta=1 dopo cui ha senso ripetere subito un LOAD completo
+DELTA_RETRY_CODES = ("BASE_MISMATCH", "NO_BASE", "BAD_DELTA", "BAD_CRC")
+
+# Ultima immagine caricata con successo per (device, module_id), con il suo
+# CRC32 (base_crc, evita di ricalcolarlo a ogni LOAD): è la base dei
+# LOAD delta=1 successivi. Solo immagini AOT: l'interprete WAMR riscrive il
+# bytecode .wasm nel buffer al load, quindi sul device la base non resta
+# integra (il firmware risponderebbe sempre BASE_MISMATCH).
+AOT_MAGIC = b"\0aot"
+_image_cache = {}
+
+
+def _load_attempt(t: Transport, line: str, data: bytes, wire: bytes,
+                  tag: str | None):
+    """LOAD su una sessione già aperta. Se il firmware non riconosce il
+    parametro tag (es. enc=lz4, delta=1) lo ignora e si aspetta size byte
+    raw: in quel caso si manda data invece di wire."""
+    print(">>", line)
+    t.write_line(line)
+
+    resp = read_until_prefix(t, ["LOAD_READY", "LOAD_ERR"], timeout=3.0)
+    if resp is None:
+        return {"ok": False, "error": "timeout in attesa di LOAD_READY/LOAD_ERR"}
+    if resp.startswith("LOAD_ERR"):
+        return {"ok": False, "error": resp}
+
+    if tag is not None and tag not in resp.split():
+        tag, wire = None, data
+
+    print(f">> [BINARY] {len(wire)} bytes ({tag or 'raw'}, size={len(data)})")
+    t.write(wire)
+
+    # Su TCP (Renode, agent_sim) write() ritorna prima che il payload sia
+    # arrivato al device: il timeout include il tempo di linea del blob
+    load_timeout = 3.0 + len(wire) * 10 / UART_BAUDRATE
+    resp2 = read_until_prefix(t, ["LOAD_OK", "LOAD_ERR"], timeout=load_timeout)
+    if resp2 is None:
+        return {"ok": False, "error": "timeout in attesa di LOAD_OK/LOAD_ERR"}
+    if resp2.startswith("LOAD_ERR"):
+        return {"ok": False, "error": resp2, "encoded": tag is not None}
+    return {"ok": True, "detail": resp2, "wire_bytes": len(wire),
+            "encoded": tag is not None}
+
+
 def gw_load_bytes(device_port: str, module_id: str, data: bytes,
-                    replace: bool = False, replace_victim: str | None = None):
+                    replace: bool = False, replace_victim: str | None = None,
+                    enc: str = "raw", delta: bool = True,
+                    crc32: int | None = None):
+    # crc32: già calcolato dal chiamante (es. verifica del blob dell'host)
     size = len(data)
-    crc32 = binascii.crc32(data) & 0xFFFFFFFF
+    if crc32 is None:
+        crc32 = binascii.crc32(data) & 0xFFFFFFFF
     crc_hex = f"{crc32:08x}"
 
-    t = open_transport(device_port)
-    try:
-        t.flush_input()
+    if enc not in LOAD_ENCODINGS:
+        return {"ok": False, "error": f"enc non supportato: {enc}"}
 
-        line = f"LOAD module_id={module_id} size={size} crc32={crc_hex}"
-        if replace or replace_victim:
-            line += " replace=1"
-        if replace_victim:
-            line += f" replace_victim={replace_victim}"
+    # enc=lz4: size/crc32 restano quelli dell'immagine decompressa; se la
+    # compressione non fa guadagnare nulla si manda raw
+    wire = data
+    if enc == "lz4":
+        packed = lz4_block.compress(data)
+        if len(packed) < size:
+            wire = packed
+        else:
+            enc = "raw"
 
-        print(">>", line)
-        t.write_line(line)
+    head = f"LOAD module_id={module_id} size={size} crc32={crc_hex}"
+    if replace or replace_victim:
+        head += " replace=1"
+    if replace_victim:
+        head += f" replace_victim={replace_victim}"
 
-        resp = read_until_prefix(t, ["LOAD_READY", "LOAD_ERR"], timeout=3.0)
-        if resp is None:
-            return {"ok": False, "error": "timeout in attesa di LOAD_READY/LOAD_ERR"}
-        if resp.startswith("LOAD_ERR"):
-            return {"ok": False, "error": resp}
+    key = (device_port, module_id)
+    with device_session(device_port) as t:
+        t.flush_input()
 
-        print(f">> [BINARY] {size} bytes")
-        t.write(data)
+        res = None
+        used_delta = False
+        cached = _image_cache.get(key) if delta else None
+        if cached is not None:
+            base, base_crc = cached
+            # delta=1: patch rispetto all'immagine già nello slot, conviene
+            # solo se più piccola di quello che si manderebbe comunque
+            patch = delta_patch.encode(base, data)
+            if len(patch) < len(wire):
+                line = head + f" delta=1 base_crc={base_crc:08x} psize={len(patch)}"
+                res = _load_attempt(t, line, data, patch, "delta=1")
+                used_delta = res.get("encoded", False)
+                if not res["ok"] and any(f"code={c}" in res["error"]
+                                         for c in DELTA_RETRY_CODES):
+                    print(f"[gateway] delta rifiutato ({res['error']}), LOAD completo")
+                    _image_cache.pop(key, None)
+                    t.flush_input()
+                    res = None
+                    used_delta = False
+                else:
+                    # delta=1 viaggia sempre raw (anche se ignorato dal firmware)
+                    enc = "raw"
+
+        if res is None:
+            line = head
+            if enc != "raw":
+                line += f" enc={enc} csize={len(wire)}"
+            res = _load_attempt(t, line, data, wire,
+                                f"enc={enc}" if enc != "raw" else None)
+            if enc != "raw" and not res.get("encoded", False):
+                enc = "raw"
+
+        if not res["ok"]:
+            # lo slot sul device è stato ripulito (o è in stato incerto)
+            _image_cache.pop(key, None)
+            res.pop("encoded", None)
+            return res
+
+        if data.startswith(AOT_MAGIC):
+            _image_cache[key] = (data, crc32)
+        else:
+            _image_cache.pop(key, None)
+        if replace_victim and "warn=VICTIM_IGNORED" not in res["detail"]:
+            # lo slot del victim ora contiene module_id
+            _image_cache.pop((device_port, replace_victim), None)
 
-        resp2 = read_until_prefix(t, ["LOAD_OK", "LOAD_ERR"], timeout=3.0)
-        if resp2 is None:
-            return {"ok": False, "error": "timeout in attesa di LOAD_OK/LOAD_ERR"}
-        if resp2.startswith("LOAD_ERR"):
-            return {"ok": False, "error": resp2}
-        return {"ok": True, "detail": resp2}
-    finally:
-        t.close()
+    res.pop("encoded", None)
+    res.update({"enc": enc, "delta": used_delta,
+                "size": size})
+    return res
 
 
 def open_transport(port: str) -> Transport:
@@ -179,7 +342,7 @@ def open_transport(port: str) -> Transport:
     else:
         if serial is None:
             raise RuntimeError("pyserial not installed")
-        ser = serial.Serial(port, baudrate=115200, timeout=0.1)
+        ser = serial.Serial(port, baudrate=UART_BAUDRATE, timeout=0.1)
         return Transport(ser=ser)
 
 
@@ -224,13 +387,17 @@ def compile_to_wasm(source_c: str, out_wasm: str):
     return {"ok": True, "wasm_path": out_wasm}
 
 
-# Compila un modulo .wasm in .aot
+# Compila un modulo .wasm in .aot per il device descritto da info (campi
+# del HELLO); info vuoto = flag generici thumbv7em di prima. extra_args:
+# --enable-llvm-pgo / --use-prof-file=... per mode aot_pgo
 
-def compile_to_aot(wasm_path: str, out_aot: str):
+def compile_to_aot(wasm_path: str, out_aot: str, info: dict | None = None,
+                   extra_args: list[str] | None = None):
     cmd = [
         WAMRC_BIN,
-        "--target=thumbv7em",
-        "--target-abi=eabi",
+        *aot_target.wamrc_args(info or {}, AOT_OPT_LEVEL, AOT_SIZE_LEVEL,
+                               AOT_BOUNDS_CHECKS),
+        *(extra_args or []),
         "-o", out_aot,
         wasm_path,
     ]
@@ -249,7 +416,8 @@ def compile_to_aot(wasm_path: str, out_aot: str):
 # Operazioni verso l'agent 
 
 def gw_load(device_port: str, module_id: str, wasm_or_aot_path: str,
-              replace: bool = False, replace_victim: str | None = None):
+              replace: bool = False, replace_victim: str | None = None,
+              enc: str = "raw", delta: bool = True):
     if not os.path.isfile(wasm_or_aot_path):
         return {"ok": False, "error": f"file non trovato: {wasm_or_aot_path}"}
 
@@ -257,13 +425,13 @@ def gw_load(device_port: str, module_id: str, wasm_or_aot_path: str,
         data = f.read()
 
     return gw_load_bytes(device_port, module_id, data,
-                           replace=replace, replace_victim=replace_victim)
+                           replace=replace, replace_victim=replace_victim,
+                           enc=enc, delta=delta)
 
 
 def gw_start(device_port: str, module_id: str, func_name: str,
              func_args: str, wait_result: bool, result_timeout: float):
-    t = open_transport(device_port)
-    try:
+    with device_session(device_port) as t:
         t.flush_input()
         line = f"START module_id={module_id}"
 
@@ -310,13 +478,9 @@ def gw_start(device_port: str, module_id: str, func_name: str,
         else:
             return {"ok": False, "error": resp2}
 
-    finally:
-        t.close()
-
 
 def gw_stop(device_port: str, module_id: str, result_timeout: float):
-    t = open_transport(device_port)
-    try:
+    with device_session(device_port) as t:
         t.flush_input()
         line = f"STOP module_id={module_id}"
         print(">>", line)
@@ -338,13 +502,61 @@ def gw_stop(device_port: str, module_id: str, result_timeout: float):
         if resp2 is None:
             return {"ok": False, "error": "timeout in attesa di RESULT (stop)"}
         return {"ok": True, "detail": resp2}
-    finally:
-        t.close()
+
+
+# Banner HELLO del device (ripetuto su INFO), per porta: cambia solo se
+# cambia il firmware, quindi basta chiederlo una volta
+_device_info = {}
+
+
+def gw_info(device_port: str, refresh: bool = False):
+    if not refresh and device_port in _device_info:
+        return {"ok": True, "info": _device_info[device_port], "cached": True}
+    with device_session(device_port) as t:
+        t.flush_input()
+        print(">> INFO")
+        t.write_line("INFO")
+
+        resp = read_until_prefix(t, ["HELLO", "ERROR"], timeout=2.0)
+        if resp is None:
+            return {"ok": False, "error": "timeout in attesa di HELLO"}
+        if resp.startswith("ERROR"):
+            # firmware senza INFO (ERROR code=UNKNOWN_COMMAND)
+            return {"ok": False, "error": resp}
+        info = aot_target.parse_hello(resp)
+        _device_info[device_port] = info
+        return {"ok": True, "info": info, "detail": resp}
+
+
+def gw_pgo_dump(device_port: str, module_id: str):
+    # profilo LLVM grezzo (.profraw) di un modulo AOT strumentato; il
+    # payload arriva dopo la riga PGO_DATA, seguito da un \n
+    with device_session(device_port) as t:
+        t.flush_input()
+        line = f"PGO_DUMP module_id={module_id}"
+        print(">>", line)
+        t.write_line(line)
+
+        resp = read_until_prefix(t, ["PGO_DATA", "PGO_ERR", "ERROR"], timeout=3.0)
+        if resp is None:
+            return {"ok": False, "error": "timeout in attesa di PGO_DATA/PGO_ERR"}
+        if not resp.startswith("PGO_DATA"):
+            # ERROR code=UNKNOWN_COMMAND: firmware senza PGO_DUMP
+            return {"ok": False, "error": resp}
+
+        fields = aot_target.parse_hello(resp)
+        size = int(fields["size"])
+        data = t.read_exact(size, timeout=3.0 + size * 10 / UART_BAUDRATE)
+        if data is None:
+            return {"ok": False, "error": f"profilo incompleto (attesi {size} byte)"}
+        got = binascii.crc32(data) & 0xFFFFFFFF
+        if got != int(fields["crc32"], 16):
+            return {"ok": False, "error": f"CRC mismatch expected={fields['crc32']} got={got:08x}"}
+        return {"ok": True, "detail": resp, "profile": data}
 
 
 def gw_status(device_port: str):
-    t = open_transport(device_port)
-    try:
+    with device_session(device_port) as t:
         t.flush_input()
         line = "STATUS"
         print(">>", line)
@@ -354,17 +566,59 @@ def gw_status(device_port: str):
         if resp is None:
             return {"ok": False, "error": "timeout in attesa di STATUS"}
         return {"ok": True, "detail": resp}
-    finally:
-        t.close()
+
+
+# Profilo per mode aot_pgo: carica l'AOT strumentato (wamrc
+# --enable-llvm-pgo), lo fa girare con il workload dell'host (runs START
+# con attesa del RESULT), legge i contatori con PGO_DUMP e li converte con
+# llvm-profdata merge. Il workload deve terminare: i contatori si leggono
+# solo a modulo fermo (PGO_ERR code=BUSY).
+
+def pgo_profile(device_port: str, module_id: str, wasm_path: str, tmpdir_p: Path,
+                info: dict, pgo: dict, load_kw: dict):
+    inst_path = str(tmpdir_p / f"{module_id}.pgo.aot")
+    res = compile_to_aot(wasm_path, inst_path, info, ["--enable-llvm-pgo"])
+    if not res.get("ok"):
+        return {"ok": False, "step": "compile_aot_pgo", **res}
+
+    res = gw_load(device_port, module_id, inst_path, **load_kw)
+    if not res.get("ok"):
+        return {"ok": False, "step": "load_pgo", **res}
+
+    runs = max(1, int(pgo.get("runs", 1)))
+    for _ in range(runs):
+        last = gw_start(device_port, module_id, pgo.get("func", ""), pgo.get("args", ""),
+                        True, float(pgo.get("result_timeout", 10.0)))
+        if not last.get("ok"):
+            return {"ok": False, "step": "pgo_run", **last}
+
+    dump = gw_pgo_dump(device_port, module_id)
+    if not dump["ok"]:
+        return {"ok": False, "step": "pgo_dump", **dump}
+
+    raw_path = tmpdir_p / f"{module_id}.profraw"
+    raw_path.write_bytes(dump["profile"])
+    prof_path = str(tmpdir_p / f"{module_id}.profdata")
+    cmd = [LLVM_PROFDATA_BIN, "merge", f"-output={prof_path}", str(raw_path)]
+    print("Profilo PGO:", " ".join(cmd))
+    res = subprocess.run(cmd, capture_output=True, text=True)
+    if res.returncode != 0:
+        return {"ok": False, "step": "pgo_merge", "error": "errore llvm-profdata merge",
+                "stderr": res.stderr, "stdout": res.stdout}
+    return {"ok": True, "profdata": prof_path, "pgo_runs": runs,
+            "profile_size": len(dump["profile"]), "pgo_result": last.get("detail")}
 
 
 # build_and_load 
-# Modalità: wasm oppure aot
-#   wasm: compila C -> wasm e carica il wasm
-#   aot:  compila C -> wasm, poi wasm -> aot, carica l'aot
+# Modalità: wasm, aot oppure aot_pgo
+#   wasm:    compila C -> wasm e carica il wasm
+#   aot:     compila C -> wasm, poi wasm -> aot, carica l'aot
+#   aot_pgo: come aot, ma prima un giro con l'AOT strumentato sul device
+#            (pgo_profile) e poi wasm -> aot con --use-prof-file
 
 def gw_build_and_load(device_port: str, module_id: str,
-                        source_path: str, mode: str, replace=False, replace_victim=None):
+                        source_path: str, mode: str, replace=False, replace_victim=None,
+                        enc: str = "raw", delta: bool = True, pgo: dict | None = None):
    
     source_path = os.path.abspath(source_path)
     if not os.path.isfile(source_path):
@@ -380,16 +634,41 @@ def gw_build_and_load(device_port: str, module_id: str,
         deploy_path = wasm_path
         extra = {"wasm_path": wasm_path}
 
-        if mode == "aot":
+        if mode in ("aot", "aot_pgo"):
+            res_info = gw_info(device_port)
+            info = res_info.get("info", {})
+            if not res_info["ok"]:
+                print(f"[gateway] INFO non disponibile ({res_info['error']}), AOT generico")
+            elif info.get("aot") == "0":
+                return {"ok": False, "step": "compile_aot",
+                        "error": "il firmware non carica moduli AOT (aot=0)"}
+            wamrc_extra = []
+            if mode == "aot_pgo":
+                if info.get("pgo") != "1":
+                    return {"ok": False, "step": "compile_aot_pgo",
+                            "error": "il firmware non ha PGO_DUMP (WAMR_BUILD_STATIC_PGO=0)"}
+                res_pgo = pgo_profile(device_port, module_id, wasm_path, tmpdir_p, info,
+                                      pgo or {}, {"replace": replace,
+                                                  "replace_victim": replace_victim,
+                                                  "enc": enc, "delta": delta})
+                if not res_pgo["ok"]:
+                    return res_pgo
+                wamrc_extra = [f"--use-prof-file={res_pgo['profdata']}"]
+                extra.update({k: res_pgo[k] for k in ("pgo_runs", "profile_size", "pgo_result")})
+                # il modulo strumentato ora occupa lo slot: si sostituisce lì
+                replace, replace_victim = True, None
             aot_path = str(tmpdir_p / f"{module_id}.aot")
-            res_aot = compile_to_aot(wasm_path, aot_path)
+            res_aot = compile_to_aot(wasm_path, aot_path, info, wamrc_extra)
             if not res_aot.get("ok"):
                 return {"ok": False, "step": "compile_aot", **res_aot}
             deploy_path = aot_path
             extra["aot_path"] = aot_path
+            extra["wamrc_args"] = aot_target.wamrc_args(
+                info, AOT_OPT_LEVEL, AOT_SIZE_LEVEL, AOT_BOUNDS_CHECKS) + wamrc_extra
 
         res_dep = gw_load(device_port, module_id, deploy_path,
-                    replace=replace, replace_victim=replace_victim)
+                    replace=replace, replace_victim=replace_victim, enc=enc,
+                    delta=delta)
 
         return {"step": "load", **extra, **res_dep}
 
@@ -414,8 +693,12 @@ def handle_client(conn, addr):
         req = json.loads(header.decode("utf-8").strip())
 
         device = req.get("device")
-        port = DEVICE_ENDPOINTS[device]
+        port = DEVICE_ENDPOINTS.get(device)
         cmd = req.get("cmd")
+        if port is None:
+            resp = {"ok": False, "error": f"device sconosciuto: {device}"}
+            conn.sendall((json.dumps(resp) + "\n").encode("utf-8"))
+            return
 
         if cmd == "load":
             blob_size = int(req["blob_size"])
@@ -426,7 +709,8 @@ def handle_client(conn, addr):
                 blob = blob[:blob_size]
 
             expected = str(req["blob_crc32"]).lower()
-            got = f"{(binascii.crc32(blob) & 0xFFFFFFFF):08x}"
+            blob_crc = binascii.crc32(blob) & 0xFFFFFFFF
+            got = f"{blob_crc:08x}"
             if got != expected:
                 resp = {"ok": False, "error": f"CRC mismatch expected={expected} got={got}"}
                 conn.sendall((json.dumps(resp) + "\n").encode("utf-8"))
@@ -436,7 +720,10 @@ def handle_client(conn, addr):
             replace_victim = req.get("replace_victim")
 
             resp = gw_load_bytes(port, req["module_id"], blob,
-                                replace=replace, replace_victim=replace_victim)
+                                replace=replace, replace_victim=replace_victim,
+                                enc=req.get("enc", "raw"),
+                                delta=bool(req.get("delta", True)),
+                                crc32=blob_crc)
 
 
         elif cmd == "start":
@@ -456,6 +743,8 @@ def handle_client(conn, addr):
             )
         elif cmd == "status":
             resp = gw_status(port)
+        elif cmd == "info":
+            resp = gw_info(port, refresh=bool(req.get("refresh", False)))
         elif cmd == "build_and_load":
             mode = req.get("mode", "wasm")
 
@@ -485,13 +774,27 @@ def handle_client(conn, addr):
                     port,
                     req["module_id"],
                     source_path,
-                    mode, replace=replace, replace_victim=replace_victim
+                    mode, replace=replace, replace_victim=replace_victim,
+                    enc=req.get("enc", "raw"),
+                    delta=bool(req.get("delta", True)),
+                    pgo={"func": req.get("pgo_func", ""),
+                         "args": req.get("pgo_args", ""),
+                         "runs": int(req.get("pgo_runs", 1)),
+                         "result_timeout": float(req.get("result_timeout", 10.0))},
                 )
 
         else:
             resp = {"ok": False, "error": f"comando sconosciuto: {cmd}"}
 
         conn.sendall((json.dumps(resp) + "\n").encode("utf-8"))
+    except (OSError, RuntimeError) as e:
+        # endpoint non raggiungibile (seriale occupata, simulatore giù, ...):
+        # rispondi comunque all'host invece di chiudere la connessione a vuoto
+        try:
+            resp = {"ok": False, "error": f"errore I/O verso il device: {e}"}
+            conn.sendall((json.dumps(resp) + "\n").encode("utf-8"))
+        except OSError:
+            pass
     finally:
         conn.close()
 
@@ -500,7 +803,7 @@ def run_gateway(listen_host: str, listen_port: int):
     with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as s:
         s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)  # Imposta l’opzione SO_REUSEADDR: permette di riusare rapidamente la stessa porta dopo un riavvio del processo, senza aspettare che il kernel liberi lo stato precedente
         s.bind((listen_host, listen_port))
-        s.listen(5)   # Manda la socket in stato “listening” e imposta la dimensione della coda pendente (qui 5 connessioni in attesa massimo)
+        s.listen(128)   # Manda la socket in stato “listening” e imposta la dimensione della coda pendente (abbastanza ampia per bench_orchestrator)
         print(f"Gateway listening on {listen_host}:{listen_port}")
         while True:
             conn, addr = s.accept()
@@ -509,13 +812,91 @@ def run_gateway(listen_host: str, listen_port: int):
             t.start()
 
 
+# Device simulati
+
+def spawn_simulators(count: int, sim_bin: str, sim_args: list[str]) -> list[str]:
+    """
+    Avvia count istanze di agent_sim su porte effimere e le registra come
+    sim0..sim<count-1>. Ogni simulatore scrive "SIM_READY port=<n>" sulla
+    pipe passata con --ready-fd appena è in ascolto.
+    """
+    if not os.path.isfile(sim_bin):
+        raise RuntimeError(f"agent_sim non trovato: {sim_bin} (compila linux/linux_agent_sim)")
+
+    procs = []
+    atexit.register(lambda: [p.terminate() for p in procs if p.poll() is None])
+
+    pending = []
+    for i in range(count):
+        r, w = os.pipe()
+        cmd = [sim_bin, "--port", "0", "--ready-fd", str(w)] + sim_args
+        p = subprocess.Popen(cmd, pass_fds=(w,), stdout=subprocess.DEVNULL)
+        os.close(w)
+        procs.append(p)
+        pending.append((f"sim{i}", r))
+
+    names = []
+    for name, r in pending:
+        with os.fdopen(r, "r") as f:
+            line = f.readline().strip()
+        if not line.startswith("SIM_READY port="):
+            raise RuntimeError(f"{name}: avvio agent_sim fallito")
+        DEVICE_ENDPOINTS[name] = f"tcp:127.0.0.1:{line.split('=', 1)[1]}"
+        names.append(name)
+    return names
+
+
 def main():
     parser = argparse.ArgumentParser(
         description="Gateway per orchestrazione moduli Wasm/AOT su device STM32/Zephyr"
     )
     parser.add_argument("--host", default="0.0.0.0", help="Host di ascolto")
     parser.add_argument("--port", type=int, default=9000, help="Porta di ascolto")
+    parser.add_argument(
+        "--device-endpoint",
+        action="append",
+        default=[],
+        metavar="NOME=ENDPOINT",
+        help="Aggiunge/sovrascrive un device (es. sim0=tcp:localhost:5000), ripetibile",
+    )
+    parser.add_argument(
+        "--spawn-sim",
+        type=int,
+        default=0,
+        metavar="N",
+        help="Avvia N simulatori agent_sim e li registra come sim0..simN-1",
+    )
+    parser.add_argument("--sim-bin", default=SIM_BIN_DEFAULT, help="Eseguibile agent_sim")
+    parser.add_argument("--aot-opt-level", type=int, default=aot_target.OPT_LEVEL,
+                        help="wamrc --opt-level per build_and_load aot (default %(default)s)")
+    parser.add_argument("--aot-size-level", type=int, default=aot_target.SIZE_LEVEL,
+                        help="wamrc --size-level (default %(default)s)")
+    parser.add_argument("--aot-no-bounds-checks", action="store_true",
+                        help="wamrc --bounds-checks=0: solo per moduli fidati")
+    parser.add_argument("--llvm-profdata", default="llvm-profdata",
+                        help="llvm-profdata della stessa versione LLVM di wamrc (mode aot_pgo)")
+    parser.add_argument(
+        "--sim-arg",
+        action="append",
+        default=[],
+        help="Argomento extra per ogni agent_sim (es. --sim-arg=--baud=115200), ripetibile",
+    )
     args = parser.parse_args()
+    global AOT_OPT_LEVEL, AOT_SIZE_LEVEL, AOT_BOUNDS_CHECKS, LLVM_PROFDATA_BIN
+    LLVM_PROFDATA_BIN = args.llvm_profdata
+    AOT_OPT_LEVEL = args.aot_opt_level
+    AOT_SIZE_LEVEL = args.aot_size_level
+    AOT_BOUNDS_CHECKS = not args.aot_no_bounds_checks
+    for spec in args.device_endpoint:
+        name, sep, endpoint = spec.partition("=")
+        if not sep or not name or not endpoint:
+            parser.error(f"--device-endpoint non valido: {spec}")
+        DEVICE_ENDPOINTS[name] = endpoint
+    if args.spawn_sim > 0:
+        # SIGTERM -> SystemExit, così atexit chiude anche i simulatori
+        signal.signal(signal.SIGTERM, lambda *_: sys.exit(0))
+        names = spawn_simulators(args.spawn_sim, args.sim_bin, args.sim_arg)
+        print(f"Simulatori avviati: {names[0]}..{names[-1]}")
     run_gateway(args.host, args.port)
 
 
@@ -73,6 +73,10 @@ def cmd_load(args):
         payload["replace"] = True
         if args.replace_victim:
             payload["replace_victim"] = args.replace_victim
+    if args.enc != "raw":
+        payload["enc"] = args.enc
+    if args.no_delta:
+        payload["delta"] = False
 
     t0 = time.perf_counter()
     resp = send_request(args.gw_host, args.gw_port, payload, blob=blob, timeout=20.0)
@@ -135,6 +139,16 @@ def cmd_status(args):
     pretty_print_response(resp)
 
 
+def cmd_info(args):
+    payload = {
+        "cmd": "info",
+        "device": args.device,
+        "refresh": args.refresh,
+    }
+    resp = send_request(args.gw_host, args.gw_port, payload)
+    pretty_print_response(resp)
+
+
 def cmd_build_and_load(args):
     with open(args.source, "rb") as f:
         blob = f.read()
@@ -154,9 +168,19 @@ def cmd_build_and_load(args):
         payload["replace"] = True
         if args.replace_victim:
             payload["replace_victim"] = args.replace_victim
+    if args.enc != "raw":
+        payload["enc"] = args.enc
+    if args.no_delta:
+        payload["delta"] = False
+    timeout = 60.0
+    if args.mode == "aot_pgo":
+        # workload di profilo sul device prima della build finale
+        payload.update({"pgo_func": args.pgo_func or "", "pgo_args": args.pgo_args or "",
+                        "pgo_runs": args.pgo_runs, "result_timeout": args.result_timeout})
+        timeout += args.pgo_runs * args.result_timeout
 
     t0 = time.perf_counter()
-    resp = send_request(args.gw_host, args.gw_port, payload, blob=blob, timeout=60.0)
+    resp = send_request(args.gw_host, args.gw_port, payload, blob=blob, timeout=timeout)
     t1 = time.perf_counter()
     print(f"e2e_latency_ms={(t1 - t0) * 1000.0:.2f}")
     pretty_print_response(resp)
@@ -196,6 +220,17 @@ def main():
         "--replace-victim",
         help="Module ID da abortire e rimpiazzare quando gli slot sono pieni",
     )
+    p_deploy.add_argument(
+        "--enc",
+        choices=["raw", "lz4"],
+        default="raw",
+        help="Codifica del trasferimento gateway -> device (lz4: decompresso in streaming sul device)",
+    )
+    p_deploy.add_argument(
+        "--no-delta",
+        action="store_true",
+        help="Non usare LOAD delta=1 anche se il gateway ha l'immagine precedente del modulo",
+    )
     p_deploy.set_defaults(func=cmd_load)
 
     # start
@@ -231,6 +266,12 @@ def main():
     p_status = subparsers.add_parser("status", help="Stato del device")
     p_status.set_defaults(func=cmd_status)
 
+    # info
+    p_info = subparsers.add_parser("info", help="Banner HELLO del device (cpu/fpu per gli AOT)")
+    p_info.add_argument("--refresh", action="store_true",
+                        help="Richiedi INFO al device anche se il gateway lo ha già")
+    p_info.set_defaults(func=cmd_info)
+
     # build-and-deploy
     p_build = subparsers.add_parser(
         "build_and_load",
@@ -244,12 +285,21 @@ def main():
     )
     p_build.add_argument(
         "--mode",
-        choices=["wasm", "aot"],
+        choices=["wasm", "aot", "aot_pgo"],
         default="wasm",
-        help="Tipo di binario da generare (default: wasm)",
+        help="Tipo di binario da generare (default: wasm); aot_pgo: AOT "
+             "ottimizzato con il profilo di un giro sul device",
     )
+    p_build.add_argument("--pgo-func", help="aot_pgo: funzione del workload (default: entrypoint)")
+    p_build.add_argument("--pgo-args", help='aot_pgo: argomenti "a=1,b=2" del workload')
+    p_build.add_argument("--pgo-runs", type=int, default=1,
+                         help="aot_pgo: START del workload prima di PGO_DUMP (default 1)")
+    p_build.add_argument("--result-timeout", type=float, default=10.0,
+                         help="aot_pgo: timeout del RESULT di ogni START")
     p_build.add_argument("--replace", action="store_true")
     p_build.add_argument("--replace-victim")
+    p_build.add_argument("--enc", choices=["raw", "lz4"], default="raw")
+    p_build.add_argument("--no-delta", action="store_true")
     p_build.set_defaults(func=cmd_build_and_load)
 
     args = parser.parse_args()
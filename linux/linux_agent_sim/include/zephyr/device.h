@@ -0,0 +1,36 @@
+/* Shim <zephyr/device.h>: un solo device UART e un solo controller GPIO. */
+#ifndef SIM_ZEPHYR_DEVICE_H
+#define SIM_ZEPHYR_DEVICE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct device {
+    const char *name;
+};
+
+extern const struct device sim_uart_device;
+extern const struct device sim_gpio_device;
+
+/* devicetree ridotto ai nodi usati dall'agent */
+#define DT_CHOSEN(prop) SIM_DT_CHOSEN_##prop
+#define DT_ALIAS(alias) SIM_DT_ALIAS_##alias
+#define SIM_DT_CHOSEN_zephyr_shell_uart (&sim_uart_device)
+#define SIM_DT_CHOSEN_zephyr_console    (&sim_uart_device)
+#define SIM_DT_ALIAS_led0               (&sim_gpio_device)
+
+#define DEVICE_DT_GET(node_id) (node_id)
+
+static inline bool device_is_ready(const struct device *dev)
+{
+    return dev != NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_ZEPHYR_DEVICE_H */
@@ -0,0 +1,37 @@
+/* Shim <zephyr/drivers/gpio.h>: il LED è solo uno stato in memoria. */
+#ifndef SIM_ZEPHYR_DRIVERS_GPIO_H
+#define SIM_ZEPHYR_DRIVERS_GPIO_H
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint8_t gpio_pin_t;
+typedef uint32_t gpio_flags_t;
+
+#define GPIO_OUTPUT          (1u << 17)
+#define GPIO_OUTPUT_INIT_LOW (1u << 18)
+#define GPIO_OUTPUT_INACTIVE (GPIO_OUTPUT | GPIO_OUTPUT_INIT_LOW)
+#define GPIO_OUTPUT_ACTIVE   GPIO_OUTPUT
+
+struct gpio_dt_spec {
+    const struct device *port;
+    gpio_pin_t pin;
+    gpio_flags_t dt_flags;
+};
+
+/* LD2 delle Nucleo: PA5 */
+#define GPIO_DT_SPEC_GET(node_id, prop) { .port = (node_id), .pin = 5, .dt_flags = 0 }
+
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, gpio_flags_t extra_flags);
+int gpio_pin_toggle(const struct device *port, gpio_pin_t pin);
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_ZEPHYR_DRIVERS_GPIO_H */
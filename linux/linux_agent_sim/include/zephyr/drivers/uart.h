@@ -0,0 +1,33 @@
+/*
+ * Shim <zephyr/drivers/uart.h> in modalità interrupt-driven.
+ * La "FIFO" RX è il blocco di byte che il link TCP sta consegnando:
+ * la callback registrata viene invocata dal thread RX con irq_lock() preso.
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_UART_H
+#define SIM_ZEPHYR_DRIVERS_UART_H
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*uart_irq_callback_user_data_t)(const struct device *dev,
+                                              void *user_data);
+
+int uart_irq_callback_user_data_set(const struct device *dev,
+                                    uart_irq_callback_user_data_t cb,
+                                    void *user_data);
+void uart_irq_rx_enable(const struct device *dev);
+void uart_irq_rx_disable(const struct device *dev);
+int uart_irq_update(const struct device *dev);
+int uart_irq_rx_ready(const struct device *dev);
+int uart_fifo_read(const struct device *dev, uint8_t *rx_data, const int size);
+void uart_poll_out(const struct device *dev, unsigned char out_char);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_ZEPHYR_DRIVERS_UART_H */
@@ -0,0 +1,167 @@
+/*
+ * Shim minimale delle API kernel Zephyr usate da firmware/src/main.c,
+ * implementate sopra pthread (vedi src/sim_kernel.c).
+ *
+ * Semantica mantenuta dove conta per l'agent:
+ *  - k_mutex ricorsivo come in Zephyr;
+ *  - k_thread_abort() sincrono (ritorna a thread terminato);
+ *  - irq_lock() esclude il "ISR" UART simulato (thread RX del link).
+ * Priorità e dimensioni degli stack sono ignorate (stack pthread di default).
+ */
+#ifndef SIM_ZEPHYR_KERNEL_H
+#define SIM_ZEPHYR_KERNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARG_UNUSED(x) (void)(x)
+#define CONTAINER_OF(ptr, type, field) \
+    ((type *)(((char *)(ptr)) - offsetof(type, field)))
+
+/* ------------------------ Timeout ------------------------ */
+
+typedef struct {
+    int64_t ns; /* < 0 = attesa infinita */
+} k_timeout_t;
+
+#define K_NSEC(t)    ((k_timeout_t){ (int64_t)(t) })
+#define K_USEC(t)    K_NSEC((int64_t)(t) * 1000)
+#define K_MSEC(t)    K_NSEC((int64_t)(t) * 1000000)
+#define K_SECONDS(t) K_MSEC((int64_t)(t) * 1000)
+#define K_NO_WAIT    K_NSEC(0)
+#define K_FOREVER    K_NSEC(-1)
+
+int32_t k_sleep(k_timeout_t timeout);
+int32_t k_msleep(int32_t ms);
+int64_t k_uptime_get(void);
+
+/* ------------------------ Thread ------------------------ */
+
+typedef void (*k_thread_entry_t)(void *p1, void *p2, void *p3);
+
+struct k_thread {
+    pthread_t pthread;
+    bool started;
+    k_thread_entry_t entry;
+    void *p1, *p2, *p3;
+    size_t stack_size;
+};
+
+typedef struct k_thread *k_tid_t;
+typedef char k_thread_stack_t;
+
+#define K_THREAD_STACK_DEFINE(sym, size) k_thread_stack_t sym[size]
+#define K_THREAD_STACK_ARRAY_DEFINE(sym, n, size) k_thread_stack_t sym[n][size]
+#define K_THREAD_STACK_SIZEOF(sym) sizeof(sym)
+
+k_tid_t k_thread_create(struct k_thread *new_thread, k_thread_stack_t *stack,
+                        size_t stack_size, k_thread_entry_t entry,
+                        void *p1, void *p2, void *p3,
+                        int prio, uint32_t options, k_timeout_t delay);
+void k_thread_abort(k_tid_t thread);
+k_tid_t k_current_get(void);
+int k_thread_stack_space_get(const struct k_thread *thread, size_t *unused_ptr);
+
+/* ------------------------ Mutex / semafori ------------------------ */
+
+struct k_mutex {
+    pthread_mutex_t lock;
+    uint32_t lock_count;
+};
+
+#define K_MUTEX_DEFINE(name) \
+    struct k_mutex name = { PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP, 0 }
+
+int k_mutex_init(struct k_mutex *mutex);
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
+int k_mutex_unlock(struct k_mutex *mutex);
+
+struct k_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    unsigned int count;
+    unsigned int limit;
+};
+
+#define K_SEM_DEFINE(name, initial_count, count_limit) \
+    struct k_sem name = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, \
+                          (initial_count), (count_limit) }
+
+int k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit);
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
+void k_sem_give(struct k_sem *sem);
+void k_sem_reset(struct k_sem *sem);
+
+/* ------------------------ Message queue ------------------------ */
+
+struct k_msgq {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    char *buffer_start;
+    size_t msg_size;
+    uint32_t max_msgs;
+    uint32_t read_idx;
+    uint32_t used_msgs;
+};
+
+#define K_MSGQ_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)            \
+    static char _k_msgq_buf_##q_name[(q_msg_size) * (q_max_msgs)];        \
+    struct k_msgq q_name = { PTHREAD_MUTEX_INITIALIZER,                   \
+                             PTHREAD_COND_INITIALIZER,                    \
+                             _k_msgq_buf_##q_name, (q_msg_size),          \
+                             (q_max_msgs), 0, 0 }
+
+int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
+int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
+
+/* ------------------------ Work queue di sistema ------------------------ */
+
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+struct k_work {
+    k_work_handler_t handler;
+};
+
+struct k_work_delayable {
+    struct k_work work;
+    int64_t deadline_ns;
+    bool pending;
+    struct k_work_delayable *next;
+};
+
+struct k_work_sync {
+    int unused;
+};
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay);
+bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
+                                  struct k_work_sync *sync);
+
+static inline struct k_work_delayable *
+k_work_delayable_from_work(struct k_work *work)
+{
+    return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+/* ------------------------ IRQ / console ------------------------ */
+
+unsigned int irq_lock(void);
+void irq_unlock(unsigned int key);
+
+/* printk va sulla stessa UART del protocollo, come con CONFIG_UART_CONSOLE */
+void printk(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_ZEPHYR_KERNEL_H */
@@ -0,0 +1,7 @@
+/* Shim <zephyr/sys/mem_stats.h>: nessun simbolo usato dall'agent. */
+#ifndef SIM_ZEPHYR_SYS_MEM_STATS_H
+#define SIM_ZEPHYR_SYS_MEM_STATS_H
+
+#include <stddef.h>
+
+#endif /* SIM_ZEPHYR_SYS_MEM_STATS_H */
@@ -0,0 +1,9 @@
+/* Shim <zephyr/sys/sys_heap.h>: l'agent dichiara solo _system_heap (weak). */
+#ifndef SIM_ZEPHYR_SYS_SYS_HEAP_H
+#define SIM_ZEPHYR_SYS_SYS_HEAP_H
+
+struct sys_heap {
+    void *heap;
+};
+
+#endif /* SIM_ZEPHYR_SYS_SYS_HEAP_H */
@@ -0,0 +1,26 @@
+/*
+ * Parte "board" del simulatore: link UART su TCP con emulazione di banda e
+ * latenza, più i device UART/GPIO visti dal firmware tramite gli shim Zephyr.
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    const char *bind_host;  /* default 127.0.0.1 */
+    int port;               /* 0 = porta effimera scelta dal kernel */
+    uint32_t baud;          /* 0 = banda illimitata (8N1: 10 bit per byte) */
+    uint32_t latency_us;    /* latenza one-way aggiunta in ciascuna direzione */
+    int ready_fd;           /* se >= 0 riceve "SIM_READY port=<n>\n" e viene chiuso */
+    bool verbose;
+} sim_link_config_t;
+
+/* Avvia listener e thread del link; ritorna la porta in ascolto o -1 */
+int sim_link_start(const sim_link_config_t *cfg);
+
+int64_t sim_now_ns(void);
+void sim_sleep_until_ns(int64_t deadline_ns);
+
+#endif /* SIM_H */
@@ -0,0 +1,569 @@
+/*
+ * Primitive kernel Zephyr (thread, mutex, semafori, msgq, work queue,
+ * irq_lock) sopra pthread, per far girare firmware/src/main.c su Linux.
+ *
+ * k_thread_abort() usa pthread_cancel asincrono: come su Zephyr il worker
+ * può essere fermato anche dentro un loop wasm stretto. Le primitive qui
+ * sotto disabilitano la cancellazione nelle proprie sezioni critiche e i
+ * k_mutex posseduti da un thread abortito vengono rilasciati, così il
+ * resto dell'agent non resta bloccato.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+
+#include "sim.h"
+
+#define MAX_HELD_MUTEXES 8
+
+/* ------------------------ Tempo ------------------------ */
+
+int64_t sim_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+void sim_sleep_until_ns(int64_t deadline_ns)
+{
+    struct timespec ts;
+    ts.tv_sec  = deadline_ns / 1000000000ll;
+    ts.tv_nsec = deadline_ns % 1000000000ll;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+/*
+ * Le condition variable definite staticamente (K_SEM_DEFINE, K_MSGQ_DEFINE)
+ * usano CLOCK_REALTIME: tutte le attese con timeout usano quel clock.
+ */
+static int64_t realtime_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (int64_t)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static void deadline_to_timespec(int64_t deadline_ns, struct timespec *ts)
+{
+    ts->tv_sec  = deadline_ns / 1000000000ll;
+    ts->tv_nsec = deadline_ns % 1000000000ll;
+}
+
+/*
+ * Attende su cond (mutex già preso, cancellazione disabilitata) fino a
+ * deadline_ns (< 0 = infinito). La cancellazione è riabilitata solo durante
+ * l'attesa; il chiamante deve aver registrato un cleanup che sblocca il mutex.
+ */
+static int cond_wait_cancelable(pthread_cond_t *cond, pthread_mutex_t *lock,
+                                int64_t deadline_ns, int cancel_state)
+{
+    int ret;
+    int dummy;
+
+    pthread_setcancelstate(cancel_state, &dummy);
+    if (deadline_ns < 0) {
+        ret = pthread_cond_wait(cond, lock);
+    } else {
+        struct timespec ts;
+        deadline_to_timespec(deadline_ns, &ts);
+        ret = pthread_cond_timedwait(cond, lock, &ts);
+    }
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &dummy);
+    return ret;
+}
+
+static void unlock_cleanup(void *arg)
+{
+    pthread_mutex_unlock((pthread_mutex_t *)arg);
+}
+
+static int64_t timeout_deadline(k_timeout_t timeout)
+{
+    if (timeout.ns < 0) {
+        return -1;
+    }
+    return realtime_ns() + timeout.ns;
+}
+
+int32_t k_sleep(k_timeout_t timeout)
+{
+    if (timeout.ns < 0) {
+        for (;;) {
+            pause();
+        }
+    }
+    sim_sleep_until_ns(sim_now_ns() + timeout.ns);
+    return 0;
+}
+
+int32_t k_msleep(int32_t ms)
+{
+    return k_sleep(K_MSEC(ms));
+}
+
+int64_t k_uptime_get(void)
+{
+    static int64_t boot_ns;
+    if (boot_ns == 0) {
+        boot_ns = sim_now_ns();
+    }
+    return (sim_now_ns() - boot_ns) / 1000000;
+}
+
+/* ------------------------ Thread ------------------------ */
+
+static __thread struct k_thread *t_self;
+static __thread struct k_mutex *t_held[MAX_HELD_MUTEXES];
+static __thread int t_held_count;
+
+static struct k_thread main_thread;
+
+/* eseguito nel thread cancellato: rilascia i k_mutex ancora posseduti */
+static void release_held_mutexes(void *arg)
+{
+    ARG_UNUSED(arg);
+    for (int i = t_held_count - 1; i >= 0; i--) {
+        struct k_mutex *m = t_held[i];
+        while (m->lock_count > 0) {
+            m->lock_count--;
+            pthread_mutex_unlock(&m->lock);
+        }
+    }
+    t_held_count = 0;
+}
+
+static void *thread_trampoline(void *arg)
+{
+    struct k_thread *t = (struct k_thread *)arg;
+    int dummy;
+
+    t_self = t;
+    pthread_cleanup_push(release_held_mutexes, NULL);
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &dummy);
+    t->entry(t->p1, t->p2, t->p3);
+    pthread_cleanup_pop(0);
+    return NULL;
+}
+
+k_tid_t k_thread_create(struct k_thread *new_thread, k_thread_stack_t *stack,
+                        size_t stack_size, k_thread_entry_t entry,
+                        void *p1, void *p2, void *p3,
+                        int prio, uint32_t options, k_timeout_t delay)
+{
+    ARG_UNUSED(stack);
+    ARG_UNUSED(prio);
+    ARG_UNUSED(options);
+    ARG_UNUSED(delay);
+
+    memset(new_thread, 0, sizeof(*new_thread));
+    new_thread->entry = entry;
+    new_thread->p1 = p1;
+    new_thread->p2 = p2;
+    new_thread->p3 = p3;
+    new_thread->stack_size = stack_size;
+
+    if (pthread_create(&new_thread->pthread, NULL, thread_trampoline, new_thread) != 0) {
+        return NULL;
+    }
+    new_thread->started = true;
+    return new_thread;
+}
+
+void k_thread_abort(k_tid_t thread)
+{
+    if (!thread || !thread->started) {
+        return;
+    }
+    if (thread == t_self) {
+        pthread_exit(NULL);
+    }
+    pthread_cancel(thread->pthread);
+    pthread_join(thread->pthread, NULL);
+    thread->started = false;
+}
+
+k_tid_t k_current_get(void)
+{
+    return t_self ? t_self : &main_thread;
+}
+
+/*
+ * Gli stack pthread non hanno un watermark come CONFIG_INIT_STACKS:
+ * si riporta la dimensione richiesta dal firmware (nessun low_stack).
+ */
+int k_thread_stack_space_get(const struct k_thread *thread, size_t *unused_ptr)
+{
+    if (!thread || !unused_ptr) {
+        return -EINVAL;
+    }
+    *unused_ptr = thread->stack_size;
+    return 0;
+}
+
+/* ------------------------ Mutex ------------------------ */
+
+int k_mutex_init(struct k_mutex *mutex)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    mutex->lock_count = 0;
+    return 0;
+}
+
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+    int old_state;
+    int ret;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    if (timeout.ns < 0) {
+        ret = pthread_mutex_lock(&mutex->lock);
+    } else if (timeout.ns == 0) {
+        ret = pthread_mutex_trylock(&mutex->lock);
+    } else {
+        struct timespec ts;
+        deadline_to_timespec(realtime_ns() + timeout.ns, &ts);
+        ret = pthread_mutex_timedlock(&mutex->lock, &ts);
+    }
+
+    if (ret == 0) {
+        if (mutex->lock_count++ == 0 && t_held_count < MAX_HELD_MUTEXES) {
+            t_held[t_held_count++] = mutex;
+        }
+    }
+    pthread_setcancelstate(old_state, &old_state);
+
+    if (ret == 0) {
+        return 0;
+    }
+    return (timeout.ns == 0) ? -EBUSY : -EAGAIN;
+}
+
+int k_mutex_unlock(struct k_mutex *mutex)
+{
+    int old_state;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    if (mutex->lock_count == 0) {
+        pthread_setcancelstate(old_state, &old_state);
+        return -EINVAL;
+    }
+    if (--mutex->lock_count == 0) {
+        for (int i = t_held_count - 1; i >= 0; i--) {
+            if (t_held[i] == mutex) {
+                t_held[i] = t_held[--t_held_count];
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&mutex->lock);
+    pthread_setcancelstate(old_state, &old_state);
+    return 0;
+}
+
+/* ------------------------ Semafori ------------------------ */
+
+int k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit)
+{
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = initial_count;
+    sem->limit = limit;
+    return 0;
+}
+
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout)
+{
+    int old_state;
+    volatile int ret = 0;
+    int64_t deadline = timeout_deadline(timeout);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&sem->lock);
+    pthread_cleanup_push(unlock_cleanup, &sem->lock);
+
+    while (sem->count == 0) {
+        if (timeout.ns == 0) {
+            ret = -EBUSY;
+            break;
+        }
+        if (cond_wait_cancelable(&sem->cond, &sem->lock, deadline, old_state) == ETIMEDOUT
+            && sem->count == 0) {
+            ret = -EAGAIN;
+            break;
+        }
+    }
+    if (ret == 0) {
+        sem->count--;
+    }
+
+    pthread_cleanup_pop(1);
+    pthread_setcancelstate(old_state, &old_state);
+    return ret;
+}
+
+void k_sem_give(struct k_sem *sem)
+{
+    int old_state;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&sem->lock);
+    if (sem->count < sem->limit) {
+        sem->count++;
+    }
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    pthread_setcancelstate(old_state, &old_state);
+}
+
+void k_sem_reset(struct k_sem *sem)
+{
+    int old_state;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&sem->lock);
+    sem->count = 0;
+    pthread_mutex_unlock(&sem->lock);
+    pthread_setcancelstate(old_state, &old_state);
+}
+
+/* ------------------------ Message queue ------------------------ */
+
+int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+{
+    int old_state;
+    volatile int ret = 0;
+    int64_t deadline = timeout_deadline(timeout);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&msgq->lock);
+    pthread_cleanup_push(unlock_cleanup, &msgq->lock);
+
+    while (msgq->used_msgs == msgq->max_msgs) {
+        if (timeout.ns == 0) {
+            ret = -ENOMSG;
+            break;
+        }
+        if (cond_wait_cancelable(&msgq->cond, &msgq->lock, deadline, old_state) == ETIMEDOUT
+            && msgq->used_msgs == msgq->max_msgs) {
+            ret = -EAGAIN;
+            break;
+        }
+    }
+    if (ret == 0) {
+        uint32_t idx = (msgq->read_idx + msgq->used_msgs) % msgq->max_msgs;
+        memcpy(msgq->buffer_start + idx * msgq->msg_size, data, msgq->msg_size);
+        msgq->used_msgs++;
+        pthread_cond_broadcast(&msgq->cond);
+    }
+
+    pthread_cleanup_pop(1);
+    pthread_setcancelstate(old_state, &old_state);
+    return ret;
+}
+
+int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+    int old_state;
+    volatile int ret = 0;
+    int64_t deadline = timeout_deadline(timeout);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&msgq->lock);
+    pthread_cleanup_push(unlock_cleanup, &msgq->lock);
+
+    while (msgq->used_msgs == 0) {
+        if (timeout.ns == 0) {
+            ret = -ENOMSG;
+            break;
+        }
+        if (cond_wait_cancelable(&msgq->cond, &msgq->lock, deadline, old_state) == ETIMEDOUT
+            && msgq->used_msgs == 0) {
+            ret = -EAGAIN;
+            break;
+        }
+    }
+    if (ret == 0) {
+        memcpy(data, msgq->buffer_start + msgq->read_idx * msgq->msg_size, msgq->msg_size);
+        msgq->read_idx = (msgq->read_idx + 1) % msgq->max_msgs;
+        msgq->used_msgs--;
+        pthread_cond_broadcast(&msgq->cond);
+    }
+
+    pthread_cleanup_pop(1);
+    pthread_setcancelstate(old_state, &old_state);
+    return ret;
+}
+
+/* ------------------------ Work queue di sistema ------------------------ */
+
+static pthread_mutex_t wq_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wq_cond = PTHREAD_COND_INITIALIZER;
+static struct k_work_delayable *wq_head;    /* lista pending, non ordinata */
+static struct k_work_delayable *wq_running; /* item in esecuzione */
+static pthread_t wq_thread;
+static pthread_once_t wq_once = PTHREAD_ONCE_INIT;
+
+static void wq_unlink_locked(struct k_work_delayable *dwork)
+{
+    for (struct k_work_delayable **pp = &wq_head; *pp; pp = &(*pp)->next) {
+        if (*pp == dwork) {
+            *pp = dwork->next;
+            dwork->next = NULL;
+            dwork->pending = false;
+            return;
+        }
+    }
+}
+
+static void *wq_thread_entry(void *arg)
+{
+    struct k_thread self = { 0 };
+    ARG_UNUSED(arg);
+
+    t_self = &self;
+    pthread_mutex_lock(&wq_lock);
+    for (;;) {
+        struct k_work_delayable *next = NULL;
+        for (struct k_work_delayable *w = wq_head; w; w = w->next) {
+            if (!next || w->deadline_ns < next->deadline_ns) {
+                next = w;
+            }
+        }
+
+        if (!next) {
+            pthread_cond_wait(&wq_cond, &wq_lock);
+            continue;
+        }
+        int64_t wait_ns = next->deadline_ns - sim_now_ns();
+        if (wait_ns > 0) {
+            struct timespec ts;
+            deadline_to_timespec(realtime_ns() + wait_ns, &ts);
+            pthread_cond_timedwait(&wq_cond, &wq_lock, &ts);
+            continue;
+        }
+
+        wq_unlink_locked(next);
+        wq_running = next;
+        pthread_mutex_unlock(&wq_lock);
+
+        next->work.handler(&next->work);
+
+        pthread_mutex_lock(&wq_lock);
+        wq_running = NULL;
+        pthread_cond_broadcast(&wq_cond);
+    }
+    return NULL;
+}
+
+static void wq_start(void)
+{
+    pthread_create(&wq_thread, NULL, wq_thread_entry, NULL);
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler)
+{
+    int old_state;
+
+    pthread_once(&wq_once, wq_start);
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&wq_lock);
+    wq_unlink_locked(dwork);
+    memset(dwork, 0, sizeof(*dwork));
+    dwork->work.handler = handler;
+    pthread_mutex_unlock(&wq_lock);
+    pthread_setcancelstate(old_state, &old_state);
+}
+
+int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+    int old_state;
+
+    pthread_once(&wq_once, wq_start);
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&wq_lock);
+    wq_unlink_locked(dwork);
+    dwork->deadline_ns = sim_now_ns() + (delay.ns > 0 ? delay.ns : 0);
+    dwork->pending = true;
+    dwork->next = wq_head;
+    wq_head = dwork;
+    pthread_cond_broadcast(&wq_cond);
+    pthread_mutex_unlock(&wq_lock);
+    pthread_setcancelstate(old_state, &old_state);
+    return 1;
+}
+
+bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
+                                  struct k_work_sync *sync)
+{
+    int old_state;
+    bool was_busy;
+    ARG_UNUSED(sync);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&wq_lock);
+    pthread_cleanup_push(unlock_cleanup, &wq_lock);
+
+    was_busy = dwork->pending || wq_running == dwork;
+    wq_unlink_locked(dwork);
+    /* il worker può essere abortito dall'handler stesso mentre aspetta */
+    while (wq_running == dwork) {
+        cond_wait_cancelable(&wq_cond, &wq_lock, -1, old_state);
+    }
+
+    pthread_cleanup_pop(1);
+    pthread_setcancelstate(old_state, &old_state);
+    return was_busy;
+}
+
+/* ------------------------ IRQ lock / console ------------------------ */
+
+static pthread_mutex_t irq_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+unsigned int irq_lock(void)
+{
+    int old_state;
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&irq_mutex);
+    return (unsigned int)old_state;
+}
+
+void irq_unlock(unsigned int key)
+{
+    int dummy;
+    pthread_mutex_unlock(&irq_mutex);
+    pthread_setcancelstate((int)key, &dummy);
+}
+
+void printk(const char *fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+    int old_state;
+
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) {
+        return;
+    }
+    if ((size_t)n >= sizeof(buf)) {
+        n = sizeof(buf) - 1;
+    }
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    for (int i = 0; i < n; i++) {
+        uart_poll_out(&sim_uart_device, (unsigned char)buf[i]);
+    }
+    pthread_setcancelstate(old_state, &old_state);
+}
@@ -0,0 +1,397 @@
+/*
+ * Link UART simulato: un client TCP alla volta (come il bridge di Renode),
+ * i byte ricevuti vengono consegnati alla callback "ISR" del firmware a
+ * velocità di linea (--baud) dopo la latenza configurata; lo stesso vale
+ * per l'uscita verso il client.
+ *
+ * Il "filo" è modellato come una coda di chunk timestampati all'arrivo:
+ * un chunk parte quando è trascorsa la latenza e il filo è libero, e viene
+ * consegnato a fette di SIM_LINK_SLICE byte al ritmo di un byte ogni
+ * 10/baud secondi. In RX la coda è limitata, così il mittente TCP rallenta
+ * come farebbe pyserial su una seriale vera.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/gpio.h>
+
+#include "sim.h"
+
+#define SIM_LINK_SLICE      16    /* byte per "interrupt" RX/TX */
+#define SIM_RX_QUEUE_LIMIT  1024  /* byte in volo lato device con --baud */
+#define SIM_TX_LINE_SIZE    256
+
+const struct device sim_uart_device = { "uart_sim" };
+const struct device sim_gpio_device = { "gpio_sim" };
+
+static sim_link_config_t g_cfg;
+static int64_t g_byte_ns;
+static int64_t g_latency_ns;
+
+/* ------------------------ Filo con banda/latenza ------------------------ */
+
+typedef struct link_chunk {
+    struct link_chunk *next;
+    int64_t arrival_ns;
+    size_t len;
+    uint8_t data[];
+} link_chunk_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    link_chunk_t *head;
+    link_chunk_t *tail;
+    size_t queued_bytes;
+    size_t queue_limit;   /* 0 = illimitata */
+    int64_t wire_free_ns;
+    void (*sink)(const uint8_t *data, size_t len);
+    pthread_t thread;
+} link_pipe_t;
+
+static void pipe_push(link_pipe_t *p, const uint8_t *data, size_t len)
+{
+    link_chunk_t *c = malloc(sizeof(*c) + len);
+    if (!c) {
+        return;
+    }
+    c->next = NULL;
+    c->arrival_ns = sim_now_ns();
+    c->len = len;
+    memcpy(c->data, data, len);
+
+    pthread_mutex_lock(&p->lock);
+    while (p->queue_limit && p->queued_bytes >= p->queue_limit) {
+        pthread_cond_wait(&p->cond, &p->lock);
+    }
+    if (p->tail) {
+        p->tail->next = c;
+    } else {
+        p->head = c;
+    }
+    p->tail = c;
+    p->queued_bytes += len;
+    pthread_cond_broadcast(&p->cond);
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void *pipe_thread(void *arg)
+{
+    link_pipe_t *p = (link_pipe_t *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&p->lock);
+        while (!p->head) {
+            pthread_cond_wait(&p->cond, &p->lock);
+        }
+        link_chunk_t *c = p->head;
+        pthread_mutex_unlock(&p->lock);
+
+        int64_t t = c->arrival_ns + g_latency_ns;
+        if (t < p->wire_free_ns) {
+            t = p->wire_free_ns;
+        }
+
+        if (g_byte_ns == 0) {
+            if (g_latency_ns) {
+                sim_sleep_until_ns(t);
+            }
+            p->sink(c->data, c->len);
+        } else {
+            for (size_t off = 0; off < c->len; off += SIM_LINK_SLICE) {
+                size_t n = c->len - off;
+                if (n > SIM_LINK_SLICE) {
+                    n = SIM_LINK_SLICE;
+                }
+                t += (int64_t)n * g_byte_ns;
+                sim_sleep_until_ns(t);
+                p->sink(c->data + off, n);
+            }
+        }
+        p->wire_free_ns = t;
+
+        pthread_mutex_lock(&p->lock);
+        p->head = c->next;
+        if (!p->head) {
+            p->tail = NULL;
+        }
+        p->queued_bytes -= c->len;
+        pthread_cond_broadcast(&p->cond);
+        pthread_mutex_unlock(&p->lock);
+        free(c);
+    }
+    return NULL;
+}
+
+static void pipe_init(link_pipe_t *p, void (*sink)(const uint8_t *, size_t),
+                      size_t queue_limit)
+{
+    memset(p, 0, sizeof(*p));
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->cond, NULL);
+    p->sink = sink;
+    p->queue_limit = queue_limit;
+    pthread_create(&p->thread, NULL, pipe_thread, p);
+}
+
+static link_pipe_t g_rx_pipe;
+static link_pipe_t g_tx_pipe;
+
+/* ------------------------ Client TCP ------------------------ */
+
+static pthread_mutex_t g_client_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_client_fd = -1;
+
+/* senza client collegato i byte TX vanno persi, come su una UART scollegata */
+static void tx_sink(const uint8_t *data, size_t len)
+{
+    pthread_mutex_lock(&g_client_lock);
+    if (g_client_fd >= 0) {
+        (void)send(g_client_fd, data, len, MSG_NOSIGNAL);
+    }
+    pthread_mutex_unlock(&g_client_lock);
+}
+
+/* ------------------------ UART ------------------------ */
+
+static uart_irq_callback_user_data_t g_uart_cb;
+static void *g_uart_cb_data;
+static volatile bool g_rx_irq_enabled;
+
+static const uint8_t *g_rx_ptr;
+static size_t g_rx_len;
+
+static pthread_mutex_t g_tx_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t g_tx_line[SIM_TX_LINE_SIZE];
+static size_t g_tx_len;
+
+/* "interrupt" RX: la callback svuota la fetta corrente con uart_fifo_read */
+static void rx_sink(const uint8_t *data, size_t len)
+{
+    unsigned int key = irq_lock();
+
+    g_rx_ptr = data;
+    g_rx_len = len;
+    while (g_rx_len > 0 && g_uart_cb && g_rx_irq_enabled) {
+        size_t before = g_rx_len;
+        g_uart_cb(&sim_uart_device, g_uart_cb_data);
+        if (g_rx_len == before) {
+            break;
+        }
+    }
+    /* senza ISR registrata i byte vengono scartati */
+    g_rx_ptr = NULL;
+    g_rx_len = 0;
+
+    irq_unlock(key);
+}
+
+int uart_irq_callback_user_data_set(const struct device *dev,
+                                    uart_irq_callback_user_data_t cb,
+                                    void *user_data)
+{
+    ARG_UNUSED(dev);
+    unsigned int key = irq_lock();
+    g_uart_cb = cb;
+    g_uart_cb_data = user_data;
+    irq_unlock(key);
+    return 0;
+}
+
+void uart_irq_rx_enable(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+    g_rx_irq_enabled = true;
+}
+
+void uart_irq_rx_disable(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+    g_rx_irq_enabled = false;
+}
+
+int uart_irq_update(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+    return 1;
+}
+
+int uart_irq_rx_ready(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+    return g_rx_len > 0;
+}
+
+int uart_fifo_read(const struct device *dev, uint8_t *rx_data, const int size)
+{
+    ARG_UNUSED(dev);
+    if (size <= 0 || g_rx_len == 0) {
+        return 0;
+    }
+    size_t n = (size_t)size < g_rx_len ? (size_t)size : g_rx_len;
+    memcpy(rx_data, g_rx_ptr, n);
+    g_rx_ptr += n;
+    g_rx_len -= n;
+    return (int)n;
+}
+
+/* bufferizza fino a fine riga: un send() per byte renderebbe il TX il collo di bottiglia */
+void uart_poll_out(const struct device *dev, unsigned char out_char)
+{
+    int old_state;
+    ARG_UNUSED(dev);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old_state);
+    pthread_mutex_lock(&g_tx_lock);
+    g_tx_line[g_tx_len++] = out_char;
+    if (out_char == '\n' || g_tx_len == sizeof(g_tx_line)) {
+        if (g_cfg.verbose) {
+            fprintf(stderr, "[sim:%d] >> %.*s", g_cfg.port, (int)g_tx_len, g_tx_line);
+        }
+        pipe_push(&g_tx_pipe, g_tx_line, g_tx_len);
+        g_tx_len = 0;
+    }
+    pthread_mutex_unlock(&g_tx_lock);
+    pthread_setcancelstate(old_state, &old_state);
+}
+
+/* ------------------------ GPIO ------------------------ */
+
+static int g_led_state;
+static uint32_t g_led_toggles;
+
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, gpio_flags_t extra_flags)
+{
+    ARG_UNUSED(spec);
+    g_led_state = (extra_flags & GPIO_OUTPUT_INIT_LOW) ? 0 : g_led_state;
+    return 0;
+}
+
+int gpio_pin_toggle(const struct device *port, gpio_pin_t pin)
+{
+    ARG_UNUSED(port);
+    ARG_UNUSED(pin);
+    g_led_state = !g_led_state;
+    g_led_toggles++;
+    if (g_cfg.verbose) {
+        fprintf(stderr, "[sim:%d] led=%d toggles=%u\n", g_cfg.port, g_led_state, g_led_toggles);
+    }
+    return 0;
+}
+
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value)
+{
+    ARG_UNUSED(spec);
+    if ((value != 0) != (g_led_state != 0)) {
+        g_led_toggles++;
+    }
+    g_led_state = (value != 0);
+    return 0;
+}
+
+/* ------------------------ Listener ------------------------ */
+
+static int g_listen_fd = -1;
+
+static void *accept_thread(void *arg)
+{
+    uint8_t buf[4096];
+    ARG_UNUSED(arg);
+
+    for (;;) {
+        int fd = accept(g_listen_fd, NULL, NULL);
+        if (fd < 0) {
+            continue;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        pthread_mutex_lock(&g_client_lock);
+        g_client_fd = fd;
+        pthread_mutex_unlock(&g_client_lock);
+        if (g_cfg.verbose) {
+            fprintf(stderr, "[sim:%d] client connected\n", g_cfg.port);
+        }
+
+        for (;;) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                break;
+            }
+            pipe_push(&g_rx_pipe, buf, (size_t)n);
+        }
+
+        pthread_mutex_lock(&g_client_lock);
+        g_client_fd = -1;
+        pthread_mutex_unlock(&g_client_lock);
+        close(fd);
+        if (g_cfg.verbose) {
+            fprintf(stderr, "[sim:%d] client disconnected\n", g_cfg.port);
+        }
+    }
+    return NULL;
+}
+
+int sim_link_start(const sim_link_config_t *cfg)
+{
+    struct addrinfo hints, *res = NULL;
+    char port_str[16];
+    pthread_t tid;
+
+    g_cfg = *cfg;
+    g_byte_ns = cfg->baud ? (int64_t)(10ll * 1000000000ll / cfg->baud) : 0;
+    g_latency_ns = (int64_t)cfg->latency_us * 1000;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    snprintf(port_str, sizeof(port_str), "%d", cfg->port);
+    if (getaddrinfo(cfg->bind_host, port_str, &hints, &res) != 0 || !res) {
+        fprintf(stderr, "agent_sim: cannot resolve %s\n", cfg->bind_host);
+        return -1;
+    }
+
+    g_listen_fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    int one = 1;
+    setsockopt(g_listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (cfg->baud) {
+        /* buffer piccolo: la backpressure della coda RX arriva fino al mittente */
+        int rcvbuf = 4096;
+        setsockopt(g_listen_fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    }
+    if (bind(g_listen_fd, res->ai_addr, res->ai_addrlen) != 0
+        || listen(g_listen_fd, 4) != 0) {
+        perror("agent_sim: bind/listen");
+        freeaddrinfo(res);
+        return -1;
+    }
+    freeaddrinfo(res);
+
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof(addr);
+    getsockname(g_listen_fd, (struct sockaddr *)&addr, &addr_len);
+    g_cfg.port = ntohs(addr.sin_port);
+
+    pipe_init(&g_rx_pipe, rx_sink, cfg->baud ? SIM_RX_QUEUE_LIMIT : 0);
+    pipe_init(&g_tx_pipe, tx_sink, 0);
+    pthread_create(&tid, NULL, accept_thread, NULL);
+    pthread_detach(tid);
+
+    if (cfg->ready_fd >= 0) {
+        char line[48];
+        int n = snprintf(line, sizeof(line), "SIM_READY port=%d\n", g_cfg.port);
+        (void)!write(cfg->ready_fd, line, (size_t)n);
+        close(cfg->ready_fd);
+    }
+    return g_cfg.port;
+}
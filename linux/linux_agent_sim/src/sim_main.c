@@ -0,0 +1,78 @@
+/*
+ * agent_sim: l'agent di firmware/src/main.c compilato per Linux.
+ * Parla lo stesso protocollo LOAD/START/STOP/STATUS su un socket TCP
+ * (endpoint gateway "tcp:host:porta"), con banda e latenza del link
+ * configurabili per avvicinarsi alla UART reale.
+ */
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+/* main() del firmware, rinominato in compilazione (-Dmain=agent_main) */
+int agent_main(void);
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Uso: %s [opzioni]\n"
+            "  --host ADDR        indirizzo di ascolto (default 127.0.0.1)\n"
+            "  --port N           porta TCP, 0 = effimera (default 5000)\n"
+            "  --baud N           banda del link in baud 8N1, 0 = illimitata (default 0)\n"
+            "  --latency-us N     latenza one-way aggiunta per direzione (default 0)\n"
+            "  --ready-fd FD      scrive \"SIM_READY port=<n>\" su FD quando in ascolto\n"
+            "  --verbose          log del traffico TX e del LED su stderr\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    static const struct option long_opts[] = {
+        { "host",       required_argument, NULL, 'H' },
+        { "port",       required_argument, NULL, 'p' },
+        { "baud",       required_argument, NULL, 'b' },
+        { "latency-us", required_argument, NULL, 'l' },
+        { "ready-fd",   required_argument, NULL, 'r' },
+        { "verbose",    no_argument,       NULL, 'v' },
+        { "help",       no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    sim_link_config_t cfg = {
+        .bind_host = "127.0.0.1",
+        .port = 5000,
+        .baud = 0,
+        .latency_us = 0,
+        .ready_fd = -1,
+        .verbose = false,
+    };
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "H:p:b:l:r:vh", long_opts, NULL)) != -1) {
+        switch (opt) {
+        case 'H': cfg.bind_host = optarg; break;
+        case 'p': cfg.port = atoi(optarg); break;
+        case 'b': cfg.baud = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'l': cfg.latency_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'r': cfg.ready_fd = atoi(optarg); break;
+        case 'v': cfg.verbose = true; break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    int port = sim_link_start(&cfg);
+    if (port < 0) {
+        return 1;
+    }
+    printf("agent_sim listening on %s:%d baud=%u latency_us=%u\n",
+           cfg.bind_host, port, cfg.baud, cfg.latency_us);
+
+    return agent_main();
+}
@@ -0,0 +1,29 @@
+# Scrive bench_build_info.h (SHA git, compilatore, flag) per --format results.
+# Gira a ogni build (target build_info) e tocca l'header solo se cambia,
+# così lo SHA resta giusto anche senza riconfigurare.
+#
+#   cmake -DSRC_DIR=... -DOUT=... -DCOMPILER=... -DFLAGS=... -P build_info.cmake
+
+execute_process (COMMAND git rev-parse --short=12 HEAD
+  WORKING_DIRECTORY ${SRC_DIR}
+  OUTPUT_VARIABLE sha OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+if (sha)
+  execute_process (COMMAND git status --porcelain --untracked-files=no
+    WORKING_DIRECTORY ${SRC_DIR}
+    OUTPUT_VARIABLE dirty ERROR_QUIET)
+  if (dirty)
+    string (APPEND sha "-dirty")
+  endif ()
+else ()
+  set (sha "unknown")
+endif ()
+
+string (STRIP "${FLAGS}" FLAGS)
+string (REPLACE "\\" "\\\\" FLAGS "${FLAGS}")
+string (REPLACE "\"" "\\\"" FLAGS "${FLAGS}")
+file (WRITE ${OUT}.tmp
+  "/* generato da build_info.cmake */\n"
+  "#define BENCH_GIT_SHA  \"${sha}\"\n"
+  "#define BENCH_COMPILER \"${COMPILER}\"\n"
+  "#define BENCH_C_FLAGS  \"${FLAGS}\"\n")
+configure_file (${OUT}.tmp ${OUT} COPYONLY)
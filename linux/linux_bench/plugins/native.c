@@ -0,0 +1,186 @@
+/*
+ * Plugin "native": i kernel sono compilati dallo stesso sorgente C dei
+ * moduli wasm come shared object (<modulo>.so) e chiamati via dlsym.
+ * Niente instantiate: le variabili statiche del .so sono l'istanza.
+ */
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bench_phase.h"
+#include "bench_plugin.h"
+
+struct bench_module {
+    void *handle;
+};
+
+/* anche le funzioni void si chiamano così: il valore di ritorno è spazzatura
+ * e il driver lo legge solo per <kernel>_checksum */
+typedef uint32_t (*fn0_t)(void);
+typedef uint32_t (*fn1_t)(uint32_t);
+typedef uint32_t (*fn2_t)(uint32_t, uint32_t);
+typedef uint32_t (*fn3_t)(uint32_t, uint32_t, uint32_t);
+typedef uint32_t (*fn4_t)(uint32_t, uint32_t, uint32_t, uint32_t);
+
+static bool native_init(char *err, size_t err_len)
+{
+    (void)err;
+    (void)err_len;
+    return true;
+}
+
+static void native_deinit(void)
+{
+}
+
+/*
+ * dlopen di una copia temporanea di path: il loader la vede come un altro
+ * .so, con le proprie statiche. dlmopen in un namespace nuovo farebbe lo
+ * stesso ma ricarica anche la libc, che esaurisce il TLS statico in pochi
+ * namespace.
+ */
+static void *dlopen_copy(const char *path, char *err, size_t err_len)
+{
+    char tmp[] = "/tmp/bench_native_XXXXXX";
+    char buf[65536];
+    size_t n;
+    void *h = NULL;
+
+    int fd = mkstemp(tmp);
+    FILE *in = fopen(path, "rb");
+    if (fd < 0 || !in) {
+        snprintf(err, err_len, "cannot copy %s", path);
+        goto out;
+    }
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0) {
+        if (write(fd, buf, n) != (ssize_t)n) {
+            snprintf(err, err_len, "cannot copy %s", path);
+            goto out;
+        }
+    }
+    h = dlopen(tmp, RTLD_NOW | RTLD_LOCAL);
+    if (!h) snprintf(err, err_len, "%s", dlerror());
+
+out:
+    if (in) fclose(in);
+    if (fd >= 0) {
+        close(fd);
+        unlink(tmp);   /* resta mappato finché serve */
+    }
+    return h;
+}
+
+static bench_module_t *native_load(const char *path, char *err, size_t err_len)
+{
+    /* già caricato (--threads, un modulo per thread): dlopen ridarebbe lo
+     * stesso handle e le stesse statiche */
+    void *h = dlopen(path, RTLD_NOW | RTLD_LOCAL | RTLD_NOLOAD);
+    if (h) {
+        dlclose(h);
+        h = dlopen_copy(path, err, err_len);
+        if (!h) return NULL;
+    } else {
+        h = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    }
+    if (!h) {
+        snprintf(err, err_len, "%s", dlerror());
+        return NULL;
+    }
+    bench_module_t *mod = calloc(1, sizeof(*mod));
+    if (!mod) {
+        dlclose(h);
+        snprintf(err, err_len, "out of memory");
+        return NULL;
+    }
+    mod->handle = h;
+    return mod;
+}
+
+static void native_unload(bench_module_t *mod)
+{
+    if (!mod) return;
+    dlclose(mod->handle);
+    free(mod);
+}
+
+static bench_func_t *native_lookup(bench_module_t *mod, const char *name)
+{
+    return (bench_func_t *)dlsym(mod->handle, name);
+}
+
+static bool native_call(bench_module_t *mod, bench_func_t *func,
+                        uint32_t argc, const uint32_t *argv, uint32_t *ret,
+                        char *err, size_t err_len)
+{
+    uint32_t r;
+    (void)mod;
+    /* la firma non è nota: si chiama con il numero di argomenti richiesto
+     * dal driver, come farebbe il runtime wasm dopo il type check */
+    switch (argc) {
+    case 0: r = ((fn0_t)(void *)func)(); break;
+    case 1: r = ((fn1_t)(void *)func)(argv[0]); break;
+    case 2: r = ((fn2_t)(void *)func)(argv[0], argv[1]); break;
+    case 3: r = ((fn3_t)(void *)func)(argv[0], argv[1], argv[2]); break;
+    case 4: r = ((fn4_t)(void *)func)(argv[0], argv[1], argv[2], argv[3]); break;
+    default:
+        snprintf(err, err_len, "too many arguments (%u)", argc);
+        return false;
+    }
+    if (ret) *ret = r;
+    return true;
+}
+
+/* dlopen (mappa e riloca il .so) e first_call (dlsym + chiamata); il
+ * loader dinamico alloca con il malloc di glibc: nessun conteggio di heap */
+static bool native_startup(const char *path, const char *func,
+                           uint32_t argc, const uint32_t *argv,
+                           bench_phase_t *phases, uint32_t *num_phases,
+                           char *err, size_t err_len)
+{
+    uint32_t n = 0;
+    bool ok = false;
+
+    bench_phase_begin(&phases[n], "dlopen", false);
+    bench_module_t *mod = native_load(path, err, err_len);
+    bench_phase_end(&phases[n++]);
+    if (!mod) {
+        *num_phases = n;
+        return false;
+    }
+
+    if (func) {
+        bench_phase_begin(&phases[n], "first_call", false);
+        bench_func_t *fn = native_lookup(mod, func);
+        bool called = fn && native_call(mod, fn, argc, argv, NULL, err, err_len);
+        bench_phase_end(&phases[n++]);
+        if (!fn) {
+            snprintf(err, err_len, "%s: not found", func);
+        }
+        ok = called;
+    } else {
+        ok = true;
+    }
+
+    native_unload(mod);
+    *num_phases = n;
+    return ok;
+}
+
+static const bench_runtime_t native_runtime = {
+    .abi_version   = BENCH_PLUGIN_ABI_VERSION,
+    .name          = "native",
+    .module_suffix = ".so",
+    .init          = native_init,
+    .deinit        = native_deinit,
+    .load          = native_load,
+    .unload        = native_unload,
+    .lookup        = native_lookup,
+    .call          = native_call,
+    .startup       = native_startup,
+};
+
+BENCH_PLUGIN_EXPORT const bench_runtime_t *bench_plugin_runtime(void)
+{
+    return &native_runtime;
+}
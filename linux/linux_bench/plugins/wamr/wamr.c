@@ -0,0 +1,370 @@
+/*
+ * Plugin WAMR: lo stesso sorgente è compilato una volta per modalità
+ * (classic/fast interp, AOT, LLVM JIT, Fast JIT, multi-tier), ognuna con la
+ * propria copia di vmlib configurata dalle WAMR_BUILD_* del sotto-progetto.
+ * BENCH_RUNTIME_NAME, BENCH_MODULE_SUFFIX e BENCH_RUNNING_MODE arrivano dal
+ * CMakeLists.txt. Con WASM_ENABLE_OPCODE_COUNTER (wamr-interp-prof,
+ * wamr-fast-interp-prof) espone i contatori degli opcode a --opcode-profile.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm_export.h"
+
+#include "bench_phase.h"
+#include "bench_plugin.h"
+#include "hostcall_wamr.h"   /* import di hostcall_bench.wasm */
+
+#define WAMR_STACK_SIZE (64 * 1024)
+/* heap dell'app nella memoria lineare; ridefinito dai profili di
+ * bench_sweep.py wamr (BENCH_WAMR_DEFS) */
+#ifndef WAMR_HEAP_SIZE
+#define WAMR_HEAP_SIZE  (16 * 1024)
+#endif
+#define HEAP_HEADER     16   /* dimensione del blocco, allineamento di malloc */
+
+struct bench_module {
+    uint8_t            *buf;   /* il loader lo referenzia (e l'interprete lo modifica) */
+    wasm_module_t       module;
+    wasm_module_inst_t  inst;
+    wasm_exec_env_t     env;
+    bool                shared;   /* module appartiene all'istanza di base */
+};
+
+static uint8_t *read_file(const char *path, uint32_t *size, char *err, size_t err_len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        snprintf(err, err_len, "cannot open %s", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = (len > 0) ? malloc((size_t)len) : NULL;
+    if (!buf || fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        snprintf(err, err_len, "cannot read %s", path);
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = (uint32_t)len;
+    return buf;
+}
+
+/*
+ * Allocatore di WAMR: malloc di sistema con la dimensione in testa al blocco,
+ * così bench_phase.h conta i byte vivi e il picco per --startup. La memoria
+ * lineare e il codice AOT/JIT passano da os_mmap e non da qui. Con
+ * --threads i contatori non sono protetti: valgono solo per --startup.
+ */
+static void *heap_malloc(unsigned int size)
+{
+    uint8_t *block = malloc((size_t)size + HEAP_HEADER);
+    if (!block) return NULL;
+    *(size_t *)block = size;
+    bench_heap_add(size);
+    return block + HEAP_HEADER;
+}
+
+static void heap_free(void *ptr)
+{
+    if (!ptr) return;
+    uint8_t *block = (uint8_t *)ptr - HEAP_HEADER;
+    bench_heap_sub(*(size_t *)block);
+    free(block);
+}
+
+static void *heap_realloc(void *ptr, unsigned int size)
+{
+    if (!ptr) return heap_malloc(size);
+
+    uint8_t *block = (uint8_t *)ptr - HEAP_HEADER;
+    size_t old = *(size_t *)block;
+    uint8_t *nblock = realloc(block, (size_t)size + HEAP_HEADER);
+    if (!nblock) return NULL;
+    *(size_t *)nblock = size;
+    bench_heap_sub(old);
+    bench_heap_add(size);
+    return nblock + HEAP_HEADER;
+}
+
+static bool wamr_init(char *err, size_t err_len)
+{
+    RuntimeInitArgs init_args;
+
+    /* init args base: allocatore di sistema, contato */
+    memset(&init_args, 0, sizeof(init_args));
+    init_args.mem_alloc_type = Alloc_With_Allocator;
+    init_args.mem_alloc_option.allocator.malloc_func  = (void *)heap_malloc;
+    init_args.mem_alloc_option.allocator.realloc_func = (void *)heap_realloc;
+    init_args.mem_alloc_option.allocator.free_func    = (void *)heap_free;
+    init_args.running_mode   = (RunningMode)BENCH_RUNNING_MODE;
+
+    /* 0 = nessuna modalità da imporre (build solo AOT) */
+    if (BENCH_RUNNING_MODE != 0
+        && !wasm_runtime_is_running_mode_supported((RunningMode)BENCH_RUNNING_MODE)) {
+        snprintf(err, err_len, "running mode %d not built in", (int)BENCH_RUNNING_MODE);
+        return false;
+    }
+    if (!wasm_runtime_full_init(&init_args)) {
+        snprintf(err, err_len, "wasm_runtime_full_init failed");
+        return false;
+    }
+    /* niente warning a ogni avvio per gli import non risolti (toggle) */
+    wasm_runtime_set_log_level(WASM_LOG_LEVEL_ERROR);
+    if (!hostcall_register_wamr()) {
+        snprintf(err, err_len, "wasm_runtime_register_natives failed");
+        wasm_runtime_destroy();
+        return false;
+    }
+    return true;
+}
+
+static void wamr_deinit(void)
+{
+    wasm_runtime_destroy();
+}
+
+static void wamr_unload(bench_module_t *mod)
+{
+    if (!mod) return;
+    if (mod->env) wasm_runtime_destroy_exec_env(mod->env);
+    if (mod->inst) wasm_runtime_deinstantiate(mod->inst);
+    if (mod->module && !mod->shared) wasm_runtime_unload(mod->module);
+    free(mod->buf);
+    free(mod);
+}
+
+/* istanza ed exec env propri sul modulo di base (--threads, modulo condiviso) */
+static bench_module_t *wamr_instantiate(bench_module_t *base, char *err, size_t err_len)
+{
+    char error_buf[128];
+    bench_module_t *mod = calloc(1, sizeof(*mod));
+    if (!mod) {
+        snprintf(err, err_len, "out of memory");
+        return NULL;
+    }
+
+    mod->module = base->module;
+    mod->shared = true;
+    mod->inst = wasm_runtime_instantiate(mod->module, WAMR_STACK_SIZE, WAMR_HEAP_SIZE,
+                                         error_buf, sizeof(error_buf));
+    if (!mod->inst) {
+        snprintf(err, err_len, "instantiate failed: %s", error_buf);
+        goto fail;
+    }
+    mod->env = wasm_runtime_create_exec_env(mod->inst, WAMR_STACK_SIZE);
+    if (!mod->env) {
+        snprintf(err, err_len, "create_exec_env failed");
+        goto fail;
+    }
+    return mod;
+
+fail:
+    wamr_unload(mod);
+    return NULL;
+}
+
+/* thread non creati da WAMR: stack e segnali per il bound check hardware */
+static bool wamr_thread_init(char *err, size_t err_len)
+{
+    if (!wasm_runtime_init_thread_env()) {
+        snprintf(err, err_len, "wasm_runtime_init_thread_env failed");
+        return false;
+    }
+    return true;
+}
+
+static void wamr_thread_deinit(void)
+{
+    wasm_runtime_destroy_thread_env();
+}
+
+static bench_module_t *wamr_load(const char *path, char *err, size_t err_len)
+{
+    char error_buf[128];
+    uint32_t size = 0;
+    bench_module_t *mod = calloc(1, sizeof(*mod));
+    if (!mod) {
+        snprintf(err, err_len, "out of memory");
+        return NULL;
+    }
+
+    mod->buf = read_file(path, &size, err, err_len);
+    if (!mod->buf) goto fail;
+
+    mod->module = wasm_runtime_load(mod->buf, size, error_buf, sizeof(error_buf));
+    if (!mod->module) {
+        snprintf(err, err_len, "load failed: %s", error_buf);
+        goto fail;
+    }
+    mod->inst = wasm_runtime_instantiate(mod->module, WAMR_STACK_SIZE, WAMR_HEAP_SIZE,
+                                         error_buf, sizeof(error_buf));
+    if (!mod->inst) {
+        snprintf(err, err_len, "instantiate failed: %s", error_buf);
+        goto fail;
+    }
+    mod->env = wasm_runtime_create_exec_env(mod->inst, WAMR_STACK_SIZE);
+    if (!mod->env) {
+        snprintf(err, err_len, "create_exec_env failed");
+        goto fail;
+    }
+    return mod;
+
+fail:
+    wamr_unload(mod);
+    return NULL;
+}
+
+static bench_func_t *wamr_lookup(bench_module_t *mod, const char *name)
+{
+    return (bench_func_t *)wasm_runtime_lookup_function(mod->inst, name);
+}
+
+static bool wamr_call(bench_module_t *mod, bench_func_t *func,
+                      uint32_t argc, const uint32_t *argv, uint32_t *ret,
+                      char *err, size_t err_len)
+{
+    uint32_t cells[BENCH_MAX_ARGS];   /* argomenti in ingresso, risultato in uscita */
+    memcpy(cells, argv, argc * sizeof(uint32_t));
+
+    if (!wasm_runtime_call_wasm(mod->env, (wasm_function_inst_t)func, argc, cells)) {
+        const char *exc = wasm_runtime_get_exception(mod->inst);
+        snprintf(err, err_len, "%s", exc ? exc : "call failed");
+        wasm_runtime_clear_exception(mod->inst);
+        return false;
+    }
+    if (ret && wasm_func_get_result_count((wasm_function_inst_t)func, mod->inst) > 0) {
+        *ret = cells[0];
+    }
+    return true;
+}
+
+/* pagine della memoria lineare di default (compreso l'heap dell'app) */
+static uint64_t linear_memory_bytes(wasm_module_inst_t inst)
+{
+    wasm_memory_inst_t mem = wasm_runtime_get_default_memory(inst);
+    if (!mem) return 0;
+    return wasm_memory_get_cur_page_count(mem) * wasm_memory_get_bytes_per_page(mem);
+}
+
+/*
+ * load: parse + validazione (+ preparazione del codice per fast-interp,
+ * rilocazione per AOT, compilazione per LLVM JIT). La memoria lineare, che
+ * WAMR mappa fuori dall'allocatore, è sommata all'heap da instantiate in
+ * poi, come per wasm3 che la alloca con m3_Malloc.
+ */
+static bool wamr_startup(const char *path, const char *func,
+                         uint32_t argc, const uint32_t *argv,
+                         bench_phase_t *phases, uint32_t *num_phases,
+                         char *err, size_t err_len)
+{
+    char error_buf[128];
+    uint32_t size = 0, n = 0;
+    uint32_t cells[BENCH_MAX_ARGS];
+    wasm_module_t module = NULL;
+    wasm_module_inst_t inst = NULL;
+    wasm_exec_env_t env = NULL;
+    uint64_t linear = 0;
+    bool ok = false;
+
+    /* il loader modifica il buffer: una copia nuova a ogni avvio */
+    uint8_t *buf = read_file(path, &size, err, err_len);
+    if (!buf) return false;
+    bench_phase_base = bench_heap_live;
+
+    bench_phase_begin(&phases[n], "load", true);
+    module = wasm_runtime_load(buf, size, error_buf, sizeof(error_buf));
+    bench_phase_end(&phases[n++]);
+    if (!module) {
+        snprintf(err, err_len, "load failed: %s", error_buf);
+        goto out;
+    }
+
+    bench_phase_begin(&phases[n], "instantiate", true);
+    inst = wasm_runtime_instantiate(module, WAMR_STACK_SIZE, WAMR_HEAP_SIZE,
+                                    error_buf, sizeof(error_buf));
+    if (inst) {
+        linear = linear_memory_bytes(inst);
+        bench_heap_add(linear);
+    }
+    bench_phase_end(&phases[n++]);
+    if (!inst) {
+        snprintf(err, err_len, "instantiate failed: %s", error_buf);
+        goto out;
+    }
+
+    bench_phase_begin(&phases[n], "exec_env", true);
+    env = wasm_runtime_create_exec_env(inst, WAMR_STACK_SIZE);
+    bench_phase_end(&phases[n++]);
+    if (!env) {
+        snprintf(err, err_len, "create_exec_env failed");
+        goto out;
+    }
+
+    if (func) {
+        bench_phase_begin(&phases[n], "first_call", true);
+        wasm_function_inst_t fn = wasm_runtime_lookup_function(inst, func);
+        memcpy(cells, argv, argc * sizeof(uint32_t));
+        bool called = fn && wasm_runtime_call_wasm(env, fn, argc, cells);
+        bench_phase_end(&phases[n++]);
+        if (!called) {
+            const char *exc = wasm_runtime_get_exception(inst);
+            snprintf(err, err_len, "%s: %s", func, fn ? (exc ? exc : "call failed") : "not found");
+            goto out;
+        }
+    }
+    ok = true;
+
+out:
+    if (env) wasm_runtime_destroy_exec_env(env);
+    if (inst) {
+        bench_heap_sub(linear);
+        wasm_runtime_deinstantiate(inst);
+    }
+    if (module) wasm_runtime_unload(module);
+    free(buf);
+    *num_phases = n;
+    return ok;
+}
+
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+static void wamr_profile_reset(void)
+{
+    wasm_runtime_reset_opcode_counters();
+}
+
+/* nomi di DEFINE_GOTO_TABLE (wasm_opcode.h), opcode interni compresi */
+static uint64_t wamr_profile_dump(bench_profile_cb cb, void *ctx)
+{
+    return wasm_runtime_get_opcode_counters(cb, ctx);
+}
+#endif
+
+static const bench_runtime_t wamr_runtime = {
+    .abi_version   = BENCH_PLUGIN_ABI_VERSION,
+    .name          = BENCH_RUNTIME_NAME,
+    .module_suffix = BENCH_MODULE_SUFFIX,
+    .init          = wamr_init,
+    .deinit        = wamr_deinit,
+    .load          = wamr_load,
+    .unload        = wamr_unload,
+    .lookup        = wamr_lookup,
+    .call          = wamr_call,
+    .startup       = wamr_startup,
+    .instantiate   = wamr_instantiate,
+    .thread_init   = wamr_thread_init,
+    .thread_deinit = wamr_thread_deinit,
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+    .profile_reset = wamr_profile_reset,
+    .profile_dump  = wamr_profile_dump,
+#endif
+};
+
+BENCH_PLUGIN_EXPORT const bench_runtime_t *bench_plugin_runtime(void)
+{
+    return &wamr_runtime;
+}
@@ -0,0 +1,314 @@
+/*
+ * Plugin "wasm3": stessi sorgenti m3_*.c di linux/linux_wasm3_fft, compilati
+ * con d_m3HeapStats per i byte di --startup. Le varianti di
+ * LINUX_BENCH_WASM3_VARIANTS (wasm3-<nome>) cambiano solo le d_m3* e
+ * BENCH_RUNTIME_NAME, che arriva dal CMakeLists.txt; con
+ * d_m3EnableOpProfiling (wasm3-prof) il plugin espone i contatori delle
+ * operazioni a --opcode-profile.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wasm3.h"
+
+#include "bench_phase.h"
+#include "bench_plugin.h"
+#include "hostcall_wasm3.h"   /* import di hostcall_bench.wasm */
+
+#define WASM3_STACK_SIZE (64 * 1024)
+
+struct bench_module {
+    IM3Environment env;
+    IM3Runtime     rt;
+    uint8_t       *buf;   /* wasm3 referenzia il binario per tutta la vita del modulo */
+    uint32_t       size;
+    bool           shared;   /* env e buf appartengono all'istanza di base */
+};
+
+static uint8_t *read_file(const char *path, uint32_t *size, char *err, size_t err_len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        snprintf(err, err_len, "cannot open %s", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = (len > 0) ? malloc((size_t)len) : NULL;
+    if (!buf || fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        snprintf(err, err_len, "cannot read %s", path);
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = (uint32_t)len;
+    return buf;
+}
+
+static bool wasm3_init(char *err, size_t err_len)
+{
+    (void)err;
+    (void)err_len;
+    return true;
+}
+
+static void wasm3_deinit(void)
+{
+}
+
+static void wasm3_unload(bench_module_t *mod)
+{
+    if (!mod) return;
+    if (mod->rt) m3_FreeRuntime(mod->rt);
+    if (!mod->shared) {
+        if (mod->env) m3_FreeEnvironment(mod->env);
+        free(mod->buf);
+    }
+    free(mod);
+}
+
+/* runtime e modulo nell'environment di mod, dal binario mod->buf */
+static bool wasm3_new_runtime(bench_module_t *mod, char *err, size_t err_len)
+{
+    M3Result r;
+    IM3Module m3mod = NULL;
+
+    mod->rt = m3_NewRuntime(mod->env, WASM3_STACK_SIZE, NULL);
+    if (!mod->rt) {
+        snprintf(err, err_len, "m3_NewRuntime: OOM");
+        return false;
+    }
+    r = m3_ParseModule(mod->env, &m3mod, mod->buf, mod->size);
+    if (r) {
+        snprintf(err, err_len, "m3_ParseModule: %s", r);
+        return false;
+    }
+    r = m3_LoadModule(mod->rt, m3mod);
+    if (r) {
+        snprintf(err, err_len, "m3_LoadModule: %s", r);
+        m3_FreeModule(m3mod);
+        return false;
+    }
+    r = hostcall_link_wasm3(m3mod);
+    if (r) {
+        snprintf(err, err_len, "m3_LinkRawFunction: %s", r);
+        return false;
+    }
+    return true;
+}
+
+static bench_module_t *wasm3_load(const char *path, char *err, size_t err_len)
+{
+    bench_module_t *mod = calloc(1, sizeof(*mod));
+    if (!mod) {
+        snprintf(err, err_len, "out of memory");
+        return NULL;
+    }
+
+    mod->buf = read_file(path, &mod->size, err, err_len);
+    if (!mod->buf) goto fail;
+
+    mod->env = m3_NewEnvironment();
+    if (!mod->env) {
+        snprintf(err, err_len, "m3_NewEnvironment: OOM");
+        goto fail;
+    }
+    if (!wasm3_new_runtime(mod, err, err_len)) goto fail;
+    return mod;
+
+fail:
+    wasm3_unload(mod);
+    return NULL;
+}
+
+/*
+ * --threads, modulo condiviso: un IM3Module vive in un solo runtime, quindi
+ * si condividono l'environment (tipi e pool delle code page) e il binario,
+ * e ogni istanza riparsa il modulo nel proprio runtime.
+ */
+static bench_module_t *wasm3_instantiate(bench_module_t *base, char *err, size_t err_len)
+{
+    bench_module_t *mod = calloc(1, sizeof(*mod));
+    if (!mod) {
+        snprintf(err, err_len, "out of memory");
+        return NULL;
+    }
+
+    mod->env = base->env;
+    mod->buf = base->buf;
+    mod->size = base->size;
+    mod->shared = true;
+    if (!wasm3_new_runtime(mod, err, err_len)) {
+        wasm3_unload(mod);
+        return NULL;
+    }
+    return mod;
+}
+
+static bench_func_t *wasm3_lookup(bench_module_t *mod, const char *name)
+{
+    IM3Function fn = NULL;
+    /* m3_FindFunction compila la funzione (lazy): resta fuori dalla misura */
+    if (m3_FindFunction(&fn, mod->rt, name) != m3Err_none) {
+        return NULL;
+    }
+    return (bench_func_t *)fn;
+}
+
+static bool wasm3_call(bench_module_t *mod, bench_func_t *func,
+                       uint32_t argc, const uint32_t *argv, uint32_t *ret,
+                       char *err, size_t err_len)
+{
+    (void)mod;
+    const void *argptrs[BENCH_MAX_ARGS];
+    for (uint32_t i = 0; i < argc && i < BENCH_MAX_ARGS; i++) {
+        argptrs[i] = &argv[i];
+    }
+    M3Result r = m3_Call((IM3Function)func, argc, argptrs);
+    if (r) {
+        snprintf(err, err_len, "%s", r);
+        return false;
+    }
+    if (ret && m3_GetRetCount((IM3Function)func) > 0) {
+        const void *retptrs[1] = { ret };
+        r = m3_GetResults((IM3Function)func, 1, retptrs);
+        if (r) {
+            snprintf(err, err_len, "%s", r);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* contatori di m3_Malloc -> bench_phase.h */
+static void heap_sync(void)
+{
+    size_t live, peak;
+    m3_GetHeapStats(&live, &peak);
+    bench_heap_live = live;
+    bench_heap_peak = peak;
+}
+
+#define PHASE_BEGIN(name) \
+    do { m3_ResetHeapPeak(); heap_sync(); bench_phase_begin(&phases[n], (name), true); } while (0)
+#define PHASE_END() \
+    do { heap_sync(); bench_phase_end(&phases[n++]); } while (0)
+
+/*
+ * runtime: m3_NewEnvironment + m3_NewRuntime (stack dell'interprete);
+ * parse: decodifica delle sezioni; load: memoria, globali e dati;
+ * compile: m3_FindFunction compila func; first_call: la chiamata, che
+ * compila a sua volta (lazy) le funzioni raggiunte.
+ */
+static bool wasm3_startup(const char *path, const char *func,
+                          uint32_t argc, const uint32_t *argv,
+                          bench_phase_t *phases, uint32_t *num_phases,
+                          char *err, size_t err_len)
+{
+    M3Result r = m3Err_none;
+    IM3Environment env = NULL;
+    IM3Runtime rt = NULL;
+    IM3Module m3mod = NULL;
+    IM3Function fn = NULL;
+    const void *argptrs[BENCH_MAX_ARGS];
+    uint32_t size = 0, n = 0;
+    bool ok = false;
+
+    uint8_t *buf = read_file(path, &size, err, err_len);
+    if (!buf) return false;
+    heap_sync();
+    bench_phase_base = bench_heap_live;
+
+    PHASE_BEGIN("runtime");
+    env = m3_NewEnvironment();
+    rt = env ? m3_NewRuntime(env, WASM3_STACK_SIZE, NULL) : NULL;
+    PHASE_END();
+    if (!rt) {
+        snprintf(err, err_len, "m3_NewRuntime: OOM");
+        goto out;
+    }
+
+    PHASE_BEGIN("parse");
+    r = m3_ParseModule(env, &m3mod, buf, size);
+    PHASE_END();
+    if (r) {
+        snprintf(err, err_len, "m3_ParseModule: %s", r);
+        goto out;
+    }
+
+    PHASE_BEGIN("load");
+    r = m3_LoadModule(rt, m3mod);
+    PHASE_END();
+    if (r) {
+        snprintf(err, err_len, "m3_LoadModule: %s", r);
+        m3_FreeModule(m3mod);
+        goto out;
+    }
+
+    if (func) {
+        PHASE_BEGIN("compile");
+        r = m3_FindFunction(&fn, rt, func);
+        PHASE_END();
+        if (r) {
+            snprintf(err, err_len, "%s: %s", func, r);
+            goto out;
+        }
+
+        for (uint32_t i = 0; i < argc && i < BENCH_MAX_ARGS; i++) {
+            argptrs[i] = &argv[i];
+        }
+        PHASE_BEGIN("first_call");
+        r = m3_Call(fn, argc, argptrs);
+        PHASE_END();
+        if (r) {
+            snprintf(err, err_len, "%s: %s", func, r);
+            goto out;
+        }
+    }
+    ok = true;
+
+out:
+    if (rt) m3_FreeRuntime(rt);
+    if (env) m3_FreeEnvironment(env);
+    free(buf);
+    *num_phases = n;
+    return ok;
+}
+
+#if d_m3EnableOpProfiling
+static void wasm3_profile_reset(void)
+{
+    m3_ResetProfilerInfo();
+}
+
+/* nomi delle funzioni op_* di m3_exec.h */
+static uint64_t wasm3_profile_dump(bench_profile_cb cb, void *ctx)
+{
+    return m3_ForEachProfilerCount(cb, ctx);
+}
+#endif
+
+static const bench_runtime_t wasm3_runtime = {
+    .abi_version   = BENCH_PLUGIN_ABI_VERSION,
+    .name          = BENCH_RUNTIME_NAME,
+    .module_suffix = ".wasm",
+    .init          = wasm3_init,
+    .deinit        = wasm3_deinit,
+    .load          = wasm3_load,
+    .unload        = wasm3_unload,
+    .lookup        = wasm3_lookup,
+    .call          = wasm3_call,
+    .startup       = wasm3_startup,
+    .instantiate   = wasm3_instantiate,
+#if d_m3EnableOpProfiling
+    .profile_reset = wasm3_profile_reset,
+    .profile_dump  = wasm3_profile_dump,
+#endif
+};
+
+BENCH_PLUGIN_EXPORT const bench_runtime_t *bench_plugin_runtime(void)
+{
+    return &wasm3_runtime;
+}
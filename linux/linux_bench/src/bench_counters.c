@@ -0,0 +1,141 @@
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "bench_counters.h"
+
+typedef struct {
+    uint32_t type;
+    uint64_t config;
+} counter_desc_t;
+
+#define HW_CACHE(cache, op, result) \
+    ((uint64_t)(cache) | ((uint64_t)(op) << 8) | ((uint64_t)(result) << 16))
+
+static const counter_desc_t counter_desc[BENCH_CTR_COUNT] = {
+    [BENCH_CTR_CYCLES]        = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    [BENCH_CTR_INSTRUCTIONS]  = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    [BENCH_CTR_BRANCH_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    [BENCH_CTR_L1D_MISSES]    = { PERF_TYPE_HW_CACHE,
+                                  HW_CACHE(PERF_COUNT_HW_CACHE_L1D,
+                                           PERF_COUNT_HW_CACHE_OP_READ,
+                                           PERF_COUNT_HW_CACHE_RESULT_MISS) },
+    [BENCH_CTR_LLC_MISSES]    = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+};
+
+struct read_format {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+};
+
+static int perf_open(const counter_desc_t *d)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = d->type;
+    attr.config         = d->config;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;   /* basta perf_event_paranoid <= 2 */
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    /* eventi separati (non un gruppo): se la PMU non ne ha abbastanza il
+     * kernel li multiplexa e il valore viene riscalato in lettura */
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static uint64_t fallback_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int aux;
+    return __rdtscp(&aux);
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return 0;
+#endif
+}
+
+void bench_counters_open(bench_counters_t *c)
+{
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        c->fd[i] = perf_open(&counter_desc[i]);
+    }
+
+    if (c->fd[BENCH_CTR_CYCLES] >= 0) {
+        c->cycles_source = "perf";
+    } else {
+#if defined(__x86_64__) || defined(__i386__)
+        c->cycles_source = "tsc";
+#elif defined(__aarch64__)
+        c->cycles_source = "cntvct";
+#else
+        c->cycles_source = "none";
+#endif
+    }
+}
+
+void bench_counters_close(bench_counters_t *c)
+{
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        if (c->fd[i] >= 0) {
+            close(c->fd[i]);
+            c->fd[i] = -1;
+        }
+    }
+}
+
+void bench_counters_start(bench_counters_t *c)
+{
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        if (c->fd[i] >= 0) {
+            ioctl(c->fd[i], PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        if (c->fd[i] >= 0) {
+            ioctl(c->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    c->fallback_start = fallback_now();
+}
+
+void bench_counters_stop(bench_counters_t *c, bench_sample_t *out)
+{
+    uint64_t fallback_end = fallback_now();
+
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        if (c->fd[i] >= 0) {
+            ioctl(c->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    memset(out, 0, sizeof(*out));
+    for (int i = 0; i < BENCH_CTR_COUNT; i++) {
+        struct read_format rf;
+        if (c->fd[i] < 0 || read(c->fd[i], &rf, sizeof(rf)) != (ssize_t)sizeof(rf)
+            || rf.time_running == 0) {
+            continue;
+        }
+        out->value[i] = rf.value;
+        if (rf.time_running < rf.time_enabled) {
+            out->value[i] = (uint64_t)((double)rf.value * rf.time_enabled / rf.time_running);
+        }
+        out->valid[i] = true;
+    }
+
+    if (c->fd[BENCH_CTR_CYCLES] < 0 && strcmp(c->cycles_source, "none") != 0) {
+        out->value[BENCH_CTR_CYCLES] = fallback_end - c->fallback_start;
+        out->valid[BENCH_CTR_CYCLES] = true;
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef BENCH_COUNTERS_H
+#define BENCH_COUNTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Contatori hardware per linux_bench: perf_event_open (solo user space) per
+ * cicli, istruzioni, branch miss, miss L1D e LLC. Se la PMU non è
+ * accessibile (VM, perf_event_paranoid) i cicli ripiegano sul contatore
+ * di sistema: TSC su x86 (cicli di riferimento a frequenza costante) o
+ * CNTVCT su AArch64 (timer generico, non cicli di core). La sorgente è
+ * sempre riportata in output insieme al valore.
+ */
+
+typedef enum {
+    BENCH_CTR_CYCLES = 0,
+    BENCH_CTR_INSTRUCTIONS,
+    BENCH_CTR_BRANCH_MISSES,
+    BENCH_CTR_L1D_MISSES,
+    BENCH_CTR_LLC_MISSES,
+    BENCH_CTR_COUNT
+} bench_counter_id_t;
+
+typedef struct {
+    uint64_t value[BENCH_CTR_COUNT];
+    bool     valid[BENCH_CTR_COUNT];
+} bench_sample_t;
+
+typedef struct {
+    int         fd[BENCH_CTR_COUNT];    /* -1 se l'evento non è disponibile */
+    const char *cycles_source;          /* "perf", "tsc", "cntvct", "none" */
+    uint64_t    fallback_start;
+} bench_counters_t;
+
+/* apre tutti gli eventi disponibili; non fallisce mai (al peggio "none") */
+void bench_counters_open(bench_counters_t *c);
+void bench_counters_close(bench_counters_t *c);
+
+void bench_counters_start(bench_counters_t *c);
+void bench_counters_stop(bench_counters_t *c, bench_sample_t *out);
+
+#endif /* BENCH_COUNTERS_H */
@@ -0,0 +1,53 @@
+#ifndef BENCH_PHASE_H
+#define BENCH_PHASE_H
+
+#include <stdint.h>
+#include <time.h>
+
+#include "bench_plugin.h"
+
+/*
+ * Misura delle fasi di --startup, lato plugin. Il plugin aggiorna
+ * bench_heap_live/bench_heap_peak dal proprio allocatore (o li copia dai
+ * contatori del runtime) e racchiude ogni fase tra begin ed end; i byte
+ * riportati sono relativi a bench_phase_base, fissato prima della prima fase.
+ */
+
+static uint64_t bench_heap_live;
+static uint64_t bench_heap_peak;
+static uint64_t bench_phase_base;
+
+static inline uint64_t bench_phase_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline void bench_heap_add(uint64_t n)
+{
+    bench_heap_live += n;
+    if (bench_heap_live > bench_heap_peak) bench_heap_peak = bench_heap_live;
+}
+
+static inline void bench_heap_sub(uint64_t n)
+{
+    bench_heap_live -= n;
+}
+
+static inline void bench_phase_begin(bench_phase_t *ph, const char *name, bool has_heap)
+{
+    ph->name = name;
+    ph->has_heap = has_heap;
+    bench_heap_peak = bench_heap_live;
+    ph->ns = bench_phase_ns();
+}
+
+static inline void bench_phase_end(bench_phase_t *ph)
+{
+    ph->ns = bench_phase_ns() - ph->ns;
+    ph->peak_bytes = ph->has_heap ? bench_heap_peak - bench_phase_base : 0;
+    ph->live_bytes = ph->has_heap ? bench_heap_live - bench_phase_base : 0;
+}
+
+#endif /* BENCH_PHASE_H */
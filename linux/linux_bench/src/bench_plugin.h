@@ -0,0 +1,98 @@
+#ifndef BENCH_PLUGIN_H
+#define BENCH_PLUGIN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Interfaccia dei plugin runtime di linux_bench. Ogni plugin è una shared
+ * library bench_<nome>.so che esporta BENCH_PLUGIN_ENTRY; il driver la apre
+ * con dlopen(RTLD_LOCAL), quindi più copie di WAMR con configurazioni
+ * diverse convivono nello stesso processo.
+ *
+ * Convenzione dei kernel: un modulo esporta <kernel>_init([size]),
+ * <kernel>_bench(iterations) e, opzionale, <kernel>_checksum() -> i32.
+ * Argomenti e risultati sono tutti i32.
+ *
+ * Con --threads il driver usa un'istanza per thread: load, lookup, call e
+ * unload di istanze diverse possono girare in parallelo; load/instantiate/
+ * unload e la prima chiamata sono serializzati dal driver.
+ */
+
+#define BENCH_PLUGIN_ABI_VERSION 5
+#define BENCH_PLUGIN_ENTRY       "bench_plugin_runtime"
+#define BENCH_MAX_ARGS           4
+#define BENCH_MAX_PHASES         8
+
+#define BENCH_PLUGIN_EXPORT __attribute__((visibility("default")))
+
+typedef struct bench_module bench_module_t;   /* opaco, definito dal plugin */
+typedef struct bench_func   bench_func_t;
+
+/* una fase dell'avvio di un modulo (--startup) */
+typedef struct {
+    const char *name;         /* "parse", "load", "instantiate", "first_call", ... */
+    uint64_t    ns;
+    bool        has_heap;     /* false: il plugin non vede l'allocatore (native) */
+    uint64_t    peak_bytes;   /* picco dell'heap del runtime durante la fase, */
+    uint64_t    live_bytes;   /* e allocato a fine fase, oltre a quanto c'era prima */
+} bench_phase_t;
+
+/* --opcode-profile: un'operazione dell'interprete (next NULL) o una coppia di
+ * operazioni eseguite una dopo l'altra, con il numero di esecuzioni */
+typedef void (*bench_profile_cb)(void *ctx, const char *op, const char *next, uint64_t count);
+
+typedef struct {
+    uint32_t    abi_version;
+    const char *name;            /* es. "wamr-aot", usato in output */
+    const char *module_suffix;   /* ".wasm", ".aot", ".so" */
+
+    bool            (*init)(char *err, size_t err_len);
+    void            (*deinit)(void);
+
+    /* legge il modulo da file e lo istanzia */
+    bench_module_t *(*load)(const char *path, char *err, size_t err_len);
+    void            (*unload)(bench_module_t *mod);
+
+    /* NULL se la funzione non è esportata */
+    bench_func_t   *(*lookup)(bench_module_t *mod, const char *name);
+    /* ret (può essere NULL) riceve il risultato i32, se la funzione ne ha */
+    bool            (*call)(bench_module_t *mod, bench_func_t *func,
+                            uint32_t argc, const uint32_t *argv, uint32_t *ret,
+                            char *err, size_t err_len);
+
+    /*
+     * Avvio a fasi: legge path (fuori misura), lo carica, lo istanzia e, se
+     * func non è NULL, chiama func(argv) una volta; poi libera tutto. Le fasi
+     * dipendono dal runtime e vanno in phases[0..*num_phases).
+     */
+    bool            (*startup)(const char *path, const char *func,
+                               uint32_t argc, const uint32_t *argv,
+                               bench_phase_t *phases, uint32_t *num_phases,
+                               char *err, size_t err_len);
+
+    /*
+     * --threads (tutti opzionali, NULL se non servono). instantiate crea
+     * un'altra istanza del modulo già caricato in base, che resta di base:
+     * va liberata con unload prima di base. thread_init/thread_deinit
+     * racchiudono l'uso del runtime nei thread creati dal driver.
+     */
+    bench_module_t *(*instantiate)(bench_module_t *base, char *err, size_t err_len);
+    bool            (*thread_init)(char *err, size_t err_len);
+    void            (*thread_deinit)(void);
+
+    /*
+     * --opcode-profile (opzionali, NULL se il plugin non è una build di
+     * profiling): profile_reset azzera i contatori dell'interprete,
+     * profile_dump passa a cb ogni operazione e poi ogni coppia contate da
+     * allora e restituisce le esecuzioni rimaste fuori dalle tabelle.
+     * I contatori sono globali al processo, non per istanza.
+     */
+    void            (*profile_reset)(void);
+    uint64_t        (*profile_dump)(bench_profile_cb cb, void *ctx);
+} bench_runtime_t;
+
+typedef const bench_runtime_t *(*bench_plugin_entry_fn)(void);
+
+#endif /* BENCH_PLUGIN_H */
@@ -0,0 +1,1529 @@
+/*
+ * linux_bench: un solo driver per tutti i runtime (native, wasm3, WAMR in
+ * ogni modalità). I runtime sono plugin caricati con dlopen, i moduli sono
+ * letti da file e ogni (runtime, kernel, size) produce una riga CSV o JSON.
+ * Cicli, IPC e miss per iterazione vengono da bench_counters (perf_event_open,
+ * con fallback su TSC/CNTVCT): niente conversione ns -> cicli con una
+ * frequenza fissa.
+ *
+ * Ogni riga è il risultato di --warmup round scartati e --reps round misurati
+ * (ciascuno <kernel>_bench(--iters)) con il processo fissato su una CPU:
+ * ns_per_iter è la mediana, con MAD, minimo, CI al 95% e CV (bench_stats.h).
+ * Se il CV supera --max-cv la riga viene emessa comunque ma il run fallisce.
+ * Se il modulo esporta <kernel>_checksum, il suo valore a fine misura va in
+ * output: a parità di parametri deve coincidere su tutti i runtime.
+ *
+ * --hostcall misura il costo di una chiamata wasm -> host: hostcall_bench
+ * (wasm/hostcall) fa una chiamata a un import no-op per iterazione, quindi
+ * ns_per_iter e cycles_per_iter sono per chiamata.
+ *
+ * --suites esegue CoreMark, Dhrystone e i kernel PolyBench di suites_bench
+ * (wasm/suites: le suite di tests/benchmarks di WAMR con l'interfaccia dei
+ * kernel), su tutti i runtime come gli altri moduli.
+ *
+ * Con --startup niente kernel: per ogni modulo si misurano le fasi di avvio
+ * (load, instantiate, prima chiamata, ... secondo il runtime), una riga per
+ * fase più "total", con il picco di heap del runtime in ogni fase.
+ *
+ * --format results scrive le stesse righe come record dello schema di
+ * bench_results.py (JSON Lines con SHA git, compilatore e flag della
+ * build), da confrontare con bench_compare.py.
+ *
+ * --opcode-profile FILE scrive in FILE, per ogni riga, le esecuzioni di
+ * ogni operazione dell'interprete e di ogni coppia di operazioni
+ * consecutive nei round misurati (JSON Lines, bench_opprof.py). Servono i
+ * plugin di profiling (-DLINUX_BENCH_OPCODE_PROFILE=ON: wasm3-prof,
+ * wamr-interp-prof, wamr-fast-interp-prof), che sono anche il default di
+ * --runtime; i loro tempi valgono solo tra di loro.
+ *
+ * Con --threads 1,2,4,... ogni kernel gira su N thread, ciascuno con la
+ * propria istanza: modulo caricato da ogni thread (per-thread) o istanze
+ * di un solo modulo (shared, --sharing). Una riga per (runtime, kernel,
+ * size, sharing, N) con throughput, speedup rispetto a N = 1 e latenza per
+ * iterazione dei singoli thread: espone le contese globali del runtime
+ * (exception_lock di WAMR, allocatore, environment di wasm3).
+ *
+ *   linux_bench [--runtime native,wasm3,...] [--kernel modulo:kernel[@size,...]]
+ *               [--suite] [--simd] [--hostcall] [--suites] [--startup]
+ *               [--startup-module modulo[:func(args)]]
+ *               [--threads N,N,...] [--sharing per-thread|shared|both]
+ *               [--iters N] [--warmup N] [--reps N] [--max-cv PCT] [--cpu N|none]
+ *               [--format csv|json|results] [--out FILE] [--opcode-profile FILE]
+ *               [--plugin-dir DIR] [--module-dir DIR] [--list]
+ */
+#include <dlfcn.h>
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <libgen.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <sys/stat.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench_build_info.h"   /* generato: BENCH_GIT_SHA, BENCH_COMPILER, BENCH_C_FLAGS */
+#include "bench_counters.h"
+#include "bench_plugin.h"
+#include "bench_stats.h"
+#include "fft_bench.h"       /* wasm/fft: FFT_VARIANT_NAMES */
+#include "hostcall_bench.h"  /* wasm/hostcall: HOSTCALL_SUITE_NAMES */
+#include "kernels_bench.h"   /* wasm/kernels: KERNELS_SUITE_NAMES */
+#include "suites_bench.h"    /* wasm/suites: SUITES_NAMES */
+
+#define MAX_RUNTIMES 16
+#define MAX_KERNELS  48
+#define MAX_SIZES    16
+#define MAX_REPS     1000
+#define MAX_STARTUP  16
+#define MAX_THREADS  64
+#define MAX_CPUS     256
+
+/* ordine di output quando --runtime non è dato: quelli non compilati si saltano */
+static const char *const default_runtimes[] = {
+    "native", "wasm3", "wamr-interp", "wamr-fast-interp", "wamr-aot",
+    "wamr-jit", "wamr-fast-jit", "wamr-multi-tier",
+};
+
+/* --opcode-profile senza --runtime: le build con i contatori */
+static const char *const default_profile_runtimes[] = {
+    "wasm3-prof", "wamr-interp-prof", "wamr-fast-interp-prof",
+};
+
+typedef struct {
+    char     module[64];
+    char     kernel[64];
+    uint32_t sizes[MAX_SIZES];
+    int      num_sizes;       /* 0: <kernel>_init() senza argomenti */
+} kernel_spec_t;
+
+/* modulo di --startup e funzione chiamata una volta dopo l'istanza */
+typedef struct {
+    char     module[64];
+    char     func[64];        /* vuoto: nessuna chiamata */
+    uint32_t argv[BENCH_MAX_ARGS];
+    uint32_t argc;
+} startup_spec_t;
+
+/* moduli di wasm/ in ordine di dimensione; i synth_* li genera wasm_gen.py */
+static const char *const default_startup[] = {
+    "toggle", "math_ops:add(1,2)", "fft_bench:fft_init",
+    "synth_4k:entry(1)", "synth_16k:entry(1)", "synth_64k:entry(1)", "synth_256k:entry(1)",
+};
+
+typedef enum { FORMAT_CSV = 0, FORMAT_JSON, FORMAT_RESULTS } out_format_t;
+
+#define RESULTS_SCHEMA 1   /* bench_results.py SCHEMA_VERSION */
+
+/* --sharing: quali varianti di --threads misurare */
+enum { SHARING_PER_THREAD = 1, SHARING_SHARED = 2 };
+
+typedef struct {
+    const char *runtimes[MAX_RUNTIMES];
+    int         num_runtimes;
+    bool        explicit_runtimes;
+    kernel_spec_t kernels[MAX_KERNELS];
+    int         num_kernels;
+    bool        startup;
+    startup_spec_t startups[MAX_STARTUP];
+    int         num_startups;
+    uint32_t    threads[MAX_THREADS];   /* --threads, crescenti; 0 voci: un thread */
+    int         num_threads;
+    unsigned    sharing;      /* SHARING_* */
+    int         cpus[MAX_CPUS];         /* CPU consentite all'avvio, per i thread */
+    int         num_cpus;
+    uint32_t    iters;
+    uint32_t    warmup;
+    uint32_t    reps;
+    double      max_cv;       /* percentuale; 0 disabilita il controllo */
+    int         cpu;          /* CPU fissata con sched_setaffinity, -1 nessuna */
+    out_format_t format;
+    FILE       *out;
+    FILE       *profile;      /* --opcode-profile, NULL se non richiesto */
+    char        plugin_dir[PATH_MAX];
+    char        module_dir[PATH_MAX];
+    char        machine[65];
+    char        date[32];     /* inizio del run, UTC ISO 8601 (--format results) */
+    bench_counters_t counters;
+} bench_config_t;
+
+typedef struct {
+    const char *runtime;
+    const char *kernel;
+    const char *module;
+    uint32_t    size;
+    uint32_t    iters;
+    uint32_t    reps;
+    uint64_t    load_ns;
+    uint64_t    init_ns;
+    uint64_t    total_ns;     /* somma dei round misurati */
+    bench_stats_t ns;         /* ns per round */
+    bench_sample_t ctr;       /* somma dei round misurati */
+    const char *cycles_source;
+    bool        has_checksum;
+    uint32_t    checksum;     /* <kernel>_checksum() dopo l'ultimo round */
+} bench_row_t;
+
+/* una misura di --threads */
+typedef struct {
+    const char *runtime;
+    const char *kernel;
+    const char *module;
+    const char *sharing;
+    uint32_t    size;
+    uint32_t    threads;
+    uint64_t    setup_ns;     /* il thread più lento: load/instantiate, init e warmup */
+    uint64_t    wall_ns;      /* dal via comune alla fine dell'ultimo thread */
+    double      iters_per_s;  /* tutti i thread */
+    double      speedup;      /* rispetto a threads = 1; 0 se non misurato */
+    bench_stats_t ns;         /* ns per round, round di tutti i thread */
+    uint64_t    worst_ns;     /* mediana del thread più lento */
+    bool        has_checksum;
+    uint32_t    checksum;     /* uguale in tutti i thread */
+} scaling_row_t;
+
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* snprintf che rifiuta l'output troncato: un percorso o un nome tagliato
+ * aprirebbe un altro file o cercherebbe un'altra funzione */
+static bool __attribute__((format(printf, 3, 4)))
+format_full(char *buf, size_t len, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, len, fmt, ap);
+    va_end(ap);
+    return n >= 0 && (size_t)n < len;
+}
+
+/* ------------------------ output ------------------------ */
+
+static void emit_header(const bench_config_t *cfg)
+{
+    if (cfg->format == FORMAT_CSV) {
+        fprintf(cfg->out, "runtime,kernel,module,size,iterations,reps,warmup,cpu,"
+                          "load_ns,init_ns,total_ns,ns_per_iter,"
+                          "ns_mad_per_iter,ns_min_per_iter,ns_mean_per_iter,ns_ci95_per_iter,"
+                          "cv_pct,outliers,"
+                          "cycles,cycles_per_iter,cycles_source,instructions,ipc,"
+                          "branch_misses_per_iter,l1d_misses_per_iter,llc_misses_per_iter,"
+                          "checksum\n");
+    }
+}
+
+/* stringa JSON con gli escape minimi (i flag possono contenere virgolette) */
+static void emit_json_str(FILE *out, const char *s)
+{
+    fputc('"', out);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', out);
+        fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+/*
+ * Inizio di un record di --format results. "wamr-aot" diventa runtime
+ * "wamr" e mode "aot"; native e wasm3 hanno una modalità sola.
+ */
+static void emit_result_head(const bench_config_t *cfg, const char *rt_name,
+                             const char *kernel, const char *module)
+{
+    const char *dash = strchr(rt_name, '-');
+    int rt_len = dash ? (int)(dash - rt_name) : (int)strlen(rt_name);
+    const char *mode = dash ? dash + 1 : strcmp(rt_name, "native") == 0 ? "native" : "interp";
+
+    fprintf(cfg->out, "{\"schema\":%d,\"source\":\"linux_bench\",\"date\":\"%s\","
+                      "\"git_sha\":\"%s\",\"target\":\"host-%s\",\"os\":\"linux\","
+                      "\"runtime\":\"%.*s\",\"mode\":\"%s\",\"compiler\":",
+            RESULTS_SCHEMA, cfg->date, BENCH_GIT_SHA, cfg->machine, rt_len, rt_name, mode);
+    emit_json_str(cfg->out, BENCH_COMPILER);
+    fputs(",\"flags\":", cfg->out);
+    emit_json_str(cfg->out, BENCH_C_FLAGS);
+    fprintf(cfg->out, ",\"kernel\":\"%s\",\"module\":\"%s\"", kernel, module);
+}
+
+/* statistiche per iterazione (div = iterazioni per round) */
+static void emit_result_stats(const bench_config_t *cfg, const bench_stats_t *st, double div)
+{
+    fprintf(cfg->out, ",\"stats\":{\"n\":%" PRIu32 ",\"median\":%.1f,\"mad\":%.1f,"
+                      "\"min\":%.1f,\"mean\":%.1f,\"stddev\":%.1f,\"ci95\":%.1f,"
+                      "\"cv_pct\":%.1f,\"outliers\":%" PRIu32 "}",
+            st->n, st->median / div, st->mad / div, st->min / div, st->mean / div,
+            st->stddev / div, st->ci95 / div, st->cv_permille / 10.0, st->outliers);
+}
+
+static void emit_result_row(const bench_config_t *cfg, const bench_row_t *r)
+{
+    emit_result_head(cfg, r->runtime, r->kernel, r->module);
+    if (r->size) {
+        fprintf(cfg->out, ",\"size\":%" PRIu32, r->size);
+    } else {
+        fputs(",\"size\":null", cfg->out);
+    }
+    fprintf(cfg->out, ",\"iterations\":%" PRIu32 ",\"unit\":\"ns\"", r->iters);
+    emit_result_stats(cfg, &r->ns, r->iters ? (double)r->iters : 1.0);
+    fputs(",\"memory\":{}", cfg->out);
+    if (r->has_checksum) {
+        fprintf(cfg->out, ",\"checksum\":\"0x%08" PRIx32 "\"", r->checksum);
+    } else {
+        fputs(",\"checksum\":null", cfg->out);
+    }
+    fprintf(cfg->out, ",\"extra\":{\"cpu\":%d,\"warmup\":%" PRIu32 ",\"load_ns\":%" PRIu64
+                      ",\"cycles_source\":\"%s\"",
+            cfg->cpu, cfg->warmup, r->load_ns, r->cycles_source);
+    if (r->ctr.valid[BENCH_CTR_CYCLES]) {
+        uint64_t n = (uint64_t)r->iters * r->reps;
+        fprintf(cfg->out, ",\"cycles_per_iter\":%.1f",
+                n ? (double)r->ctr.value[BENCH_CTR_CYCLES] / n : 0.0);
+    }
+    fputs("}}\n", cfg->out);
+    fflush(cfg->out);
+}
+
+/* contatore per iterazione; vuoto (CSV) o null (JSON) se non disponibile */
+static void emit_ctr(const bench_config_t *cfg, const char *key, const bench_row_t *r,
+                     bench_counter_id_t id, bool per_iter)
+{
+    bool json = (cfg->format == FORMAT_JSON);
+
+    if (json) {
+        fprintf(cfg->out, ",\"%s\":", key);
+    } else {
+        fputc(',', cfg->out);
+    }
+    if (!r->ctr.valid[id]) {
+        if (json) fputs("null", cfg->out);
+        return;
+    }
+    if (per_iter) {
+        uint64_t n = (uint64_t)r->iters * r->reps;
+        fprintf(cfg->out, "%.2f", n ? (double)r->ctr.value[id] / n : 0.0);
+    } else {
+        fprintf(cfg->out, "%" PRIu64, r->ctr.value[id]);
+    }
+}
+
+static void emit_row(const bench_config_t *cfg, const bench_row_t *r)
+{
+    double div = r->iters ? (double)r->iters : 1.0;
+    bool json = (cfg->format == FORMAT_JSON);
+    bool have_ipc = r->ctr.valid[BENCH_CTR_INSTRUCTIONS] && r->ctr.valid[BENCH_CTR_CYCLES]
+                    && strcmp(r->cycles_source, "perf") == 0
+                    && r->ctr.value[BENCH_CTR_CYCLES] > 0;
+
+    if (cfg->format == FORMAT_RESULTS) {
+        emit_result_row(cfg, r);
+        return;
+    }
+
+    if (!json) {
+        fprintf(cfg->out, "%s,%s,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%d"
+                          ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                          ",%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%" PRIu32,
+                r->runtime, r->kernel, r->module, r->size, r->iters, r->reps,
+                cfg->warmup, cfg->cpu, r->load_ns, r->init_ns, r->total_ns,
+                r->ns.median / div, r->ns.mad / div, r->ns.min / div,
+                r->ns.mean / div, r->ns.ci95 / div, r->ns.cv_permille / 10.0,
+                r->ns.outliers);
+    } else {
+        fprintf(cfg->out, "{\"runtime\":\"%s\",\"kernel\":\"%s\",\"module\":\"%s\","
+                          "\"size\":%" PRIu32 ",\"iterations\":%" PRIu32 ","
+                          "\"reps\":%" PRIu32 ",\"warmup\":%" PRIu32 ",\"cpu\":%d,"
+                          "\"load_ns\":%" PRIu64 ",\"init_ns\":%" PRIu64 ","
+                          "\"total_ns\":%" PRIu64 ",\"ns_per_iter\":%.1f,"
+                          "\"ns_mad_per_iter\":%.1f,\"ns_min_per_iter\":%.1f,"
+                          "\"ns_mean_per_iter\":%.1f,\"ns_ci95_per_iter\":%.1f,"
+                          "\"cv_pct\":%.1f,\"outliers\":%" PRIu32,
+                r->runtime, r->kernel, r->module, r->size, r->iters, r->reps,
+                cfg->warmup, cfg->cpu, r->load_ns, r->init_ns, r->total_ns,
+                r->ns.median / div, r->ns.mad / div, r->ns.min / div,
+                r->ns.mean / div, r->ns.ci95 / div, r->ns.cv_permille / 10.0,
+                r->ns.outliers);
+    }
+
+    emit_ctr(cfg, "cycles", r, BENCH_CTR_CYCLES, false);
+    emit_ctr(cfg, "cycles_per_iter", r, BENCH_CTR_CYCLES, true);
+    fprintf(cfg->out, json ? ",\"cycles_source\":\"%s\"" : ",%s", r->cycles_source);
+    emit_ctr(cfg, "instructions", r, BENCH_CTR_INSTRUCTIONS, false);
+    /* IPC solo con cicli di core veri (non TSC/CNTVCT) */
+    if (have_ipc) {
+        fprintf(cfg->out, json ? ",\"ipc\":%.3f" : ",%.3f",
+                (double)r->ctr.value[BENCH_CTR_INSTRUCTIONS] / r->ctr.value[BENCH_CTR_CYCLES]);
+    } else {
+        fputs(json ? ",\"ipc\":null" : ",", cfg->out);
+    }
+    emit_ctr(cfg, "branch_misses_per_iter", r, BENCH_CTR_BRANCH_MISSES, true);
+    emit_ctr(cfg, "l1d_misses_per_iter", r, BENCH_CTR_L1D_MISSES, true);
+    emit_ctr(cfg, "llc_misses_per_iter", r, BENCH_CTR_LLC_MISSES, true);
+    if (r->has_checksum) {
+        fprintf(cfg->out, json ? ",\"checksum\":\"0x%08" PRIx32 "\"" : ",0x%08" PRIx32, r->checksum);
+    } else {
+        fputs(json ? ",\"checksum\":null" : ",", cfg->out);
+    }
+
+    fputs(json ? "}\n" : "\n", cfg->out);
+    fflush(cfg->out);
+}
+
+static void emit_startup_header(const bench_config_t *cfg)
+{
+    if (cfg->format == FORMAT_CSV) {
+        fprintf(cfg->out, "runtime,module,module_bytes,phase,reps,warmup,cpu,"
+                          "ns,ns_mad,ns_min,ns_mean,ns_ci95,cv_pct,outliers,"
+                          "peak_bytes,live_bytes\n");
+    }
+}
+
+/* una fase (o "total"): tempi sulle ripetizioni, byte dell'ultima */
+static void emit_startup_row(const bench_config_t *cfg, const char *runtime,
+                             const char *module, uint64_t module_bytes,
+                             const bench_phase_t *ph, const bench_stats_t *st)
+{
+    if (cfg->format == FORMAT_RESULTS) {
+        char kernel[80];
+        snprintf(kernel, sizeof(kernel), "startup:%s", ph->name);
+        emit_result_head(cfg, runtime, kernel, module);
+        fprintf(cfg->out, ",\"size\":null,\"iterations\":1,\"unit\":\"ns\"");
+        emit_result_stats(cfg, st, 1.0);
+        if (ph->has_heap) {
+            fprintf(cfg->out, ",\"memory\":{\"peak_bytes\":%" PRIu64 ",\"live_bytes\":%" PRIu64 "}",
+                    ph->peak_bytes, ph->live_bytes);
+        } else {
+            fputs(",\"memory\":{}", cfg->out);
+        }
+        fprintf(cfg->out, ",\"checksum\":null,\"extra\":{\"cpu\":%d,\"warmup\":%" PRIu32
+                          ",\"module_bytes\":%" PRIu64 "}}\n",
+                cfg->cpu, cfg->warmup, module_bytes);
+        fflush(cfg->out);
+        return;
+    }
+    if (cfg->format == FORMAT_CSV) {
+        fprintf(cfg->out, "%s,%s,%" PRIu64 ",%s,%" PRIu32 ",%" PRIu32 ",%d"
+                          ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                          ",%.1f,%" PRIu32,
+                runtime, module, module_bytes, ph->name, cfg->reps, cfg->warmup, cfg->cpu,
+                st->median, st->mad, st->min, st->mean, st->ci95,
+                st->cv_permille / 10.0, st->outliers);
+        if (ph->has_heap) {
+            fprintf(cfg->out, ",%" PRIu64 ",%" PRIu64 "\n", ph->peak_bytes, ph->live_bytes);
+        } else {
+            fputs(",,\n", cfg->out);
+        }
+    } else {
+        fprintf(cfg->out, "{\"runtime\":\"%s\",\"module\":\"%s\",\"module_bytes\":%" PRIu64 ","
+                          "\"phase\":\"%s\",\"reps\":%" PRIu32 ",\"warmup\":%" PRIu32 ",\"cpu\":%d,"
+                          "\"ns\":%" PRIu64 ",\"ns_mad\":%" PRIu64 ",\"ns_min\":%" PRIu64 ","
+                          "\"ns_mean\":%" PRIu64 ",\"ns_ci95\":%" PRIu64 ","
+                          "\"cv_pct\":%.1f,\"outliers\":%" PRIu32,
+                runtime, module, module_bytes, ph->name, cfg->reps, cfg->warmup, cfg->cpu,
+                st->median, st->mad, st->min, st->mean, st->ci95,
+                st->cv_permille / 10.0, st->outliers);
+        if (ph->has_heap) {
+            fprintf(cfg->out, ",\"peak_bytes\":%" PRIu64 ",\"live_bytes\":%" PRIu64 "}\n",
+                    ph->peak_bytes, ph->live_bytes);
+        } else {
+            fputs(",\"peak_bytes\":null,\"live_bytes\":null}\n", cfg->out);
+        }
+    }
+    fflush(cfg->out);
+}
+
+static void emit_scaling_header(const bench_config_t *cfg)
+{
+    if (cfg->format == FORMAT_CSV) {
+        fprintf(cfg->out, "runtime,kernel,module,size,sharing,threads,iterations,reps,warmup,"
+                          "setup_ns,wall_ns,iters_per_s,speedup,efficiency_pct,"
+                          "ns_per_iter,ns_mad_per_iter,ns_min_per_iter,ns_worst_thread_per_iter,"
+                          "cv_pct,outliers,checksum\n");
+    }
+}
+
+static void emit_scaling_row(const bench_config_t *cfg, const scaling_row_t *r)
+{
+    double div = cfg->iters ? (double)cfg->iters : 1.0;
+    bool json = (cfg->format == FORMAT_JSON);
+
+    if (!json) {
+        fprintf(cfg->out, "%s,%s,%s,%" PRIu32 ",%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+                          ",%" PRIu64 ",%" PRIu64 ",%.0f",
+                r->runtime, r->kernel, r->module, r->size, r->sharing, r->threads,
+                cfg->iters, cfg->reps, cfg->warmup, r->setup_ns, r->wall_ns, r->iters_per_s);
+        if (r->speedup > 0) {
+            fprintf(cfg->out, ",%.2f,%.1f", r->speedup, 100.0 * r->speedup / r->threads);
+        } else {
+            fputs(",,", cfg->out);
+        }
+        fprintf(cfg->out, ",%.1f,%.1f,%.1f,%.1f,%.1f,%" PRIu32,
+                r->ns.median / div, r->ns.mad / div, r->ns.min / div, r->worst_ns / div,
+                r->ns.cv_permille / 10.0, r->ns.outliers);
+    } else {
+        fprintf(cfg->out, "{\"runtime\":\"%s\",\"kernel\":\"%s\",\"module\":\"%s\","
+                          "\"size\":%" PRIu32 ",\"sharing\":\"%s\",\"threads\":%" PRIu32 ","
+                          "\"iterations\":%" PRIu32 ",\"reps\":%" PRIu32 ",\"warmup\":%" PRIu32 ","
+                          "\"setup_ns\":%" PRIu64 ",\"wall_ns\":%" PRIu64 ",\"iters_per_s\":%.0f",
+                r->runtime, r->kernel, r->module, r->size, r->sharing, r->threads,
+                cfg->iters, cfg->reps, cfg->warmup, r->setup_ns, r->wall_ns, r->iters_per_s);
+        if (r->speedup > 0) {
+            fprintf(cfg->out, ",\"speedup\":%.2f,\"efficiency_pct\":%.1f",
+                    r->speedup, 100.0 * r->speedup / r->threads);
+        } else {
+            fputs(",\"speedup\":null,\"efficiency_pct\":null", cfg->out);
+        }
+        fprintf(cfg->out, ",\"ns_per_iter\":%.1f,\"ns_mad_per_iter\":%.1f,"
+                          "\"ns_min_per_iter\":%.1f,\"ns_worst_thread_per_iter\":%.1f,"
+                          "\"cv_pct\":%.1f,\"outliers\":%" PRIu32,
+                r->ns.median / div, r->ns.mad / div, r->ns.min / div, r->worst_ns / div,
+                r->ns.cv_permille / 10.0, r->ns.outliers);
+    }
+    if (r->has_checksum) {
+        fprintf(cfg->out, json ? ",\"checksum\":\"0x%08" PRIx32 "\"" : ",0x%08" PRIx32, r->checksum);
+    } else {
+        fputs(json ? ",\"checksum\":null" : ",", cfg->out);
+    }
+    fputs(json ? "}\n" : "\n", cfg->out);
+    fflush(cfg->out);
+}
+
+/* stato di emit_profile: le operazioni arrivano prima delle coppie */
+typedef struct {
+    FILE    *out;
+    bool     pairs;
+    bool     first;
+    uint64_t total;
+} profile_ctx_t;
+
+static void profile_entry(void *arg, const char *op, const char *next, uint64_t count)
+{
+    profile_ctx_t *ctx = arg;
+
+    if (next && !ctx->pairs) {
+        fputs("},\"pairs\":{", ctx->out);
+        ctx->pairs = true;
+        ctx->first = true;
+    }
+    if (!ctx->first) {
+        fputc(',', ctx->out);
+    }
+    ctx->first = false;
+    if (next) {
+        fprintf(ctx->out, "\"%s %s\":%" PRIu64, op, next, count);
+    } else {
+        fprintf(ctx->out, "\"%s\":%" PRIu64, op, count);
+        ctx->total += count;
+    }
+}
+
+/*
+ * Un record di --opcode-profile: esecuzioni nei cfg->reps round misurati
+ * da cfg->iters iterazioni. "ops" per operazione, "pairs" per coppia
+ * "prima dopo", "dropped" le coppie rimaste fuori dalla tabella del plugin.
+ */
+static void emit_profile(const bench_config_t *cfg, const bench_runtime_t *rt,
+                         const bench_row_t *r)
+{
+    profile_ctx_t ctx = { .out = cfg->profile, .first = true };
+    FILE *out = cfg->profile;
+
+    fprintf(out, "{\"source\":\"linux_bench\",\"target\":\"host-%s\",\"runtime\":",
+            cfg->machine);
+    emit_json_str(out, r->runtime);
+    fputs(",\"kernel\":", out);
+    emit_json_str(out, r->kernel);
+    fputs(",\"module\":", out);
+    emit_json_str(out, r->module);
+    if (r->size) {
+        fprintf(out, ",\"size\":%" PRIu32, r->size);
+    } else {
+        fputs(",\"size\":null", out);
+    }
+    fprintf(out, ",\"iterations\":%" PRIu32 ",\"reps\":%" PRIu32 ",\"ops\":{",
+            r->iters, r->reps);
+    uint64_t dropped = rt->profile_dump(profile_entry, &ctx);
+    fprintf(out, "%s},\"total\":%" PRIu64 ",\"dropped\":%" PRIu64 "}\n",
+            ctx.pairs ? "" : "},\"pairs\":{", ctx.total, dropped);
+    fflush(out);
+}
+
+/* ------------------------ moduli ------------------------ */
+
+/* <dir>/<modulo>.<machine><suffix> (es. fft_bench.x86_64.aot), poi <dir>/<modulo><suffix> */
+static bool resolve_module(const bench_config_t *cfg, const char *module,
+                           const char *suffix, char *path, size_t path_len)
+{
+    if (format_full(path, path_len, "%s/%s.%s%s", cfg->module_dir, module, cfg->machine, suffix)
+        && access(path, R_OK) == 0) {
+        return true;
+    }
+    return format_full(path, path_len, "%s/%s%s", cfg->module_dir, module, suffix)
+        && access(path, R_OK) == 0;
+}
+
+/*
+ * cfg->warmup round a vuoto, poi cfg->reps round misurati: il tempo di ogni
+ * round va nelle statistiche, i contatori si sommano su tutti i round.
+ */
+static bool run_rounds(bench_config_t *cfg, const bench_runtime_t *rt,
+                       bench_module_t *mod, bench_func_t *f_bench,
+                       bench_row_t *row, char *err, size_t err_len)
+{
+    static uint64_t samples[MAX_REPS];
+    bench_counters_t *ctr = &cfg->counters;
+
+    for (uint32_t i = 0; i < cfg->warmup; i++) {
+        if (!rt->call(mod, f_bench, 1, &cfg->iters, NULL, err, err_len)) {
+            return false;
+        }
+    }
+    /* --opcode-profile: solo i round misurati */
+    if (cfg->profile && rt->profile_reset) {
+        rt->profile_reset();
+    }
+
+    for (int id = 0; id < BENCH_CTR_COUNT; id++) {
+        row->ctr.value[id] = 0;
+        row->ctr.valid[id] = true;
+    }
+    row->reps = cfg->reps;
+    row->cycles_source = ctr->cycles_source;
+
+    for (uint32_t i = 0; i < cfg->reps; i++) {
+        bench_sample_t s;
+
+        bench_counters_start(ctr);
+        uint64_t t0 = ns_now();
+        bool ok = rt->call(mod, f_bench, 1, &cfg->iters, NULL, err, err_len);
+        samples[i] = ns_now() - t0;
+        bench_counters_stop(ctr, &s);
+        if (!ok) {
+            return false;
+        }
+
+        row->total_ns += samples[i];
+        for (int id = 0; id < BENCH_CTR_COUNT; id++) {
+            row->ctr.value[id] += s.value[id];
+            row->ctr.valid[id] = row->ctr.valid[id] && s.valid[id];
+        }
+    }
+
+    bench_stats_compute(samples, cfg->reps, &row->ns);
+    return true;
+}
+
+static int run_module(bench_config_t *cfg, const bench_runtime_t *rt,
+                      const kernel_spec_t *ks)
+{
+    char path[PATH_MAX];
+    char err[256] = {0};
+    char fname[96];
+    int failures = 0;
+
+    if (!resolve_module(cfg, ks->module, rt->module_suffix, path, sizeof(path))) {
+        fprintf(stderr, "[%s] %s: nessun modulo %s%s in %s, salto\n", rt->name,
+                ks->kernel, ks->module, rt->module_suffix, cfg->module_dir);
+        return 0;
+    }
+
+    uint64_t t0 = ns_now();
+    bench_module_t *mod = rt->load(path, err, sizeof(err));
+    uint64_t load_ns = ns_now() - t0;
+    if (!mod) {
+        fprintf(stderr, "[%s] %s: load fallito: %s\n", rt->name, path, err);
+        return 1;
+    }
+
+    snprintf(fname, sizeof(fname), "%s_init", ks->kernel);
+    bench_func_t *f_init = rt->lookup(mod, fname);
+    snprintf(fname, sizeof(fname), "%s_bench", ks->kernel);
+    bench_func_t *f_bench = rt->lookup(mod, fname);
+    snprintf(fname, sizeof(fname), "%s_checksum", ks->kernel);
+    bench_func_t *f_checksum = rt->lookup(mod, fname);
+    if (!f_bench || (ks->num_sizes > 0 && !f_init)) {
+        fprintf(stderr, "[%s] %s: funzioni %s_init/%s_bench non trovate\n",
+                rt->name, path, ks->kernel, ks->kernel);
+        rt->unload(mod);
+        return 1;
+    }
+
+    /* una riga per size; senza size una sola riga con size=0 */
+    int rounds = ks->num_sizes > 0 ? ks->num_sizes : 1;
+    for (int i = 0; i < rounds; i++) {
+        bench_row_t row = {
+            .runtime = rt->name,
+            .kernel  = ks->kernel,
+            .module  = strrchr(path, '/') + 1,
+            .size    = ks->num_sizes > 0 ? ks->sizes[i] : 0,
+            .iters   = cfg->iters,
+            .load_ns = load_ns,
+        };
+
+        if (f_init) {
+            t0 = ns_now();
+            if (!rt->call(mod, f_init, ks->num_sizes > 0 ? 1 : 0, &row.size, NULL,
+                          err, sizeof(err))) {
+                fprintf(stderr, "[%s] %s_init: %s\n", rt->name, ks->kernel, err);
+                failures++;
+                continue;
+            }
+            row.init_ns = ns_now() - t0;
+        }
+
+        if (!run_rounds(cfg, rt, mod, f_bench, &row, err, sizeof(err))) {
+            fprintf(stderr, "[%s] %s_bench: %s\n", rt->name, ks->kernel, err);
+            failures++;
+            continue;
+        }
+        if (cfg->profile && rt->profile_dump) {
+            emit_profile(cfg, rt, &row);
+        }
+        if (f_checksum) {
+            row.has_checksum = rt->call(mod, f_checksum, 0, NULL, &row.checksum,
+                                        err, sizeof(err));
+        }
+
+        emit_row(cfg, &row);
+        if (cfg->max_cv > 0 && row.ns.cv_permille / 10.0 > cfg->max_cv) {
+            fprintf(stderr, "[%s] %s size=%" PRIu32 ": CV %.1f%% > %.1f%%, misura instabile\n",
+                    rt->name, ks->kernel, row.size, row.ns.cv_permille / 10.0, cfg->max_cv);
+            failures++;
+        }
+    }
+
+    rt->unload(mod);
+    return failures;
+}
+
+/*
+ * cfg->warmup avvii scartati e cfg->reps misurati, ognuno da zero (il plugin
+ * libera tutto): la prima riga del processo non paga cache fredde e page
+ * fault del plugin. --max-cv non si applica, l'avvio di moduli piccoli dura
+ * pochi microsecondi ed è rumoroso per natura.
+ */
+static int run_startup(bench_config_t *cfg, const bench_runtime_t *rt,
+                       const startup_spec_t *ss)
+{
+    static uint64_t samples[BENCH_MAX_PHASES + 1][MAX_REPS];
+    bench_phase_t phases[BENCH_MAX_PHASES];
+    uint32_t num_phases = 0, first_phases = 0;
+    char path[PATH_MAX];
+    char err[256] = {0};
+    struct stat sb;
+
+    if (!rt->startup) {
+        fprintf(stderr, "[%s] --startup non supportato dal plugin, salto\n", rt->name);
+        return 0;
+    }
+    if (!resolve_module(cfg, ss->module, rt->module_suffix, path, sizeof(path))) {
+        fprintf(stderr, "[%s] startup: nessun modulo %s%s in %s, salto\n", rt->name,
+                ss->module, rt->module_suffix, cfg->module_dir);
+        return 0;
+    }
+    uint64_t module_bytes = stat(path, &sb) == 0 ? (uint64_t)sb.st_size : 0;
+    const char *func = ss->func[0] ? ss->func : NULL;
+
+    for (uint32_t i = 0; i < cfg->warmup + cfg->reps; i++) {
+        if (!rt->startup(path, func, ss->argc, ss->argv, phases, &num_phases,
+                         err, sizeof(err))) {
+            fprintf(stderr, "[%s] startup %s: %s\n", rt->name, path, err);
+            return 1;
+        }
+        if (i == 0) {
+            first_phases = num_phases;
+        } else if (num_phases != first_phases) {
+            fprintf(stderr, "[%s] startup %s: numero di fasi variabile\n", rt->name, path);
+            return 1;
+        }
+        if (i < cfg->warmup) continue;
+
+        uint64_t sum = 0;
+        for (uint32_t p = 0; p < num_phases; p++) {
+            samples[p][i - cfg->warmup] = phases[p].ns;
+            sum += phases[p].ns;
+        }
+        samples[num_phases][i - cfg->warmup] = sum;
+    }
+
+    const char *module = strrchr(path, '/') + 1;
+    bench_phase_t total = { .name = "total", .has_heap = phases[0].has_heap };
+    bench_stats_t st;
+    for (uint32_t p = 0; p < num_phases; p++) {
+        bench_stats_compute(samples[p], cfg->reps, &st);
+        emit_startup_row(cfg, rt->name, module, module_bytes, &phases[p], &st);
+        if (phases[p].peak_bytes > total.peak_bytes) total.peak_bytes = phases[p].peak_bytes;
+        total.live_bytes = phases[p].live_bytes;
+    }
+    bench_stats_compute(samples[num_phases], cfg->reps, &st);
+    emit_startup_row(cfg, rt->name, module, module_bytes, &total, &st);
+    return 0;
+}
+
+/* ------------------------ --threads ------------------------ */
+
+/* stato comune ai thread di una misura */
+typedef struct {
+    const bench_config_t  *cfg;
+    const bench_runtime_t *rt;
+    const kernel_spec_t   *ks;
+    const char            *path;
+    bench_module_t        *base;      /* shared: istanze di questo modulo; NULL per-thread */
+    const uint32_t        *size;      /* argomento di <kernel>_init, NULL se senza size */
+    uint32_t               warmup;
+    pthread_mutex_t        lock;      /* serializza preparazione e chiusura */
+    pthread_barrier_t      start;     /* via comune ai round misurati */
+    pthread_barrier_t      stop;      /* nessuna chiusura mentre altri misurano */
+} scaling_run_t;
+
+typedef struct {
+    scaling_run_t *run;
+    uint64_t      *samples;           /* cfg->reps, ns per round */
+    uint64_t       setup_ns;
+    uint64_t       begin_ns;          /* primo e ultimo istante dei round misurati */
+    uint64_t       end_ns;
+    bool           ok;
+    bool           has_checksum;
+    uint32_t       checksum;
+    char           err[256];
+} scaling_thread_t;
+
+/*
+ * Istanza, lookup, init e warmup, sotto run->lock. Il warmup (almeno un
+ * round) tiene fuori dalla misura anche la compilazione lazy di wasm3, che
+ * prende le code page dall'environment condiviso.
+ */
+static bool scaling_setup(scaling_thread_t *t, bench_module_t **mod,
+                          bench_func_t **f_bench, bench_func_t **f_checksum)
+{
+    const scaling_run_t *run = t->run;
+    const bench_runtime_t *rt = run->rt;
+    const kernel_spec_t *ks = run->ks;
+    char fname[96];
+
+    *mod = run->base ? rt->instantiate(run->base, t->err, sizeof(t->err))
+                     : rt->load(run->path, t->err, sizeof(t->err));
+    if (!*mod) return false;
+
+    snprintf(fname, sizeof(fname), "%s_init", ks->kernel);
+    bench_func_t *f_init = rt->lookup(*mod, fname);
+    snprintf(fname, sizeof(fname), "%s_bench", ks->kernel);
+    *f_bench = rt->lookup(*mod, fname);
+    snprintf(fname, sizeof(fname), "%s_checksum", ks->kernel);
+    *f_checksum = rt->lookup(*mod, fname);
+    if (!*f_bench || (run->size && !f_init)) {
+        snprintf(t->err, sizeof(t->err), "funzioni %s_init/%s_bench non trovate",
+                 ks->kernel, ks->kernel);
+        return false;
+    }
+
+    if (f_init && !rt->call(*mod, f_init, run->size ? 1 : 0, run->size, NULL,
+                            t->err, sizeof(t->err))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < run->warmup; i++) {
+        if (!rt->call(*mod, *f_bench, 1, &run->cfg->iters, NULL, t->err, sizeof(t->err))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *scaling_thread(void *arg)
+{
+    scaling_thread_t *t = arg;
+    scaling_run_t *run = t->run;
+    const bench_runtime_t *rt = run->rt;
+    const bench_config_t *cfg = run->cfg;
+    bench_module_t *mod = NULL;
+    bench_func_t *f_bench = NULL, *f_checksum = NULL;
+
+    pthread_mutex_lock(&run->lock);
+    uint64_t t0 = ns_now();
+    bool thread_env = !rt->thread_init || rt->thread_init(t->err, sizeof(t->err));
+    t->ok = thread_env && scaling_setup(t, &mod, &f_bench, &f_checksum);
+    t->setup_ns = ns_now() - t0;
+    pthread_mutex_unlock(&run->lock);
+
+    /* anche dopo un errore: gli altri thread aspettano alle barriere */
+    pthread_barrier_wait(&run->start);
+    t->begin_ns = ns_now();
+    for (uint32_t i = 0; i < cfg->reps && t->ok; i++) {
+        t0 = ns_now();
+        t->ok = rt->call(mod, f_bench, 1, &cfg->iters, NULL, t->err, sizeof(t->err));
+        t->samples[i] = ns_now() - t0;
+    }
+    t->end_ns = ns_now();
+    pthread_barrier_wait(&run->stop);
+
+    pthread_mutex_lock(&run->lock);
+    if (t->ok && f_checksum) {
+        t->has_checksum = rt->call(mod, f_checksum, 0, NULL, &t->checksum,
+                                   t->err, sizeof(t->err));
+    }
+    if (mod) rt->unload(mod);
+    if (thread_env && rt->thread_deinit) rt->thread_deinit();
+    pthread_mutex_unlock(&run->lock);
+    return NULL;
+}
+
+/*
+ * n thread, fissati a rotazione sulle CPU consentite all'avvio. wall_ns va
+ * dal primo thread che parte dopo la barriera all'ultimo che finisce: il
+ * throughput conta anche i thread che la contesa rallenta. Gli istanti sono
+ * presi dai thread, il driver potrebbe non essere in esecuzione al via.
+ */
+static bool run_threads(const bench_config_t *cfg, scaling_run_t *run, uint32_t n,
+                        scaling_row_t *row)
+{
+    static scaling_thread_t th[MAX_THREADS];
+    pthread_t tid[MAX_THREADS];
+    bool ok = true;
+
+    uint64_t *samples = calloc((size_t)n * cfg->reps, sizeof(uint64_t));
+    if (!samples) {
+        fprintf(stderr, "[%s] %s: out of memory\n", run->rt->name, run->ks->kernel);
+        return false;
+    }
+    pthread_barrier_init(&run->start, NULL, n);
+    pthread_barrier_init(&run->stop, NULL, n);
+
+    for (uint32_t i = 0; i < n; i++) {
+        pthread_attr_t attr;
+        cpu_set_t set;
+
+        th[i] = (scaling_thread_t){ .run = run, .samples = samples + (size_t)i * cfg->reps };
+        pthread_attr_init(&attr);
+        if (cfg->num_cpus > 0) {
+            CPU_ZERO(&set);
+            CPU_SET(cfg->cpus[i % cfg->num_cpus], &set);
+            pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+        }
+        int rc = pthread_create(&tid[i], &attr, scaling_thread, &th[i]);
+        pthread_attr_destroy(&attr);
+        if (rc != 0) {
+            /* i thread già partiti restano fermi alla barriera: niente da recuperare */
+            fprintf(stderr, "pthread_create: %s\n", strerror(rc));
+            exit(1);
+        }
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    pthread_barrier_destroy(&run->start);
+    pthread_barrier_destroy(&run->stop);
+
+    uint64_t begin = UINT64_MAX, end = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        bench_stats_t st;
+
+        if (!th[i].ok) {
+            fprintf(stderr, "[%s] %s threads=%" PRIu32 ": thread %" PRIu32 ": %s\n",
+                    run->rt->name, run->ks->kernel, n, i, th[i].err);
+            ok = false;
+            continue;
+        }
+        if (th[i].setup_ns > row->setup_ns) row->setup_ns = th[i].setup_ns;
+        if (i == 0) {
+            row->has_checksum = th[i].has_checksum;
+            row->checksum = th[i].checksum;
+        } else if (th[i].has_checksum != row->has_checksum || th[i].checksum != row->checksum) {
+            fprintf(stderr, "[%s] %s threads=%" PRIu32 ": checksum del thread %" PRIu32
+                            " diverso (0x%08" PRIx32 " / 0x%08" PRIx32 ")\n",
+                    run->rt->name, run->ks->kernel, n, i, th[i].checksum, row->checksum);
+            ok = false;
+        }
+        bench_stats_compute(th[i].samples, cfg->reps, &st);
+        if (st.median > row->worst_ns) row->worst_ns = st.median;
+        if (th[i].begin_ns < begin) begin = th[i].begin_ns;
+        if (th[i].end_ns > end) end = th[i].end_ns;
+    }
+
+    if (ok) {
+        row->wall_ns = end - begin;
+        bench_stats_compute(samples, n * cfg->reps, &row->ns);
+        row->iters_per_s = (double)n * cfg->reps * cfg->iters * 1e9 / row->wall_ns;
+    }
+    free(samples);
+    return ok;
+}
+
+/* una riga per (size, sharing, numero di thread); --max-cv non si applica */
+static int run_scaling(bench_config_t *cfg, const bench_runtime_t *rt,
+                       const kernel_spec_t *ks)
+{
+    static const struct { unsigned mode; const char *name; } modes[] = {
+        { SHARING_PER_THREAD, "per-thread" },
+        { SHARING_SHARED,     "shared" },
+    };
+    char path[PATH_MAX];
+    char err[256] = {0};
+    int failures = 0;
+
+    if (!resolve_module(cfg, ks->module, rt->module_suffix, path, sizeof(path))) {
+        fprintf(stderr, "[%s] %s: nessun modulo %s%s in %s, salto\n", rt->name,
+                ks->kernel, ks->module, rt->module_suffix, cfg->module_dir);
+        return 0;
+    }
+
+    int rounds = ks->num_sizes > 0 ? ks->num_sizes : 1;
+    for (int i = 0; i < rounds; i++) {
+        for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+            if (!(cfg->sharing & modes[m].mode)
+                || (modes[m].mode == SHARING_SHARED && !rt->instantiate)) {
+                continue;
+            }
+            double tput_1 = 0;
+            for (int t = 0; t < cfg->num_threads; t++) {
+                scaling_run_t run = {
+                    .cfg    = cfg,
+                    .rt     = rt,
+                    .ks     = ks,
+                    .path   = path,
+                    .size   = ks->num_sizes > 0 ? &ks->sizes[i] : NULL,
+                    .warmup = cfg->warmup > 0 ? cfg->warmup : 1,
+                };
+                scaling_row_t row = {
+                    .runtime = rt->name,
+                    .kernel  = ks->kernel,
+                    .module  = strrchr(path, '/') + 1,
+                    .sharing = modes[m].name,
+                    .size    = ks->num_sizes > 0 ? ks->sizes[i] : 0,
+                    .threads = cfg->threads[t],
+                };
+
+                if (modes[m].mode == SHARING_SHARED) {
+                    run.base = rt->load(path, err, sizeof(err));
+                    if (!run.base) {
+                        fprintf(stderr, "[%s] %s: load fallito: %s\n", rt->name, path, err);
+                        failures++;
+                        break;
+                    }
+                }
+                pthread_mutex_init(&run.lock, NULL);
+                bool ok = run_threads(cfg, &run, cfg->threads[t], &row);
+                pthread_mutex_destroy(&run.lock);
+                if (run.base) rt->unload(run.base);
+                if (!ok) {
+                    failures++;
+                    break;
+                }
+
+                if (row.threads == 1) tput_1 = row.iters_per_s;
+                row.speedup = tput_1 > 0 ? row.iters_per_s / tput_1 : 0;
+                emit_scaling_row(cfg, &row);
+            }
+        }
+    }
+    return failures;
+}
+
+/* ------------------------ plugin ------------------------ */
+
+static int run_runtime(bench_config_t *cfg, const char *name)
+{
+    char path[PATH_MAX];
+    char err[256] = {0};
+    int failures = 0;
+
+    if (!format_full(path, sizeof(path), "%s/bench_%s.so", cfg->plugin_dir, name)) {
+        fprintf(stderr, "[%s] percorso del plugin troppo lungo\n", name);
+        return 1;
+    }
+    if (!cfg->explicit_runtimes && access(path, R_OK) != 0) {
+        return 0;   /* runtime non compilato in questa build */
+    }
+
+    void *h = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!h) {
+        fprintf(stderr, "[%s] dlopen: %s\n", name, dlerror());
+        return 1;
+    }
+    bench_plugin_entry_fn entry = (bench_plugin_entry_fn)dlsym(h, BENCH_PLUGIN_ENTRY);
+    const bench_runtime_t *rt = entry ? entry() : NULL;
+    if (!rt || rt->abi_version != BENCH_PLUGIN_ABI_VERSION) {
+        fprintf(stderr, "[%s] plugin non valido (ABI)\n", name);
+        dlclose(h);
+        return 1;
+    }
+    if (!rt->init(err, sizeof(err))) {
+        fprintf(stderr, "[%s] init: %s\n", name, err);
+        dlclose(h);
+        return 1;
+    }
+
+    if (cfg->profile && !rt->profile_dump) {
+        fprintf(stderr, "[%s] --opcode-profile: plugin senza contatori, solo tempi\n", rt->name);
+    }
+
+    if (cfg->startup) {
+        for (int s = 0; s < cfg->num_startups; s++) {
+            failures += run_startup(cfg, rt, &cfg->startups[s]);
+        }
+    } else if (cfg->num_threads > 0) {
+        if ((cfg->sharing & SHARING_SHARED) && !rt->instantiate) {
+            fprintf(stderr, "[%s] --sharing shared non supportato dal plugin, salto\n", rt->name);
+        }
+        for (int k = 0; k < cfg->num_kernels; k++) {
+            failures += run_scaling(cfg, rt, &cfg->kernels[k]);
+        }
+    } else {
+        for (int k = 0; k < cfg->num_kernels; k++) {
+            failures += run_module(cfg, rt, &cfg->kernels[k]);
+        }
+    }
+
+    rt->deinit();
+    dlclose(h);
+    return failures;
+}
+
+/* ------------------------ CLI ------------------------ */
+
+/* "modulo:kernel[@size,size...]" oppure "kernel" (modulo con lo stesso nome) */
+static bool parse_kernel_spec(const char *arg, kernel_spec_t *ks)
+{
+    char buf[256];
+    memset(ks, 0, sizeof(*ks));
+    if (!format_full(buf, sizeof(buf), "%s", arg)) return false;
+
+    char *sizes = strchr(buf, '@');
+    if (sizes) {
+        *sizes++ = '\0';
+        for (char *tok = strtok(sizes, ","); tok; tok = strtok(NULL, ",")) {
+            if (ks->num_sizes == MAX_SIZES) return false;
+            ks->sizes[ks->num_sizes++] = (uint32_t)strtoul(tok, NULL, 0);
+        }
+    }
+    char *colon = strchr(buf, ':');
+    if (colon) {
+        *colon = '\0';
+        if (!format_full(ks->module, sizeof(ks->module), "%s", buf)
+            || !format_full(ks->kernel, sizeof(ks->kernel), "%s", colon + 1)) {
+            return false;
+        }
+    } else if (!format_full(ks->module, sizeof(ks->module), "%s", buf)
+               || !format_full(ks->kernel, sizeof(ks->kernel), "%s", buf)) {
+        return false;
+    }
+    return ks->module[0] != '\0' && ks->kernel[0] != '\0';
+}
+
+/* "modulo[:func[(a,b,...)]]": func è chiamata una volta con argomenti i32 */
+static bool parse_startup_spec(const char *arg, startup_spec_t *ss)
+{
+    char buf[256];
+    memset(ss, 0, sizeof(*ss));
+    if (!format_full(buf, sizeof(buf), "%s", arg)) return false;
+
+    char *args = strchr(buf, '(');
+    if (args) {
+        *args++ = '\0';
+        char *close = strchr(args, ')');
+        if (!close) return false;
+        *close = '\0';
+        for (char *tok = strtok(args, ","); tok; tok = strtok(NULL, ",")) {
+            if (ss->argc == BENCH_MAX_ARGS) return false;
+            ss->argv[ss->argc++] = (uint32_t)strtoul(tok, NULL, 0);
+        }
+    }
+    char *colon = strchr(buf, ':');
+    if (colon) {
+        *colon = '\0';
+        if (!format_full(ss->func, sizeof(ss->func), "%s", colon + 1)) return false;
+    }
+    if (!format_full(ss->module, sizeof(ss->module), "%s", buf)) return false;
+    return ss->module[0] != '\0' && (!colon || ss->func[0] != '\0');
+}
+
+/* "1,2,4,8": da 1 a MAX_THREADS, ordinati e senza doppioni (speedup su threads=1) */
+static bool parse_threads(const char *arg, bench_config_t *cfg)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", arg);
+    cfg->num_threads = 0;
+
+    for (char *tok = strtok(buf, ","); tok; tok = strtok(NULL, ",")) {
+        unsigned long v = strtoul(tok, NULL, 0);
+        if (v == 0 || v > MAX_THREADS) return false;
+
+        int j = cfg->num_threads;
+        while (j > 0 && cfg->threads[j - 1] > v) j--;
+        if (j > 0 && cfg->threads[j - 1] == v) continue;
+        memmove(&cfg->threads[j + 1], &cfg->threads[j],
+                (size_t)(cfg->num_threads - j) * sizeof(cfg->threads[0]));
+        cfg->threads[j] = (uint32_t)v;
+        cfg->num_threads++;
+    }
+    return cfg->num_threads > 0;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "uso: %s [--runtime r1,r2,...] [--kernel modulo:kernel[@size,...]]... [--suite] [--simd]\n"
+            "          [--hostcall] [--suites] [--startup] [--startup-module modulo[:func(args)]]...\n"
+            "          [--threads N,N,...] [--sharing per-thread|shared|both]\n"
+            "          [--iters N] [--warmup N] [--reps N] [--max-cv PCT] [--cpu N|none]\n"
+            "          [--format csv|json|results] [--out FILE] [--opcode-profile FILE]\n"
+            "          [--plugin-dir DIR] [--module-dir DIR] [--list]\n"
+            "--suite: fft_bench:fft, le varianti FFT a N = " FFT_SUITE_SIZES "\n"
+            "         e tutti i kernel di kernels_bench\n"
+            "--simd: le varianti SIMD128 (moduli fft_bench_simd e kernels_bench_simd)\n"
+            "--hostcall: costo per chiamata degli import no-op di hostcall_bench\n"
+            "--suites: CoreMark, Dhrystone e PolyBench (modulo suites_bench, wasm/suites)\n"
+            "--format results: record JSON Lines per bench_results.py / bench_compare.py\n"
+            "--opcode-profile: conteggi di operazioni e coppie per kernel (JSON Lines per\n"
+            "                  bench_opprof.py); default --runtime wasm3-prof,\n"
+            "                  wamr-interp-prof,wamr-fast-interp-prof\n"
+            "--startup: fasi di avvio di toggle, math_ops, fft_bench e synth_* al posto dei\n"
+            "           kernel (--startup-module sceglie i moduli)\n"
+            "--threads: ogni kernel su N thread con un'istanza ciascuno, throughput e\n"
+            "           speedup; --sharing: modulo caricato da ogni thread, istanze di un\n"
+            "           solo modulo o entrambi (default both). --cpu non si applica, i\n"
+            "           thread ruotano sulle CPU consentite\n"
+            "default: tutti i plugin presenti, --kernel fft_bench:fft, --iters 100,\n"
+            "         --warmup 3, --reps 10, --max-cv 5, --cpu = CPU corrente\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    static bench_config_t cfg;
+    static char runtime_arg[512];
+    bool list_only = false;
+    char exe[PATH_MAX];
+    struct utsname un;
+
+    cfg.iters = 100;
+    cfg.warmup = 3;
+    cfg.reps = 10;
+    cfg.max_cv = 5.0;
+    cfg.cpu = sched_getcpu();
+    cfg.sharing = SHARING_PER_THREAD | SHARING_SHARED;
+    cfg.format = FORMAT_CSV;
+    cfg.out = stdout;
+
+    /* plugin e moduli accanto all'eseguibile (layout della build CMake) */
+    ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+    exe[n > 0 ? n : 0] = '\0';
+    const char *exe_dir = n > 0 ? dirname(exe) : ".";
+    snprintf(cfg.plugin_dir, sizeof(cfg.plugin_dir), "%s/plugins", exe_dir);
+    snprintf(cfg.module_dir, sizeof(cfg.module_dir), "%s/modules", exe_dir);
+    snprintf(cfg.machine, sizeof(cfg.machine), "%s",
+             uname(&un) == 0 ? un.machine : "unknown");
+
+    static const struct option opts[] = {
+        { "runtime",    required_argument, NULL, 'r' },
+        { "kernel",     required_argument, NULL, 'k' },
+        { "suite",      no_argument,       NULL, 's' },
+        { "simd",       no_argument,       NULL, 'S' },
+        { "hostcall",   no_argument,       NULL, 'H' },
+        { "suites",     no_argument,       NULL, 'W' },
+        { "startup",    no_argument,       NULL, 'u' },
+        { "startup-module", required_argument, NULL, 'U' },
+        { "threads",    required_argument, NULL, 'T' },
+        { "sharing",    required_argument, NULL, 'm' },
+        { "iters",      required_argument, NULL, 'n' },
+        { "warmup",     required_argument, NULL, 'w' },
+        { "reps",       required_argument, NULL, 'R' },
+        { "max-cv",     required_argument, NULL, 'V' },
+        { "cpu",        required_argument, NULL, 'c' },
+        { "format",     required_argument, NULL, 'f' },
+        { "out",        required_argument, NULL, 'o' },
+        { "opcode-profile", required_argument, NULL, 'O' },
+        { "plugin-dir", required_argument, NULL, 'P' },
+        { "module-dir", required_argument, NULL, 'M' },
+        { "list",       no_argument,       NULL, 'l' },
+        { "help",       no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "r:k:sSHWuU:T:m:n:w:R:V:c:f:o:O:P:M:lh", opts, NULL)) != -1) {
+        switch (c) {
+        case 'r':
+            snprintf(runtime_arg, sizeof(runtime_arg), "%s", optarg);
+            for (char *tok = strtok(runtime_arg, ","); tok; tok = strtok(NULL, ",")) {
+                if (cfg.num_runtimes < MAX_RUNTIMES) {
+                    cfg.runtimes[cfg.num_runtimes++] = tok;
+                }
+            }
+            cfg.explicit_runtimes = true;
+            break;
+        case 'k':
+            if (cfg.num_kernels == MAX_KERNELS ||
+                !parse_kernel_spec(optarg, &cfg.kernels[cfg.num_kernels])) {
+                fprintf(stderr, "--kernel non valido: %s\n", optarg);
+                return 2;
+            }
+            cfg.num_kernels++;
+            break;
+        case 's': {
+            static const char *const variants[] = { FFT_VARIANT_NAMES };
+            static const char *const suite[] = { KERNELS_SUITE_NAMES };
+            char spec[96];
+            if (cfg.num_kernels + 1 + FFT_VARIANT_LEN + KERNELS_SUITE_LEN > MAX_KERNELS) {
+                fprintf(stderr, "--suite: troppi kernel\n");
+                return 2;
+            }
+            parse_kernel_spec("fft_bench:fft", &cfg.kernels[cfg.num_kernels++]);
+            for (int i = 0; i < FFT_VARIANT_LEN; i++) {
+                snprintf(spec, sizeof(spec), "fft_bench:%s@" FFT_SUITE_SIZES, variants[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            for (int i = 0; i < KERNELS_SUITE_LEN; i++) {
+                snprintf(spec, sizeof(spec), "kernels_bench:%s", suite[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            break;
+        }
+        case 'S': {
+            static const char *const variants[] = { FFT_SIMD_VARIANT_NAMES };
+            static const char *const simd[] = { KERNELS_SIMD_NAMES };
+            char spec[96];
+            if (cfg.num_kernels + FFT_SIMD_VARIANT_LEN + KERNELS_SIMD_LEN > MAX_KERNELS) {
+                fprintf(stderr, "--simd: troppi kernel\n");
+                return 2;
+            }
+            for (int i = 0; i < FFT_SIMD_VARIANT_LEN; i++) {
+                snprintf(spec, sizeof(spec), "fft_bench_simd:%s@" FFT_SUITE_SIZES, variants[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            for (int i = 0; i < KERNELS_SIMD_LEN; i++) {
+                snprintf(spec, sizeof(spec), "kernels_bench_simd:%s", simd[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            break;
+        }
+        case 'H': {
+            static const char *const hostcall[] = { HOSTCALL_SUITE_NAMES };
+            char spec[96];
+            if (cfg.num_kernels + HOSTCALL_SUITE_LEN > MAX_KERNELS) {
+                fprintf(stderr, "--hostcall: troppi kernel\n");
+                return 2;
+            }
+            for (int i = 0; i < HOSTCALL_SUITE_LEN; i++) {
+                snprintf(spec, sizeof(spec), "hostcall_bench:%s", hostcall[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            break;
+        }
+        case 'W': {
+            static const char *const suites[] = { SUITES_NAMES };
+            char spec[96];
+            if (cfg.num_kernels + SUITES_LEN > MAX_KERNELS) {
+                fprintf(stderr, "--suites: troppi kernel\n");
+                return 2;
+            }
+            for (int i = 0; i < SUITES_LEN; i++) {
+                snprintf(spec, sizeof(spec), "suites_bench:%s", suites[i]);
+                parse_kernel_spec(spec, &cfg.kernels[cfg.num_kernels++]);
+            }
+            break;
+        }
+        case 'u':
+            cfg.startup = true;
+            break;
+        case 'U':
+            if (cfg.num_startups == MAX_STARTUP ||
+                !parse_startup_spec(optarg, &cfg.startups[cfg.num_startups])) {
+                fprintf(stderr, "--startup-module non valido: %s\n", optarg);
+                return 2;
+            }
+            cfg.num_startups++;
+            cfg.startup = true;
+            break;
+        case 'T':
+            if (!parse_threads(optarg, &cfg)) {
+                fprintf(stderr, "--threads: numeri tra 1 e %d separati da virgole\n", MAX_THREADS);
+                return 2;
+            }
+            break;
+        case 'm':
+            if (strcmp(optarg, "per-thread") == 0) {
+                cfg.sharing = SHARING_PER_THREAD;
+            } else if (strcmp(optarg, "shared") == 0) {
+                cfg.sharing = SHARING_SHARED;
+            } else if (strcmp(optarg, "both") == 0) {
+                cfg.sharing = SHARING_PER_THREAD | SHARING_SHARED;
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'n':
+            cfg.iters = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'w':
+            cfg.warmup = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'R':
+            cfg.reps = (uint32_t)strtoul(optarg, NULL, 0);
+            if (cfg.reps == 0 || cfg.reps > MAX_REPS) {
+                fprintf(stderr, "--reps deve essere tra 1 e %d\n", MAX_REPS);
+                return 2;
+            }
+            break;
+        case 'V':
+            cfg.max_cv = strtod(optarg, NULL);
+            break;
+        case 'c':
+            cfg.cpu = strcmp(optarg, "none") == 0 ? -1 : atoi(optarg);
+            break;
+        case 'f':
+            if (strcmp(optarg, "csv") == 0) {
+                cfg.format = FORMAT_CSV;
+            } else if (strcmp(optarg, "json") == 0) {
+                cfg.format = FORMAT_JSON;
+            } else if (strcmp(optarg, "results") == 0) {
+                cfg.format = FORMAT_RESULTS;
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'o':
+            cfg.out = fopen(optarg, "w");
+            if (!cfg.out) {
+                perror(optarg);
+                return 2;
+            }
+            break;
+        case 'O':
+            cfg.profile = fopen(optarg, "w");
+            if (!cfg.profile) {
+                perror(optarg);
+                return 2;
+            }
+            break;
+        case 'P':
+            if (!format_full(cfg.plugin_dir, sizeof(cfg.plugin_dir), "%s", optarg)) {
+                fprintf(stderr, "--plugin-dir: percorso troppo lungo\n");
+                return 2;
+            }
+            break;
+        case 'M':
+            if (!format_full(cfg.module_dir, sizeof(cfg.module_dir), "%s", optarg)) {
+                fprintf(stderr, "--module-dir: percorso troppo lungo\n");
+                return 2;
+            }
+            break;
+        case 'l':
+            list_only = true;
+            break;
+        default:
+            usage(argv[0]);
+            return c == 'h' ? 0 : 2;
+        }
+    }
+
+    if (!cfg.explicit_runtimes && cfg.profile) {
+        for (size_t i = 0;
+             i < sizeof(default_profile_runtimes) / sizeof(default_profile_runtimes[0]); i++) {
+            cfg.runtimes[cfg.num_runtimes++] = default_profile_runtimes[i];
+        }
+    } else if (!cfg.explicit_runtimes) {
+        for (size_t i = 0; i < sizeof(default_runtimes) / sizeof(default_runtimes[0]); i++) {
+            cfg.runtimes[cfg.num_runtimes++] = default_runtimes[i];
+        }
+    }
+    if (cfg.num_kernels == 0) {
+        parse_kernel_spec("fft_bench:fft", &cfg.kernels[cfg.num_kernels++]);
+    }
+    if (cfg.startup && cfg.num_startups == 0) {
+        for (size_t i = 0; i < sizeof(default_startup) / sizeof(default_startup[0]); i++) {
+            parse_startup_spec(default_startup[i], &cfg.startups[cfg.num_startups++]);
+        }
+    }
+
+    if (list_only) {
+        for (int i = 0; i < cfg.num_runtimes; i++) {
+            char path[PATH_MAX];
+            bool found = format_full(path, sizeof(path), "%s/bench_%s.so",
+                                     cfg.plugin_dir, cfg.runtimes[i])
+                && access(path, R_OK) == 0;
+            printf("%-18s %s\n", cfg.runtimes[i], found ? path : "(non compilato)");
+        }
+        return 0;
+    }
+
+    if (cfg.startup && cfg.num_threads > 0) {
+        fprintf(stderr, "--startup e --threads non si combinano\n");
+        return 2;
+    }
+    if (cfg.profile && (cfg.startup || cfg.num_threads > 0)) {
+        fprintf(stderr, "--opcode-profile vale solo per i kernel, non con --startup o --threads\n");
+        return 2;
+    }
+    if (cfg.format == FORMAT_RESULTS && cfg.num_threads > 0) {
+        fprintf(stderr, "--format results non copre --threads: usare csv o json\n");
+        return 2;
+    }
+    time_t now = time(NULL);
+    strftime(cfg.date, sizeof(cfg.date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    /* --threads: le CPU su cui far ruotare i thread, prima di fissare il processo */
+    if (cfg.num_threads > 0) {
+        cpu_set_t set;
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (int i = 0; i < CPU_SETSIZE && cfg.num_cpus < MAX_CPUS; i++) {
+                if (CPU_ISSET(i, &set)) cfg.cpus[cfg.num_cpus++] = i;
+            }
+        }
+        if (cfg.num_cpus > 0 && cfg.threads[cfg.num_threads - 1] > (uint32_t)cfg.num_cpus) {
+            fprintf(stderr, "--threads: %" PRIu32 " thread su %d CPU, oltre %d i thread "
+                            "condividono i core\n",
+                    cfg.threads[cfg.num_threads - 1], cfg.num_cpus, cfg.num_cpus);
+        }
+        cfg.cpu = -1;
+    }
+
+    /* niente migrazioni tra core durante le misure (cache e frequenze diverse) */
+    if (cfg.cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cfg.cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+            fprintf(stderr, "sched_setaffinity(cpu %d): %s\n", cfg.cpu, strerror(errno));
+            return 2;
+        }
+    }
+
+    bench_counters_open(&cfg.counters);
+    if (strcmp(cfg.counters.cycles_source, "perf") != 0) {
+        fprintf(stderr, "perf_event_open non disponibile: cicli da %s, niente IPC/miss "
+                        "(vedi /proc/sys/kernel/perf_event_paranoid)\n",
+                cfg.counters.cycles_source);
+    }
+
+    if (cfg.startup) {
+        emit_startup_header(&cfg);
+    } else if (cfg.num_threads > 0) {
+        emit_scaling_header(&cfg);
+    } else {
+        emit_header(&cfg);
+    }
+    int failures = 0;
+    for (int i = 0; i < cfg.num_runtimes; i++) {
+        failures += run_runtime(&cfg, cfg.runtimes[i]);
+    }
+
+    bench_counters_close(&cfg.counters);
+    if (cfg.out != stdout) {
+        fclose(cfg.out);
+    }
+    if (cfg.profile) {
+        fclose(cfg.profile);
+    }
+    return failures ? 1 : 0;
+}
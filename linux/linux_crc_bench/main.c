@@ -0,0 +1,118 @@
+/*
+ * Microbenchmark CRC32 (zlib) del path di LOAD dell'agent:
+ *   bitwise    loop a 8 iterazioni per byte (vecchio crc32_calc)
+ *   table      tabella a byte (crc32_table[0])
+ *   slice4     crc32_update() del firmware su tutto il buffer
+ *   chunk512   crc32_update() a blocchi di 512 byte, come il thread del LOAD
+ */
+#include <time.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crc32.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#define BUF_SIZE  (32 * 1024)   /* ordine di grandezza di un modulo .aot */
+#define NUM_ITER  200
+
+static uint8_t buf[BUF_SIZE];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t crc_bitwise(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            uint32_t lsb  = crc & 1u;
+            uint32_t mask = -(int32_t)lsb;
+            crc = (crc >> 1) ^ (0xEDB88320u & mask);
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t crc_table(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc32_table[0][(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static uint32_t crc_chunk512(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < len; i += 512) {
+        crc = crc32_update(crc, &data[i], len - i < 512 ? len - i : 512);
+    }
+    return crc;
+}
+
+#ifdef HAVE_ZLIB
+static uint32_t crc_zlib(const uint8_t *data, size_t len)
+{
+    return (uint32_t)crc32(0L, data, (uInt)len);
+}
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t (*fn)(const uint8_t *, size_t);
+} variant_t;
+
+static const variant_t variants[] = {
+    { "bitwise", crc_bitwise },
+    { "table",   crc_table },
+    { "slice4",  crc32_calc },
+    { "chunk512", crc_chunk512 },
+#ifdef HAVE_ZLIB
+    { "zlib",    crc_zlib },
+#endif
+};
+
+int main(void)
+{
+    srand(1);
+    for (size_t i = 0; i < BUF_SIZE; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+
+    uint32_t ref = crc_bitwise(buf, BUF_SIZE);
+    int ret = 0;
+
+    printf("Linux CRC32, buffer %d bytes, %d iterazioni\n", BUF_SIZE, NUM_ITER);
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        volatile uint32_t sink = variants[v].fn(buf, BUF_SIZE);   /* warmup */
+        if (sink != ref) {
+            printf("%-8s CRC errato: %08" PRIx32 " != %08" PRIx32 "\n",
+                   variants[v].name, (uint32_t)sink, ref);
+            ret = 1;
+            continue;
+        }
+
+        uint64_t t0 = now_ns();
+        for (int k = 0; k < NUM_ITER; k++) {
+            sink = variants[v].fn(buf, BUF_SIZE);
+        }
+        uint64_t total_ns = now_ns() - t0;
+
+        double ns_per_byte = (double)total_ns / ((double)NUM_ITER * BUF_SIZE);
+        printf("%-8s %8.3f ns/byte %9.1f MB/s\n", variants[v].name,
+               ns_per_byte, 1000.0 / ns_per_byte);
+    }
+    return ret;
+}
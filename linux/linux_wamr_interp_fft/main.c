@@ -88,7 +88,9 @@ int main(void)
     end = ns_now();
 
     total_ns = end - start;
-    total_cycles = total_ns * (cpu_hz / 1000000000ULL);
+    // stima a frequenza nominale (cicli misurati: linux/linux_bench);
+    // moltiplicare prima di dividere, cpu_hz / 1e9 troncherebbe 3.7 a 3
+    total_cycles = total_ns * cpu_hz / 1000000000ULL;
     avg_cycles   = total_cycles / NUM_ITER;
 
     printf("Linux + WAMR (interp)\r\n");
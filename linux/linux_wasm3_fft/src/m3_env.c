@@ -239,7 +239,9 @@ void  m3_FreeRuntime  (IM3Runtime i_runtime)
 {
     if (i_runtime)
     {
+# if d_m3ProfilerPrintOnFree
         m3_PrintProfilerInfo ();
+# endif
 
         Runtime_Release (i_runtime);
         m3_Free (i_runtime);
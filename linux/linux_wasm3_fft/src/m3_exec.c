@@ -13,57 +13,143 @@
 # if d_m3EnableOpProfiling
 //--------------------------------------------------------------------------------------------------------
 static M3ProfilerSlot s_opProfilerCounts [d_m3ProfilerSlotMask + 1] = {};
+static M3ProfilerPairSlot s_opProfilerPairs [d_m3ProfilerPairSlotMask + 1] = {};
+static cstr_t s_opProfilerPrevious = NULL;
+static u64 s_opProfilerDropped = 0;
 
+// the keys are the addresses of the op names; mixed, since their low bits are mostly alignment
+static u32  ProfilerHash  (cstr_t i_name)
+{
+    u64 key = (u64) (uintptr_t) i_name;
+
+    return (u32) ((key * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+// open addressing with linear probing: a full table drops the hit instead of aborting
 void  ProfileHit  (cstr_t i_operationName)
 {
-    u64 ptr = (u64) i_operationName;
+    u32 hash = ProfilerHash (i_operationName);
+    u32 i;
+
+    for (i = 0; i <= d_m3ProfilerSlotMask; ++i)
+    {
+        M3ProfilerSlot * slot = & s_opProfilerCounts [(hash + i) & d_m3ProfilerSlotMask];
 
-    M3ProfilerSlot * slot = & s_opProfilerCounts [ptr & d_m3ProfilerSlotMask];
+        if (not slot->opName)
+            slot->opName = i_operationName;
 
-    if (slot->opName)
+        if (slot->opName == i_operationName)
+        {
+            slot->hitCount++;
+            break;
+        }
+    }
+    if (i > d_m3ProfilerSlotMask)
+        s_opProfilerDropped++;
+
+    if (s_opProfilerPrevious)
     {
-        if (slot->opName != i_operationName)
+        u32 pairHash = ProfilerHash (s_opProfilerPrevious) ^ (hash * 31);
+
+        for (i = 0; i <= d_m3ProfilerPairSlotMask; ++i)
         {
-            m3_Abort ("profiler slot collision; increase d_m3ProfilerSlotMask");
+            M3ProfilerPairSlot * slot = & s_opProfilerPairs [(pairHash + i) & d_m3ProfilerPairSlotMask];
+
+            if (not slot->opName)
+            {
+                slot->opName = s_opProfilerPrevious;
+                slot->nextName = i_operationName;
+            }
+
+            if (slot->opName == s_opProfilerPrevious and slot->nextName == i_operationName)
+            {
+                slot->hitCount++;
+                break;
+            }
         }
+        if (i > d_m3ProfilerPairSlotMask)
+            s_opProfilerDropped++;
+    }
+
+    s_opProfilerPrevious = i_operationName;
+}
+
+
+uint64_t  m3_ForEachProfilerCount  (M3ProfilerCallback i_callback, void * i_userData)
+{
+    for (u32 i = 0; i <= d_m3ProfilerSlotMask; ++i)
+    {
+        M3ProfilerSlot * slot = & s_opProfilerCounts [i];
+
+        if (slot->opName)
+            i_callback (i_userData, slot->opName, NULL, slot->hitCount);
     }
 
-    slot->opName = i_operationName;
-    slot->hitCount++;
+    for (u32 i = 0; i <= d_m3ProfilerPairSlotMask; ++i)
+    {
+        M3ProfilerPairSlot * slot = & s_opProfilerPairs [i];
+
+        if (slot->opName)
+            i_callback (i_userData, slot->opName, slot->nextName, slot->hitCount);
+    }
+
+    return s_opProfilerDropped;
+}
+
+
+void  m3_ResetProfilerInfo  ()
+{
+    memset (s_opProfilerCounts, 0, sizeof (s_opProfilerCounts));
+    memset (s_opProfilerPairs, 0, sizeof (s_opProfilerPairs));
+    s_opProfilerPrevious = NULL;
+    s_opProfilerDropped = 0;
 }
 
 
+// most executed first; the table is left as it is, so the counters keep going
 void  m3_PrintProfilerInfo  ()
 {
-    M3ProfilerSlot dummy;
-    M3ProfilerSlot * maxSlot = & dummy;
+    u64 lastCount = UINT64_MAX;
+    i32 lastIndex = -1;
 
-    do
+    while (true)
     {
-        maxSlot->hitCount = 0;
+        i32 next = -1;
 
         for (u32 i = 0; i <= d_m3ProfilerSlotMask; ++i)
         {
             M3ProfilerSlot * slot = & s_opProfilerCounts [i];
+            u64 count = slot->hitCount;
 
-            if (slot->opName)
-            {
-                if (slot->hitCount > maxSlot->hitCount)
-                    maxSlot = slot;
-            }
-        }
+            if (not slot->opName)
+                continue;
 
-        if (maxSlot->opName)
-        {
-            fprintf (stderr, "%13llu  %s\n", maxSlot->hitCount, maxSlot->opName);
-            maxSlot->opName = NULL;
+            // after the last printed slot in (count descending, index ascending) order
+            if (count > lastCount or (count == lastCount and (i32) i <= lastIndex))
+                continue;
+
+            if (next < 0 or count > s_opProfilerCounts [next].hitCount)
+                next = (i32) i;
         }
+
+        if (next < 0)
+            break;
+
+        fprintf (stderr, "%13llu  %s\n", (unsigned long long) s_opProfilerCounts [next].hitCount, s_opProfilerCounts [next].opName);
+        lastCount = s_opProfilerCounts [next].hitCount;
+        lastIndex = next;
     }
-    while (maxSlot->hitCount);
 }
 
 # else
 
 void  m3_PrintProfilerInfo  () {}
 
+uint64_t  m3_ForEachProfilerCount  (M3ProfilerCallback i_callback, void * i_userData)
+{
+    return 0;
+}
+
+void  m3_ResetProfilerInfo  () {}
+
 # endif
@@ -98,7 +98,9 @@ static void run_wasm_fft_benchmark(void) {
 
 
 	total_ns = end - start;
-	total_cycles = total_ns * (cpu_hz / 1000000000ULL);
+	// stima a frequenza nominale (cicli misurati: linux/linux_bench);
+	// moltiplicare prima di dividere, cpu_hz / 1e9 troncherebbe 3.7 a 3
+	total_cycles = total_ns * cpu_hz / 1000000000ULL;
 	avg_cycles   = total_cycles / NUM_ITER;
 	printf("Linux + wasm3\r\n");
 	printf("Total cycles: %" PRIu64 "\n", total_cycles);
@@ -0,0 +1,130 @@
+"""
+Compressore LZ4 in formato "block" (senza frame) per LOAD enc=lz4.
+
+Usa il modulo `lz4` se installato, altrimenti un compressore greedy in
+Python puro compatibile con qualsiasi decoder LZ4 (rispetta le regole di
+fine blocco: ultimi 5 byte sempre literal, nessun match negli ultimi 12).
+Il decoder corrispondente lato device è firmware/src/lz4_stream.c.
+
+Il compressore in Python limita i match a MAX_MATCH byte, come MAX_COPY di
+delta_patch.py: il thread del LOAD torna a svuotare il ring della UART tra
+una copia e l'altra. I match del modulo `lz4` non hanno limite, ma il
+decoder gira comunque fuori dall'ISR.
+"""
+
+try:
+    import lz4.block as _lz4_block
+except ImportError:
+    _lz4_block = None
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MF_LIMIT = 12
+MAX_OFFSET = 0xFFFF
+MAX_MATCH = 1024     # copia massima per sequenza (encoder Python)
+
+
+def _write_len(out: bytearray, n: int):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def _emit(out: bytearray, literals, match_len: int = 0, offset: int = 0):
+    lit_len = len(literals)
+    ml = match_len - MIN_MATCH if match_len else 0
+    token = (min(lit_len, 15) << 4) | (min(ml, 15) if match_len else 0)
+    out.append(token)
+    if lit_len >= 15:
+        _write_len(out, lit_len - 15)
+    out += literals
+    if match_len:
+        out += offset.to_bytes(2, "little")
+        if ml >= 15:
+            _write_len(out, ml - 15)
+
+
+def _compress_py(src: bytes) -> bytes:
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    match_limit = n - MF_LIMIT
+
+    while i < match_limit:
+        key = src[i:i + MIN_MATCH]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > MAX_OFFSET:
+            i += 1
+            continue
+
+        max_len = min(n - LAST_LITERALS - i, MAX_MATCH)
+        mlen = MIN_MATCH
+        while mlen < max_len and src[cand + mlen] == src[i + mlen]:
+            mlen += 1
+        # estende all'indietro dentro i literal pendenti
+        while (i > anchor and cand > 0 and mlen < MAX_MATCH
+               and src[i - 1] == src[cand - 1]):
+            i -= 1
+            cand -= 1
+            mlen += 1
+
+        _emit(out, src[anchor:i], mlen, i - cand)
+        end = i + mlen
+        # indicizza anche l'interno del match (basta la coda: costo limitato)
+        for j in range(max(i + 1, end - 16), min(end, match_limit)):
+            table[src[j:j + MIN_MATCH]] = j
+        i = anchor = end
+
+    _emit(out, src[anchor:])
+    return bytes(out)
+
+
+def compress(data: bytes) -> bytes:
+    if _lz4_block is not None:
+        return _lz4_block.compress(data, store_size=False)
+    return _compress_py(data)
+
+
+def decompress(src: bytes, size: int) -> bytes:
+    """Decoder di riferimento (verifica lato gateway/test)."""
+    out = bytearray()
+    i = 0
+    n = len(src)
+    while i < n:
+        token = src[i]
+        i += 1
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit_len += b
+                if b != 255:
+                    break
+        out += src[i:i + lit_len]
+        i += lit_len
+        if i >= n:
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        match_len = token & 0x0F
+        if match_len == 15:
+            while True:
+                b = src[i]
+                i += 1
+                match_len += b
+                if b != 255:
+                    break
+        match_len += MIN_MATCH
+        if offset == 0 or offset > len(out):
+            raise ValueError("offset LZ4 non valido")
+        start = len(out) - offset
+        for k in range(match_len):
+            out.append(out[start + k])
+    if len(out) != size:
+        raise ValueError(f"dimensione decompressa {len(out)} != {size}")
+    return bytes(out)
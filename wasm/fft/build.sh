@@ -0,0 +1,70 @@
+#!/bin/sh
+# Compila il modulo FFT: wasm host, header C per gli MCU e AOT.
+#
+#   wasm/fft/build.sh                (CLANG, WAMRC, PYTHON sovrascrivibili da env)
+#
+# Produce, accanto a questo script:
+#   fft_bench.wasm          modulo host (FFT_MAX_N = 4096, per linux_bench)
+#   fft_bench.x86_64.aot    AOT host per linux_bench
+#   fft_bench.wasm.h        xxd -i del modulo MCU (FFT_MAX_N = 1024, una
+#                           pagina di memoria), per wasm3/WAMR interp
+#   f4/, f7/ fft_bench.aot, fft_bench_aot.h   AOT del modulo MCU per
+#                           famiglia, con i flag che il gateway ricava dal
+#                           HELLO della board (aot_target.py: --cpu, FPU)
+# e copia gli header nei progetti MCU che eseguono la FFT in wasm.
+# I progetti MCU nativi compilano lo stesso sorgente: le loro copie di
+# fft_bench_wasm.c, fft_bench.h e twiddle1024.h vengono da qui (anche senza
+# toolchain wasm), non si modificano a mano.
+set -e
+
+cd "$(dirname "$0")"
+CLANG=${CLANG:-clang}
+WAMRC=${WAMRC:-wamrc}
+PYTHON=${PYTHON:-python3}
+REPO=../..
+
+for prj in baremetal/bm_fft_f4 baremetal/bm_fft_f7 freertos/frt_fft_f4 freertos/frt_fft_f7; do
+  cp fft_bench_wasm.c "$REPO/$prj/Core/Src/"
+  cp fft_bench.h twiddle1024.h "$REPO/$prj/Core/Inc/"
+done
+for prj in zephyrproject/z_native_fft_f4 zephyrproject/z_native_fft_f7; do
+  cp fft_bench_wasm.c fft_bench.h twiddle1024.h "$REPO/$prj/src/"
+done
+CFLAGS="--target=wasm32-unknown-unknown -O3 -nostdlib -fno-builtin \
+  -Wl,--no-entry -Wl,-z,stack-size=16384"
+
+$CLANG $CFLAGS fft_bench_wasm.c -o fft_bench.wasm
+
+# modulo MCU: stesso nome di file, così xxd genera fft_bench_wasm[]
+mkdir -p mcu
+$CLANG $CFLAGS -DFFT_MAX_N=1024 fft_bench_wasm.c -o mcu/fft_bench.wasm
+(cd mcu && xxd -i fft_bench.wasm) > fft_bench.wasm.h
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    mkdir -p $fam
+    "$WAMRC" $("$PYTHON" $REPO/aot_target.py --family $fam) -o $fam/fft_bench.aot mcu/fft_bench.wasm
+    (cd $fam && xxd -i fft_bench.aot) > $fam/fft_bench_aot.h
+  done
+  "$WAMRC" --target=x86_64 --opt-level=3 --size-level=0 \
+    --bounds-checks=0 --stack-bounds-checks=0 \
+    -o fft_bench.x86_64.aot fft_bench.wasm
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
+
+for dst in \
+  baremetal/bm_wasm3_fft_f4/Core/Inc baremetal/bm_wasm3_fft_f7/Core/Inc \
+  freertos/frt_wasm3_fft_f4/Core/Inc freertos/frt_wasm3_fft_f7/Core/Inc \
+  zephyrproject/z_wasm3_fft_f4/src zephyrproject/z_wasm3_fft_f7/src \
+  zephyrproject/z_wamr_interp_fft_f4/src zephyrproject/z_wamr_interp_fft_f7/src; do
+  cp fft_bench.wasm.h fft_bench.h "$REPO/$dst/"
+done
+for fam in f4 f7; do
+  cp fft_bench.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+done
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    cp $fam/fft_bench_aot.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  done
+fi
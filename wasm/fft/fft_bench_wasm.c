@@ -1,15 +1,22 @@
 #include <stdint.h>
 
+#include "fft_bench.h"
+#ifdef BENCH_SIMD
+#include "bench_simd.h"
+#endif
 
-#define N_FFT 1024
-
-
-#if defined(__wasm__) || defined(__wasm)
-#  define WASM_EXPORT(name) __attribute__((export_name(name)))
-#else
-#  define WASM_EXPORT(name)
+/*
+ * Le somme float non devono essere contratte in FMA, altrimenti i checksum
+ * delle varianti nativi divergono da quelli wasm.
+ */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
 #endif
 
+#define N_FFT 1024
+
 static float buf[2 * N_FFT];
 
 /* ---------------------------------------------------------
@@ -104,3 +111,615 @@ void fft_bench(int iterations)
     }
 }
 
+
+/* =========================================================
+ * Varianti con N scelto a runtime (fft_bench.h)
+ * ========================================================= */
+
+#define FFT_2PI 6.283185307179586
+
+static int32_t fft_n;          /* taglia corrente, 0 se non valida */
+static float   fft_inv_n;
+
+/* W_n^k = exp(-j 2 pi k / n) per k < 3n/4 (radix-4 e split-radix usano W^3k) */
+static float   tw_re[FFT_MAX_N * 3 / 4];
+static float   tw_im[FFT_MAX_N * 3 / 4];
+/* gli stessi in Q15, k < n/2 */
+static int16_t twq_re[FFT_MAX_N / 2];
+static int16_t twq_im[FFT_MAX_N / 2];
+
+/* input del frame e buffer di lavoro: float o Q15 a seconda della variante */
+static union { float f[2 * FFT_MAX_N]; int16_t q[2 * FFT_MAX_N]; } fft_in, fft_out;
+
+/* ---------------------------------------------------------
+ * Twiddle generati in init (niente libm nel modulo wasm)
+ * --------------------------------------------------------- */
+
+/* sin e cos per x in [0, pi/4]: Taylor in double, errore < 1e-20 */
+static void sincos_octant(double x, double *s, double *c)
+{
+    double x2 = x * x;
+    double ts = x, tc = 1.0;
+    double sum_s = x, sum_c = 1.0;
+
+    for (int k = 1; k <= 10; ++k) {
+        ts *= -x2 / (double)((2 * k) * (2 * k + 1));
+        tc *= -x2 / (double)((2 * k - 1) * (2 * k));
+        sum_s += ts;
+        sum_c += tc;
+    }
+    *s = sum_s;
+    *c = sum_c;
+}
+
+/* W_n^k, riducendo l'angolo al primo ottante con aritmetica intera */
+static void twiddle(int32_t k, int32_t n, double *re, double *im)
+{
+    int32_t quarter = n / 4;
+    int32_t q = (k / quarter) & 3;
+    int32_t r = k % quarter;
+    double s, c, cos_t, sin_t;
+
+    if (2 * r <= quarter) {
+        sincos_octant(FFT_2PI * (double)r / (double)n, &s, &c);
+        cos_t = c;
+        sin_t = s;
+    } else {
+        /* cos(pi/2 - a) = sin(a) */
+        sincos_octant(FFT_2PI * (double)(quarter - r) / (double)n, &s, &c);
+        cos_t = s;
+        sin_t = c;
+    }
+    /* angolo = q * pi/2 + theta */
+    switch (q) {
+    case 0:  *re =  cos_t; *im = -sin_t; break;
+    case 1:  *re = -sin_t; *im = -cos_t; break;
+    case 2:  *re = -cos_t; *im =  sin_t; break;
+    default: *re =  sin_t; *im =  cos_t; break;
+    }
+}
+
+static int16_t q15_from_double(double v)
+{
+    double x = v * 32767.0;
+    return (int16_t)(int32_t)(x >= 0.0 ? x + 0.5 : x - 0.5);
+}
+
+static int16_t q15_sat(int32_t v)
+{
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (int16_t)v;
+}
+
+/* LCG di Numerical Recipes: stesso input su ogni target */
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+/*
+ * Prepara twiddle e input per n campioni (count valori: 2n complessi, n
+ * reali). L'input è rumore in [-0.5, 0.5): in Q15 è lo stesso segnale, così
+ * le varianti float e Q15 trasformano gli stessi dati.
+ */
+static int32_t fft_setup(int32_t n, int32_t count, int q15)
+{
+    uint32_t seed = 42;
+
+    if (n < FFT_MIN_N || n > FFT_MAX_N || (n & (n - 1)) != 0) {
+        fft_n = 0;
+        return 0;
+    }
+    fft_n = n;
+    fft_inv_n = 1.0f / (float)n;
+
+    for (int32_t k = 0; k < n * 3 / 4; ++k) {
+        double re, im;
+        twiddle(k, n, &re, &im);
+        tw_re[k] = (float)re;
+        tw_im[k] = (float)im;
+        if (k < n / 2) {
+            twq_re[k] = q15_from_double(re);
+            twq_im[k] = q15_from_double(im);
+        }
+    }
+
+    for (int32_t i = 0; i < count; ++i) {
+        int16_t v = (int16_t)((int32_t)lcg_next(&seed) >> 17);
+        if (q15) {
+            fft_in.q[i] = v;
+        } else {
+            fft_in.f[i] = (float)v / 32768.0f;
+        }
+    }
+    return n;
+}
+
+/* FNV-1a sui byte dell'output (tutti i target sono little endian) */
+static uint32_t fnv1a_bytes(const uint8_t *p, uint32_t len)
+{
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* ---------------------------------------------------------
+ * Nuclei: m punti complessi, W_m^k = tw[k * step] (step = n / m)
+ * --------------------------------------------------------- */
+
+/* copia m complessi in ordine bit-reversed: il primo passo di ogni DIT */
+static void load_bitrev(float *dst, const float *src, int32_t m)
+{
+    int32_t j = 0;
+    for (int32_t i = 0; i < m; ++i) {
+        dst[2*j+0] = src[2*i+0];
+        dst[2*j+1] = src[2*i+1];
+        int32_t bit = m >> 1;
+        while (j & bit) { j ^= bit; bit >>= 1; }
+        j |= bit;
+    }
+}
+
+static void load_bitrev_q15(int16_t *dst, const int16_t *src, int32_t m)
+{
+    int32_t j = 0;
+    for (int32_t i = 0; i < m; ++i) {
+        dst[2*j+0] = src[2*i+0];
+        dst[2*j+1] = src[2*i+1];
+        int32_t bit = m >> 1;
+        while (j & bit) { j ^= bit; bit >>= 1; }
+        j |= bit;
+    }
+}
+
+static void cfft_r2(float *b, int32_t m, int32_t step)
+{
+    for (int32_t len = 2; len <= m; len <<= 1) {
+        int32_t half_len = len >> 1;
+        int32_t stride   = (m / len) * step;
+
+        for (int32_t i = 0; i < m; i += len) {
+            for (int32_t j = 0; j < half_len; j++) {
+                int32_t idx1 = i + j;
+                int32_t idx2 = idx1 + half_len;
+                int32_t k    = j * stride;
+
+                float wr = tw_re[k];
+                float wi = tw_im[k];
+
+                float xr = b[2*idx2+0];
+                float xi = b[2*idx2+1];
+
+                float tr = wr*xr - wi*xi;
+                float ti = wr*xi + wi*xr;
+
+                float ur = b[2*idx1+0];
+                float ui = b[2*idx1+1];
+
+                b[2*idx1+0] = ur + tr;
+                b[2*idx1+1] = ui + ti;
+                b[2*idx2+0] = ur - tr;
+                b[2*idx2+1] = ui - ti;
+            }
+        }
+    }
+}
+
+/*
+ * Radix-4 su input bit-reversed (base 2): nel gruppo di 4L punti i quattro
+ * blocchi da L contengono le sotto-DFT dei campioni con indice = 0, 2, 1, 3
+ * (mod 4). Tre moltiplicazioni complesse per farfalla, metà dei passaggi
+ * sulla memoria rispetto al radix-2.
+ */
+static void cfft_r4(float *b, int32_t m, int32_t step)
+{
+    int32_t L = 1;
+    int32_t log2m = 0;
+
+    while ((1 << log2m) < m) log2m++;
+    if (log2m & 1) {
+        /* log2 m dispari: un passo radix-2 (twiddle 1) e poi solo radix-4 */
+        for (int32_t i = 0; i < m; i += 2) {
+            float ar = b[2*i+0], ai = b[2*i+1];
+            float cr = b[2*i+2], ci = b[2*i+3];
+            b[2*i+0] = ar + cr;
+            b[2*i+1] = ai + ci;
+            b[2*i+2] = ar - cr;
+            b[2*i+3] = ai - ci;
+        }
+        L = 2;
+    }
+
+    for (; 4 * L <= m; L <<= 2) {
+        int32_t stride = (m / (4 * L)) * step;
+
+        for (int32_t i = 0; i < m; i += 4 * L) {
+            for (int32_t j = 0; j < L; j++) {
+                int32_t p0 = i + j, p1 = p0 + L, p2 = p1 + L, p3 = p2 + L;
+                int32_t k  = j * stride;
+
+                float w1r = tw_re[k],     w1i = tw_im[k];
+                float w2r = tw_re[2 * k], w2i = tw_im[2 * k];
+                float w3r = tw_re[3 * k], w3i = tw_im[3 * k];
+
+                float ar = b[2*p0+0], ai = b[2*p0+1];
+                float xr, xi;
+
+                /* B = W^2j * x(p1), C = W^j * x(p2), D = W^3j * x(p3) */
+                xr = b[2*p1+0]; xi = b[2*p1+1];
+                float br = w2r*xr - w2i*xi, bi = w2r*xi + w2i*xr;
+                xr = b[2*p2+0]; xi = b[2*p2+1];
+                float cr = w1r*xr - w1i*xi, ci = w1r*xi + w1i*xr;
+                xr = b[2*p3+0]; xi = b[2*p3+1];
+                float dr = w3r*xr - w3i*xi, di = w3r*xi + w3i*xr;
+
+                float s0r = ar + br, s0i = ai + bi;
+                float s1r = ar - br, s1i = ai - bi;
+                float s2r = cr + dr, s2i = ci + di;
+                float s3r = cr - dr, s3i = ci - di;
+
+                b[2*p0+0] = s0r + s2r;
+                b[2*p0+1] = s0i + s2i;
+                b[2*p2+0] = s0r - s2r;
+                b[2*p2+1] = s0i - s2i;
+                /* X1 = s1 - j*s3, X3 = s1 + j*s3 */
+                b[2*p1+0] = s1r + s3i;
+                b[2*p1+1] = s1i - s3r;
+                b[2*p3+0] = s1r - s3i;
+                b[2*p3+1] = s1i + s3r;
+            }
+        }
+    }
+}
+
+/*
+ * Split-radix DIT ricorsiva sullo stesso layout bit-reversed: [0, m/2) sono
+ * i campioni pari, [m/2, 3m/4) quelli = 1 (mod 4), [3m/4, m) quelli = 3.
+ */
+static void cfft_sr(float *b, int32_t m, int32_t step)
+{
+    if (m < 2) return;
+    if (m == 2) {
+        float ar = b[0], ai = b[1];
+        b[0] = ar + b[2];
+        b[1] = ai + b[3];
+        b[2] = ar - b[2];
+        b[3] = ai - b[3];
+        return;
+    }
+
+    int32_t q = m >> 2;
+    cfft_sr(b, m >> 1, step << 1);
+    cfft_sr(b + 2 * (2 * q), q, step << 2);
+    cfft_sr(b + 2 * (3 * q), q, step << 2);
+
+    for (int32_t k = 0; k < q; ++k) {
+        int32_t k1 = k * step, k3 = 3 * k1;
+        float w1r = tw_re[k1], w1i = tw_im[k1];
+        float w3r = tw_re[k3], w3i = tw_im[k3];
+
+        float zr = b[2*(2*q+k)+0], zi = b[2*(2*q+k)+1];
+        float yr = b[2*(3*q+k)+0], yi = b[2*(3*q+k)+1];
+        float t1r = w1r*zr - w1i*zi, t1i = w1r*zi + w1i*zr;
+        float t2r = w3r*yr - w3i*yi, t2i = w3r*yi + w3i*yr;
+        float sr = t1r + t2r, si = t1i + t2i;
+        float dr = t1r - t2r, di = t1i - t2i;
+
+        float u0r = b[2*k+0],     u0i = b[2*k+1];
+        float u1r = b[2*(q+k)+0], u1i = b[2*(q+k)+1];
+
+        b[2*k+0]       = u0r + sr;
+        b[2*k+1]       = u0i + si;
+        b[2*(2*q+k)+0] = u0r - sr;
+        b[2*(2*q+k)+1] = u0i - si;
+        /* X[k+m/4] = U1 - j*d, X[k+3m/4] = U1 + j*d */
+        b[2*(q+k)+0]   = u1r + di;
+        b[2*(q+k)+1]   = u1i - dr;
+        b[2*(3*q+k)+0] = u1r - di;
+        b[2*(3*q+k)+1] = u1i + dr;
+    }
+}
+
+/*
+ * Da Z = FFT di n/2 punti di z[m] = x[2m] + j x[2m+1] alle n/2 + 1 bin della
+ * FFT reale. Come in CMSIS, b[1] (immaginaria di X[0], sempre nulla) porta
+ * la parte reale di X[n/2].
+ */
+static void rfft_split(float *b, int32_t n)
+{
+    int32_t half = n >> 1;
+    float z0r = b[0], z0i = b[1];
+
+    b[0] = z0r + z0i;
+    b[1] = z0r - z0i;
+
+    for (int32_t k = 1; k <= half / 2; ++k) {
+        int32_t kc = half - k;
+        float zr = b[2*k+0],  zi = b[2*k+1];
+        float cr = b[2*kc+0], ci = -b[2*kc+1];         /* conj(Z[n/2-k]) */
+
+        float er = (zr + cr) * 0.5f, ei = (zi + ci) * 0.5f;
+        float or_ = (zi - ci) * 0.5f, oi = (cr - zr) * 0.5f;   /* -j * (Z - conj) / 2 */
+        float tr = tw_re[k]*or_ - tw_im[k]*oi;
+        float ti = tw_re[k]*oi  + tw_im[k]*or_;
+
+        b[2*k+0]  = er + tr;
+        b[2*k+1]  = ei + ti;
+        b[2*kc+0] = er - tr;
+        b[2*kc+1] = ti - ei;
+    }
+}
+
+/* radix-2 Q15: ingressi dimezzati a ogni stadio, uscita = X / m */
+static void cfft_q15(int16_t *b, int32_t m, int32_t step)
+{
+    for (int32_t len = 2; len <= m; len <<= 1) {
+        int32_t half_len = len >> 1;
+        int32_t stride   = (m / len) * step;
+
+        for (int32_t i = 0; i < m; i += len) {
+            for (int32_t j = 0; j < half_len; j++) {
+                int32_t idx1 = i + j;
+                int32_t idx2 = idx1 + half_len;
+                int32_t k    = j * stride;
+
+                int32_t wr = twq_re[k];
+                int32_t wi = twq_im[k];
+
+                int32_t xr = b[2*idx2+0] >> 1;
+                int32_t xi = b[2*idx2+1] >> 1;
+
+                int32_t tr = (wr*xr - wi*xi) >> 15;
+                int32_t ti = (wr*xi + wi*xr) >> 15;
+
+                int32_t ur = b[2*idx1+0] >> 1;
+                int32_t ui = b[2*idx1+1] >> 1;
+
+                b[2*idx1+0] = q15_sat(ur + tr);
+                b[2*idx1+1] = q15_sat(ui + ti);
+                b[2*idx2+0] = q15_sat(ur - tr);
+                b[2*idx2+1] = q15_sat(ui - ti);
+            }
+        }
+    }
+}
+
+/* come rfft_split, con un ulteriore 1/2 per restare in Q15: uscita = X / n */
+static void rfft_split_q15(int16_t *b, int32_t n)
+{
+    int32_t half = n >> 1;
+    int32_t z0r = b[0], z0i = b[1];
+
+    b[0] = q15_sat((z0r + z0i) >> 1);
+    b[1] = q15_sat((z0r - z0i) >> 1);
+
+    for (int32_t k = 1; k <= half / 2; ++k) {
+        int32_t kc = half - k;
+        int32_t zr = b[2*k+0],  zi = b[2*k+1];
+        int32_t cr = b[2*kc+0], ci = -b[2*kc+1];
+
+        int32_t er = (zr + cr) >> 2, ei = (zi + ci) >> 2;
+        int32_t or_ = (zi - ci) >> 2, oi = (cr - zr) >> 2;
+        int32_t tr = ((int32_t)twq_re[k]*or_ - (int32_t)twq_im[k]*oi) >> 15;
+        int32_t ti = ((int32_t)twq_re[k]*oi  + (int32_t)twq_im[k]*or_) >> 15;
+
+        b[2*k+0]  = q15_sat(er + tr);
+        b[2*k+1]  = q15_sat(ei + ti);
+        b[2*kc+0] = q15_sat(er - tr);
+        b[2*kc+1] = q15_sat(ti - ei);
+    }
+}
+
+/* ---------------------------------------------------------
+ * API esportate: V_init(n), V_bench(iterations), V_checksum()
+ * --------------------------------------------------------- */
+
+/* il DC del frame (scalato a [-0.5, 0.5)) diventa il primo campione del successivo */
+#define FEEDBACK_F()   (fft_in.f[0] = fft_out.f[0] * fft_inv_n)
+#define FEEDBACK_Q15() (fft_in.q[0] = fft_out.q[0])
+
+WASM_EXPORT("fft_r2_init")
+void fft_r2_init(int32_t n) { fft_setup(n, 2 * n, 0); }
+
+WASM_EXPORT("fft_r2_bench")
+void fft_r2_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev(fft_out.f, fft_in.f, fft_n);
+        cfft_r2(fft_out.f, fft_n, 1);
+        FEEDBACK_F();
+    }
+}
+
+WASM_EXPORT("fft_r2_checksum")
+uint32_t fft_r2_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.f, 8u * (uint32_t)fft_n) : 0;
+}
+
+WASM_EXPORT("fft_r4_init")
+void fft_r4_init(int32_t n) { fft_setup(n, 2 * n, 0); }
+
+WASM_EXPORT("fft_r4_bench")
+void fft_r4_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev(fft_out.f, fft_in.f, fft_n);
+        cfft_r4(fft_out.f, fft_n, 1);
+        FEEDBACK_F();
+    }
+}
+
+WASM_EXPORT("fft_r4_checksum")
+uint32_t fft_r4_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.f, 8u * (uint32_t)fft_n) : 0;
+}
+
+WASM_EXPORT("fft_sr_init")
+void fft_sr_init(int32_t n) { fft_setup(n, 2 * n, 0); }
+
+WASM_EXPORT("fft_sr_bench")
+void fft_sr_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev(fft_out.f, fft_in.f, fft_n);
+        cfft_sr(fft_out.f, fft_n, 1);
+        FEEDBACK_F();
+    }
+}
+
+WASM_EXPORT("fft_sr_checksum")
+uint32_t fft_sr_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.f, 8u * (uint32_t)fft_n) : 0;
+}
+
+WASM_EXPORT("rfft_init")
+void rfft_init(int32_t n) { fft_setup(n, n, 0); }
+
+WASM_EXPORT("rfft_bench")
+void rfft_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev(fft_out.f, fft_in.f, fft_n / 2);
+        cfft_r4(fft_out.f, fft_n / 2, 2);
+        rfft_split(fft_out.f, fft_n);
+        FEEDBACK_F();
+    }
+}
+
+WASM_EXPORT("rfft_checksum")
+uint32_t rfft_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.f, 4u * (uint32_t)fft_n) : 0;
+}
+
+WASM_EXPORT("fft_q15_init")
+void fft_q15_init(int32_t n) { fft_setup(n, 2 * n, 1); }
+
+WASM_EXPORT("fft_q15_bench")
+void fft_q15_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev_q15(fft_out.q, fft_in.q, fft_n);
+        cfft_q15(fft_out.q, fft_n, 1);
+        FEEDBACK_Q15();
+    }
+}
+
+WASM_EXPORT("fft_q15_checksum")
+uint32_t fft_q15_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.q, 4u * (uint32_t)fft_n) : 0;
+}
+
+WASM_EXPORT("rfft_q15_init")
+void rfft_q15_init(int32_t n) { fft_setup(n, n, 1); }
+
+WASM_EXPORT("rfft_q15_bench")
+void rfft_q15_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev_q15(fft_out.q, fft_in.q, fft_n / 2);
+        cfft_q15(fft_out.q, fft_n / 2, 2);
+        rfft_split_q15(fft_out.q, fft_n);
+        FEEDBACK_Q15();
+    }
+}
+
+WASM_EXPORT("rfft_q15_checksum")
+uint32_t rfft_q15_checksum(void)
+{
+    return fft_n ? fnv1a_bytes((const uint8_t *)fft_out.q, 2u * (uint32_t)fft_n) : 0;
+}
+
+#ifdef BENCH_SIMD
+/* ---------------------------------------------------------
+ * Radix-2 SIMD128: due farfalle (j, j+1) per vettore sui complessi
+ * interlacciati [re0 im0 re1 im1]. Le operazioni per lane sono quelle di
+ * cfft_r2, quindi l'uscita è identica bit a bit.
+ * --------------------------------------------------------- */
+static void cfft_r2_simd(float *b, int32_t m, int32_t step)
+{
+    /* (wi * swap(x)) * sign = [-wi*xi, wi*xr, ...] */
+    const bsimd_f32x4 sign = bsimd_make_f32(-1.0f, 1.0f, -1.0f, 1.0f);
+
+    /* len = 2 (una farfalla per gruppo): come cfft_r2 */
+    for (int32_t i = 0; i < m; i += 2) {
+        float wr = tw_re[0], wi = tw_im[0];
+        float xr = b[2*i+2], xi = b[2*i+3];
+        float tr = wr*xr - wi*xi;
+        float ti = wr*xi + wi*xr;
+        float ur = b[2*i+0], ui = b[2*i+1];
+        b[2*i+0] = ur + tr;
+        b[2*i+1] = ui + ti;
+        b[2*i+2] = ur - tr;
+        b[2*i+3] = ui - ti;
+    }
+
+    for (int32_t len = 4; len <= m; len <<= 1) {
+        int32_t half_len = len >> 1;
+        int32_t stride   = (m / len) * step;
+
+        for (int32_t i = 0; i < m; i += len) {
+            for (int32_t j = 0; j < half_len; j += 2) {
+                int32_t idx1 = i + j;
+                int32_t idx2 = idx1 + half_len;
+                int32_t k0   = j * stride;
+                int32_t k1   = k0 + stride;
+
+                bsimd_f32x4 wr = bsimd_make_f32(tw_re[k0], tw_re[k0], tw_re[k1], tw_re[k1]);
+                bsimd_f32x4 wi = bsimd_make_f32(tw_im[k0], tw_im[k0], tw_im[k1], tw_im[k1]);
+                bsimd_f32x4 x  = bsimd_load_f32(&b[2*idx2]);
+                bsimd_f32x4 u  = bsimd_load_f32(&b[2*idx1]);
+
+                bsimd_f32x4 t = bsimd_add_f32(bsimd_mul_f32(wr, x),
+                                              bsimd_mul_f32(bsimd_mul_f32(wi, bsimd_swap_pairs_f32(x)), sign));
+
+                bsimd_store_f32(&b[2*idx1], bsimd_add_f32(u, t));
+                bsimd_store_f32(&b[2*idx2], bsimd_sub_f32(u, t));
+            }
+        }
+    }
+}
+
+WASM_EXPORT("fft_r2_simd_init")
+void fft_r2_simd_init(int32_t n) { fft_setup(n, 2 * n, 0); }
+
+WASM_EXPORT("fft_r2_simd_bench")
+void fft_r2_simd_bench(int32_t iterations)
+{
+    if (!fft_n) return;
+    for (int32_t it = 0; it < iterations; ++it) {
+        load_bitrev(fft_out.f, fft_in.f, fft_n);
+        cfft_r2_simd(fft_out.f, fft_n, 1);
+        FEEDBACK_F();
+    }
+}
+
+WASM_EXPORT("fft_r2_simd_checksum")
+uint32_t fft_r2_simd_checksum(void) { return fft_r2_checksum(); }
+#endif /* BENCH_SIMD */
+
+#if !(defined(__wasm__) || defined(__wasm))
+const fft_variant_desc_t fft_variants[FFT_VARIANT_LEN] = {
+    { "fft_r2",   fft_r2_init,   fft_r2_bench,   fft_r2_checksum   },
+    { "fft_r4",   fft_r4_init,   fft_r4_bench,   fft_r4_checksum   },
+    { "fft_sr",   fft_sr_init,   fft_sr_bench,   fft_sr_checksum   },
+    { "rfft",     rfft_init,     rfft_bench,     rfft_checksum     },
+    { "fft_q15",  fft_q15_init,  fft_q15_bench,  fft_q15_checksum  },
+    { "rfft_q15", rfft_q15_init, rfft_q15_bench, rfft_q15_checksum },
+};
+#endif
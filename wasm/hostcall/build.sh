@@ -0,0 +1,50 @@
+#!/bin/sh
+# Modulo del benchmark delle chiamate host: wasm, header C per gli MCU e AOT.
+#
+#   wasm/hostcall/build.sh           (PYTHON, WAMRC sovrascrivibili da env)
+#
+# Produce, accanto a questo script:
+#   hostcall_bench.wasm        scritto da hostcall_gen.py, niente toolchain
+#   hostcall_bench.wasm.h      xxd -i del .wasm, per wasm3/WAMR interp su MCU
+#   f4/, f7/ hostcall_bench.aot, hostcall_bench_aot.h   AOT per famiglia
+#                              (flag da aot_target.py, come il gateway)
+#   hostcall_bench.x86_64.aot  AOT host per linux_bench
+# e copia header e sorgenti nelle app Zephyr: il modulo e gli import
+# (hostcall_wasm3.h / hostcall_wamr.h) in quelle wasm, la baseline
+# hostcall_bench.c in quelle native.
+set -e
+
+cd "$(dirname "$0")"
+PYTHON=${PYTHON:-python3}
+WAMRC=${WAMRC:-wamrc}
+REPO=../..
+
+"$PYTHON" hostcall_gen.py -o hostcall_bench.wasm
+xxd -i hostcall_bench.wasm > hostcall_bench.wasm.h
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    mkdir -p $fam
+    "$WAMRC" $("$PYTHON" $REPO/aot_target.py --family $fam) -o $fam/hostcall_bench.aot hostcall_bench.wasm
+    (cd $fam && xxd -i hostcall_bench.aot) > $fam/hostcall_bench_aot.h
+  done
+  "$WAMRC" --target=x86_64 -o hostcall_bench.x86_64.aot hostcall_bench.wasm
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
+
+for dst in zephyrproject/z_wasm3_fft_f4/src zephyrproject/z_wasm3_fft_f7/src; do
+  cp hostcall_bench.wasm.h hostcall_bench.h hostcall_wasm3.h "$REPO/$dst/"
+done
+for dst in zephyrproject/z_wamr_interp_fft_f4/src zephyrproject/z_wamr_interp_fft_f7/src; do
+  cp hostcall_bench.wasm.h hostcall_bench.h hostcall_wamr.h "$REPO/$dst/"
+done
+for fam in f4 f7; do
+  if [ -f $fam/hostcall_bench_aot.h ]; then
+    cp $fam/hostcall_bench_aot.h hostcall_bench.h hostcall_wamr.h \
+      "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  fi
+done
+for dst in zephyrproject/z_native_fft_f4/src zephyrproject/z_native_fft_f7/src; do
+  cp hostcall_bench.c hostcall_bench.h "$REPO/$dst/"
+done
@@ -0,0 +1,192 @@
+unsigned char hostcall_bench_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x0a, 0x60,
+  0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x60, 0x04, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x00, 0x60, 0x08, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0x60, 0x04, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x60, 0x04, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x00, 0x60, 0x04, 0x7f, 0x7e, 0x7d, 0x7c, 0x00, 0x60, 0x01, 0x7f,
+  0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x01, 0x7f,
+  0x02, 0xd9, 0x01, 0x0e, 0x03, 0x65, 0x6e, 0x76, 0x07, 0x68, 0x63, 0x5f,
+  0x76, 0x6f, 0x69, 0x64, 0x00, 0x00, 0x03, 0x65, 0x6e, 0x76, 0x08, 0x68,
+  0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x31, 0x00, 0x01, 0x03, 0x65, 0x6e,
+  0x76, 0x08, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x34, 0x00, 0x02,
+  0x03, 0x65, 0x6e, 0x76, 0x08, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f,
+  0x38, 0x00, 0x03, 0x03, 0x65, 0x6e, 0x76, 0x08, 0x68, 0x63, 0x5f, 0x69,
+  0x36, 0x34, 0x5f, 0x34, 0x00, 0x04, 0x03, 0x65, 0x6e, 0x76, 0x08, 0x68,
+  0x63, 0x5f, 0x66, 0x36, 0x34, 0x5f, 0x34, 0x00, 0x05, 0x03, 0x65, 0x6e,
+  0x76, 0x08, 0x68, 0x63, 0x5f, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x00, 0x06,
+  0x03, 0x65, 0x6e, 0x76, 0x06, 0x68, 0x63, 0x5f, 0x72, 0x65, 0x74, 0x00,
+  0x07, 0x03, 0x65, 0x6e, 0x76, 0x06, 0x68, 0x63, 0x5f, 0x73, 0x74, 0x72,
+  0x00, 0x07, 0x03, 0x65, 0x6e, 0x76, 0x06, 0x68, 0x63, 0x5f, 0x62, 0x75,
+  0x66, 0x00, 0x08, 0x03, 0x65, 0x6e, 0x76, 0x0b, 0x68, 0x63, 0x5f, 0x72,
+  0x61, 0x77, 0x5f, 0x76, 0x6f, 0x69, 0x64, 0x00, 0x00, 0x03, 0x65, 0x6e,
+  0x76, 0x0c, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32,
+  0x5f, 0x34, 0x00, 0x02, 0x03, 0x65, 0x6e, 0x76, 0x0c, 0x68, 0x63, 0x5f,
+  0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x38, 0x00, 0x03, 0x03,
+  0x65, 0x6e, 0x76, 0x0a, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x73,
+  0x74, 0x72, 0x00, 0x07, 0x03, 0x32, 0x31, 0x07, 0x00, 0x01, 0x09, 0x00,
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00,
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00,
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00,
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x05, 0x03, 0x01, 0x00,
+  0x01, 0x06, 0x06, 0x01, 0x7f, 0x01, 0x41, 0x00, 0x0b, 0x07, 0xe9, 0x06,
+  0x31, 0x0c, 0x68, 0x63, 0x5f, 0x6c, 0x6f, 0x6f, 0x70, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x0f, 0x0d, 0x68, 0x63, 0x5f, 0x6c, 0x6f, 0x6f, 0x70,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x10, 0x10, 0x68, 0x63, 0x5f,
+  0x6c, 0x6f, 0x6f, 0x70, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x11, 0x0d, 0x68, 0x63, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x12, 0x0e, 0x68, 0x63, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x13,
+  0x11, 0x68, 0x63, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x14, 0x0c, 0x68, 0x63, 0x5f,
+  0x76, 0x6f, 0x69, 0x64, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x15, 0x0d,
+  0x68, 0x63, 0x5f, 0x76, 0x6f, 0x69, 0x64, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x16, 0x10, 0x68, 0x63, 0x5f, 0x76, 0x6f, 0x69, 0x64, 0x5f,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x17, 0x0d, 0x68,
+  0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x31, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x18, 0x0e, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x31, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x19, 0x11, 0x68, 0x63, 0x5f, 0x69,
+  0x33, 0x32, 0x5f, 0x31, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x1a, 0x0d, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x34,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x1b, 0x0e, 0x68, 0x63, 0x5f, 0x69,
+  0x33, 0x32, 0x5f, 0x34, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x1c,
+  0x11, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x34, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x1d, 0x0d, 0x68, 0x63, 0x5f,
+  0x69, 0x33, 0x32, 0x5f, 0x38, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x1e,
+  0x0e, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x38, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x00, 0x1f, 0x11, 0x68, 0x63, 0x5f, 0x69, 0x33, 0x32,
+  0x5f, 0x38, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00,
+  0x20, 0x0d, 0x68, 0x63, 0x5f, 0x69, 0x36, 0x34, 0x5f, 0x34, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x21, 0x0e, 0x68, 0x63, 0x5f, 0x69, 0x36, 0x34,
+  0x5f, 0x34, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x22, 0x11, 0x68,
+  0x63, 0x5f, 0x69, 0x36, 0x34, 0x5f, 0x34, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x23, 0x0d, 0x68, 0x63, 0x5f, 0x66, 0x36,
+  0x34, 0x5f, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x24, 0x0e, 0x68,
+  0x63, 0x5f, 0x66, 0x36, 0x34, 0x5f, 0x34, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x25, 0x11, 0x68, 0x63, 0x5f, 0x66, 0x36, 0x34, 0x5f, 0x34,
+  0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x26, 0x0d,
+  0x68, 0x63, 0x5f, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x69,
+  0x74, 0x00, 0x27, 0x0e, 0x68, 0x63, 0x5f, 0x6d, 0x69, 0x78, 0x65, 0x64,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x28, 0x11, 0x68, 0x63, 0x5f,
+  0x6d, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+  0x75, 0x6d, 0x00, 0x29, 0x0b, 0x68, 0x63, 0x5f, 0x72, 0x65, 0x74, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x2a, 0x0c, 0x68, 0x63, 0x5f, 0x72, 0x65,
+  0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x2b, 0x0f, 0x68, 0x63,
+  0x5f, 0x72, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x2c, 0x0b, 0x68, 0x63, 0x5f, 0x73, 0x74, 0x72, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x2d, 0x0c, 0x68, 0x63, 0x5f, 0x73, 0x74, 0x72,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x2e, 0x0f, 0x68, 0x63, 0x5f,
+  0x73, 0x74, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x00, 0x2f, 0x0b, 0x68, 0x63, 0x5f, 0x62, 0x75, 0x66, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x30, 0x0c, 0x68, 0x63, 0x5f, 0x62, 0x75, 0x66, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x31, 0x0f, 0x68, 0x63, 0x5f, 0x62,
+  0x75, 0x66, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00,
+  0x32, 0x10, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x76, 0x6f, 0x69,
+  0x64, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x33, 0x11, 0x68, 0x63, 0x5f,
+  0x72, 0x61, 0x77, 0x5f, 0x76, 0x6f, 0x69, 0x64, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x00, 0x34, 0x14, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f,
+  0x76, 0x6f, 0x69, 0x64, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x35, 0x11, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x69,
+  0x33, 0x32, 0x5f, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x36, 0x12,
+  0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x34,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x37, 0x15, 0x68, 0x63, 0x5f,
+  0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x34, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x38, 0x11, 0x68, 0x63, 0x5f,
+  0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32, 0x5f, 0x38, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x39, 0x12, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f,
+  0x69, 0x33, 0x32, 0x5f, 0x38, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00,
+  0x3a, 0x15, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x69, 0x33, 0x32,
+  0x5f, 0x38, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00,
+  0x3b, 0x0f, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x73, 0x74, 0x72,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x3c, 0x10, 0x68, 0x63, 0x5f, 0x72,
+  0x61, 0x77, 0x5f, 0x73, 0x74, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x3d, 0x13, 0x68, 0x63, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x73, 0x74,
+  0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x3e,
+  0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x02, 0x00, 0x0a, 0xab, 0x07,
+  0x31, 0x07, 0x00, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x0b, 0x06, 0x00, 0x41,
+  0x00, 0x24, 0x00, 0x0b, 0x24, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00,
+  0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x41, 0x01, 0x23, 0x00, 0x6a,
+  0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48,
+  0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00,
+  0x41, 0x00, 0x24, 0x00, 0x0b, 0x26, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20,
+  0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x20, 0x01, 0x10, 0x0e,
+  0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01,
+  0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00,
+  0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x26, 0x01, 0x01, 0x7f,
+  0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x10,
+  0x00, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01,
+  0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04,
+  0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x28,
+  0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00,
+  0x03, 0x40, 0x20, 0x01, 0x10, 0x01, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24,
+  0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d,
+  0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41,
+  0x00, 0x24, 0x00, 0x0b, 0x2e, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00,
+  0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x20, 0x01, 0x41, 0x02, 0x41,
+  0x03, 0x41, 0x04, 0x10, 0x02, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00,
+  0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00,
+  0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00,
+  0x24, 0x00, 0x0b, 0x36, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x20, 0x01, 0x41, 0x02, 0x41, 0x03,
+  0x41, 0x04, 0x41, 0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x08, 0x10, 0x03,
+  0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a,
+  0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00,
+  0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x2e, 0x01,
+  0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03,
+  0x40, 0x42, 0x01, 0x42, 0x02, 0x42, 0x03, 0x42, 0x04, 0x10, 0x04, 0x41,
+  0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22,
+  0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23,
+  0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x4a, 0x01, 0x01,
+  0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x40,
+  0x10, 0x05, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41,
+  0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b,
+  0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b,
+  0x38, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d,
+  0x00, 0x03, 0x40, 0x20, 0x01, 0x42, 0x02, 0x43, 0x00, 0x00, 0x60, 0x40,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x40, 0x10, 0x06, 0x41,
+  0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22,
+  0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23,
+  0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x26, 0x01, 0x01,
+  0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40,
+  0x20, 0x01, 0x10, 0x07, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41,
+  0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b,
+  0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b,
+  0x26, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d,
+  0x00, 0x03, 0x40, 0x41, 0x10, 0x10, 0x08, 0x23, 0x00, 0x6a, 0x24, 0x00,
+  0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00,
+  0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00,
+  0x24, 0x00, 0x0b, 0x2a, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x41, 0xc0, 0x00, 0x41, 0xc0, 0x00,
+  0x10, 0x09, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a,
+  0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00,
+  0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x26, 0x01,
+  0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03,
+  0x40, 0x10, 0x0a, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01,
+  0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b,
+  0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00,
+  0x0b, 0x2e, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x03, 0x40, 0x20, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x04,
+  0x10, 0x0b, 0x41, 0x01, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41,
+  0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b,
+  0x04, 0x00, 0x23, 0x00, 0x0b, 0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b,
+  0x36, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d,
+  0x00, 0x03, 0x40, 0x20, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x04, 0x41,
+  0x05, 0x41, 0x06, 0x41, 0x07, 0x41, 0x08, 0x10, 0x0c, 0x41, 0x01, 0x23,
+  0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20,
+  0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00, 0x23, 0x00, 0x0b,
+  0x06, 0x00, 0x41, 0x00, 0x24, 0x00, 0x0b, 0x26, 0x01, 0x01, 0x7f, 0x02,
+  0x40, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x03, 0x40, 0x41, 0x10,
+  0x10, 0x0d, 0x23, 0x00, 0x6a, 0x24, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a,
+  0x22, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x04, 0x00,
+  0x23, 0x00, 0x0b, 0x0b, 0x55, 0x02, 0x00, 0x41, 0x10, 0x0b, 0x09, 0x68,
+  0x6f, 0x73, 0x74, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x41, 0xc0, 0x00,
+  0x0b, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+  0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21,
+  0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d,
+  0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f
+};
+unsigned int hostcall_bench_wasm_len = 2262;
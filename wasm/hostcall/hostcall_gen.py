@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""
+Generatore del modulo hostcall_bench.wasm (costo delle chiamate wasm -> host,
+vedi hostcall_bench.h): binario scritto direttamente, senza toolchain, così
+ogni iterazione contiene esattamente una call all'import e nient'altro che
+un compilatore potrebbe spostare o eliminare.
+
+    python3 hostcall_gen.py -o hostcall_bench.wasm
+
+Per ogni kernel K: K_bench(n) fa n chiamate, K_init() azzera acc e
+K_checksum() lo ritorna. Init e checksum sono funzioni distinte per kernel:
+wasm3 tiene pochi nomi di export per funzione.
+"""
+import argparse
+import struct
+
+I32, I64, F32, F64 = 0x7F, 0x7E, 0x7D, 0x7C
+
+OP_BLOCK, OP_LOOP, OP_END, OP_BR_IF, OP_CALL = 0x02, 0x03, 0x0B, 0x0D, 0x10
+OP_LOCAL_GET, OP_LOCAL_SET, OP_LOCAL_TEE = 0x20, 0x21, 0x22
+OP_GLOBAL_GET, OP_GLOBAL_SET = 0x23, 0x24
+OP_I32_CONST, OP_I64_CONST, OP_F32_CONST, OP_F64_CONST = 0x41, 0x42, 0x43, 0x44
+OP_I32_LT_S, OP_I32_ADD = 0x48, 0x6A
+BLOCKTYPE_EMPTY = 0x40
+
+STR = b"hostcall"      # HOSTCALL_STR
+STR_ADDR = 16          # HOSTCALL_STR_ADDR
+BUF_ADDR = 64          # HOSTCALL_BUF_ADDR
+BUF_LEN = 64           # HOSTCALL_BUF_LEN
+
+# import "env": (nome, parametri, risultato o None); l'ordine dà l'indice
+IMPORTS = [
+    ("hc_void", [], None),
+    ("hc_i32_1", [I32], None),
+    ("hc_i32_4", [I32] * 4, None),
+    ("hc_i32_8", [I32] * 8, None),
+    ("hc_i64_4", [I64] * 4, None),
+    ("hc_f64_4", [F64] * 4, None),
+    ("hc_mixed", [I32, I64, F32, F64], None),
+    ("hc_ret", [I32], I32),
+    ("hc_str", [I32], I32),
+    ("hc_buf", [I32, I32], I32),
+    ("hc_raw_void", [], None),
+    ("hc_raw_i32_4", [I32] * 4, None),
+    ("hc_raw_i32_8", [I32] * 8, None),
+    ("hc_raw_str", [I32], I32),
+]
+
+# kernel -> import chiamato (None: hc_loop, "local": funzione del modulo)
+KERNELS = [("hc_loop", None), ("hc_local", "local")] + [(name, name) for name, _, _ in IMPORTS]
+
+
+def _uleb(v: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def _sleb(v: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if (v == 0 and not b & 0x40) or (v == -1 and b & 0x40):
+            out.append(b)
+            return bytes(out)
+        out.append(b | 0x80)
+
+
+def _vec(items) -> bytes:
+    items = list(items)
+    return _uleb(len(items)) + b"".join(items)
+
+
+def _name(s: str) -> bytes:
+    return _uleb(len(s)) + s.encode()
+
+
+def _section(sid: int, payload: bytes) -> bytes:
+    return bytes([sid]) + _uleb(len(payload)) + payload
+
+
+def _functype(params, result) -> bytes:
+    return bytes([0x60]) + _vec([bytes([p]) for p in params]) + _vec([bytes([result])] if result else [])
+
+
+def _const(t: int, k: int) -> bytes:
+    """argomento costante k-esimo del tipo t"""
+    if t == I32:
+        return bytes([OP_I32_CONST]) + _sleb(k)
+    if t == I64:
+        return bytes([OP_I64_CONST]) + _sleb(k)
+    if t == F32:
+        return bytes([OP_F32_CONST]) + struct.pack("<f", k + 0.5)
+    return bytes([OP_F64_CONST]) + struct.pack("<d", k + 0.5)
+
+
+ACC = 0   # indice della global acc
+
+
+def _acc_add() -> bytes:
+    """acc += valore in cima allo stack"""
+    return bytes([OP_GLOBAL_GET, ACC, OP_I32_ADD, OP_GLOBAL_SET, ACC])
+
+
+def _call_body(name, params, result, func_idx) -> bytes:
+    """una iterazione: local 1 = i"""
+    if name == "hc_str" or name == "hc_raw_str":
+        args = _const(I32, STR_ADDR)
+    elif name == "hc_buf":
+        args = _const(I32, BUF_ADDR) + _const(I32, BUF_LEN)
+    else:
+        # primo i32 = i (argomento non costante), il resto costanti
+        args = b"".join(bytes([OP_LOCAL_GET, 1]) if k == 0 and t == I32 else _const(t, k + 1)
+                        for k, t in enumerate(params))
+    code = args + bytes([OP_CALL]) + _uleb(func_idx)
+    if result is None:
+        code += _const(I32, 1)
+    return code + _acc_add()
+
+
+def _bench_body(iteration: bytes) -> bytes:
+    """for (i = 0; i < n; i++) iteration; local 0 = n, local 1 = i"""
+    code = bytearray()
+    code += bytes([OP_BLOCK, BLOCKTYPE_EMPTY])
+    code += bytes([OP_LOCAL_GET, 0]) + _const(I32, 1) + bytes([OP_I32_LT_S, OP_BR_IF, 0])
+    code += bytes([OP_LOOP, BLOCKTYPE_EMPTY])
+    code += iteration
+    code += bytes([OP_LOCAL_GET, 1]) + _const(I32, 1) + bytes([OP_I32_ADD, OP_LOCAL_TEE, 1])
+    code += bytes([OP_LOCAL_GET, 0, OP_I32_LT_S, OP_BR_IF, 0])
+    code += bytes([OP_END, OP_END, OP_END])
+    return _vec([_uleb(1) + bytes([I32])]) + bytes(code)
+
+
+def build_module() -> bytes:
+    types = []
+
+    def type_index(params, result):
+        t = _functype(params, result)
+        if t not in types:
+            types.append(t)
+        return types.index(t)
+
+    imports = [_name("env") + _name(name) + bytes([0x00]) + _uleb(type_index(params, result))
+               for name, params, result in IMPORTS]
+    import_idx = {name: i for i, (name, _, _) in enumerate(IMPORTS)}
+    sig = {name: (params, result) for name, params, result in IMPORTS}
+
+    # funzioni del modulo: local, poi init, bench e checksum per kernel
+    n_imp = len(IMPORTS)
+    local_idx = n_imp
+    funcs = [type_index([I32], I32)]
+    bodies = [_vec([]) + bytes([OP_LOCAL_GET, 0]) + _const(I32, 1) + bytes([OP_I32_ADD, OP_END])]
+    exports = []
+    for kernel, target in KERNELS:
+        if target is None:
+            iteration = _const(I32, 1) + _acc_add()
+        elif target == "local":
+            iteration = bytes([OP_LOCAL_GET, 1, OP_CALL]) + _uleb(local_idx) + _acc_add()
+        else:
+            iteration = _call_body(target, *sig[target], import_idx[target])
+        init_idx = n_imp + len(funcs)
+        funcs += [type_index([], None), type_index([I32], None), type_index([], I32)]
+        bodies += [
+            _vec([]) + _const(I32, 0) + bytes([OP_GLOBAL_SET, ACC, OP_END]),
+            _bench_body(iteration),
+            _vec([]) + bytes([OP_GLOBAL_GET, ACC, OP_END]),
+        ]
+        bench_idx, checksum_idx = init_idx + 1, init_idx + 2
+        exports += [
+            _name(f"{kernel}_init") + bytes([0x00]) + _uleb(init_idx),
+            _name(f"{kernel}_bench") + bytes([0x00]) + _uleb(bench_idx),
+            _name(f"{kernel}_checksum") + bytes([0x00]) + _uleb(checksum_idx),
+        ]
+    exports.append(_name("memory") + bytes([0x02]) + _uleb(0))
+
+    buf = bytes(range(BUF_LEN))
+    data = [
+        _uleb(0) + _const(I32, STR_ADDR) + bytes([OP_END]) + _vec([bytes([b]) for b in STR + b"\0"]),
+        _uleb(0) + _const(I32, BUF_ADDR) + bytes([OP_END]) + _vec([bytes([b]) for b in buf]),
+    ]
+
+    return b"".join([
+        b"\0asm", (1).to_bytes(4, "little"),
+        _section(1, _vec(types)),
+        _section(2, _vec(imports)),
+        _section(3, _vec([_uleb(t) for t in funcs])),
+        _section(5, _vec([bytes([0x00]) + _uleb(1)])),                       # memory min 1
+        _section(6, _vec([bytes([I32, 0x01]) + _const(I32, 0) + bytes([OP_END])])),   # acc
+        _section(7, _vec(exports)),
+        _section(10, _vec([_uleb(len(b)) + b for b in bodies])),
+        _section(11, _vec(data)),
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Genera hostcall_bench.wasm")
+    parser.add_argument("-o", "--out", required=True, help="File .wasm da scrivere")
+    args = parser.parse_args()
+
+    mod = build_module()
+    with open(args.out, "wb") as f:
+        f.write(mod)
+    print(f"{args.out}: {len(mod)} byte")
+
+
+if __name__ == "__main__":
+    main()
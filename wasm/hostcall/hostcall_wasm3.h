@@ -0,0 +1,145 @@
+#ifndef HOSTCALL_WASM3_H
+#define HOSTCALL_WASM3_H
+
+/*
+ * Import "env" di hostcall_bench.wasm per wasm3 (linux_bench e app MCU).
+ * wasm3 ha solo funzioni raw, quindi hc_raw_* usano le stesse; hc_str e
+ * hc_buf controllano i limiti come farebbe un host reale (m3ApiCheckMem).
+ *
+ *   hostcall_link_wasm3(module)   dopo m3_LoadModule; gli import che il
+ *                                 modulo non ha vengono ignorati
+ */
+#include <string.h>
+
+#include "wasm3.h"
+
+m3ApiRawFunction(hc_m3_void)
+{
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_i32_1)
+{
+    m3ApiGetArg(int32_t, a);
+    (void)a;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_i32_4)
+{
+    m3ApiGetArg(int32_t, a);
+    m3ApiGetArg(int32_t, b);
+    m3ApiGetArg(int32_t, c);
+    m3ApiGetArg(int32_t, d);
+    (void)a; (void)b; (void)c; (void)d;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_i32_8)
+{
+    m3ApiGetArg(int32_t, a);
+    m3ApiGetArg(int32_t, b);
+    m3ApiGetArg(int32_t, c);
+    m3ApiGetArg(int32_t, d);
+    m3ApiGetArg(int32_t, e);
+    m3ApiGetArg(int32_t, f);
+    m3ApiGetArg(int32_t, g);
+    m3ApiGetArg(int32_t, h);
+    (void)a; (void)b; (void)c; (void)d; (void)e; (void)f; (void)g; (void)h;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_i64_4)
+{
+    m3ApiGetArg(int64_t, a);
+    m3ApiGetArg(int64_t, b);
+    m3ApiGetArg(int64_t, c);
+    m3ApiGetArg(int64_t, d);
+    (void)a; (void)b; (void)c; (void)d;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_f64_4)
+{
+    m3ApiGetArg(double, a);
+    m3ApiGetArg(double, b);
+    m3ApiGetArg(double, c);
+    m3ApiGetArg(double, d);
+    (void)a; (void)b; (void)c; (void)d;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_mixed)
+{
+    m3ApiGetArg(int32_t, a);
+    m3ApiGetArg(int64_t, b);
+    m3ApiGetArg(float, c);
+    m3ApiGetArg(double, d);
+    (void)a; (void)b; (void)c; (void)d;
+    m3ApiSuccess();
+}
+
+m3ApiRawFunction(hc_m3_ret)
+{
+    m3ApiReturnType(int32_t);
+    m3ApiGetArg(int32_t, x);
+    m3ApiReturn(x + 1);
+}
+
+/* strlen limitata alla memoria lineare: fuori dai limiti è una trap */
+m3ApiRawFunction(hc_m3_str)
+{
+    m3ApiReturnType(int32_t);
+    m3ApiGetArgMem(const char *, s);
+    m3ApiCheckMem(s, 1);
+    size_t avail = (size_t)((const char *)_mem + m3_GetMemorySize(runtime) - s);
+    size_t n = strnlen(s, avail);
+    if (n == avail) {
+        m3ApiTrap(m3Err_trapOutOfBoundsMemoryAccess);
+    }
+    m3ApiReturn((int32_t)n);
+}
+
+m3ApiRawFunction(hc_m3_buf)
+{
+    m3ApiReturnType(int32_t);
+    m3ApiGetArgMem(const uint8_t *, p);
+    m3ApiGetArg(int32_t, len);
+    m3ApiCheckMem(p, len);
+    m3ApiReturn(len);
+}
+
+static M3Result hostcall_link_wasm3(IM3Module module)
+{
+    static const struct {
+        const char   *name;
+        const char   *sig;
+        M3RawCall     fn;
+    } imports[] = {
+        { "hc_void",      "v()",          hc_m3_void },
+        { "hc_i32_1",     "v(i)",         hc_m3_i32_1 },
+        { "hc_i32_4",     "v(iiii)",      hc_m3_i32_4 },
+        { "hc_i32_8",     "v(iiiiiiii)",  hc_m3_i32_8 },
+        { "hc_i64_4",     "v(IIII)",      hc_m3_i64_4 },
+        { "hc_f64_4",     "v(FFFF)",      hc_m3_f64_4 },
+        { "hc_mixed",     "v(iIfF)",      hc_m3_mixed },
+        { "hc_ret",       "i(i)",         hc_m3_ret },
+        { "hc_str",       "i(*)",         hc_m3_str },
+        { "hc_buf",       "i(*i)",        hc_m3_buf },
+        { "hc_raw_void",  "v()",          hc_m3_void },
+        { "hc_raw_i32_4", "v(iiii)",      hc_m3_i32_4 },
+        { "hc_raw_i32_8", "v(iiiiiiii)",  hc_m3_i32_8 },
+        { "hc_raw_str",   "i(*)",         hc_m3_str },
+    };
+
+    for (size_t i = 0; i < sizeof(imports) / sizeof(imports[0]); i++) {
+        M3Result r = m3_LinkRawFunction(module, "env", imports[i].name, imports[i].sig,
+                                        imports[i].fn);
+        if (r && r != m3Err_functionLookupFailed) {
+            return r;
+        }
+    }
+    return m3Err_none;
+}
+
+#endif /* HOSTCALL_WASM3_H */
@@ -0,0 +1,64 @@
+#!/bin/sh
+# Compila la suite di kernel: modulo wasm, header C per gli MCU e AOT.
+#
+#   wasm/kernels/build.sh            (CLANG, WAMRC, PYTHON sovrascrivibili da env)
+#
+# Produce, accanto a questo script:
+#   kernels_bench.wasm      modulo wasm32 (1 pagina di memoria, stack 4 KB)
+#   kernels_bench.wasm.h    xxd -i del .wasm, per wasm3/WAMR interp su MCU
+#   f4/, f7/ kernels_bench.aot, kernels_bench_aot.h   AOT per famiglia
+#                           (flag da aot_target.py, come il gateway)
+#   kernels_bench.x86_64.aot  AOT host per linux_bench
+# e copia gli header nei progetti MCU che eseguono la suite.
+# I progetti MCU nativi compilano lo stesso sorgente: le loro copie di
+# kernels_bench.c e kernels_bench.h vengono da qui (anche senza toolchain
+# wasm), non si modificano a mano.
+set -e
+
+cd "$(dirname "$0")"
+CLANG=${CLANG:-clang}
+WAMRC=${WAMRC:-wamrc}
+PYTHON=${PYTHON:-python3}
+REPO=../..
+
+for prj in baremetal/bm_fft_f4 baremetal/bm_fft_f7 freertos/frt_fft_f4 freertos/frt_fft_f7; do
+  cp kernels_bench.c "$REPO/$prj/Core/Src/"
+  cp kernels_bench.h "$REPO/$prj/Core/Inc/"
+done
+for prj in zephyrproject/z_native_fft_f4 zephyrproject/z_native_fft_f7; do
+  cp kernels_bench.c kernels_bench.h "$REPO/$prj/src/"
+done
+
+"$CLANG" --target=wasm32-unknown-unknown -O3 -nostdlib -fno-builtin \
+  -Wl,--no-entry \
+  -Wl,--initial-memory=65536 -Wl,--max-memory=65536 \
+  -Wl,--stack-first -Wl,-z,stack-size=4096 \
+  kernels_bench.c -o kernels_bench.wasm
+
+xxd -i kernels_bench.wasm > kernels_bench.wasm.h
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    mkdir -p $fam
+    "$WAMRC" $("$PYTHON" $REPO/aot_target.py --family $fam) -o $fam/kernels_bench.aot kernels_bench.wasm
+    (cd $fam && xxd -i kernels_bench.aot) > $fam/kernels_bench_aot.h
+  done
+  "$WAMRC" --target=x86_64 -o kernels_bench.x86_64.aot kernels_bench.wasm
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
+
+# interpreti: stesso header ovunque
+for dst in \
+  baremetal/bm_wasm3_fft_f4/Core/Inc baremetal/bm_wasm3_fft_f7/Core/Inc \
+  freertos/frt_wasm3_fft_f4/Core/Inc freertos/frt_wasm3_fft_f7/Core/Inc \
+  zephyrproject/z_wasm3_fft_f4/src zephyrproject/z_wasm3_fft_f7/src \
+  zephyrproject/z_wamr_interp_fft_f4/src zephyrproject/z_wamr_interp_fft_f7/src; do
+  cp kernels_bench.wasm.h kernels_bench.h "$REPO/$dst/"
+done
+for fam in f4 f7; do
+  cp kernels_bench.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  if [ -f $fam/kernels_bench_aot.h ]; then
+    cp $fam/kernels_bench_aot.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  fi
+done
@@ -0,0 +1,106 @@
+#ifndef BENCH_SIMD_H
+#define BENCH_SIMD_H
+
+#include <stdint.h>
+
+/*
+ * Vettori a 128 bit per le varianti SIMD dei kernel (-DBENCH_SIMD).
+ * Stesse operazioni su tre backend, così il sorgente è uno solo:
+ *   wasm32 -msimd128   -> wasm_simd128.h (modulo *_simd.wasm / .aot)
+ *   x86_64 -msse4.1    -> SSE, la baseline nativa a parità di larghezza
+ *   aarch64            -> NEON
+ *
+ * Solo operazioni esatte lane per lane (niente FMA, niente riduzioni
+ * orizzontali): ogni lane ripete le operazioni del kernel scalare nello
+ * stesso ordine, quindi i checksum coincidono con quelli scalari.
+ */
+
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+
+typedef v128_t bsimd_f32x4;
+typedef v128_t bsimd_i32x4;
+
+#define bsimd_load_f32(p)      wasm_v128_load(p)
+#define bsimd_store_f32(p, v)  wasm_v128_store((p), (v))
+#define bsimd_splat_f32(x)     wasm_f32x4_splat(x)
+#define bsimd_make_f32(a, b, c, d) wasm_f32x4_make((a), (b), (c), (d))
+#define bsimd_add_f32(a, b)    wasm_f32x4_add((a), (b))
+#define bsimd_sub_f32(a, b)    wasm_f32x4_sub((a), (b))
+#define bsimd_mul_f32(a, b)    wasm_f32x4_mul((a), (b))
+/* [x0 x1 x2 x3] -> [x1 x0 x3 x2]: scambia re/im di due complessi */
+#define bsimd_swap_pairs_f32(v) wasm_i32x4_shuffle((v), (v), 1, 0, 3, 2)
+
+#define bsimd_load_i32(p)      wasm_v128_load(p)
+#define bsimd_store_i32(p, v)  wasm_v128_store((p), (v))
+#define bsimd_splat_i32(x)     wasm_i32x4_splat(x)
+#define bsimd_add_i32(a, b)    wasm_i32x4_add((a), (b))
+#define bsimd_mul_i32(a, b)    wasm_i32x4_mul((a), (b))
+#define bsimd_sra_i32(v, n)    wasm_i32x4_shr((v), (n))
+/* 4 int16 estesi con segno a int32 */
+#define bsimd_load_i16x4(p)    wasm_i32x4_load16x4(p)
+/* 8 int32 -> 8 int16 con saturazione */
+#define bsimd_store_sat_i16x8(p, lo, hi) \
+    wasm_v128_store((p), wasm_i16x8_narrow_i32x4((lo), (hi)))
+
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+
+typedef __m128  bsimd_f32x4;
+typedef __m128i bsimd_i32x4;
+
+#define bsimd_load_f32(p)      _mm_loadu_ps(p)
+#define bsimd_store_f32(p, v)  _mm_storeu_ps((p), (v))
+#define bsimd_splat_f32(x)     _mm_set1_ps(x)
+#define bsimd_make_f32(a, b, c, d) _mm_setr_ps((a), (b), (c), (d))
+#define bsimd_add_f32(a, b)    _mm_add_ps((a), (b))
+#define bsimd_sub_f32(a, b)    _mm_sub_ps((a), (b))
+#define bsimd_mul_f32(a, b)    _mm_mul_ps((a), (b))
+#define bsimd_swap_pairs_f32(v) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(2, 3, 0, 1))
+
+#define bsimd_load_i32(p)      _mm_loadu_si128((const __m128i *)(const void *)(p))
+#define bsimd_store_i32(p, v)  _mm_storeu_si128((__m128i *)(void *)(p), (v))
+#define bsimd_splat_i32(x)     _mm_set1_epi32((int)(x))
+#define bsimd_add_i32(a, b)    _mm_add_epi32((a), (b))
+#define bsimd_mul_i32(a, b)    _mm_mullo_epi32((a), (b))
+#define bsimd_sra_i32(v, n)    _mm_srai_epi32((v), (n))
+#define bsimd_load_i16x4(p) \
+    _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)(const void *)(p)))
+#define bsimd_store_sat_i16x8(p, lo, hi) \
+    _mm_storeu_si128((__m128i *)(void *)(p), _mm_packs_epi32((lo), (hi)))
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+
+typedef float32x4_t bsimd_f32x4;
+typedef int32x4_t   bsimd_i32x4;
+
+static inline bsimd_f32x4 bsimd_make_f32(float a, float b, float c, float d)
+{
+    float v[4] = { a, b, c, d };
+    return vld1q_f32(v);
+}
+
+#define bsimd_load_f32(p)      vld1q_f32(p)
+#define bsimd_store_f32(p, v)  vst1q_f32((p), (v))
+#define bsimd_splat_f32(x)     vdupq_n_f32(x)
+#define bsimd_add_f32(a, b)    vaddq_f32((a), (b))
+#define bsimd_sub_f32(a, b)    vsubq_f32((a), (b))
+#define bsimd_mul_f32(a, b)    vmulq_f32((a), (b))
+#define bsimd_swap_pairs_f32(v) vrev64q_f32(v)
+
+#define bsimd_load_i32(p)      vreinterpretq_s32_u32(vld1q_u32((const uint32_t *)(p)))
+#define bsimd_store_i32(p, v)  vst1q_u32((uint32_t *)(p), vreinterpretq_u32_s32(v))
+#define bsimd_splat_i32(x)     vdupq_n_s32((int32_t)(x))
+#define bsimd_add_i32(a, b)    vaddq_s32((a), (b))
+#define bsimd_mul_i32(a, b)    vmulq_s32((a), (b))
+#define bsimd_sra_i32(v, n)    vshrq_n_s32((v), (n))
+#define bsimd_load_i16x4(p)    vmovl_s16(vld1_s16(p))
+#define bsimd_store_sat_i16x8(p, lo, hi) \
+    vst1q_s16((p), vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)))
+
+#else
+#error "BENCH_SIMD richiede wasm simd128 (-msimd128), SSE4.1 (-msse4.1) o NEON (aarch64)"
+#endif
+
+#endif /* BENCH_SIMD_H */
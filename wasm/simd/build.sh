@@ -0,0 +1,32 @@
+#!/bin/sh
+# Compila i moduli SIMD128 (FFT e kernel con -DBENCH_SIMD) per linux_bench.
+#
+#   wasm/simd/build.sh               (CLANG, WAMRC sovrascrivibili da env)
+#
+# Produce, accanto a questo script:
+#   fft_bench_simd.wasm, kernels_bench_simd.wasm
+#   <modulo>.x86_64.aot, <modulo>.aarch64.aot   (se wamrc è disponibile)
+# Solo host: wasm3 e gli MCU non eseguono SIMD128.
+set -e
+
+cd "$(dirname "$0")"
+CLANG=${CLANG:-clang}
+WAMRC=${WAMRC:-wamrc}
+CFLAGS="--target=wasm32-unknown-unknown -O3 -nostdlib -fno-builtin -msimd128 \
+  -DBENCH_SIMD -I. -Wl,--no-entry"
+
+$CLANG $CFLAGS -Wl,-z,stack-size=16384 \
+  ../fft/fft_bench_wasm.c -o fft_bench_simd.wasm
+$CLANG $CFLAGS \
+  -Wl,--initial-memory=65536 -Wl,--max-memory=65536 \
+  -Wl,--stack-first -Wl,-z,stack-size=4096 \
+  ../kernels/kernels_bench.c -o kernels_bench_simd.wasm
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for m in fft_bench_simd kernels_bench_simd; do
+    "$WAMRC" --target=x86_64 --opt-level=3 -o $m.x86_64.aot $m.wasm
+    "$WAMRC" --target=aarch64 --opt-level=3 -o $m.aarch64.aot $m.wasm
+  done
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
@@ -0,0 +1,115 @@
+#!/bin/sh
+# Moduli del benchmark di avvio (linux_bench --startup e app Zephyr).
+#
+#   wasm/startup/build.sh            (PYTHON, WAMRC sovrascrivibili da env)
+#
+# Produce, accanto a questo script:
+#   synth_{4k,16k,64k,256k}.wasm     moduli sintetici (wasm_gen.py)
+#   <modulo>.x86_64.aot              AOT host per linux_bench (se c'è wamrc)
+#   startup_modules.h                moduli MCU (toggle, math_ops, fft_bench,
+#                                    synth_4k, synth_16k) per wasm3/WAMR interp
+#   f4/, f7/ startup_modules_aot.h   gli stessi in AOT per famiglia (se c'è
+#                                    wamrc; flag da aot_target.py)
+# e copia gli header nelle app Zephyr che eseguono la FFT in wasm.
+set -e
+
+cd "$(dirname "$0")"
+PYTHON=${PYTHON:-python3}
+WAMRC=${WAMRC:-wamrc}
+REPO=../..
+
+for size in 4k 16k 64k 256k; do
+  "$PYTHON" wasm_gen.py --size $size -o synth_$size.wasm
+done
+
+# modulo FFT MCU (una pagina) se wasm/fft/build.sh l'ha generato
+FFT=../fft/mcu/fft_bench.wasm
+[ -f "$FFT" ] || FFT=../fft/fft_bench.wasm
+
+mkdir -p mcu
+cp ../toggle/toggle.wasm ../math_ops/math_ops.wasm synth_4k.wasm synth_16k.wasm mcu/
+cp "$FFT" mcu/fft_bench.wasm
+
+# modulo:funzione:argomenti; toggle non ha una funzione che ritorni
+MCU_MODULES="toggle:: math_ops:add:1,2 fft_bench:fft_init: synth_4k:entry:1 synth_16k:entry:1"
+
+# gen_header <wasm|aot> <file.h> [dir]: array const (in flash) e tabella
+# startup_modules[], moduli letti da dir (default mcu)
+gen_header() {
+  ext=$1
+  out=$2
+  dir=${3:-mcu}
+  {
+    echo "/* generato da wasm/startup/build.sh: moduli del benchmark di avvio */"
+    echo "#ifndef STARTUP_MODULES_H"
+    echo "#define STARTUP_MODULES_H"
+    echo
+    echo "#include <stdint.h>"
+    echo "#include <stddef.h>"
+    echo
+    echo "typedef struct {"
+    echo "    const char          *name;"
+    echo "    const unsigned char *data;"
+    echo "    unsigned int         len;"
+    echo "    const char          *func;   /* NULL: nessuna prima chiamata */"
+    echo "    uint32_t             argc;"
+    echo "    uint32_t             argv[2];"
+    echo "} startup_module_t;"
+    echo
+    for spec in $MCU_MODULES; do
+      name=${spec%%:*}
+      (cd $dir && xxd -i $name.$ext) | sed 's/^unsigned/static const unsigned/'
+      echo
+    done
+    echo "static const startup_module_t startup_modules[] = {"
+    for spec in $MCU_MODULES; do
+      name=${spec%%:*}
+      rest=${spec#*:}
+      func=${rest%%:*}
+      args=${rest#*:}
+      argc=0
+      [ -n "$args" ] && argc=$(echo "$args" | tr ',' '\n' | wc -l)
+      if [ -n "$func" ]; then
+        func="\"$func\""
+      else
+        func=NULL
+      fi
+      args=$(echo "${args:-0}" | sed "s/,/, /g")
+      echo "    { \"$name\", ${name}_$ext, sizeof(${name}_$ext), $func, $argc, { $args } },"
+    done
+    echo "};"
+    echo "#define STARTUP_MODULES_LEN (sizeof(startup_modules) / sizeof(startup_modules[0]))"
+    echo
+    echo "#endif /* STARTUP_MODULES_H */"
+  } > "$out"
+}
+
+gen_header wasm startup_modules.h
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    mkdir -p mcu/$fam $fam
+    for spec in $MCU_MODULES; do
+      name=${spec%%:*}
+      "$WAMRC" $("$PYTHON" $REPO/aot_target.py --family $fam) -o mcu/$fam/$name.aot mcu/$name.wasm
+    done
+    gen_header aot $fam/startup_modules_aot.h mcu/$fam
+  done
+  for m in ../toggle/toggle ../math_ops/math_ops synth_4k synth_16k synth_64k synth_256k; do
+    "$WAMRC" --target=x86_64 --opt-level=3 --size-level=0 \
+      -o "$(basename $m).x86_64.aot" $m.wasm
+  done
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
+
+for dst in \
+  zephyrproject/z_wasm3_fft_f4/src zephyrproject/z_wasm3_fft_f7/src \
+  zephyrproject/z_wamr_interp_fft_f4/src zephyrproject/z_wamr_interp_fft_f7/src; do
+  cp startup_modules.h "$REPO/$dst/"
+done
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    cp $fam/startup_modules_aot.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  done
+fi
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Generatore di moduli wasm sintetici per il benchmark di avvio (linux_bench
+--startup e le app Zephyr): binario scritto direttamente, senza toolchain.
+
+Il modulo ha una memoria di una pagina, un segmento dati, N funzioni
+f<i>(i32) -> i32 di aritmetica lineare con qualche `if` (per dare lavoro
+al validatore) ed esporta solo entry(i32) -> i32, che le chiama tutte.
+La prima chiamata di entry costringe quindi wasm3, che compila in modo
+lazy, a compilare l'intero modulo come fa WAMR al load.
+
+    python3 wasm_gen.py --size 16k -o synth_16k.wasm
+
+Stessi parametri -> stesso binario (costanti da un LCG con seed fisso).
+"""
+import argparse
+
+ROUNDS_PER_FUNC = 32   # ~420 byte di codice per funzione
+IF_EVERY = 8
+DATA_BYTES = 256
+
+I32 = 0x7F
+OP_LOCAL_GET, OP_LOCAL_SET = 0x20, 0x21
+OP_I32_CONST = 0x41
+OP_I32_ADD, OP_I32_MUL, OP_I32_AND, OP_I32_XOR, OP_I32_ROTL = 0x6A, 0x6C, 0x71, 0x73, 0x77
+OP_IF, OP_END, OP_CALL = 0x04, 0x0B, 0x10
+BLOCKTYPE_EMPTY = 0x40
+
+
+def _uleb(v: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def _sleb(v: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if (v == 0 and not b & 0x40) or (v == -1 and b & 0x40):
+            out.append(b)
+            return bytes(out)
+        out.append(b | 0x80)
+
+
+def _vec(items) -> bytes:
+    items = list(items)
+    return _uleb(len(items)) + b"".join(items)
+
+
+def _name(s: str) -> bytes:
+    return _uleb(len(s)) + s.encode()
+
+
+def _section(sid: int, payload: bytes) -> bytes:
+    return bytes([sid]) + _uleb(len(payload)) + payload
+
+
+class _Lcg:
+    def __init__(self, seed: int):
+        self.state = seed
+
+    def next(self) -> int:
+        self.state = (self.state * 1103515245 + 12345) & 0x7FFFFFFF
+        return self.state
+
+
+def _i32_const(v: int) -> bytes:
+    v &= 0xFFFFFFFF
+    return bytes([OP_I32_CONST]) + _sleb(v - (1 << 32) if v & 0x80000000 else v)
+
+
+def _func_body(rng: _Lcg) -> bytes:
+    """local 0 = x (param), local 1 = acc"""
+    code = bytearray()
+    for r in range(ROUNDS_PER_FUNC):
+        # acc = rotl((x * A + B) ^ acc, R)
+        code += bytes([OP_LOCAL_GET, 0]) + _i32_const(rng.next() | 1) + bytes([OP_I32_MUL])
+        code += _i32_const(rng.next()) + bytes([OP_I32_ADD])
+        code += bytes([OP_LOCAL_GET, 1, OP_I32_XOR])
+        code += _i32_const(rng.next() % 31 + 1) + bytes([OP_I32_ROTL, OP_LOCAL_SET, 1])
+        if r % IF_EVERY == IF_EVERY - 1:
+            # if (acc & 1) acc ^= C
+            code += bytes([OP_LOCAL_GET, 1]) + _i32_const(1) + bytes([OP_I32_AND, OP_IF, BLOCKTYPE_EMPTY])
+            code += bytes([OP_LOCAL_GET, 1]) + _i32_const(rng.next()) + bytes([OP_I32_XOR, OP_LOCAL_SET, 1])
+            code += bytes([OP_END])
+    code += bytes([OP_LOCAL_GET, 1, OP_END])
+    return _vec([_uleb(1) + bytes([I32])]) + bytes(code)
+
+
+def _entry_body(num_funcs: int) -> bytes:
+    """acc ^= f<i>(x) per ogni i (le f sono gli indici 0..N-1, entry è N)"""
+    code = bytearray()
+    for i in range(num_funcs):
+        code += bytes([OP_LOCAL_GET, 0, OP_CALL]) + _uleb(i) + bytes([OP_LOCAL_GET, 1, OP_I32_XOR, OP_LOCAL_SET, 1])
+    code += bytes([OP_LOCAL_GET, 1, OP_END])
+    return _vec([_uleb(1) + bytes([I32])]) + bytes(code)
+
+
+def build_module(num_funcs: int, seed: int = 42) -> bytes:
+    rng = _Lcg(seed)
+    func_type = bytes([0x60]) + _vec([bytes([I32])]) + _vec([bytes([I32])])
+
+    bodies = [_func_body(rng) for _ in range(num_funcs)] + [_entry_body(num_funcs)]
+    data = bytes(rng.next() & 0xFF for _ in range(DATA_BYTES))
+
+    return b"".join([
+        b"\0asm", (1).to_bytes(4, "little"),
+        _section(1, _vec([func_type])),
+        _section(3, _vec([_uleb(0)] * (num_funcs + 1))),
+        _section(5, _vec([bytes([0x00]) + _uleb(1)])),                      # memory min 1
+        _section(7, _vec([_name("entry") + bytes([0x00]) + _uleb(num_funcs)])),
+        _section(10, _vec([_uleb(len(b)) + b for b in bodies])),
+        _section(11, _vec([_uleb(0) + _i32_const(1024) + bytes([OP_END]) + _vec([bytes([b]) for b in data])])),
+    ])
+
+
+def module_for_size(size: int, seed: int = 42) -> bytes:
+    """il modulo più piccolo con almeno size byte (la dimensione cresce con N)"""
+    lo, hi = 1, 1
+    while len(build_module(hi, seed)) < size:
+        hi *= 2
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if len(build_module(mid, seed)) >= size:
+            hi = mid
+        else:
+            lo = mid + 1
+    return build_module(lo, seed)
+
+
+def _parse_size(s: str) -> int:
+    s = s.strip().lower()
+    if s.endswith("k"):
+        return int(s[:-1]) * 1024
+    return int(s, 0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Genera un modulo wasm sintetico per i benchmark di avvio")
+    g = parser.add_mutually_exclusive_group(required=True)
+    g.add_argument("--size", type=_parse_size, help="Dimensione minima del modulo, es. 16k")
+    g.add_argument("--funcs", type=int, help="Numero di funzioni f<i>")
+    parser.add_argument("--seed", type=int, default=42)
+    parser.add_argument("-o", "--out", required=True, help="File .wasm da scrivere")
+    args = parser.parse_args()
+
+    mod = module_for_size(args.size, args.seed) if args.size else build_module(args.funcs, args.seed)
+    with open(args.out, "wb") as f:
+        f.write(mod)
+    print(f"{args.out}: {len(mod)} byte")
+
+
+if __name__ == "__main__":
+    main()
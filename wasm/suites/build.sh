@@ -0,0 +1,99 @@
+#!/bin/sh
+# Suite di benchmark di WAMR (CoreMark, Dhrystone, PolyBench) come kernel:
+# modulo wasm, header C per gli MCU e AOT.
+#
+#   wasm/suites/build.sh     (WASI_SDK, WAMRC, PYTHON, GIT sovrascrivibili da env)
+#
+# CoreMark e PolyBench vengono clonati in third_party/ alla prima build,
+# come fanno gli script di tests/benchmarks di WAMR; Dhrystone è già nel
+# sorgente di WAMR in zephyrproject/. Serve wasi-sdk per gli header della
+# libc: il modulo è -nostartfiles senza entry e non ha import (solo
+# funzioni di stringa dalla libc, niente malloc né stdio).
+#
+# Produce, accanto a questo script:
+#   suites_bench.wasm       modulo wasm32 (1 pagina di memoria, stack 8 KB)
+#   suites_bench.wasm.h     xxd -i del .wasm, per wasm3/WAMR interp su MCU
+#   f4/, f7/ suites_bench.aot, suites_bench_aot.h   AOT per famiglia
+#                           (flag da aot_target.py, come il gateway)
+#   suites_bench.x86_64.aot AOT host per linux_bench
+# e copia gli header nelle app Zephyr wasm. Il .so nativo lo compila
+# linux_bench (CMake) quando third_party/ esiste.
+#
+# Sightglass non c'è: WAMR compila i moduli shootout con
+# -Dblack_box=set_res e --allow-undefined, ogni risultato va a un import
+# dell'host e non stanno nell'interfaccia K_init/K_bench/K_checksum.
+set -e
+
+cd "$(dirname "$0")"
+WASI_SDK=${WASI_SDK:-/opt/wasi-sdk}
+CLANG=${CLANG:-$WASI_SDK/bin/clang}
+WAMRC=${WAMRC:-wamrc}
+PYTHON=${PYTHON:-python3}
+GIT=${GIT:-git}
+REPO=../..
+
+COREMARK=third_party/coremark
+POLYBENCH=third_party/PolyBenchC-4.2.1
+DHRYSTONE=$REPO/zephyrproject/wasm-micro-runtime/tests/benchmarks/dhrystone
+# stessi file di SUITES_POLYBENCH (suites_bench.h)
+POLYBENCH_KERNELS="gemm atax bicg mvt trisolv jacobi-1d jacobi-2d seidel-2d floyd-warshall nussinov"
+
+mkdir -p third_party
+if [ ! -d $COREMARK ]; then
+  "$GIT" clone --depth 1 https://github.com/eembc/coremark.git $COREMARK
+fi
+if [ ! -d $POLYBENCH ]; then
+  "$GIT" clone --depth 1 https://github.com/MatthiasJReisinger/PolyBenchC-4.2.1.git $POLYBENCH
+fi
+
+OBJ=obj
+rm -rf $OBJ
+mkdir -p $OBJ
+CFLAGS="-O3 -ffp-contract=off -I."
+
+"$CLANG" $CFLAGS -Icoremark -I$COREMARK -c coremark_suite.c -o $OBJ/coremark_suite.o
+for f in core_list_join core_matrix core_state core_util; do
+  "$CLANG" $CFLAGS -Icoremark -I$COREMARK -c $COREMARK/$f.c -o $OBJ/$f.o
+done
+
+"$CLANG" $CFLAGS -I$DHRYSTONE/include -c dhrystone_suite.c -o $OBJ/dhrystone_suite.o
+"$CLANG" $CFLAGS -w -I$DHRYSTONE/include -Dmain=dhry_main -c $DHRYSTONE/src/dhry_1.c -o $OBJ/dhry_1.o
+"$CLANG" $CFLAGS -w -I$DHRYSTONE/include -c $DHRYSTONE/src/dhry_2.c -o $OBJ/dhry_2.o
+
+"$CLANG" $CFLAGS -c polybench_suite.c -o $OBJ/polybench_suite.o
+for k in $POLYBENCH_KERNELS; do
+  src=$(find $POLYBENCH -name "$k.c" | head -n 1)
+  id=$(echo "$k" | tr - _)
+  "$CLANG" $CFLAGS -w -I$POLYBENCH/utilities -I"$(dirname "$src")" -DMINI_DATASET \
+    -Dmain=polybench_${id}_main -Dfprintf=polybench_fprintf -Dfree=polybench_free_data \
+    -DPOLYBENCH_DUMP_TARGET=NULL -c "$src" -o $OBJ/pb_$id.o
+done
+
+"$CLANG" -nostartfiles -Wl,--no-entry \
+  -Wl,--initial-memory=65536 -Wl,--max-memory=65536 \
+  -Wl,--stack-first -Wl,-z,stack-size=8192 \
+  $OBJ/*.o -o suites_bench.wasm
+
+xxd -i suites_bench.wasm > suites_bench.wasm.h
+
+if command -v "$WAMRC" >/dev/null 2>&1; then
+  for fam in f4 f7; do
+    mkdir -p $fam
+    "$WAMRC" $("$PYTHON" $REPO/aot_target.py --family $fam) -o $fam/suites_bench.aot suites_bench.wasm
+    (cd $fam && xxd -i suites_bench.aot) > $fam/suites_bench_aot.h
+  done
+  "$WAMRC" --target=x86_64 -o suites_bench.x86_64.aot suites_bench.wasm
+else
+  echo "wamrc non trovato: salto gli AOT" >&2
+fi
+
+for dst in \
+  zephyrproject/z_wasm3_fft_f4/src zephyrproject/z_wasm3_fft_f7/src \
+  zephyrproject/z_wamr_interp_fft_f4/src zephyrproject/z_wamr_interp_fft_f7/src; do
+  cp suites_bench.wasm.h suites_bench.h "$REPO/$dst/"
+done
+for fam in f4 f7; do
+  if [ -f $fam/suites_bench_aot.h ]; then
+    cp $fam/suites_bench_aot.h suites_bench.h "$REPO/zephyrproject/z_wamr_aot_fft_$fam/src/"
+  fi
+done
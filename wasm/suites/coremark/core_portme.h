@@ -0,0 +1,75 @@
+/*
+ * Port di CoreMark per wasm/suites: niente main, niente timer e niente
+ * stdio. core_main.c non si compila; coremark_suite.c ne rifà la parte
+ * che prepara i dati e il ciclo di iterate(). Vale sia per il modulo
+ * wasm32 sia per il .so nativo a 64 bit (ee_ptr_int è uintptr_t).
+ */
+#ifndef CORE_PORTME_H
+#define CORE_PORTME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HAS_FLOAT  0
+#define HAS_TIME_H 0
+#define USE_CLOCK  0
+#define HAS_STDIO  0
+#define HAS_PRINTF 0
+
+#ifndef COMPILER_VERSION
+#ifdef __GNUC__
+#define COMPILER_VERSION "GCC"__VERSION__
+#else
+#define COMPILER_VERSION "unknown"
+#endif
+#endif
+#ifndef COMPILER_FLAGS
+#define COMPILER_FLAGS "wasm/suites"
+#endif
+#ifndef MEM_LOCATION
+#define MEM_LOCATION "STATIC"
+#endif
+
+typedef int16_t   ee_s16;
+typedef uint16_t  ee_u16;
+typedef int32_t   ee_s32;
+typedef uint8_t   ee_u8;
+typedef uint32_t  ee_u32;
+typedef uintptr_t ee_ptr_int;
+typedef size_t    ee_size_t;
+typedef float     ee_f32;
+
+#define align_mem(x) (void *)(4 + (((ee_ptr_int)(x)-1) & ~3))
+
+#define CORETIMETYPE ee_u32
+typedef ee_u32 CORE_TICKS;
+
+/* seed 0, 0, 0x66 del performance run, letti da get_seed_32 (core_util.c) */
+#define SEED_METHOD SEED_VOLATILE
+#define MEM_METHOD  MEM_STATIC
+
+#define MULTITHREAD       1
+#define USE_PTHREAD       0
+#define USE_FORK          0
+#define USE_SOCKET        0
+#define MAIN_HAS_NOARGC   1
+#define MAIN_HAS_NORETURN 0
+
+#ifndef TOTAL_DATA_SIZE
+#define TOTAL_DATA_SIZE 2000
+#endif
+#define PERFORMANCE_RUN 1
+
+extern ee_u32 default_num_contexts;
+
+typedef struct CORE_PORTABLE_S {
+    ee_u8 portable_id;
+} core_portable;
+
+void portable_init(core_portable *p, int *argc, char *argv[]);
+void portable_fini(core_portable *p);
+
+/* solo per i messaggi di check_data_types (core_util.c): scartati */
+int ee_printf(const char *fmt, ...);
+
+#endif /* CORE_PORTME_H */
@@ -0,0 +1,95 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "coremark.h"
+#include "suites_bench.h"
+
+/*
+ * CoreMark (github.com/eembc/coremark, scaricato da wasm/suites/build.sh)
+ * con il port di wasm/suites/coremark. Si compilano core_list_join.c,
+ * core_matrix.c, core_state.c e core_util.c; da core_main.c vengono la
+ * preparazione dei tre blocchi (lista, matrice, macchina a stati) con i
+ * seed del performance run e il corpo di iterate(), che qui diventa
+ * coremark_bench. Nessun timer: i cicli li misura il runner.
+ *
+ * Il checksum è il CRC accumulato in res.crc: con una sola iterazione
+ * per round a partire da coremark_init, res.crclist (il CRC del primo
+ * giro) coincide con il valore atteso da core_main per 2000 byte, 0xe714.
+ */
+
+volatile ee_s32 seed1_volatile = 0x0;
+volatile ee_s32 seed2_volatile = 0x0;
+volatile ee_s32 seed3_volatile = 0x66;
+volatile ee_s32 seed4_volatile = 1;
+volatile ee_s32 seed5_volatile = 0;
+
+ee_u32 default_num_contexts = 1;
+
+void portable_init(core_portable *p, int *argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    p->portable_id = 1;
+}
+
+void portable_fini(core_portable *p)
+{
+    p->portable_id = 0;
+}
+
+int ee_printf(const char *fmt, ...)
+{
+    (void)fmt;
+    return 0;
+}
+
+/* allineato come i puntatori della lista anche sul .so a 64 bit */
+static uint64_t cm_memblk[(TOTAL_DATA_SIZE + 7) / 8];
+static core_results cm_res;
+
+WASM_EXPORT("coremark_init")
+void coremark_init(void)
+{
+    ee_u8 *mem = (ee_u8 *)cm_memblk;
+
+    memset(&cm_res, 0, sizeof(cm_res));
+    memset(cm_memblk, 0, sizeof(cm_memblk));
+    cm_res.seed1 = (ee_s16)get_seed(1);
+    cm_res.seed2 = (ee_s16)get_seed(2);
+    cm_res.seed3 = (ee_s16)get_seed(3);
+    cm_res.iterations = (ee_u32)get_seed_32(4);
+    cm_res.execs = ALL_ALGORITHMS_MASK;
+    /* come core_main: TOTAL_DATA_SIZE diviso tra i tre algoritmi */
+    cm_res.size = TOTAL_DATA_SIZE / 3;
+    cm_res.memblock[0] = mem;
+    for (int i = 0; i < 3; i++) {
+        cm_res.memblock[i + 1] = mem + cm_res.size * i;
+    }
+
+    cm_res.list = core_list_init(cm_res.size, cm_res.memblock[1], cm_res.seed1);
+    core_init_matrix(cm_res.size, cm_res.memblock[2],
+                     (ee_s32)cm_res.seed1 | (((ee_s32)cm_res.seed2) << 16), &cm_res.mat);
+    core_init_state(cm_res.size, cm_res.seed1, cm_res.memblock[3]);
+}
+
+WASM_EXPORT("coremark_bench")
+void coremark_bench(int32_t iterations)
+{
+    ee_u16 crc;
+
+    for (int32_t i = 0; i < iterations; ++i) {
+        crc = core_bench_list(&cm_res, 1);
+        cm_res.crc = crcu16(crc, cm_res.crc);
+        crc = core_bench_list(&cm_res, -1);
+        cm_res.crc = crcu16(crc, cm_res.crc);
+        if (cm_res.crclist == 0) {
+            cm_res.crclist = cm_res.crc;
+        }
+    }
+}
+
+WASM_EXPORT("coremark_checksum")
+uint32_t coremark_checksum(void)
+{
+    return ((uint32_t)cm_res.crclist << 16) | cm_res.crc;
+}
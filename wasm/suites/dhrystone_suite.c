@@ -0,0 +1,158 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "dhry.h"
+#include "suites_bench.h"
+
+/*
+ * Dhrystone 2.1 (tests/benchmarks/dhrystone di WAMR). dhry_1.c e dhry_2.c
+ * si compilano così come sono, con -Dmain=dhry_main: il main originale
+ * (stampe, clock_gettime, calibrazione del numero di giri) resta fuori dal
+ * modulo wasm perché nessuno lo chiama. Qui c'è lo stesso corpo del ciclo
+ * "for Run_Index", con lo stato del main tenuto tra una chiamata e l'altra.
+ *
+ * Niente malloc: i due record stanno in memoria statica.
+ */
+
+extern Rec_Pointer Ptr_Glob, Next_Ptr_Glob;
+extern int Int_Glob;
+extern Boolean Bool_Glob;
+extern char Ch_1_Glob, Ch_2_Glob;
+extern int Arr_1_Glob[50];
+extern int Arr_2_Glob[50][50];
+
+Enumeration Func_1(Capital_Letter Ch_1_Par_Val, Capital_Letter Ch_2_Par_Val);
+Boolean Func_2(Str_30 Str_1_Par_Ref, Str_30 Str_2_Par_Ref);
+void Proc_1(Rec_Pointer Ptr_Val_Par);
+void Proc_2(One_Fifty *Int_Par_Ref);
+void Proc_4();
+void Proc_5();
+void Proc_6(Enumeration Enum_Val_Par, Enumeration *Enum_Ref_Par);
+void Proc_7(One_Fifty Int_1_Par_Val, One_Fifty Int_2_Par_Val, One_Fifty *Int_Par_Ref);
+void Proc_8(Arr_1_Dim Arr_1_Par_Ref, Arr_2_Dim Arr_2_Par_Ref, int Int_1_Par_Val,
+            int Int_2_Par_Val);
+
+static Rec_Type dhry_rec[2];
+static Str_30 dhry_str_1;
+/* locali del main che arrivano al report finale */
+static One_Fifty dhry_int_1, dhry_int_2, dhry_int_3;
+static Enumeration dhry_enum;
+static Str_30 dhry_str_2;
+static int32_t dhry_runs;
+
+/* FNV-1a a 32 bit, un byte alla volta */
+static uint32_t fnv1a(uint32_t h, const void *p, uint32_t n)
+{
+    const uint8_t *b = p;
+    for (uint32_t i = 0; i < n; ++i) {
+        h ^= b[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t fnv1a_int(uint32_t h, int32_t v)
+{
+    return fnv1a(h, &v, sizeof(v));
+}
+
+/* record senza Ptr_Comp: il puntatore cambia tra nativo e wasm */
+static uint32_t fnv1a_rec(uint32_t h, const Rec_Type *r)
+{
+    h = fnv1a_int(h, r->Discr);
+    h = fnv1a_int(h, r->variant.var_1.Enum_Comp);
+    h = fnv1a_int(h, r->variant.var_1.Int_Comp);
+    return fnv1a(h, r->variant.var_1.Str_Comp, (uint32_t)strlen(r->variant.var_1.Str_Comp));
+}
+
+WASM_EXPORT("dhrystone_init")
+void dhrystone_init(void)
+{
+    memset(dhry_rec, 0, sizeof(dhry_rec));
+    memset(Arr_1_Glob, 0, sizeof(Arr_1_Glob));
+    memset(Arr_2_Glob, 0, sizeof(Arr_2_Glob));
+    Int_Glob = 0;
+    Bool_Glob = 0;
+    Ch_1_Glob = Ch_2_Glob = 0;
+
+    Next_Ptr_Glob = &dhry_rec[0];
+    Ptr_Glob = &dhry_rec[1];
+
+    Ptr_Glob->Ptr_Comp = Next_Ptr_Glob;
+    Ptr_Glob->Discr = Ident_1;
+    Ptr_Glob->variant.var_1.Enum_Comp = Ident_3;
+    Ptr_Glob->variant.var_1.Int_Comp = 40;
+    strcpy(Ptr_Glob->variant.var_1.Str_Comp, "DHRYSTONE PROGRAM, SOME STRING");
+    strcpy(dhry_str_1, "DHRYSTONE PROGRAM, 1'ST STRING");
+
+    Arr_2_Glob[8][7] = 10;
+    dhry_runs = 0;
+}
+
+WASM_EXPORT("dhrystone_bench")
+void dhrystone_bench(int32_t iterations)
+{
+    One_Fifty Int_1_Loc = 0, Int_2_Loc = 0, Int_3_Loc = 0;
+    Enumeration Enum_Loc = Ident_1;
+    char Ch_Index;
+
+    for (int32_t it = 0; it < iterations; ++it) {
+        for (int Run_Index = 1; Run_Index <= DHRY_RUNS_PER_ITER; ++Run_Index) {
+            Proc_5();
+            Proc_4();
+            Int_1_Loc = 2;
+            Int_2_Loc = 3;
+            strcpy(dhry_str_2, "DHRYSTONE PROGRAM, 2'ND STRING");
+            Enum_Loc = Ident_2;
+            Bool_Glob = !Func_2(dhry_str_1, dhry_str_2);
+            while (Int_1_Loc < Int_2_Loc) {
+                Int_3_Loc = 5 * Int_1_Loc - Int_2_Loc;
+                Proc_7(Int_1_Loc, Int_2_Loc, &Int_3_Loc);
+                Int_1_Loc += 1;
+            }
+            Proc_8(Arr_1_Glob, Arr_2_Glob, Int_1_Loc, Int_3_Loc);
+            Proc_1(Ptr_Glob);
+            for (Ch_Index = 'A'; Ch_Index <= Ch_2_Glob; ++Ch_Index) {
+                if (Enum_Loc == Func_1(Ch_Index, 'C')) {
+                    Proc_6(Ident_1, &Enum_Loc);
+                    strcpy(dhry_str_2, "DHRYSTONE PROGRAM, 3'RD STRING");
+                    Int_2_Loc = Run_Index;
+                    Int_Glob = Run_Index;
+                }
+            }
+            Int_2_Loc = Int_2_Loc * Int_1_Loc;
+            Int_1_Loc = Int_2_Loc / Int_3_Loc;
+            Int_2_Loc = 7 * (Int_2_Loc - Int_3_Loc) - Int_1_Loc;
+            Proc_2(&Int_1_Loc);
+        }
+        dhry_runs += DHRY_RUNS_PER_ITER;
+    }
+
+    dhry_int_1 = Int_1_Loc;
+    dhry_int_2 = Int_2_Loc;
+    dhry_int_3 = Int_3_Loc;
+    dhry_enum = Enum_Loc;
+}
+
+/* i valori del report finale di dhry_1.c; Arr_2_Glob[8][7] vale
+ * 10 + giri eseguiti, quindi dipende dai round come gli altri checksum */
+WASM_EXPORT("dhrystone_checksum")
+uint32_t dhrystone_checksum(void)
+{
+    uint32_t h = 2166136261u;
+    h = fnv1a_int(h, Int_Glob);
+    h = fnv1a_int(h, Bool_Glob);
+    h = fnv1a_int(h, Ch_1_Glob);
+    h = fnv1a_int(h, Ch_2_Glob);
+    h = fnv1a_int(h, Arr_1_Glob[8]);
+    h = fnv1a_int(h, Arr_2_Glob[8][7]);
+    h = fnv1a_rec(h, Ptr_Glob);
+    h = fnv1a_rec(h, Next_Ptr_Glob);
+    h = fnv1a_int(h, dhry_int_1);
+    h = fnv1a_int(h, dhry_int_2);
+    h = fnv1a_int(h, dhry_int_3);
+    h = fnv1a_int(h, dhry_enum);
+    h = fnv1a(h, dhry_str_1, (uint32_t)strlen(dhry_str_1));
+    h = fnv1a(h, dhry_str_2, (uint32_t)strlen(dhry_str_2));
+    return fnv1a_int(h, dhry_runs);
+}
@@ -0,0 +1,141 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "suites_bench.h"
+
+/*
+ * PolyBench/C 4.2.1 (scaricato da wasm/suites/build.sh). Ogni kernel si
+ * compila dal suo .c originale con -Dmain=polybench_<id>_main e
+ * -DMINI_DATASET; al posto di utilities/polybench.c ci sono le poche
+ * funzioni che i kernel usano senza POLYBENCH_TIME:
+ *   polybench_alloc_data   da un'arena statica (niente malloc: il modulo
+ *                          resta in una pagina wasm, anche su MCU)
+ *   polybench_free_data    (-Dfree=polybench_free_data nei kernel)
+ *   polybench_fprintf      (-Dfprintf=polybench_fprintf): non stampa, fa
+ *                          l'hash dei valori del dump degli array
+ *
+ * pb_<id>_bench(n) chiama n volte il main: alloca, inizializza, esegue il
+ * kernel, libera. Il checksum è l'hash del dump di un main in più, che
+ * PolyBench fa solo con argc > 42 e argv[0] vuoto: il compilatore non può
+ * togliere il kernel perché argc arriva da un'altra unità di compilazione.
+ */
+
+#ifndef SUITES_POLYBENCH_ARENA
+#define SUITES_POLYBENCH_ARENA (20 * 1024)
+#endif
+
+static uint64_t pb_arena[SUITES_POLYBENCH_ARENA / 8];
+static uint32_t pb_used;
+static uint32_t pb_live;
+
+void *polybench_alloc_data(unsigned long long n, int elt_size)
+{
+    uint64_t bytes = ((uint64_t)n * (uint64_t)elt_size + 7u) & ~(uint64_t)7u;
+    if (bytes > sizeof(pb_arena) - pb_used) {
+        /* dataset più grande dell'arena: meglio una trap che un NULL
+         * (l'indirizzo 0 nel modulo wasm è lo stack) */
+        __builtin_trap();
+    }
+    void *p = (uint8_t *)pb_arena + pb_used;
+    pb_used += (uint32_t)bytes;
+    pb_live++;
+    return p;
+}
+
+/* gli array di un main si liberano tutti a fine main: arena vuota */
+void polybench_free_data(void *ptr)
+{
+    if (ptr && --pb_live == 0) {
+        pb_used = 0;
+    }
+}
+
+/* FNV-1a a 32 bit sui valori del dump, non sul testo formattato */
+static uint32_t pb_hash;
+
+static void pb_hash_bytes(const void *p, size_t n)
+{
+    const uint8_t *b = p;
+    for (size_t i = 0; i < n; ++i) {
+        pb_hash ^= b[i];
+        pb_hash *= 16777619u;
+    }
+}
+
+int polybench_fprintf(FILE *stream, const char *fmt, ...)
+{
+    va_list ap;
+
+    (void)stream;
+    va_start(ap, fmt);
+    for (const char *c = fmt; *c; ++c) {
+        if (*c != '%') {
+            continue;
+        }
+        /* flag, ampiezza, precisione e modificatori di lunghezza */
+        while (*++c && (c[0] == '-' || c[0] == '+' || c[0] == ' ' || c[0] == '#'
+                        || c[0] == '.' || c[0] == 'l' || c[0] == 'h'
+                        || (c[0] >= '0' && c[0] <= '9'))) {
+        }
+        switch (*c) {
+        case 'd': case 'i': case 'u': case 'x': case 'c': {
+            int32_t v = va_arg(ap, int);
+            pb_hash_bytes(&v, sizeof(v));
+            break;
+        }
+        case 'f': case 'e': case 'g': {
+            double v = va_arg(ap, double);
+            pb_hash_bytes(&v, sizeof(v));
+            break;
+        }
+        case 's':
+            (void)va_arg(ap, const char *);   /* nome dell'array */
+            break;
+        case '\0':
+            va_end(ap);
+            return 0;
+        default:
+            break;
+        }
+    }
+    va_end(ap);
+    return 0;
+}
+
+#define PB_MAIN_DECL(id, file) int polybench_##id##_main(int argc, char **argv);
+SUITES_POLYBENCH(PB_MAIN_DECL)
+#undef PB_MAIN_DECL
+
+static char pb_empty[] = "";
+static char *pb_argv[] = { pb_empty, NULL };
+
+/* argc > 42 e argv[0] == "": il main fa il dump (POLYBENCH_DCE_ONLY_CODE) */
+#define PB_DUMP_ARGC 43
+
+#define PB_KERNEL(id, file)                                      \
+    WASM_EXPORT("pb_" #id "_init")                               \
+    void pb_##id##_init(void)                                    \
+    {                                                            \
+        pb_used = 0;                                             \
+        pb_live = 0;                                             \
+    }                                                            \
+                                                                 \
+    WASM_EXPORT("pb_" #id "_bench")                              \
+    void pb_##id##_bench(int32_t iterations)                     \
+    {                                                            \
+        for (int32_t i = 0; i < iterations; ++i) {               \
+            polybench_##id##_main(1, pb_argv);                   \
+        }                                                        \
+    }                                                            \
+                                                                 \
+    WASM_EXPORT("pb_" #id "_checksum")                           \
+    uint32_t pb_##id##_checksum(void)                            \
+    {                                                            \
+        pb_hash = 2166136261u;                                   \
+        polybench_##id##_main(PB_DUMP_ARGC, pb_argv);            \
+        return pb_hash;                                          \
+    }
+SUITES_POLYBENCH(PB_KERNEL)
+#undef PB_KERNEL
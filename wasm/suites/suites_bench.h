@@ -0,0 +1,70 @@
+#ifndef SUITES_BENCH_H
+#define SUITES_BENCH_H
+
+#include <stdint.h>
+
+/*
+ * Suite di benchmark di WAMR (tests/benchmarks) riportate all'interfaccia
+ * dei kernel di linux_bench e delle app MCU: CoreMark, Dhrystone e un
+ * sottoinsieme di PolyBench, in un solo modulo (suites_bench) costruito da
+ * wasm/suites/build.sh. I main() originali girano su WASI e misurano da
+ * soli il tempo; qui il ciclo misurato è <kernel>_bench e il tempo lo
+ * prende il runner, come per wasm/kernels.
+ *
+ * Ogni kernel K esporta:
+ *   K_init()              prepara i dati (non misurato)
+ *   K_bench(iterations)   il carico misurato
+ *   K_checksum()          hash dell'output: deve coincidere tra nativo e
+ *                         ogni runtime wasm a parità di init/bench
+ *
+ * Un'iterazione è: un giro di core_bench_list x2 (come iterate() di
+ * CoreMark), DHRY_RUNS_PER_ITER giri di Dhrystone, un main() completo di
+ * PolyBench (alloca, inizializza, kernel, libera) col dataset MINI.
+ */
+
+#if defined(__wasm__) || defined(__wasm)
+#  define WASM_EXPORT(name) __attribute__((export_name(name)))
+#else
+#  define WASM_EXPORT(name)
+#endif
+
+/* giri del ciclo di Dhrystone per iterazione */
+#define DHRY_RUNS_PER_ITER 1000
+
+/* kernel PolyBench importati: X(nome C, file sorgente senza .c); tutti
+ * stanno col dataset MINI nell'arena di polybench_suite.c */
+#define SUITES_POLYBENCH(X)                  \
+    X(gemm, gemm)                            \
+    X(atax, atax)                            \
+    X(bicg, bicg)                            \
+    X(mvt, mvt)                              \
+    X(trisolv, trisolv)                      \
+    X(jacobi_1d, jacobi-1d)                  \
+    X(jacobi_2d, jacobi-2d)                  \
+    X(seidel_2d, seidel-2d)                  \
+    X(floyd_warshall, floyd-warshall)        \
+    X(nussinov, nussinov)
+
+/* nomi nell'ordine di esecuzione della suite */
+#define SUITES_NAMES "coremark", "dhrystone",                           \
+    "pb_gemm", "pb_atax", "pb_bicg", "pb_mvt", "pb_trisolv",            \
+    "pb_jacobi_1d", "pb_jacobi_2d", "pb_seidel_2d",                     \
+    "pb_floyd_warshall", "pb_nussinov"
+#define SUITES_LEN 12
+
+void     coremark_init(void);
+void     coremark_bench(int32_t iterations);
+uint32_t coremark_checksum(void);
+
+void     dhrystone_init(void);
+void     dhrystone_bench(int32_t iterations);
+uint32_t dhrystone_checksum(void);
+
+#define SUITES_POLYBENCH_DECL(id, file)      \
+    void     pb_##id##_init(void);           \
+    void     pb_##id##_bench(int32_t iterations); \
+    uint32_t pb_##id##_checksum(void);
+SUITES_POLYBENCH(SUITES_POLYBENCH_DECL)
+#undef SUITES_POLYBENCH_DECL
+
+#endif /* SUITES_BENCH_H */
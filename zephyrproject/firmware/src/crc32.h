@@ -0,0 +1,53 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * CRC32 zlib (polinomio riflesso 0xEDB88320), compatibile con
+ * binascii.crc32 lato gateway. Tabelle const in flash (4 KiB).
+ *
+ * crc32_update() si concatena come zlib: crc32_update(crc32_update(0, a), b)
+ * == CRC di a||b, quindi si può calcolare a pezzi mentre i byte arrivano.
+ */
+
+extern const uint32_t crc32_table[4][256];
+
+/*
+ * Sulle F7 l'unità CRC ha polinomio programmabile e inversione dei bit in
+ * ingresso (per byte) e in uscita: con 0x04C11DB7, REV_IN=byte, REV_OUT e
+ * INIT/XOR finale a 0xFFFFFFFF produce proprio il CRC32 zlib. Le F4 hanno
+ * solo CRC-32/MPEG-2 fisso su parole a 32 bit, nRF52 e simulatore nessuna
+ * unità: lì resta la versione a tabelle.
+ */
+#if defined(CONFIG_SOC_SERIES_STM32F7X)
+#define CRC32_HW 1
+#else
+#define CRC32_HW 0
+#endif
+
+/* slice-by-4 sui blocchi allineati, tabella a byte su testa/coda */
+uint32_t crc32_update_sw(uint32_t crc, const uint8_t *data, size_t len);
+
+#if CRC32_HW
+/* unità CRC condivisa: un solo thread alla volta (nell'agent il thread dei
+ * comandi), mai dall'ISR */
+uint32_t crc32_update_hw(uint32_t crc, const uint8_t *data, size_t len);
+#endif
+
+static inline uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+#if CRC32_HW
+    return crc32_update_hw(crc, data, len);
+#else
+    return crc32_update_sw(crc, data, len);
+#endif
+}
+
+static inline uint32_t crc32_calc(const uint8_t *data, size_t len)
+{
+    return crc32_update(0, data, len);
+}
+
+#endif /* CRC32_H */
@@ -0,0 +1,132 @@
+#include <string.h>
+
+#include "delta_stream.h"
+
+#define DELTA_OP_ADD      0
+#define DELTA_OP_COPY_OLD 1
+#define DELTA_OP_COPY_NEW 2
+
+void delta_stream_init(delta_stream_t *s, const uint8_t *old, size_t old_len,
+                       uint8_t *dst, size_t dst_len)
+{
+    s->old     = old;
+    s->old_len = old_len;
+    s->dst     = dst;
+    s->dst_len = dst_len;
+    s->pos     = 0;
+    s->old_pos = 0;
+    s->len     = 0;
+    s->varint  = 0;
+    s->shift   = 0;
+    s->state   = (dst_len == 0) ? DELTAS_END : DELTAS_OP;
+}
+
+static void delta_after_op(delta_stream_t *s)
+{
+    s->state = (s->pos == s->dst_len) ? DELTAS_END : DELTAS_OP;
+}
+
+/* accumula un varint LEB128; true quando è completo (in s->varint) */
+static bool delta_varint(delta_stream_t *s, uint8_t c)
+{
+    if (s->shift > 28) {
+        s->state = DELTAS_ERROR;
+        return false;
+    }
+    s->varint |= (uint32_t)(c & 0x7F) << s->shift;
+    s->shift += 7;
+    return (c & 0x80) == 0;
+}
+
+static void delta_varint_reset(delta_stream_t *s)
+{
+    s->varint = 0;
+    s->shift  = 0;
+}
+
+static void delta_copy_old(delta_stream_t *s, uint32_t zz)
+{
+    /* zigzag: 0,-1,1,-2,... -> 0,1,2,3,... */
+    int64_t rel = (zz & 1u) ? -(int64_t)((zz >> 1) + 1) : (int64_t)(zz >> 1);
+    int64_t off = (int64_t)s->old_pos + rel;
+
+    if (off < 0 || (uint64_t)off + s->len > s->old_len) {
+        s->state = DELTAS_ERROR;
+        return;
+    }
+    memcpy(s->dst + s->pos, s->old + off, s->len);
+    s->pos    += s->len;
+    s->old_pos = (size_t)off + s->len;
+    delta_after_op(s);
+}
+
+static void delta_copy_new(delta_stream_t *s, uint32_t dist)
+{
+    if (dist == 0 || dist > s->pos) {
+        s->state = DELTAS_ERROR;
+        return;
+    }
+    /* byte per byte: dist < len ripete il pattern */
+    uint8_t *out = s->dst + s->pos;
+    const uint8_t *ref = out - dist;
+    for (uint32_t i = 0; i < s->len; i++) {
+        out[i] = ref[i];
+    }
+    s->pos += s->len;
+    delta_after_op(s);
+}
+
+void delta_stream_feed(delta_stream_t *s, uint8_t c)
+{
+    switch (s->state) {
+    case DELTAS_OP:
+        if (!delta_varint(s, c)) {
+            break;
+        }
+        s->len = s->varint >> 2;
+        if (s->len == 0 || s->len > s->dst_len - s->pos) {
+            s->state = DELTAS_ERROR;
+            break;
+        }
+        switch (s->varint & 3u) {
+        case DELTA_OP_ADD:      s->state = DELTAS_ADD;      break;
+        case DELTA_OP_COPY_OLD: s->state = DELTAS_OLD_OFF;  break;
+        case DELTA_OP_COPY_NEW: s->state = DELTAS_NEW_DIST; break;
+        default:                s->state = DELTAS_ERROR;    break;
+        }
+        delta_varint_reset(s);
+        break;
+
+    case DELTAS_ADD:
+        s->dst[s->pos++] = c;
+        if (--s->len == 0) {
+            delta_after_op(s);
+        }
+        break;
+
+    case DELTAS_OLD_OFF:
+        if (delta_varint(s, c)) {
+            uint32_t v = s->varint;
+            delta_varint_reset(s);
+            delta_copy_old(s, v);
+        }
+        break;
+
+    case DELTAS_NEW_DIST:
+        if (delta_varint(s, c)) {
+            uint32_t v = s->varint;
+            delta_varint_reset(s);
+            delta_copy_new(s, v);
+        }
+        break;
+
+    case DELTAS_END:
+        /* byte oltre la fine dell'immagine: patch non valida */
+        s->state = DELTAS_ERROR;
+        break;
+
+    case DELTAS_ERROR:
+    default:
+        break;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef DELTA_STREAM_H
+#define DELTA_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Decoder delle patch di LOAD delta=1 (formato in delta_patch.py lato
+ * gateway), alimentato un byte alla volta dal thread del LOAD come
+ * lz4_stream. Ricostruisce la nuova immagine in dst leggendo la vecchia
+ * (old) ancora in RAM.
+ *
+ * Operazioni: varint (len << 2 | op), poi
+ *   op 0 ADD       len byte letterali
+ *   op 1 COPY_OLD  varint zigzag: offset relativo alla fine dell'ultima COPY_OLD
+ *   op 2 COPY_NEW  varint dist: copia da dst[pos - dist] (sovrapposizione ammessa)
+ */
+
+typedef enum {
+    DELTAS_OP = 0,
+    DELTAS_ADD,
+    DELTAS_OLD_OFF,
+    DELTAS_NEW_DIST,
+    DELTAS_END,
+    DELTAS_ERROR,
+} delta_stream_state_t;
+
+typedef struct {
+    const uint8_t *old;
+    size_t         old_len;
+    uint8_t       *dst;
+    size_t         dst_len;
+    size_t         pos;       /* byte ricostruiti finora */
+    size_t         old_pos;   /* fine dell'ultima COPY_OLD */
+    uint32_t       len;       /* lunghezza dell'operazione corrente */
+    uint32_t       varint;
+    uint8_t        shift;
+    delta_stream_state_t state;
+} delta_stream_t;
+
+void delta_stream_init(delta_stream_t *s, const uint8_t *old, size_t old_len,
+                       uint8_t *dst, size_t dst_len);
+
+/* Consuma un byte di patch; dopo un errore i byte successivi sono ignorati */
+void delta_stream_feed(delta_stream_t *s, uint8_t c);
+
+/* true se la nuova immagine è stata ricostruita esattamente (dst_len byte) */
+static inline bool delta_stream_done(const delta_stream_t *s)
+{
+    return s->state == DELTAS_END;
+}
+
+#endif /* DELTA_STREAM_H */
@@ -0,0 +1,106 @@
+#include "lz4_stream.h"
+
+#define LZ4_MIN_MATCH 4
+
+void lz4_stream_init(lz4_stream_t *s, uint8_t *dst, size_t dst_len)
+{
+    s->dst       = dst;
+    s->dst_len   = dst_len;
+    s->pos       = 0;
+    s->lit_len   = 0;
+    s->match_len = 0;
+    s->offset    = 0;
+    s->state     = LZ4S_TOKEN;
+}
+
+/* fine dei literal: l'ultima sequenza del blocco non ha offset/match */
+static void lz4_after_literals(lz4_stream_t *s)
+{
+    s->state = (s->pos == s->dst_len) ? LZ4S_END : LZ4S_OFFSET_LO;
+}
+
+static void lz4_copy_match(lz4_stream_t *s)
+{
+    uint32_t len = s->match_len + LZ4_MIN_MATCH;
+
+    if (len > s->dst_len - s->pos) {
+        s->state = LZ4S_ERROR;
+        return;
+    }
+
+    /* copia byte per byte: i match possono sovrapporsi (offset < len) */
+    uint8_t *out = s->dst + s->pos;
+    const uint8_t *ref = out - s->offset;
+    for (uint32_t i = 0; i < len; i++) {
+        out[i] = ref[i];
+    }
+    s->pos += len;
+    s->state = LZ4S_TOKEN;
+}
+
+void lz4_stream_feed(lz4_stream_t *s, uint8_t c)
+{
+    switch (s->state) {
+    case LZ4S_TOKEN:
+        s->lit_len   = c >> 4;
+        s->match_len = c & 0x0F;
+        if (s->lit_len == 15) {
+            s->state = LZ4S_LIT_LEN;
+        } else if (s->lit_len > 0) {
+            s->state = LZ4S_LITERALS;
+        } else {
+            lz4_after_literals(s);
+        }
+        break;
+
+    case LZ4S_LIT_LEN:
+        s->lit_len += c;
+        if (c != 255) {
+            s->state = LZ4S_LITERALS;
+        }
+        break;
+
+    case LZ4S_LITERALS:
+        if (s->pos >= s->dst_len) {
+            s->state = LZ4S_ERROR;
+            break;
+        }
+        s->dst[s->pos++] = c;
+        if (--s->lit_len == 0) {
+            lz4_after_literals(s);
+        }
+        break;
+
+    case LZ4S_OFFSET_LO:
+        s->offset = c;
+        s->state = LZ4S_OFFSET_HI;
+        break;
+
+    case LZ4S_OFFSET_HI:
+        s->offset |= (uint32_t)c << 8;
+        if (s->offset == 0 || s->offset > s->pos) {
+            s->state = LZ4S_ERROR;
+        } else if (s->match_len == 15) {
+            s->state = LZ4S_MATCH_LEN;
+        } else {
+            lz4_copy_match(s);
+        }
+        break;
+
+    case LZ4S_MATCH_LEN:
+        s->match_len += c;
+        if (c != 255) {
+            lz4_copy_match(s);
+        }
+        break;
+
+    case LZ4S_END:
+        /* byte oltre la fine dell'immagine: stream non valido */
+        s->state = LZ4S_ERROR;
+        break;
+
+    case LZ4S_ERROR:
+    default:
+        break;
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef LZ4_STREAM_H
+#define LZ4_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Decoder LZ4 (formato "block", senza frame) alimentato un byte alla volta
+ * dal thread del LOAD, che svuota il ring riempito dall'ISR UART: un match
+ * può copiare decine di KB per un solo byte in ingresso. Scrive direttamente
+ * nel buffer di destinazione e usa lo stesso buffer come finestra dei match:
+ * nessuno scratch oltre a questa struct, qualunque sia la dimensione del
+ * modulo.
+ */
+
+typedef enum {
+    LZ4S_TOKEN = 0,
+    LZ4S_LIT_LEN,
+    LZ4S_LITERALS,
+    LZ4S_OFFSET_LO,
+    LZ4S_OFFSET_HI,
+    LZ4S_MATCH_LEN,
+    LZ4S_END,
+    LZ4S_ERROR,
+} lz4_stream_state_t;
+
+typedef struct {
+    uint8_t *dst;
+    size_t   dst_len;
+    size_t   pos;        /* byte decompressi finora */
+    uint32_t lit_len;
+    uint32_t match_len;
+    uint32_t offset;
+    lz4_stream_state_t state;
+} lz4_stream_t;
+
+void lz4_stream_init(lz4_stream_t *s, uint8_t *dst, size_t dst_len);
+
+/* Consuma un byte compresso; dopo un errore i byte successivi sono ignorati */
+void lz4_stream_feed(lz4_stream_t *s, uint8_t c);
+
+/* true se l'immagine è stata ricostruita esattamente (dst_len byte) */
+static inline bool lz4_stream_done(const lz4_stream_t *s)
+{
+    return s->state == LZ4S_END;
+}
+
+#endif /* LZ4_STREAM_H */
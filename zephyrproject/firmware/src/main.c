@@ -16,6 +16,10 @@
 #include "bh_log.h"
 #include "wasm_export.h"
 
+#include "crc32.h"
+#include "lz4_stream.h"
+#include "delta_stream.h"
+
 /* Se non esiste nella build, resta NULL e non rompe il link */
 extern struct sys_heap _system_heap __attribute__((weak));
 
@@ -50,6 +54,116 @@ static uint8_t g_wamr_pool[WAMR_GLOBAL_POOL_SIZE] __attribute__((aligned(8)));
 
 #define STOP_FORCE_DELAY_MS 1200
 
+#define FW_VERSION "1.2.0"
+
+/* ------------------------ HELLO ------------------------ */
+
+/*
+ * Target per cui il gateway compila gli AOT (aot_target.py): isa = --target
+ * di wamrc, cpu = --cpu, fpu = --cpu-features. Dalle macro del compilatore,
+ * quindi fpu=none anche quando la FPU c'è ma CONFIG_FPU è spento (con il
+ * coprocessore disabilitato un'istruzione VFP va in UsageFault). abi è
+ * quella con cui l'invokeNative di WAMR chiama le funzioni AOT.
+ */
+#ifdef CONFIG_BOARD
+#define AGENT_DEVICE_ID CONFIG_BOARD
+#else
+#define AGENT_DEVICE_ID "agent_sim"
+#endif
+
+#if defined(__riscv)
+/* estensioni RISC-V -> stringa ISA (rv32imac, ...) */
+#ifdef __riscv_mul
+#define AGENT_RV_M "m"
+#else
+#define AGENT_RV_M ""
+#endif
+#ifdef __riscv_atomic
+#define AGENT_RV_A "a"
+#else
+#define AGENT_RV_A ""
+#endif
+#if defined(__riscv_flen) && __riscv_flen >= 64
+#define AGENT_RV_FD "fd"
+#elif defined(__riscv_flen)
+#define AGENT_RV_FD "f"
+#else
+#define AGENT_RV_FD ""
+#endif
+#ifdef __riscv_compressed
+#define AGENT_RV_C "c"
+#else
+#define AGENT_RV_C ""
+#endif
+#endif
+
+#if defined(__ARM_ARCH_7EM__)
+#define AGENT_ISA "thumbv7em"
+#elif defined(__ARM_ARCH_7M__)
+#define AGENT_ISA "thumbv7m"
+#elif defined(__ARM_ARCH_8M_MAIN__)
+#define AGENT_ISA "thumbv8m.main"
+#elif defined(__ARM_ARCH_6M__)
+#define AGENT_ISA "thumbv6m"
+#elif defined(__riscv) && __riscv_xlen == 32
+#define AGENT_ISA "rv32i" AGENT_RV_M AGENT_RV_A AGENT_RV_FD AGENT_RV_C
+#elif defined(__x86_64__)
+#define AGENT_ISA "x86_64"                  /* agent_sim */
+#else
+#define AGENT_ISA "unknown"
+#endif
+
+#if defined(CONFIG_CPU_CORTEX_M7)
+#define AGENT_CPU "cortex-m7"
+#elif defined(CONFIG_CPU_CORTEX_M4)
+#define AGENT_CPU "cortex-m4"
+#elif defined(CONFIG_CPU_CORTEX_M33)
+#define AGENT_CPU "cortex-m33"
+#elif defined(CONFIG_CPU_CORTEX_M3)
+#define AGENT_CPU "cortex-m3"
+#elif defined(CONFIG_CPU_CORTEX_M0PLUS)
+#define AGENT_CPU "cortex-m0plus"
+#elif defined(__riscv)
+#define AGENT_CPU "generic-rv32"
+#elif defined(__x86_64__)
+#define AGENT_CPU "x86-64"
+#else
+#define AGENT_CPU "unknown"
+#endif
+
+#if !defined(__ARM_FP)
+#define AGENT_FPU "none"
+#elif defined(CONFIG_CPU_CORTEX_M4)
+#define AGENT_FPU "fpv4-sp-d16"
+#elif (__ARM_FP & 0x8)
+#define AGENT_FPU "fpv5-d16"
+#else
+#define AGENT_FPU "fpv5-sp-d16"
+#endif
+
+#if defined(BUILD_TARGET_THUMB_VFP) || defined(BUILD_TARGET_ARM_VFP)
+#define AGENT_ABI "eabihf"
+#elif defined(__arm__)
+#define AGENT_ABI "eabi"
+#elif defined(__riscv)
+#define AGENT_ABI "ilp32"
+#else
+#define AGENT_ABI "gnu"
+#endif
+
+#if WASM_ENABLE_AOT != 0
+#define AGENT_AOT 1
+#else
+#define AGENT_AOT 0
+#endif
+
+/* PGO_DUMP disponibile (west build ... -- -DWAMR_BUILD_STATIC_PGO=1) */
+#if WASM_ENABLE_STATIC_PGO != 0
+#define AGENT_PGO 1
+#else
+#define AGENT_PGO 0
+#endif
+
 /* ------------------------ UART MsgQ ------------------------ */
 
 K_MSGQ_DEFINE(uart_msgq, LINE_BUF_SIZE, 4, 4);
@@ -118,10 +232,30 @@ typedef enum { RX_STATE_LINE=0, RX_STATE_BINARY } rx_state_t;
 static volatile rx_state_t g_rx_state = RX_STATE_LINE;
 
 /* buffer binario (usato solo durante LOAD, 1 alla volta) */
+typedef enum { BIN_ENC_RAW=0, BIN_ENC_LZ4, BIN_ENC_DELTA } bin_enc_t;
+
 static uint8_t *g_bin_buf      = NULL;
-static size_t   g_bin_expected = 0;
-static size_t   g_bin_received = 0;
-K_SEM_DEFINE(bin_sem, 0, 1);
+static size_t   g_bin_expected = 0;   /* byte sul filo (csize/psize se codificato) */
+static volatile size_t g_bin_received = 0;
+static bin_enc_t    g_bin_enc  = BIN_ENC_RAW;
+static lz4_stream_t g_bin_lz4;        /* decompressione in streaming in g_bin_buf */
+static delta_stream_t g_bin_delta;    /* patch applicata sull'immagine precedente */
+static uint32_t g_bin_crc;            /* CRC32 parziale dei byte già scritti in g_bin_buf */
+static size_t   g_bin_crc_pos;
+/* il CRC lo calcola il thread del LOAD, a blocchi di al più BIN_CRC_CHUNK
+ * byte; in raw l'ISR lo sveglia ogni BIN_CRC_CHUNK byte ricevuti */
+#define BIN_CRC_CHUNK 512u            /* potenza di 2 */
+/* byte lz4/delta ricevuti e non ancora decodificati. La decodifica gira nel
+ * thread del LOAD: un match o una COPY scrivono fino a decine di KB per un
+ * solo byte sul filo, troppo per l'ISR (un byte ogni ~87 us a 115200). */
+#ifndef BIN_RING_SIZE
+#define BIN_RING_SIZE 512u            /* potenza di 2: ~44 ms di ricezione */
+#endif
+static volatile uint8_t  g_bin_ring[BIN_RING_SIZE];
+static volatile uint32_t g_bin_ring_head;   /* scritto solo dall'ISR */
+static volatile uint32_t g_bin_ring_tail;   /* scritto solo dal thread */
+static volatile bool     g_bin_overrun;
+K_SEM_DEFINE(bin_sem, 0, 1);          /* dati nel ring o payload completo */
 K_MUTEX_DEFINE(uart_mutex);
 /* Semaforo per serializzare accesso LED */
 K_MUTEX_DEFINE(gpio_mutex);
@@ -129,15 +263,18 @@ K_MUTEX_DEFINE(gpio_mutex);
 /* ------------------------ Prototypes ------------------------ */
 
 static void agent_write_str(const char *s);
+static void agent_write_blob(const char *head, const uint8_t *data, size_t len);
 static int  agent_read_line(char *buf, size_t max_len);
 
-static uint32_t crc32_calc(const uint8_t *data, size_t len);
-
 static void handle_command_line(char *line);
 static void handle_load_cmd(const char *line);
 static void handle_start_cmd(const char *line);
 static void handle_stop_cmd(const char *line);
 static void handle_status_cmd(const char *line);
+#if WASM_ENABLE_STATIC_PGO != 0
+static void handle_pgo_dump_cmd(const char *line);
+#endif
+static void agent_write_hello(void);
 
 static bool wasm_runtime_init_all(void);
 
@@ -148,22 +285,6 @@ static void slot_cleanup(module_slot_t *slot);
 static void module_worker(void *p1, void *p2, void *p3);
 static module_slot_t *slot_from_current_thread(void);
 
-/* ------------------------ CRC32 (zlib) ------------------------ */
-
-static uint32_t crc32_calc(const uint8_t *data, size_t len)
-{
-    uint32_t crc = 0xFFFFFFFFu;
-    for (size_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            uint32_t lsb  = crc & 1u;
-            uint32_t mask = -(int32_t)lsb;
-            crc = (crc >> 1) ^ (0xEDB88320u & mask);
-        }
-    }
-    return ~crc;
-}
-
 /* ------------------------ UART ISR ------------------------ */
 
 static void serial_cb(const struct device *dev, void *user_data)
@@ -187,10 +308,29 @@ static void serial_cb(const struct device *dev, void *user_data)
             }
         } else { /* RX_STATE_BINARY */
             if (g_bin_buf != NULL && g_bin_received < g_bin_expected) {
-                g_bin_buf[g_bin_received++] = c;
+                if (g_bin_enc != BIN_ENC_RAW) {
+                    /* al thread del LOAD, svegliato quando il ring era vuoto */
+                    uint32_t head = g_bin_ring_head;
+                    uint32_t tail = g_bin_ring_tail;
+                    if (head - tail == BIN_RING_SIZE) {
+                        g_bin_overrun = true;
+                    } else {
+                        g_bin_ring[head & (BIN_RING_SIZE - 1u)] = c;
+                        g_bin_ring_head = head + 1u;
+                        if (head == tail) {
+                            k_sem_give(&bin_sem);
+                        }
+                    }
+                } else {
+                    g_bin_buf[g_bin_received] = c;
+                }
+                g_bin_received++;
                 if (g_bin_received == g_bin_expected) {
                     g_rx_state = RX_STATE_LINE;
                     k_sem_give(&bin_sem);
+                } else if (g_bin_enc == BIN_ENC_RAW &&
+                           (g_bin_received & (BIN_CRC_CHUNK - 1u)) == 0) {
+                    k_sem_give(&bin_sem);
                 }
             }
         }
@@ -262,9 +402,12 @@ static void led_toggle_native(wasm_exec_env_t exec_env, uint32_t duration_ms)
 
 
 static NativeSymbol native_symbols[] = {
-    { "gpio_toggle",  gpio_toggle_native,  "()"  },
-    { "uart_print", (void *)uart_print_native, "(i)" },
-    { "led_toggle", (void *)led_toggle_native, "(i)" },
+    { .symbol = "gpio_toggle", .func_ptr = gpio_toggle_native,
+      .signature = "()",  .attachment = NULL },
+    { .symbol = "uart_print",  .func_ptr = (void *)uart_print_native,
+      .signature = "(i)", .attachment = NULL },
+    { .symbol = "led_toggle",  .func_ptr = (void *)led_toggle_native,
+      .signature = "(i)", .attachment = NULL },
 };
 
 /* ------------------------ Param parsing ------------------------ */
@@ -275,7 +418,8 @@ static const char *find_param(const char *line, const char *key)
     const char *p = line;
 
     while ((p = strstr(p, key)) != NULL) {
-        if (p[key_len] == '=') {
+        /* chiave intera: "size" non deve matchare dentro "csize=" */
+        if (p[key_len] == '=' && (p == line || p[-1] == ' ')) {
             return p + key_len + 1;
         }
         p++;
@@ -445,7 +589,7 @@ static module_slot_t *slot_alloc(const char *module_id)
         if (!slot->used) {
             memset(slot, 0, sizeof(*slot));
             slot->used = true;
-            strncpy(slot->module_id, module_id, sizeof(slot->module_id) - 1);
+            snprintf(slot->module_id, sizeof(slot->module_id), "%s", module_id);
 
             k_sem_init(&slot->work_sem, 0, 1);
 
@@ -599,6 +743,70 @@ static void module_worker(void *p1, void *p2, void *p3)
 
 /* ------------------------ Command handlers ------------------------ */
 
+/* Porta il CRC fino a g_bin_buf[done - 1], un blocco alla volta */
+static void bin_crc_advance(size_t done)
+{
+    while (g_bin_crc_pos < done) {
+        size_t n = done - g_bin_crc_pos;
+        if (n > BIN_CRC_CHUNK) {
+            n = BIN_CRC_CHUNK;
+        }
+        g_bin_crc = crc32_update(g_bin_crc, g_bin_buf + g_bin_crc_pos, n);
+        g_bin_crc_pos += n;
+    }
+}
+
+/* Decodifica i byte lz4/delta accodati dall'ISR e aggiorna il CRC di quanto
+ * scritto in g_bin_buf. Gira nel thread del LOAD, con l'ISR attiva. */
+static void bin_ring_drain(void)
+{
+    uint32_t tail = g_bin_ring_tail;
+
+    while (tail != g_bin_ring_head) {
+        uint8_t c = g_bin_ring[tail & (BIN_RING_SIZE - 1u)];
+        size_t done;
+
+        if (g_bin_enc == BIN_ENC_LZ4) {
+            lz4_stream_feed(&g_bin_lz4, c);
+            done = g_bin_lz4.pos;
+        } else {
+            delta_stream_feed(&g_bin_delta, c);
+            done = g_bin_delta.pos;
+        }
+        g_bin_ring_tail = ++tail;
+        bin_crc_advance(done);
+    }
+}
+
+/* Attende il payload binario entro timeout_ms, decodificando e calcolando il
+ * CRC man mano.
+ * false su timeout o se il ring si è riempito: in quel caso aspetta comunque
+ * la fine del payload, così i byte residui non diventano righe di comando. */
+static bool bin_wait_payload(int64_t timeout_ms)
+{
+    int64_t deadline = k_uptime_get() + timeout_ms;
+
+    for (;;) {
+        /* stato letto prima di svuotare: l'ISR accoda l'ultimo byte e poi
+         * torna in RX_STATE_LINE */
+        bool complete = (g_rx_state == RX_STATE_LINE);
+
+        if (g_bin_enc == BIN_ENC_RAW) {
+            bin_crc_advance(g_bin_received);
+        } else if (!g_bin_overrun) {
+            bin_ring_drain();
+        }
+        if (complete) {
+            return !g_bin_overrun;
+        }
+
+        int64_t left = deadline - k_uptime_get();
+        if (left <= 0 || k_sem_take(&bin_sem, K_MSEC(left)) != 0) {
+            return false;
+        }
+    }
+}
+
 static void handle_load_cmd(const char *line)
 {
     k_mutex_lock(&load_mutex, K_FOREVER);
@@ -606,18 +814,30 @@ static void handle_load_cmd(const char *line)
     bool warn_ignored_victim = false;
     char size_str[16];
     char crc_str[16];
+    char enc_str[8] = "raw";
     char module_id_buf[32];
     char victim_id_buf[32] = {0};
     char out_buf[200];
 
     bool do_replace = false;
     bool have_victim = false;
+    bin_enc_t enc = BIN_ENC_RAW;
+    uint32_t csize = 0;
+    uint32_t psize = 0;
+    uint32_t base_crc = 0;
+    uint8_t *base_buf = NULL;   /* immagine precedente, sorgente della patch */
+    uint32_t base_size = 0;
 
     const char *p_mod    = find_param(line, "module_id");
     const char *p_size   = find_param(line, "size");
     const char *p_crc    = find_param(line, "crc32");
     const char *p_rep    = find_param(line, "replace");
     const char *p_victim = find_param(line, "replace_victim");
+    const char *p_enc    = find_param(line, "enc");
+    const char *p_csize  = find_param(line, "csize");
+    const char *p_delta  = find_param(line, "delta");
+    const char *p_bcrc   = find_param(line, "base_crc");
+    const char *p_psize  = find_param(line, "psize");
 
     if (!p_mod || !p_size || !p_crc) {
         agent_write_str("LOAD_ERR code=BAD_PARAMS msg=\"missing module_id/size/crc32\"\n");
@@ -647,10 +867,78 @@ static void handle_load_cmd(const char *line)
 
     uint32_t crc_expected = (uint32_t)strtoul(crc_str, NULL, 16);
 
+    /* enc=lz4: sul filo arrivano csize byte, size resta la dimensione decompressa */
+    if (p_enc) {
+        copy_param_value(p_enc, enc_str, sizeof(enc_str));
+        if (strcmp(enc_str, "lz4") == 0) {
+            enc = BIN_ENC_LZ4;
+        } else if (strcmp(enc_str, "raw") != 0) {
+            agent_write_str("LOAD_ERR code=BAD_ENC msg=\"unsupported enc\"\n");
+            goto out;
+        }
+    }
+    if (enc == BIN_ENC_LZ4) {
+        char csize_str[16] = {0};
+        if (p_csize) {
+            copy_param_value(p_csize, csize_str, sizeof(csize_str));
+        }
+        csize = (uint32_t)atoi(csize_str);
+        if (csize == 0) {
+            agent_write_str("LOAD_ERR code=BAD_PARAMS msg=\"enc=lz4 requires csize\"\n");
+            goto out;
+        }
+    }
+
+    /* delta=1: sul filo arriva una patch di psize byte da applicare
+     * all'immagine già caricata in module_id (vedi delta_patch.py) */
+    if (p_delta) {
+        char delta_str[4];
+        copy_param_value(p_delta, delta_str, sizeof(delta_str));
+        if (delta_str[0] == '1') {
+            if (enc != BIN_ENC_RAW) {
+                agent_write_str("LOAD_ERR code=BAD_ENC msg=\"delta requires enc=raw\"\n");
+                goto out;
+            }
+            char bcrc_str[16] = {0};
+            char psize_str[16] = {0};
+            if (p_bcrc) {
+                copy_param_value(p_bcrc, bcrc_str, sizeof(bcrc_str));
+            }
+            if (p_psize) {
+                copy_param_value(p_psize, psize_str, sizeof(psize_str));
+            }
+            psize = (uint32_t)atoi(psize_str);
+            if (bcrc_str[0] == '\0' || psize == 0) {
+                agent_write_str("LOAD_ERR code=BAD_PARAMS msg=\"delta=1 requires base_crc/psize\"\n");
+                goto out;
+            }
+            base_crc = (uint32_t)strtoul(bcrc_str, NULL, 16);
+            enc = BIN_ENC_DELTA;
+        }
+    }
+
     /* Admission control pool (come già fai) ... */
 
     module_slot_t *slot = slot_find(module_id_buf);
 
+    if (enc == BIN_ENC_DELTA) {
+        if (!slot || !slot->wasm_buf) {
+            agent_write_str("LOAD_ERR code=NO_BASE msg=\"module not loaded\"\n");
+            goto out;
+        }
+        /* verifica prima di fermare il worker: con base sbagliata il modulo
+         * in esecuzione resta intatto. Il CRC è ricalcolato sul buffer
+         * perché l'interprete riscrive il bytecode in place al load. */
+        uint32_t crc_base = crc32_calc(slot->wasm_buf, slot->wasm_size);
+        if (crc_base != base_crc) {
+            snprintf(out_buf, sizeof(out_buf),
+                     "LOAD_ERR code=BASE_MISMATCH msg=\"expected=%08lx got=%08lx\"\n",
+                     (unsigned long)base_crc, (unsigned long)crc_base);
+            agent_write_str(out_buf);
+            goto out;
+        }
+    }
+
     if (slot) {
         if (have_victim) {
             /* module_id esiste già -> replace in-place, quindi replace_victim non serve */
@@ -669,6 +957,12 @@ static void handle_load_cmd(const char *line)
             slot_ensure_worker(slot);
         }
 
+        if (enc == BIN_ENC_DELTA) {
+            /* stacca la vecchia immagine: serve fino a fine ricezione */
+            base_buf  = slot->wasm_buf;
+            base_size = slot->wasm_size;
+            slot->wasm_buf = NULL;
+        }
         slot_cleanup(slot);
         /* module_id già corretto */
     } else {
@@ -698,8 +992,7 @@ static void handle_load_cmd(const char *line)
                 slot_cleanup(victim);
 
                 /* riuso lo slot del victim per il nuovo module_id */
-                strncpy(victim->module_id, module_id_buf, sizeof(victim->module_id) - 1);
-                victim->module_id[sizeof(victim->module_id) - 1] = '\0';
+                snprintf(victim->module_id, sizeof(victim->module_id), "%s", module_id_buf);
                 slot = victim;
             } else {
                 agent_write_str("LOAD_ERR code=NO_SLOT msg=\"MAX_MODULES reached\"\n");
@@ -718,19 +1011,48 @@ static void handle_load_cmd(const char *line)
     /* prepara RX binaria (1 LOAD alla volta) */
     unsigned int key = irq_lock();
     g_bin_buf      = slot->wasm_buf;
-    g_bin_expected = slot->wasm_size;
+    g_bin_enc      = enc;
+    g_bin_expected = (enc == BIN_ENC_LZ4)   ? csize :
+                     (enc == BIN_ENC_DELTA) ? psize : slot->wasm_size;
     g_bin_received = 0;
+    g_bin_crc      = 0;
+    g_bin_crc_pos  = 0;
+    g_bin_ring_head = 0;
+    g_bin_ring_tail = 0;
+    g_bin_overrun   = false;
+    if (enc == BIN_ENC_LZ4) {
+        lz4_stream_init(&g_bin_lz4, slot->wasm_buf, slot->wasm_size);
+    } else if (enc == BIN_ENC_DELTA) {
+        delta_stream_init(&g_bin_delta, base_buf, base_size,
+                          slot->wasm_buf, slot->wasm_size);
+    }
     g_rx_state     = RX_STATE_BINARY;
     k_sem_reset(&bin_sem);
     irq_unlock(key);
 
-    snprintf(out_buf, sizeof(out_buf),
-             "LOAD_READY module_id=%s size=%lu crc32=%s\n",
-             slot->module_id, (unsigned long)slot->wasm_size, crc_str);
+    if (enc == BIN_ENC_LZ4) {
+        snprintf(out_buf, sizeof(out_buf),
+                 "LOAD_READY module_id=%s size=%lu crc32=%s enc=lz4 csize=%lu\n",
+                 slot->module_id, (unsigned long)slot->wasm_size, crc_str,
+                 (unsigned long)csize);
+    } else if (enc == BIN_ENC_DELTA) {
+        snprintf(out_buf, sizeof(out_buf),
+                 "LOAD_READY module_id=%s size=%lu crc32=%s delta=1 psize=%lu\n",
+                 slot->module_id, (unsigned long)slot->wasm_size, crc_str,
+                 (unsigned long)psize);
+    } else {
+        snprintf(out_buf, sizeof(out_buf),
+                 "LOAD_READY module_id=%s size=%lu crc32=%s\n",
+                 slot->module_id, (unsigned long)slot->wasm_size, crc_str);
+    }
     agent_write_str(out_buf);
 
-    if (k_sem_take(&bin_sem, K_SECONDS(5)) != 0) {
-        agent_write_str("LOAD_ERR code=TIMEOUT msg=\"binary payload not received\"\n");
+    if (!bin_wait_payload(5000)) {
+        if (g_bin_overrun) {
+            agent_write_str("LOAD_ERR code=OVERRUN msg=\"decoder fell behind the UART\"\n");
+        } else {
+            agent_write_str("LOAD_ERR code=TIMEOUT msg=\"binary payload not received\"\n");
+        }
         key = irq_lock();
         g_rx_state = RX_STATE_LINE;
         g_bin_buf = NULL;
@@ -746,7 +1068,31 @@ static void handle_load_cmd(const char *line)
     g_bin_buf = NULL;
     irq_unlock(key);
 
-    uint32_t crc_calc = crc32_calc(slot->wasm_buf, slot->wasm_size);
+    if (enc == BIN_ENC_LZ4 && !lz4_stream_done(&g_bin_lz4)) {
+        snprintf(out_buf, sizeof(out_buf),
+                 "LOAD_ERR code=BAD_ENCODING msg=\"lz4 decoded=%lu/%lu\"\n",
+                 (unsigned long)g_bin_lz4.pos, (unsigned long)slot->wasm_size);
+        agent_write_str(out_buf);
+        slot_cleanup(slot);
+        goto out;
+    }
+
+    if (base_buf) {
+        wasm_runtime_free(base_buf);
+        base_buf = NULL;
+    }
+    if (enc == BIN_ENC_DELTA && !delta_stream_done(&g_bin_delta)) {
+        snprintf(out_buf, sizeof(out_buf),
+                 "LOAD_ERR code=BAD_DELTA msg=\"decoded=%lu/%lu\"\n",
+                 (unsigned long)g_bin_delta.pos, (unsigned long)slot->wasm_size);
+        agent_write_str(out_buf);
+        slot_cleanup(slot);
+        goto out;
+    }
+
+    /* g_bin_crc copre tutti i byte scritti: con raw/lz4/delta completi
+     * coincide con il CRC dell'intera immagine */
+    uint32_t crc_calc = g_bin_crc;
     if (crc_calc != crc_expected) {
         snprintf(out_buf, sizeof(out_buf),
                  "LOAD_ERR code=BAD_CRC msg=\"expected=%08lx got=%08lx\"\n",
@@ -800,6 +1146,9 @@ static void handle_load_cmd(const char *line)
     }
 
 out:
+    if (base_buf) {
+        wasm_runtime_free(base_buf);
+    }
     k_mutex_unlock(&load_mutex);
 }
 
@@ -886,14 +1235,12 @@ static void handle_start_cmd(const char *line)
             }
             return;
         }
-        strncpy(func_name, "app_main", sizeof(func_name) - 1);
-        func_name[sizeof(func_name) - 1] = '\0';
+        snprintf(func_name, sizeof(func_name), "%s", "app_main");
     }
 
     /* 3) Fill request */
     memset(&slot->req, 0, sizeof(slot->req));
-    strncpy(slot->req.func_name, func_name, sizeof(slot->req.func_name) - 1);
-    slot->req.func_name[sizeof(slot->req.func_name) - 1] = '\0'; 
+    snprintf(slot->req.func_name, sizeof(slot->req.func_name), "%s", func_name);
     slot->req.argc = argc_local;
     for (uint32_t i = 0; i < argc_local; i++) {
         slot->req.argv[i] = argv_local[i];
@@ -992,6 +1339,83 @@ static void handle_status_cmd(const char *line)
 
 
 
+#if WASM_ENABLE_STATIC_PGO != 0
+/* ------------------------ PGO_DUMP ------------------------ */
+
+/* LLVMProfileRawHeader di WAMR (14 campi uint64): un modulo senza
+ * contatori produce solo questo */
+#define PGO_RAW_HEADER_SIZE (14 * 8)
+
+/*
+ * Profilo di un modulo AOT compilato con wamrc --enable-llvm-pgo: i
+ * contatori partono dal LOAD e crescono a ogni START. Risposta:
+ *   PGO_DATA module_id=<id> size=<N> crc32=<hex>\n + N byte raw + \n
+ * cioè un .profraw LLVM, da passare a llvm-profdata merge. Il \n finale
+ * chiude la riga per chi legge a righe (e fa partire il TX di agent_sim). Il buffer viene
+ * dal pool WAMR e torna libero appena inviato.
+ */
+static void handle_pgo_dump_cmd(const char *line)
+{
+    char module_id_buf[32];
+    char out[128];
+    const char *p_mod = find_param(line, "module_id");
+
+    if (!p_mod) {
+        agent_write_str("PGO_ERR code=NO_MODULE_ID\n");
+        return;
+    }
+    copy_param_value(p_mod, module_id_buf, sizeof(module_id_buf));
+
+    module_slot_t *slot = slot_find(module_id_buf);
+    if (!slot || !slot->inst) {
+        agent_write_str("PGO_ERR code=NO_MODULE\n");
+        return;
+    }
+    if (slot->busy) {
+        /* il worker sta ancora aggiornando i contatori */
+        agent_write_str("PGO_ERR code=BUSY\n");
+        return;
+    }
+
+    uint32_t size = wasm_runtime_get_pgo_prof_data_size(slot->inst);
+    if (size <= PGO_RAW_HEADER_SIZE) {
+        /* modulo .wasm o AOT senza --enable-llvm-pgo */
+        agent_write_str("PGO_ERR code=NOT_INSTRUMENTED\n");
+        return;
+    }
+
+    char *buf = wasm_runtime_malloc(size);
+    if (!buf) {
+        snprintf(out, sizeof(out), "PGO_ERR code=NO_MEM size=%lu\n", (unsigned long)size);
+        agent_write_str(out);
+        return;
+    }
+
+    if (wasm_runtime_dump_pgo_prof_data_to_buf(slot->inst, buf, size) != size) {
+        agent_write_str("PGO_ERR code=DUMP_FAIL\n");
+    } else {
+        snprintf(out, sizeof(out), "PGO_DATA module_id=%s size=%lu crc32=%08lx\n",
+                 slot->module_id, (unsigned long)size,
+                 (unsigned long)crc32_calc((const uint8_t *)buf, size));
+        agent_write_blob(out, (const uint8_t *)buf, size);
+    }
+    wasm_runtime_free(buf);
+}
+#endif
+
+/* ------------------------ HELLO / INFO ------------------------ */
+
+static void agent_write_hello(void)
+{
+    char out[192];
+    snprintf(out, sizeof(out),
+             "HELLO device_id=%s rtos=Zephyr runtime=WAMR fw_version=%s "
+             "isa=%s cpu=%s fpu=%s abi=%s aot=%d pgo=%d\n",
+             AGENT_DEVICE_ID, FW_VERSION,
+             AGENT_ISA, AGENT_CPU, AGENT_FPU, AGENT_ABI, AGENT_AOT, AGENT_PGO);
+    agent_write_str(out);
+}
+
 /* ------------------------ Command dispatcher ------------------------ */
 
 static void handle_command_line(char *line)
@@ -1014,6 +1438,15 @@ static void handle_command_line(char *line)
         handle_stop_cmd(rest ? rest : "");
     } else if (strcmp(cmd, "STATUS") == 0) {
         handle_status_cmd(rest ? rest : "");
+    } else if (strcmp(cmd, "INFO") == 0) {
+        /* il gateway si collega dopo il boot: ripete il banner */
+        agent_write_hello();
+    } else if (strcmp(cmd, "PGO_DUMP") == 0) {
+#if WASM_ENABLE_STATIC_PGO != 0
+        handle_pgo_dump_cmd(rest ? rest : "");
+#else
+        agent_write_str("PGO_ERR code=NOT_SUPPORTED\n");
+#endif
     } else {
         agent_write_str("ERROR code=UNKNOWN_COMMAND\n");
     }
@@ -1076,7 +1509,7 @@ static void comm_thread_entry(void *arg1, void *arg2, void *arg3)
         return;
     }
 
-    agent_write_str("HELLO device_id=nucleo_f746zg rtos=Zephyr runtime=WAMR fw_version=1.0.0\n");
+    agent_write_hello();
 
     char line_buf[LINE_BUF_SIZE];
     for (;;) {
@@ -1132,6 +1565,26 @@ static void agent_write_str(const char *buf)
     k_mutex_unlock(&uart_tx_mutex);
 }
 
+/* riga di intestazione + payload binario + \n, senza output di altri thread in mezzo */
+static void agent_write_blob(const char *head, const uint8_t *data, size_t len)
+{
+    if (!uart_dev || !head) {
+        return;
+    }
+
+    k_mutex_lock(&uart_tx_mutex, K_FOREVER);
+
+    for (const char *c = head; *c; c++) {
+        uart_poll_out(uart_dev, *c);
+    }
+    for (size_t i = 0; i < len; i++) {
+        uart_poll_out(uart_dev, data[i]);
+    }
+    uart_poll_out(uart_dev, '\n');
+
+    k_mutex_unlock(&uart_tx_mutex);
+}
+
 static int agent_read_line(char *buf, size_t max_len)
 {
     if (!buf || max_len == 0) {
@@ -90,6 +90,109 @@ static uint8_t g_wamr_pool[WAMR_GLOBAL_POOL_SIZE] __attribute__((aligned(8)));
 
 #define STOP_FORCE_DELAY_MS 1200
 
+#define FW_VERSION "1.1.0"
+
+/* ------------------------ HELLO ------------------------ */
+
+/*
+ * Target per cui il gateway compila gli AOT (aot_target.py): isa = --target
+ * di wamrc, cpu = --cpu, fpu = --cpu-features. Dalle macro del compilatore,
+ * quindi fpu=none anche quando la FPU c'è ma CONFIG_FPU è spento (con il
+ * coprocessore disabilitato un'istruzione VFP va in UsageFault). abi è
+ * quella con cui l'invokeNative di WAMR chiama le funzioni AOT.
+ */
+#ifdef CONFIG_BOARD
+#define AGENT_DEVICE_ID CONFIG_BOARD
+#else
+#define AGENT_DEVICE_ID "agent_sim"
+#endif
+
+#if defined(__riscv)
+/* estensioni RISC-V -> stringa ISA (rv32imac, ...) */
+#ifdef __riscv_mul
+#define AGENT_RV_M "m"
+#else
+#define AGENT_RV_M ""
+#endif
+#ifdef __riscv_atomic
+#define AGENT_RV_A "a"
+#else
+#define AGENT_RV_A ""
+#endif
+#if defined(__riscv_flen) && __riscv_flen >= 64
+#define AGENT_RV_FD "fd"
+#elif defined(__riscv_flen)
+#define AGENT_RV_FD "f"
+#else
+#define AGENT_RV_FD ""
+#endif
+#ifdef __riscv_compressed
+#define AGENT_RV_C "c"
+#else
+#define AGENT_RV_C ""
+#endif
+#endif
+
+#if defined(__ARM_ARCH_7EM__)
+#define AGENT_ISA "thumbv7em"
+#elif defined(__ARM_ARCH_7M__)
+#define AGENT_ISA "thumbv7m"
+#elif defined(__ARM_ARCH_8M_MAIN__)
+#define AGENT_ISA "thumbv8m.main"
+#elif defined(__ARM_ARCH_6M__)
+#define AGENT_ISA "thumbv6m"
+#elif defined(__riscv) && __riscv_xlen == 32
+#define AGENT_ISA "rv32i" AGENT_RV_M AGENT_RV_A AGENT_RV_FD AGENT_RV_C
+#elif defined(__x86_64__)
+#define AGENT_ISA "x86_64"                  /* agent_sim */
+#else
+#define AGENT_ISA "unknown"
+#endif
+
+#if defined(CONFIG_CPU_CORTEX_M7)
+#define AGENT_CPU "cortex-m7"
+#elif defined(CONFIG_CPU_CORTEX_M4)
+#define AGENT_CPU "cortex-m4"
+#elif defined(CONFIG_CPU_CORTEX_M33)
+#define AGENT_CPU "cortex-m33"
+#elif defined(CONFIG_CPU_CORTEX_M3)
+#define AGENT_CPU "cortex-m3"
+#elif defined(CONFIG_CPU_CORTEX_M0PLUS)
+#define AGENT_CPU "cortex-m0plus"
+#elif defined(__riscv)
+#define AGENT_CPU "generic-rv32"
+#elif defined(__x86_64__)
+#define AGENT_CPU "x86-64"
+#else
+#define AGENT_CPU "unknown"
+#endif
+
+#if !defined(__ARM_FP)
+#define AGENT_FPU "none"
+#elif defined(CONFIG_CPU_CORTEX_M4)
+#define AGENT_FPU "fpv4-sp-d16"
+#elif (__ARM_FP & 0x8)
+#define AGENT_FPU "fpv5-d16"
+#else
+#define AGENT_FPU "fpv5-sp-d16"
+#endif
+
+#if defined(BUILD_TARGET_THUMB_VFP) || defined(BUILD_TARGET_ARM_VFP)
+#define AGENT_ABI "eabihf"
+#elif defined(__arm__)
+#define AGENT_ABI "eabi"
+#elif defined(__riscv)
+#define AGENT_ABI "ilp32"
+#else
+#define AGENT_ABI "gnu"
+#endif
+
+#if WASM_ENABLE_AOT != 0
+#define AGENT_AOT 1
+#else
+#define AGENT_AOT 0
+#endif
+
 /* ------------------------ UART MsgQ ------------------------ */
 
 K_MSGQ_DEFINE(uart_msgq, LINE_BUF_SIZE, 4, 4);
@@ -178,6 +281,7 @@ static void handle_load_cmd(const char *line);
 static void handle_start_cmd(const char *line);
 static void handle_stop_cmd(const char *line);
 static void handle_status_cmd(const char *line);
+static void agent_write_hello(void);
 
 static bool wasm_runtime_init_all(void);
 
@@ -1032,6 +1136,19 @@ static void handle_status_cmd(const char *line)
 
 
 
+/* ------------------------ HELLO / INFO ------------------------ */
+
+static void agent_write_hello(void)
+{
+    char out[192];
+    snprintf(out, sizeof(out),
+             "HELLO device_id=%s rtos=Zephyr runtime=WAMR fw_version=%s "
+             "isa=%s cpu=%s fpu=%s abi=%s aot=%d\n",
+             AGENT_DEVICE_ID, FW_VERSION,
+             AGENT_ISA, AGENT_CPU, AGENT_FPU, AGENT_ABI, AGENT_AOT);
+    agent_write_str(out);
+}
+
 /* ------------------------ Command dispatcher ------------------------ */
 
 static void handle_command_line(char *line)
@@ -1054,6 +1171,9 @@ static void handle_command_line(char *line)
         handle_stop_cmd(rest ? rest : "");
     } else if (strcmp(cmd, "STATUS") == 0) {
         handle_status_cmd(rest ? rest : "");
+    } else if (strcmp(cmd, "INFO") == 0) {
+        /* il gateway si collega dopo il boot: ripete il banner */
+        agent_write_hello();
     } else {
         agent_write_str("ERROR code=UNKNOWN_COMMAND\n");
     }
@@ -1116,7 +1236,7 @@ static void comm_thread_entry(void *arg1, void *arg2, void *arg3)
         return;
     }
 
-    agent_write_str("HELLO device_id=nucleo_f746zg rtos=Zephyr runtime=WAMR fw_version=1.0.0\n");
+    agent_write_hello();
 
     char line_buf[LINE_BUF_SIZE];
     for (;;) {
@@ -299,6 +299,11 @@
 #define WASM_ENABLE_OPCODE_COUNTER 0
 #endif
 
+/* Slots of the opcode pair table of the opcode counter, a power of 2 */
+#ifndef WASM_OPCODE_PAIR_SLOTS
+#define WASM_OPCODE_PAIR_SLOTS 1024
+#endif
+
 /* Support a module with dependency, other modules */
 #ifndef WASM_ENABLE_MULTI_MODULE
 #define WASM_ENABLE_MULTI_MODULE 0
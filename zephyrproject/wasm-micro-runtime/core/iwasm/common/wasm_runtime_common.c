@@ -2121,6 +2121,27 @@ wasm_runtime_get_wasm_func_exec_time(WASMModuleInstanceCommon *inst,
 }
 #endif /* WASM_ENABLE_PERF_PROFILING != 0 */
 
+uint64
+wasm_runtime_get_opcode_counters(wasm_opcode_counter_callback_t callback,
+                                 void *user_data)
+{
+#if WASM_ENABLE_INTERP != 0 && WASM_ENABLE_OPCODE_COUNTER != 0
+    return wasm_get_opcode_counters(callback, user_data);
+#else
+    (void)callback;
+    (void)user_data;
+    return 0;
+#endif
+}
+
+void
+wasm_runtime_reset_opcode_counters(void)
+{
+#if WASM_ENABLE_INTERP != 0 && WASM_ENABLE_OPCODE_COUNTER != 0
+    wasm_reset_opcode_counters();
+#endif
+}
+
 WASMModuleInstanceCommon *
 wasm_runtime_get_module_inst(WASMExecEnv *exec_env)
 {
@@ -1936,6 +1936,36 @@ WASM_RUNTIME_API_EXTERN double
 wasm_runtime_get_wasm_func_exec_time(wasm_module_inst_t inst,
                                      const char *func_name);
 
+/* Callback of wasm_runtime_get_opcode_counters */
+typedef void (*wasm_opcode_counter_callback_t)(void *user_data,
+                                               const char *opcode,
+                                               const char *next_opcode,
+                                               uint64_t count);
+
+/**
+ * Get the dynamic opcode counts of the interpreter since the last
+ * wasm_runtime_reset_opcode_counters, in a build with
+ * WASM_ENABLE_OPCODE_COUNTER: the callback is called first for each
+ * executed opcode, with next_opcode NULL, then for each pair of opcodes
+ * executed one after the other. The counters are global to the runtime
+ * and not thread safe.
+ *
+ * @param callback called once per opcode and once per pair
+ * @param user_data passed to the callback
+ *
+ * @return the pair executions left out because the pair table
+ *         (WASM_OPCODE_PAIR_SLOTS) was full, 0 without the counter
+ */
+WASM_RUNTIME_API_EXTERN uint64_t
+wasm_runtime_get_opcode_counters(wasm_opcode_counter_callback_t callback,
+                                 void *user_data);
+
+/**
+ * Reset the opcode counters of the interpreter (WASM_ENABLE_OPCODE_COUNTER)
+ */
+WASM_RUNTIME_API_EXTERN void
+wasm_runtime_reset_opcode_counters(void);
+
 /* wasm thread callback function type */
 typedef void *(*wasm_thread_callback_t)(wasm_exec_env_t, void *);
 /* wasm thread type */
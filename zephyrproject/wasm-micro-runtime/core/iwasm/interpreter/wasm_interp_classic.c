@@ -1473,7 +1473,17 @@ wasm_interp_call_func_import(WASMModuleInstance *module_inst,
 #if WASM_ENABLE_LABELS_AS_VALUES != 0
 
 #define HANDLE_OP(opcode) HANDLE_##opcode:
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+/* Counted at dispatch, where the opcode is known also for the handlers
+   shared by several opcodes */
+#define FETCH_OPCODE_AND_DISPATCH()          \
+    do {                                     \
+        wasm_interp_count_opcode(*frame_ip); \
+        goto *handle_table[*frame_ip++];     \
+    } while (0)
+#else
 #define FETCH_OPCODE_AND_DISPATCH() goto *handle_table[*frame_ip++]
+#endif
 
 #if WASM_ENABLE_THREAD_MGR != 0 && WASM_ENABLE_DEBUG_INTERP != 0
 #define HANDLE_OP_END()                                                       \
@@ -1495,7 +1505,7 @@ wasm_interp_call_func_import(WASMModuleInstance *module_inst,
             os_mutex_unlock(&exec_env->wait_lock);                            \
         }                                                                     \
         CHECK_INSTRUCTION_LIMIT();                                            \
-        goto *handle_table[*frame_ip++];                                      \
+        FETCH_OPCODE_AND_DISPATCH();                                          \
     } while (0)
 #else
 #define HANDLE_OP_END()        \
@@ -1674,6 +1684,9 @@ wasm_interp_call_func_bytecode(WASMModuleInstance *module,
 #if WASM_ENABLE_LABELS_AS_VALUES == 0
     while (frame_ip < frame_ip_end) {
         opcode = *frame_ip++;
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+        wasm_interp_count_opcode(opcode);
+#endif
         switch (opcode) {
 #else
     FETCH_OPCODE_AND_DISPATCH();
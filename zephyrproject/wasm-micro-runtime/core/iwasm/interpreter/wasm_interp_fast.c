@@ -1393,45 +1393,22 @@ wasm_interp_call_func_import(WASMModuleInstance *module_inst,
     } while (0)
 #endif
 
-#if WASM_ENABLE_OPCODE_COUNTER != 0
-typedef struct OpcodeInfo {
-    char *name;
-    uint64 count;
-} OpcodeInfo;
-
-/* clang-format off */
-#define HANDLE_OPCODE(op) \
-    {                     \
-        #op, 0            \
-    }
-DEFINE_GOTO_TABLE(OpcodeInfo, opcode_table);
-#undef HANDLE_OPCODE
-/* clang-format on */
-
-static void
-wasm_interp_dump_op_count()
-{
-    uint32 i;
-    uint64 total_count = 0;
-    for (i = 0; i < WASM_OP_IMPDEP; i++)
-        total_count += opcode_table[i].count;
-
-    os_printf("total opcode count: %ld\n", total_count);
-    for (i = 0; i < WASM_OP_IMPDEP; i++)
-        if (opcode_table[i].count > 0)
-            os_printf("\t\t%s count:\t\t%ld,\t\t%.2f%%\n", opcode_table[i].name,
-                      opcode_table[i].count,
-                      opcode_table[i].count * 100.0f / total_count);
-}
-#endif
-
 #if WASM_ENABLE_LABELS_AS_VALUES != 0
 
 /* #define HANDLE_OP(opcode) HANDLE_##opcode:printf(#opcode"\n"); */
 #if WASM_ENABLE_OPCODE_COUNTER != 0
-#define HANDLE_OP(opcode) HANDLE_##opcode : opcode_table[opcode].count++;
+/* A handler shared by several opcodes has one HANDLE_OP label per opcode
+   in a row: only the first label reached after a dispatch counts */
+#define HANDLE_OP(opcode)                  \
+    HANDLE_##opcode : if (!opcode_counted) \
+    {                                      \
+        wasm_interp_count_opcode(opcode);  \
+        opcode_counted = true;             \
+    }
+#define OPCODE_COUNTER_NEXT() opcode_counted = false
 #else
 #define HANDLE_OP(opcode) HANDLE_##opcode:
+#define OPCODE_COUNTER_NEXT() (void)0
 #endif
 #if WASM_CPU_SUPPORTS_UNALIGNED_ADDR_ACCESS != 0
 #define FETCH_OPCODE_AND_DISPATCH()                    \
@@ -1439,6 +1416,7 @@ wasm_interp_dump_op_count()
         const void *p_label_addr = *(void **)frame_ip; \
         frame_ip += sizeof(void *);                    \
         CHECK_INSTRUCTION_LIMIT();                     \
+        OPCODE_COUNTER_NEXT();                         \
         goto *p_label_addr;                            \
     } while (0)
 #else
@@ -1451,6 +1429,7 @@ wasm_interp_dump_op_count()
         p_label_addr = label_base + (int32)LOAD_U32_WITH_2U16S(frame_ip); \
         frame_ip += sizeof(int32);                                        \
         CHECK_INSTRUCTION_LIMIT();                                        \
+        OPCODE_COUNTER_NEXT();                                            \
         goto *p_label_addr;                                               \
     } while (0)
 #else
@@ -1462,6 +1441,7 @@ wasm_interp_dump_op_count()
         p_label_addr = (void *)(uintptr_t)LOAD_U32_WITH_2U16S(frame_ip); \
         frame_ip += sizeof(int32);                                       \
         CHECK_INSTRUCTION_LIMIT();                                       \
+        OPCODE_COUNTER_NEXT();                                           \
         goto *p_label_addr;                                              \
     } while (0)
 #endif
@@ -1538,6 +1518,9 @@ wasm_interp_call_func_bytecode(WASMModuleInstance *module,
     uint8 *maddr = NULL;
     uint32 local_idx, local_offset, global_idx;
     uint8 opcode = 0, local_type, *global_addr;
+#if WASM_ENABLE_OPCODE_COUNTER != 0 && WASM_ENABLE_LABELS_AS_VALUES != 0
+    bool opcode_counted = false;
+#endif
 
 #if WASM_ENABLE_INSTRUCTION_METERING != 0
     int instructions_left = -1;
@@ -1599,6 +1582,9 @@ wasm_interp_call_func_bytecode(WASMModuleInstance *module,
         opcode = *frame_ip++;
 #if WASM_CPU_SUPPORTS_UNALIGNED_ADDR_ACCESS == 0
         frame_ip++;
+#endif
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+        wasm_interp_count_opcode(opcode);
 #endif
         switch (opcode) {
 #else
@@ -7995,7 +7981,4 @@ wasm_interp_call_wasm(WASMModuleInstance *module_inst, WASMExecEnv *exec_env,
 
     wasm_exec_env_set_cur_frame(exec_env, prev_frame);
     FREE_FRAME(exec_env, frame);
-#if WASM_ENABLE_OPCODE_COUNTER != 0
-    wasm_interp_dump_op_count();
-#endif
 }
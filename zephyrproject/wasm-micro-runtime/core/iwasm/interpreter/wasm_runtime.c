@@ -7,6 +7,7 @@
 #include "wasm.h"
 #include "wasm_loader.h"
 #include "wasm_interp.h"
+#include "wasm_opcode.h"
 #include "bh_common.h"
 #include "bh_log.h"
 #include "mem_alloc.h"
@@ -3791,6 +3792,98 @@ wasm_get_wasm_func_exec_time(const WASMModuleInstance *inst,
 }
 #endif /*WASM_ENABLE_PERF_PROFILING != 0*/
 
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+/* clang-format off */
+#define HANDLE_OPCODE(op) #op
+DEFINE_GOTO_TABLE(const char *, opcode_names);
+#undef HANDLE_OPCODE
+/* clang-format on */
+
+#if (WASM_OPCODE_PAIR_SLOTS & (WASM_OPCODE_PAIR_SLOTS - 1)) != 0
+#error "WASM_OPCODE_PAIR_SLOTS must be a power of 2"
+#endif
+
+typedef struct OpcodePairSlot {
+    uint64 count;
+    /* previous opcode << 8 | opcode */
+    uint16 key;
+    bool used;
+} OpcodePairSlot;
+
+static uint64 opcode_counts[WASM_INSTRUCTION_NUM];
+static OpcodePairSlot opcode_pairs[WASM_OPCODE_PAIR_SLOTS];
+static uint64 opcode_pairs_dropped;
+static int32 opcode_prev = -1;
+
+void
+wasm_interp_count_opcode(uint8 opcode)
+{
+    uint32 key, hash, n;
+
+    /* the interpreter enters a call through WASM_OP_IMPDEP, which is not
+       an opcode of the module */
+    if (opcode == WASM_OP_IMPDEP)
+        return;
+
+    opcode_counts[opcode]++;
+    if (opcode_prev >= 0) {
+        key = ((uint32)opcode_prev << 8) | opcode;
+        hash = key * 0x9E3779B1u;
+        hash ^= hash >> 16;
+        /* open addressing with linear probing */
+        for (n = 0; n < WASM_OPCODE_PAIR_SLOTS; n++, hash++) {
+            OpcodePairSlot *slot =
+                &opcode_pairs[hash & (WASM_OPCODE_PAIR_SLOTS - 1)];
+            if (!slot->used) {
+                slot->used = true;
+                slot->key = (uint16)key;
+            }
+            if (slot->key == key) {
+                slot->count++;
+                break;
+            }
+        }
+        if (n == WASM_OPCODE_PAIR_SLOTS)
+            opcode_pairs_dropped++;
+    }
+    opcode_prev = opcode;
+}
+
+static const char *
+opcode_name(uint32 opcode)
+{
+    return opcode_names[opcode] ? opcode_names[opcode] : "UNKNOWN";
+}
+
+uint64
+wasm_get_opcode_counters(wasm_opcode_counter_callback_t callback,
+                         void *user_data)
+{
+    uint32 i;
+
+    for (i = 0; i < WASM_INSTRUCTION_NUM; i++) {
+        if (opcode_counts[i] > 0)
+            callback(user_data, opcode_name(i), NULL, opcode_counts[i]);
+    }
+    for (i = 0; i < WASM_OPCODE_PAIR_SLOTS; i++) {
+        if (opcode_pairs[i].used)
+            callback(user_data, opcode_name(opcode_pairs[i].key >> 8),
+                     opcode_name(opcode_pairs[i].key & 0xFF),
+                     opcode_pairs[i].count);
+    }
+    return opcode_pairs_dropped;
+}
+
+void
+wasm_reset_opcode_counters(void)
+{
+    memset(opcode_counts, 0, sizeof(opcode_counts));
+    memset(opcode_pairs, 0, sizeof(opcode_pairs));
+    opcode_pairs_dropped = 0;
+    opcode_prev = -1;
+}
+#endif /* end of WASM_ENABLE_OPCODE_COUNTER != 0 */
+
 uint64
 wasm_module_malloc_internal(WASMModuleInstance *module_inst,
                             WASMExecEnv *exec_env, uint64 size,
@@ -560,6 +560,18 @@ wasm_instantiate(WASMModule *module, WASMModuleInstance *parent,
 void
 wasm_dump_perf_profiling(const WASMModuleInstance *module_inst);
 
+#if WASM_ENABLE_OPCODE_COUNTER != 0
+void
+wasm_interp_count_opcode(uint8 opcode);
+
+uint64
+wasm_get_opcode_counters(wasm_opcode_counter_callback_t callback,
+                         void *user_data);
+
+void
+wasm_reset_opcode_counters(void);
+#endif
+
 double
 wasm_summarize_wasm_execute_time(const WASMModuleInstance *inst);
 
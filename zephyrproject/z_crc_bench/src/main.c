@@ -0,0 +1,106 @@
+/*
+ * Microbenchmark CRC32 del path di LOAD (stesse varianti di
+ * linux/linux_crc_bench, più l'unità CRC sulle F7). Gira su native_sim e
+ * sulle nucleo:
+ *   west build -b native_sim zephyrproject/z_crc_bench && west build -t run
+ *   west build -b nucleo_f446re zephyrproject/z_crc_bench
+ *   west build -b nucleo_f746zg zephyrproject/z_crc_bench   (variante hw)
+ * I tempi usano k_cycle_get_32(): sulle STM32 sono cicli di core (SysTick),
+ * su native_sim sono convertiti in ns del processo host.
+ */
+#include <zephyr/kernel.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "crc32.h"
+
+#define BUF_SIZE  (16 * 1024)
+#define NUM_ITER  10
+
+static uint8_t buf[BUF_SIZE];
+
+static uint32_t crc_bitwise(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            uint32_t lsb  = crc & 1u;
+            uint32_t mask = -(int32_t)lsb;
+            crc = (crc >> 1) ^ (0xEDB88320u & mask);
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t crc_table(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc32_table[0][(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static uint32_t crc_slice4(const uint8_t *data, size_t len)
+{
+    return crc32_update_sw(0, data, len);
+}
+
+static uint32_t crc_chunk512(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < len; i += 512) {
+        crc = crc32_update(crc, &data[i], len - i < 512 ? len - i : 512);
+    }
+    return crc;
+}
+
+typedef struct {
+    const char *name;
+    uint32_t (*fn)(const uint8_t *, size_t);
+} variant_t;
+
+static const variant_t variants[] = {
+    { "bitwise", crc_bitwise },
+    { "table",   crc_table },
+    { "slice4",  crc_slice4 },
+#if CRC32_HW
+    { "hw",      crc32_calc },   /* unità CRC delle F7 */
+#endif
+    { "chunk512", crc_chunk512 },
+};
+
+int main(void)
+{
+    srand(1);
+    for (size_t i = 0; i < BUF_SIZE; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+
+    uint32_t ref = crc_bitwise(buf, BUF_SIZE);
+
+    printk("CRC32 bench on %s, buffer %d bytes, %d iterazioni\n",
+           CONFIG_BOARD, BUF_SIZE, NUM_ITER);
+    for (size_t v = 0; v < ARRAY_SIZE(variants); v++) {
+        volatile uint32_t sink = variants[v].fn(buf, BUF_SIZE);
+        if (sink != ref) {
+            printk("%s: CRC errato %08x != %08x\n", variants[v].name, sink, ref);
+            continue;
+        }
+
+        uint32_t start = k_cycle_get_32();
+        for (int k = 0; k < NUM_ITER; k++) {
+            sink = variants[v].fn(buf, BUF_SIZE);
+        }
+        uint32_t cycles = k_cycle_get_32() - start;
+
+        uint64_t bytes = (uint64_t)NUM_ITER * BUF_SIZE;
+        uint64_t ns = k_cyc_to_ns_floor64(cycles);
+        /* centesimi di ciclo/ns per byte, printk non ha %f */
+        printk("%-8s cycles/byte=%u.%02u ns/byte=%u.%02u\n", variants[v].name,
+               (unsigned)(cycles / bytes), (unsigned)((cycles * 100ULL / bytes) % 100),
+               (unsigned)(ns / bytes), (unsigned)((ns * 100ULL / bytes) % 100));
+    }
+    return 0;
+}
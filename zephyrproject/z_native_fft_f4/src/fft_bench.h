@@ -0,0 +1,105 @@
+#ifndef FFT_BENCH_H
+#define FFT_BENCH_H
+
+#include <stdint.h>
+
+/*
+ * Modulo FFT del benchmark. Stesso sorgente per la build nativa (Linux .so)
+ * e per il modulo wasm (wasm/fft/build.sh).
+ *
+ *   fft_init() / fft_bench(iterations)
+ *       punto storico: radix-2 complessa, N = 1024, twiddle1024.h, in place.
+ *       Confrontabile con i programmi MCU nativi e con i risultati passati.
+ *
+ *   V_init(n) / V_bench(iterations) / V_checksum()
+ *       varianti con N scelto a runtime (potenza di 2 in FFT_MIN_N..FFT_MAX_N,
+ *       twiddle generati in V_init). Ogni iterazione trasforma un frame nuovo
+ *       (copia in ordine bit-reversed dall'input); il termine DC rientra
+ *       nell'input, così i giri ripetuti non sono eliminabili. Una N non
+ *       valida rende bench un no-op e checksum 0.
+ */
+
+#ifndef WASM_EXPORT
+#  if defined(__wasm__) || defined(__wasm)
+#    define WASM_EXPORT(name) __attribute__((export_name(name)))
+#  else
+#    define WASM_EXPORT(name)
+#  endif
+#endif
+
+#define FFT_MIN_N 64
+#ifndef FFT_MAX_N
+#if defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M'
+#define FFT_MAX_N 1024     /* Cortex-M nativo: come il modulo wasm MCU */
+#else
+#define FFT_MAX_N 4096     /* host; il modulo wasm MCU ha -DFFT_MAX_N=1024 */
+#endif
+#endif
+
+/* varianti, nell'ordine della suite, e taglie di default */
+#define FFT_VARIANT_NAMES "fft_r2", "fft_r4", "fft_sr", "rfft", "fft_q15", "rfft_q15"
+#define FFT_VARIANT_LEN   6
+#define FFT_SUITE_SIZES   "64,128,256,512,1024,2048,4096"
+
+/* taglie dei programmi MCU: 256 punti reali come le pipeline di sensori
+ * sugli F4, 1024 come il punto storico */
+#define FFT_MCU_SIZES     256, 1024
+#define FFT_MCU_SIZES_LEN 2
+
+/* varianti SIMD128 (build con -DBENCH_SIMD, modulo fft_bench_simd) */
+#define FFT_SIMD_VARIANT_NAMES "fft_r2_simd"
+#define FFT_SIMD_VARIANT_LEN   1
+
+void     fft_init(void);
+void     fft_bench(int iterations);
+
+/* complessa radix-2 DIT */
+void     fft_r2_init(int32_t n);
+void     fft_r2_bench(int32_t iterations);
+uint32_t fft_r2_checksum(void);
+
+/* complessa radix-4 DIT (un passo radix-2 iniziale se log2 n è dispari) */
+void     fft_r4_init(int32_t n);
+void     fft_r4_bench(int32_t iterations);
+uint32_t fft_r4_checksum(void);
+
+/* complessa split-radix (ricorsiva, DIT) */
+void     fft_sr_init(int32_t n);
+void     fft_sr_bench(int32_t iterations);
+uint32_t fft_sr_checksum(void);
+
+/* n campioni reali: FFT complessa di n/2 punti + passo di separazione */
+void     rfft_init(int32_t n);
+void     rfft_bench(int32_t iterations);
+uint32_t rfft_checksum(void);
+
+/* complessa radix-2 in Q15, scala 1/2 per stadio (come arm_cfft_radix2_q15) */
+void     fft_q15_init(int32_t n);
+void     fft_q15_bench(int32_t iterations);
+uint32_t fft_q15_checksum(void);
+
+/* reale in Q15 (come arm_rfft_q15) */
+void     rfft_q15_init(int32_t n);
+void     rfft_q15_bench(int32_t iterations);
+uint32_t rfft_q15_checksum(void);
+
+#ifdef BENCH_SIMD
+/* fft_r2 con due farfalle per vettore: stesso checksum di fft_r2 */
+void     fft_r2_simd_init(int32_t n);
+void     fft_r2_simd_bench(int32_t iterations);
+uint32_t fft_r2_simd_checksum(void);
+#endif
+
+#if !(defined(__wasm__) || defined(__wasm))
+/* tabella per i runner nativi (MCU): stesso ordine di FFT_VARIANT_NAMES */
+typedef struct {
+    const char *name;
+    void     (*init)(int32_t n);
+    void     (*bench)(int32_t iterations);
+    uint32_t (*checksum)(void);
+} fft_variant_desc_t;
+
+extern const fft_variant_desc_t fft_variants[FFT_VARIANT_LEN];
+#endif
+
+#endif /* FFT_BENCH_H */
@@ -0,0 +1,94 @@
+/*
+ * Baseline nativa di hostcall_bench.wasm (vedi hostcall_bench.h): stessi
+ * kernel e stesso checksum, con le funzioni "host" chiamate tramite
+ * puntatori volatile, così il compilatore non può inlinarle né eliminarle.
+ * Build: shared object per linux_bench, sorgente diretto nelle app native MCU.
+ * Non esiste una versione raw: hc_raw_* chiamano le stesse funzioni.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hostcall_bench.h"
+
+#if defined(__GNUC__)
+#  define HC_NOINLINE __attribute__((noinline))
+#else
+#  define HC_NOINLINE
+#endif
+
+static const char hc_data_str[] = HOSTCALL_STR;
+static uint8_t hc_data_buf[HOSTCALL_BUF_LEN];
+static uint32_t acc;
+
+/* ----------------- funzioni host ----------------- */
+
+static HC_NOINLINE void host_void(void) {}
+static HC_NOINLINE void host_i32_1(int32_t a) { (void)a; }
+static HC_NOINLINE void host_i32_4(int32_t a, int32_t b, int32_t c, int32_t d)
+{ (void)a; (void)b; (void)c; (void)d; }
+static HC_NOINLINE void host_i32_8(int32_t a, int32_t b, int32_t c, int32_t d,
+                                   int32_t e, int32_t f, int32_t g, int32_t h)
+{ (void)a; (void)b; (void)c; (void)d; (void)e; (void)f; (void)g; (void)h; }
+static HC_NOINLINE void host_i64_4(int64_t a, int64_t b, int64_t c, int64_t d)
+{ (void)a; (void)b; (void)c; (void)d; }
+static HC_NOINLINE void host_f64_4(double a, double b, double c, double d)
+{ (void)a; (void)b; (void)c; (void)d; }
+static HC_NOINLINE void host_mixed(int32_t a, int64_t b, float c, double d)
+{ (void)a; (void)b; (void)c; (void)d; }
+static HC_NOINLINE int32_t host_ret(int32_t x) { return x + 1; }
+static HC_NOINLINE int32_t host_str(const char *s)
+{
+    int32_t n = 0;
+    while (s[n]) n++;
+    return n;
+}
+static HC_NOINLINE int32_t host_buf(const uint8_t *p, int32_t len) { (void)p; return len; }
+
+static void (*volatile p_void)(void) = host_void;
+static void (*volatile p_i32_1)(int32_t) = host_i32_1;
+static void (*volatile p_i32_4)(int32_t, int32_t, int32_t, int32_t) = host_i32_4;
+static void (*volatile p_i32_8)(int32_t, int32_t, int32_t, int32_t,
+                                int32_t, int32_t, int32_t, int32_t) = host_i32_8;
+static void (*volatile p_i64_4)(int64_t, int64_t, int64_t, int64_t) = host_i64_4;
+static void (*volatile p_f64_4)(double, double, double, double) = host_f64_4;
+static void (*volatile p_mixed)(int32_t, int64_t, float, double) = host_mixed;
+static int32_t (*volatile p_ret)(int32_t) = host_ret;
+static int32_t (*volatile p_str)(const char *) = host_str;
+static int32_t (*volatile p_buf)(const uint8_t *, int32_t) = host_buf;
+
+/* hc_local: chiamata a una funzione "del modulo", non inline */
+static HC_NOINLINE int32_t local_fn(int32_t x) { return x + 1; }
+static int32_t (*volatile p_local)(int32_t) = local_fn;
+
+/* ----------------- kernel ----------------- */
+
+/* stessi argomenti del modulo wasm: primo i32 = i, poi le costanti k + 1 */
+#define HC_KERNEL(K, ITERATION)                              \
+    void K##_init(void) { acc = 0; }                         \
+    uint32_t K##_checksum(void) { return acc; }              \
+    void K##_bench(int32_t iterations)                       \
+    {                                                        \
+        for (int32_t i = 0; i < iterations; i++) {           \
+            ITERATION;                                       \
+        }                                                    \
+    }
+
+HC_KERNEL(hc_loop,      { volatile uint32_t one = 1; acc += one; })
+HC_KERNEL(hc_local,     acc += (uint32_t)p_local(i))
+HC_KERNEL(hc_void,      { p_void(); acc += 1; })
+HC_KERNEL(hc_i32_1,     { p_i32_1(i); acc += 1; })
+HC_KERNEL(hc_i32_4,     { p_i32_4(i, 2, 3, 4); acc += 1; })
+HC_KERNEL(hc_i32_8,     { p_i32_8(i, 2, 3, 4, 5, 6, 7, 8); acc += 1; })
+HC_KERNEL(hc_i64_4,     { p_i64_4(1, 2, 3, 4); acc += 1; })
+HC_KERNEL(hc_f64_4,     { p_f64_4(1.5, 2.5, 3.5, 4.5); acc += 1; })
+HC_KERNEL(hc_mixed,     { p_mixed(i, 2, 3.5f, 4.5); acc += 1; })
+HC_KERNEL(hc_ret,       acc += (uint32_t)p_ret(i))
+HC_KERNEL(hc_str,       acc += (uint32_t)p_str(hc_data_str))
+HC_KERNEL(hc_buf,       acc += (uint32_t)p_buf(hc_data_buf, HOSTCALL_BUF_LEN))
+HC_KERNEL(hc_raw_void,  { p_void(); acc += 1; })
+HC_KERNEL(hc_raw_i32_4, { p_i32_4(i, 2, 3, 4); acc += 1; })
+HC_KERNEL(hc_raw_i32_8, { p_i32_8(i, 2, 3, 4, 5, 6, 7, 8); acc += 1; })
+HC_KERNEL(hc_raw_str,   acc += (uint32_t)p_str(hc_data_str))
+
+#define HC_DESC(K) { #K, K##_init, K##_bench, K##_checksum },
+const hostcall_desc_t hostcall_suite[HOSTCALL_SUITE_LEN] = { HOSTCALL_FOREACH(HC_DESC) };
@@ -1,17 +1,51 @@
 #include <zephyr/kernel.h>
+#include <stdio.h>
+#ifdef CONFIG_SOC_FAMILY_STM32
 #include <stm32f4xx.h>
+#else
+#include <cmsis_core.h>   /* board emulate: mps2/an385, qemu_cortex_m3 */
+#endif
+
+/*
+ * BENCH_EMU (target emulati, vedi zephyrproject/bench_emu): il DWT manca
+ * (QEMU) o non conta i cicli (Renode), quindi si misura con k_cycle_get_32,
+ * che con QEMU -icount e con Renode avanza con le istruzioni eseguite.
+ * SysTick e IRQ restano attivi: k_cycle_get_32 ne ha bisogno.
+ */
+#ifdef BENCH_EMU
+#define BENCH_CYCLES()      k_cycle_get_32()
+#define BENCH_SYSTICK_OFF() ((void)0)
+#define BENCH_IRQ_OFF()     ((void)0)
+#define BENCH_IRQ_ON()      ((void)0)
+#else
+#define BENCH_CYCLES()      DWT->CYCCNT
+#define BENCH_SYSTICK_OFF() (SysTick->CTRL = 0)
+#define BENCH_IRQ_OFF()     __disable_irq()
+#define BENCH_IRQ_ON()      __enable_irq()
+#endif
 
 #define N_FFT     1024
-#define NUM_ITER  100
+#define NUM_ITER  10       // FFT per round
+#define WARMUP_ROUNDS   2   // round scartati
+#define NUM_ROUNDS      20  // round misurati
+#define MAX_CV_PERMILLE 20  // oltre il 2% di CV la misura non vale
 
 static float buf[2 * N_FFT];
 
 #include "twiddle1024.h"
+#define BENCH_STATS_PRINTF printk   // report su UART (console Zephyr)
+#include "bench_stats.h"
+#include "kernels_bench.h"
+#include "fft_bench.h"   // varianti del modulo FFT (fft_bench_wasm.c)
+#include "hostcall_bench.h"
 
 volatile uint32_t total_cycles = 0;
 volatile uint32_t avg_cycles   = 0;
+// Cicli di ogni round misurato e statistiche
+static uint64_t round_cycles[NUM_ROUNDS];
+static bench_stats_t stats;
 
-static void fft_init(void)
+static void fft_native_init(void)
 {
     for (int i = 0; i < N_FFT; ++i) {
         float x = (float)i;
@@ -74,7 +108,7 @@ static void fft_radix2(float *b)
 }
 
 
-void fft_bench(int iterations)
+static void fft_native_bench(int iterations)
 {
     for (int k = 0; k < iterations; ++k) {
         fft_radix2(buf);
@@ -88,30 +122,129 @@ void fft_bench(int iterations)
 // DWT cycle counter
 //------------------------------
 static void DWT_Init(void) {
+#ifndef BENCH_EMU
 	// abilita il blocco di trace
 	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
 	// azzera il contatore
 	DWT->CYCCNT = 0;
 	// abilita il contatore di cicli
 	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 }
 
 void run_benchmark(void) {
     DWT_Init();
-    fft_init();
 
-    uint32_t start = DWT->CYCCNT;
-    fft_bench(NUM_ITER);
-    uint32_t end   = DWT->CYCCNT;
+    for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+        fft_native_init();   // stesso input a ogni round
+
+        uint32_t start = BENCH_CYCLES();
+        fft_native_bench(NUM_ITER);
+        uint32_t end   = BENCH_CYCLES();
+
+        if (r >= WARMUP_ROUNDS) {
+            round_cycles[r - WARMUP_ROUNDS] = end - start;
+        }
+    }
+
+    bench_stats_compute(round_cycles, NUM_ROUNDS, &stats);
+    total_cycles = (uint32_t)stats.median;
+    avg_cycles   = (uint32_t)(stats.median / NUM_ITER);
+}
+
+//------------------------------
+// Suite di kernel (wasm/kernels)
+//------------------------------
+// Stessi round della FFT; init una sola volta, così il checksum finale
+// coincide con quello dei runtime wasm e di linux_bench a parità di round.
+static uint64_t suite_cycles[NUM_ROUNDS];
+
+void run_suite(void)
+{
+    bench_stats_t st;
+
+    for (int k = 0; k < KERNELS_SUITE_LEN; k++) {
+        const kernel_desc_t *kd = &kernels_suite[k];
+
+        kd->init();
+        for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+            uint32_t start = BENCH_CYCLES();
+            kd->bench(NUM_ITER);
+            uint32_t end   = BENCH_CYCLES();
+
+            if (r >= WARMUP_ROUNDS) {
+                suite_cycles[r - WARMUP_ROUNDS] = end - start;
+            }
+        }
+        bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+        bench_stats_print_row(kd->name, &st, NUM_ITER, kd->checksum());
+    }
+}
 
-    total_cycles = end - start;
-    avg_cycles   = total_cycles / NUM_ITER;
+// Varianti del modulo FFT alle taglie MCU (fft_bench.h), come nei runtime
+// wasm: una riga "fft_r2@256" ecc., init(n) una volta per taglia.
+void run_fft_variants(void)
+{
+    static const int32_t sizes[FFT_MCU_SIZES_LEN] = { FFT_MCU_SIZES };
+    bench_stats_t st;
+    char row[32];
+
+    for (int k = 0; k < FFT_VARIANT_LEN; k++) {
+        const fft_variant_desc_t *vd = &fft_variants[k];
+
+        for (int s = 0; s < FFT_MCU_SIZES_LEN; s++) {
+            snprintf(row, sizeof(row), "%s@%ld", vd->name, (long)sizes[s]);
+            vd->init(sizes[s]);
+            for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+                uint32_t start = BENCH_CYCLES();
+                vd->bench(NUM_ITER);
+                uint32_t end   = BENCH_CYCLES();
+
+                if (r >= WARMUP_ROUNDS) {
+                    suite_cycles[r - WARMUP_ROUNDS] = end - start;
+                }
+            }
+            bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+            bench_stats_print_row(row, &st, NUM_ITER, vd->checksum());
+        }
+    }
+}
+
+//------------------------------
+// Chiamate "host" (wasm/hostcall)
+//------------------------------
+// Baseline delle app wasm: funzioni C no-op chiamate via puntatore,
+// HOSTCALL_MCU_ITERS chiamate per round, cicli per chiamata.
+void run_hostcall_suite(void)
+{
+    bench_stats_t st;
+
+    printk("host call: cicli per chiamata\r\n");
+    for (int k = 0; k < HOSTCALL_SUITE_LEN; k++) {
+        const hostcall_desc_t *hd = &hostcall_suite[k];
+
+        hd->init();
+        for (int r = 0; r < WARMUP_ROUNDS + NUM_ROUNDS; r++) {
+            uint32_t start = BENCH_CYCLES();
+            hd->bench(HOSTCALL_MCU_ITERS);
+            uint32_t end   = BENCH_CYCLES();
+
+            if (r >= WARMUP_ROUNDS) {
+                suite_cycles[r - WARMUP_ROUNDS] = end - start;
+            }
+        }
+        bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+        bench_stats_print_row(hd->name, &st, HOSTCALL_MCU_ITERS, hd->checksum());
+    }
 }
 
 void main(void)
 {
-   SysTick->CTRL = 0;   // disabilita SysTick
-	__disable_irq();     // opzionale se vuoi togliere tutte le IRQ
+#ifdef BENCH_EMU
+    printk("Clock: %u Hz\r\n", sys_clock_hw_cycles_per_sec());   /* per bench_emu.py */
+#endif
+   BENCH_SYSTICK_OFF();   // disabilita SysTick
+	BENCH_IRQ_OFF();     // opzionale se vuoi togliere tutte le IRQ
 
 	/* USER CODE END 2 */
 
@@ -121,8 +254,12 @@ void main(void)
 	run_benchmark();
 
 	printk("Zephyr\r\n");
-	printk("Total cycles: %lu\r\n", (unsigned long)total_cycles);
-	printk("Avg cycles per FFT: %lu\r\n", (unsigned long)avg_cycles);
+	bench_stats_print("cycles per FFT", &stats, NUM_ITER);
+	bench_stats_check(&stats, MAX_CV_PERMILLE);
+	run_fft_variants();
+	run_suite();
+	run_hostcall_suite();
+	printk("BENCH DONE\r\n");
 //printk("SystemCoreClock = %u Hz\n", SystemCoreClock);
 
 	while (1)
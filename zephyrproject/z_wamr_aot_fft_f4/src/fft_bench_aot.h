@@ -4,7 +4,7 @@ unsigned char fft_bench_aot[] = {
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x74, 0x68, 0x75, 0x6d, 0x62, 0x76, 0x37, 0x65, 0x6d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x11, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -352,133 +352,1439 @@ unsigned char fft_bench_aot[] = {
   0xb0, 0x0a, 0xc9, 0xbc, 0xb6, 0xc9, 0x96, 0xbc, 0x90, 0x0e, 0x49, 0xbc,
   0x89, 0x0f, 0xc9, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x70, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0xb5, 0x82, 0xb0, 0x01, 0x46, 0x40, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
-  0x00, 0x00, 0x01, 0xab, 0x02, 0x68, 0x88, 0x68, 0x93, 0x42, 0x22, 0xbf,
-  0x9a, 0x1a, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd2, 0x0b, 0x21, 0xff, 0xf7,
-  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
-  0xff, 0xe7, 0x2d, 0xe9, 0xf0, 0x47, 0x80, 0x46, 0xd0, 0xf8, 0x78, 0x01,
-  0xd8, 0xf8, 0xb8, 0x91, 0x00, 0x25, 0x00, 0xf5, 0xa0, 0x54, 0x4f, 0xf4,
-  0xa0, 0x57, 0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x4f, 0x45, 0x9f, 0xbf,
-  0x06, 0x46, 0x20, 0x60, 0x08, 0x37, 0x4f, 0x45, 0x1c, 0xd8, 0x01, 0x35,
-  0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x82, 0x46, 0xa0, 0x60, 0x30, 0x46,
-  0x4f, 0xf0, 0x7c, 0x51, 0xff, 0xf7, 0xfe, 0xff, 0x60, 0x60, 0x50, 0x46,
-  0x4f, 0xf0, 0x7c, 0x51, 0xff, 0xf7, 0xfe, 0xff, 0x39, 0x1d, 0x49, 0x45,
-  0x08, 0xd8, 0xe0, 0x60, 0x01, 0x35, 0x0f, 0x1d, 0x10, 0x34, 0xb5, 0xf5,
-  0x80, 0x6f, 0xda, 0xd1, 0xbd, 0xe8, 0xf0, 0x87, 0x40, 0x46, 0x02, 0x21,
-  0xbd, 0xe8, 0xf0, 0x47, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
-  0x02, 0x46, 0x40, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x00, 0x0d, 0xf1,
-  0x04, 0x0c, 0x43, 0x68, 0x90, 0x68, 0x9c, 0x45, 0x22, 0xbf, 0xac, 0xeb,
-  0x03, 0x03, 0x12, 0x69, 0x93, 0x42, 0x04, 0xd2, 0x0b, 0x21, 0xff, 0xf7,
-  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
-  0xff, 0xe7, 0x2d, 0xe9, 0xf0, 0x4f, 0x91, 0xb0, 0x01, 0x29, 0x0a, 0x46,
-  0x06, 0x91, 0xc0, 0xf2, 0xf8, 0x80, 0xd0, 0xf8, 0x78, 0x81, 0x41, 0xf2,
-  0x04, 0x41, 0xd0, 0xf8, 0xb8, 0xc1, 0x41, 0x44, 0x0e, 0x91, 0x00, 0x21,
-  0x05, 0x91, 0x07, 0x90, 0x00, 0x20, 0x00, 0x21, 0x88, 0x42, 0x29, 0xda,
-  0x4f, 0xf4, 0xa0, 0x52, 0x02, 0xeb, 0xc0, 0x06, 0x66, 0x45, 0x9c, 0xbf,
-  0x02, 0xeb, 0xc1, 0x07, 0x67, 0x45, 0x00, 0xf2, 0xe1, 0x80, 0x58, 0xf8,
-  0x06, 0x30, 0x46, 0x44, 0x58, 0xf8, 0x07, 0x50, 0xc2, 0x00, 0x35, 0x60,
-  0x41, 0xf2, 0x04, 0x46, 0x16, 0x44, 0x66, 0x45, 0x9f, 0xbf, 0xcd, 0x00,
-  0x41, 0xf2, 0x04, 0x44, 0x25, 0x44, 0x65, 0x45, 0x00, 0xf2, 0xce, 0x80,
-  0x08, 0xeb, 0x07, 0x0e, 0x0e, 0x9f, 0x58, 0xf8, 0x06, 0x60, 0x58, 0xf8,
-  0x05, 0x40, 0xce, 0xf8, 0x00, 0x30, 0xbc, 0x50, 0x48, 0xf8, 0x05, 0x60,
-  0x8a, 0x05, 0x07, 0xd4, 0x4f, 0xf4, 0x00, 0x72, 0x01, 0x30, 0x11, 0x43,
-  0xb0, 0xf5, 0x80, 0x6f, 0xca, 0xd1, 0x17, 0xe0, 0x4f, 0xf4, 0x00, 0x73,
-  0x59, 0x40, 0x5a, 0x08, 0x11, 0xea, 0x53, 0x0f, 0xf2, 0xd0, 0x51, 0x40,
-  0x9a, 0x08, 0x11, 0xea, 0x93, 0x0f, 0x1e, 0xbf, 0x51, 0x40, 0xda, 0x08,
-  0x11, 0xea, 0xd3, 0x0f, 0xe8, 0xd0, 0x51, 0x40, 0x1a, 0x09, 0x11, 0xea,
-  0x13, 0x1f, 0x13, 0x46, 0xea, 0xd1, 0xe1, 0xe7, 0x02, 0x22, 0x53, 0x10,
-  0x01, 0x2b, 0xc0, 0xf2, 0x8c, 0x80, 0x92, 0xfa, 0xa2, 0xf0, 0x4f, 0xf4,
-  0x80, 0x61, 0xb0, 0xfa, 0x80, 0xf0, 0x4f, 0xf4, 0xa0, 0x5a, 0x00, 0xf0,
-  0x1f, 0x00, 0x21, 0xfa, 0x00, 0xf0, 0x00, 0x21, 0x80, 0x00, 0x08, 0x90,
-  0x90, 0x00, 0x09, 0x90, 0xd0, 0x00, 0x00, 0x90, 0xcd, 0xf8, 0x40, 0xc0,
-  0xcd, 0xe9, 0x01, 0x32, 0x00, 0x20, 0x04, 0x91, 0xcd, 0xf8, 0x0c, 0xa0,
-  0x0d, 0x93, 0x0f, 0x90, 0x00, 0xf5, 0x80, 0x60, 0x60, 0x45, 0x9f, 0xbf,
-  0x09, 0x99, 0x0a, 0xeb, 0x01, 0x09, 0x49, 0xf0, 0x04, 0x0b, 0xe3, 0x45,
-  0x72, 0xd8, 0x58, 0xf8, 0x00, 0x00, 0x58, 0xf8, 0x0b, 0x10, 0xcd, 0xe9,
-  0x0b, 0x01, 0xff, 0xf7, 0xfe, 0xff, 0x05, 0x46, 0x0f, 0x98, 0x10, 0x99,
-  0x00, 0xf5, 0x40, 0x60, 0x88, 0x42, 0x63, 0xd8, 0x58, 0xf8, 0x00, 0x40,
-  0x4a, 0xf0, 0x04, 0x07, 0x58, 0xf8, 0x09, 0x60, 0x20, 0x46, 0x31, 0x46,
-  0xff, 0xf7, 0xfe, 0xff, 0x01, 0x46, 0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x05, 0x46, 0x10, 0x98, 0x87, 0x42, 0x51, 0xd8, 0x08, 0xeb, 0x09, 0x00,
-  0x58, 0xf8, 0x07, 0x90, 0x0a, 0x90, 0x28, 0x46, 0xc3, 0x44, 0x49, 0x46,
-  0xff, 0xf7, 0xfe, 0xff, 0x48, 0xf8, 0x07, 0x00, 0x31, 0x46, 0x0b, 0x98,
-  0xff, 0xf7, 0xfe, 0xff, 0x0c, 0x99, 0x06, 0x46, 0x20, 0x46, 0xff, 0xf7,
-  0xfe, 0xff, 0x01, 0x46, 0x30, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x58, 0xf8,
-  0x0a, 0x60, 0x04, 0x46, 0x21, 0x46, 0x30, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x48, 0xf8, 0x0a, 0x00, 0x48, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0xcb, 0xf8, 0x00, 0x00, 0x30, 0x46, 0x21, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x0a, 0x99, 0x0a, 0xf1, 0x08, 0x0a, 0xdd, 0xf8, 0x40, 0xc0, 0x08, 0x60,
-  0x08, 0x98, 0x0f, 0x99, 0x08, 0x44, 0x0d, 0x99, 0x4b, 0x1e, 0x99, 0xd1,
-  0x02, 0x9a, 0x04, 0x99, 0x00, 0x98, 0xdd, 0xf8, 0x0c, 0xa0, 0x11, 0x44,
-  0x01, 0x9b, 0xb1, 0xf5, 0x80, 0x6f, 0x82, 0x44, 0x8a, 0xd3, 0x52, 0x00,
-  0xb2, 0xf5, 0x80, 0x6f, 0x7f, 0xf7, 0x6b, 0xaf, 0x05, 0x99, 0x06, 0x98,
-  0x01, 0x31, 0x05, 0x91, 0x81, 0x42, 0x7f, 0xf4, 0x13, 0xaf, 0x11, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x07, 0x98, 0x02, 0x21, 0x11, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x6d, 0x65, 0x6d, 0x6f,
-  0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-  0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x66, 0x66, 0x74, 0x5f,
-  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x7c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x74,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x10, 0xd4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61,
+  0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x12, 0x68, 0x01, 0x46,
+  0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x00, 0xbf,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x10, 0xb5,
+  0xd0, 0xf8, 0x78, 0x11, 0xd0, 0xf8, 0xb8, 0xc1, 0x01, 0xf5, 0xa0, 0x52,
+  0x4f, 0xf4, 0xa0, 0x53, 0x00, 0x21, 0xb6, 0xee, 0x00, 0x0a, 0x00, 0xbf,
+  0x63, 0x45, 0x2f, 0xd8, 0x01, 0xee, 0x10, 0x1a, 0xb8, 0xee, 0xc1, 0x1a,
+  0x08, 0x33, 0x11, 0xee, 0x10, 0xea, 0x63, 0x45, 0xc2, 0xf8, 0x00, 0xe0,
+  0x24, 0xd8, 0x4c, 0x1c, 0x02, 0xee, 0x10, 0x4a, 0xb8, 0xee, 0xc2, 0x2a,
+  0x04, 0x3b, 0x12, 0xee, 0x10, 0xea, 0x63, 0x45, 0xc2, 0xf8, 0x08, 0xe0,
+  0x18, 0xd8, 0x21, 0xee, 0x00, 0x1a, 0x08, 0x33, 0x11, 0xee, 0x10, 0xea,
+  0x63, 0x45, 0xc2, 0xf8, 0x04, 0xe0, 0x0f, 0xd8, 0x22, 0xee, 0x00, 0x1a,
+  0x11, 0xee, 0x10, 0x1a, 0xd1, 0x60, 0x61, 0x1c, 0xb1, 0xf5, 0x80, 0x6f,
+  0x02, 0xf1, 0x10, 0x02, 0x03, 0xf1, 0x04, 0x03, 0x08, 0xbf, 0x10, 0xbd,
+  0xce, 0xe7, 0x00, 0xbf, 0x02, 0x21, 0xbd, 0xe8, 0x10, 0x40, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+  0x00, 0x03, 0xd3, 0xf8, 0x04, 0xc0, 0x02, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x03, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x8b, 0xb0,
+  0x01, 0x29, 0xc0, 0xf2, 0x09, 0x81, 0xd0, 0xf8, 0x78, 0xa1, 0xd0, 0xf8,
+  0xb8, 0x81, 0x0a, 0xf5, 0xa0, 0x52, 0x0a, 0x92, 0x00, 0x22, 0x41, 0xf2,
+  0x04, 0x4e, 0x06, 0x92, 0x05, 0x91, 0x08, 0x90, 0x00, 0x27, 0x00, 0x26,
+  0x08, 0xe0, 0x00, 0xbf, 0x4f, 0xf4, 0x00, 0x74, 0x01, 0x36, 0xb6, 0xf5,
+  0x80, 0x6f, 0x47, 0xea, 0x04, 0x07, 0x49, 0xd0, 0xbe, 0x42, 0x29, 0xda,
+  0x4f, 0xf4, 0xa0, 0x50, 0x00, 0xeb, 0xc6, 0x05, 0x45, 0x45, 0x00, 0xf2,
+  0xeb, 0x80, 0x4f, 0xf4, 0xa0, 0x50, 0x00, 0xeb, 0xc7, 0x01, 0x41, 0x45,
+  0x00, 0xf2, 0xe4, 0x80, 0xf3, 0x00, 0x0a, 0xeb, 0x05, 0x04, 0x5a, 0xf8,
+  0x05, 0x50, 0x5a, 0xf8, 0x01, 0x20, 0x73, 0x44, 0x43, 0x45, 0x22, 0x60,
+  0x00, 0xf2, 0xd8, 0x80, 0xfa, 0x00, 0x02, 0xeb, 0x0e, 0x04, 0x44, 0x45,
+  0x00, 0xf2, 0xd2, 0x80, 0x0a, 0xeb, 0x03, 0x02, 0x5a, 0xf8, 0x04, 0x30,
+  0x10, 0x68, 0x51, 0x44, 0x13, 0x60, 0x0d, 0x60, 0x4a, 0xf8, 0x04, 0x00,
+  0xb8, 0x05, 0xc9, 0xd5, 0x4f, 0xf4, 0x00, 0x75, 0x6f, 0x40, 0x17, 0xea,
+  0x55, 0x0f, 0x4f, 0xea, 0x55, 0x04, 0xc3, 0xd0, 0x67, 0x40, 0x17, 0xea,
+  0x95, 0x0f, 0x4f, 0xea, 0x95, 0x04, 0xbd, 0xd0, 0x67, 0x40, 0x17, 0xea,
+  0xd5, 0x0f, 0x4f, 0xea, 0xd5, 0x04, 0xb7, 0xd0, 0x67, 0x40, 0x2c, 0x09,
+  0x17, 0xea, 0x15, 0x1f, 0x25, 0x46, 0xe7, 0xd1, 0xb0, 0xe7, 0x00, 0xbf,
+  0x02, 0x21, 0x48, 0x10, 0x01, 0x28, 0x4f, 0xf0, 0x01, 0x0c, 0x4f, 0xea,
+  0x81, 0x00, 0xc8, 0xbf, 0x4f, 0xea, 0x61, 0x0c, 0x09, 0x90, 0x4f, 0xf4,
+  0x80, 0x60, 0xb0, 0xfb, 0xf1, 0xf0, 0xca, 0x00, 0x00, 0x92, 0x83, 0x00,
+  0x0a, 0x98, 0x00, 0x22, 0x00, 0xeb, 0x81, 0x00, 0x41, 0xf2, 0x04, 0x4b,
+  0x07, 0x90, 0xcd, 0xe9, 0x01, 0xc1, 0x4f, 0xf0, 0x00, 0x09, 0x04, 0x92,
+  0xcd, 0xf8, 0x0c, 0xb0, 0xc3, 0x45, 0x00, 0xf2, 0x87, 0x80, 0x03, 0xfb,
+  0x09, 0xf1, 0x01, 0xf5, 0x40, 0x65, 0x45, 0x45, 0x00, 0xf2, 0x80, 0x80,
+  0x09, 0x98, 0x00, 0xeb, 0x0b, 0x04, 0x20, 0x1f, 0x40, 0x45, 0x79, 0xd8,
+  0x01, 0xf5, 0x80, 0x61, 0x41, 0x45, 0x98, 0xbf, 0x44, 0x45, 0x73, 0xd8,
+  0x0a, 0x9a, 0x4e, 0xf6, 0x00, 0x47, 0x02, 0xeb, 0x0b, 0x04, 0xcf, 0xf6,
+  0xff, 0x77, 0xe2, 0x59, 0x5a, 0xf8, 0x05, 0x50, 0x00, 0xee, 0x10, 0x2a,
+  0x07, 0x9a, 0x01, 0xee, 0x10, 0x5a, 0x02, 0xeb, 0x0b, 0x05, 0x4e, 0xf6,
+  0xfc, 0x32, 0xcf, 0xf6, 0xff, 0x72, 0xaa, 0x58, 0x5a, 0xf8, 0x01, 0x10,
+  0x02, 0xee, 0x10, 0x2a, 0xea, 0x59, 0x05, 0xee, 0x10, 0x1a, 0x04, 0xee,
+  0x10, 0x2a, 0x21, 0xee, 0x02, 0x3a, 0x25, 0xee, 0x04, 0x6a, 0x33, 0xee,
+  0x06, 0x3a, 0xab, 0xf1, 0x04, 0x00, 0x30, 0xee, 0x03, 0x6a, 0xa4, 0xf5,
+  0xa0, 0x56, 0x16, 0xee, 0x10, 0x1a, 0x40, 0x45, 0x31, 0x60, 0x43, 0xd8,
+  0x4e, 0xf6, 0xfc, 0x36, 0xcf, 0xf6, 0xff, 0x76, 0xa1, 0x59, 0x25, 0xee,
+  0x02, 0x2a, 0x21, 0xee, 0x04, 0x1a, 0x06, 0xee, 0x10, 0x1a, 0x32, 0xee,
+  0x41, 0x1a, 0x36, 0xee, 0x01, 0x2a, 0x12, 0xee, 0x10, 0x1a, 0x30, 0xee,
+  0x43, 0x0a, 0xa5, 0xf5, 0xa0, 0x52, 0xa1, 0x51, 0x10, 0xee, 0x10, 0x1a,
+  0x36, 0xee, 0x41, 0x0a, 0xa5, 0xeb, 0x0e, 0x00, 0x11, 0x60, 0x10, 0xee,
+  0x10, 0x1a, 0x09, 0xf1, 0x01, 0x09, 0xbc, 0xf1, 0x01, 0x0c, 0x0b, 0xf1,
+  0x08, 0x0b, 0x01, 0x60, 0x92, 0xd1, 0x02, 0x99, 0x04, 0x9a, 0x00, 0x98,
+  0xdd, 0xf8, 0x0c, 0xb0, 0x0a, 0x44, 0xdd, 0xf8, 0x04, 0xc0, 0xb2, 0xf5,
+  0x80, 0x6f, 0x83, 0x44, 0xff, 0xf4, 0x81, 0xaf, 0x49, 0x00, 0xb1, 0xf5,
+  0x80, 0x6f, 0x7f, 0xf7, 0x62, 0xaf, 0x06, 0x98, 0x05, 0x99, 0x01, 0x30,
+  0x88, 0x42, 0x06, 0x90, 0x7f, 0xf4, 0x04, 0xaf, 0x0b, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x08, 0x98, 0x02, 0x21, 0x0b, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x68, 0x01, 0xab, 0x9a, 0x1a,
+  0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x00, 0x23, 0xff, 0xf7, 0xfe, 0xbf,
+  0x10, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x0e, 0xc0, 0xf2, 0x00, 0x0e,
+  0xde, 0xf8, 0x0c, 0xe0, 0x84, 0x46, 0x80, 0x68, 0x01, 0xac, 0xb4, 0xeb,
+  0x0e, 0x0e, 0x07, 0xd3, 0xdc, 0xf8, 0x10, 0x40, 0xa6, 0x45, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x10, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x10, 0xbd, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0x2d, 0xed, 0x10, 0x8b, 0xa2, 0xb0, 0xd0, 0xf8, 0x78, 0x71,
+  0x16, 0x46, 0xa1, 0xf1, 0x40, 0x02, 0xb2, 0xf5, 0x70, 0x7f, 0x11, 0x97,
+  0x07, 0xf5, 0x50, 0x57, 0x00, 0xf2, 0xba, 0x85, 0x4f, 0xf0, 0x55, 0x32,
+  0x02, 0xea, 0x51, 0x02, 0x8a, 0x1a, 0x4f, 0xf0, 0x33, 0x35, 0x05, 0xea,
+  0x92, 0x05, 0x22, 0xf0, 0xcc, 0x32, 0x2a, 0x44, 0x02, 0xeb, 0x12, 0x12,
+  0x22, 0xf0, 0xf0, 0x32, 0x4f, 0xf0, 0x01, 0x35, 0x6a, 0x43, 0x12, 0x0e,
+  0x02, 0x2a, 0x80, 0xf0, 0xa3, 0x85, 0x00, 0xee, 0x10, 0x1a, 0xb8, 0xee,
+  0xc0, 0x0a, 0xb7, 0xee, 0x00, 0x1a, 0x81, 0xee, 0x00, 0x0a, 0xd0, 0xf8,
+  0xb0, 0x21, 0xcd, 0xe9, 0x01, 0x36, 0x0b, 0x92, 0x03, 0x90, 0xd0, 0xf8,
+  0xb8, 0x01, 0x47, 0xf2, 0x04, 0x42, 0x0f, 0x90, 0x11, 0x98, 0x39, 0x60,
+  0x02, 0x44, 0x48, 0x08, 0x0c, 0x90, 0x01, 0xeb, 0x41, 0x00, 0x80, 0x08,
+  0x09, 0x90, 0x08, 0x46, 0x82, 0xed, 0x00, 0x0a, 0x8c, 0x08, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0x0a, 0x9b, 0x9f, 0xed, 0x0b, 0xab, 0x9f, 0xed,
+  0x0c, 0xbb, 0x9f, 0xed, 0x0d, 0xcb, 0x9f, 0xed, 0x0e, 0xdb, 0xcd, 0xe9,
+  0x0d, 0x10, 0x00, 0x21, 0x48, 0xf6, 0x10, 0x46, 0x48, 0xf2, 0x10, 0x05,
+  0x47, 0xf2, 0x10, 0x42, 0x0a, 0x94, 0x71, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x63, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6a, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x75, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7a, 0x40,
+  0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x73, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x77, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x5b, 0x40, 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40,
+  0x4f, 0xf0, 0x00, 0x40, 0x0b, 0x99, 0xdd, 0xe9, 0x14, 0x56, 0x13, 0x9a,
+  0x8e, 0x42, 0x00, 0xf2, 0xf9, 0x85, 0x11, 0x99, 0x88, 0x53, 0x12, 0x99,
+  0x09, 0x98, 0x01, 0x31, 0x0a, 0x9c, 0x02, 0x36, 0x04, 0x35, 0x88, 0x42,
+  0x02, 0xf1, 0x04, 0x02, 0x00, 0xf0, 0x02, 0x85, 0x13, 0xa8, 0x64, 0xc0,
+  0xb1, 0xfb, 0xf4, 0xf0, 0x12, 0x91, 0x10, 0x90, 0x00, 0xfb, 0x14, 0x10,
+  0xb4, 0xeb, 0x40, 0x0f, 0x80, 0xf0, 0xca, 0x81, 0x20, 0x1a, 0xff, 0xf7,
+  0xfe, 0xff, 0x1f, 0xed, 0x37, 0x0b, 0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7,
+  0xfe, 0xff, 0xdd, 0xe9, 0x0d, 0x32, 0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec,
+  0x10, 0x0b, 0x81, 0x46, 0x8d, 0xed, 0x1e, 0x0b, 0x9d, 0xf8, 0x7f, 0x00,
+  0x88, 0x46, 0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8, 0x7f, 0x00, 0xdd, 0xe9,
+  0x1e, 0x23, 0x48, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x43, 0x0b,
+  0x82, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x8b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x1f, 0xed, 0x45, 0x0b, 0x06, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x0f, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x47, 0x0b, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0x46, 0x0b, 0x46, 0x30, 0x46, 0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x51, 0x0b, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x1f, 0xed, 0x5a, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x63, 0x0b,
+  0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x6c, 0x0b, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x1f, 0xed, 0x75, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x7e, 0x0b,
+  0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x87, 0x0b, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x1f, 0xed, 0x90, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x98, 0x0b, 0x41, 0xec, 0x1e, 0x0b,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0x46, 0x0b, 0x46, 0x48, 0x46, 0x41, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x04, 0x46, 0x0d, 0x46, 0x48, 0x46, 0x41, 0x46, 0x22, 0x46, 0x2b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xa2, 0x0b, 0x80, 0x46, 0x89, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x40, 0x46, 0x49, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x1f, 0xed, 0xab, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xb4, 0x0b,
+  0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xbd, 0x0b, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x19, 0x2b, 0x50, 0x46, 0x59, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x1a, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46,
+  0x53, 0xec, 0x1b, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46,
+  0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x1c, 0x2b, 0x50, 0x46, 0x59, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x1d, 0x2b,
+  0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x20, 0x46, 0x29, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec, 0x18, 0x0b, 0xc7, 0xe1, 0x00, 0xbf,
+  0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xfa, 0x0b, 0x53, 0xec, 0x10, 0x2b,
+  0xff, 0xf7, 0xfe, 0xff, 0xdd, 0xe9, 0x0d, 0x32, 0xff, 0xf7, 0xfe, 0xff,
+  0x41, 0xec, 0x10, 0x0b, 0x81, 0x46, 0x8d, 0xed, 0x20, 0x0b, 0x9d, 0xf8,
+  0x87, 0x00, 0x88, 0x46, 0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8, 0x87, 0x00,
+  0xdd, 0xe9, 0x20, 0x23, 0x48, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xf9, 0x0b, 0x83, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x8a, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xf7, 0x0b, 0x06, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x0f, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xf5, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x30, 0x46, 0x39, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xeb, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xe2, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xd9, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xd0, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xc7, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xbe, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xb5, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xac, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xa4, 0x0b, 0x41, 0xec,
+  0x18, 0x0b, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x48, 0x46, 0x41, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x48, 0x46, 0x41, 0x46, 0x22, 0x46,
+  0x2b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0x9a, 0x0b, 0x80, 0x46,
+  0x89, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x40, 0x46, 0x49, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0x91, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0x88, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0x7f, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x19, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x1a, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x1b, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x1c, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x1d, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec, 0x1e, 0x0b, 0x10, 0x98,
+  0x0f, 0x99, 0x00, 0xf0, 0x03, 0x00, 0x14, 0x9d, 0x02, 0x28, 0x15, 0xd0,
+  0x01, 0x28, 0x21, 0xd0, 0x00, 0x28, 0x7d, 0xd1, 0x8d, 0xed, 0x16, 0xeb,
+  0x9d, 0xf8, 0x5f, 0x00, 0xb0, 0xee, 0x48, 0xfa, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x5f, 0x00, 0x9d, 0xed, 0x16, 0xeb, 0xf0, 0xee, 0x68, 0xfa,
+  0x8d, 0x42, 0x78, 0xd9, 0x32, 0xe2, 0x00, 0xbf, 0x8d, 0xed, 0x1c, 0x8b,
+  0x9d, 0xf8, 0x77, 0x00, 0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8, 0x77, 0x00,
+  0x9d, 0xed, 0x1c, 0xfb, 0x8d, 0x42, 0x6a, 0xd9, 0x24, 0xe2, 0x00, 0xbf,
+  0x8d, 0xed, 0x18, 0x8b, 0x9d, 0xf8, 0x67, 0x00, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x67, 0x00, 0x9d, 0xed, 0x18, 0x0b, 0x8d, 0xed, 0x1a, 0xeb,
+  0x9d, 0xf8, 0x6f, 0x00, 0xb0, 0xee, 0x40, 0xea, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x6f, 0x00, 0x9d, 0xed, 0x1a, 0xfb, 0xf0, 0xee, 0x60, 0xea,
+  0x8d, 0x42, 0x4e, 0xd9, 0x08, 0xe2, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5b, 0x40, 0xb0, 0xee, 0x4e, 0xfa,
+  0xb0, 0xee, 0x48, 0xea, 0xf0, 0xee, 0x6e, 0xfa, 0xf0, 0xee, 0x68, 0xea,
+  0x8d, 0x42, 0x00, 0xf2, 0xbb, 0x81, 0x58, 0xec, 0x1e, 0x4b, 0x20, 0x46,
+  0x41, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x11, 0x9e, 0x57, 0xec, 0x1f, 0xab,
+  0x70, 0x51, 0x50, 0x46, 0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x0c, 0x99,
+  0x12, 0x9a, 0x8a, 0x42, 0x11, 0x46, 0x13, 0x9a, 0xb0, 0x50, 0x15, 0x9e,
+  0xbf, 0xf4, 0xae, 0xab, 0x9f, 0xed, 0xd8, 0x0b, 0x20, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x41, 0x46, 0x08, 0x97, 0x04, 0x92, 0x06, 0x93, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xd5, 0x0b, 0x04, 0x46, 0x57, 0xec, 0x10, 0x2b,
+  0x3b, 0x46, 0x0d, 0x46, 0x05, 0x92, 0xff, 0xf7, 0xfe, 0xff, 0xd2, 0xa1,
+  0x00, 0x28, 0x08, 0x46, 0x01, 0xf1, 0x08, 0x08, 0x18, 0xbf, 0x40, 0x46,
+  0x90, 0xed, 0x00, 0x0b, 0x20, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x29, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xce, 0x0b, 0x07, 0x97, 0xff, 0x0f,
+  0x53, 0xec, 0x10, 0x5b, 0x89, 0x46, 0x67, 0xf3, 0xdf, 0x71, 0x2a, 0x46,
+  0x83, 0x46, 0x10, 0x93, 0xff, 0xf7, 0xfe, 0xff, 0x40, 0xb9, 0x4f, 0xf0,
+  0x00, 0x40, 0x0b, 0x9a, 0x06, 0xf5, 0x80, 0x61, 0x91, 0x42, 0x2a, 0xd9,
+  0x68, 0xe1, 0x00, 0xbf, 0x58, 0x46, 0x49, 0x46, 0x5a, 0x46, 0x4b, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x40, 0xf0, 0xc3, 0x80, 0x9f, 0xed,
+  0xc0, 0x0b, 0x58, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x49, 0x46, 0x03, 0x24,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x40, 0xf0, 0x54, 0x81, 0x10, 0x9b,
+  0x58, 0x46, 0x49, 0x46, 0x2a, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0x40, 0xf0, 0x4b, 0x81, 0x58, 0x46, 0x49, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x15, 0x9e, 0x0b, 0x9a, 0x06, 0xf5, 0x80, 0x61, 0x91, 0x42, 0x00, 0xf2,
+  0x3f, 0x81, 0x11, 0x99, 0x04, 0x9a, 0x31, 0x44, 0xa1, 0xf8, 0x00, 0x04,
+  0x08, 0x99, 0x06, 0x9b, 0x50, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x05, 0x9a,
+  0x07, 0x9b, 0x04, 0x46, 0x0e, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0xa1, 0xa0, 0x08, 0xbf, 0x80, 0x46, 0x98, 0xed, 0x00, 0x0b, 0x20, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x31, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x38, 0x46, 0x10, 0x9b, 0x0f, 0x46, 0x60, 0xf3, 0xdf, 0x71, 0x30, 0x46,
+  0x2a, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x3f, 0xf4, 0x14, 0xab,
+  0x30, 0x46, 0x39, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x00, 0x28, 0x71, 0xd1, 0x9f, 0xed, 0x97, 0x0b, 0x30, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x39, 0x46, 0x03, 0x24, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0x40, 0xf0, 0x03, 0x81, 0x10, 0x9b, 0x30, 0x46, 0x39, 0x46, 0x2a, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x40, 0xf0, 0xfa, 0x80, 0x30, 0x46,
+  0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xf7, 0xf3, 0xba, 0x00, 0xbf,
+  0x00, 0x21, 0x39, 0x60, 0x22, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0xdd, 0xf8, 0x08, 0x80, 0x0b, 0x99, 0xb8, 0xf1,
+  0x01, 0x0f, 0xf3, 0xdb, 0x01, 0x98, 0x00, 0x28, 0x46, 0xd0, 0xa8, 0xf1,
+  0x04, 0x00, 0x10, 0xf1, 0x03, 0x0f, 0x57, 0xd2, 0x4f, 0xf2, 0x5f, 0x3e,
+  0x46, 0xf2, 0x0d, 0x69, 0x28, 0xf0, 0x03, 0x03, 0xc3, 0xf6, 0x6e, 0x4e,
+  0xc0, 0xf2, 0x19, 0x09, 0x4f, 0xea, 0x43, 0x0c, 0x2a, 0x26, 0x45, 0xf2,
+  0x0a, 0x47, 0xbd, 0x1f, 0x8d, 0x42, 0x00, 0xf2, 0xc9, 0x80, 0x11, 0x9a,
+  0x06, 0xfb, 0x09, 0xe4, 0xd6, 0x19, 0xaa, 0x1c, 0x60, 0x14, 0x8a, 0x42,
+  0x26, 0xf8, 0x06, 0x0c, 0x00, 0xf2, 0xbe, 0x80, 0x04, 0xfb, 0x09, 0xe5,
+  0x94, 0x1c, 0x68, 0x14, 0x8c, 0x42, 0x26, 0xf8, 0x04, 0x0c, 0x00, 0xf2,
+  0xb5, 0x80, 0x05, 0xfb, 0x09, 0xe2, 0x02, 0x34, 0x50, 0x14, 0x8c, 0x42,
+  0x26, 0xf8, 0x02, 0x0c, 0x00, 0xf2, 0xac, 0x80, 0x02, 0xfb, 0x09, 0xe6,
+  0x11, 0x9a, 0x70, 0x14, 0xd0, 0x53, 0x04, 0x3b, 0x07, 0xf1, 0x08, 0x07,
+  0xd5, 0xd1, 0x45, 0xf2, 0x04, 0x40, 0x06, 0xfb, 0x09, 0xe5, 0x60, 0x44,
+  0x1e, 0xe0, 0x00, 0xbf, 0x05, 0x24, 0x9a, 0xe0, 0xb8, 0xf1, 0x01, 0x0f,
+  0x46, 0xd1, 0x9f, 0xed, 0x5e, 0x0a, 0x45, 0xf2, 0x04, 0x40, 0x0f, 0x99,
+  0x88, 0x42, 0x00, 0xf2, 0x8f, 0x80, 0x11, 0x9a, 0x10, 0xee, 0x10, 0x1a,
+  0x11, 0x50, 0x22, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x4b, 0xf2, 0x81, 0x15, 0xc4, 0xf2, 0x99, 0x05,
+  0x45, 0xf2, 0x04, 0x40, 0x18, 0xf0, 0x03, 0x02, 0x8a, 0xd0, 0x88, 0x42,
+  0x78, 0xd8, 0x11, 0x9f, 0x6b, 0x14, 0x01, 0x2a, 0x3b, 0x52, 0x3f, 0xf4,
+  0x83, 0xaf, 0x86, 0x1c, 0x8e, 0x42, 0x6f, 0xd8, 0x4f, 0xf2, 0x5f, 0x33,
+  0x46, 0xf2, 0x0d, 0x67, 0xc3, 0xf6, 0x6e, 0x43, 0xc0, 0xf2, 0x19, 0x07,
+  0x05, 0xfb, 0x07, 0x34, 0x02, 0x2a, 0x11, 0x9a, 0x4f, 0xea, 0x64, 0x45,
+  0x95, 0x53, 0x3f, 0xf4, 0x6f, 0xaf, 0x04, 0x30, 0x88, 0x42, 0x5b, 0xd8,
+  0x04, 0xfb, 0x07, 0x31, 0x11, 0x9a, 0x49, 0x14, 0x11, 0x52, 0x22, 0xb0,
+  0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0x11, 0x9b, 0x4f, 0xf2, 0x5f, 0x31, 0x46, 0xf2, 0x0d, 0x62, 0x28, 0xf0,
+  0x01, 0x0e, 0x45, 0xf2, 0x08, 0x40, 0x9f, 0xed, 0x37, 0x0a, 0x0f, 0x9e,
+  0x08, 0xf0, 0x01, 0x0c, 0xc3, 0xf6, 0x6e, 0x41, 0xc0, 0xf2, 0x19, 0x02,
+  0x1f, 0x18, 0x2a, 0x25, 0x45, 0xf2, 0x04, 0x44, 0x70, 0x46, 0xb4, 0x42,
+  0x36, 0xd8, 0x05, 0xfb, 0x02, 0x15, 0x04, 0x34, 0x6b, 0x14, 0x01, 0xee,
+  0x10, 0x3a, 0xb8, 0xee, 0xc1, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x11, 0xee,
+  0x10, 0x3a, 0xb4, 0x42, 0x47, 0xf8, 0x04, 0x3c, 0x26, 0xd8, 0x05, 0xfb,
+  0x02, 0x15, 0x02, 0x38, 0x4f, 0xea, 0x65, 0x43, 0x01, 0xee, 0x10, 0x3a,
+  0xb8, 0xee, 0xc1, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x11, 0xee, 0x10, 0x3a,
+  0x47, 0xf8, 0x08, 0x3b, 0x04, 0xf1, 0x04, 0x04, 0xdb, 0xd1, 0xbc, 0xf1,
+  0x00, 0x0f, 0x3f, 0xf4, 0x21, 0xaf, 0x05, 0xfb, 0x02, 0x10, 0x40, 0x14,
+  0x01, 0xee, 0x10, 0x0a, 0xb8, 0xee, 0xc1, 0x1a, 0x45, 0xf2, 0x04, 0x40,
+  0x21, 0xee, 0x00, 0x0a, 0x00, 0xeb, 0x8e, 0x00, 0x0f, 0x99, 0x88, 0x42,
+  0x7f, 0xf6, 0x71, 0xaf, 0x02, 0x24, 0x03, 0x98, 0x21, 0x46, 0x22, 0xb0,
+  0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x30, 0x81, 0x3e,
+  0x00, 0x00, 0x00, 0x38, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03,
+  0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x10, 0xc0, 0x02, 0x46, 0x80, 0x68,
+  0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x03, 0x07, 0xd3, 0x12, 0x69, 0x93, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x00, 0xbf,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x8b, 0xb0, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4,
+  0x50, 0x52, 0x53, 0xf8, 0x02, 0x80, 0xb8, 0xf1, 0x00, 0x0f, 0x00, 0xf0,
+  0xd3, 0x81, 0x01, 0x29, 0xc0, 0xf2, 0xd0, 0x81, 0x47, 0xf2, 0x04, 0x42,
+  0x1a, 0x44, 0x45, 0xf2, 0x04, 0x47, 0x92, 0xed, 0x00, 0x0a, 0x03, 0xeb,
+  0x07, 0x0c, 0xb8, 0xf1, 0x01, 0x0f, 0x03, 0xf5, 0x50, 0x5e, 0x2f, 0xdb,
+  0x34, 0xd1, 0xdc, 0xf8, 0x04, 0x00, 0x9c, 0xed, 0x00, 0x2a, 0xce, 0xf8,
+  0x08, 0x00, 0xa1, 0xf1, 0x08, 0x00, 0x10, 0xf1, 0x08, 0x0f, 0x01, 0xf0,
+  0x07, 0x00, 0x00, 0xf2, 0x1d, 0x81, 0x21, 0xf0, 0x07, 0x01, 0xa1, 0xf1,
+  0x08, 0x02, 0x01, 0x23, 0x03, 0xeb, 0xd2, 0x03, 0x13, 0xf0, 0x03, 0x03,
+  0x00, 0xf0, 0x1e, 0x81, 0x22, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x01, 0x2b, 0x21, 0xee,
+  0x00, 0x2a, 0x40, 0xf0, 0x0d, 0x81, 0x11, 0x46, 0x2f, 0xe1, 0x00, 0xbf,
+  0x9e, 0xed, 0x01, 0x1a, 0x21, 0xee, 0x00, 0x0a, 0x8a, 0xe1, 0x00, 0xbf,
+  0xd0, 0xf8, 0xb8, 0xb1, 0x00, 0x22, 0x43, 0xf2, 0x04, 0x4a, 0x06, 0x92,
+  0x0a, 0x90, 0x00, 0x27, 0x00, 0x26, 0x05, 0xe0, 0x54, 0x10, 0x01, 0x37,
+  0x47, 0x45, 0x46, 0xea, 0x04, 0x06, 0x3f, 0xd0, 0x45, 0xf2, 0x04, 0x42,
+  0x02, 0xeb, 0xc7, 0x04, 0x5c, 0x45, 0x4f, 0xf0, 0x02, 0x02, 0x00, 0xf2,
+  0xe2, 0x80, 0x0a, 0xeb, 0xc6, 0x05, 0x5d, 0x45, 0x00, 0xf2, 0xdd, 0x80,
+  0x1a, 0x59, 0xfc, 0x00, 0x5a, 0x51, 0x45, 0xf2, 0x08, 0x42, 0x14, 0x44,
+  0x5c, 0x45, 0x4f, 0xf0, 0x02, 0x02, 0x00, 0xf2, 0xd2, 0x80, 0xf5, 0x00,
+  0x43, 0xf2, 0x08, 0x49, 0x4d, 0x44, 0x5d, 0x45, 0x00, 0xf2, 0xcb, 0x80,
+  0x1a, 0x59, 0x5a, 0x51, 0x42, 0x46, 0x00, 0xbf, 0x16, 0xea, 0x62, 0x0f,
+  0xd2, 0xd0, 0x86, 0xea, 0x62, 0x06, 0x16, 0xea, 0xa2, 0x0f, 0x0f, 0xd0,
+  0x86, 0xea, 0xa2, 0x06, 0x16, 0xea, 0xe2, 0x0f, 0x0c, 0xd0, 0x86, 0xea,
+  0xe2, 0x05, 0x14, 0x11, 0x85, 0xea, 0x22, 0x16, 0x15, 0xea, 0x22, 0x1f,
+  0x22, 0x46, 0xe9, 0xd1, 0x2e, 0x46, 0xbe, 0xe7, 0x94, 0x10, 0xbc, 0xe7,
+  0xd4, 0x10, 0xba, 0xe7, 0x06, 0x9c, 0x02, 0x22, 0x00, 0x2a, 0x00, 0xf0,
+  0x4f, 0x81, 0x01, 0x2a, 0xc0, 0xf2, 0x8b, 0x80, 0x56, 0x08, 0x98, 0xfb,
+  0xf2, 0xf7, 0x01, 0x2e, 0x4f, 0xf0, 0x01, 0x05, 0x4f, 0xea, 0x82, 0x06,
+  0x88, 0xbf, 0x55, 0x08, 0x09, 0x96, 0xd6, 0x00, 0x00, 0x96, 0xbe, 0x00,
+  0x07, 0x96, 0x03, 0xeb, 0x82, 0x06, 0x00, 0x20, 0x43, 0xf2, 0x08, 0x49,
+  0x08, 0x96, 0xcd, 0xf8, 0x0c, 0xc0, 0x06, 0x94, 0xcd, 0xe9, 0x01, 0x2e,
+  0x47, 0xf2, 0x10, 0x47, 0x48, 0xf2, 0x10, 0x06, 0xaa, 0x46, 0x05, 0x90,
+  0xcd, 0xf8, 0x10, 0x90, 0xd9, 0x45, 0x7d, 0xd8, 0x5e, 0x45, 0x7b, 0xd8,
+  0x09, 0x9a, 0x28, 0x46, 0x02, 0xeb, 0x09, 0x04, 0x25, 0x1f, 0x5d, 0x45,
+  0x74, 0xd8, 0x5f, 0x45, 0x72, 0xd8, 0x5c, 0x45, 0x70, 0xd8, 0xdd, 0xf8,
+  0x20, 0xc0, 0x53, 0xf8, 0x09, 0x50, 0x0c, 0xeb, 0x09, 0x0e, 0x01, 0xee,
+  0x10, 0x5a, 0x5e, 0xf8, 0x04, 0x5c, 0x9c, 0x59, 0x03, 0xee, 0x10, 0x5a,
+  0xdd, 0x59, 0x02, 0xee, 0x10, 0x4a, 0x05, 0xee, 0x10, 0x5a, 0x5c, 0xf8,
+  0x09, 0x50, 0x22, 0xee, 0x03, 0x4a, 0x06, 0xee, 0x10, 0x5a, 0x25, 0xee,
+  0x06, 0x7a, 0x34, 0xee, 0x07, 0x4a, 0xa9, 0xf1, 0x04, 0x02, 0x31, 0xee,
+  0x04, 0x7a, 0x03, 0xeb, 0x09, 0x04, 0x17, 0xee, 0x10, 0x5a, 0x5a, 0x45,
+  0x25, 0x60, 0x49, 0xd8, 0x54, 0xf8, 0x04, 0x5c, 0x25, 0xee, 0x03, 0x3a,
+  0x22, 0xee, 0x06, 0x2a, 0x07, 0xee, 0x10, 0x5a, 0x33, 0xee, 0x42, 0x2a,
+  0x37, 0xee, 0x02, 0x3a, 0x13, 0xee, 0x10, 0x5a, 0x31, 0xee, 0x44, 0x1a,
+  0x44, 0xf8, 0x04, 0x5c, 0x11, 0xee, 0x10, 0x5a, 0x37, 0xee, 0x42, 0x1a,
+  0x07, 0x9a, 0xce, 0xf8, 0x00, 0x50, 0x11, 0xee, 0x10, 0x5a, 0x4e, 0xf8,
+  0x04, 0x5c, 0xba, 0xf1, 0x01, 0x0a, 0x17, 0x44, 0x16, 0x44, 0x09, 0xf1,
+  0x08, 0x09, 0x05, 0x46, 0xa4, 0xd1, 0x01, 0x9a, 0x05, 0x98, 0x00, 0x9f,
+  0xdd, 0xf8, 0x10, 0x90, 0x10, 0x44, 0xdd, 0xe9, 0x02, 0xec, 0x06, 0x9c,
+  0x40, 0x45, 0xb9, 0x44, 0x43, 0xf2, 0x04, 0x4a, 0x8e, 0xdb, 0xb8, 0xeb,
+  0x42, 0x0f, 0x4f, 0xea, 0x42, 0x02, 0xbf, 0xf6, 0x69, 0xaf, 0x9e, 0xed,
+  0x01, 0x1a, 0x01, 0x34, 0x21, 0xee, 0x00, 0x1a, 0x8c, 0x42, 0x06, 0x94,
+  0x8c, 0xed, 0x00, 0x1a, 0x7f, 0xf4, 0x13, 0xaf, 0x96, 0xe0, 0x00, 0xbf,
+  0x9f, 0xed, 0x59, 0x1a, 0x74, 0xe0, 0x00, 0xbf, 0x02, 0x22, 0x0a, 0x98,
+  0x11, 0x46, 0x0b, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x25, 0xe0, 0x00, 0xbf, 0x22, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x02, 0x2b, 0x21, 0xee,
+  0x00, 0x2a, 0x01, 0xd1, 0x10, 0x39, 0x10, 0xe0, 0x22, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x2a, 0x18, 0x39, 0x18, 0x2a, 0x42, 0xd3, 0x00, 0xbf,
+  0x22, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x20, 0x39, 0x21, 0xee, 0x00, 0x2a, 0xbd, 0xd1,
+  0xb0, 0xb1, 0x01, 0x28, 0x22, 0xee, 0x00, 0x1a, 0x07, 0xd0, 0x02, 0x28,
+  0x21, 0xee, 0x00, 0x2a, 0x0e, 0xd0, 0x03, 0x28, 0x22, 0xee, 0x00, 0x1a,
+  0x06, 0xd1, 0xb0, 0xee, 0x41, 0x0a, 0xb0, 0xee, 0x42, 0x1a, 0x8e, 0xed,
+  0x01, 0x2a, 0x07, 0xe0, 0x04, 0x28, 0x21, 0xee, 0x00, 0x2a, 0x09, 0xd1,
+  0xb0, 0xee, 0x42, 0x0a, 0x8e, 0xed, 0x01, 0x1a, 0x8c, 0xed, 0x00, 0x0a,
+  0x0b, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf, 0x05, 0x28, 0x22, 0xee,
+  0x00, 0x3a, 0x03, 0xd1, 0xb0, 0xee, 0x43, 0x0a, 0xe5, 0xe7, 0x00, 0xbf,
+  0x06, 0x28, 0x23, 0xee, 0x00, 0x1a, 0x09, 0xd1, 0xb0, 0xee, 0x41, 0x0a,
+  0xb0, 0xee, 0x43, 0x1a, 0x8e, 0xed, 0x01, 0x3a, 0xe6, 0xe7, 0x00, 0xbf,
+  0x04, 0x22, 0x54, 0xe7, 0x21, 0xee, 0x00, 0x0a, 0xde, 0xe7, 0x00, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0x52, 0x69, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x41,
+  0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3,
+  0x49, 0xf6, 0xc5, 0x58, 0xca, 0x00, 0xc8, 0xf2, 0x1c, 0x18, 0x2f, 0xd0,
+  0xd0, 0xf8, 0xa8, 0xe1, 0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c,
+  0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x00, 0xbf,
+  0x74, 0x45, 0x25, 0xd8, 0x65, 0x1c, 0x75, 0x45, 0x22, 0xd8, 0xa5, 0x1c,
+  0x75, 0x45, 0x1f, 0xd8, 0xe5, 0x1c, 0x75, 0x45, 0x1c, 0xd8, 0x13, 0xf8,
+  0x01, 0x5c, 0x13, 0xf8, 0x04, 0x6b, 0x85, 0xea, 0x08, 0x05, 0x05, 0xfb,
+  0x0c, 0xf5, 0x13, 0xf8, 0x03, 0x7c, 0x75, 0x40, 0x05, 0xfb, 0x0c, 0xf5,
+  0x13, 0xf8, 0x02, 0x1c, 0x7d, 0x40, 0x05, 0xfb, 0x0c, 0xf5, 0x69, 0x40,
+  0x01, 0xfb, 0x0c, 0xf8, 0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04, 0xdb, 0xd1,
+  0x40, 0x46, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0xbf, 0x02, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x69, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x00, 0x23,
+  0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x69, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x85, 0xb0, 0x82, 0x68,
+  0x86, 0x46, 0xd2, 0xf8, 0x78, 0x71, 0x4f, 0xf4, 0x50, 0x50, 0x57, 0xf8,
+  0x00, 0xc0, 0xbc, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0x7b, 0x80, 0x01, 0x29,
+  0x78, 0xdb, 0x47, 0xf2, 0x04, 0x40, 0x38, 0x44, 0xcd, 0xe9, 0x03, 0x12,
+  0xd2, 0xf8, 0xb8, 0x61, 0x02, 0x90, 0x45, 0xf2, 0x04, 0x40, 0x38, 0x44,
+  0x07, 0xf5, 0x50, 0x52, 0x4f, 0xf0, 0x00, 0x09, 0x43, 0xf2, 0x04, 0x4a,
+  0x45, 0xf2, 0x04, 0x4b, 0x45, 0xf2, 0x08, 0x48, 0x01, 0x90, 0x00, 0x92,
+  0xbc, 0xf1, 0x01, 0x0f, 0x3c, 0xdb, 0x00, 0x20, 0x00, 0x21, 0x05, 0xe0,
+  0x5c, 0x10, 0x01, 0x30, 0x60, 0x45, 0x41, 0xea, 0x04, 0x01, 0x33, 0xd0,
+  0x0b, 0xeb, 0xc0, 0x03, 0xb3, 0x42, 0x55, 0xd8, 0x0a, 0xeb, 0xc1, 0x04,
+  0xb4, 0x42, 0x51, 0xd8, 0xc5, 0x00, 0xfa, 0x58, 0x05, 0xeb, 0x08, 0x03,
+  0xb3, 0x42, 0x3a, 0x51, 0x4a, 0xd8, 0xca, 0x00, 0x43, 0xf2, 0x08, 0x44,
+  0x15, 0x19, 0xb5, 0x42, 0x44, 0xd8, 0xfa, 0x58, 0x63, 0x46, 0x7a, 0x51,
+  0x11, 0xea, 0x63, 0x0f, 0xde, 0xd0, 0x81, 0xea, 0x63, 0x01, 0x11, 0xea,
+  0xa3, 0x0f, 0x0f, 0xd0, 0x81, 0xea, 0xa3, 0x01, 0x11, 0xea, 0xe3, 0x0f,
+  0x0c, 0xd0, 0x81, 0xea, 0xe3, 0x05, 0x1c, 0x11, 0x85, 0xea, 0x23, 0x11,
+  0x15, 0xea, 0x23, 0x1f, 0x23, 0x46, 0xe9, 0xd1, 0x29, 0x46, 0xca, 0xe7,
+  0x9c, 0x10, 0xc8, 0xe7, 0xdc, 0x10, 0xc6, 0xe7, 0x70, 0x46, 0x61, 0x46,
+  0x01, 0x22, 0x74, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x98, 0x00, 0x9a,
+  0x90, 0xf8, 0x68, 0x00, 0x00, 0x28, 0x03, 0x98, 0x14, 0xd1, 0x02, 0x99,
+  0x92, 0xed, 0x01, 0x0a, 0x91, 0xed, 0x00, 0x1a, 0x09, 0xf1, 0x01, 0x09,
+  0x81, 0x45, 0x01, 0x98, 0x20, 0xee, 0x01, 0x0a, 0x80, 0xed, 0x00, 0x0a,
+  0x06, 0xd0, 0xd2, 0xf8, 0x00, 0xc0, 0xa6, 0x46, 0xbc, 0xf1, 0x01, 0x0f,
+  0xa1, 0xda, 0xdd, 0xe7, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0x04, 0x98, 0x02, 0x21, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+  0x00, 0x03, 0xd3, 0xf8, 0x20, 0xc0, 0x86, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x0c, 0x08, 0xd3, 0xde, 0xf8, 0x10, 0x30, 0x9c, 0x45,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x00, 0xbf,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x4f, 0x81, 0xb0, 0x2d, 0xed, 0x06, 0x8b, 0x9e, 0xb0, 0xd0, 0xf8,
+  0x78, 0xc1, 0xd0, 0xf8, 0xb8, 0xb1, 0x03, 0x23, 0x01, 0x26, 0x00, 0xbf,
+  0xdf, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa, 0x05, 0xf5, 0xa9, 0x42,
+  0x16, 0xdd, 0x9f, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa, 0x05, 0xf5,
+  0xa9, 0x42, 0x0f, 0xdd, 0x5f, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa,
+  0x05, 0xf5, 0xa9, 0x42, 0x08, 0xdd, 0x03, 0xf0, 0x1f, 0x07, 0x06, 0xfa,
+  0x07, 0xf7, 0xb9, 0x42, 0x03, 0xf1, 0x04, 0x03, 0xe2, 0xdc, 0x1f, 0x1f,
+  0xfb, 0x07, 0x40, 0xf0, 0x77, 0x81, 0x01, 0x27, 0x01, 0x29, 0xc0, 0xf2,
+  0xb9, 0x81, 0xbd, 0x00, 0x8d, 0x42, 0x00, 0xf3, 0xb5, 0x81, 0x4f, 0xea,
+  0x82, 0x0e, 0x4f, 0xea, 0xc2, 0x08, 0x02, 0xeb, 0x42, 0x02, 0x43, 0xf2,
+  0x04, 0x46, 0x4f, 0xea, 0x82, 0x09, 0x0c, 0xeb, 0x06, 0x02, 0x12, 0x92,
+  0x00, 0x2d, 0x00, 0xf0, 0xb5, 0x81, 0x2b, 0x46, 0x01, 0x2f, 0xc0, 0xf2,
+  0x53, 0x81, 0x91, 0xfb, 0xf3, 0xf5, 0xdc, 0x00, 0x00, 0x94, 0x0e, 0xfb,
+  0x05, 0xf4, 0x0c, 0x94, 0x08, 0xfb, 0x05, 0xf4, 0x0b, 0x94, 0x09, 0xfb,
+  0x05, 0xf4, 0x43, 0xf2, 0x08, 0x4a, 0x0a, 0x94, 0x0a, 0xeb, 0xc7, 0x04,
+  0x15, 0x94, 0x12, 0x9c, 0x07, 0xeb, 0x47, 0x02, 0x04, 0xeb, 0xc7, 0x05,
+  0x0f, 0x95, 0x06, 0xeb, 0xc7, 0x05, 0x16, 0x95, 0x0a, 0xeb, 0x07, 0x15,
+  0x13, 0x95, 0x04, 0xeb, 0x07, 0x15, 0x0e, 0x95, 0x06, 0xeb, 0x07, 0x15,
+  0x14, 0x95, 0x0a, 0xeb, 0xc2, 0x05, 0x04, 0xeb, 0xc2, 0x04, 0x06, 0xeb,
+  0xc2, 0x02, 0x10, 0x95, 0x0d, 0x94, 0x11, 0x92, 0x00, 0x24, 0x00, 0x22,
+  0xcd, 0xe9, 0x05, 0x72, 0xcd, 0xe9, 0x03, 0x8e, 0xcd, 0xe9, 0x01, 0x39,
+  0xcd, 0xe9, 0x08, 0x0c, 0x47, 0xf2, 0x10, 0x40, 0x1d, 0x90, 0x07, 0x94,
+  0x12, 0x9b, 0x48, 0xf2, 0x10, 0x0a, 0x47, 0xf2, 0x10, 0x4e, 0x48, 0xf2,
+  0x10, 0x09, 0x47, 0xf2, 0x10, 0x48, 0x48, 0xf2, 0x10, 0x06, 0x43, 0xf2,
+  0x08, 0x40, 0x20, 0x44, 0x58, 0x45, 0x98, 0xbf, 0xda, 0x45, 0x00, 0xf2,
+  0x59, 0x81, 0x16, 0x9a, 0x22, 0x44, 0x5a, 0x45, 0x98, 0xbf, 0xde, 0x45,
+  0x00, 0xf2, 0x52, 0x81, 0x15, 0x9a, 0x22, 0x44, 0x5a, 0x45, 0x98, 0xbf,
+  0xd9, 0x45, 0x00, 0xf2, 0x4b, 0x81, 0x14, 0x9a, 0x22, 0x44, 0x5a, 0x45,
+  0x98, 0xbf, 0xd8, 0x45, 0x00, 0xf2, 0x44, 0x81, 0x13, 0x9a, 0x22, 0x44,
+  0x5a, 0x45, 0x98, 0xbf, 0x5e, 0x45, 0x00, 0xf2, 0x3d, 0x81, 0x11, 0x9a,
+  0x22, 0x44, 0x5a, 0x45, 0x00, 0xf2, 0x38, 0x81, 0xa6, 0xf5, 0x40, 0x62,
+  0x5a, 0x45, 0x00, 0xf2, 0x33, 0x81, 0x10, 0x9a, 0x22, 0x44, 0x5a, 0x45,
+  0x00, 0xf2, 0x2e, 0x81, 0x1b, 0x97, 0x5c, 0xf8, 0x0a, 0x70, 0x1a, 0x19,
+  0x1c, 0x92, 0x01, 0xee, 0x10, 0x7a, 0x0f, 0x9f, 0x1a, 0x46, 0x3d, 0x59,
+  0x27, 0x44, 0x33, 0x46, 0x7e, 0x68, 0x02, 0xee, 0x10, 0x5a, 0x04, 0xee,
+  0x10, 0x6a, 0x5c, 0xf8, 0x09, 0x60, 0x5c, 0xf8, 0x0e, 0x50, 0x06, 0xee,
+  0x10, 0x6a, 0x0e, 0x9e, 0x05, 0xee, 0x10, 0x5a, 0x35, 0x59, 0xcd, 0xf8,
+  0x60, 0xa0, 0xdd, 0xf8, 0x74, 0xa0, 0xcd, 0xf8, 0x5c, 0xe0, 0x06, 0xeb,
+  0x04, 0x0e, 0xcd, 0xf8, 0x68, 0x80, 0x19, 0x93, 0x00, 0xee, 0x90, 0x5a,
+  0x5c, 0xf8, 0x08, 0x50, 0xde, 0xf8, 0x04, 0x60, 0xdd, 0xf8, 0x34, 0x80,
+  0x02, 0xee, 0x90, 0x6a, 0x58, 0xf8, 0x04, 0x60, 0x03, 0xee, 0x90, 0x5a,
+  0x5c, 0xf8, 0x03, 0x50, 0x05, 0xee, 0x90, 0x6a, 0x5c, 0xf8, 0x0a, 0x60,
+  0x04, 0xee, 0x90, 0x5a, 0x08, 0xeb, 0x04, 0x05, 0x08, 0xee, 0x10, 0x6a,
+  0x6e, 0x68, 0x1c, 0x9b, 0x21, 0xee, 0x02, 0x0a, 0x25, 0xee, 0x04, 0x3a,
+  0x30, 0xee, 0x03, 0x0a, 0x26, 0xee, 0x20, 0x3a, 0x23, 0xee, 0xa2, 0x7a,
+  0x09, 0xee, 0x10, 0x6a, 0x5e, 0x68, 0x33, 0xee, 0x07, 0x3a, 0x24, 0xee,
+  0xa5, 0x7a, 0x68, 0xee, 0x09, 0x1a, 0x37, 0xee, 0x21, 0x7a, 0x01, 0xee,
+  0x90, 0x6a, 0x71, 0xee, 0x80, 0x6a, 0x73, 0xee, 0x07, 0x7a, 0x36, 0xee,
+  0xa7, 0xaa, 0x04, 0x38, 0x1a, 0xee, 0x10, 0x6a, 0x58, 0x45, 0x5e, 0x60,
+  0x00, 0xf2, 0xc8, 0x80, 0x25, 0xee, 0x02, 0x2a, 0x21, 0xee, 0x04, 0x1a,
+  0x32, 0xee, 0x41, 0x1a, 0x23, 0xee, 0xa0, 0x2a, 0x26, 0xee, 0x22, 0x4a,
+  0x10, 0x59, 0x32, 0xee, 0x44, 0x2a, 0x28, 0xee, 0x25, 0x4a, 0x24, 0xee,
+  0x89, 0x5a, 0x06, 0xee, 0x10, 0x0a, 0x34, 0xee, 0x45, 0x4a, 0x36, 0xee,
+  0x01, 0x5a, 0x76, 0xee, 0xe7, 0x0a, 0x72, 0xee, 0x04, 0x2a, 0x10, 0xee,
+  0x90, 0x0a, 0x75, 0xee, 0x62, 0x0a, 0x31, 0xee, 0xc0, 0x0a, 0x32, 0xee,
+  0x44, 0x2a, 0xce, 0xf8, 0x04, 0x00, 0x10, 0xee, 0x90, 0x0a, 0x30, 0xee,
+  0x42, 0x4a, 0x36, 0xee, 0x41, 0x1a, 0x33, 0xee, 0x47, 0x3a, 0xce, 0xf8,
+  0x00, 0x00, 0x14, 0xee, 0x10, 0x0a, 0x31, 0xee, 0x03, 0x4a, 0x78, 0x60,
+  0x14, 0xee, 0x10, 0x0a, 0x30, 0xee, 0x02, 0x0a, 0x38, 0x60, 0x10, 0xee,
+  0x10, 0x0a, 0x31, 0xee, 0x43, 0x0a, 0x68, 0x60, 0x10, 0xee, 0x10, 0x0a,
+  0x35, 0xee, 0x22, 0x0a, 0x28, 0x60, 0x10, 0xee, 0x10, 0x0a, 0x10, 0x51,
+  0xdd, 0xf8, 0x28, 0xc0, 0x0c, 0x98, 0xdd, 0xf8, 0x68, 0x80, 0x13, 0x46,
+  0x19, 0x9e, 0x80, 0x44, 0x81, 0x44, 0x0b, 0x98, 0x18, 0x9a, 0xe2, 0x44,
+  0x1b, 0x9f, 0xdd, 0xf8, 0x5c, 0xe0, 0xcd, 0xf8, 0x74, 0xa0, 0x66, 0x44,
+  0x02, 0x44, 0xdd, 0xf8, 0x24, 0xc0, 0x01, 0x3f, 0x04, 0xf1, 0x08, 0x04,
+  0x86, 0x44, 0x92, 0x46, 0x7f, 0xf4, 0x05, 0xaf, 0x01, 0x9b, 0x06, 0x9a,
+  0x43, 0xf2, 0x04, 0x46, 0x1a, 0x44, 0x10, 0x46, 0x06, 0x92, 0x00, 0x98,
+  0x07, 0x9c, 0xdd, 0xe9, 0x04, 0xe7, 0x04, 0x44, 0x08, 0x98, 0xdd, 0xe9,
+  0x02, 0x98, 0x8a, 0x42, 0xff, 0xf6, 0xe4, 0xae, 0x9d, 0x00, 0xb1, 0xeb,
+  0x83, 0x0f, 0x1f, 0x46, 0xbf, 0xf6, 0xa0, 0xae, 0x46, 0xe0, 0x00, 0xbf,
+  0x01, 0x29, 0x43, 0xdb, 0x00, 0x23, 0x43, 0xf2, 0x10, 0x47, 0x00, 0xbf,
+  0xa7, 0xf1, 0x08, 0x06, 0x5e, 0x45, 0x98, 0xbf, 0x5f, 0x45, 0x40, 0xd8,
+  0x0c, 0xeb, 0x07, 0x06, 0x56, 0xf8, 0x08, 0x5c, 0xa7, 0xf1, 0x0c, 0x04,
+  0x00, 0xee, 0x10, 0x5a, 0x5c, 0xf8, 0x07, 0x50, 0x5c, 0x45, 0x01, 0xee,
+  0x10, 0x5a, 0x30, 0xee, 0x41, 0x2a, 0x12, 0xee, 0x10, 0x5a, 0x4c, 0xf8,
+  0x07, 0x50, 0x2c, 0xd8, 0x3d, 0x1f, 0x5d, 0x45, 0x29, 0xd8, 0x56, 0xf8,
+  0x0c, 0x5c, 0x56, 0xf8, 0x04, 0x4c, 0x02, 0xee, 0x10, 0x5a, 0x03, 0xee,
+  0x10, 0x4a, 0x32, 0xee, 0x43, 0x4a, 0x14, 0xee, 0x10, 0x5a, 0x30, 0xee,
+  0x01, 0x0a, 0x46, 0xf8, 0x04, 0x5c, 0x10, 0xee, 0x10, 0x5a, 0x32, 0xee,
+  0x03, 0x0a, 0x02, 0x33, 0x46, 0xf8, 0x08, 0x5c, 0x10, 0xee, 0x10, 0x5a,
+  0x8b, 0x42, 0x07, 0xf1, 0x10, 0x07, 0x46, 0xf8, 0x0c, 0x5c, 0xc3, 0xdb,
+  0x02, 0x27, 0x01, 0x29, 0xbf, 0xf6, 0x47, 0xae, 0x1e, 0xb0, 0xbd, 0xec,
+  0x06, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x08, 0x98, 0x02, 0x21,
+  0x1e, 0xb0, 0xbd, 0xec, 0x06, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x04, 0x21, 0xf5, 0xe7, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6a, 0x01, 0x46,
+  0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x41, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51,
+  0x59, 0x58, 0xe1, 0xb3, 0x49, 0xf6, 0xc5, 0x58, 0xca, 0x00, 0xc8, 0xf2,
+  0x1c, 0x18, 0x2f, 0xd0, 0xd0, 0xf8, 0xa8, 0xe1, 0x03, 0xf5, 0x50, 0x53,
+  0x40, 0xf2, 0x93, 0x1c, 0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2,
+  0x04, 0x44, 0x00, 0xbf, 0x74, 0x45, 0x25, 0xd8, 0x65, 0x1c, 0x75, 0x45,
+  0x22, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x1f, 0xd8, 0xe5, 0x1c, 0x75, 0x45,
+  0x1c, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x13, 0xf8, 0x04, 0x6b, 0x85, 0xea,
+  0x08, 0x05, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x03, 0x7c, 0x75, 0x40,
+  0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x02, 0x1c, 0x7d, 0x40, 0x05, 0xfb,
+  0x0c, 0xf5, 0x69, 0x40, 0x01, 0xfb, 0x0c, 0xf8, 0x04, 0x3a, 0x04, 0xf1,
+  0x04, 0x04, 0xdb, 0xd1, 0x40, 0x46, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0xbf,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6a, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x4a, 0x00, 0x00, 0x23, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x6a, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x85, 0xb0, 0x83, 0x68, 0x84, 0x46, 0xd3, 0xf8, 0x78, 0x71, 0x4f, 0xf4,
+  0x50, 0x50, 0x3a, 0x58, 0x00, 0x2a, 0x79, 0xd0, 0x8e, 0x46, 0x01, 0x29,
+  0x76, 0xdb, 0x47, 0xf2, 0x04, 0x40, 0x38, 0x44, 0x04, 0x93, 0x03, 0x90,
+  0x45, 0xf2, 0x04, 0x40, 0xd3, 0xf8, 0xb8, 0xa1, 0x38, 0x44, 0x02, 0x90,
+  0x07, 0xf5, 0x50, 0x50, 0x4f, 0xf0, 0x00, 0x09, 0x45, 0xf2, 0x04, 0x4b,
+  0x45, 0xf2, 0x08, 0x48, 0x01, 0x90, 0x01, 0x2a, 0x3e, 0xdb, 0x00, 0x20,
+  0x00, 0x21, 0x05, 0xe0, 0x5c, 0x10, 0x01, 0x30, 0x90, 0x42, 0x41, 0xea,
+  0x04, 0x01, 0x35, 0xd0, 0x0b, 0xeb, 0xc0, 0x03, 0x53, 0x45, 0x57, 0xd8,
+  0x43, 0xf2, 0x04, 0x44, 0x04, 0xeb, 0xc1, 0x04, 0x54, 0x45, 0x51, 0xd8,
+  0xc5, 0x00, 0xfe, 0x58, 0x05, 0xeb, 0x08, 0x03, 0x53, 0x45, 0x3e, 0x51,
+  0x4a, 0xd8, 0xce, 0x00, 0x43, 0xf2, 0x08, 0x44, 0x35, 0x19, 0x55, 0x45,
+  0x44, 0xd8, 0xfb, 0x58, 0x7b, 0x51, 0x13, 0x46, 0x11, 0xea, 0x63, 0x0f,
+  0xdc, 0xd0, 0x81, 0xea, 0x63, 0x01, 0x11, 0xea, 0xa3, 0x0f, 0x0f, 0xd0,
+  0x81, 0xea, 0xa3, 0x01, 0x11, 0xea, 0xe3, 0x0f, 0x0c, 0xd0, 0x81, 0xea,
+  0xe3, 0x05, 0x1c, 0x11, 0x85, 0xea, 0x23, 0x11, 0x15, 0xea, 0x23, 0x1f,
+  0x23, 0x46, 0xe9, 0xd1, 0x29, 0x46, 0xc8, 0xe7, 0x9c, 0x10, 0xc6, 0xe7,
+  0xdc, 0x10, 0xc4, 0xe7, 0x60, 0x46, 0x43, 0xf2, 0x04, 0x41, 0x01, 0x23,
+  0x64, 0x46, 0x75, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x98, 0x01, 0x99,
+  0x90, 0xf8, 0x68, 0x00, 0xa0, 0xb9, 0x03, 0x98, 0x91, 0xed, 0x01, 0x0a,
+  0x90, 0xed, 0x00, 0x1a, 0x09, 0xf1, 0x01, 0x09, 0x02, 0x98, 0xae, 0x46,
+  0x20, 0xee, 0x01, 0x0a, 0xa9, 0x45, 0x80, 0xed, 0x00, 0x0a, 0x05, 0xd0,
+  0x0a, 0x68, 0xa4, 0x46, 0x01, 0x2a, 0xa0, 0xda, 0xde, 0xe7, 0x00, 0xbf,
+  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf, 0x04, 0x98, 0x02, 0x21,
+  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x0c, 0xc0, 0xf2, 0x00, 0x0c, 0xdc, 0xf8,
+  0x30, 0xc0, 0x0d, 0xf1, 0x04, 0x0e, 0xbe, 0xeb, 0x0c, 0x0c, 0x07, 0xd3,
+  0xd0, 0xf8, 0x10, 0xe0, 0xf4, 0x45, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x8f, 0xb0, 0x02, 0x2a,
+  0x39, 0xdb, 0xd0, 0xf8, 0x08, 0xa0, 0x0d, 0x46, 0xda, 0xf8, 0x78, 0xb1,
+  0xda, 0xf8, 0xb8, 0x81, 0x04, 0x46, 0x25, 0xd1, 0xa8, 0x45, 0x1c, 0xd3,
+  0x15, 0xf1, 0x09, 0x0f, 0x19, 0xd8, 0x05, 0xf1, 0x08, 0x00, 0x40, 0x45,
+  0x15, 0xd8, 0x5b, 0xf8, 0x05, 0x10, 0x5b, 0xf8, 0x00, 0x30, 0x00, 0xee,
+  0x10, 0x1a, 0x01, 0xee, 0x10, 0x3a, 0x30, 0xee, 0x01, 0x2a, 0x29, 0x1d,
+  0x0b, 0xeb, 0x05, 0x02, 0x12, 0xee, 0x10, 0x3a, 0x41, 0x45, 0x13, 0x60,
+  0x98, 0xbf, 0x15, 0xf1, 0x0d, 0x0f, 0x40, 0xf2, 0x2d, 0x81, 0x50, 0x46,
+  0x02, 0x21, 0x0f, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x1f, 0x46, 0x16, 0x46, 0x52, 0x08, 0x5b, 0x00, 0x20, 0x46, 0x29, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0x10, 0xb1, 0x0f, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x6f, 0xf0, 0x0c, 0x00, 0x00, 0xea, 0x86, 0x00,
+  0x4f, 0xea, 0x96, 0x09, 0x41, 0x19, 0xbb, 0x00, 0x20, 0x46, 0x4a, 0x46,
+  0x0c, 0x93, 0xff, 0xf7, 0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0x00, 0x28,
+  0xeb, 0xd1, 0x09, 0xeb, 0x49, 0x00, 0x0e, 0x90, 0x0c, 0x9b, 0x05, 0xeb,
+  0xc0, 0x01, 0x20, 0x46, 0x4a, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9a, 0xf8,
+  0x68, 0x00, 0x00, 0x28, 0xdd, 0xd1, 0x04, 0x2e, 0xdb, 0xd3, 0x0e, 0x98,
+  0x4a, 0x46, 0xc1, 0x00, 0x07, 0xeb, 0x47, 0x00, 0x80, 0x00, 0xb9, 0xf1,
+  0x01, 0x0f, 0x98, 0xbf, 0x01, 0x22, 0x01, 0x90, 0x4f, 0xea, 0x09, 0x10,
+  0x05, 0x90, 0x4f, 0xea, 0xc9, 0x00, 0x06, 0x90, 0x01, 0xeb, 0x0b, 0x00,
+  0x04, 0x30, 0x48, 0xf2, 0x10, 0x06, 0x04, 0x91, 0x03, 0x90, 0x0b, 0xeb,
+  0x06, 0x00, 0x0b, 0x90, 0x0b, 0xeb, 0x09, 0x10, 0x04, 0x30, 0x02, 0x90,
+  0x0b, 0xeb, 0xc9, 0x00, 0x04, 0x30, 0x0a, 0x90, 0x47, 0xf2, 0x10, 0x40,
+  0x0d, 0x90, 0x47, 0xf2, 0x10, 0x40, 0x0e, 0x90, 0x06, 0x98, 0x28, 0x44,
+  0x07, 0x1d, 0x47, 0x45, 0x9b, 0xd8, 0x2f, 0x1d, 0x47, 0x45, 0x98, 0xbf,
+  0x46, 0x45, 0x96, 0xd8, 0x05, 0x99, 0x4f, 0x19, 0x47, 0x45, 0x92, 0xd8,
+  0x0d, 0x99, 0x41, 0x45, 0x8f, 0xd8, 0x04, 0x37, 0x47, 0x45, 0x8c, 0xd8,
+  0x0e, 0x99, 0x01, 0xf5, 0x40, 0x67, 0x47, 0x45, 0x3f, 0xf6, 0x87, 0xaf,
+  0x04, 0x99, 0x4f, 0x19, 0x47, 0x45, 0x3f, 0xf6, 0x82, 0xaf, 0x0e, 0x99,
+  0x41, 0x45, 0x3f, 0xf6, 0x7e, 0xaf, 0x04, 0x37, 0x47, 0x45, 0x3f, 0xf6,
+  0x7a, 0xaf, 0x0b, 0xeb, 0x05, 0x07, 0x79, 0x68, 0x02, 0x9c, 0x00, 0xee,
+  0x10, 0x1a, 0x5b, 0xf8, 0x06, 0x10, 0x04, 0xeb, 0x05, 0x0e, 0x01, 0xee,
+  0x10, 0x1a, 0x0d, 0x99, 0x5e, 0xf8, 0x04, 0x3c, 0x5b, 0xf8, 0x01, 0x10,
+  0x03, 0xee, 0x10, 0x3a, 0x06, 0xee, 0x10, 0x1a, 0x0b, 0x99, 0x63, 0x59,
+  0x03, 0x9c, 0x09, 0x68, 0x04, 0xeb, 0x05, 0x0c, 0x05, 0xee, 0x10, 0x3a,
+  0x5c, 0xf8, 0x04, 0x3c, 0x07, 0xee, 0x10, 0x1a, 0x0e, 0x99, 0x00, 0xee,
+  0x90, 0x3a, 0x5b, 0xf8, 0x01, 0x10, 0x63, 0x59, 0x03, 0xee, 0x90, 0x1a,
+  0x02, 0xee, 0x90, 0x3a, 0x21, 0xee, 0x03, 0x2a, 0x26, 0xee, 0x05, 0x4a,
+  0x32, 0xee, 0x04, 0x2a, 0x27, 0xee, 0x20, 0x4a, 0x63, 0xee, 0xa2, 0x1a,
+  0x0a, 0x99, 0x34, 0xee, 0x21, 0x4a, 0x72, 0xee, 0x04, 0x1a, 0x51, 0xf8,
+  0x05, 0x90, 0x70, 0xee, 0x21, 0x4a, 0x40, 0x45, 0x14, 0xee, 0x90, 0x0a,
+  0x78, 0x60, 0x98, 0xbf, 0x45, 0x45, 0x3f, 0xf6, 0x34, 0xaf, 0x26, 0xee,
+  0x03, 0x3a, 0x21, 0xee, 0x05, 0x1a, 0x33, 0xee, 0x41, 0x1a, 0x5b, 0xf8,
+  0x05, 0x00, 0x23, 0xee, 0xa0, 0x3a, 0x27, 0xee, 0x22, 0x6a, 0x33, 0xee,
+  0x46, 0x3a, 0x05, 0xee, 0x10, 0x0a, 0x31, 0xee, 0x03, 0x6a, 0x35, 0xee,
+  0x06, 0x7a, 0x17, 0xee, 0x10, 0x0a, 0x30, 0xee, 0x61, 0x0a, 0x09, 0x90,
+  0x10, 0xee, 0x10, 0x0a, 0x07, 0x90, 0x0a, 0x98, 0x08, 0x92, 0x35, 0xee,
+  0x46, 0x0a, 0x09, 0x99, 0x43, 0x19, 0x10, 0xee, 0x10, 0x7a, 0x00, 0xee,
+  0x10, 0x9a, 0x31, 0xee, 0x43, 0x1a, 0x53, 0xf8, 0x04, 0x2c, 0x30, 0xee,
+  0x41, 0x3a, 0x31, 0xee, 0x00, 0x0a, 0x4b, 0xf8, 0x05, 0x10, 0x07, 0x99,
+  0x13, 0xee, 0x10, 0x9a, 0x30, 0x46, 0x10, 0xee, 0x10, 0x6a, 0x03, 0xee,
+  0x10, 0x2a, 0x32, 0xee, 0x44, 0x2a, 0xce, 0xf8, 0x00, 0x10, 0xc3, 0xf8,
+  0x00, 0x90, 0xcc, 0xf8, 0x00, 0x60, 0x06, 0x46, 0x01, 0x98, 0x0e, 0x99,
+  0x33, 0xee, 0x02, 0x4a, 0x14, 0xee, 0x10, 0x2a, 0x01, 0x44, 0x4e, 0xf8,
+  0x04, 0x7c, 0x43, 0xf8, 0x04, 0x2c, 0x08, 0x9a, 0x0e, 0x91, 0x0b, 0x99,
+  0x33, 0xee, 0x42, 0x0a, 0x01, 0x44, 0x0b, 0x91, 0xdd, 0xe9, 0x0c, 0x01,
+  0x10, 0xee, 0x10, 0x4a, 0x08, 0x35, 0x01, 0x3a, 0x01, 0x44, 0x06, 0x44,
+  0x4c, 0xf8, 0x04, 0x4c, 0x0d, 0x91, 0x7f, 0xf4, 0x33, 0xaf, 0xe4, 0xe6,
+  0x05, 0xf1, 0x0c, 0x02, 0x42, 0x45, 0x3f, 0xf6, 0xce, 0xae, 0x5b, 0xf8,
+  0x01, 0x30, 0x30, 0xee, 0x41, 0x0a, 0x02, 0xee, 0x10, 0x3a, 0x5b, 0xf8,
+  0x02, 0x30, 0x58, 0x44, 0x03, 0xee, 0x10, 0x3a, 0x32, 0xee, 0x43, 0x4a,
+  0x14, 0xee, 0x10, 0x3a, 0x4b, 0xf8, 0x02, 0x30, 0x10, 0xee, 0x10, 0x2a,
+  0x32, 0xee, 0x03, 0x0a, 0x59, 0x44, 0x02, 0x60, 0x10, 0xee, 0x10, 0x0a,
+  0x08, 0x60, 0x0f, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6b, 0x01, 0x46,
+  0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x41, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51,
+  0x59, 0x58, 0xe1, 0xb3, 0x49, 0xf6, 0xc5, 0x58, 0xca, 0x00, 0xc8, 0xf2,
+  0x1c, 0x18, 0x2f, 0xd0, 0xd0, 0xf8, 0xa8, 0xe1, 0x03, 0xf5, 0x50, 0x53,
+  0x40, 0xf2, 0x93, 0x1c, 0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2,
+  0x04, 0x44, 0x00, 0xbf, 0x74, 0x45, 0x25, 0xd8, 0x65, 0x1c, 0x75, 0x45,
+  0x22, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x1f, 0xd8, 0xe5, 0x1c, 0x75, 0x45,
+  0x1c, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x13, 0xf8, 0x04, 0x6b, 0x85, 0xea,
+  0x08, 0x05, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x03, 0x7c, 0x75, 0x40,
+  0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x02, 0x1c, 0x7d, 0x40, 0x05, 0xfb,
+  0x0c, 0xf5, 0x69, 0x40, 0x01, 0xfb, 0x0c, 0xf8, 0x04, 0x3a, 0x04, 0xf1,
+  0x04, 0x04, 0xdb, 0xd1, 0x40, 0x46, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0xbf,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6b, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x0a, 0x46, 0x00, 0x23, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x6b, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0x2d, 0xed, 0x02, 0x8b, 0x86, 0xb0, 0xd0, 0xf8, 0x08, 0x90,
+  0x4f, 0xf4, 0x50, 0x52, 0xd9, 0xf8, 0x78, 0xa1, 0x5a, 0xf8, 0x02, 0xe0,
+  0xbe, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0x18, 0x81, 0x01, 0x29, 0xc0, 0xf2,
+  0x15, 0x81, 0x47, 0xf2, 0x04, 0x42, 0x52, 0x44, 0x01, 0x92, 0x45, 0xf2,
+  0x04, 0x42, 0x52, 0x44, 0x00, 0x92, 0x47, 0xf2, 0x14, 0x42, 0x52, 0x44,
+  0x05, 0x92, 0x48, 0xf2, 0x14, 0x02, 0xd9, 0xf8, 0xb8, 0x81, 0x52, 0x44,
+  0x0a, 0xf5, 0x50, 0x5b, 0x04, 0x92, 0x00, 0x22, 0xb6, 0xee, 0x00, 0x8a,
+  0x03, 0x92, 0x02, 0x91, 0x0e, 0xeb, 0xde, 0x71, 0xbe, 0xf1, 0x02, 0x0f,
+  0x4f, 0xea, 0x61, 0x01, 0x2a, 0xda, 0x02, 0x22, 0x04, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x99, 0xf8, 0x68, 0x10, 0x00, 0x29, 0x02, 0x99, 0x40, 0xf0,
+  0xeb, 0x80, 0x9b, 0xed, 0x01, 0x0a, 0x9b, 0xed, 0x02, 0x1a, 0xdb, 0xf8,
+  0x00, 0xe0, 0x20, 0x46, 0x30, 0xee, 0x41, 0x2a, 0x30, 0xee, 0x01, 0x0a,
+  0xbe, 0xf1, 0x04, 0x0f, 0x8b, 0xed, 0x01, 0x0a, 0x8b, 0xed, 0x02, 0x2a,
+  0x5a, 0xda, 0x01, 0x9a, 0x92, 0xed, 0x00, 0x1a, 0x03, 0x9a, 0x20, 0xee,
+  0x01, 0x0a, 0x01, 0x32, 0x03, 0x92, 0x8a, 0x42, 0x00, 0x9a, 0x82, 0xed,
+  0x00, 0x0a, 0xcf, 0xd1, 0xca, 0xe0, 0x00, 0xbf, 0x00, 0x26, 0x00, 0x22,
+  0x06, 0xe0, 0x00, 0xbf, 0x5d, 0x10, 0x01, 0x36, 0x8e, 0x42, 0x42, 0xea,
+  0x05, 0x02, 0xca, 0xd0, 0x45, 0xf2, 0x04, 0x43, 0x03, 0xeb, 0xc6, 0x03,
+  0x43, 0x45, 0x00, 0xf2, 0xbf, 0x80, 0x43, 0xf2, 0x04, 0x47, 0x07, 0xeb,
+  0xc2, 0x05, 0x45, 0x45, 0x00, 0xf2, 0xb8, 0x80, 0xf4, 0x00, 0x5a, 0xf8,
+  0x03, 0x70, 0x45, 0xf2, 0x08, 0x43, 0x23, 0x44, 0x43, 0x45, 0x4a, 0xf8,
+  0x05, 0x70, 0x00, 0xf2, 0xad, 0x80, 0xd7, 0x00, 0x43, 0xf2, 0x08, 0x45,
+  0x3d, 0x44, 0x45, 0x45, 0x00, 0xf2, 0xa6, 0x80, 0x5a, 0xf8, 0x03, 0x30,
+  0x4a, 0xf8, 0x05, 0x30, 0x0b, 0x46, 0x00, 0xbf, 0x12, 0xea, 0x63, 0x0f,
+  0xd0, 0xd0, 0x82, 0xea, 0x63, 0x02, 0x12, 0xea, 0xa3, 0x0f, 0x0f, 0xd0,
+  0x82, 0xea, 0xa3, 0x02, 0x12, 0xea, 0xe3, 0x0f, 0x0c, 0xd0, 0x82, 0xea,
+  0xe3, 0x04, 0x1d, 0x11, 0x84, 0xea, 0x23, 0x12, 0x14, 0xea, 0x23, 0x1f,
+  0x2b, 0x46, 0xe9, 0xd1, 0x22, 0x46, 0xbc, 0xe7, 0x9d, 0x10, 0xba, 0xe7,
+  0xdd, 0x10, 0xb8, 0xe7, 0x4f, 0xea, 0x9e, 0x01, 0x01, 0x29, 0x4f, 0xf0,
+  0x01, 0x01, 0x88, 0xbf, 0x4f, 0xea, 0x9e, 0x01, 0x4f, 0xea, 0x81, 0x0c,
+  0x6f, 0xf0, 0x04, 0x01, 0x01, 0xea, 0x8e, 0x01, 0x01, 0xf5, 0x50, 0x52,
+  0x00, 0x23, 0x43, 0xf2, 0x0c, 0x45, 0x29, 0x1d, 0x41, 0x45, 0x98, 0xbf,
+  0x42, 0x45, 0x6b, 0xd8, 0x47, 0xf2, 0x14, 0x44, 0x1f, 0x19, 0x47, 0x45,
+  0x66, 0xd8, 0x17, 0x1f, 0x47, 0x45, 0x63, 0xd8, 0x04, 0x39, 0x41, 0x45,
+  0x60, 0xd8, 0x48, 0xf2, 0x14, 0x01, 0x19, 0x44, 0x41, 0x45, 0x5b, 0xd8,
+  0x5a, 0xf8, 0x02, 0x40, 0x0a, 0xeb, 0x05, 0x01, 0x4f, 0x68, 0x01, 0xee,
+  0x10, 0x4a, 0x05, 0x9c, 0x00, 0xee, 0x10, 0x7a, 0xe7, 0x58, 0x0a, 0xeb,
+  0x02, 0x04, 0x02, 0xee, 0x10, 0x7a, 0x54, 0xf8, 0x04, 0x7c, 0x04, 0x9e,
+  0x04, 0xee, 0x10, 0x7a, 0x5a, 0xf8, 0x05, 0x70, 0x30, 0xee, 0x41, 0x3a,
+  0x05, 0xee, 0x10, 0x7a, 0xf7, 0x58, 0x34, 0xee, 0x45, 0x6a, 0x30, 0xee,
+  0x01, 0x0a, 0x26, 0xee, 0x08, 0x6a, 0x00, 0xee, 0x90, 0x7a, 0x20, 0xee,
+  0x08, 0x0a, 0x22, 0xee, 0x06, 0x7a, 0x20, 0xee, 0x80, 0x1a, 0x23, 0xee,
+  0x08, 0x3a, 0x37, 0xee, 0x01, 0x1a, 0x35, 0xee, 0x04, 0x4a, 0x22, 0xee,
+  0x00, 0x0a, 0x26, 0xee, 0x20, 0x2a, 0x33, 0xee, 0x01, 0x7a, 0x24, 0xee,
+  0x08, 0x4a, 0x30, 0xee, 0x42, 0x0a, 0x17, 0xee, 0x10, 0x7a, 0x34, 0xee,
+  0x00, 0x2a, 0x4f, 0x60, 0x12, 0xee, 0x10, 0x7a, 0x34, 0xee, 0x40, 0x0a,
+  0x0f, 0x60, 0x10, 0xee, 0x10, 0x1a, 0x31, 0xee, 0x43, 0x0a, 0x04, 0x33,
+  0x44, 0xf8, 0x04, 0x1c, 0x10, 0xee, 0x10, 0x1a, 0x08, 0x35, 0x9c, 0x45,
+  0xa2, 0xf1, 0x08, 0x02, 0x21, 0x60, 0x98, 0xd1, 0x9b, 0xed, 0x01, 0x0a,
+  0x02, 0x99, 0x26, 0xe7, 0x06, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x48, 0x46, 0x02, 0x21, 0x06, 0xb0, 0xbd, 0xec,
+  0x02, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x12, 0x6c, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x41, 0xd0, 0xf8, 0x78, 0x31,
+  0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3, 0x49, 0xf6, 0xc5, 0x58,
+  0x8a, 0x00, 0xc8, 0xf2, 0x1c, 0x18, 0x2f, 0xd0, 0xd0, 0xf8, 0xa8, 0xe1,
+  0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c, 0xc0, 0xf2, 0x00, 0x1c,
+  0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x00, 0xbf, 0x74, 0x45, 0x25, 0xd8,
+  0x65, 0x1c, 0x75, 0x45, 0x22, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x1f, 0xd8,
+  0xe5, 0x1c, 0x75, 0x45, 0x1c, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x13, 0xf8,
+  0x04, 0x6b, 0x85, 0xea, 0x08, 0x05, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8,
+  0x03, 0x7c, 0x75, 0x40, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x02, 0x1c,
+  0x7d, 0x40, 0x05, 0xfb, 0x0c, 0xf5, 0x69, 0x40, 0x01, 0xfb, 0x0c, 0xf8,
+  0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04, 0xdb, 0xd1, 0x40, 0x46, 0xbd, 0xe8,
+  0xf0, 0x81, 0x00, 0xbf, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0xbd, 0xe8, 0xf0, 0x81, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6c, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x01, 0x23, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6c, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x85, 0xb0, 0x82, 0x68, 0x86, 0x46, 0xd2, 0xf8,
+  0x78, 0x71, 0x4f, 0xf4, 0x50, 0x50, 0x57, 0xf8, 0x00, 0xc0, 0xbc, 0xf1,
+  0x00, 0x0f, 0x6f, 0xd0, 0x01, 0x29, 0x6d, 0xdb, 0xd2, 0xf8, 0xb0, 0x61,
+  0x45, 0xf2, 0x04, 0x40, 0xcd, 0xe9, 0x03, 0x12, 0x38, 0x44, 0x07, 0xf5,
+  0x50, 0x52, 0x4f, 0xf0, 0x00, 0x08, 0x43, 0xf2, 0x04, 0x49, 0x45, 0xf2,
+  0x04, 0x4a, 0x45, 0xf2, 0x06, 0x4b, 0x02, 0x90, 0x01, 0x92, 0xbc, 0xf1,
+  0x01, 0x0f, 0x3d, 0xdb, 0x00, 0x20, 0x00, 0x21, 0x06, 0xe0, 0x00, 0xbf,
+  0x5c, 0x10, 0x01, 0x30, 0x60, 0x45, 0x41, 0xea, 0x04, 0x01, 0x33, 0xd0,
+  0x0a, 0xeb, 0x80, 0x03, 0xb3, 0x42, 0x4d, 0xd8, 0x09, 0xeb, 0x81, 0x04,
+  0xb4, 0x42, 0x49, 0xd8, 0x85, 0x00, 0xfa, 0x5a, 0x05, 0xeb, 0x0b, 0x03,
+  0xb3, 0x42, 0x3a, 0x53, 0x42, 0xd8, 0x8a, 0x00, 0x43, 0xf2, 0x06, 0x44,
+  0x15, 0x19, 0xb5, 0x42, 0x3c, 0xd8, 0xfa, 0x5a, 0x63, 0x46, 0x7a, 0x53,
+  0x11, 0xea, 0x63, 0x0f, 0xde, 0xd0, 0x81, 0xea, 0x63, 0x01, 0x11, 0xea,
+  0xa3, 0x0f, 0x0f, 0xd0, 0x81, 0xea, 0xa3, 0x01, 0x11, 0xea, 0xe3, 0x0f,
+  0x0c, 0xd0, 0x81, 0xea, 0xe3, 0x05, 0x1c, 0x11, 0x85, 0xea, 0x23, 0x11,
+  0x15, 0xea, 0x23, 0x1f, 0x23, 0x46, 0xe9, 0xd1, 0x29, 0x46, 0xca, 0xe7,
+  0x9c, 0x10, 0xc8, 0xe7, 0xdc, 0x10, 0xc6, 0xe7, 0x70, 0x46, 0x61, 0x46,
+  0x01, 0x22, 0x74, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x98, 0x03, 0x99,
+  0x90, 0xf8, 0x68, 0x00, 0x01, 0x9a, 0x68, 0xb9, 0x08, 0xf1, 0x01, 0x08,
+  0x90, 0x88, 0x88, 0x45, 0x02, 0x99, 0x08, 0x80, 0x06, 0xd0, 0xd2, 0xf8,
+  0x00, 0xc0, 0xa6, 0x46, 0xbc, 0xf1, 0x01, 0x0f, 0xa8, 0xda, 0xe5, 0xe7,
+  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf, 0x04, 0x98, 0x02, 0x21,
+  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8,
+  0x4c, 0xc0, 0x86, 0x46, 0x80, 0x68, 0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x0c,
+  0x08, 0xd3, 0xde, 0xf8, 0x10, 0x30, 0x9c, 0x45, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x8e, 0xb0,
+  0x02, 0x29, 0x03, 0xda, 0x0e, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0xd0, 0xf8, 0x78, 0xc1, 0xd0, 0xf8, 0xb0, 0x31, 0x57, 0x00, 0x02, 0x26,
+  0x00, 0x2e, 0x00, 0xf0, 0x99, 0x80, 0x40, 0xf3, 0x89, 0x80, 0x07, 0x90,
+  0x91, 0xfb, 0xf6, 0xf0, 0x72, 0x08, 0x01, 0x24, 0xb5, 0x00, 0x78, 0x43,
+  0x01, 0x2a, 0x88, 0xbf, 0x74, 0x08, 0x72, 0x00, 0xcd, 0xe9, 0x00, 0x75,
+  0x08, 0x90, 0x0c, 0xeb, 0x46, 0x00, 0x00, 0x27, 0x43, 0xf2, 0x06, 0x4a,
+  0x0a, 0x90, 0x04, 0x91, 0x09, 0x92, 0xcd, 0xe9, 0x02, 0x46, 0x48, 0xf6,
+  0x10, 0x45, 0x06, 0x97, 0xcd, 0xf8, 0x14, 0xa0, 0x02, 0xeb, 0x0a, 0x00,
+  0x02, 0x38, 0x40, 0xf0, 0x02, 0x09, 0x99, 0x45, 0x9c, 0xbf, 0x9d, 0x42,
+  0x98, 0x42, 0x67, 0xd8, 0x05, 0xf5, 0x80, 0x60, 0x98, 0x42, 0x98, 0xbf,
+  0x9a, 0x45, 0x61, 0xd8, 0xaa, 0xf1, 0x02, 0x00, 0x3c, 0xf9, 0x09, 0x10,
+  0x0b, 0x94, 0x0d, 0x90, 0x4f, 0xea, 0x61, 0x0e, 0x0a, 0x99, 0x3c, 0xf9,
+  0x05, 0x00, 0x01, 0xeb, 0x0a, 0x08, 0x38, 0xf9, 0x02, 0x6c, 0x0c, 0xeb,
+  0x05, 0x01, 0xb1, 0xf9, 0x00, 0x14, 0x00, 0xfb, 0x0e, 0xf4, 0x76, 0x10,
+  0x11, 0xfb, 0x06, 0x47, 0x3c, 0xf9, 0x0a, 0x40, 0xff, 0x13, 0xe3, 0x46,
+  0x07, 0xeb, 0x64, 0x0c, 0x1a, 0x46, 0x0c, 0xf3, 0x0f, 0x03, 0x0c, 0x93,
+  0x0d, 0x9b, 0xdc, 0x46, 0x93, 0x46, 0x93, 0x42, 0x0c, 0x9a, 0x2c, 0xf8,
+  0x0a, 0x20, 0x37, 0xd8, 0x70, 0x43, 0x01, 0xfb, 0x1e, 0x00, 0x0c, 0xeb,
+  0x0a, 0x01, 0x31, 0xf9, 0x02, 0x3c, 0xc0, 0x13, 0x00, 0xeb, 0x63, 0x06,
+  0x62, 0x10, 0x06, 0xf3, 0x0f, 0x06, 0x21, 0xf8, 0x02, 0x6c, 0xd1, 0x1b,
+  0xc0, 0xeb, 0x63, 0x00, 0x01, 0xf3, 0x0f, 0x01, 0x00, 0xf3, 0x0f, 0x00,
+  0x2c, 0xf8, 0x09, 0x10, 0x28, 0xf8, 0x02, 0x0c, 0x0b, 0x9c, 0x08, 0x98,
+  0x09, 0x9a, 0x01, 0x3c, 0x0a, 0xf1, 0x04, 0x0a, 0x05, 0x44, 0x5b, 0x46,
+  0xa2, 0xd1, 0x03, 0x9e, 0x06, 0x9f, 0x04, 0x99, 0x01, 0x98, 0xdd, 0xf8,
+  0x14, 0xa0, 0x37, 0x44, 0x02, 0x9c, 0x8f, 0x42, 0x82, 0x44, 0x92, 0xdb,
+  0x07, 0x98, 0x00, 0x9f, 0x01, 0xe0, 0x00, 0xbf, 0x72, 0x00, 0x8a, 0x42,
+  0x16, 0x46, 0x7f, 0xf7, 0x6d, 0xaf, 0x61, 0xe7, 0x07, 0x98, 0x02, 0x21,
+  0x0e, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0xbf,
+  0x04, 0x21, 0x0e, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x12, 0x6d, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x41, 0xd0, 0xf8, 0x78, 0x31,
+  0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3, 0x49, 0xf6, 0xc5, 0x58,
+  0x8a, 0x00, 0xc8, 0xf2, 0x1c, 0x18, 0x2f, 0xd0, 0xd0, 0xf8, 0xa8, 0xe1,
+  0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c, 0xc0, 0xf2, 0x00, 0x1c,
+  0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x00, 0xbf, 0x74, 0x45, 0x25, 0xd8,
+  0x65, 0x1c, 0x75, 0x45, 0x22, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x1f, 0xd8,
+  0xe5, 0x1c, 0x75, 0x45, 0x1c, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x13, 0xf8,
+  0x04, 0x6b, 0x85, 0xea, 0x08, 0x05, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8,
+  0x03, 0x7c, 0x75, 0x40, 0x05, 0xfb, 0x0c, 0xf5, 0x13, 0xf8, 0x02, 0x1c,
+  0x7d, 0x40, 0x05, 0xfb, 0x0c, 0xf5, 0x69, 0x40, 0x01, 0xfb, 0x0c, 0xf8,
+  0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04, 0xdb, 0xd1, 0x40, 0x46, 0xbd, 0xe8,
+  0xf0, 0x81, 0x00, 0xbf, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0xbd, 0xe8, 0xf0, 0x81, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6d, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x0a, 0x46, 0x01, 0x23, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6d, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf,
+  0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x8f, 0xb0, 0x83, 0x68, 0x0a, 0x90, 0xd3, 0xf8,
+  0x78, 0x81, 0x4f, 0xf4, 0x50, 0x50, 0x58, 0xf8, 0x00, 0x60, 0x00, 0x2e,
+  0x00, 0xf0, 0x10, 0x81, 0x01, 0x29, 0xc0, 0xf2, 0x0d, 0x81, 0x45, 0xf2,
+  0x04, 0x40, 0x40, 0x44, 0x03, 0x90, 0x08, 0xf5, 0x50, 0x50, 0xd3, 0xf8,
+  0xb0, 0x71, 0x04, 0x90, 0x08, 0xf1, 0x02, 0x00, 0x02, 0x90, 0x00, 0x20,
+  0x43, 0xf2, 0x04, 0x49, 0x45, 0xf2, 0x04, 0x4a, 0x43, 0xf2, 0x06, 0x4b,
+  0x45, 0xf2, 0x06, 0x4c, 0x06, 0x90, 0x09, 0x93, 0x05, 0x91, 0x06, 0xeb,
+  0xd6, 0x71, 0x02, 0x2e, 0x4f, 0xea, 0x61, 0x01, 0x24, 0xda, 0x0a, 0x98,
+  0x02, 0x22, 0xff, 0xf7, 0xfe, 0xff, 0x09, 0x9b, 0x05, 0x99, 0x93, 0xf8,
+  0x68, 0x00, 0x45, 0xf2, 0x06, 0x4c, 0x00, 0x28, 0x40, 0xf0, 0xe2, 0x80,
+  0x04, 0x9d, 0xb5, 0xf9, 0x06, 0x00, 0xb5, 0xf9, 0x04, 0x60, 0x32, 0x1a,
+  0x30, 0x44, 0x2e, 0x68, 0x22, 0xf3, 0x4f, 0x02, 0x20, 0xf3, 0x4f, 0x00,
+  0x04, 0x2e, 0xea, 0x80, 0xa8, 0x80, 0x4d, 0xda, 0x06, 0x9a, 0x01, 0x32,
+  0x06, 0x92, 0x8a, 0x42, 0x03, 0x9a, 0x10, 0x80, 0xd5, 0xd1, 0xc9, 0xe0,
+  0x00, 0x20, 0x00, 0x22, 0x06, 0xe0, 0x00, 0xbf, 0x5d, 0x10, 0x01, 0x30,
+  0x88, 0x42, 0x42, 0xea, 0x05, 0x02, 0xd0, 0xd0, 0x0a, 0xeb, 0x80, 0x03,
+  0xbb, 0x42, 0x00, 0xf2, 0xbf, 0x80, 0x09, 0xeb, 0x82, 0x05, 0xbd, 0x42,
+  0x00, 0xf2, 0xba, 0x80, 0x84, 0x00, 0x38, 0xf8, 0x03, 0x60, 0x04, 0xeb,
+  0x0c, 0x03, 0xbb, 0x42, 0x28, 0xf8, 0x05, 0x60, 0x00, 0xf2, 0xb0, 0x80,
+  0x96, 0x00, 0x06, 0xeb, 0x0b, 0x05, 0xbd, 0x42, 0x00, 0xf2, 0xaa, 0x80,
+  0x38, 0xf8, 0x03, 0x30, 0x28, 0xf8, 0x05, 0x30, 0x0b, 0x46, 0x00, 0xbf,
+  0x12, 0xea, 0x63, 0x0f, 0xd6, 0xd0, 0x82, 0xea, 0x63, 0x02, 0x12, 0xea,
+  0xa3, 0x0f, 0x0f, 0xd0, 0x82, 0xea, 0xa3, 0x02, 0x12, 0xea, 0xe3, 0x0f,
+  0x0c, 0xd0, 0x82, 0xea, 0xe3, 0x04, 0x1d, 0x11, 0x84, 0xea, 0x23, 0x12,
+  0x14, 0xea, 0x23, 0x1f, 0x2b, 0x46, 0xe9, 0xd1, 0x22, 0x46, 0xc2, 0xe7,
+  0x9d, 0x10, 0xc0, 0xe7, 0xdd, 0x10, 0xbe, 0xe7, 0xb1, 0x08, 0x01, 0x29,
+  0x4f, 0xf0, 0x01, 0x01, 0x88, 0xbf, 0xb1, 0x08, 0x4f, 0xf4, 0x50, 0x50,
+  0x01, 0x96, 0x00, 0xeb, 0x46, 0x02, 0x02, 0x98, 0x22, 0xf0, 0x02, 0x02,
+  0x10, 0x44, 0x00, 0x23, 0x0b, 0x92, 0x0e, 0x90, 0xa3, 0xeb, 0x81, 0x00,
+  0x48, 0xf6, 0x12, 0x44, 0x43, 0xf2, 0x08, 0x45, 0x07, 0x90, 0x08, 0x97,
+  0x0b, 0x98, 0xc1, 0x18, 0x8e, 0x1c, 0xbe, 0x42, 0x68, 0xd8, 0xae, 0x1c,
+  0xbe, 0x42, 0x65, 0xd8, 0x04, 0xf5, 0x80, 0x66, 0xbe, 0x42, 0x61, 0xd8,
+  0xb9, 0x42, 0x98, 0xbf, 0xbd, 0x42, 0x5d, 0xd8, 0x0e, 0x98, 0x08, 0xeb,
+  0x05, 0x01, 0xc2, 0x5e, 0xb1, 0xf9, 0x02, 0xb0, 0x18, 0x44, 0x0c, 0x91,
+  0x0b, 0xeb, 0x02, 0x0a, 0x11, 0x46, 0x08, 0xeb, 0x04, 0x02, 0x30, 0xf9,
+  0x02, 0xec, 0x38, 0xf9, 0x05, 0x90, 0xb2, 0xf9, 0x00, 0x24, 0x4f, 0xea,
+  0xaa, 0x0a, 0x0d, 0x90, 0xae, 0xeb, 0x09, 0x06, 0x38, 0xf9, 0x04, 0x00,
+  0x0a, 0xfb, 0x02, 0xfc, 0xb7, 0x10, 0x17, 0xfb, 0x00, 0xc6, 0x4f, 0xea,
+  0xe6, 0x3c, 0xab, 0xeb, 0x01, 0x0b, 0x0a, 0xfb, 0x00, 0xf0, 0x0c, 0xeb,
+  0xab, 0x06, 0x0c, 0x99, 0x07, 0xfb, 0x12, 0x00, 0x06, 0xf3, 0x0f, 0x06,
+  0x4e, 0x80, 0x09, 0xeb, 0x0e, 0x01, 0xc2, 0x13, 0x02, 0xeb, 0xa1, 0x02,
+  0x89, 0x10, 0xa1, 0xeb, 0xe0, 0x30, 0x0d, 0x99, 0x02, 0xf3, 0x0f, 0x02,
+  0x00, 0xf3, 0x0f, 0x00, 0x28, 0xf8, 0x05, 0x20, 0x21, 0xf8, 0x02, 0x0c,
+  0xac, 0xeb, 0xab, 0x00, 0x0e, 0x99, 0x00, 0xf3, 0x0f, 0x00, 0xc8, 0x52,
+  0x07, 0x98, 0x08, 0x9f, 0x04, 0x3b, 0x45, 0xf2, 0x04, 0x4a, 0x43, 0xf2,
+  0x04, 0x49, 0x45, 0xf2, 0x06, 0x4c, 0x43, 0xf2, 0x06, 0x4b, 0x02, 0x34,
+  0x98, 0x42, 0x05, 0xf1, 0x04, 0x05, 0x9b, 0xd1, 0x04, 0x98, 0x05, 0x99,
+  0x80, 0x88, 0x01, 0x9e, 0x2e, 0xe7, 0x00, 0xbf, 0x0f, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x09, 0x98, 0x02, 0x21, 0x0f, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x6d, 0x01, 0x46, 0x80, 0x68,
+  0x01, 0xab, 0x9a, 0x1a, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0xd0, 0xf8, 0x78, 0xc1, 0x80, 0x46, 0x4f, 0xf4, 0x50, 0x50,
+  0x5c, 0xf8, 0x00, 0x90, 0xb9, 0xf1, 0x00, 0x0f, 0x52, 0xd0, 0x49, 0xf6,
+  0xc5, 0x50, 0x5f, 0xea, 0x49, 0x07, 0xc8, 0xf2, 0x1c, 0x10, 0x4c, 0xd0,
+  0xd8, 0xf8, 0xa8, 0xb1, 0x3e, 0x1f, 0x16, 0xf1, 0x04, 0x0f, 0x37, 0xd8,
+  0x0c, 0xf5, 0x50, 0x55, 0x40, 0xf2, 0x93, 0x1a, 0x27, 0xf0, 0x03, 0x0e,
+  0xc0, 0xf2, 0x00, 0x1a, 0x05, 0x35, 0x43, 0xf2, 0x04, 0x46, 0x77, 0x46,
+  0x5e, 0x45, 0x33, 0xd8, 0x71, 0x1c, 0x59, 0x45, 0x30, 0xd8, 0xb1, 0x1c,
+  0x59, 0x45, 0x2d, 0xd8, 0xf1, 0x1c, 0x59, 0x45, 0x2a, 0xd8, 0x15, 0xf8,
+  0x01, 0x1c, 0x15, 0xf8, 0x04, 0x3b, 0x48, 0x40, 0x00, 0xfb, 0x0a, 0xf0,
+  0x15, 0xf8, 0x03, 0x4c, 0x58, 0x40, 0x00, 0xfb, 0x0a, 0xf0, 0x15, 0xf8,
+  0x02, 0x2c, 0x60, 0x40, 0x00, 0xfb, 0x0a, 0xf0, 0x50, 0x40, 0x00, 0xfb,
+  0x0a, 0xf0, 0x04, 0x3f, 0x06, 0xf1, 0x04, 0x06, 0xdc, 0xd1, 0x43, 0xf2,
+  0x04, 0x41, 0x0e, 0xeb, 0x01, 0x07, 0x5f, 0xea, 0xc9, 0x71, 0x06, 0xd1,
+  0x0f, 0xe0, 0x00, 0xbf, 0x43, 0xf2, 0x04, 0x47, 0x5f, 0xea, 0xc9, 0x71,
+  0x09, 0xd0, 0x5f, 0x45, 0x02, 0xd8, 0x7b, 0x1c, 0x5b, 0x45, 0x07, 0xd9,
+  0x40, 0x46, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x1c, 0xf8, 0x07, 0x10, 0x1c, 0xf8, 0x03, 0x20,
+  0x48, 0x40, 0x40, 0xf2, 0x93, 0x11, 0xc0, 0xf2, 0x00, 0x11, 0x48, 0x43,
+  0x50, 0x40, 0x48, 0x43, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00,
+  0x60, 0x11, 0x00, 0x00, 0x98, 0x15, 0x00, 0x00, 0x5c, 0x16, 0x00, 0x00,
+  0x94, 0x16, 0x00, 0x00, 0xee, 0x17, 0x00, 0x00, 0x20, 0x1c, 0x00, 0x00,
+  0xe4, 0x1c, 0x00, 0x00, 0x1c, 0x1d, 0x00, 0x00, 0x6e, 0x1e, 0x00, 0x00,
+  0x9c, 0x21, 0x00, 0x00, 0x60, 0x22, 0x00, 0x00, 0x98, 0x22, 0x00, 0x00,
+  0x3c, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x38, 0x26, 0x00, 0x00,
+  0x7a, 0x27, 0x00, 0x00, 0x14, 0x29, 0x00, 0x00, 0xd8, 0x29, 0x00, 0x00,
+  0x10, 0x2a, 0x00, 0x00, 0x92, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xde, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x07, 0x00, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x72, 0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x72, 0x32, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x72, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x62,
+  0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x73, 0x75, 0x6d, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x72, 0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x71, 0x31, 0x35, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x74,
   0x65, 0x78, 0x74, 0x00, 0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73,
   0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00,
   0x1a, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78,
   0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68,
-  0x5f, 0x69, 0x64, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
-  0x69, 0x5f, 0x75, 0x69, 0x32, 0x66, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f,
-  0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x66, 0x6d, 0x75, 0x6c, 0x00, 0x00,
-  0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x66, 0x61,
-  0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
-  0x69, 0x5f, 0x66, 0x73, 0x75, 0x62, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x5f, 0x69, 0x64, 0x00, 0x0b, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75,
+  0x6e, 0x63, 0x23, 0x33, 0x00, 0x00, 0x0c, 0x00, 0x5f, 0x5f, 0x61, 0x65,
+  0x61, 0x62, 0x69, 0x5f, 0x69, 0x32, 0x64, 0x00, 0x0d, 0x00, 0x5f, 0x5f,
+  0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x6d, 0x75, 0x6c, 0x00, 0x00,
+  0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x64,
+  0x69, 0x76, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
+  0x69, 0x5f, 0x64, 0x61, 0x64, 0x64, 0x00, 0x00, 0x0c, 0x00, 0x5f, 0x5f,
+  0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x32, 0x66, 0x00, 0x0f, 0x00,
+  0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70,
+  0x67, 0x65, 0x00, 0x00, 0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
+  0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70, 0x6c, 0x74, 0x00, 0x00, 0x0f, 0x00,
+  0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70,
+  0x75, 0x6e, 0x00, 0x00, 0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
+  0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70, 0x6c, 0x65, 0x00, 0x00, 0x0d, 0x00,
+  0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x32, 0x69, 0x7a,
+  0x00, 0x00, 0x0b, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63,
+  0x23, 0x38, 0x00, 0x00, 0x0c, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75,
+  0x6e, 0x63, 0x23, 0x31, 0x32, 0x00, 0x0c, 0x00, 0x61, 0x6f, 0x74, 0x5f,
+  0x66, 0x75, 0x6e, 0x63, 0x23, 0x31, 0x39, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00,
+  0x4e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x5a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x84, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa4, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xb8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xe8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x6c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x98, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xc4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xf0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x44, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x74, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x7c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x8c, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xa0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb8, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xcc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x88, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x98, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xa0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xc0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd4, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xe0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xec, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x16, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x36, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x4a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x56, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x66, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x7a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x82, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x92, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xa6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xae, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xbe, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xd2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xda, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xea, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xfe, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x16, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x56, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x82, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x8a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xae, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xb6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xd6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xe2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x06, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x32, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x3a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x5e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x76, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x8a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xb2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xba, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xca, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xda, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xe2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x32, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x52, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x5a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x66, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x9e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xae, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xd6, 0x0d, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
+  0xea, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x44, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x5c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6e, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x7c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x9e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0xc2, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xd6, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xe8, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0xfe, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x1e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x64, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x8e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9c, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x52, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x64, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x90, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x98, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbc, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x9c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xea, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xda, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xec, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x20, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x24, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x6a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x72, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x76, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x5a, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xa0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa4, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x56, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x64, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x88, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x94, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9c, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x38, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x66, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x3c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x38, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x76, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7e, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x82, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xaa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3e, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xce, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdc, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x14, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa2, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x8e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x96, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xba, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
 };
-unsigned int fft_bench_aot_len = 5772;
+unsigned int fft_bench_aot_len = 21444;
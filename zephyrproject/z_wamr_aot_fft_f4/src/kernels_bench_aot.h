@@ -0,0 +1,1225 @@
+unsigned char kernels_bench_aot[] = {
+  0x00, 0x61, 0x6f, 0x74, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x68, 0x75, 0x6d, 0x62, 0x76, 0x37, 0x65, 0x6d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+  0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+  0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+  0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+  0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+  0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+  0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+  0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+  0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+  0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+  0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+  0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+  0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+  0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+  0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+  0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+  0xb0, 0x54, 0xbb, 0x16, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61,
+  0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6c, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x12, 0x68, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x00, 0xbf, 0x70, 0xb5, 0xd0, 0xf8, 0x78, 0x41, 0x4b, 0xf2,
+  0xb5, 0x4e, 0xc3, 0xf6, 0x34, 0x4e, 0x04, 0xf5, 0x88, 0x53, 0x0e, 0xf5,
+  0x00, 0x02, 0xd0, 0xf8, 0xb8, 0x11, 0x4a, 0xf2, 0xa6, 0x56, 0x9a, 0x66,
+  0x4f, 0xf2, 0xf1, 0x02, 0x4f, 0xf2, 0xf1, 0x05, 0xc0, 0xf2, 0x25, 0x06,
+  0xc3, 0xf6, 0x70, 0x42, 0xc3, 0xf6, 0x70, 0x35, 0x16, 0x44, 0xde, 0x66,
+  0x05, 0xf1, 0x80, 0x76, 0x4f, 0xf2, 0xf1, 0x0c, 0x1e, 0x67, 0x4c, 0xf2,
+  0xc4, 0x36, 0xc3, 0xf6, 0xf0, 0x3c, 0xc0, 0xf2, 0x43, 0x06, 0x66, 0x44,
+  0x5e, 0x67, 0x4f, 0xf4, 0x88, 0x56, 0xa5, 0x51, 0xdd, 0x67, 0x49, 0xf2,
+  0x97, 0x65, 0xc3, 0xf6, 0x16, 0x55, 0x9d, 0x65, 0x5d, 0x62, 0x4a, 0xf2,
+  0xa6, 0x55, 0xc3, 0xf6, 0x25, 0x55, 0x5d, 0x65, 0x9d, 0x62, 0x4b, 0xf2,
+  0xb5, 0x45, 0xda, 0x60, 0x49, 0xf2, 0x97, 0x62, 0xc3, 0xf6, 0x34, 0x55,
+  0xc3, 0xf6, 0x96, 0x42, 0x1d, 0x65, 0xdd, 0x62, 0x4c, 0xf2, 0xc4, 0x35,
+  0x1a, 0x61, 0x4b, 0xf2, 0xb5, 0x42, 0xc3, 0xf6, 0x43, 0x55, 0xc3, 0xf6,
+  0xb4, 0x42, 0xdd, 0x64, 0x1d, 0x63, 0x4d, 0xf2, 0xd3, 0x25, 0x5a, 0x61,
+  0x4d, 0xf2, 0xd3, 0x22, 0xc3, 0xf6, 0x52, 0x55, 0xc3, 0xf6, 0xd2, 0x42,
+  0x9d, 0x64, 0x5d, 0x63, 0x4e, 0xf2, 0xe2, 0x15, 0x5a, 0x66, 0x9a, 0x61,
+  0x4f, 0xf2, 0xf1, 0x02, 0xc3, 0xf6, 0x61, 0x55, 0xc3, 0xf6, 0xf0, 0x42,
+  0x5d, 0x64, 0x9d, 0x63, 0x4f, 0xf2, 0xf1, 0x05, 0x1a, 0x66, 0xda, 0x61,
+  0x48, 0xf2, 0x88, 0x72, 0xc3, 0xf6, 0x70, 0x55, 0xc3, 0xf6, 0x07, 0x52,
+  0xb1, 0xf5, 0x8c, 0x5f, 0xc3, 0xe9, 0x0f, 0x55, 0xc3, 0xf8, 0x78, 0xc0,
+  0xc3, 0xe9, 0x01, 0xce, 0xda, 0x65, 0x1a, 0x62, 0x3f, 0xd3, 0x4f, 0xf2,
+  0x5f, 0x3e, 0x46, 0xf2, 0x0d, 0x62, 0x45, 0xf6, 0x6c, 0x13, 0x9f, 0xed,
+  0x1f, 0x2a, 0x9f, 0xed, 0x1f, 0x0a, 0xc3, 0xf6, 0x6e, 0x4e, 0xc0, 0xf2,
+  0x19, 0x02, 0x04, 0xf5, 0x8c, 0x54, 0xc3, 0xf6, 0x88, 0x43, 0x4f, 0xf4,
+  0x8c, 0x55, 0x41, 0xf2, 0xf8, 0x5c, 0xbf, 0xee, 0x00, 0x1a, 0x00, 0xbf,
+  0x12, 0xee, 0x10, 0x6a, 0x65, 0x45, 0x26, 0x60, 0x08, 0xbf, 0x70, 0xbd,
+  0x2e, 0x1d, 0x8e, 0x42, 0x1d, 0xd8, 0x03, 0xfb, 0x02, 0xe3, 0x08, 0x35,
+  0x1e, 0x0a, 0x02, 0xee, 0x10, 0x6a, 0xb8, 0xee, 0xc2, 0x2a, 0x22, 0xee,
+  0x00, 0x2a, 0x32, 0xee, 0x01, 0x2a, 0x03, 0xfb, 0x02, 0xe3, 0x12, 0xee,
+  0x10, 0x6a, 0x66, 0x60, 0x1e, 0x0a, 0x02, 0xee, 0x10, 0x6a, 0xb8, 0xee,
+  0xc2, 0x2a, 0x22, 0xee, 0x00, 0x2a, 0x32, 0xee, 0x01, 0x2a, 0x8d, 0x42,
+  0x04, 0xf1, 0x08, 0x04, 0xd8, 0xd9, 0x02, 0x21, 0xbd, 0xe8, 0x70, 0x40,
+  0xff, 0xf7, 0xfe, 0xbf, 0x4e, 0xef, 0x06, 0xbf, 0x00, 0x00, 0x00, 0x34,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03,
+  0xd3, 0xf8, 0x04, 0xc0, 0x02, 0x46, 0x80, 0x68, 0x01, 0xab, 0xb3, 0xeb,
+  0x0c, 0x03, 0x07, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0x2d, 0xed, 0x10, 0x8b, 0x8a, 0xb0, 0x01, 0x29, 0xc0, 0xf2,
+  0x3d, 0x83, 0xd0, 0xf8, 0x78, 0x21, 0xd0, 0xf8, 0xb8, 0x31, 0x02, 0xf5,
+  0x88, 0x54, 0x94, 0xed, 0x18, 0x0a, 0x09, 0x92, 0x8d, 0xed, 0x08, 0x0a,
+  0x94, 0xed, 0x19, 0x0a, 0x04, 0xf6, 0xfc, 0x07, 0x8d, 0xed, 0x07, 0x0a,
+  0x94, 0xed, 0x1a, 0x3a, 0x94, 0xed, 0x1b, 0x4a, 0x94, 0xed, 0x1c, 0x5a,
+  0x94, 0xed, 0x1d, 0x6a, 0x94, 0xed, 0x1e, 0x7a, 0xd4, 0xed, 0x1f, 0x0a,
+  0xd4, 0xed, 0x10, 0x1a, 0xd4, 0xed, 0x11, 0x2a, 0xd4, 0xed, 0x12, 0x3a,
+  0xd4, 0xed, 0x13, 0x4a, 0xd4, 0xed, 0x14, 0x5a, 0xd4, 0xed, 0x15, 0x6a,
+  0x03, 0x97, 0x00, 0x27, 0xd4, 0xed, 0x16, 0x7a, 0xd4, 0xed, 0x17, 0x9a,
+  0x94, 0xed, 0x08, 0x8a, 0x94, 0xed, 0x09, 0x9a, 0x94, 0xed, 0x0a, 0xaa,
+  0x94, 0xed, 0x0b, 0xba, 0x94, 0xed, 0x0c, 0xca, 0x94, 0xed, 0x0d, 0xda,
+  0x94, 0xed, 0x0e, 0xea, 0x94, 0xed, 0x0f, 0xfa, 0x94, 0xed, 0x00, 0x1a,
+  0xd4, 0xed, 0x01, 0x8a, 0xd4, 0xed, 0x02, 0xaa, 0xd4, 0xed, 0x03, 0xba,
+  0xd4, 0xed, 0x04, 0xca, 0xd4, 0xed, 0x05, 0xda, 0xd4, 0xed, 0x06, 0xea,
+  0xd4, 0xed, 0x07, 0xfa, 0x04, 0x97, 0x41, 0xf2, 0x84, 0x19, 0x41, 0xf2,
+  0x88, 0x1e, 0x41, 0xf2, 0x8c, 0x1a, 0x41, 0xf2, 0x90, 0x15, 0x41, 0xf2,
+  0x94, 0x12, 0x41, 0xf2, 0x98, 0x16, 0x41, 0xf2, 0x9c, 0x17, 0x41, 0xf2,
+  0xa4, 0x1b, 0x41, 0xf2, 0xa8, 0x18, 0x02, 0x91, 0x4f, 0xf0, 0x00, 0x0c,
+  0x0c, 0xf5, 0x8c, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0xd9, 0x82, 0x0c, 0xeb,
+  0x09, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xd4, 0x82, 0x0c, 0xeb, 0x0e, 0x04,
+  0x9c, 0x42, 0x00, 0xf2, 0xcf, 0x82, 0x0c, 0xeb, 0x0a, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0xca, 0x82, 0x0c, 0xeb, 0x05, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0xc5, 0x82, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xc0, 0x82,
+  0x0c, 0xeb, 0x06, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xbb, 0x82, 0x0c, 0xeb,
+  0x07, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xb6, 0x82, 0x0c, 0xf5, 0x8d, 0x54,
+  0x9c, 0x42, 0x00, 0xf2, 0xb1, 0x82, 0x0c, 0xeb, 0x0b, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0xac, 0x82, 0x0c, 0xeb, 0x08, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0xa7, 0x82, 0x41, 0xf2, 0xac, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0xa0, 0x82, 0x41, 0xf2, 0xb0, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x00, 0xf2, 0x99, 0x82, 0x41, 0xf2, 0xb4, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x92, 0x82, 0x41, 0xf2, 0xb8, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x8b, 0x82, 0x41, 0xf2,
+  0xbc, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x84, 0x82,
+  0x0c, 0xf5, 0x8e, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0x7f, 0x82, 0x41, 0xf2,
+  0xc4, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x78, 0x82,
+  0x41, 0xf2, 0xc8, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0x71, 0x82, 0x41, 0xf2, 0xcc, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x6a, 0x82, 0x41, 0xf2, 0xd0, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x00, 0xf2, 0x63, 0x82, 0x41, 0xf2, 0xd4, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x5c, 0x82, 0x41, 0xf2, 0xd8, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x55, 0x82, 0x41, 0xf2,
+  0xdc, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x4e, 0x82,
+  0x0c, 0xf5, 0x8f, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0x49, 0x82, 0x41, 0xf2,
+  0xe4, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x42, 0x82,
+  0x41, 0xf2, 0xe8, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0x3b, 0x82, 0x41, 0xf2, 0xec, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x34, 0x82, 0x41, 0xf2, 0xf0, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x00, 0xf2, 0x2d, 0x82, 0x41, 0xf2, 0xf4, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x26, 0x82, 0x41, 0xf2, 0xf8, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x1f, 0x82, 0x41, 0xf2,
+  0xfc, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x18, 0x82,
+  0x0c, 0xf5, 0xb0, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0x13, 0x82, 0x09, 0x9c,
+  0x41, 0xf2, 0x84, 0x18, 0x04, 0xeb, 0x0c, 0x0b, 0x4f, 0xf4, 0x8c, 0x54,
+  0x5b, 0xf8, 0x04, 0x40, 0x41, 0xf2, 0x88, 0x19, 0x00, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x08, 0x40, 0x9f, 0xed, 0xe6, 0x2a, 0x21, 0xee, 0x00, 0x0a,
+  0x8d, 0xed, 0x06, 0x1a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x09, 0x40,
+  0x41, 0xf2, 0x8c, 0x1e, 0x30, 0xee, 0x02, 0x0a, 0x28, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x0e, 0x40,
+  0x41, 0xf2, 0x90, 0x1a, 0x2a, 0xee, 0x81, 0x1a, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x0a, 0x40, 0x41, 0xf2, 0x94, 0x12,
+  0x2b, 0xee, 0x81, 0x1a, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0x98, 0x16, 0x2c, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x06, 0x40,
+  0x41, 0xf2, 0x9c, 0x17, 0x2d, 0xee, 0x81, 0x1a, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x07, 0x40, 0x2e, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x4f, 0xf4, 0x8d, 0x54,
+  0x5b, 0xf8, 0x04, 0x40, 0x41, 0xf2, 0xa4, 0x15, 0x2f, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x05, 0x40,
+  0x41, 0xf2, 0xa8, 0x18, 0x28, 0xee, 0x01, 0x1a, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x08, 0x40, 0x29, 0xee, 0x01, 0x1a,
+  0x41, 0xf2, 0xac, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x2a, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xb0, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x2b, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xb4, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x2c, 0xee, 0x01, 0x1a,
+  0x41, 0xf2, 0xb8, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x2d, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xbc, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x2e, 0xee, 0x01, 0x1a, 0x4f, 0xf4, 0x8e, 0x52, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x2f, 0xee, 0x01, 0x1a,
+  0x41, 0xf2, 0xc4, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x21, 0xee, 0x81, 0x1a, 0x41, 0xf2, 0xc8, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x22, 0xee, 0x81, 0x1a, 0x41, 0xf2, 0xcc, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x23, 0xee, 0x81, 0x1a,
+  0x41, 0xf2, 0xd0, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x24, 0xee, 0x81, 0x1a, 0x41, 0xf2, 0xd4, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x25, 0xee, 0x81, 0x1a, 0x41, 0xf2, 0xd8, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x26, 0xee, 0x81, 0x1a,
+  0x41, 0xf2, 0xdc, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x27, 0xee, 0x81, 0x1a, 0x4f, 0xf4, 0x8f, 0x52,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0xcd, 0xed, 0x05, 0x9a, 0x29, 0xee, 0x81, 0x1a, 0x9d, 0xed, 0x08, 0x2a,
+  0x41, 0xf2, 0xe4, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x22, 0xee, 0x01, 0x1a, 0x9d, 0xed, 0x07, 0x2a,
+  0x41, 0xf2, 0xe8, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x22, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xec, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0xf0, 0xee, 0x6f, 0x9a, 0xf0, 0xee, 0x6e, 0xfa, 0xf0, 0xee, 0x6d, 0xea,
+  0xf0, 0xee, 0x6c, 0xda, 0xf0, 0xee, 0x6b, 0xca, 0xf0, 0xee, 0x6a, 0xba,
+  0xf0, 0xee, 0x68, 0xaa, 0xf0, 0xee, 0x4f, 0x8a, 0xb0, 0xee, 0x4e, 0xfa,
+  0xb0, 0xee, 0x4d, 0xea, 0xb0, 0xee, 0x4c, 0xda, 0xb0, 0xee, 0x4b, 0xca,
+  0xb0, 0xee, 0x4a, 0xba, 0xb0, 0xee, 0x49, 0xaa, 0xb0, 0xee, 0x48, 0x9a,
+  0xb0, 0xee, 0x67, 0x8a, 0xf0, 0xee, 0x66, 0x7a, 0xf0, 0xee, 0x65, 0x6a,
+  0xf0, 0xee, 0x64, 0x5a, 0xf0, 0xee, 0x63, 0x4a, 0xf0, 0xee, 0x62, 0x3a,
+  0xf0, 0xee, 0x61, 0x2a, 0xf0, 0xee, 0x60, 0x1a, 0xf0, 0xee, 0x47, 0x0a,
+  0xb0, 0xee, 0x46, 0x7a, 0xb0, 0xee, 0x45, 0x6a, 0xb0, 0xee, 0x44, 0x5a,
+  0xb0, 0xee, 0x43, 0x4a, 0x23, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xf0, 0x12,
+  0xb0, 0xee, 0x45, 0x4a, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x24, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xf4, 0x12,
+  0xb0, 0xee, 0x46, 0x5a, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x25, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xf8, 0x12,
+  0xb0, 0xee, 0x47, 0x6a, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x26, 0xee, 0x01, 0x1a, 0x41, 0xf2, 0xfc, 0x12,
+  0xb0, 0xee, 0x60, 0x7a, 0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x27, 0xee, 0x01, 0x1a, 0xf0, 0xee, 0x61, 0x0a,
+  0x30, 0xee, 0x01, 0x0a, 0x01, 0xee, 0x10, 0x4a, 0x20, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0xf0, 0xee, 0x62, 0x1a, 0xf0, 0xee, 0x63, 0x2a,
+  0xf0, 0xee, 0x64, 0x3a, 0xf0, 0xee, 0x65, 0x4a, 0xf0, 0xee, 0x66, 0x5a,
+  0xf0, 0xee, 0x67, 0x6a, 0xf0, 0xee, 0x48, 0x7a, 0xb0, 0xee, 0x49, 0x8a,
+  0xb0, 0xee, 0x4a, 0x9a, 0xb0, 0xee, 0x4b, 0xaa, 0xb0, 0xee, 0x4c, 0xba,
+  0xb0, 0xee, 0x4d, 0xca, 0xb0, 0xee, 0x4e, 0xda, 0xb0, 0xee, 0x4f, 0xea,
+  0xb0, 0xee, 0x68, 0xfa, 0xf0, 0xee, 0x6a, 0x8a, 0xf0, 0xee, 0x6b, 0xaa,
+  0xf0, 0xee, 0x6c, 0xba, 0xf0, 0xee, 0x6d, 0xca, 0xf0, 0xee, 0x6e, 0xda,
+  0xf0, 0xee, 0x6f, 0xea, 0xf0, 0xee, 0x69, 0xfa, 0xdd, 0xed, 0x05, 0x9a,
+  0x9d, 0xed, 0x06, 0x1a, 0x10, 0xee, 0x10, 0x4a, 0x0c, 0xf1, 0x04, 0x0c,
+  0x4f, 0xf4, 0xb0, 0x52, 0x41, 0xf2, 0x84, 0x19, 0x41, 0xf2, 0x88, 0x1e,
+  0x41, 0xf2, 0x8c, 0x1a, 0xbc, 0xf5, 0x80, 0x6f, 0x4b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0x90, 0x15, 0x41, 0xf2, 0x94, 0x12, 0x41, 0xf2, 0xa4, 0x1b,
+  0x41, 0xf2, 0x98, 0x16, 0x41, 0xf2, 0x9c, 0x17, 0x7f, 0xf4, 0x5a, 0xad,
+  0x02, 0xe0, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9c, 0xdd, 0xf8,
+  0x10, 0xb0, 0x94, 0xed, 0x00, 0x0a, 0x09, 0x9a, 0xb6, 0xee, 0x00, 0x2a,
+  0x5f, 0xfa, 0x8b, 0xf4, 0x20, 0xee, 0x02, 0x0a, 0x02, 0xeb, 0x84, 0x02,
+  0x01, 0x92, 0x10, 0xee, 0x10, 0x2a, 0x0b, 0xf1, 0x01, 0x0b, 0x00, 0x92,
+  0xcd, 0xf8, 0x10, 0xb0, 0x01, 0x46, 0x02, 0x98, 0xdd, 0xe9, 0x00, 0x84,
+  0x41, 0xf2, 0xfc, 0x1c, 0x83, 0x45, 0x41, 0xf2, 0x90, 0x15, 0x41, 0xf2,
+  0x94, 0x12, 0x41, 0xf2, 0xa4, 0x1b, 0x41, 0xf2, 0x98, 0x16, 0x41, 0xf2,
+  0x9c, 0x17, 0x44, 0xf8, 0x0c, 0x80, 0x41, 0xf2, 0xa8, 0x18, 0x08, 0x46,
+  0x7f, 0xf4, 0x26, 0xad, 0x0a, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x0a, 0xb0, 0xbd, 0xec, 0x10, 0x8b,
+  0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x68,
+  0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0xf0, 0xb5, 0x81, 0xb0, 0x40, 0xf2, 0x93, 0x12, 0xd0, 0xf8, 0x78, 0xc1,
+  0xd0, 0xf8, 0xb8, 0x71, 0x49, 0xf6, 0xc5, 0x5e, 0xc0, 0xf2, 0x00, 0x12,
+  0xc8, 0xf2, 0x1c, 0x1e, 0x4f, 0xf4, 0xb0, 0x51, 0xb9, 0x42, 0x00, 0xf2,
+  0xa5, 0x80, 0x0c, 0x1d, 0xbc, 0x42, 0x00, 0xf2, 0xa1, 0x80, 0x01, 0xf1,
+  0x08, 0x04, 0xbc, 0x42, 0x00, 0xf2, 0x9c, 0x80, 0x01, 0xf1, 0x0c, 0x04,
+  0xbc, 0x42, 0x00, 0xf2, 0x97, 0x80, 0x01, 0xf1, 0x10, 0x04, 0xbc, 0x42,
+  0x00, 0xf2, 0x92, 0x80, 0x01, 0xf1, 0x14, 0x04, 0xbc, 0x42, 0x00, 0xf2,
+  0x8d, 0x80, 0x01, 0xf1, 0x18, 0x04, 0xbc, 0x42, 0x00, 0xf2, 0x88, 0x80,
+  0x01, 0xf1, 0x1c, 0x04, 0xbc, 0x42, 0x00, 0xf2, 0x83, 0x80, 0x5c, 0xf8,
+  0x01, 0x50, 0x0c, 0xeb, 0x01, 0x04, 0xee, 0xb2, 0x86, 0xea, 0x0e, 0x06,
+  0x56, 0x43, 0xc5, 0xf3, 0x07, 0x23, 0x73, 0x40, 0x53, 0x43, 0xc5, 0xf3,
+  0x07, 0x46, 0x73, 0x40, 0x66, 0x68, 0x53, 0x43, 0x83, 0xea, 0x15, 0x63,
+  0xf5, 0xb2, 0x53, 0x43, 0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x45, 0x6b, 0x40, 0xa5, 0x68,
+  0x53, 0x43, 0x83, 0xea, 0x16, 0x63, 0xee, 0xb2, 0x53, 0x43, 0x73, 0x40,
+  0x53, 0x43, 0xc5, 0xf3, 0x07, 0x26, 0x73, 0x40, 0x53, 0x43, 0xc5, 0xf3,
+  0x07, 0x46, 0x73, 0x40, 0xe6, 0x68, 0x53, 0x43, 0x83, 0xea, 0x15, 0x63,
+  0xf5, 0xb2, 0x53, 0x43, 0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x45, 0x6b, 0x40, 0x25, 0x69,
+  0x53, 0x43, 0x83, 0xea, 0x16, 0x63, 0xee, 0xb2, 0x53, 0x43, 0x73, 0x40,
+  0x53, 0x43, 0xc5, 0xf3, 0x07, 0x26, 0x73, 0x40, 0x53, 0x43, 0xc5, 0xf3,
+  0x07, 0x46, 0x73, 0x40, 0x66, 0x69, 0x53, 0x43, 0x83, 0xea, 0x15, 0x63,
+  0xf5, 0xb2, 0x53, 0x43, 0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x45, 0x6b, 0x40, 0xa5, 0x69,
+  0x53, 0x43, 0x83, 0xea, 0x16, 0x63, 0xee, 0xb2, 0x53, 0x43, 0x73, 0x40,
+  0x53, 0x43, 0xc5, 0xf3, 0x07, 0x26, 0x73, 0x40, 0x53, 0x43, 0xc5, 0xf3,
+  0x07, 0x46, 0x73, 0x40, 0x53, 0x43, 0xe6, 0x69, 0x83, 0xea, 0x15, 0x63,
+  0x53, 0x43, 0xf5, 0xb2, 0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x6b, 0x40, 0x53, 0x43, 0xc6, 0xf3, 0x07, 0x45, 0x6b, 0x40, 0x53, 0x43,
+  0x83, 0xea, 0x16, 0x63, 0x20, 0x31, 0xb1, 0xf5, 0xd0, 0x5f, 0x03, 0xfb,
+  0x02, 0xfe, 0x7f, 0xf4, 0x59, 0xaf, 0x04, 0xe0, 0x02, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x4f, 0xf0, 0x00, 0x0e, 0x70, 0x46, 0x01, 0xb0, 0xf0, 0xbd,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0xd2, 0x68, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x00, 0xbf, 0xb0, 0xb5, 0xd0, 0xf8, 0x78, 0x11, 0x4f, 0xf2,
+  0x5f, 0x3c, 0x46, 0xf2, 0x0d, 0x6e, 0xd0, 0xf8, 0xb8, 0x31, 0x01, 0xf5,
+  0xd0, 0x52, 0x00, 0x24, 0x4f, 0xf4, 0xd0, 0x55, 0x9f, 0xed, 0x22, 0x0a,
+  0xc3, 0xf6, 0x6e, 0x4c, 0xc0, 0xf2, 0x19, 0x0e, 0x14, 0x61, 0x4c, 0x51,
+  0x94, 0x61, 0x14, 0x62, 0x14, 0x63, 0x14, 0x64, 0x94, 0x64, 0x14, 0x65,
+  0x01, 0xf5, 0xd3, 0x51, 0x02, 0x24, 0x4f, 0xf4, 0xd3, 0x52, 0xbf, 0xee,
+  0x00, 0x1a, 0x00, 0xbf, 0x9a, 0x42, 0x27, 0xd8, 0x04, 0xfb, 0x0e, 0xc4,
+  0x25, 0x0a, 0x02, 0xee, 0x10, 0x5a, 0xb8, 0xee, 0xc2, 0x2a, 0x22, 0xee,
+  0x00, 0x2a, 0x32, 0xee, 0x01, 0x2a, 0x15, 0x1d, 0x9d, 0x42, 0x12, 0xee,
+  0x10, 0x5a, 0x0d, 0x60, 0x16, 0xd8, 0x04, 0xfb, 0x0e, 0xc4, 0x08, 0x32,
+  0x25, 0x0a, 0x02, 0xee, 0x10, 0x5a, 0xb8, 0xee, 0xc2, 0x2a, 0x22, 0xee,
+  0x00, 0x2a, 0x32, 0xee, 0x01, 0x2a, 0x12, 0xee, 0x10, 0x5a, 0xb2, 0xf5,
+  0xf3, 0x5f, 0x4d, 0x60, 0x01, 0xf1, 0x08, 0x01, 0x08, 0xbf, 0xb0, 0xbd,
+  0xd6, 0xe7, 0x00, 0xbf, 0x02, 0x21, 0xbd, 0xe8, 0xb0, 0x40, 0xff, 0xf7,
+  0xfe, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x34, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x10, 0xc0,
+  0x02, 0x46, 0x80, 0x68, 0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x03, 0x07, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x00, 0xbf, 0x2d, 0xe9, 0xf0, 0x41, 0x2d, 0xed, 0x04, 0x8b,
+  0x01, 0x29, 0xc0, 0xf2, 0x8d, 0x80, 0xd0, 0xf8, 0x78, 0x31, 0xd0, 0xf8,
+  0xb8, 0x21, 0x03, 0xf5, 0xd0, 0x5c, 0x9c, 0xed, 0x14, 0x0a, 0x9c, 0xed,
+  0x12, 0x1a, 0x9c, 0xed, 0x10, 0x3a, 0x9c, 0xed, 0x0c, 0x2a, 0x9c, 0xed,
+  0x00, 0x7a, 0xdc, 0xed, 0x04, 0x3a, 0x9c, 0xed, 0x06, 0x4a, 0xdc, 0xed,
+  0x08, 0x2a, 0x9f, 0xed, 0x41, 0x5a, 0x9f, 0xed, 0x41, 0x6a, 0xdf, 0xed,
+  0x41, 0x0a, 0xdf, 0xed, 0x41, 0x1a, 0x4f, 0xf0, 0x00, 0x0e, 0x4f, 0xf4,
+  0xd3, 0x58, 0x4f, 0xf4, 0xf3, 0x55, 0x00, 0x26, 0x06, 0xf5, 0xd3, 0x57,
+  0x97, 0x42, 0x67, 0xd8, 0x06, 0xf5, 0xf3, 0x57, 0x97, 0x42, 0x63, 0xd8,
+  0x9f, 0x19, 0x57, 0xf8, 0x08, 0x40, 0x04, 0x36, 0x04, 0xee, 0x90, 0x4a,
+  0x64, 0xee, 0x85, 0x5a, 0x75, 0xee, 0x87, 0x6a, 0x24, 0xee, 0x86, 0x7a,
+  0x66, 0xee, 0xa0, 0x4a, 0x37, 0xee, 0x24, 0x7a, 0x33, 0xee, 0x87, 0x7a,
+  0x66, 0xee, 0x85, 0x3a, 0x73, 0xee, 0x84, 0x4a, 0x26, 0xee, 0x86, 0x4a,
+  0x64, 0xee, 0xa0, 0x7a, 0x34, 0xee, 0x27, 0x4a, 0x32, 0xee, 0x84, 0x4a,
+  0x64, 0xee, 0x85, 0x2a, 0x72, 0xee, 0x82, 0x7a, 0x24, 0xee, 0x86, 0x2a,
+  0x27, 0xee, 0xa0, 0x8a, 0x32, 0xee, 0x08, 0x2a, 0x33, 0xee, 0x02, 0x2a,
+  0x27, 0xee, 0x85, 0x3a, 0x33, 0xee, 0x01, 0x8a, 0x27, 0xee, 0x86, 0x1a,
+  0x28, 0xee, 0x20, 0x9a, 0x31, 0xee, 0x09, 0x1a, 0x30, 0xee, 0x01, 0x1a,
+  0x28, 0xee, 0x21, 0x0a, 0x33, 0xee, 0x40, 0x0a, 0x27, 0xee, 0xa1, 0x3a,
+  0x32, 0xee, 0xc3, 0x3a, 0x64, 0xee, 0xa1, 0x2a, 0x73, 0xee, 0xe2, 0x2a,
+  0x66, 0xee, 0xa1, 0x3a, 0x18, 0xee, 0x10, 0x4a, 0x75, 0xee, 0xe3, 0x3a,
+  0xb6, 0xf5, 0x80, 0x6f, 0x7c, 0x51, 0xab, 0xd1, 0x0e, 0xf1, 0x01, 0x0e,
+  0x8e, 0x45, 0xa6, 0xd1, 0xcc, 0xed, 0x04, 0x3a, 0x8c, 0xed, 0x00, 0x7a,
+  0x8c, 0xed, 0x06, 0x4a, 0xcc, 0xed, 0x08, 0x2a, 0x8c, 0xed, 0x0c, 0x2a,
+  0x8c, 0xed, 0x10, 0x3a, 0x8c, 0xed, 0x12, 0x1a, 0x8c, 0xed, 0x14, 0x0a,
+  0xbd, 0xec, 0x04, 0x8b, 0xbd, 0xe8, 0xf0, 0x81, 0x02, 0x21, 0xbd, 0xec,
+  0x04, 0x8b, 0xbd, 0xe8, 0xf0, 0x41, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0xbf,
+  0xfd, 0x25, 0x8a, 0x3d, 0xfe, 0x25, 0x0a, 0x3e, 0x2f, 0x4d, 0x92, 0x3f,
+  0xbb, 0x5a, 0xd3, 0x3e, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0x52, 0x69, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x41,
+  0x40, 0xf2, 0x93, 0x12, 0xd0, 0xf8, 0x78, 0xc1, 0xd0, 0xf8, 0xb8, 0x31,
+  0x49, 0xf6, 0xc5, 0x5e, 0xc0, 0xf2, 0x00, 0x12, 0xc8, 0xf2, 0x1c, 0x1e,
+  0x4f, 0xf4, 0xf3, 0x51, 0x42, 0xf2, 0x60, 0x28, 0x99, 0x42, 0x00, 0xf2,
+  0xa7, 0x80, 0x0d, 0x1d, 0x9d, 0x42, 0x00, 0xf2, 0xa3, 0x80, 0x01, 0xf1,
+  0x08, 0x05, 0x9d, 0x42, 0x00, 0xf2, 0x9e, 0x80, 0x01, 0xf1, 0x0c, 0x05,
+  0x9d, 0x42, 0x00, 0xf2, 0x99, 0x80, 0x01, 0xf1, 0x10, 0x05, 0x9d, 0x42,
+  0x00, 0xf2, 0x94, 0x80, 0x01, 0xf1, 0x14, 0x05, 0x9d, 0x42, 0x00, 0xf2,
+  0x8f, 0x80, 0x01, 0xf1, 0x18, 0x05, 0x9d, 0x42, 0x00, 0xf2, 0x8a, 0x80,
+  0x01, 0xf1, 0x1c, 0x05, 0x9d, 0x42, 0x00, 0xf2, 0x85, 0x80, 0x5c, 0xf8,
+  0x01, 0x60, 0x0c, 0xeb, 0x01, 0x05, 0xf7, 0xb2, 0x87, 0xea, 0x0e, 0x07,
+  0x57, 0x43, 0xc6, 0xf3, 0x07, 0x24, 0x67, 0x40, 0x57, 0x43, 0xc6, 0xf3,
+  0x07, 0x44, 0x67, 0x40, 0x6c, 0x68, 0x57, 0x43, 0x87, 0xea, 0x16, 0x67,
+  0xe6, 0xb2, 0x57, 0x43, 0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x26,
+  0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x46, 0x77, 0x40, 0xae, 0x68,
+  0x57, 0x43, 0x87, 0xea, 0x14, 0x67, 0xf4, 0xb2, 0x57, 0x43, 0x67, 0x40,
+  0x57, 0x43, 0xc6, 0xf3, 0x07, 0x24, 0x67, 0x40, 0x57, 0x43, 0xc6, 0xf3,
+  0x07, 0x44, 0x67, 0x40, 0xec, 0x68, 0x57, 0x43, 0x87, 0xea, 0x16, 0x67,
+  0xe6, 0xb2, 0x57, 0x43, 0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x26,
+  0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x46, 0x77, 0x40, 0x2e, 0x69,
+  0x57, 0x43, 0x87, 0xea, 0x14, 0x67, 0xf4, 0xb2, 0x57, 0x43, 0x67, 0x40,
+  0x57, 0x43, 0xc6, 0xf3, 0x07, 0x24, 0x67, 0x40, 0x57, 0x43, 0xc6, 0xf3,
+  0x07, 0x44, 0x67, 0x40, 0x6c, 0x69, 0x57, 0x43, 0x87, 0xea, 0x16, 0x67,
+  0xe6, 0xb2, 0x57, 0x43, 0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x26,
+  0x77, 0x40, 0x57, 0x43, 0xc4, 0xf3, 0x07, 0x46, 0x77, 0x40, 0xae, 0x69,
+  0x57, 0x43, 0x87, 0xea, 0x14, 0x67, 0xf4, 0xb2, 0x57, 0x43, 0x67, 0x40,
+  0x57, 0x43, 0xc6, 0xf3, 0x07, 0x24, 0x67, 0x40, 0x57, 0x43, 0xc6, 0xf3,
+  0x07, 0x44, 0x67, 0x40, 0x57, 0x43, 0x87, 0xea, 0x16, 0x67, 0xee, 0x69,
+  0x57, 0x43, 0xf5, 0xb2, 0x6f, 0x40, 0x57, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x6f, 0x40, 0x57, 0x43, 0xc6, 0xf3, 0x07, 0x45, 0x6f, 0x40, 0x57, 0x43,
+  0x87, 0xea, 0x16, 0x67, 0x20, 0x31, 0x41, 0x45, 0x07, 0xfb, 0x02, 0xfe,
+  0x7f, 0xf4, 0x5a, 0xaf, 0x70, 0x46, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0xbf,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x69, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0xd0, 0xf8, 0x78, 0xc1,
+  0x4f, 0xf2, 0x5f, 0x31, 0x46, 0xf2, 0x0d, 0x62, 0xd0, 0xf8, 0xb8, 0x31,
+  0x42, 0xf6, 0x84, 0x27, 0x42, 0xf2, 0x84, 0x24, 0xc3, 0xf6, 0x6e, 0x41,
+  0xc0, 0xf2, 0x19, 0x02, 0x67, 0x44, 0x0c, 0xeb, 0x04, 0x0e, 0x4f, 0xf0,
+  0x00, 0x08, 0x4f, 0xf0, 0x03, 0x09, 0x4f, 0xf0, 0x00, 0x0b, 0x00, 0x97,
+  0x42, 0xf6, 0x60, 0x24, 0x5c, 0x44, 0x9c, 0x42, 0x00, 0xf2, 0x2a, 0x81,
+  0x42, 0xf6, 0x64, 0x24, 0x5c, 0x44, 0x0e, 0xeb, 0x0b, 0x0a, 0x9c, 0x42,
+  0xca, 0xf8, 0xdc, 0x87, 0x00, 0xf2, 0x20, 0x81, 0x42, 0xf6, 0x68, 0x24,
+  0x5c, 0x44, 0x9c, 0x42, 0xca, 0xf8, 0xe0, 0x87, 0x00, 0xf2, 0x18, 0x81,
+  0x42, 0xf6, 0x6c, 0x24, 0x5c, 0x44, 0x9c, 0x42, 0xca, 0xf8, 0xe4, 0x87,
+  0x00, 0xf2, 0x10, 0x81, 0x42, 0xf6, 0x70, 0x24, 0x5c, 0x44, 0x9c, 0x42,
+  0xca, 0xf8, 0xe8, 0x87, 0x00, 0xf2, 0x08, 0x81, 0x42, 0xf6, 0x74, 0x24,
+  0x5c, 0x44, 0x9c, 0x42, 0xca, 0xf8, 0xec, 0x87, 0x00, 0xf2, 0x00, 0x81,
+  0x09, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0xf0, 0x87, 0x27, 0x0d, 0x04, 0xfb,
+  0x02, 0x14, 0x4a, 0xf8, 0x24, 0x7c, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14,
+  0xca, 0xf8, 0xdc, 0x73, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0x4a, 0xf8,
+  0x20, 0x7c, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0xe0, 0x73,
+  0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0x4a, 0xf8, 0x1c, 0x7c, 0x27, 0x0d,
+  0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0xe4, 0x73, 0x27, 0x0d, 0x04, 0xfb,
+  0x02, 0x14, 0x4a, 0xf8, 0x18, 0x7c, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14,
+  0xca, 0xf8, 0xe8, 0x73, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0x4a, 0xf8,
+  0x14, 0x7c, 0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0xec, 0x73,
+  0x27, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0x4a, 0xf8, 0x10, 0x7c, 0x27, 0x0d,
+  0xca, 0xf8, 0xf0, 0x73, 0x04, 0xfb, 0x02, 0x17, 0x42, 0xf6, 0x78, 0x24,
+  0x5c, 0x44, 0x9c, 0x42, 0x4f, 0xea, 0x17, 0x54, 0x4a, 0xf8, 0x0c, 0x4c,
+  0x00, 0xf2, 0xb6, 0x80, 0x42, 0xf6, 0x7c, 0x24, 0x5c, 0x44, 0x9c, 0x42,
+  0xca, 0xf8, 0xf4, 0x87, 0x00, 0xf2, 0xae, 0x80, 0x0b, 0xf5, 0x2a, 0x54,
+  0x9c, 0x42, 0xca, 0xf8, 0xf8, 0x87, 0x00, 0xf2, 0xa7, 0x80, 0x42, 0xf6,
+  0x84, 0x25, 0x5d, 0x44, 0x0c, 0xeb, 0x0b, 0x04, 0x9d, 0x42, 0x4f, 0xf4,
+  0x2a, 0x55, 0x44, 0xf8, 0x05, 0x80, 0x00, 0xf2, 0x9b, 0x80, 0x42, 0xf6,
+  0x88, 0x25, 0x5d, 0x44, 0x9d, 0x42, 0x00, 0x9d, 0x45, 0xf8, 0x0b, 0x80,
+  0x00, 0xf2, 0x92, 0x80, 0x42, 0xf6, 0x8c, 0x25, 0x5d, 0x44, 0x9d, 0x42,
+  0xca, 0xf8, 0x04, 0x88, 0x00, 0xf2, 0x8a, 0x80, 0x07, 0xfb, 0x02, 0x15,
+  0x4f, 0xf4, 0x0a, 0x56, 0x2f, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8,
+  0xf4, 0x73, 0x2f, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0x4a, 0xf8, 0x08, 0x7c,
+  0x2f, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8, 0xf8, 0x73, 0x2f, 0x0d,
+  0x05, 0xfb, 0x02, 0x15, 0xa7, 0x51, 0x2f, 0x0d, 0x05, 0xfb, 0x02, 0x15,
+  0x4f, 0xf4, 0x1a, 0x56, 0xa7, 0x51, 0x2c, 0x0d, 0x05, 0xfb, 0x02, 0x15,
+  0x4e, 0xf8, 0x0b, 0x40, 0x2c, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8,
+  0x00, 0x44, 0x2c, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8, 0x04, 0x40,
+  0x2c, 0x0d, 0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8, 0x04, 0x44, 0x2c, 0x0d,
+  0x05, 0xfb, 0x02, 0x15, 0xca, 0xf8, 0x08, 0x40, 0x2c, 0x0d, 0x05, 0xfb,
+  0x02, 0x15, 0xca, 0xf8, 0x08, 0x44, 0x2f, 0x0d, 0x05, 0xfb, 0x02, 0x14,
+  0x42, 0xf6, 0x90, 0x26, 0xca, 0xf8, 0x0c, 0x70, 0x0b, 0xeb, 0x06, 0x07,
+  0x25, 0x0d, 0x9f, 0x42, 0xca, 0xf8, 0x08, 0x88, 0xca, 0xf8, 0x0c, 0x54,
+  0x3e, 0xd8, 0x42, 0xf6, 0x94, 0x25, 0x5d, 0x44, 0x9d, 0x42, 0xca, 0xf8,
+  0x0c, 0x88, 0x37, 0xd8, 0x42, 0xf6, 0x98, 0x25, 0x5d, 0x44, 0x9d, 0x42,
+  0xca, 0xf8, 0x10, 0x88, 0x30, 0xd8, 0x42, 0xf6, 0x9c, 0x25, 0x5d, 0x44,
+  0x9d, 0x42, 0xca, 0xf8, 0x14, 0x88, 0x29, 0xd8, 0x04, 0xfb, 0x02, 0x14,
+  0x0b, 0xf1, 0x40, 0x0b, 0x25, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8,
+  0x10, 0x50, 0x25, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0x10, 0x54,
+  0x25, 0x0d, 0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0x14, 0x50, 0x25, 0x0d,
+  0x04, 0xfb, 0x02, 0x14, 0xca, 0xf8, 0x14, 0x54, 0x04, 0xfb, 0x02, 0x19,
+  0x25, 0x0d, 0x4f, 0xea, 0x19, 0x54, 0xbb, 0xf5, 0x80, 0x6f, 0xca, 0xf8,
+  0x18, 0x88, 0xca, 0xf8, 0x18, 0x50, 0xca, 0xf8, 0x18, 0x44, 0x7f, 0xf4,
+  0xd3, 0xae, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x1c, 0xc0,
+  0x02, 0x46, 0x80, 0x68, 0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x03, 0x07, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x93, 0xb0, 0x01, 0x29, 0xc0, 0xf2,
+  0x67, 0x81, 0xd0, 0xf8, 0x78, 0x61, 0x42, 0xf6, 0x5c, 0x62, 0xd0, 0xf8,
+  0xb8, 0x71, 0x32, 0x44, 0x33, 0x46, 0x04, 0x96, 0x00, 0x92, 0x00, 0x22,
+  0x42, 0xf2, 0x9c, 0x26, 0x42, 0xf6, 0x20, 0x2e, 0x02, 0x92, 0x01, 0x91,
+  0x03, 0x90, 0x00, 0x20, 0x42, 0xf6, 0x60, 0x29, 0x42, 0xf6, 0x64, 0x21,
+  0x06, 0x91, 0x05, 0x90, 0x06, 0xeb, 0x80, 0x10, 0xb8, 0x42, 0x00, 0xf2,
+  0x4d, 0x81, 0xdd, 0xf8, 0x10, 0xc0, 0x05, 0x99, 0x5c, 0xf8, 0x00, 0x00,
+  0x89, 0x01, 0x12, 0x90, 0x01, 0xeb, 0x0c, 0x05, 0x42, 0xf2, 0x98, 0x20,
+  0x2b, 0x58, 0x42, 0xf2, 0x94, 0x20, 0x28, 0x58, 0x42, 0xf2, 0x64, 0x22,
+  0x11, 0x90, 0x42, 0xf2, 0x90, 0x20, 0x28, 0x58, 0x55, 0xf8, 0x02, 0xa0,
+  0x10, 0x90, 0x42, 0xf2, 0x8c, 0x20, 0x28, 0x58, 0x42, 0xf2, 0x60, 0x22,
+  0x0f, 0x90, 0x42, 0xf2, 0x88, 0x20, 0x28, 0x58, 0x4f, 0xf0, 0x00, 0x0b,
+  0x0e, 0x90, 0x42, 0xf2, 0x84, 0x20, 0x28, 0x58, 0x0d, 0x90, 0x4f, 0xf4,
+  0x0a, 0x50, 0x28, 0x58, 0x0c, 0x90, 0x42, 0xf2, 0x7c, 0x20, 0x28, 0x58,
+  0x0b, 0x90, 0x42, 0xf2, 0x78, 0x20, 0x28, 0x58, 0x0a, 0x90, 0x42, 0xf2,
+  0x74, 0x20, 0x28, 0x58, 0x09, 0x90, 0x42, 0xf2, 0x70, 0x20, 0x28, 0x58,
+  0x08, 0x90, 0x42, 0xf2, 0x6c, 0x20, 0x28, 0x58, 0x07, 0x90, 0x42, 0xf2,
+  0x68, 0x20, 0x55, 0xf8, 0x00, 0x80, 0xad, 0x58, 0x0b, 0xeb, 0x0e, 0x04,
+  0xbc, 0x42, 0x00, 0xf2, 0x03, 0x81, 0x09, 0xeb, 0x0b, 0x04, 0xbc, 0x42,
+  0x00, 0xf2, 0xfe, 0x80, 0x5c, 0xf8, 0x0e, 0x40, 0x42, 0xf6, 0xe0, 0x12,
+  0x12, 0x99, 0x5c, 0xf8, 0x02, 0xe0, 0x4c, 0x43, 0x42, 0xf6, 0xa0, 0x12,
+  0x0e, 0xfb, 0x03, 0x44, 0x5c, 0xf8, 0x02, 0x60, 0x11, 0x98, 0x42, 0xf6,
+  0x60, 0x12, 0x06, 0xfb, 0x00, 0x46, 0x5c, 0xf8, 0x02, 0x40, 0x10, 0x98,
+  0x42, 0xf6, 0x20, 0x12, 0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40,
+  0x0f, 0x98, 0x42, 0xf6, 0xe0, 0x02, 0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8,
+  0x02, 0x40, 0x0e, 0x98, 0x42, 0xf6, 0xa0, 0x02, 0x04, 0xfb, 0x00, 0x66,
+  0x5c, 0xf8, 0x02, 0x40, 0x0d, 0x98, 0x42, 0xf6, 0x60, 0x02, 0x04, 0xfb,
+  0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x0c, 0x98, 0x42, 0xf6, 0x20, 0x02,
+  0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x0b, 0x98, 0x42, 0xf2,
+  0xe0, 0x72, 0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x0a, 0x98,
+  0x42, 0xf2, 0xa0, 0x72, 0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40,
+  0x09, 0x98, 0x42, 0xf2, 0x60, 0x72, 0x04, 0xfb, 0x00, 0x66, 0x5c, 0xf8,
+  0x02, 0x40, 0x08, 0x98, 0x42, 0xf2, 0x20, 0x72, 0x04, 0xfb, 0x00, 0x66,
+  0x5c, 0xf8, 0x02, 0x40, 0x07, 0x98, 0x42, 0xf2, 0xe0, 0x62, 0x04, 0xfb,
+  0x00, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x42, 0xf2, 0xa0, 0x62, 0x04, 0xfb,
+  0x08, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x42, 0xf2, 0x60, 0x62, 0x04, 0xfb,
+  0x0a, 0x66, 0x5c, 0xf8, 0x02, 0x40, 0x06, 0x99, 0x04, 0xfb, 0x05, 0x66,
+  0x01, 0xeb, 0x0b, 0x04, 0x42, 0xf6, 0x20, 0x2e, 0xbc, 0x42, 0x4c, 0xf8,
+  0x09, 0x60, 0x00, 0xf2, 0x8b, 0x80, 0x42, 0xf6, 0x64, 0x01, 0x0c, 0xeb,
+  0x01, 0x06, 0xd6, 0xf8, 0xc0, 0x41, 0x12, 0x98, 0xd6, 0xf8, 0x80, 0x21,
+  0x44, 0x43, 0x02, 0xfb, 0x03, 0x42, 0xd6, 0xf8, 0x40, 0x41, 0x11, 0x98,
+  0x0b, 0xf1, 0x08, 0x0b, 0x04, 0xfb, 0x00, 0x22, 0xd6, 0xf8, 0x00, 0x41,
+  0x10, 0x98, 0xbb, 0xf1, 0x40, 0x0f, 0x04, 0xfb, 0x00, 0x22, 0xd6, 0xf8,
+  0xc0, 0x40, 0x0f, 0x98, 0x04, 0xfb, 0x00, 0x22, 0xd6, 0xf8, 0x80, 0x40,
+  0x0e, 0x98, 0x04, 0xfb, 0x00, 0x22, 0x34, 0x6c, 0x0d, 0x98, 0x04, 0xfb,
+  0x00, 0x22, 0x5c, 0xf8, 0x01, 0x40, 0x0c, 0x98, 0x42, 0xf2, 0x64, 0x71,
+  0x04, 0xfb, 0x00, 0x22, 0x56, 0xf8, 0x40, 0x4c, 0x0b, 0x98, 0x04, 0xfb,
+  0x00, 0x22, 0x56, 0xf8, 0x80, 0x4c, 0x0a, 0x98, 0x56, 0xf8, 0xc0, 0x6c,
+  0x04, 0xfb, 0x00, 0x22, 0x09, 0x98, 0x06, 0xfb, 0x00, 0x22, 0x5c, 0xf8,
+  0x01, 0x60, 0x08, 0x98, 0x42, 0xf2, 0x24, 0x71, 0x06, 0xfb, 0x00, 0x22,
+  0x5c, 0xf8, 0x01, 0x60, 0x07, 0x98, 0x42, 0xf2, 0xe4, 0x61, 0x06, 0xfb,
+  0x00, 0x22, 0x5c, 0xf8, 0x01, 0x60, 0x42, 0xf2, 0xa4, 0x61, 0x06, 0xfb,
+  0x08, 0x22, 0x5c, 0xf8, 0x01, 0x60, 0x42, 0xf2, 0x64, 0x61, 0x06, 0xfb,
+  0x0a, 0x22, 0x5c, 0xf8, 0x01, 0x60, 0x06, 0xfb, 0x05, 0x22, 0x0c, 0xeb,
+  0x09, 0x06, 0x0c, 0xf1, 0x08, 0x0c, 0x72, 0x60, 0x7f, 0xf4, 0x20, 0xaf,
+  0x05, 0x98, 0x06, 0x99, 0x01, 0x30, 0x09, 0xf1, 0x40, 0x09, 0x10, 0x28,
+  0x01, 0xf1, 0x40, 0x01, 0x42, 0xf2, 0x9c, 0x26, 0x06, 0x91, 0x7f, 0xf4,
+  0xc8, 0xae, 0x02, 0x9c, 0x3c, 0x20, 0x00, 0xea, 0x94, 0x00, 0x04, 0x99,
+  0x64, 0xf3, 0x89, 0x10, 0x08, 0x44, 0x00, 0x99, 0x42, 0xf2, 0x60, 0x25,
+  0x09, 0x68, 0x42, 0x59, 0x6f, 0xf3, 0x1f, 0x31, 0x4a, 0x40, 0x01, 0x99,
+  0x01, 0x34, 0x8c, 0x42, 0x02, 0x94, 0x42, 0x51, 0x7f, 0xf4, 0xab, 0xae,
+  0x13, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf, 0x03, 0x98, 0x02, 0x21,
+  0x13, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x12, 0x6a,
+  0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0xd0, 0xf8, 0x78, 0x11, 0x42, 0xf6,
+  0x70, 0x2c, 0x40, 0xf2, 0x93, 0x12, 0xd0, 0xf8, 0xb8, 0x31, 0x01, 0xeb,
+  0x0c, 0x0e, 0x49, 0xf6, 0xc5, 0x51, 0xc0, 0xf2, 0x00, 0x12, 0xc8, 0xf2,
+  0x1c, 0x11, 0x00, 0x24, 0x42, 0xf6, 0x60, 0x25, 0x42, 0xf6, 0x64, 0x28,
+  0x42, 0xf6, 0x68, 0x2a, 0x67, 0x19, 0x9f, 0x42, 0x00, 0xf2, 0xb2, 0x80,
+  0x04, 0xeb, 0x08, 0x07, 0x9f, 0x42, 0x00, 0xf2, 0xad, 0x80, 0x04, 0xeb,
+  0x0a, 0x07, 0x9f, 0x42, 0x00, 0xf2, 0xa8, 0x80, 0x42, 0xf6, 0x6c, 0x26,
+  0xa7, 0x19, 0x9f, 0x42, 0x00, 0xf2, 0xa2, 0x80, 0x04, 0xeb, 0x0c, 0x07,
+  0x9f, 0x42, 0x00, 0xf2, 0x9d, 0x80, 0x42, 0xf6, 0x74, 0x26, 0xa7, 0x19,
+  0x9f, 0x42, 0x00, 0xf2, 0x97, 0x80, 0x42, 0xf6, 0x78, 0x26, 0xa7, 0x19,
+  0x9f, 0x42, 0x00, 0xf2, 0x91, 0x80, 0x42, 0xf6, 0x7c, 0x26, 0xa7, 0x19,
+  0x9f, 0x42, 0x00, 0xf2, 0x8b, 0x80, 0x0e, 0xeb, 0x04, 0x0b, 0x5b, 0xf8,
+  0x10, 0x7c, 0x5f, 0xfa, 0x87, 0xf9, 0x81, 0xea, 0x09, 0x01, 0x51, 0x43,
+  0xc7, 0xf3, 0x07, 0x26, 0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x46,
+  0x71, 0x40, 0x5b, 0xf8, 0x0c, 0x6c, 0x51, 0x43, 0x81, 0xea, 0x17, 0x61,
+  0xf7, 0xb2, 0x51, 0x43, 0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x27,
+  0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x47, 0x79, 0x40, 0x5b, 0xf8,
+  0x08, 0x7c, 0x51, 0x43, 0x81, 0xea, 0x16, 0x61, 0xfe, 0xb2, 0x51, 0x43,
+  0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x26, 0x71, 0x40, 0x51, 0x43,
+  0xc7, 0xf3, 0x07, 0x46, 0x71, 0x40, 0x5b, 0xf8, 0x04, 0x6c, 0x51, 0x43,
+  0x81, 0xea, 0x17, 0x61, 0xf7, 0xb2, 0x51, 0x43, 0x79, 0x40, 0x51, 0x43,
+  0xc6, 0xf3, 0x07, 0x27, 0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x47,
+  0x79, 0x40, 0x5e, 0xf8, 0x04, 0x70, 0x51, 0x43, 0x81, 0xea, 0x16, 0x61,
+  0xfe, 0xb2, 0x51, 0x43, 0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x26,
+  0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x46, 0x71, 0x40, 0xdb, 0xf8,
+  0x04, 0x60, 0x51, 0x43, 0x81, 0xea, 0x17, 0x61, 0xf7, 0xb2, 0x51, 0x43,
+  0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x27, 0x79, 0x40, 0x51, 0x43,
+  0xc6, 0xf3, 0x07, 0x47, 0x79, 0x40, 0xdb, 0xf8, 0x08, 0x70, 0x51, 0x43,
+  0x81, 0xea, 0x16, 0x61, 0xfe, 0xb2, 0x51, 0x43, 0x71, 0x40, 0x51, 0x43,
+  0xc7, 0xf3, 0x07, 0x26, 0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x46,
+  0x71, 0x40, 0x51, 0x43, 0xdb, 0xf8, 0x0c, 0x60, 0x81, 0xea, 0x17, 0x61,
+  0x51, 0x43, 0xf7, 0xb2, 0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x27,
+  0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x47, 0x79, 0x40, 0x51, 0x43,
+  0x81, 0xea, 0x16, 0x61, 0x20, 0x34, 0xb4, 0xf5, 0x80, 0x6f, 0x02, 0xfb,
+  0x01, 0xf1, 0x7f, 0xf4, 0x4b, 0xaf, 0x03, 0xe0, 0x02, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0x52, 0x6a, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0xd0, 0xf8, 0x78, 0x21,
+  0x48, 0xf2, 0x20, 0x3b, 0xd0, 0xf8, 0xa8, 0xe1, 0xd0, 0xf8, 0xb8, 0x91,
+  0x42, 0xf6, 0x64, 0x61, 0x46, 0xf2, 0x58, 0x18, 0xce, 0xf6, 0xb8, 0x5b,
+  0x00, 0x92, 0x0a, 0x44, 0x42, 0xf6, 0x60, 0x6a, 0x6f, 0xf0, 0xff, 0x04,
+  0xc4, 0xf6, 0xb2, 0x58, 0x04, 0xf5, 0x80, 0x77, 0x8b, 0xea, 0x97, 0x01,
+  0xbd, 0x07, 0x58, 0xbf, 0xb9, 0x08, 0x8b, 0xea, 0x51, 0x06, 0xcb, 0x07,
+  0x08, 0xbf, 0x4e, 0x08, 0x8b, 0xea, 0x56, 0x01, 0xf3, 0x07, 0x08, 0xbf,
+  0x71, 0x08, 0x8b, 0xea, 0x51, 0x03, 0xce, 0x07, 0x08, 0xbf, 0x4b, 0x08,
+  0x8b, 0xea, 0x53, 0x01, 0xde, 0x07, 0x08, 0xbf, 0x59, 0x08, 0x8b, 0xea,
+  0x51, 0x06, 0xcb, 0x07, 0x08, 0xbf, 0x4e, 0x08, 0xca, 0x45, 0x7b, 0xd8,
+  0xf3, 0x07, 0x4f, 0xea, 0x56, 0x01, 0x43, 0x46, 0x18, 0xbf, 0x81, 0xea,
+  0x0b, 0x01, 0x00, 0x2d, 0x5c, 0xbf, 0x42, 0xf2, 0xc8, 0x03, 0xc3, 0xf6,
+  0x6e, 0x33, 0x83, 0xea, 0xd7, 0x03, 0x7d, 0x07, 0x48, 0xbf, 0x83, 0xea,
+  0x0b, 0x03, 0x8b, 0xea, 0x53, 0x05, 0xde, 0x07, 0x08, 0xbf, 0x5d, 0x08,
+  0x8b, 0xea, 0x55, 0x03, 0xee, 0x07, 0x08, 0xbf, 0x6b, 0x08, 0x8b, 0xea,
+  0x53, 0x05, 0xde, 0x07, 0x08, 0xbf, 0x5d, 0x08, 0x8b, 0xea, 0x55, 0x07,
+  0xeb, 0x07, 0x08, 0xbf, 0x6f, 0x08, 0x0a, 0xf1, 0x04, 0x05, 0x4d, 0x45,
+  0x42, 0xf8, 0x04, 0x1c, 0x4e, 0xd8, 0x79, 0x08, 0xfb, 0x07, 0x18, 0xbf,
+  0x81, 0xea, 0x0b, 0x01, 0x42, 0xf8, 0x08, 0x1b, 0x02, 0x34, 0x05, 0xf1,
+  0x04, 0x0a, 0xa5, 0xd1, 0x00, 0x99, 0x4f, 0xf2, 0x5f, 0x38, 0x46, 0xf2,
+  0x0d, 0x62, 0x43, 0xf2, 0x61, 0x2b, 0xc3, 0xf6, 0x6e, 0x48, 0xc0, 0xf2,
+  0x19, 0x02, 0x01, 0xeb, 0x0b, 0x04, 0x04, 0x26, 0x00, 0x25, 0x43, 0xf2,
+  0x60, 0x2a, 0x43, 0xf2, 0x62, 0x29, 0x00, 0xbf, 0x05, 0xeb, 0x0a, 0x07,
+  0x77, 0x45, 0x2b, 0xd8, 0x06, 0xfb, 0x02, 0x86, 0x05, 0xeb, 0x0b, 0x0c,
+  0x33, 0x0e, 0x67, 0x19, 0xf4, 0x45, 0x07, 0xf8, 0x01, 0x3c, 0x21, 0xd8,
+  0x06, 0xfb, 0x02, 0x86, 0x05, 0xeb, 0x09, 0x01, 0x33, 0x0e, 0x71, 0x45,
+  0x63, 0x55, 0x19, 0xd8, 0x06, 0xfb, 0x02, 0x86, 0x43, 0xf2, 0x63, 0x23,
+  0x2b, 0x44, 0x31, 0x0e, 0x73, 0x45, 0x79, 0x70, 0x10, 0xd8, 0x06, 0xfb,
+  0x02, 0x86, 0x04, 0x35, 0x31, 0x0e, 0xb5, 0xf5, 0x80, 0x6f, 0xb9, 0x70,
+  0xd8, 0xd1, 0x00, 0x9a, 0x43, 0xf2, 0x60, 0x60, 0x00, 0x21, 0x11, 0x50,
+  0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf, 0x02, 0x21, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x28, 0xc0,
+  0x02, 0x46, 0x80, 0x68, 0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x03, 0x07, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0x01, 0x29, 0x4a, 0xdb,
+  0xd0, 0xf8, 0x78, 0xb1, 0xd0, 0xf8, 0xa8, 0xe1, 0xd0, 0xf8, 0xb8, 0xc1,
+  0x43, 0xf2, 0x61, 0x22, 0x0b, 0xeb, 0x02, 0x05, 0x4f, 0xf0, 0x00, 0x09,
+  0x42, 0xf6, 0x60, 0x6a, 0x00, 0x95, 0x4f, 0xf0, 0xff, 0x37, 0x4f, 0xf4,
+  0x80, 0x66, 0x43, 0xf2, 0x61, 0x24, 0x62, 0x1e, 0x72, 0x45, 0x35, 0xd8,
+  0x15, 0xf8, 0x01, 0x2c, 0x5f, 0xfa, 0x87, 0xf8, 0x82, 0xea, 0x08, 0x02,
+  0x0a, 0xeb, 0x82, 0x02, 0x62, 0x45, 0x98, 0xbf, 0x74, 0x45, 0x29, 0xd8,
+  0x5b, 0xf8, 0x02, 0x20, 0x82, 0xea, 0x17, 0x27, 0x2a, 0x78, 0xfb, 0xb2,
+  0x5a, 0x40, 0x0a, 0xeb, 0x82, 0x02, 0x62, 0x45, 0x1e, 0xd8, 0x5b, 0xf8,
+  0x02, 0x20, 0x02, 0x3e, 0x82, 0xea, 0x17, 0x27, 0x05, 0xf1, 0x02, 0x05,
+  0x04, 0xf1, 0x02, 0x04, 0xdb, 0xd1, 0x4a, 0x46, 0x6f, 0xf3, 0x9f, 0x22,
+  0x43, 0xf2, 0x60, 0x23, 0xd4, 0x18, 0x74, 0x45, 0x0c, 0xd8, 0x09, 0xf1,
+  0x01, 0x09, 0x00, 0x9d, 0xfa, 0x43, 0x89, 0x45, 0x0b, 0xf8, 0x04, 0x20,
+  0xc5, 0xd1, 0xc5, 0xf8, 0xff, 0x23, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x02, 0x21, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02,
+  0xd2, 0x6a, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a, 0x07, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x06, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0xd0, 0xf8, 0x78, 0x01, 0x43, 0xf2, 0x60, 0x61,
+  0x40, 0x58, 0x70, 0x47, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0x12, 0x6b, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0,
+  0xd0, 0xf8, 0x78, 0xe1, 0x40, 0xf2, 0x00, 0x17, 0x44, 0xf2, 0x40, 0x01,
+  0xc0, 0xf2, 0x02, 0x37, 0x40, 0xf2, 0x04, 0x55, 0xd0, 0xf8, 0xa8, 0x21,
+  0x0e, 0xeb, 0x01, 0x03, 0x07, 0xf1, 0x08, 0x36, 0xc0, 0xf2, 0x06, 0x75,
+  0x00, 0x90, 0x05, 0xf1, 0x08, 0x34, 0x4e, 0xf8, 0x01, 0x70, 0xc3, 0xe9,
+  0x01, 0x56, 0x01, 0x20, 0x0c, 0x27, 0x4f, 0xf0, 0x08, 0x0c, 0x44, 0xf2,
+  0x53, 0x01, 0x10, 0x26, 0xdc, 0x60, 0x0c, 0x1f, 0x94, 0x42, 0x00, 0xf2,
+  0xbf, 0x80, 0x0e, 0xeb, 0x01, 0x05, 0x15, 0xf8, 0x06, 0x8c, 0x15, 0xf8,
+  0x05, 0xbc, 0x15, 0xf8, 0x04, 0xac, 0x16, 0xf0, 0x0c, 0x0f, 0x24, 0xd1,
+  0x08, 0xf5, 0x80, 0x59, 0x91, 0x45, 0x00, 0xf2, 0xaf, 0x80, 0x0a, 0xf5,
+  0x80, 0x54, 0x94, 0x42, 0x00, 0xf2, 0xaa, 0x80, 0x0b, 0xf5, 0x80, 0x58,
+  0x90, 0x45, 0x00, 0xf2, 0xa5, 0x80, 0x10, 0x23, 0x63, 0xf3, 0x1f, 0x27,
+  0x97, 0x42, 0x00, 0xf2, 0x9f, 0x80, 0x1e, 0xf8, 0x09, 0x90, 0x1e, 0xf8,
+  0x04, 0xb0, 0x44, 0xb2, 0x1b, 0x23, 0x1e, 0xf8, 0x07, 0xa0, 0x1e, 0xf8,
+  0x08, 0x80, 0x03, 0xea, 0xd4, 0x14, 0x80, 0xea, 0x09, 0x07, 0x84, 0xea,
+  0x40, 0x00, 0xa1, 0xf1, 0x13, 0x04, 0x94, 0x42, 0x00, 0xf2, 0x8a, 0x80,
+  0xcc, 0x1e, 0x94, 0x42, 0x00, 0xf2, 0x86, 0x80, 0x15, 0xf8, 0x13, 0x4c,
+  0x67, 0x40, 0x8c, 0x1e, 0x94, 0x42, 0x05, 0xf8, 0x03, 0x7c, 0x7d, 0xd8,
+  0x15, 0xf8, 0x12, 0x4c, 0x4b, 0x1e, 0x84, 0xea, 0x08, 0x04, 0x93, 0x42,
+  0x05, 0xf8, 0x02, 0x4c, 0x74, 0xd8, 0x15, 0xf8, 0x11, 0x3c, 0x91, 0x42,
+  0x83, 0xea, 0x0b, 0x03, 0x05, 0xf8, 0x01, 0x3c, 0x6c, 0xd8, 0x15, 0xf8,
+  0x10, 0x3c, 0x0c, 0xf1, 0x04, 0x0c, 0x83, 0xea, 0x0a, 0x03, 0x0e, 0xf8,
+  0x01, 0x30, 0x04, 0x31, 0xbc, 0xf1, 0xa8, 0x0f, 0x06, 0xf1, 0x04, 0x06,
+  0x9b, 0xd3, 0x43, 0xf2, 0x7f, 0x60, 0x70, 0x44, 0x00, 0x21, 0x00, 0x22,
+  0x83, 0x18, 0x81, 0xf0, 0x33, 0x07, 0x03, 0xf8, 0x0c, 0x7c, 0x81, 0xf0,
+  0x22, 0x07, 0x03, 0xf8, 0x0d, 0x7c, 0x02, 0xf1, 0x11, 0x07, 0x07, 0xf0,
+  0x0d, 0x07, 0x47, 0xea, 0x07, 0x17, 0x4f, 0x40, 0x03, 0xf8, 0x0e, 0x7c,
+  0x81, 0xf0, 0x77, 0x07, 0x03, 0xf8, 0x08, 0x7c, 0x81, 0xf0, 0x66, 0x07,
+  0x03, 0xf8, 0x09, 0x7c, 0x57, 0x1d, 0x07, 0xf0, 0x0d, 0x07, 0x47, 0xea,
+  0x07, 0x17, 0x4f, 0x40, 0x03, 0xf8, 0x0a, 0x7c, 0x81, 0xf0, 0x44, 0x07,
+  0x03, 0xf8, 0x0b, 0x7c, 0x81, 0xf0, 0xbb, 0x07, 0x03, 0xf8, 0x04, 0x7c,
+  0x81, 0xf0, 0xaa, 0x07, 0x03, 0xf8, 0x05, 0x7c, 0x02, 0xf1, 0x09, 0x07,
+  0x07, 0xf0, 0x0d, 0x07, 0x47, 0xea, 0x07, 0x17, 0x4f, 0x40, 0x03, 0xf8,
+  0x06, 0x7c, 0x81, 0xf0, 0x88, 0x07, 0x03, 0xf8, 0x07, 0x7c, 0xcf, 0x43,
+  0x87, 0x54, 0x81, 0xf0, 0xee, 0x07, 0x03, 0xf8, 0x01, 0x7c, 0x02, 0xf1,
+  0x0d, 0x07, 0x07, 0xf0, 0x0d, 0x07, 0x47, 0xea, 0x07, 0x17, 0x4f, 0x40,
+  0x10, 0x32, 0x03, 0xf8, 0x0f, 0x1c, 0x03, 0xf8, 0x02, 0x7c, 0x81, 0xf0,
+  0xcc, 0x07, 0xb2, 0xf5, 0x80, 0x7f, 0x01, 0xf1, 0x01, 0x01, 0x03, 0xf8,
+  0x03, 0x7c, 0xa9, 0xd1, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0x00, 0x98, 0x02, 0x21, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+  0x00, 0x03, 0xd3, 0xf8, 0x34, 0xc0, 0x02, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x03, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0xbc, 0xb0,
+  0x01, 0x29, 0xc0, 0xf2, 0x89, 0x82, 0xd0, 0xf8, 0x78, 0x71, 0x44, 0xf2,
+  0x40, 0x02, 0x3a, 0x44, 0xd3, 0x7b, 0x21, 0x93, 0x93, 0x7b, 0x20, 0x93,
+  0x53, 0x7b, 0x1f, 0x93, 0x13, 0x7b, 0x1e, 0x93, 0xd3, 0x7a, 0x1d, 0x93,
+  0x93, 0x7a, 0x1c, 0x93, 0x53, 0x7a, 0x1b, 0x93, 0x13, 0x7a, 0x1a, 0x93,
+  0xd3, 0x79, 0x19, 0x93, 0x93, 0x79, 0x18, 0x93, 0x53, 0x79, 0x17, 0x93,
+  0x13, 0x79, 0x16, 0x93, 0x13, 0x78, 0x15, 0x93, 0x53, 0x78, 0x14, 0x93,
+  0x93, 0x78, 0xd2, 0x78, 0x13, 0x93, 0x12, 0x92, 0x44, 0xf2, 0x57, 0x02,
+  0x3a, 0x44, 0x2b, 0x97, 0x29, 0x92, 0xd0, 0xf8, 0xa8, 0x21, 0x2a, 0x92,
+  0x00, 0x22, 0x01, 0x92, 0x43, 0xf2, 0x7f, 0x62, 0x00, 0x91, 0x02, 0x90,
+  0x00, 0x20, 0x23, 0x90, 0x02, 0xeb, 0x00, 0x12, 0x2a, 0x98, 0x11, 0x46,
+  0x82, 0x42, 0x22, 0x92, 0x00, 0xf2, 0x50, 0x82, 0x23, 0x98, 0x43, 0xf2,
+  0x7e, 0x61, 0x07, 0x01, 0x22, 0x98, 0x2b, 0x9b, 0x39, 0x44, 0x11, 0x91,
+  0x18, 0x5c, 0x21, 0x9a, 0x59, 0x5c, 0x50, 0x40, 0x34, 0x90, 0x20, 0x98,
+  0x43, 0xf2, 0x72, 0x65, 0x48, 0x40, 0x33, 0x90, 0x43, 0xf2, 0x7d, 0x60,
+  0x43, 0xf2, 0x7c, 0x61, 0x38, 0x44, 0x39, 0x44, 0x10, 0x90, 0x0f, 0x91,
+  0x18, 0x5c, 0x1f, 0x9a, 0x59, 0x5c, 0x80, 0xea, 0x02, 0x0e, 0x1e, 0x98,
+  0x48, 0x40, 0x37, 0x90, 0x43, 0xf2, 0x7b, 0x60, 0x43, 0xf2, 0x7a, 0x61,
+  0x38, 0x44, 0x39, 0x44, 0x0e, 0x90, 0x0d, 0x91, 0x18, 0x5c, 0x1d, 0x9a,
+  0x59, 0x5c, 0x80, 0xea, 0x02, 0x0b, 0x1c, 0x98, 0x48, 0x40, 0x32, 0x90,
+  0x43, 0xf2, 0x79, 0x60, 0x43, 0xf2, 0x78, 0x61, 0x38, 0x44, 0x39, 0x44,
+  0x0c, 0x90, 0x0b, 0x91, 0x18, 0x5c, 0x1b, 0x9a, 0x59, 0x5c, 0x50, 0x40,
+  0x31, 0x90, 0x1a, 0x98, 0x81, 0xea, 0x00, 0x09, 0x43, 0xf2, 0x77, 0x60,
+  0x43, 0xf2, 0x76, 0x61, 0x38, 0x44, 0x39, 0x44, 0x0a, 0x90, 0x09, 0x91,
+  0x18, 0x5c, 0x19, 0x9a, 0x59, 0x5c, 0x50, 0x40, 0x18, 0x9a, 0x81, 0xea,
+  0x02, 0x04, 0x43, 0xf2, 0x75, 0x61, 0x43, 0xf2, 0x74, 0x62, 0x39, 0x44,
+  0x3a, 0x44, 0x08, 0x91, 0x07, 0x92, 0x59, 0x5c, 0x9e, 0x5c, 0x17, 0x9a,
+  0x51, 0x40, 0x30, 0x91, 0x16, 0x9a, 0x72, 0x40, 0x43, 0xf2, 0x73, 0x66,
+  0xb9, 0x19, 0x06, 0x91, 0x13, 0xf8, 0x01, 0xc0, 0x79, 0x19, 0x05, 0x91,
+  0x12, 0x9e, 0x5d, 0x5c, 0x8c, 0xea, 0x06, 0x0c, 0x13, 0x9e, 0x6e, 0x40,
+  0x43, 0xf2, 0x71, 0x65, 0x79, 0x19, 0x43, 0xf2, 0x70, 0x65, 0x3d, 0x44,
+  0x03, 0x91, 0x04, 0x95, 0x5f, 0x5c, 0x59, 0x5d, 0x14, 0x9d, 0x23, 0x46,
+  0x6f, 0x40, 0x15, 0x9d, 0x00, 0x24, 0x81, 0xea, 0x05, 0x08, 0x01, 0x21,
+  0x2f, 0x94, 0x00, 0xbf, 0x3a, 0x91, 0x2b, 0x9d, 0x4f, 0xf4, 0x80, 0x51,
+  0x55, 0xfa, 0x83, 0xf3, 0x5b, 0x5c, 0x55, 0xfa, 0x8b, 0xf4, 0x2d, 0x93,
+  0x37, 0x9b, 0x14, 0xf8, 0x01, 0xa0, 0x55, 0xfa, 0x87, 0xf4, 0x14, 0xf8,
+  0x01, 0xb0, 0x55, 0xfa, 0x83, 0xf4, 0x55, 0xfa, 0x80, 0xf0, 0x67, 0x5c,
+  0x44, 0x5c, 0x55, 0xfa, 0x86, 0xf0, 0x46, 0x5c, 0x55, 0xfa, 0x8e, 0xf0,
+  0x40, 0x5c, 0x2e, 0x90, 0x55, 0xfa, 0x89, 0xf0, 0x10, 0xf8, 0x01, 0xe0,
+  0x55, 0xfa, 0x8c, 0xf0, 0x10, 0xf8, 0x01, 0xc0, 0x33, 0x98, 0x55, 0xfa,
+  0x80, 0xf0, 0x40, 0x5c, 0x35, 0x90, 0x31, 0x98, 0x55, 0xfa, 0x80, 0xf0,
+  0x40, 0x5c, 0x3b, 0x90, 0x55, 0xfa, 0x82, 0xf0, 0x42, 0x5c, 0x34, 0x98,
+  0x55, 0xfa, 0x80, 0xf0, 0x40, 0x5c, 0x36, 0x90, 0x32, 0x98, 0x55, 0xfa,
+  0x80, 0xf0, 0x40, 0x5c, 0x34, 0x90, 0x30, 0x98, 0x55, 0xfa, 0x80, 0xf0,
+  0x43, 0x5c, 0x55, 0xfa, 0x88, 0xf0, 0x10, 0xf8, 0x01, 0x80, 0x3a, 0x98,
+  0x39, 0x92, 0x09, 0x28, 0xcd, 0xe9, 0x37, 0x73, 0x00, 0xf2, 0xe0, 0x80,
+  0x2d, 0x9b, 0x87, 0xea, 0x0b, 0x05, 0x87, 0xea, 0x0a, 0x00, 0x85, 0xea,
+  0x03, 0x01, 0x81, 0xea, 0x40, 0x07, 0x40, 0xb2, 0x4f, 0xf0, 0x1b, 0x09,
+  0x09, 0xea, 0xd0, 0x10, 0x78, 0x40, 0x28, 0x95, 0x33, 0x90, 0x83, 0xea,
+  0x0a, 0x00, 0x47, 0xb2, 0x09, 0xea, 0xd7, 0x17, 0x81, 0xea, 0x0a, 0x01,
+  0x87, 0xea, 0x40, 0x00, 0x30, 0x91, 0x85, 0xea, 0x0a, 0x01, 0x48, 0x40,
+  0x32, 0x90, 0x8b, 0xea, 0x03, 0x00, 0x8b, 0xea, 0x40, 0x01, 0x40, 0xb2,
+  0x09, 0xea, 0xd0, 0x10, 0x48, 0x40, 0x2c, 0x90, 0x2e, 0x9d, 0x8e, 0xea,
+  0x04, 0x00, 0x8e, 0xea, 0x05, 0x0a, 0x8a, 0xea, 0x06, 0x01, 0x81, 0xea,
+  0x40, 0x03, 0x40, 0xb2, 0x09, 0xea, 0xd0, 0x10, 0x27, 0x46, 0x58, 0x40,
+  0xdd, 0xf8, 0xd0, 0xb0, 0x35, 0x9c, 0x31, 0x90, 0x86, 0xea, 0x07, 0x00,
+  0x43, 0xb2, 0x09, 0xea, 0xd3, 0x13, 0x79, 0x40, 0x83, 0xea, 0x40, 0x00,
+  0x26, 0x91, 0x8a, 0xea, 0x07, 0x01, 0x48, 0x40, 0x2d, 0x90, 0x85, 0xea,
+  0x06, 0x00, 0x85, 0xea, 0x40, 0x01, 0x40, 0xb2, 0x09, 0xea, 0xd0, 0x10,
+  0x48, 0x40, 0x25, 0x90, 0x3b, 0x9b, 0x82, 0xea, 0x0c, 0x01, 0x82, 0xea,
+  0x03, 0x00, 0x80, 0xea, 0x04, 0x07, 0x87, 0xea, 0x41, 0x02, 0x49, 0xb2,
+  0x09, 0xea, 0xd1, 0x11, 0x51, 0x40, 0x2e, 0x91, 0x84, 0xea, 0x0c, 0x01,
+  0x4a, 0xb2, 0x09, 0xea, 0xd2, 0x12, 0x82, 0xea, 0x41, 0x02, 0x87, 0xea,
+  0x0c, 0x01, 0x80, 0xea, 0x0c, 0x07, 0x7a, 0x40, 0x83, 0xea, 0x04, 0x07,
+  0x83, 0xea, 0x47, 0x0c, 0x7f, 0xb2, 0x09, 0xea, 0xd7, 0x17, 0x27, 0x92,
+  0x8c, 0xea, 0x07, 0x02, 0x35, 0x92, 0x38, 0x9d, 0x36, 0x9c, 0x73, 0x46,
+  0x88, 0xea, 0x05, 0x0e, 0x88, 0xea, 0x04, 0x07, 0x5a, 0x46, 0x8b, 0xea,
+  0x0e, 0x0b, 0xc4, 0x46, 0x8b, 0xea, 0x47, 0x08, 0x7f, 0xb2, 0x09, 0xea,
+  0xd7, 0x17, 0x88, 0xea, 0x07, 0x06, 0x82, 0xea, 0x04, 0x07, 0x3b, 0x96,
+  0x16, 0x46, 0x7a, 0xb2, 0x09, 0xea, 0xd2, 0x12, 0x82, 0xea, 0x47, 0x02,
+  0x8b, 0xea, 0x04, 0x07, 0x84, 0xea, 0x0e, 0x04, 0x62, 0x40, 0x85, 0xea,
+  0x06, 0x04, 0x24, 0x92, 0x85, 0xea, 0x44, 0x02, 0x64, 0xb2, 0x09, 0xea,
+  0xd4, 0x14, 0x62, 0x40, 0x28, 0x9d, 0x37, 0x9c, 0x2c, 0x9e, 0x84, 0xea,
+  0x45, 0x04, 0x6d, 0xb2, 0x09, 0xea, 0xd5, 0x15, 0x6c, 0x40, 0x30, 0x9d,
+  0x86, 0xea, 0x05, 0x0b, 0x6c, 0x40, 0x4f, 0xfa, 0x8a, 0xf5, 0x37, 0x94,
+  0x83, 0xea, 0x4a, 0x04, 0x09, 0xea, 0xd5, 0x15, 0x6c, 0x40, 0xdd, 0xe9,
+  0x25, 0x53, 0x85, 0xea, 0x03, 0x08, 0x63, 0x40, 0x30, 0x93, 0x39, 0x9b,
+  0x83, 0xea, 0x40, 0x03, 0x40, 0xb2, 0x09, 0xea, 0xd0, 0x10, 0x58, 0x40,
+  0x35, 0x9b, 0x48, 0x40, 0x83, 0xea, 0x01, 0x05, 0x4f, 0xfa, 0x8e, 0xf1,
+  0x39, 0x90, 0x8c, 0xea, 0x4e, 0x00, 0x09, 0xea, 0xd1, 0x11, 0x48, 0x40,
+  0x82, 0xea, 0x07, 0x01, 0x78, 0x40, 0x38, 0x91, 0x2c, 0x90, 0x27, 0x98,
+  0xdd, 0xf8, 0xb8, 0xc0, 0xdd, 0xe9, 0x32, 0x2a, 0x35, 0x90, 0x3b, 0x98,
+  0x31, 0x9c, 0x2d, 0x9e, 0x36, 0x90, 0xdd, 0xf8, 0x90, 0xe0, 0xdd, 0xf8,
+  0xbc, 0x90, 0x0a, 0xe0, 0xcd, 0xf8, 0xb0, 0x80, 0xcd, 0xf8, 0xc0, 0xe0,
+  0x0d, 0xf1, 0xb4, 0x09, 0x3b, 0x9d, 0xdd, 0xf8, 0xd0, 0xe0, 0x99, 0xe8,
+  0x04, 0x03, 0x44, 0xf2, 0x5f, 0x00, 0x2a, 0x99, 0x48, 0x44, 0x88, 0x42,
+  0x00, 0xf2, 0x90, 0x80, 0x17, 0x46, 0x29, 0x9a, 0x3b, 0x95, 0x02, 0xeb,
+  0x09, 0x05, 0x28, 0x7a, 0xe9, 0x79, 0x80, 0xea, 0x0a, 0x00, 0x34, 0x90,
+  0x87, 0xea, 0x01, 0x00, 0x33, 0x90, 0xa8, 0x79, 0x69, 0x79, 0x8b, 0xea,
+  0x00, 0x0a, 0x37, 0x98, 0x23, 0x46, 0x48, 0x40, 0x37, 0x90, 0x28, 0x79,
+  0xe9, 0x78, 0x84, 0xea, 0x00, 0x0b, 0x86, 0xea, 0x01, 0x00, 0x32, 0x90,
+  0xa8, 0x78, 0x69, 0x78, 0x80, 0xea, 0x08, 0x00, 0x31, 0x90, 0x30, 0x98,
+  0x4c, 0x46, 0x80, 0xea, 0x01, 0x09, 0x10, 0x5d, 0x15, 0xf8, 0x01, 0x1c,
+  0x35, 0x9a, 0x3b, 0x9f, 0x82, 0xea, 0x01, 0x03, 0x15, 0xf8, 0x02, 0x1c,
+  0x15, 0xf8, 0x03, 0x2c, 0x79, 0x40, 0x30, 0x91, 0x39, 0x99, 0x15, 0xf8,
+  0x04, 0x7c, 0x4a, 0x40, 0x36, 0x99, 0x80, 0xea, 0x0c, 0x00, 0x81, 0xea,
+  0x07, 0x0c, 0x15, 0xf8, 0x06, 0x7c, 0x38, 0x99, 0x15, 0xf8, 0x05, 0x6c,
+  0x15, 0xf8, 0x07, 0x5c, 0x4f, 0x40, 0x2c, 0x99, 0x10, 0x34, 0x2f, 0x94,
+  0x81, 0xea, 0x05, 0x08, 0x3a, 0x99, 0x86, 0xea, 0x0e, 0x06, 0xd6, 0x46,
+  0xa0, 0x2c, 0x01, 0xf1, 0x01, 0x01, 0x7f, 0xf4, 0x71, 0xae, 0x22, 0x99,
+  0x34, 0x9c, 0x2b, 0x9d, 0x6c, 0x54, 0x11, 0x99, 0x33, 0x9c, 0x6c, 0x54,
+  0x10, 0x99, 0x1c, 0x46, 0x05, 0xf8, 0x01, 0xe0, 0x0f, 0x99, 0x37, 0x9b,
+  0x6b, 0x54, 0x0e, 0x99, 0x32, 0x9b, 0x05, 0xf8, 0x01, 0xb0, 0x0d, 0x99,
+  0x6b, 0x54, 0x0c, 0x99, 0x31, 0x9b, 0x6b, 0x54, 0x0b, 0x99, 0x05, 0xf8,
+  0x01, 0x90, 0x0a, 0x99, 0x68, 0x54, 0x09, 0x98, 0x30, 0x99, 0x2c, 0x54,
+  0x08, 0x98, 0x29, 0x54, 0x07, 0x98, 0x04, 0x99, 0x2a, 0x54, 0x06, 0x98,
+  0x43, 0xf2, 0x7f, 0x62, 0x05, 0xf8, 0x00, 0xc0, 0x05, 0x98, 0x05, 0xf8,
+  0x01, 0x80, 0x2e, 0x54, 0x03, 0x98, 0x2f, 0x54, 0x23, 0x98, 0x01, 0x30,
+  0x10, 0x28, 0x7f, 0xf4, 0xb2, 0xad, 0x01, 0x98, 0x00, 0x99, 0x01, 0x30,
+  0x88, 0x42, 0x01, 0x90, 0x7f, 0xf4, 0xaa, 0xad, 0x3c, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x02, 0x98, 0x02, 0x21, 0x3c, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x6b, 0x01, 0x46, 0x80, 0x68,
+  0x01, 0xab, 0x9a, 0x1a, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x43,
+  0x81, 0xb0, 0xd0, 0xf8, 0x78, 0x11, 0x43, 0xf2, 0x71, 0x6c, 0x40, 0xf2,
+  0x93, 0x1e, 0xd0, 0xf8, 0xa8, 0x31, 0x01, 0xeb, 0x0c, 0x02, 0x49, 0xf6,
+  0xc5, 0x51, 0xc0, 0xf2, 0x00, 0x1e, 0xc8, 0xf2, 0x1c, 0x11, 0x00, 0x24,
+  0x43, 0xf2, 0x70, 0x65, 0x43, 0xf2, 0x72, 0x69, 0x43, 0xf2, 0x73, 0x68,
+  0x67, 0x19, 0x9f, 0x42, 0x26, 0xd8, 0x04, 0xeb, 0x0c, 0x07, 0x9f, 0x42,
+  0x22, 0xd8, 0x04, 0xeb, 0x09, 0x07, 0x9f, 0x42, 0x1e, 0xd8, 0x04, 0xeb,
+  0x08, 0x07, 0x9f, 0x42, 0x1a, 0xd8, 0x17, 0x19, 0x17, 0xf8, 0x01, 0x6c,
+  0x71, 0x40, 0x16, 0x5d, 0x01, 0xfb, 0x0e, 0xf1, 0x71, 0x40, 0x7e, 0x78,
+  0x01, 0xfb, 0x0e, 0xf1, 0x71, 0x40, 0xbe, 0x78, 0x01, 0xfb, 0x0e, 0xf1,
+  0x71, 0x40, 0x04, 0x34, 0xb4, 0xf5, 0x80, 0x7f, 0x01, 0xfb, 0x0e, 0xf1,
+  0xda, 0xd1, 0x08, 0x46, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x83, 0x00, 0xbf,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x83, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x6b, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0x9a, 0x1a, 0x07, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x00, 0xbf, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x82, 0xb0,
+  0xd0, 0xf8, 0x78, 0x31, 0x00, 0x90, 0xd0, 0xf8, 0xc0, 0x21, 0x43, 0xf2,
+  0x70, 0x70, 0x05, 0x21, 0x01, 0x93, 0x19, 0x50, 0x00, 0x23, 0x43, 0xf2,
+  0x98, 0x7b, 0x43, 0xf6, 0x38, 0x0a, 0x43, 0xf6, 0x58, 0x08, 0x43, 0xf6,
+  0x78, 0x09, 0x4f, 0xf0, 0x00, 0x0e, 0x43, 0xf2, 0xb8, 0x75, 0x43, 0xf2,
+  0xd8, 0x71, 0x43, 0xf2, 0xf8, 0x76, 0x0e, 0xeb, 0x0b, 0x07, 0x97, 0x42,
+  0x00, 0xf2, 0xd6, 0x80, 0x01, 0x9f, 0x43, 0xf2, 0x90, 0x7c, 0x77, 0x44,
+  0x07, 0xeb, 0x0b, 0x04, 0x63, 0x60, 0x07, 0xeb, 0x0c, 0x04, 0x43, 0xf2,
+  0x88, 0x70, 0x63, 0x60, 0x3c, 0x18, 0x63, 0x60, 0x0e, 0xeb, 0x05, 0x04,
+  0x47, 0xf8, 0x0c, 0x30, 0x43, 0xf6, 0x18, 0x0c, 0x3b, 0x50, 0x94, 0x42,
+  0x07, 0xf5, 0x5e, 0x54, 0x4f, 0xf4, 0x5e, 0x50, 0x47, 0xf8, 0x0b, 0x30,
+  0x3b, 0x50, 0x63, 0x60, 0x00, 0xf2, 0xb6, 0x80, 0x7c, 0x19, 0x43, 0xf2,
+  0xb0, 0x70, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf2, 0xa8, 0x70,
+  0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x63, 0x60, 0x0e, 0xeb, 0x01, 0x04,
+  0x43, 0xf2, 0xa0, 0x70, 0x94, 0x42, 0x07, 0xeb, 0x00, 0x04, 0x7b, 0x51,
+  0x3b, 0x50, 0x63, 0x60, 0x00, 0xf2, 0x9e, 0x80, 0x7c, 0x18, 0x43, 0xf2,
+  0xd0, 0x70, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf2, 0xc8, 0x70,
+  0x63, 0x60, 0x3c, 0x18, 0x63, 0x60, 0x0e, 0xeb, 0x06, 0x04, 0x3b, 0x50,
+  0x94, 0x42, 0x07, 0xf5, 0x5f, 0x54, 0x4f, 0xf4, 0x5f, 0x50, 0x7b, 0x50,
+  0x3b, 0x50, 0x63, 0x60, 0x00, 0xf2, 0x86, 0x80, 0xbc, 0x19, 0x43, 0xf2,
+  0xf0, 0x70, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf2, 0xe8, 0x70,
+  0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x63, 0x60, 0x0e, 0xeb, 0x0c, 0x04,
+  0x43, 0xf2, 0xe0, 0x70, 0x94, 0x42, 0x07, 0xeb, 0x00, 0x04, 0xbb, 0x51,
+  0x3b, 0x50, 0x63, 0x60, 0x6e, 0xd8, 0x07, 0xeb, 0x0c, 0x04, 0x43, 0xf6,
+  0x10, 0x00, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf6, 0x08, 0x00,
+  0x63, 0x60, 0x3c, 0x18, 0x63, 0x60, 0x0e, 0xeb, 0x0a, 0x04, 0x3b, 0x50,
+  0x94, 0x42, 0x07, 0xf5, 0x60, 0x54, 0x4f, 0xf4, 0x60, 0x50, 0x47, 0xf8,
+  0x0c, 0x30, 0x3b, 0x50, 0x63, 0x60, 0x55, 0xd8, 0x43, 0xf6, 0x38, 0x00,
+  0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf6, 0x30, 0x00, 0x63, 0x60, 0x3c, 0x18,
+  0x3b, 0x50, 0x43, 0xf6, 0x28, 0x00, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50,
+  0x63, 0x60, 0x0e, 0xeb, 0x08, 0x04, 0x43, 0xf6, 0x20, 0x00, 0x43, 0xf6,
+  0x38, 0x0a, 0x94, 0x42, 0x07, 0xeb, 0x00, 0x04, 0x3b, 0x50, 0x63, 0x60,
+  0x3a, 0xd8, 0x43, 0xf6, 0x58, 0x00, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf6,
+  0x50, 0x00, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf6, 0x48, 0x00,
+  0x63, 0x60, 0x3c, 0x18, 0x63, 0x60, 0x0e, 0xeb, 0x09, 0x04, 0x43, 0xf6,
+  0x58, 0x08, 0x3b, 0x50, 0x94, 0x42, 0x07, 0xf5, 0x61, 0x54, 0x4f, 0xf4,
+  0x61, 0x50, 0x3b, 0x50, 0x63, 0x60, 0x1f, 0xd8, 0x43, 0xf6, 0x78, 0x00,
+  0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf6, 0x70, 0x00, 0x63, 0x60, 0x3c, 0x18,
+  0x3b, 0x50, 0x43, 0xf6, 0x68, 0x00, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50,
+  0x43, 0xf6, 0x60, 0x00, 0x0e, 0xf5, 0x80, 0x7e, 0x43, 0xf6, 0x78, 0x09,
+  0x63, 0x60, 0x3c, 0x18, 0xbe, 0xf5, 0x80, 0x6f, 0x3b, 0x50, 0x63, 0x60,
+  0x7f, 0xf4, 0x29, 0xaf, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0x00, 0x98, 0x02, 0x21, 0x02, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2,
+  0x00, 0x02, 0x12, 0x6c, 0x01, 0xab, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69,
+  0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0x01, 0x29, 0x4c, 0xdb, 0xd0, 0xf8,
+  0x08, 0xa0, 0x80, 0x46, 0xda, 0xf8, 0x78, 0x71, 0xda, 0xf8, 0xb8, 0x51,
+  0x4f, 0xf2, 0x5f, 0x34, 0x46, 0xf2, 0x0d, 0x66, 0x43, 0xf2, 0x70, 0x70,
+  0x89, 0x46, 0xc3, 0xf6, 0x6e, 0x44, 0xc0, 0xf2, 0x19, 0x06, 0x07, 0xeb,
+  0x00, 0x0c, 0x4f, 0xf0, 0x00, 0x0b, 0xdc, 0xf8, 0x00, 0x10, 0x4f, 0xf4,
+  0x5e, 0x50, 0x00, 0xbf, 0xa8, 0x42, 0x33, 0xd8, 0x01, 0xfb, 0x06, 0x41,
+  0x02, 0x1d, 0xaa, 0x42, 0x39, 0x50, 0x2d, 0xd8, 0x01, 0xfb, 0x06, 0x41,
+  0x00, 0xf1, 0x08, 0x03, 0x3a, 0x18, 0xab, 0x42, 0x51, 0x60, 0x25, 0xd8,
+  0x01, 0xfb, 0x06, 0x41, 0x00, 0xf1, 0x0c, 0x03, 0xab, 0x42, 0x91, 0x60,
+  0x1e, 0xd8, 0x01, 0xfb, 0x06, 0x41, 0x10, 0x30, 0xb0, 0xf5, 0x6e, 0x5f,
+  0xd1, 0x60, 0xe1, 0xd1, 0xcc, 0xf8, 0x00, 0x10, 0x40, 0x46, 0x4f, 0xf4,
+  0x5e, 0x51, 0x4f, 0xf4, 0x80, 0x72, 0xcd, 0xf8, 0x00, 0xc0, 0xff, 0xf7,
+  0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0xdd, 0xf8, 0x00, 0xc0, 0x18, 0xb9,
+  0x0b, 0xf1, 0x01, 0x0b, 0xcb, 0x45, 0xc8, 0xd1, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x50, 0x46, 0x02, 0x21, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x44, 0xc0, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x0c, 0x06, 0xd3, 0x03, 0x69, 0x9c, 0x45, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x89, 0xb0, 0x83, 0x68, 0x11, 0x2a, 0xd3, 0xf8, 0x78, 0xa1, 0xd3, 0xf8,
+  0xb8, 0x91, 0x06, 0x93, 0xcd, 0xe9, 0x07, 0xa1, 0x08, 0xda, 0x90, 0x46,
+  0xb8, 0xf1, 0x02, 0x0f, 0x80, 0xf2, 0xfa, 0x80, 0x09, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x00, 0xbf, 0x03, 0x90, 0xaa, 0xf1, 0x04, 0x00, 0x05, 0x90,
+  0xaa, 0xf1, 0x08, 0x00, 0x04, 0x90, 0x6f, 0xf0, 0x02, 0x00, 0x08, 0x99,
+  0x00, 0xea, 0x42, 0x00, 0x08, 0x44, 0x48, 0x45, 0x00, 0xf2, 0x14, 0x81,
+  0xdd, 0xf8, 0x1c, 0xa0, 0xa2, 0xf1, 0x01, 0x0e, 0x5a, 0xf8, 0x00, 0x80,
+  0x00, 0x24, 0x05, 0x98, 0xa5, 0x00, 0x00, 0xeb, 0x84, 0x06, 0x0a, 0xeb,
+  0x84, 0x01, 0x23, 0x46, 0x08, 0x98, 0x44, 0x19, 0x4c, 0x45, 0x00, 0xf2,
+  0x01, 0x81, 0x08, 0x98, 0x0f, 0x58, 0x47, 0x45, 0x22, 0xd2, 0x20, 0x1d,
+  0x48, 0x45, 0x00, 0xf2, 0xf9, 0x80, 0x08, 0x98, 0x08, 0x44, 0x47, 0x68,
+  0x47, 0x45, 0x1f, 0xd2, 0x04, 0xf1, 0x08, 0x07, 0x4f, 0x45, 0x00, 0xf2,
+  0xef, 0x80, 0x87, 0x68, 0x47, 0x45, 0x1d, 0xd2, 0x04, 0xf1, 0x0c, 0x07,
+  0x4f, 0x45, 0x00, 0xf2, 0xe7, 0x80, 0xc7, 0x68, 0x10, 0x36, 0x10, 0x35,
+  0x10, 0x31, 0x47, 0x45, 0x03, 0xf1, 0x04, 0x03, 0xd8, 0xd3, 0x58, 0x1e,
+  0x02, 0x90, 0x08, 0x98, 0x30, 0x44, 0x0f, 0xe0, 0x02, 0x93, 0x08, 0x98,
+  0x01, 0x33, 0x08, 0x44, 0x0a, 0xe0, 0x00, 0xbf, 0x59, 0x1c, 0x02, 0x91,
+  0x02, 0x33, 0x04, 0x30, 0x04, 0xe0, 0x00, 0xbf, 0x99, 0x1c, 0x02, 0x91,
+  0x03, 0x33, 0x08, 0x30, 0x01, 0x90, 0x07, 0x98, 0x4f, 0xea, 0x8e, 0x0a,
+  0x00, 0xeb, 0x8e, 0x0c, 0x04, 0x98, 0x00, 0xeb, 0x8e, 0x01, 0x05, 0x98,
+  0x00, 0xeb, 0x8e, 0x0b, 0x0e, 0xf1, 0x01, 0x0e, 0x08, 0x98, 0x50, 0x44,
+  0x48, 0x45, 0x00, 0xf2, 0xb7, 0x80, 0x08, 0x9c, 0x0b, 0xeb, 0x04, 0x05,
+  0x6e, 0x68, 0x46, 0x45, 0x2c, 0xd9, 0x04, 0x38, 0x48, 0x45, 0x00, 0xf2,
+  0xad, 0x80, 0x08, 0x9c, 0x5b, 0xf8, 0x04, 0x60, 0x46, 0x45, 0x31, 0xd9,
+  0x04, 0x38, 0x48, 0x45, 0x00, 0xf2, 0xa4, 0x80, 0x55, 0xf8, 0x04, 0x6c,
+  0x46, 0x45, 0x3b, 0xd9, 0x04, 0x38, 0x48, 0x45, 0x00, 0xf2, 0x9c, 0x80,
+  0x55, 0xf8, 0x08, 0x6c, 0xac, 0xf1, 0x10, 0x0c, 0x10, 0x39, 0xae, 0xf1,
+  0x04, 0x0e, 0xab, 0xf1, 0x10, 0x0b, 0x46, 0x45, 0xaa, 0xf1, 0x10, 0x0a,
+  0xd2, 0xd8, 0x08, 0x98, 0x60, 0x44, 0x05, 0x1d, 0xae, 0xf1, 0x01, 0x0c,
+  0x02, 0x9c, 0xdd, 0xf8, 0x1c, 0xa0, 0x74, 0x45, 0x17, 0xdd, 0x1b, 0xe0,
+  0x08, 0x98, 0x0c, 0xeb, 0x00, 0x05, 0xae, 0xf1, 0x02, 0x0c, 0xae, 0xf1,
+  0x01, 0x0e, 0x02, 0x9c, 0xdd, 0xf8, 0x1c, 0xa0, 0x74, 0x45, 0x0a, 0xdd,
+  0x0e, 0xe0, 0x00, 0xbf, 0xae, 0xf1, 0x03, 0x0c, 0xae, 0xf1, 0x02, 0x0e,
+  0x02, 0x9c, 0xdd, 0xf8, 0x1c, 0xa0, 0x74, 0x45, 0x04, 0xdc, 0x01, 0x98,
+  0xe6, 0x46, 0x1c, 0x46, 0x06, 0x60, 0x2f, 0x60, 0x74, 0x45, 0x7f, 0xf7,
+  0x58, 0xaf, 0x0b, 0xe0, 0x08, 0x98, 0xae, 0xf1, 0x04, 0x0c, 0xae, 0xf1,
+  0x03, 0x0e, 0x0d, 0x18, 0x02, 0x9c, 0xdd, 0xf8, 0x1c, 0xa0, 0x74, 0x45,
+  0xeb, 0xdd, 0xef, 0xe7, 0x0e, 0xf1, 0x01, 0x08, 0x15, 0x1b, 0xa8, 0x45,
+  0x10, 0xda, 0x03, 0x98, 0x08, 0x99, 0x42, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x98, 0x90, 0xf8, 0x68, 0x00, 0x00, 0x28, 0x7f, 0xf4, 0x20, 0xaf,
+  0x08, 0x98, 0xa8, 0x46, 0x00, 0xeb, 0x84, 0x00, 0x08, 0x90, 0x0c, 0xe0,
+  0x08, 0x98, 0x2a, 0x46, 0x00, 0xeb, 0x84, 0x01, 0x03, 0x98, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x98, 0x90, 0xf8, 0x68, 0x00, 0x00, 0x28, 0x7f, 0xf4,
+  0x0d, 0xaf, 0xb8, 0xf1, 0x10, 0x0f, 0x42, 0x46, 0x3f, 0xf7, 0x13, 0xaf,
+  0x02, 0xe7, 0x00, 0xbf, 0x08, 0x9c, 0x0a, 0xf1, 0x04, 0x00, 0x01, 0x21,
+  0x02, 0x25, 0x08, 0x9a, 0x02, 0xeb, 0x81, 0x02, 0x4a, 0x45, 0x23, 0xd8,
+  0x07, 0x9b, 0x9e, 0x58, 0x2a, 0x46, 0x23, 0x46, 0x4b, 0x45, 0x1d, 0xd8,
+  0xc7, 0x18, 0x57, 0xf8, 0x04, 0x7c, 0xb7, 0x42, 0x08, 0xd9, 0x01, 0x3a,
+  0xc7, 0x50, 0x01, 0x2a, 0xa3, 0xf1, 0x04, 0x03, 0xf2, 0xdc, 0x00, 0x22,
+  0x01, 0xe0, 0x00, 0xbf, 0x01, 0x3a, 0x08, 0x9b, 0x03, 0xeb, 0x82, 0x02,
+  0x4a, 0x45, 0x09, 0xd8, 0x07, 0x9b, 0x01, 0x31, 0x04, 0x34, 0x41, 0x45,
+  0x05, 0xf1, 0x01, 0x05, 0x9e, 0x50, 0xd8, 0xd1, 0xd8, 0xe6, 0x00, 0xbf,
+  0x06, 0x98, 0x02, 0x21, 0x09, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2,
+  0x00, 0x02, 0x92, 0x6c, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0xd0, 0xf8,
+  0x78, 0x71, 0x4f, 0xf4, 0x5e, 0x51, 0x57, 0xf8, 0x01, 0xe0, 0xd0, 0xf8,
+  0xb8, 0x21, 0x43, 0xf2, 0x8c, 0x71, 0x39, 0x44, 0x43, 0xf2, 0x84, 0x73,
+  0x76, 0x46, 0x93, 0x42, 0x00, 0xf2, 0xd4, 0x80, 0x51, 0xf8, 0x08, 0x5c,
+  0xae, 0x42, 0x00, 0xf2, 0xd7, 0x80, 0x1e, 0x1d, 0x96, 0x42, 0x00, 0xf2,
+  0xcb, 0x80, 0x51, 0xf8, 0x04, 0x6c, 0xb5, 0x42, 0x00, 0xf2, 0xce, 0x80,
+  0x03, 0xf1, 0x08, 0x05, 0x95, 0x42, 0x00, 0xf2, 0xc1, 0x80, 0x0d, 0x68,
+  0xae, 0x42, 0x00, 0xf2, 0xc5, 0x80, 0x03, 0xf1, 0x0c, 0x06, 0x96, 0x42,
+  0x00, 0xf2, 0xb8, 0x80, 0x4c, 0x68, 0xa5, 0x42, 0x00, 0xf2, 0xbc, 0x80,
+  0x03, 0xf1, 0x10, 0x06, 0x96, 0x42, 0x00, 0xf2, 0xaf, 0x80, 0x8e, 0x68,
+  0xb4, 0x42, 0x00, 0xf2, 0xb3, 0x80, 0x14, 0x33, 0xb3, 0xf5, 0x6e, 0x5f,
+  0x01, 0xf1, 0x14, 0x01, 0xcd, 0xd1, 0x49, 0xf6, 0xc5, 0x53, 0x40, 0xf2,
+  0x93, 0x1c, 0x5f, 0xfa, 0x8e, 0xf1, 0xc8, 0xf2, 0x1c, 0x13, 0xc0, 0xf2,
+  0x00, 0x1c, 0x59, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xce, 0xf3, 0x07, 0x23,
+  0x59, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xce, 0xf3, 0x07, 0x43, 0x59, 0x40,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x1e, 0x61, 0x43, 0xf2, 0x8c, 0x73,
+  0x01, 0xfb, 0x0c, 0xf1, 0x07, 0xeb, 0x03, 0x0e, 0x43, 0xf2, 0x84, 0x73,
+  0x93, 0x42, 0x00, 0xf2, 0x81, 0x80, 0x1c, 0x1d, 0x94, 0x42, 0x7d, 0xd8,
+  0x03, 0xf1, 0x08, 0x04, 0x94, 0x42, 0x79, 0xd8, 0x03, 0xf1, 0x0c, 0x04,
+  0x94, 0x42, 0x75, 0xd8, 0x03, 0xf1, 0x10, 0x04, 0x94, 0x42, 0x71, 0xd8,
+  0x5e, 0xf8, 0x08, 0x7c, 0x5e, 0xf8, 0x04, 0x5c, 0xfc, 0xb2, 0x61, 0x40,
+  0x01, 0xfb, 0x0c, 0xf1, 0xc7, 0xf3, 0x07, 0x24, 0x61, 0x40, 0x01, 0xfb,
+  0x0c, 0xf1, 0xc7, 0xf3, 0x07, 0x44, 0x61, 0x40, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x17, 0x61, 0x5f, 0xfa, 0x85, 0xfa, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x0a, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc5, 0xf3, 0x07, 0x24,
+  0x61, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xc5, 0xf3, 0x07, 0x44, 0x61, 0x40,
+  0xde, 0xf8, 0x00, 0x60, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x15, 0x61,
+  0x5f, 0xfa, 0x86, 0xf9, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x09, 0x01,
+  0x01, 0xfb, 0x0c, 0xf1, 0xc6, 0xf3, 0x07, 0x24, 0x61, 0x40, 0x01, 0xfb,
+  0x0c, 0xf1, 0xc6, 0xf3, 0x07, 0x44, 0x61, 0x40, 0xde, 0xf8, 0x04, 0xb0,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x16, 0x61, 0x5f, 0xfa, 0x8b, 0xf8,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x08, 0x01, 0x01, 0xfb, 0x0c, 0xf1,
+  0xcb, 0xf3, 0x07, 0x24, 0x61, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xcb, 0xf3,
+  0x07, 0x44, 0x61, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xde, 0xf8, 0x08, 0x40,
+  0x81, 0xea, 0x1b, 0x61, 0x01, 0xfb, 0x0c, 0xf1, 0xe5, 0xb2, 0x69, 0x40,
+  0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x25, 0x69, 0x40, 0x01, 0xfb,
+  0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x45, 0x69, 0x40, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x14, 0x61, 0x14, 0x33, 0x01, 0xfb, 0x0c, 0xf1, 0xb3, 0xf5,
+  0x6e, 0x5f, 0x0e, 0xf1, 0x14, 0x0e, 0x7f, 0xf4, 0x7d, 0xaf, 0x03, 0xe0,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2,
+  0x00, 0x02, 0xd2, 0x6c, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0xd0, 0xf8, 0x78, 0x21, 0xd0, 0xf8,
+  0xb0, 0x11, 0x01, 0x27, 0x4f, 0xf4, 0x6e, 0x56, 0x97, 0x55, 0x43, 0xf6,
+  0x20, 0x46, 0x02, 0xf5, 0x6e, 0x53, 0xb1, 0x42, 0x1f, 0x74, 0x1f, 0x75,
+  0x83, 0xf8, 0x20, 0x70, 0x83, 0xf8, 0x28, 0x70, 0x83, 0xf8, 0x30, 0x70,
+  0x83, 0xf8, 0x34, 0x70, 0x83, 0xf8, 0x40, 0x70, 0x83, 0xf8, 0x50, 0x70,
+  0x83, 0xf8, 0x60, 0x70, 0x83, 0xf8, 0x64, 0x70, 0x83, 0xf8, 0x70, 0x70,
+  0x83, 0xf8, 0x78, 0x70, 0x83, 0xf8, 0x80, 0x70, 0x83, 0xf8, 0x84, 0x70,
+  0x83, 0xf8, 0x90, 0x70, 0x04, 0xd2, 0x02, 0x21, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x4f, 0xf2, 0x5f, 0x3e, 0x46, 0xf2, 0x0d, 0x6b,
+  0x43, 0xf6, 0x24, 0x4c, 0x45, 0xf2, 0xad, 0x77, 0xc3, 0xf6, 0x6e, 0x4e,
+  0xc0, 0xf2, 0x19, 0x0b, 0x62, 0x44, 0xc3, 0xf6, 0x07, 0x57, 0x00, 0x24,
+  0x43, 0xf6, 0x22, 0x4a, 0x43, 0xf6, 0x26, 0x49, 0x43, 0xf6, 0x28, 0x48,
+  0x04, 0xeb, 0x0a, 0x03, 0x3d, 0x0c, 0x16, 0x19, 0x8b, 0x42, 0x26, 0xf8,
+  0x04, 0x5c, 0xdc, 0xd8, 0x07, 0xfb, 0x0b, 0xe7, 0x04, 0xeb, 0x0c, 0x05,
+  0x3b, 0x0c, 0x8d, 0x42, 0x26, 0xf8, 0x02, 0x3c, 0xd3, 0xd8, 0x07, 0xfb,
+  0x0b, 0xe7, 0xb4, 0xf5, 0x06, 0x7f, 0x4f, 0xea, 0x17, 0x43, 0x13, 0x53,
+  0x08, 0xbf, 0xbd, 0xe8, 0xf0, 0x8f, 0x04, 0xeb, 0x09, 0x03, 0x8b, 0x42,
+  0xc5, 0xd8, 0x07, 0xfb, 0x0b, 0xe3, 0x1d, 0x0c, 0x03, 0xfb, 0x0b, 0xe7,
+  0x04, 0xeb, 0x08, 0x03, 0x08, 0x34, 0x8b, 0x42, 0x75, 0x80, 0xd5, 0xd9,
+  0xb9, 0xe7, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+  0x00, 0x03, 0xd3, 0xf8, 0x50, 0xc0, 0x02, 0x46, 0x80, 0x68, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x03, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x90, 0xb0,
+  0x01, 0x29, 0xc0, 0xf2, 0x01, 0x81, 0xd0, 0xf8, 0x78, 0x51, 0x03, 0x46,
+  0x05, 0xf5, 0x6e, 0x50, 0x0c, 0x46, 0x90, 0xf8, 0x90, 0x10, 0x47, 0xf6,
+  0xff, 0x76, 0x00, 0x29, 0x18, 0xbf, 0x01, 0x21, 0x90, 0xf8, 0x84, 0x20,
+  0xc9, 0x02, 0x0e, 0x91, 0x90, 0xf8, 0x80, 0x10, 0x00, 0x2a, 0x18, 0xbf,
+  0x4f, 0xf4, 0x10, 0x62, 0x0f, 0x92, 0x00, 0x29, 0x90, 0xf8, 0x78, 0x20,
+  0x18, 0xbf, 0x4f, 0xf4, 0x20, 0x61, 0x0d, 0x91, 0x90, 0xf8, 0x70, 0x10,
+  0x00, 0x2a, 0x18, 0xbf, 0x4f, 0xf4, 0x30, 0x62, 0x0c, 0x92, 0x00, 0x29,
+  0x90, 0xf8, 0x64, 0x20, 0x18, 0xbf, 0x4f, 0xf4, 0x40, 0x61, 0x0b, 0x91,
+  0x90, 0xf8, 0x60, 0x10, 0x00, 0x2a, 0x18, 0xbf, 0x4f, 0xf4, 0x50, 0x62,
+  0x0a, 0x92, 0x00, 0x29, 0x90, 0xf8, 0x50, 0x20, 0x18, 0xbf, 0x4f, 0xf4,
+  0x60, 0x61, 0x09, 0x91, 0x90, 0xf8, 0x40, 0x10, 0x00, 0x2a, 0x18, 0xbf,
+  0x4f, 0xf4, 0x70, 0x62, 0x08, 0x92, 0x00, 0x29, 0x90, 0xf8, 0x34, 0x20,
+  0x18, 0xbf, 0x4f, 0xf4, 0x70, 0x61, 0x07, 0x91, 0x90, 0xf8, 0x30, 0x10,
+  0x00, 0x2a, 0x18, 0xbf, 0x4f, 0xf4, 0x60, 0x62, 0x90, 0xf8, 0x28, 0xe0,
+  0x06, 0x92, 0x00, 0x29, 0x18, 0xbf, 0x4f, 0xf4, 0x50, 0x61, 0x90, 0xf8,
+  0x20, 0x90, 0x05, 0x91, 0xbe, 0xf1, 0x00, 0x0f, 0x18, 0xbf, 0x4f, 0xf4,
+  0x40, 0x6e, 0x90, 0xf8, 0x14, 0xc0, 0xb9, 0xf1, 0x00, 0x0f, 0x18, 0xbf,
+  0x4f, 0xf4, 0x30, 0x69, 0x90, 0xf8, 0x10, 0x80, 0xbc, 0xf1, 0x00, 0x0f,
+  0x18, 0xbf, 0x4f, 0xf4, 0x20, 0x6c, 0x02, 0x78, 0xb8, 0xf1, 0x00, 0x0f,
+  0x00, 0x90, 0x18, 0xbf, 0x4f, 0xf4, 0x10, 0x68, 0x00, 0x2a, 0x18, 0xbf,
+  0x01, 0x22, 0xd0, 0x02, 0x04, 0x90, 0xd3, 0xf8, 0xb0, 0xa1, 0x43, 0xf6,
+  0x3e, 0x40, 0x29, 0x46, 0x05, 0xeb, 0x00, 0x0b, 0x00, 0x25, 0x01, 0x94,
+  0x03, 0x93, 0x00, 0x27, 0x02, 0x95, 0x00, 0xbf, 0x43, 0xf6, 0x3e, 0x40,
+  0x3a, 0x18, 0x52, 0x45, 0x7a, 0xd8, 0x0b, 0xeb, 0x07, 0x02, 0x32, 0xf9,
+  0x02, 0x3c, 0x0f, 0x9d, 0x3b, 0xf9, 0x07, 0x40, 0x0e, 0x98, 0x6b, 0x43,
+  0x32, 0xf9, 0x04, 0x5c, 0x10, 0xfb, 0x04, 0x33, 0x0d, 0x98, 0x32, 0xf9,
+  0x06, 0x4c, 0x10, 0xfb, 0x05, 0x33, 0x0c, 0x98, 0x32, 0xf9, 0x08, 0x5c,
+  0x10, 0xfb, 0x04, 0x33, 0x0b, 0x98, 0x32, 0xf9, 0x0a, 0x4c, 0x10, 0xfb,
+  0x05, 0x33, 0x0a, 0x98, 0x32, 0xf9, 0x0c, 0x5c, 0x10, 0xfb, 0x04, 0x33,
+  0x09, 0x98, 0x32, 0xf9, 0x0e, 0x4c, 0x10, 0xfb, 0x05, 0x33, 0x08, 0x98,
+  0x32, 0xf9, 0x10, 0x5c, 0x10, 0xfb, 0x04, 0x33, 0x07, 0x98, 0x32, 0xf9,
+  0x12, 0x4c, 0x10, 0xfb, 0x05, 0x33, 0x06, 0x98, 0x32, 0xf9, 0x14, 0x5c,
+  0x10, 0xfb, 0x04, 0x33, 0x05, 0x98, 0x32, 0xf9, 0x16, 0x4c, 0x10, 0xfb,
+  0x05, 0x33, 0x32, 0xf9, 0x18, 0x5c, 0x1e, 0xfb, 0x04, 0x33, 0x32, 0xf9,
+  0x1a, 0x4c, 0x19, 0xfb, 0x05, 0x33, 0x1c, 0xfb, 0x04, 0x33, 0x32, 0xf9,
+  0x1c, 0x4c, 0x32, 0xf9, 0x1e, 0x2c, 0x04, 0x98, 0x18, 0xfb, 0x04, 0x33,
+  0x10, 0xfb, 0x02, 0x33, 0xda, 0x13, 0x12, 0xf5, 0x00, 0x4f, 0x48, 0xf2,
+  0x00, 0x02, 0xcf, 0xf6, 0xff, 0x72, 0xc8, 0xbf, 0xda, 0x13, 0x07, 0xf5,
+  0x79, 0x53, 0x53, 0x45, 0x20, 0xd8, 0xb2, 0x42, 0x01, 0xeb, 0x07, 0x03,
+  0x07, 0xf1, 0x02, 0x07, 0xa8, 0xbf, 0x32, 0x46, 0xb7, 0xf5, 0x00, 0x7f,
+  0x4f, 0xf4, 0x79, 0x50, 0x1a, 0x52, 0x93, 0xd1, 0x00, 0x9b, 0x02, 0x9d,
+  0xb3, 0xf9, 0xbe, 0x34, 0x01, 0x9c, 0xea, 0xb2, 0x01, 0x35, 0x01, 0xeb,
+  0x42, 0x02, 0x5b, 0x08, 0xa5, 0x42, 0x43, 0xf6, 0x3e, 0x40, 0x13, 0x52,
+  0x7f, 0xf4, 0x81, 0xaf, 0x10, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x00, 0xbf,
+  0x03, 0x98, 0x02, 0x21, 0x10, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0xc0, 0xf2,
+  0x00, 0x02, 0x52, 0x6d, 0x01, 0x46, 0x80, 0x68, 0x01, 0xab, 0x9a, 0x1a,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0xf0, 0xb5, 0x81, 0xb0, 0x40, 0xf2, 0x93, 0x1c,
+  0xd0, 0xf8, 0x78, 0xe1, 0xd0, 0xf8, 0xa8, 0x21, 0x49, 0xf6, 0xc5, 0x51,
+  0xc0, 0xf2, 0x00, 0x1c, 0xc8, 0xf2, 0x1c, 0x11, 0x4f, 0xf4, 0x79, 0x53,
+  0x44, 0xf2, 0x40, 0x04, 0x93, 0x42, 0x21, 0xd8, 0x5d, 0x1c, 0x95, 0x42,
+  0x1e, 0xd8, 0x9d, 0x1c, 0x95, 0x42, 0x1b, 0xd8, 0xdd, 0x1c, 0x95, 0x42,
+  0x18, 0xd8, 0x1e, 0xf8, 0x03, 0x50, 0x0e, 0xeb, 0x03, 0x06, 0x69, 0x40,
+  0x75, 0x78, 0x01, 0xfb, 0x0c, 0xf1, 0xb7, 0x78, 0x69, 0x40, 0x01, 0xfb,
+  0x0c, 0xf1, 0xf6, 0x78, 0x79, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0x71, 0x40,
+  0x04, 0x33, 0xa3, 0x42, 0x01, 0xfb, 0x0c, 0xf1, 0xde, 0xd1, 0x08, 0x46,
+  0x01, 0xb0, 0xf0, 0xbd, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x21,
+  0x08, 0x46, 0x01, 0xb0, 0xf0, 0xbd, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+  0x9e, 0x08, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x30, 0x0b, 0x00, 0x00,
+  0xb8, 0x0c, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x48, 0x11, 0x00, 0x00,
+  0x6e, 0x14, 0x00, 0x00, 0x50, 0x16, 0x00, 0x00, 0xfc, 0x17, 0x00, 0x00,
+  0xe4, 0x18, 0x00, 0x00, 0x24, 0x19, 0x00, 0x00, 0x32, 0x1b, 0x00, 0x00,
+  0x9a, 0x20, 0x00, 0x00, 0x64, 0x21, 0x00, 0x00, 0x96, 0x23, 0x00, 0x00,
+  0x7e, 0x24, 0x00, 0x00, 0x32, 0x27, 0x00, 0x00, 0x4e, 0x29, 0x00, 0x00,
+  0x62, 0x2a, 0x00, 0x00, 0xba, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd5, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x07, 0x00, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x66, 0x69, 0x72, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x66, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x69, 0x69, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x69, 0x69, 0x72, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x69, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x73, 0x75, 0x6d, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x63, 0x72, 0x63, 0x33,
+  0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x61, 0x65, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x61, 0x65, 0x73, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x61, 0x65, 0x73, 0x5f,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x73, 0x6f, 0x72, 0x74,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x73, 0x6f, 0x72, 0x74, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x71, 0x31, 0x35, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x74,
+  0x65, 0x78, 0x74, 0x00, 0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73,
+  0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00,
+  0x1a, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78,
+  0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68,
+  0x5f, 0x69, 0x64, 0x00, 0x0c, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75,
+  0x6e, 0x63, 0x23, 0x31, 0x37, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x9a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x58, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x26, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x34, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x38, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xa2, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe2, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x66, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x78, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x9a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x44, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x4c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x72, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x96, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x42, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x58, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7a, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0e, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4e, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x5e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x96, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x9e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x56, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x68, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x8e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x92, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9a, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9e, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbc, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x52, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x7a, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x82, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x86, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x84, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xaa, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2e, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x36, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x36, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x52, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x56, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x76, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdc, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x66, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbe, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
+};
+unsigned int kernels_bench_aot_len = 14660;
@@ -4,7 +4,7 @@ unsigned char fft_bench_aot[] = {
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x74, 0x68, 0x75, 0x6d, 0x62, 0x76, 0x37, 0x65, 0x6d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x11, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -352,133 +352,1433 @@ unsigned char fft_bench_aot[] = {
   0xb0, 0x0a, 0xc9, 0xbc, 0xb6, 0xc9, 0x96, 0xbc, 0x90, 0x0e, 0x49, 0xbc,
   0x89, 0x0f, 0xc9, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x70, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x10, 0xd4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61,
+  0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x58, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x09, 0x68,
+  0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x80, 0xb5, 0xb6, 0xee,
+  0x00, 0x0a, 0xd0, 0xf8, 0x78, 0x11, 0xd0, 0xf8, 0xb8, 0xc1, 0x01, 0xf5,
+  0xa0, 0x52, 0x4f, 0xf4, 0xa0, 0x51, 0x00, 0x23, 0x61, 0x45, 0x2e, 0xd8,
+  0x01, 0xee, 0x10, 0x3a, 0x08, 0x31, 0x61, 0x45, 0xb8, 0xee, 0xc1, 0x1a,
+  0x11, 0xee, 0x10, 0xea, 0xc2, 0xf8, 0x00, 0xe0, 0x23, 0xd8, 0x01, 0x33,
+  0x04, 0x39, 0x02, 0xee, 0x10, 0x3a, 0x61, 0x45, 0xb8, 0xee, 0xc2, 0x2a,
+  0x12, 0xee, 0x10, 0xea, 0xc2, 0xf8, 0x08, 0xe0, 0x17, 0xd8, 0x21, 0xee,
+  0x00, 0x1a, 0x08, 0x31, 0x61, 0x45, 0x11, 0xee, 0x10, 0xea, 0xc2, 0xf8,
+  0x04, 0xe0, 0x0e, 0xd8, 0x22, 0xee, 0x00, 0x1a, 0x01, 0x33, 0xb3, 0xf5,
+  0x80, 0x6f, 0x01, 0xf1, 0x04, 0x01, 0x11, 0xee, 0x10, 0xea, 0xc2, 0xf8,
+  0x0c, 0xe0, 0x02, 0xf1, 0x10, 0x02, 0xcf, 0xd1, 0x80, 0xbd, 0x02, 0x21,
+  0xbd, 0xe8, 0x80, 0x40, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x68,
+  0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x89, 0xb0, 0x01, 0x29, 0xc0, 0xf2, 0xfd, 0x80, 0xd0, 0xf8, 0x78, 0xa1,
+  0x41, 0xf2, 0x04, 0x4e, 0xd0, 0xf8, 0xb8, 0xb1, 0x0a, 0xf5, 0xa0, 0x52,
+  0x08, 0x92, 0x00, 0x22, 0x05, 0x92, 0x07, 0x90, 0x04, 0x91, 0x00, 0x27,
+  0x00, 0x26, 0xbe, 0x42, 0x27, 0xda, 0x4f, 0xf4, 0xa0, 0x50, 0x00, 0xeb,
+  0xc6, 0x05, 0x5d, 0x45, 0x9e, 0xbf, 0x4f, 0xf4, 0xa0, 0x50, 0x00, 0xeb,
+  0xc7, 0x01, 0x59, 0x45, 0x00, 0xf2, 0xe2, 0x80, 0xf3, 0x00, 0x0a, 0xeb,
+  0x05, 0x04, 0x73, 0x44, 0x5a, 0xf8, 0x05, 0x50, 0x5b, 0x45, 0x5a, 0xf8,
+  0x01, 0x20, 0x22, 0x60, 0x9e, 0xbf, 0xfa, 0x00, 0x02, 0xeb, 0x0e, 0x04,
+  0x5c, 0x45, 0x00, 0xf2, 0xd1, 0x80, 0x0a, 0xeb, 0x03, 0x02, 0x51, 0x44,
+  0x5a, 0xf8, 0x04, 0x00, 0x13, 0x68, 0x10, 0x60, 0x0d, 0x60, 0x4a, 0xf8,
+  0x04, 0x30, 0xb8, 0x05, 0x07, 0xd4, 0x4f, 0xf4, 0x00, 0x74, 0x01, 0x36,
+  0x27, 0x43, 0xb6, 0xf5, 0x80, 0x6f, 0xcc, 0xd1, 0x17, 0xe0, 0x4f, 0xf4,
+  0x00, 0x75, 0x6f, 0x40, 0x6c, 0x08, 0x17, 0xea, 0x55, 0x0f, 0xf2, 0xd0,
+  0x67, 0x40, 0xac, 0x08, 0x17, 0xea, 0x95, 0x0f, 0xed, 0xd0, 0x67, 0x40,
+  0xec, 0x08, 0x17, 0xea, 0xd5, 0x0f, 0xe8, 0xd0, 0x67, 0x40, 0x2c, 0x09,
+  0x17, 0xea, 0x15, 0x1f, 0x25, 0x46, 0xea, 0xd1, 0xe1, 0xe7, 0x02, 0x27,
+  0x78, 0x10, 0x4f, 0xf0, 0x01, 0x08, 0x01, 0x28, 0x4f, 0xea, 0xc7, 0x00,
+  0x01, 0x90, 0x4f, 0xf4, 0x80, 0x60, 0xb0, 0xfb, 0xf7, 0xf0, 0x4f, 0xea,
+  0x80, 0x03, 0x4f, 0xf0, 0x00, 0x01, 0xc8, 0xbf, 0x4f, 0xea, 0x67, 0x08,
+  0x08, 0x98, 0xbe, 0x00, 0x41, 0xf2, 0x04, 0x4c, 0x00, 0xeb, 0x87, 0x00,
+  0x06, 0x90, 0xcd, 0xf8, 0x00, 0x80, 0x4f, 0xf0, 0x00, 0x09, 0x03, 0x91,
+  0xcd, 0xf8, 0x08, 0xc0, 0xdc, 0x45, 0x00, 0xf2, 0x81, 0x80, 0x03, 0xfb,
+  0x09, 0xf1, 0x01, 0xf5, 0x40, 0x65, 0x5d, 0x45, 0x9e, 0xbf, 0x06, 0xeb,
+  0x0c, 0x04, 0x20, 0x1f, 0x58, 0x45, 0x75, 0xd8, 0x01, 0xf5, 0x80, 0x61,
+  0x59, 0x45, 0x98, 0xbf, 0x5c, 0x45, 0x6f, 0xd8, 0x06, 0x98, 0x4e, 0xf6,
+  0xfc, 0x32, 0x00, 0xeb, 0x0c, 0x04, 0xcf, 0xf6, 0xff, 0x72, 0x5a, 0xf8,
+  0x05, 0x00, 0xa2, 0x58, 0x00, 0xee, 0x10, 0x0a, 0x01, 0xee, 0x10, 0x2a,
+  0x4e, 0xf6, 0x00, 0x42, 0xcf, 0xf6, 0xff, 0x72, 0x5a, 0xf8, 0x01, 0x00,
+  0x05, 0xee, 0x10, 0x0a, 0x08, 0x98, 0xa1, 0x58, 0x20, 0xee, 0x01, 0x3a,
+  0x04, 0xee, 0x10, 0x1a, 0x00, 0xeb, 0x0c, 0x05, 0xa5, 0xf5, 0xa0, 0x51,
+  0xa8, 0x58, 0x25, 0xee, 0x04, 0x6a, 0x02, 0xee, 0x10, 0x0a, 0xac, 0xf1,
+  0x04, 0x00, 0x58, 0x45, 0x33, 0xee, 0x06, 0x3a, 0x32, 0xee, 0x03, 0x6a,
+  0x16, 0xee, 0x10, 0x2a, 0x0a, 0x60, 0x3f, 0xd8, 0x4e, 0xf6, 0xfc, 0x32,
+  0x25, 0xee, 0x01, 0x1a, 0x20, 0xee, 0x04, 0x0a, 0xcf, 0xf6, 0xff, 0x72,
+  0x32, 0xee, 0x43, 0x2a, 0xa4, 0xf5, 0xa0, 0x51, 0xa8, 0x58, 0xb8, 0xf1,
+  0x01, 0x08, 0x04, 0xee, 0x10, 0x0a, 0x31, 0xee, 0x40, 0x0a, 0x09, 0xf1,
+  0x01, 0x09, 0x0c, 0xf1, 0x08, 0x0c, 0x34, 0xee, 0x00, 0x1a, 0x34, 0xee,
+  0x40, 0x0a, 0x11, 0xee, 0x10, 0x0a, 0xa8, 0x50, 0x12, 0xee, 0x10, 0x0a,
+  0xa4, 0xeb, 0x0e, 0x02, 0x10, 0xee, 0x10, 0x4a, 0x08, 0x60, 0x14, 0x60,
+  0x94, 0xd1, 0x03, 0x99, 0xdd, 0xf8, 0x00, 0x80, 0x39, 0x44, 0xdd, 0xe9,
+  0x01, 0x0c, 0xb1, 0xf5, 0x80, 0x6f, 0x84, 0x44, 0x85, 0xd3, 0x7f, 0x00,
+  0xb7, 0xf5, 0x80, 0x6f, 0x7f, 0xf7, 0x66, 0xaf, 0x05, 0x98, 0x04, 0x99,
+  0x01, 0x30, 0x05, 0x90, 0x88, 0x42, 0x7f, 0xf4, 0x10, 0xaf, 0x09, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x07, 0x98, 0x09, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x68, 0x9a, 0x1a,
+  0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x00, 0x23, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x0c, 0x0d, 0xf1, 0x04, 0x0e,
+  0xc0, 0xf2, 0x00, 0x0c, 0xdc, 0xf8, 0x0c, 0xc0, 0xbe, 0xeb, 0x0c, 0x0e,
+  0x84, 0x46, 0x80, 0x68, 0x07, 0xd3, 0xdc, 0xf8, 0x10, 0xc0, 0xe6, 0x45,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x06, 0xe0, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x00, 0xbf, 0x00, 0xbf,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0x2d, 0xed, 0x10, 0x8b, 0xa2, 0xb0,
+  0xa1, 0xf1, 0x40, 0x07, 0xd0, 0xf8, 0x78, 0x61, 0xb7, 0xf5, 0x70, 0x7f,
+  0x06, 0xf5, 0x50, 0x57, 0x11, 0x96, 0x00, 0xf2, 0xb5, 0x85, 0x4f, 0xf0,
+  0x55, 0x36, 0x4f, 0xf0, 0x33, 0x35, 0x06, 0xea, 0x51, 0x06, 0x8e, 0x1b,
+  0x05, 0xea, 0x96, 0x05, 0x26, 0xf0, 0xcc, 0x36, 0x2e, 0x44, 0x4f, 0xf0,
+  0x01, 0x35, 0x06, 0xeb, 0x16, 0x16, 0x26, 0xf0, 0xf0, 0x36, 0x6e, 0x43,
+  0x36, 0x0e, 0x02, 0x2e, 0x80, 0xf0, 0x9e, 0x85, 0x00, 0xee, 0x10, 0x1a,
+  0xb7, 0xee, 0x00, 0x1a, 0xcd, 0xe9, 0x01, 0x32, 0xd0, 0xf8, 0xb0, 0x21,
+  0x0b, 0x92, 0x03, 0x90, 0xd0, 0xf8, 0xb8, 0x01, 0x0f, 0x90, 0x47, 0xf2,
+  0x04, 0x42, 0x11, 0x98, 0xb8, 0xee, 0xc0, 0x0a, 0x02, 0x44, 0x48, 0x08,
+  0x0c, 0x90, 0x01, 0xeb, 0x41, 0x00, 0x80, 0x08, 0x81, 0xee, 0x00, 0x0a,
+  0x09, 0x90, 0x08, 0x46, 0x39, 0x60, 0x8c, 0x08, 0x82, 0xed, 0x00, 0x0a,
+  0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0x0a, 0x9b, 0x9f, 0xed, 0x0b, 0xab,
+  0x9f, 0xed, 0x0c, 0xbb, 0x9f, 0xed, 0x0d, 0xcb, 0x9f, 0xed, 0x0e, 0xdb,
+  0xcd, 0xe9, 0x0d, 0x10, 0x00, 0x21, 0x48, 0xf6, 0x10, 0x46, 0x48, 0xf2,
+  0x10, 0x05, 0x47, 0xf2, 0x10, 0x42, 0x0a, 0x94, 0x73, 0xe0, 0x00, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x63, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x6a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x75, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x7a, 0x40, 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5b, 0x40, 0x18, 0x2d, 0x44, 0x54,
+  0xfb, 0x21, 0x19, 0x40, 0x4f, 0xf0, 0x00, 0x40, 0x0b, 0x99, 0xdd, 0xe9,
+  0x14, 0x56, 0x8e, 0x42, 0x13, 0x9a, 0x00, 0xf2, 0xf8, 0x85, 0x11, 0x99,
+  0x88, 0x53, 0x12, 0x99, 0x01, 0x31, 0x09, 0x98, 0x02, 0x36, 0x88, 0x42,
+  0x05, 0xf1, 0x04, 0x05, 0x02, 0xf1, 0x04, 0x02, 0x0a, 0x9c, 0x00, 0xf0,
+  0xfb, 0x84, 0x13, 0xa8, 0x64, 0xc0, 0xb1, 0xfb, 0xf4, 0xf0, 0x12, 0x91,
+  0x10, 0x90, 0x00, 0xfb, 0x14, 0x10, 0xb4, 0xeb, 0x40, 0x0f, 0x80, 0xf0,
+  0xc9, 0x81, 0x20, 0x1a, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x38, 0x0b,
+  0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0xdd, 0xe9, 0x0d, 0x32,
+  0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec, 0x10, 0x0b, 0x81, 0x46, 0x88, 0x46,
+  0x8d, 0xed, 0x1e, 0x0b, 0x9d, 0xf8, 0x7f, 0x00, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x7f, 0x00, 0xdd, 0xe9, 0x1e, 0x23, 0x48, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x1f, 0xed, 0x43, 0x0b, 0x82, 0x46, 0x8b, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x45, 0x0b, 0x06, 0x46,
+  0x0f, 0x46, 0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0x47, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x30, 0x46,
+  0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0x51, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x5a, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x1f, 0xed, 0x63, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0x6c, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x75, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x1f, 0xed, 0x7e, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0x87, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0x90, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46,
+  0x0b, 0x46, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0x98, 0x0b, 0x41, 0xec, 0x1e, 0x0b, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x48, 0x46,
+  0x41, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x48, 0x46,
+  0x41, 0x46, 0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0xa2, 0x0b, 0x80, 0x46, 0x89, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x40, 0x46, 0x49, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xab, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x1f, 0xed, 0xb4, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed,
+  0xbd, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec, 0x19, 0x2b, 0x04, 0x46,
+  0x0d, 0x46, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec,
+  0x1a, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x53, 0xec, 0x1b, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x50, 0x46,
+  0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec, 0x1c, 0x2b, 0x04, 0x46,
+  0x0d, 0x46, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec,
+  0x1d, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x50, 0x46, 0x59, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46,
+  0x0b, 0x46, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec,
+  0x18, 0x0b, 0xc6, 0xe1, 0xff, 0xf7, 0xfe, 0xff, 0x1f, 0xed, 0xfa, 0x0b,
+  0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0xdd, 0xe9, 0x0d, 0x32,
+  0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec, 0x10, 0x0b, 0x81, 0x46, 0x88, 0x46,
+  0x8d, 0xed, 0x20, 0x0b, 0x9d, 0xf8, 0x87, 0x00, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x87, 0x00, 0xdd, 0xe9, 0x20, 0x23, 0x48, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xf7, 0x0b, 0x83, 0x46, 0x8a, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xf5, 0x0b, 0x06, 0x46,
+  0x0f, 0x46, 0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xf3, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x30, 0x46,
+  0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xe9, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xe0, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xd7, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xce, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xc5, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0xbc, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xb3, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0xaa, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46,
+  0x0b, 0x46, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xa2, 0x0b, 0x41, 0xec, 0x18, 0x0b, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46, 0x0b, 0x46, 0x48, 0x46,
+  0x41, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x46, 0x0d, 0x46, 0x48, 0x46,
+  0x41, 0x46, 0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0x98, 0x0b, 0x80, 0x46, 0x89, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x22, 0x46, 0x2b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x40, 0x46, 0x49, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed, 0x8f, 0x0b, 0x04, 0x46,
+  0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x9f, 0xed, 0x86, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec,
+  0x10, 0x2b, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0x7d, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec, 0x19, 0x2b, 0x04, 0x46,
+  0x0d, 0x46, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec,
+  0x1a, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46,
+  0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x53, 0xec, 0x1b, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x58, 0x46,
+  0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46, 0x29, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec, 0x1c, 0x2b, 0x04, 0x46,
+  0x0d, 0x46, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x0f, 0x46, 0x20, 0x46,
+  0x29, 0x46, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x53, 0xec,
+  0x1d, 0x2b, 0x04, 0x46, 0x0d, 0x46, 0x58, 0x46, 0x51, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x32, 0x46, 0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x46,
+  0x0b, 0x46, 0x20, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x41, 0xec,
+  0x1e, 0x0b, 0x10, 0x98, 0x0f, 0x99, 0x00, 0xf0, 0x03, 0x00, 0x14, 0x9d,
+  0x02, 0x28, 0x14, 0xd0, 0x01, 0x28, 0x1f, 0xd0, 0x00, 0x28, 0x79, 0xd1,
+  0x8d, 0xed, 0x16, 0xeb, 0x9d, 0xf8, 0x5f, 0x00, 0xb0, 0xee, 0x48, 0xfa,
+  0xf0, 0xee, 0x68, 0xfa, 0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8, 0x5f, 0x00,
+  0x9d, 0xed, 0x16, 0xeb, 0x8d, 0x42, 0x74, 0xd9, 0x31, 0xe2, 0x8d, 0xed,
+  0x1c, 0x8b, 0x9d, 0xf8, 0x77, 0x00, 0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8,
+  0x77, 0x00, 0x9d, 0xed, 0x1c, 0xfb, 0x8d, 0x42, 0x67, 0xd9, 0x24, 0xe2,
+  0x8d, 0xed, 0x18, 0x8b, 0x9d, 0xf8, 0x67, 0x00, 0x80, 0xf0, 0x80, 0x00,
+  0x8d, 0xf8, 0x67, 0x00, 0x9d, 0xed, 0x18, 0x0b, 0x8d, 0xed, 0x1a, 0xeb,
+  0x9d, 0xf8, 0x6f, 0x00, 0xb0, 0xee, 0x40, 0xea, 0xf0, 0xee, 0x60, 0xea,
+  0x80, 0xf0, 0x80, 0x00, 0x8d, 0xf8, 0x6f, 0x00, 0x9d, 0xed, 0x1a, 0xfb,
+  0x8d, 0x42, 0x4c, 0xd9, 0x09, 0xe2, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x73, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x77, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x5b, 0x40, 0xb0, 0xee, 0x4e, 0xfa, 0xb0, 0xee, 0x48, 0xea,
+  0xf0, 0xee, 0x6e, 0xfa, 0xf0, 0xee, 0x68, 0xea, 0x8d, 0x42, 0x00, 0xf2,
+  0xbe, 0x81, 0x58, 0xec, 0x1e, 0x4b, 0x20, 0x46, 0x41, 0x46, 0xff, 0xf7,
+  0xfe, 0xff, 0x57, 0xec, 0x1f, 0xab, 0x11, 0x9e, 0x70, 0x51, 0x50, 0x46,
+  0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x0c, 0x99, 0x12, 0x9a, 0x8a, 0x42,
+  0x11, 0x46, 0x13, 0x9a, 0xb0, 0x50, 0x15, 0x9e, 0xbf, 0xf4, 0xb2, 0xab,
+  0x9f, 0xed, 0xd8, 0x0b, 0x20, 0x46, 0x41, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0x08, 0x97, 0x04, 0x92, 0x06, 0x93, 0xff, 0xf7, 0xfe, 0xff, 0x9f, 0xed,
+  0xd5, 0x0b, 0x04, 0x46, 0x0d, 0x46, 0x57, 0xec, 0x10, 0x2b, 0x05, 0x92,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0xd2, 0xa1, 0x00, 0x28, 0x08, 0x46,
+  0x01, 0xf1, 0x08, 0x08, 0x18, 0xbf, 0x40, 0x46, 0x90, 0xed, 0x00, 0x0b,
+  0x20, 0x46, 0x29, 0x46, 0x53, 0xec, 0x10, 0x2b, 0xff, 0xf7, 0xfe, 0xff,
+  0x9f, 0xed, 0xce, 0x0b, 0x07, 0x97, 0xff, 0x0f, 0x53, 0xec, 0x10, 0x5b,
+  0x89, 0x46, 0x83, 0x46, 0x67, 0xf3, 0xdf, 0x71, 0x10, 0x93, 0x2a, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x38, 0xb9, 0x4f, 0xf0, 0x00, 0x40, 0x06, 0xf5,
+  0x80, 0x61, 0x0b, 0x9a, 0x91, 0x42, 0x29, 0xd9, 0x6b, 0xe1, 0x58, 0x46,
+  0x49, 0x46, 0x5a, 0x46, 0x4b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0x40, 0xf0, 0xc6, 0x80, 0x9f, 0xed, 0xc0, 0x0b, 0x58, 0x46, 0x49, 0x46,
+  0x53, 0xec, 0x10, 0x2b, 0x03, 0x24, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0x40, 0xf0, 0x58, 0x81, 0x58, 0x46, 0x49, 0x46, 0x2a, 0x46, 0x10, 0x9b,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x40, 0xf0, 0x4f, 0x81, 0x58, 0x46,
+  0x49, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x15, 0x9e, 0x06, 0xf5, 0x80, 0x61,
+  0x0b, 0x9a, 0x91, 0x42, 0x00, 0xf2, 0x43, 0x81, 0x11, 0x99, 0x04, 0x9a,
+  0x31, 0x44, 0x06, 0x9b, 0xa1, 0xf8, 0x00, 0x04, 0x50, 0x46, 0x08, 0x99,
+  0xff, 0xf7, 0xfe, 0xff, 0x05, 0x9a, 0x04, 0x46, 0x07, 0x9b, 0x0e, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0xa2, 0xa0, 0x08, 0xbf, 0x80, 0x46,
+  0x98, 0xed, 0x00, 0x0b, 0x20, 0x46, 0x31, 0x46, 0x53, 0xec, 0x10, 0x2b,
+  0xff, 0xf7, 0xfe, 0xff, 0x06, 0x46, 0x38, 0x46, 0x0f, 0x46, 0x2a, 0x46,
+  0x60, 0xf3, 0xdf, 0x71, 0x30, 0x46, 0x10, 0x9b, 0xff, 0xf7, 0xfe, 0xff,
+  0x00, 0x28, 0x3f, 0xf4, 0x19, 0xab, 0x30, 0x46, 0x39, 0x46, 0x32, 0x46,
+  0x3b, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x74, 0xd1, 0x9f, 0xed,
+  0x98, 0x0b, 0x30, 0x46, 0x39, 0x46, 0x53, 0xec, 0x10, 0x2b, 0x03, 0x24,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28, 0x40, 0xf0, 0x07, 0x81, 0x30, 0x46,
+  0x39, 0x46, 0x2a, 0x46, 0x10, 0x9b, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x28,
+  0x40, 0xf0, 0xfe, 0x80, 0x30, 0x46, 0x39, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0xff, 0xf7, 0xf8, 0xba, 0x00, 0x21, 0x39, 0x60, 0x22, 0xb0, 0xbd, 0xec,
+  0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0xdd, 0xf8, 0x08, 0x80,
+  0x0b, 0x99, 0xb8, 0xf1, 0x01, 0x0f, 0xf3, 0xdb, 0x01, 0x98, 0x00, 0x28,
+  0x4a, 0xd0, 0xa8, 0xf1, 0x04, 0x00, 0x10, 0xf1, 0x03, 0x0f, 0x5a, 0xd2,
+  0x4f, 0xf2, 0x5f, 0x3e, 0x28, 0xf0, 0x03, 0x03, 0x46, 0xf2, 0x0d, 0x60,
+  0xc3, 0xf6, 0x6e, 0x4e, 0xc0, 0xf2, 0x19, 0x00, 0x4f, 0xea, 0x43, 0x0c,
+  0x2a, 0x26, 0x45, 0xf2, 0x0a, 0x47, 0xbd, 0x1f, 0x8d, 0x42, 0x00, 0xf2,
+  0xce, 0x80, 0x11, 0x9a, 0x06, 0xfb, 0x00, 0xe4, 0xd6, 0x19, 0xaa, 0x1c,
+  0x8a, 0x42, 0x4f, 0xea, 0x64, 0x45, 0x26, 0xf8, 0x06, 0x5c, 0x00, 0xf2,
+  0xc2, 0x80, 0x04, 0xfb, 0x00, 0xe5, 0x94, 0x1c, 0x8c, 0x42, 0x4f, 0xea,
+  0x65, 0x42, 0x26, 0xf8, 0x04, 0x2c, 0x00, 0xf2, 0xb8, 0x80, 0x05, 0xfb,
+  0x00, 0xe2, 0xa5, 0x1c, 0x8d, 0x42, 0x4f, 0xea, 0x62, 0x45, 0x26, 0xf8,
+  0x02, 0x5c, 0x00, 0xf2, 0xae, 0x80, 0x02, 0xfb, 0x00, 0xe6, 0x11, 0x9d,
+  0x04, 0x3b, 0x4f, 0xea, 0x66, 0x42, 0xea, 0x53, 0x07, 0xf1, 0x08, 0x07,
+  0xd1, 0xd1, 0x45, 0xf2, 0x04, 0x42, 0x06, 0xfb, 0x00, 0xe5, 0x0c, 0xeb,
+  0x02, 0x00, 0x1c, 0xe0, 0x05, 0x24, 0x9b, 0xe0, 0xb8, 0xf1, 0x01, 0x0f,
+  0x46, 0xd1, 0x45, 0xf2, 0x04, 0x40, 0x9f, 0xed, 0x5c, 0x0a, 0x0f, 0x99,
+  0x88, 0x42, 0x00, 0xf2, 0x90, 0x80, 0x10, 0xee, 0x10, 0x1a, 0x11, 0x9a,
+  0x11, 0x50, 0x22, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x4b, 0xf2, 0x81, 0x15, 0x45, 0xf2, 0x04, 0x40, 0xc4, 0xf2,
+  0x99, 0x05, 0x18, 0xf0, 0x03, 0x02, 0x3f, 0xf4, 0x87, 0xaf, 0x88, 0x42,
+  0x79, 0xd8, 0x11, 0x9f, 0x01, 0x2a, 0x4f, 0xea, 0x65, 0x43, 0x3b, 0x52,
+  0x3f, 0xf4, 0x7e, 0xaf, 0x86, 0x1c, 0x8e, 0x42, 0x6f, 0xd8, 0x46, 0xf2,
+  0x0d, 0x67, 0x4f, 0xf2, 0x5f, 0x33, 0xc0, 0xf2, 0x19, 0x07, 0xc3, 0xf6,
+  0x6e, 0x43, 0x05, 0xfb, 0x07, 0x34, 0x11, 0x9d, 0x02, 0x2a, 0x4f, 0xea,
+  0x64, 0x42, 0xaa, 0x53, 0x3f, 0xf4, 0x6a, 0xaf, 0x04, 0x30, 0x88, 0x42,
+  0x5b, 0xd8, 0x04, 0xfb, 0x07, 0x31, 0x11, 0x9a, 0x49, 0x14, 0x11, 0x52,
+  0x22, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x4f, 0xf2, 0x5f, 0x31, 0x46, 0xf2, 0x0d, 0x62, 0x28, 0xf0, 0x01, 0x0e,
+  0x45, 0xf2, 0x08, 0x40, 0x11, 0x9b, 0x08, 0xf0, 0x01, 0x0c, 0xc3, 0xf6,
+  0x6e, 0x41, 0xc0, 0xf2, 0x19, 0x02, 0x1f, 0x18, 0x2a, 0x25, 0x45, 0xf2,
+  0x04, 0x44, 0x9f, 0xed, 0x31, 0x0a, 0x70, 0x46, 0x0f, 0x9e, 0xb4, 0x42,
+  0x37, 0xd8, 0x05, 0xfb, 0x02, 0x15, 0x04, 0x34, 0xb4, 0x42, 0x4f, 0xea,
+  0x65, 0x43, 0x01, 0xee, 0x10, 0x3a, 0xb8, 0xee, 0xc1, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x11, 0xee, 0x10, 0x3a, 0x47, 0xf8, 0x04, 0x3c, 0x26, 0xd8,
+  0x05, 0xfb, 0x02, 0x15, 0x02, 0x38, 0x04, 0xf1, 0x04, 0x04, 0x4f, 0xea,
+  0x65, 0x43, 0x01, 0xee, 0x10, 0x3a, 0xb8, 0xee, 0xc1, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x11, 0xee, 0x10, 0x3a, 0x47, 0xf8, 0x08, 0x3b, 0xda, 0xd1,
+  0xbc, 0xf1, 0x00, 0x0f, 0x3f, 0xf4, 0x1c, 0xaf, 0x05, 0xfb, 0x02, 0x10,
+  0x40, 0x14, 0x01, 0xee, 0x10, 0x0a, 0x45, 0xf2, 0x04, 0x40, 0x00, 0xeb,
+  0x8e, 0x00, 0xb8, 0xee, 0xc1, 0x1a, 0x21, 0xee, 0x00, 0x0a, 0x0f, 0x99,
+  0x88, 0x42, 0x7f, 0xf6, 0x70, 0xaf, 0x02, 0x24, 0x03, 0x98, 0x21, 0x46,
+  0x22, 0xb0, 0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xdf, 0x40,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0xb5, 0x82, 0xb0, 0x01, 0x46, 0x40, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
-  0x00, 0x00, 0x01, 0xab, 0x02, 0x68, 0x88, 0x68, 0x93, 0x42, 0x22, 0xbf,
-  0x9a, 0x1a, 0x09, 0x69, 0x8a, 0x42, 0x04, 0xd2, 0x0b, 0x21, 0xff, 0xf7,
-  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
-  0xff, 0xe7, 0x2d, 0xe9, 0xf0, 0x47, 0x80, 0x46, 0xd0, 0xf8, 0x78, 0x01,
-  0xd8, 0xf8, 0xb8, 0x91, 0x00, 0x25, 0x00, 0xf5, 0xa0, 0x54, 0x4f, 0xf4,
-  0xa0, 0x57, 0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x4f, 0x45, 0x9f, 0xbf,
-  0x06, 0x46, 0x20, 0x60, 0x08, 0x37, 0x4f, 0x45, 0x1c, 0xd8, 0x01, 0x35,
-  0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x82, 0x46, 0xa0, 0x60, 0x30, 0x46,
-  0x4f, 0xf0, 0x7c, 0x51, 0xff, 0xf7, 0xfe, 0xff, 0x60, 0x60, 0x50, 0x46,
-  0x4f, 0xf0, 0x7c, 0x51, 0xff, 0xf7, 0xfe, 0xff, 0x39, 0x1d, 0x49, 0x45,
-  0x08, 0xd8, 0xe0, 0x60, 0x01, 0x35, 0x0f, 0x1d, 0x10, 0x34, 0xb5, 0xf5,
-  0x80, 0x6f, 0xda, 0xd1, 0xbd, 0xe8, 0xf0, 0x87, 0x40, 0x46, 0x02, 0x21,
-  0xbd, 0xe8, 0xf0, 0x47, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
-  0x02, 0x46, 0x40, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x00, 0x0d, 0xf1,
-  0x04, 0x0c, 0x43, 0x68, 0x90, 0x68, 0x9c, 0x45, 0x22, 0xbf, 0xac, 0xeb,
-  0x03, 0x03, 0x12, 0x69, 0x93, 0x42, 0x04, 0xd2, 0x0b, 0x21, 0xff, 0xf7,
-  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
-  0xff, 0xe7, 0x2d, 0xe9, 0xf0, 0x4f, 0x91, 0xb0, 0x01, 0x29, 0x0a, 0x46,
-  0x06, 0x91, 0xc0, 0xf2, 0xf8, 0x80, 0xd0, 0xf8, 0x78, 0x81, 0x41, 0xf2,
-  0x04, 0x41, 0xd0, 0xf8, 0xb8, 0xc1, 0x41, 0x44, 0x0e, 0x91, 0x00, 0x21,
-  0x05, 0x91, 0x07, 0x90, 0x00, 0x20, 0x00, 0x21, 0x88, 0x42, 0x29, 0xda,
-  0x4f, 0xf4, 0xa0, 0x52, 0x02, 0xeb, 0xc0, 0x06, 0x66, 0x45, 0x9c, 0xbf,
-  0x02, 0xeb, 0xc1, 0x07, 0x67, 0x45, 0x00, 0xf2, 0xe1, 0x80, 0x58, 0xf8,
-  0x06, 0x30, 0x46, 0x44, 0x58, 0xf8, 0x07, 0x50, 0xc2, 0x00, 0x35, 0x60,
-  0x41, 0xf2, 0x04, 0x46, 0x16, 0x44, 0x66, 0x45, 0x9f, 0xbf, 0xcd, 0x00,
-  0x41, 0xf2, 0x04, 0x44, 0x25, 0x44, 0x65, 0x45, 0x00, 0xf2, 0xce, 0x80,
-  0x08, 0xeb, 0x07, 0x0e, 0x0e, 0x9f, 0x58, 0xf8, 0x06, 0x60, 0x58, 0xf8,
-  0x05, 0x40, 0xce, 0xf8, 0x00, 0x30, 0xbc, 0x50, 0x48, 0xf8, 0x05, 0x60,
-  0x8a, 0x05, 0x07, 0xd4, 0x4f, 0xf4, 0x00, 0x72, 0x01, 0x30, 0x11, 0x43,
-  0xb0, 0xf5, 0x80, 0x6f, 0xca, 0xd1, 0x17, 0xe0, 0x4f, 0xf4, 0x00, 0x73,
-  0x59, 0x40, 0x5a, 0x08, 0x11, 0xea, 0x53, 0x0f, 0xf2, 0xd0, 0x51, 0x40,
-  0x9a, 0x08, 0x11, 0xea, 0x93, 0x0f, 0x1e, 0xbf, 0x51, 0x40, 0xda, 0x08,
-  0x11, 0xea, 0xd3, 0x0f, 0xe8, 0xd0, 0x51, 0x40, 0x1a, 0x09, 0x11, 0xea,
-  0x13, 0x1f, 0x13, 0x46, 0xea, 0xd1, 0xe1, 0xe7, 0x02, 0x22, 0x53, 0x10,
-  0x01, 0x2b, 0xc0, 0xf2, 0x8c, 0x80, 0x92, 0xfa, 0xa2, 0xf0, 0x4f, 0xf4,
-  0x80, 0x61, 0xb0, 0xfa, 0x80, 0xf0, 0x4f, 0xf4, 0xa0, 0x5a, 0x00, 0xf0,
-  0x1f, 0x00, 0x21, 0xfa, 0x00, 0xf0, 0x00, 0x21, 0x80, 0x00, 0x08, 0x90,
-  0x90, 0x00, 0x09, 0x90, 0xd0, 0x00, 0x00, 0x90, 0xcd, 0xf8, 0x40, 0xc0,
-  0xcd, 0xe9, 0x01, 0x32, 0x00, 0x20, 0x04, 0x91, 0xcd, 0xf8, 0x0c, 0xa0,
-  0x0d, 0x93, 0x0f, 0x90, 0x00, 0xf5, 0x80, 0x60, 0x60, 0x45, 0x9f, 0xbf,
-  0x09, 0x99, 0x0a, 0xeb, 0x01, 0x09, 0x49, 0xf0, 0x04, 0x0b, 0xe3, 0x45,
-  0x72, 0xd8, 0x58, 0xf8, 0x00, 0x00, 0x58, 0xf8, 0x0b, 0x10, 0xcd, 0xe9,
-  0x0b, 0x01, 0xff, 0xf7, 0xfe, 0xff, 0x05, 0x46, 0x0f, 0x98, 0x10, 0x99,
-  0x00, 0xf5, 0x40, 0x60, 0x88, 0x42, 0x63, 0xd8, 0x58, 0xf8, 0x00, 0x40,
-  0x4a, 0xf0, 0x04, 0x07, 0x58, 0xf8, 0x09, 0x60, 0x20, 0x46, 0x31, 0x46,
-  0xff, 0xf7, 0xfe, 0xff, 0x01, 0x46, 0x28, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x05, 0x46, 0x10, 0x98, 0x87, 0x42, 0x51, 0xd8, 0x08, 0xeb, 0x09, 0x00,
-  0x58, 0xf8, 0x07, 0x90, 0x0a, 0x90, 0x28, 0x46, 0xc3, 0x44, 0x49, 0x46,
-  0xff, 0xf7, 0xfe, 0xff, 0x48, 0xf8, 0x07, 0x00, 0x31, 0x46, 0x0b, 0x98,
-  0xff, 0xf7, 0xfe, 0xff, 0x0c, 0x99, 0x06, 0x46, 0x20, 0x46, 0xff, 0xf7,
-  0xfe, 0xff, 0x01, 0x46, 0x30, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x58, 0xf8,
-  0x0a, 0x60, 0x04, 0x46, 0x21, 0x46, 0x30, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x48, 0xf8, 0x0a, 0x00, 0x48, 0x46, 0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0xcb, 0xf8, 0x00, 0x00, 0x30, 0x46, 0x21, 0x46, 0xff, 0xf7, 0xfe, 0xff,
-  0x0a, 0x99, 0x0a, 0xf1, 0x08, 0x0a, 0xdd, 0xf8, 0x40, 0xc0, 0x08, 0x60,
-  0x08, 0x98, 0x0f, 0x99, 0x08, 0x44, 0x0d, 0x99, 0x4b, 0x1e, 0x99, 0xd1,
-  0x02, 0x9a, 0x04, 0x99, 0x00, 0x98, 0xdd, 0xf8, 0x0c, 0xa0, 0x11, 0x44,
-  0x01, 0x9b, 0xb1, 0xf5, 0x80, 0x6f, 0x82, 0x44, 0x8a, 0xd3, 0x52, 0x00,
-  0xb2, 0xf5, 0x80, 0x6f, 0x7f, 0xf7, 0x6b, 0xaf, 0x05, 0x99, 0x06, 0x98,
-  0x01, 0x31, 0x05, 0x91, 0x81, 0x42, 0x7f, 0xf4, 0x13, 0xaf, 0x11, 0xb0,
-  0xbd, 0xe8, 0xf0, 0x8f, 0x07, 0x98, 0x02, 0x21, 0x11, 0xb0, 0xbd, 0xe8,
-  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x6d, 0x65, 0x6d, 0x6f,
-  0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-  0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x66, 0x66, 0x74, 0x5f,
-  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x7c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x74,
-  0x65, 0x78, 0x74, 0x00, 0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00,
-  0x1a, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78,
-  0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68,
-  0x5f, 0x69, 0x64, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
-  0x69, 0x5f, 0x75, 0x69, 0x32, 0x66, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f,
-  0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x66, 0x6d, 0x75, 0x6c, 0x00, 0x00,
-  0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x66, 0x61,
-  0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
-  0x69, 0x5f, 0x66, 0x73, 0x75, 0x62, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0xe0, 0xc1, 0x00, 0x30, 0x81, 0x3e, 0x00, 0x00, 0x00, 0x38,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2,
+  0x00, 0x02, 0x12, 0x69, 0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x8a, 0xb0, 0xd0, 0xf8, 0x78, 0xc1, 0x4f, 0xf4,
+  0x50, 0x52, 0x5c, 0xf8, 0x02, 0xb0, 0xbb, 0xf1, 0x00, 0x0f, 0x00, 0xf0,
+  0xc3, 0x81, 0x01, 0x29, 0xc0, 0xf2, 0xc0, 0x81, 0x47, 0xf2, 0x04, 0x42,
+  0x45, 0xf2, 0x04, 0x43, 0x62, 0x44, 0x0c, 0xeb, 0x03, 0x0e, 0xbb, 0xf1,
+  0x01, 0x0f, 0x0c, 0xf5, 0x50, 0x59, 0x92, 0xed, 0x00, 0x0a, 0x2e, 0xdb,
+  0x32, 0xd1, 0xde, 0xf8, 0x04, 0x00, 0xa1, 0xf1, 0x08, 0x02, 0xc9, 0xf8,
+  0x08, 0x00, 0x12, 0xf1, 0x08, 0x0f, 0x01, 0xf0, 0x07, 0x00, 0x9e, 0xed,
+  0x00, 0x2a, 0x00, 0xf2, 0x18, 0x81, 0x21, 0xf0, 0x07, 0x01, 0x01, 0x23,
+  0xa1, 0xf1, 0x08, 0x02, 0x03, 0xeb, 0xd2, 0x03, 0x13, 0xf0, 0x03, 0x03,
+  0x00, 0xf0, 0x10, 0x81, 0x22, 0xee, 0x00, 0x1a, 0x01, 0x2b, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x2a, 0x40, 0xf0, 0xfe, 0x80, 0x11, 0x46, 0x20, 0xe1, 0x99, 0xed,
+  0x01, 0x1a, 0x21, 0xee, 0x00, 0x0a, 0x7b, 0xe1, 0xd0, 0xf8, 0xb8, 0x81,
+  0x4f, 0xf0, 0x00, 0x0a, 0x00, 0x27, 0x00, 0x26, 0x45, 0xf2, 0x04, 0x42,
+  0x02, 0xeb, 0xc7, 0x04, 0x02, 0x22, 0x44, 0x45, 0x9e, 0xbf, 0x43, 0xf2,
+  0x04, 0x43, 0x03, 0xeb, 0xc6, 0x03, 0x43, 0x45, 0x00, 0xf2, 0x83, 0x81,
+  0xfa, 0x00, 0x45, 0xf2, 0x08, 0x45, 0x15, 0x44, 0x5c, 0xf8, 0x04, 0x20,
+  0x45, 0x45, 0x4c, 0xf8, 0x03, 0x20, 0x4f, 0xf0, 0x02, 0x02, 0x9f, 0xbf,
+  0xf3, 0x00, 0x43, 0xf2, 0x08, 0x44, 0x23, 0x44, 0x43, 0x45, 0x00, 0xf2,
+  0x70, 0x81, 0x5c, 0xf8, 0x05, 0x20, 0x4c, 0xf8, 0x03, 0x20, 0x5a, 0x46,
+  0x16, 0xea, 0x62, 0x0f, 0x14, 0xd0, 0x86, 0xea, 0x62, 0x06, 0x16, 0xea,
+  0xa2, 0x0f, 0x11, 0xd0, 0x86, 0xea, 0xa2, 0x06, 0x16, 0xea, 0xe2, 0x0f,
+  0x0e, 0xd0, 0x86, 0xea, 0xe2, 0x03, 0x14, 0x11, 0x13, 0xea, 0x22, 0x1f,
+  0x83, 0xea, 0x22, 0x16, 0x22, 0x46, 0xe9, 0xd1, 0x1e, 0x46, 0x04, 0xe0,
+  0x54, 0x10, 0x02, 0xe0, 0x94, 0x10, 0x00, 0xe0, 0xd4, 0x10, 0x01, 0x37,
+  0x26, 0x43, 0x5f, 0x45, 0xb8, 0xd1, 0x02, 0x25, 0x00, 0x2d, 0x00, 0xf0,
+  0x4c, 0x81, 0x01, 0x2d, 0xc0, 0xf2, 0x8d, 0x80, 0xac, 0x00, 0x09, 0x94,
+  0x9b, 0xfb, 0xf5, 0xf3, 0xec, 0x00, 0x01, 0x94, 0x6f, 0x08, 0x01, 0x22,
+  0x9b, 0x00, 0x00, 0x24, 0x43, 0xf2, 0x08, 0x46, 0x01, 0x2f, 0x07, 0x93,
+  0x0c, 0xeb, 0x85, 0x03, 0x88, 0xbf, 0x6a, 0x08, 0x08, 0x93, 0xcd, 0xf8,
+  0x10, 0xe0, 0xcd, 0xe9, 0x02, 0xa9, 0x00, 0x95, 0x47, 0xf2, 0x10, 0x47,
+  0xb1, 0x46, 0x48, 0xf2, 0x10, 0x06, 0x92, 0x46, 0x06, 0x94, 0xcd, 0xf8,
+  0x14, 0x90, 0xc1, 0x45, 0x00, 0xf2, 0x1e, 0x81, 0x46, 0x45, 0x00, 0xf2,
+  0x1b, 0x81, 0x09, 0x9b, 0x03, 0xeb, 0x09, 0x04, 0x25, 0x1f, 0x45, 0x45,
+  0x00, 0xf2, 0x14, 0x81, 0x47, 0x45, 0x00, 0xf2, 0x11, 0x81, 0x44, 0x45,
+  0x00, 0xf2, 0x0e, 0x81, 0x08, 0x9b, 0x5c, 0xf8, 0x06, 0x40, 0x03, 0xeb,
+  0x09, 0x0e, 0x01, 0xee, 0x10, 0x4a, 0x5c, 0xf8, 0x07, 0x40, 0x5e, 0xf8,
+  0x04, 0x5c, 0x06, 0xee, 0x10, 0x4a, 0x02, 0xee, 0x10, 0x5a, 0x53, 0xf8,
+  0x09, 0x50, 0x05, 0xee, 0x10, 0x5a, 0x5c, 0xf8, 0x09, 0x40, 0x03, 0xee,
+  0x10, 0x4a, 0xa9, 0xf1, 0x04, 0x05, 0x21, 0xee, 0x02, 0x4a, 0x0c, 0xeb,
+  0x09, 0x04, 0x26, 0xee, 0x05, 0x7a, 0x45, 0x45, 0x34, 0xee, 0x07, 0x4a,
+  0x33, 0xee, 0x04, 0x7a, 0x17, 0xee, 0x10, 0x3a, 0x23, 0x60, 0x00, 0xf2,
+  0xe5, 0x80, 0x26, 0xee, 0x02, 0x2a, 0x54, 0xf8, 0x04, 0x3c, 0x21, 0xee,
+  0x05, 0x1a, 0x05, 0xee, 0x10, 0x3a, 0x33, 0xee, 0x44, 0x3a, 0xba, 0xf1,
+  0x01, 0x0a, 0x09, 0xf1, 0x08, 0x09, 0x32, 0xee, 0x41, 0x1a, 0x13, 0xee,
+  0x10, 0x5a, 0x35, 0xee, 0x01, 0x2a, 0x35, 0xee, 0x41, 0x1a, 0x12, 0xee,
+  0x10, 0x3a, 0x44, 0xf8, 0x04, 0x3c, 0x11, 0xee, 0x10, 0x3a, 0xce, 0xf8,
+  0x00, 0x50, 0x4e, 0xf8, 0x04, 0x3c, 0x07, 0x9b, 0x1f, 0x44, 0x1e, 0x44,
+  0x9f, 0xd1, 0x00, 0x9d, 0x01, 0x9b, 0x06, 0x9c, 0x05, 0x9e, 0x2c, 0x44,
+  0x1e, 0x44, 0x5c, 0x45, 0xdd, 0xf8, 0x10, 0xe0, 0xdd, 0xe9, 0x02, 0xa9,
+  0x8a, 0xdb, 0xbb, 0xeb, 0x45, 0x0f, 0x4f, 0xea, 0x45, 0x05, 0xbf, 0xf6,
+  0x67, 0xaf, 0x99, 0xed, 0x01, 0x1a, 0x0a, 0xf1, 0x01, 0x0a, 0x21, 0xee,
+  0x00, 0x1a, 0x8a, 0x45, 0x8e, 0xed, 0x00, 0x1a, 0x7f, 0xf4, 0x12, 0xaf,
+  0x8a, 0xe0, 0x9f, 0xed, 0x58, 0x1a, 0x69, 0xe0, 0x24, 0xe0, 0x22, 0xee,
+  0x00, 0x1a, 0x02, 0x2b, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x2a, 0x01, 0xd1, 0x10, 0x39,
+  0x10, 0xe0, 0x22, 0xee, 0x00, 0x1a, 0x18, 0x39, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a,
+  0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x2a,
+  0x18, 0x2a, 0x41, 0xd3, 0x22, 0xee, 0x00, 0x1a, 0x20, 0x39, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee, 0x00, 0x1a, 0x21, 0xee,
+  0x00, 0x2a, 0xbd, 0xd1, 0xb0, 0xb1, 0x22, 0xee, 0x00, 0x1a, 0x01, 0x28,
+  0x07, 0xd0, 0x21, 0xee, 0x00, 0x2a, 0x02, 0x28, 0x0e, 0xd0, 0x22, 0xee,
+  0x00, 0x1a, 0x03, 0x28, 0x06, 0xd1, 0xb0, 0xee, 0x41, 0x0a, 0xb0, 0xee,
+  0x42, 0x1a, 0x89, 0xed, 0x01, 0x2a, 0x07, 0xe0, 0x21, 0xee, 0x00, 0x2a,
+  0x04, 0x28, 0x08, 0xd1, 0xb0, 0xee, 0x42, 0x0a, 0x89, 0xed, 0x01, 0x1a,
+  0x8e, 0xed, 0x00, 0x0a, 0x0a, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x22, 0xee,
+  0x00, 0x3a, 0x05, 0x28, 0x02, 0xd1, 0xb0, 0xee, 0x43, 0x0a, 0xe6, 0xe7,
+  0x23, 0xee, 0x00, 0x1a, 0x06, 0x28, 0x06, 0xd1, 0xb0, 0xee, 0x41, 0x0a,
+  0xb0, 0xee, 0x43, 0x1a, 0x89, 0xed, 0x01, 0x3a, 0xe8, 0xe7, 0x21, 0xee,
+  0x00, 0x0a, 0xe3, 0xe7, 0x02, 0x22, 0x11, 0x46, 0x0a, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x04, 0x22, 0x11, 0x46, 0x0a, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2,
+  0x00, 0x01, 0x49, 0x69, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0,
+  0x80, 0xbd, 0xb0, 0xb5, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51,
+  0x59, 0x58, 0xe1, 0xb3, 0xca, 0x00, 0x49, 0xf6, 0xc5, 0x51, 0xc8, 0xf2,
+  0x1c, 0x11, 0x31, 0xd0, 0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c,
+  0xd0, 0xf8, 0xa8, 0xe1, 0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2,
+  0x04, 0x44, 0x74, 0x45, 0x9c, 0xbf, 0x65, 0x1c, 0x75, 0x45, 0x23, 0xd8,
+  0xa5, 0x1c, 0x75, 0x45, 0x9c, 0xbf, 0xe5, 0x1c, 0x75, 0x45, 0x1d, 0xd8,
+  0x13, 0xf8, 0x01, 0x5c, 0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04, 0x81, 0xea,
+  0x05, 0x01, 0x13, 0xf8, 0x04, 0x5b, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea,
+  0x05, 0x01, 0x13, 0xf8, 0x03, 0x5c, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea,
+  0x05, 0x01, 0x13, 0xf8, 0x02, 0x5c, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xd8, 0xd1, 0x08, 0x46, 0xb0, 0xbd,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xb0, 0xbd, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x69, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x00, 0x23,
+  0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x69, 0x9a, 0x1a, 0x06, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x85, 0xb0, 0x82, 0x68, 0x84, 0x46,
+  0x4f, 0xf4, 0x50, 0x50, 0xd2, 0xf8, 0x78, 0x71, 0x3b, 0x58, 0x00, 0x2b,
+  0x00, 0xf0, 0x81, 0x80, 0x8e, 0x46, 0x01, 0x29, 0x7d, 0xdb, 0x47, 0xf2,
+  0x04, 0x40, 0x45, 0xf2, 0x04, 0x41, 0x38, 0x44, 0x04, 0x92, 0xd2, 0xf8,
+  0xb8, 0x61, 0x03, 0x90, 0x78, 0x18, 0x4f, 0xf0, 0x00, 0x09, 0x43, 0xf2,
+  0x04, 0x4a, 0x45, 0xf2, 0x04, 0x4b, 0x45, 0xf2, 0x08, 0x48, 0x02, 0x90,
+  0x07, 0xf5, 0x50, 0x50, 0x01, 0x90, 0x01, 0x2b, 0x45, 0xdb, 0x00, 0x20,
+  0x00, 0x21, 0x0b, 0xeb, 0xc0, 0x02, 0xb2, 0x42, 0x9c, 0xbf, 0x0a, 0xeb,
+  0xc1, 0x05, 0xb5, 0x42, 0x5e, 0xd8, 0xc4, 0x00, 0xba, 0x58, 0x44, 0x44,
+  0x7a, 0x51, 0xb4, 0x42, 0x9f, 0xbf, 0xca, 0x00, 0x43, 0xf2, 0x08, 0x45,
+  0x2a, 0x44, 0xb2, 0x42, 0x52, 0xd8, 0x3d, 0x59, 0xbd, 0x50, 0x1a, 0x46,
+  0x11, 0xea, 0x62, 0x0f, 0x18, 0xd0, 0x81, 0xea, 0x62, 0x01, 0x11, 0xea,
+  0xa2, 0x0f, 0x19, 0xd0, 0x81, 0xea, 0xa2, 0x01, 0x11, 0xea, 0xe2, 0x0f,
+  0x1a, 0xd0, 0x81, 0xea, 0xe2, 0x05, 0x14, 0x11, 0x15, 0xea, 0x22, 0x1f,
+  0x85, 0xea, 0x22, 0x11, 0x22, 0x46, 0xe9, 0xd1, 0x29, 0x46, 0x01, 0x30,
+  0x21, 0x43, 0x98, 0x42, 0xcd, 0xd1, 0x10, 0xe0, 0x54, 0x10, 0x01, 0x30,
+  0x21, 0x43, 0x98, 0x42, 0xc7, 0xd1, 0x0a, 0xe0, 0x94, 0x10, 0x01, 0x30,
+  0x21, 0x43, 0x98, 0x42, 0xc1, 0xd1, 0x04, 0xe0, 0xd4, 0x10, 0x01, 0x30,
+  0x21, 0x43, 0x98, 0x42, 0xbb, 0xd1, 0x01, 0x22, 0x60, 0x46, 0x19, 0x46,
+  0x64, 0x46, 0x75, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x04, 0x98, 0x01, 0x99,
+  0x90, 0xf8, 0x68, 0x00, 0x98, 0xb9, 0x03, 0x98, 0x91, 0xed, 0x01, 0x0a,
+  0x09, 0xf1, 0x01, 0x09, 0xae, 0x46, 0x90, 0xed, 0x00, 0x1a, 0x02, 0x98,
+  0x20, 0xee, 0x01, 0x0a, 0xa9, 0x45, 0x80, 0xed, 0x00, 0x0a, 0x04, 0xd0,
+  0xa4, 0x46, 0x0b, 0x68, 0x01, 0x2b, 0x9a, 0xda, 0xdf, 0xe7, 0x05, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x04, 0x98, 0x05, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x20, 0xc0, 0x01, 0xab,
+  0xb3, 0xeb, 0x0c, 0x0c, 0x03, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x1b, 0x69,
+  0x9c, 0x45, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x4f, 0x81, 0xb0, 0x2d, 0xed, 0x06, 0x8b, 0x9c, 0xb0, 0x83, 0x46,
+  0xd0, 0xf8, 0x78, 0xc1, 0xd0, 0xf8, 0xb8, 0x91, 0x03, 0x23, 0x01, 0x26,
+  0xdf, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa, 0x05, 0xf5, 0xa9, 0x42,
+  0x15, 0xdd, 0x9f, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa, 0x05, 0xf5,
+  0xa9, 0x42, 0xc1, 0xbf, 0x5f, 0x1e, 0x07, 0xf0, 0x1f, 0x05, 0x06, 0xfa,
+  0x05, 0xf5, 0xa9, 0x42, 0x07, 0xdd, 0x03, 0xf0, 0x1f, 0x07, 0x04, 0x33,
+  0x06, 0xfa, 0x07, 0xf7, 0xb9, 0x42, 0xe3, 0xdc, 0x1f, 0x1f, 0xfb, 0x07,
+  0x40, 0xf0, 0x7e, 0x81, 0x01, 0x27, 0x01, 0x29, 0xc0, 0xf2, 0xbf, 0x81,
+  0xbd, 0x00, 0x8d, 0x42, 0x00, 0xf3, 0xbb, 0x81, 0x4f, 0xea, 0x82, 0x0e,
+  0x43, 0xf2, 0x04, 0x48, 0x4f, 0xea, 0xc2, 0x0a, 0x02, 0xeb, 0x42, 0x02,
+  0x90, 0x00, 0x0c, 0xeb, 0x08, 0x02, 0x1b, 0x92, 0x00, 0x2d, 0x00, 0xf0,
+  0xc0, 0x81, 0x2b, 0x46, 0x01, 0x2f, 0xc0, 0xf2, 0x5b, 0x81, 0xdd, 0x00,
+  0x01, 0x95, 0xcd, 0xf8, 0x24, 0xa0, 0x43, 0xf2, 0x08, 0x4a, 0x75, 0x46,
+  0x0a, 0xeb, 0xc7, 0x0e, 0xcd, 0xf8, 0x54, 0xe0, 0xae, 0x46, 0x1b, 0x9e,
+  0x07, 0xeb, 0x47, 0x02, 0x91, 0xfb, 0xf3, 0xf4, 0x06, 0xeb, 0xc7, 0x05,
+  0x0f, 0x95, 0x08, 0xeb, 0xc7, 0x05, 0x16, 0x95, 0x0a, 0xeb, 0x07, 0x15,
+  0x13, 0x95, 0x06, 0xeb, 0x07, 0x15, 0x0e, 0x95, 0x08, 0xeb, 0x07, 0x15,
+  0x14, 0x95, 0x0e, 0xfb, 0x04, 0xf5, 0x0c, 0x95, 0x0a, 0xeb, 0xc2, 0x05,
+  0xdd, 0xf8, 0x24, 0xa0, 0x11, 0x95, 0x0a, 0xfb, 0x04, 0xf5, 0x0b, 0x95,
+  0x06, 0xeb, 0xc2, 0x05, 0x00, 0xfb, 0x04, 0xf6, 0x08, 0xeb, 0xc2, 0x02,
+  0x0d, 0x95, 0x0a, 0x96, 0x00, 0x26, 0x12, 0x92, 0x00, 0x22, 0x06, 0x96,
+  0xcd, 0xf8, 0x20, 0xb0, 0xcd, 0xe9, 0x04, 0xe7, 0xcd, 0xe9, 0x02, 0x30,
+  0xcd, 0xf8, 0x40, 0xc0, 0x48, 0xf2, 0x10, 0x06, 0x47, 0xf2, 0x10, 0x48,
+  0x47, 0xf2, 0x10, 0x4a, 0x48, 0xf2, 0x10, 0x0e, 0x47, 0xf2, 0x10, 0x43,
+  0x93, 0x46, 0x48, 0xf2, 0x10, 0x05, 0x3c, 0x46, 0x07, 0x92, 0x43, 0xf2,
+  0x08, 0x40, 0x58, 0x44, 0x48, 0x45, 0x9f, 0xbf, 0x4e, 0x45, 0x16, 0x9a,
+  0x02, 0xeb, 0x0b, 0x07, 0x4f, 0x45, 0x00, 0xf2, 0x56, 0x81, 0xca, 0x45,
+  0x9e, 0xbf, 0x15, 0x9a, 0x02, 0xeb, 0x0b, 0x07, 0x4f, 0x45, 0x00, 0xf2,
+  0x4e, 0x81, 0xce, 0x45, 0x9e, 0xbf, 0x14, 0x9a, 0x02, 0xeb, 0x0b, 0x07,
+  0x4f, 0x45, 0x00, 0xf2, 0x46, 0x81, 0x4b, 0x45, 0x9e, 0xbf, 0x13, 0x9a,
+  0x02, 0xeb, 0x0b, 0x07, 0x4f, 0x45, 0x00, 0xf2, 0x3e, 0x81, 0x4d, 0x45,
+  0x9e, 0xbf, 0x12, 0x9a, 0x02, 0xeb, 0x0b, 0x07, 0x4f, 0x45, 0x00, 0xf2,
+  0x36, 0x81, 0xa5, 0xf5, 0x40, 0x67, 0x4f, 0x45, 0x9e, 0xbf, 0x11, 0x9a,
+  0x02, 0xeb, 0x0b, 0x07, 0x4f, 0x45, 0x00, 0xf2, 0x2c, 0x81, 0x1a, 0x94,
+  0x2f, 0x46, 0xdd, 0xf8, 0x40, 0xc0, 0x0f, 0x9a, 0x02, 0xeb, 0x0b, 0x04,
+  0x18, 0x94, 0x5c, 0xf8, 0x06, 0x50, 0x52, 0xf8, 0x0b, 0x20, 0x00, 0xee,
+  0x10, 0x5a, 0x65, 0x68, 0x0e, 0x9c, 0x01, 0xee, 0x10, 0x2a, 0x5c, 0xf8,
+  0x0a, 0x20, 0x02, 0xee, 0x10, 0x5a, 0x54, 0xf8, 0x0b, 0x50, 0x03, 0xee,
+  0x10, 0x2a, 0x5c, 0xf8, 0x0e, 0x20, 0x07, 0xee, 0x10, 0x5a, 0x04, 0xeb,
+  0x0b, 0x05, 0x19, 0x97, 0x04, 0xee, 0x10, 0x2a, 0x5c, 0xf8, 0x03, 0x20,
+  0x44, 0x46, 0xdd, 0xf8, 0x34, 0x80, 0x00, 0xee, 0x90, 0x2a, 0x6a, 0x68,
+  0x02, 0xee, 0x90, 0x2a, 0x5c, 0xf8, 0x07, 0x20, 0x77, 0x46, 0x08, 0xeb,
+  0x0b, 0x0e, 0x58, 0xf8, 0x0b, 0x80, 0x17, 0x93, 0x05, 0xee, 0x90, 0x8a,
+  0xa0, 0x46, 0x04, 0xee, 0x90, 0x2a, 0xde, 0xf8, 0x04, 0x30, 0x5c, 0xf8,
+  0x08, 0x20, 0x08, 0xee, 0x10, 0x3a, 0x09, 0xee, 0x10, 0x2a, 0x1b, 0x9c,
+  0x20, 0xee, 0x01, 0x5a, 0x04, 0xeb, 0x0b, 0x02, 0x23, 0xee, 0x02, 0x6a,
+  0x04, 0x38, 0x64, 0xee, 0x07, 0x3a, 0x54, 0x68, 0x60, 0xee, 0xa2, 0x6a,
+  0x48, 0x45, 0x64, 0xee, 0xa5, 0x7a, 0x29, 0xee, 0x08, 0xaa, 0x75, 0xee,
+  0x06, 0x1a, 0x33, 0xee, 0xa6, 0x5a, 0x03, 0xee, 0x90, 0x4a, 0x37, 0xee,
+  0x8a, 0x6a, 0x73, 0xee, 0xa1, 0x6a, 0x75, 0xee, 0x06, 0x7a, 0x36, 0xee,
+  0xa7, 0xaa, 0x1a, 0xee, 0x10, 0x4a, 0x54, 0x60, 0x00, 0xf2, 0xc5, 0x80,
+  0x23, 0xee, 0x01, 0x1a, 0x1b, 0x9c, 0x20, 0xee, 0x02, 0x0a, 0x18, 0x9b,
+  0x20, 0xee, 0x87, 0x2a, 0x54, 0xf8, 0x0b, 0x00, 0x24, 0xee, 0x22, 0x3a,
+  0x29, 0xee, 0x25, 0x4a, 0x24, 0xee, 0x88, 0x7a, 0x31, 0xee, 0x40, 0x0a,
+  0x32, 0xee, 0x43, 0x1a, 0x02, 0xee, 0x10, 0x0a, 0x34, 0xee, 0x47, 0x3a,
+  0x73, 0xee, 0xe1, 0x0a, 0x32, 0xee, 0x00, 0x7a, 0x71, 0xee, 0x03, 0x1a,
+  0x31, 0xee, 0x43, 0x1a, 0x32, 0xee, 0x40, 0x0a, 0x37, 0xee, 0x61, 0x2a,
+  0x36, 0xee, 0xe7, 0x4a, 0x35, 0xee, 0x46, 0x3a, 0x12, 0xee, 0x10, 0x2a,
+  0x30, 0xee, 0xc1, 0x2a, 0x14, 0xee, 0x10, 0x0a, 0x30, 0xee, 0x81, 0x1a,
+  0x30, 0xee, 0x03, 0x4a, 0x2a, 0x60, 0x68, 0x60, 0x12, 0xee, 0x10, 0x0a,
+  0x37, 0xee, 0x21, 0x2a, 0x19, 0x9d, 0x30, 0xee, 0x43, 0x0a, 0x58, 0x60,
+  0x11, 0xee, 0x10, 0x0a, 0x14, 0xee, 0x10, 0x2a, 0xce, 0xf8, 0x04, 0x00,
+  0x12, 0xee, 0x10, 0x0a, 0x1a, 0x60, 0x10, 0xee, 0x10, 0x2a, 0x44, 0xf8,
+  0x0b, 0x00, 0x0c, 0x98, 0x17, 0x9b, 0xce, 0xf8, 0x00, 0x20, 0x1a, 0x9c,
+  0x03, 0x44, 0x0a, 0x9a, 0x07, 0xeb, 0x00, 0x0e, 0x0b, 0x98, 0x01, 0x3c,
+  0x15, 0x44, 0x0b, 0xf1, 0x08, 0x0b, 0x82, 0x44, 0x06, 0x44, 0x90, 0x44,
+  0x7f, 0xf4, 0x07, 0xaf, 0x02, 0x9b, 0x43, 0xf2, 0x04, 0x48, 0x06, 0x9a,
+  0x1a, 0x44, 0x06, 0x92, 0x10, 0x46, 0x8a, 0x42, 0x01, 0x98, 0xdd, 0xf8,
+  0x40, 0xc0, 0x07, 0x9a, 0x02, 0x44, 0x05, 0x9f, 0xdd, 0xe9, 0x08, 0xba,
+  0xdd, 0xe9, 0x03, 0x0e, 0xff, 0xf6, 0xe4, 0xae, 0xb1, 0xeb, 0x83, 0x0f,
+  0x1f, 0x46, 0x4f, 0xea, 0x83, 0x05, 0xbf, 0xf6, 0x97, 0xae, 0x44, 0xe0,
+  0x01, 0x29, 0x42, 0xdb, 0x00, 0x23, 0x43, 0xf2, 0x10, 0x47, 0xa7, 0xf1,
+  0x08, 0x06, 0x4e, 0x45, 0x98, 0xbf, 0x4f, 0x45, 0x3f, 0xd8, 0x0c, 0xeb,
+  0x07, 0x06, 0x5c, 0xf8, 0x07, 0x40, 0x01, 0xee, 0x10, 0x4a, 0x56, 0xf8,
+  0x08, 0x5c, 0x00, 0xee, 0x10, 0x5a, 0xa7, 0xf1, 0x0c, 0x05, 0x4d, 0x45,
+  0x30, 0xee, 0x41, 0x2a, 0x12, 0xee, 0x10, 0x4a, 0x4c, 0xf8, 0x07, 0x40,
+  0x9c, 0xbf, 0x3d, 0x1f, 0x4d, 0x45, 0x28, 0xd8, 0x56, 0xf8, 0x0c, 0x5c,
+  0x56, 0xf8, 0x04, 0x4c, 0x02, 0xee, 0x10, 0x5a, 0x03, 0xee, 0x10, 0x4a,
+  0x30, 0xee, 0x01, 0x0a, 0x02, 0x33, 0x8b, 0x42, 0x07, 0xf1, 0x10, 0x07,
+  0x32, 0xee, 0x43, 0x4a, 0x32, 0xee, 0x03, 0x1a, 0x14, 0xee, 0x10, 0x5a,
+  0x11, 0xee, 0x10, 0x4a, 0x46, 0xf8, 0x04, 0x5c, 0x10, 0xee, 0x10, 0x5a,
+  0x46, 0xf8, 0x0c, 0x4c, 0x46, 0xf8, 0x08, 0x5c, 0xc3, 0xdb, 0x02, 0x27,
+  0x01, 0x29, 0xbf, 0xf6, 0x41, 0xae, 0x1c, 0xb0, 0xbd, 0xec, 0x06, 0x8b,
+  0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x02, 0xe0, 0x02, 0x21,
+  0xdd, 0xf8, 0x20, 0xb0, 0x58, 0x46, 0x1c, 0xb0, 0xbd, 0xec, 0x06, 0x8b,
+  0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x04, 0x21,
+  0xf4, 0xe7, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa,
+  0xc0, 0xf2, 0x00, 0x01, 0x49, 0x6a, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0xb0, 0xb5, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4,
+  0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3, 0xca, 0x00, 0x49, 0xf6, 0xc5, 0x51,
+  0xc8, 0xf2, 0x1c, 0x11, 0x31, 0xd0, 0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2,
+  0x93, 0x1c, 0xd0, 0xf8, 0xa8, 0xe1, 0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33,
+  0x43, 0xf2, 0x04, 0x44, 0x74, 0x45, 0x9c, 0xbf, 0x65, 0x1c, 0x75, 0x45,
+  0x23, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x9c, 0xbf, 0xe5, 0x1c, 0x75, 0x45,
+  0x1d, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04,
+  0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x04, 0x5b, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x03, 0x5c, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x02, 0x5c, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xd8, 0xd1, 0x08, 0x46,
+  0xb0, 0xbd, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xb0, 0xbd,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2,
+  0x00, 0x02, 0x92, 0x6a, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00,
+  0x00, 0x23, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x6a, 0x9a, 0x1a,
+  0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x85, 0xb0, 0x83, 0x68,
+  0x84, 0x46, 0x4f, 0xf4, 0x50, 0x50, 0xd3, 0xf8, 0x78, 0x71, 0x3a, 0x58,
+  0x00, 0x2a, 0x00, 0xf0, 0x82, 0x80, 0x8e, 0x46, 0x01, 0x29, 0x7e, 0xdb,
+  0x47, 0xf2, 0x04, 0x40, 0x45, 0xf2, 0x04, 0x41, 0x38, 0x44, 0x04, 0x93,
+  0xd3, 0xf8, 0xb8, 0x61, 0x03, 0x90, 0x78, 0x18, 0x4f, 0xf0, 0x00, 0x09,
+  0x43, 0xf2, 0x04, 0x4a, 0x45, 0xf2, 0x04, 0x4b, 0x45, 0xf2, 0x08, 0x48,
+  0x02, 0x90, 0x07, 0xf5, 0x50, 0x50, 0x01, 0x90, 0x01, 0x2a, 0x45, 0xdb,
+  0x00, 0x20, 0x00, 0x21, 0x0b, 0xeb, 0xc0, 0x03, 0xb3, 0x42, 0x9c, 0xbf,
+  0x0a, 0xeb, 0xc1, 0x05, 0xb5, 0x42, 0x5f, 0xd8, 0xc4, 0x00, 0xfb, 0x58,
+  0x44, 0x44, 0x7b, 0x51, 0xb4, 0x42, 0x9f, 0xbf, 0xcb, 0x00, 0x43, 0xf2,
+  0x08, 0x45, 0x2b, 0x44, 0xb3, 0x42, 0x53, 0xd8, 0x3d, 0x59, 0xfd, 0x50,
+  0x13, 0x46, 0x11, 0xea, 0x63, 0x0f, 0x18, 0xd0, 0x81, 0xea, 0x63, 0x01,
+  0x11, 0xea, 0xa3, 0x0f, 0x19, 0xd0, 0x81, 0xea, 0xa3, 0x01, 0x11, 0xea,
+  0xe3, 0x0f, 0x1a, 0xd0, 0x81, 0xea, 0xe3, 0x05, 0x1c, 0x11, 0x15, 0xea,
+  0x23, 0x1f, 0x85, 0xea, 0x23, 0x11, 0x23, 0x46, 0xe9, 0xd1, 0x29, 0x46,
+  0x01, 0x30, 0x21, 0x43, 0x90, 0x42, 0xcd, 0xd1, 0x10, 0xe0, 0x5c, 0x10,
+  0x01, 0x30, 0x21, 0x43, 0x90, 0x42, 0xc7, 0xd1, 0x0a, 0xe0, 0x9c, 0x10,
+  0x01, 0x30, 0x21, 0x43, 0x90, 0x42, 0xc1, 0xd1, 0x04, 0xe0, 0xdc, 0x10,
+  0x01, 0x30, 0x21, 0x43, 0x90, 0x42, 0xbb, 0xd1, 0x43, 0xf2, 0x04, 0x41,
+  0x01, 0x23, 0x60, 0x46, 0x64, 0x46, 0x75, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x04, 0x98, 0x01, 0x99, 0x90, 0xf8, 0x68, 0x00, 0x98, 0xb9, 0x03, 0x98,
+  0x91, 0xed, 0x01, 0x0a, 0x09, 0xf1, 0x01, 0x09, 0xae, 0x46, 0x90, 0xed,
+  0x00, 0x1a, 0x02, 0x98, 0x20, 0xee, 0x01, 0x0a, 0xa9, 0x45, 0x80, 0xed,
+  0x00, 0x0a, 0x04, 0xd0, 0xa4, 0x46, 0x0a, 0x68, 0x01, 0x2a, 0x99, 0xda,
+  0xde, 0xe7, 0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x04, 0x98,
+  0x05, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x0c, 0x0d, 0xf1, 0x04, 0x0e, 0xc0, 0xf2,
+  0x00, 0x0c, 0xdc, 0xf8, 0x30, 0xc0, 0xbe, 0xeb, 0x0c, 0x0c, 0x07, 0xd3,
+  0xd0, 0xf8, 0x10, 0xe0, 0xf4, 0x45, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x8b, 0xb0, 0x02, 0x2a,
+  0x1d, 0xdb, 0xd0, 0xf8, 0x08, 0xa0, 0x0d, 0x46, 0x04, 0x46, 0xda, 0xf8,
+  0x78, 0xb1, 0xda, 0xf8, 0xb8, 0x81, 0x08, 0xd1, 0xa8, 0x45, 0x15, 0xd2,
+  0x02, 0x21, 0x50, 0x46, 0x0b, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x16, 0x46, 0x1f, 0x46, 0x52, 0x08, 0x20, 0x46, 0x5b, 0x00,
+  0x29, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0x00, 0x28,
+  0x3f, 0xd0, 0x0b, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x15, 0xf1, 0x09, 0x0f,
+  0xe6, 0xd8, 0x05, 0xf1, 0x08, 0x00, 0x40, 0x45, 0xe2, 0xd8, 0x5b, 0xf8,
+  0x05, 0x10, 0x5b, 0xf8, 0x00, 0x20, 0x00, 0xee, 0x10, 0x1a, 0x01, 0xee,
+  0x10, 0x2a, 0x0b, 0xeb, 0x05, 0x02, 0x29, 0x1d, 0x41, 0x45, 0x30, 0xee,
+  0x01, 0x2a, 0x12, 0xee, 0x10, 0x3a, 0x13, 0x60, 0xd0, 0xd8, 0x15, 0xf1,
+  0x0d, 0x0f, 0xcd, 0xd8, 0x05, 0xf1, 0x0c, 0x02, 0x42, 0x45, 0xc9, 0xd8,
+  0x5b, 0xf8, 0x01, 0x30, 0x5b, 0xf8, 0x02, 0x70, 0x02, 0xee, 0x10, 0x3a,
+  0x03, 0xee, 0x10, 0x7a, 0x30, 0xee, 0x41, 0x0a, 0x58, 0x44, 0x59, 0x44,
+  0x32, 0xee, 0x43, 0x4a, 0x32, 0xee, 0x03, 0x1a, 0x14, 0xee, 0x10, 0x3a,
+  0x4b, 0xf8, 0x02, 0x30, 0x10, 0xee, 0x10, 0x2a, 0x11, 0xee, 0x10, 0x3a,
+  0x02, 0x60, 0x0b, 0x60, 0x0b, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x6f, 0xf0,
+  0x0c, 0x00, 0x4f, 0xea, 0x96, 0x09, 0x00, 0xea, 0x86, 0x00, 0x4a, 0x46,
+  0x41, 0x19, 0xbb, 0x00, 0x20, 0x46, 0x08, 0x93, 0xff, 0xf7, 0xfe, 0xff,
+  0x9a, 0xf8, 0x68, 0x00, 0x00, 0x28, 0xae, 0xd1, 0x09, 0xeb, 0x49, 0x00,
+  0x0a, 0x90, 0x4a, 0x46, 0x08, 0x9b, 0x05, 0xeb, 0xc0, 0x01, 0x20, 0x46,
+  0xff, 0xf7, 0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0x00, 0x28, 0xa0, 0xd1,
+  0x04, 0x2e, 0x9e, 0xd3, 0x0a, 0x98, 0x4b, 0x46, 0xc1, 0x00, 0xb9, 0xf1,
+  0x01, 0x0f, 0x07, 0xeb, 0x47, 0x00, 0x48, 0xf2, 0x10, 0x06, 0x4f, 0xea,
+  0x80, 0x00, 0x98, 0xbf, 0x01, 0x23, 0x01, 0x90, 0x4f, 0xea, 0x09, 0x10,
+  0xcd, 0xe9, 0x04, 0x10, 0x01, 0xeb, 0x0b, 0x00, 0x4f, 0xea, 0xc9, 0x01,
+  0x04, 0x30, 0x06, 0x91, 0x03, 0x90, 0x0b, 0xeb, 0x09, 0x10, 0x48, 0xf2,
+  0x10, 0x01, 0x0b, 0xeb, 0xc9, 0x02, 0x04, 0x30, 0x0b, 0xeb, 0x01, 0x04,
+  0x02, 0x90, 0x02, 0xf1, 0x04, 0x09, 0x47, 0xf2, 0x10, 0x40, 0x09, 0x90,
+  0x47, 0xf2, 0x10, 0x40, 0x0a, 0x90, 0x06, 0x98, 0x28, 0x44, 0x07, 0x1d,
+  0x47, 0x45, 0x9c, 0xbf, 0x2f, 0x1d, 0x47, 0x45, 0x3f, 0xf6, 0x58, 0xaf,
+  0x46, 0x45, 0x9e, 0xbf, 0x05, 0x99, 0x4f, 0x19, 0x47, 0x45, 0x3f, 0xf6,
+  0x51, 0xaf, 0x09, 0x99, 0x41, 0x45, 0x9c, 0xbf, 0x04, 0x37, 0x47, 0x45,
+  0x3f, 0xf6, 0x4a, 0xaf, 0x0a, 0x99, 0x01, 0xf5, 0x40, 0x67, 0x47, 0x45,
+  0x9e, 0xbf, 0x04, 0x99, 0x4f, 0x19, 0x47, 0x45, 0x3f, 0xf6, 0x40, 0xaf,
+  0x0a, 0x99, 0x41, 0x45, 0x9c, 0xbf, 0x04, 0x37, 0x47, 0x45, 0x3f, 0xf6,
+  0x39, 0xaf, 0x02, 0x9a, 0x5b, 0xf8, 0x06, 0x70, 0x02, 0xeb, 0x05, 0x0e,
+  0x01, 0xee, 0x10, 0x7a, 0x57, 0x59, 0x03, 0x9a, 0x5e, 0xf8, 0x04, 0x1c,
+  0x02, 0xeb, 0x05, 0x0c, 0x03, 0xee, 0x10, 0x1a, 0x09, 0x99, 0x06, 0xee,
+  0x10, 0x7a, 0x5c, 0xf8, 0x04, 0x7c, 0x5b, 0xf8, 0x01, 0x10, 0x07, 0xee,
+  0x10, 0x7a, 0x01, 0xee, 0x90, 0x1a, 0x21, 0x68, 0x04, 0xee, 0x10, 0x1a,
+  0x0a, 0x99, 0x57, 0x59, 0x21, 0xee, 0x03, 0x0a, 0x5b, 0xf8, 0x01, 0x10,
+  0x02, 0xee, 0x90, 0x7a, 0x03, 0xee, 0x90, 0x1a, 0x21, 0xee, 0x86, 0x2a,
+  0x24, 0xee, 0x07, 0x5a, 0x0b, 0xeb, 0x05, 0x01, 0x40, 0x45, 0x59, 0xf8,
+  0x05, 0x00, 0x63, 0xee, 0xa2, 0x0a, 0x4f, 0x68, 0x30, 0xee, 0x02, 0x0a,
+  0x35, 0xee, 0x20, 0x2a, 0x05, 0xee, 0x10, 0x7a, 0x70, 0xee, 0x02, 0x0a,
+  0x75, 0xee, 0x20, 0x4a, 0x14, 0xee, 0x90, 0x7a, 0x4f, 0x60, 0x98, 0xbf,
+  0x45, 0x45, 0x3f, 0xf6, 0xf5, 0xae, 0x21, 0xee, 0x83, 0x3a, 0x5b, 0xf8,
+  0x05, 0x10, 0x21, 0xee, 0x06, 0x1a, 0x4a, 0x46, 0x23, 0xee, 0x87, 0x6a,
+  0x07, 0x93, 0x24, 0xee, 0x22, 0x4a, 0x33, 0xee, 0x41, 0x1a, 0x30, 0xee,
+  0x42, 0x0a, 0x36, 0xee, 0x44, 0x3a, 0x04, 0xee, 0x10, 0x1a, 0x09, 0xeb,
+  0x05, 0x01, 0x35, 0xee, 0x60, 0x5a, 0x31, 0xee, 0x03, 0x6a, 0x31, 0xee,
+  0x43, 0x1a, 0x03, 0xee, 0x10, 0x0a, 0x51, 0xf8, 0x04, 0x0c, 0x15, 0xee,
+  0x10, 0x7a, 0x34, 0xee, 0x06, 0x7a, 0x02, 0xee, 0x10, 0x0a, 0x34, 0xee,
+  0x46, 0x4a, 0xce, 0xf8, 0x00, 0x70, 0x33, 0xee, 0x41, 0x6a, 0x17, 0xee,
+  0x10, 0x0a, 0x31, 0xee, 0x03, 0x1a, 0x14, 0xee, 0x10, 0x9a, 0x32, 0xee,
+  0x00, 0x4a, 0x32, 0xee, 0x40, 0x0a, 0x16, 0xee, 0x10, 0x3a, 0x4b, 0xf8,
+  0x05, 0x00, 0x11, 0xee, 0x10, 0x7a, 0x14, 0xee, 0x10, 0x0a, 0x0b, 0x60,
+  0x10, 0xee, 0x10, 0x3a, 0x4e, 0xf8, 0x04, 0x9c, 0x41, 0xf8, 0x04, 0x0c,
+  0x01, 0x98, 0x0a, 0x99, 0x4c, 0xf8, 0x04, 0x3c, 0x07, 0x9b, 0x01, 0x44,
+  0x0a, 0x91, 0x04, 0x44, 0xdd, 0xe9, 0x08, 0x01, 0x91, 0x46, 0x08, 0x35,
+  0x01, 0x3b, 0x06, 0x44, 0xcc, 0xf8, 0x00, 0x70, 0x01, 0x44, 0x09, 0x91,
+  0x7f, 0xf4, 0x3b, 0xaf, 0xad, 0xe6, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x49, 0x6b, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0xb0, 0xb5, 0xd0, 0xf8,
+  0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3, 0xca, 0x00,
+  0x49, 0xf6, 0xc5, 0x51, 0xc8, 0xf2, 0x1c, 0x11, 0x31, 0xd0, 0x03, 0xf5,
+  0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c, 0xd0, 0xf8, 0xa8, 0xe1, 0xc0, 0xf2,
+  0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x74, 0x45, 0x9c, 0xbf,
+  0x65, 0x1c, 0x75, 0x45, 0x23, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x9c, 0xbf,
+  0xe5, 0x1c, 0x75, 0x45, 0x1d, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x04, 0x3a,
+  0x04, 0xf1, 0x04, 0x04, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x04, 0x5b,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x03, 0x5c,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x02, 0x5c,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1,
+  0xd8, 0xd1, 0x08, 0x46, 0xb0, 0xbd, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x00, 0x20, 0xb0, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x92, 0x6b, 0x9a, 0x1a, 0x06, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x00, 0x23, 0x0a, 0x46, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02,
+  0xd2, 0x6b, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0x2d, 0xed, 0x02, 0x8b, 0x88, 0xb0, 0xd0, 0xf8, 0x08, 0x90,
+  0x05, 0x90, 0x4f, 0xf4, 0x50, 0x50, 0xd9, 0xf8, 0x78, 0xb1, 0x5b, 0xf8,
+  0x00, 0xe0, 0xbe, 0xf1, 0x00, 0x0f, 0x00, 0xf0, 0x27, 0x81, 0x01, 0x29,
+  0xc0, 0xf2, 0x24, 0x81, 0x47, 0xf2, 0x04, 0x40, 0x45, 0xf2, 0x04, 0x42,
+  0x58, 0x44, 0x01, 0x90, 0x0b, 0xeb, 0x02, 0x00, 0x00, 0x90, 0x0b, 0xf5,
+  0x50, 0x50, 0x02, 0x90, 0x47, 0xf2, 0x14, 0x40, 0xb6, 0xee, 0x00, 0x8a,
+  0x58, 0x44, 0x07, 0x90, 0x48, 0xf2, 0x14, 0x00, 0xd9, 0xf8, 0xb8, 0x61,
+  0x58, 0x44, 0x43, 0xf2, 0x04, 0x48, 0x45, 0xf2, 0x04, 0x4a, 0x45, 0xf2,
+  0x08, 0x47, 0x06, 0x90, 0x00, 0x20, 0x04, 0x90, 0x03, 0x91, 0x0e, 0xeb,
+  0xde, 0x71, 0xbe, 0xf1, 0x02, 0x0f, 0x4f, 0xea, 0x61, 0x01, 0x29, 0xda,
+  0x02, 0x22, 0x05, 0x98, 0xff, 0xf7, 0xfe, 0xff, 0x99, 0xf8, 0x68, 0x00,
+  0x03, 0x99, 0x00, 0x28, 0x40, 0xf0, 0xf2, 0x80, 0x02, 0x98, 0x90, 0xed,
+  0x01, 0x0a, 0x90, 0xed, 0x02, 0x1a, 0x30, 0xee, 0x41, 0x2a, 0xd0, 0xf8,
+  0x00, 0xe0, 0x30, 0xee, 0x01, 0x0a, 0xbe, 0xf1, 0x04, 0x0f, 0x80, 0xed,
+  0x01, 0x0a, 0x80, 0xed, 0x02, 0x2a, 0x5a, 0xda, 0x01, 0x98, 0x90, 0xed,
+  0x00, 0x1a, 0x04, 0x98, 0x01, 0x30, 0x04, 0x90, 0x88, 0x42, 0x00, 0x98,
+  0x20, 0xee, 0x01, 0x0a, 0x80, 0xed, 0x00, 0x0a, 0xcf, 0xd1, 0xd1, 0xe0,
+  0x00, 0x20, 0x00, 0x22, 0x0a, 0xeb, 0xc0, 0x03, 0xb3, 0x42, 0x9c, 0xbf,
+  0x08, 0xeb, 0xc2, 0x04, 0xb4, 0x42, 0x00, 0xf2, 0xcd, 0x80, 0xc5, 0x00,
+  0x5b, 0xf8, 0x03, 0x30, 0x3d, 0x44, 0x4b, 0xf8, 0x04, 0x30, 0xb5, 0x42,
+  0x9f, 0xbf, 0xd3, 0x00, 0x43, 0xf2, 0x08, 0x44, 0x23, 0x44, 0xb3, 0x42,
+  0x00, 0xf2, 0xbe, 0x80, 0x5b, 0xf8, 0x05, 0x50, 0x4b, 0xf8, 0x03, 0x50,
+  0x0b, 0x46, 0x12, 0xea, 0x63, 0x0f, 0x18, 0xd0, 0x82, 0xea, 0x63, 0x02,
+  0x12, 0xea, 0xa3, 0x0f, 0x19, 0xd0, 0x82, 0xea, 0xa3, 0x02, 0x12, 0xea,
+  0xe3, 0x0f, 0x1a, 0xd0, 0x82, 0xea, 0xe3, 0x04, 0x1d, 0x11, 0x14, 0xea,
+  0x23, 0x1f, 0x84, 0xea, 0x23, 0x12, 0x2b, 0x46, 0xe9, 0xd1, 0x22, 0x46,
+  0x01, 0x30, 0x2a, 0x43, 0x88, 0x42, 0xc7, 0xd1, 0x9a, 0xe7, 0x5d, 0x10,
+  0x01, 0x30, 0x2a, 0x43, 0x88, 0x42, 0xc1, 0xd1, 0x94, 0xe7, 0x9d, 0x10,
+  0x01, 0x30, 0x2a, 0x43, 0x88, 0x42, 0xbb, 0xd1, 0x8e, 0xe7, 0xdd, 0x10,
+  0x01, 0x30, 0x2a, 0x43, 0x88, 0x42, 0xb5, 0xd1, 0x88, 0xe7, 0x4f, 0xea,
+  0x9e, 0x01, 0x6f, 0xf0, 0x04, 0x00, 0x01, 0x29, 0x4f, 0xf0, 0x01, 0x01,
+  0x00, 0xea, 0x8e, 0x02, 0x4f, 0xf0, 0x00, 0x03, 0x88, 0xbf, 0x4f, 0xea,
+  0x9e, 0x01, 0x4f, 0xea, 0x81, 0x0c, 0x02, 0xf5, 0x50, 0x52, 0x43, 0xf2,
+  0x0c, 0x45, 0x29, 0x1d, 0xb1, 0x42, 0x98, 0xbf, 0xb2, 0x42, 0x71, 0xd8,
+  0x47, 0xf2, 0x14, 0x40, 0x1c, 0x18, 0xb4, 0x42, 0x9c, 0xbf, 0x14, 0x1f,
+  0xb4, 0x42, 0x69, 0xd8, 0x04, 0x39, 0xb1, 0x42, 0x9e, 0xbf, 0x48, 0xf2,
+  0x14, 0x00, 0x19, 0x18, 0xb1, 0x42, 0x61, 0xd8, 0x0b, 0xeb, 0x05, 0x01,
+  0x0b, 0xeb, 0x02, 0x04, 0x5b, 0xf8, 0x05, 0x00, 0x08, 0x35, 0xd1, 0xf8,
+  0x04, 0x80, 0x54, 0xf8, 0x04, 0xac, 0x01, 0xee, 0x10, 0x0a, 0x5b, 0xf8,
+  0x02, 0x00, 0x00, 0xee, 0x10, 0xaa, 0x02, 0xee, 0x10, 0x8a, 0x03, 0xee,
+  0x10, 0x0a, 0x07, 0x98, 0x45, 0xf2, 0x04, 0x4a, 0x08, 0x3a, 0xc0, 0x58,
+  0x30, 0xee, 0x41, 0x4a, 0x32, 0xee, 0x03, 0x5a, 0x32, 0xee, 0x43, 0x2a,
+  0x03, 0xee, 0x10, 0x0a, 0x06, 0x98, 0x24, 0xee, 0x08, 0x4a, 0x25, 0xee,
+  0x08, 0x5a, 0xc0, 0x58, 0x31, 0xee, 0x00, 0x0a, 0x06, 0xee, 0x10, 0x0a,
+  0x23, 0xee, 0x04, 0x7a, 0x23, 0xee, 0x05, 0x1a, 0x04, 0x33, 0x22, 0xee,
+  0x08, 0x2a, 0x9c, 0x45, 0x66, 0xee, 0x05, 0x0a, 0x24, 0xee, 0x06, 0x3a,
+  0x20, 0xee, 0x08, 0x0a, 0x37, 0xee, 0x20, 0x4a, 0x31, 0xee, 0x43, 0x1a,
+  0x32, 0xee, 0x04, 0x3a, 0x30, 0xee, 0x01, 0x5a, 0x30, 0xee, 0x41, 0x0a,
+  0x13, 0xee, 0x10, 0x8a, 0x34, 0xee, 0x42, 0x1a, 0x15, 0xee, 0x10, 0x0a,
+  0xc1, 0xf8, 0x04, 0x80, 0x10, 0xee, 0x10, 0x8a, 0x08, 0x60, 0x11, 0xee,
+  0x10, 0x0a, 0x44, 0xf8, 0x04, 0x8c, 0x43, 0xf2, 0x04, 0x48, 0x20, 0x60,
+  0x93, 0xd1, 0x02, 0x98, 0x03, 0x99, 0x90, 0xed, 0x01, 0x0a, 0x1f, 0xe7,
+  0x08, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x02, 0x21, 0x48, 0x46, 0x08, 0xb0, 0xbd, 0xec, 0x02, 0x8b, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x09, 0x6c,
+  0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0xb0, 0xb5,
+  0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3,
+  0x8a, 0x00, 0x49, 0xf6, 0xc5, 0x51, 0xc8, 0xf2, 0x1c, 0x11, 0x31, 0xd0,
+  0x03, 0xf5, 0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c, 0xd0, 0xf8, 0xa8, 0xe1,
+  0xc0, 0xf2, 0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x74, 0x45,
+  0x9c, 0xbf, 0x65, 0x1c, 0x75, 0x45, 0x23, 0xd8, 0xa5, 0x1c, 0x75, 0x45,
+  0x9c, 0xbf, 0xe5, 0x1c, 0x75, 0x45, 0x1d, 0xd8, 0x13, 0xf8, 0x01, 0x5c,
+  0x04, 0x3a, 0x04, 0xf1, 0x04, 0x04, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8,
+  0x04, 0x5b, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8,
+  0x03, 0x5c, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8,
+  0x02, 0x5c, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb,
+  0x0c, 0xf1, 0xd8, 0xd1, 0x08, 0x46, 0xb0, 0xbd, 0x02, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0xb0, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6c, 0x9a, 0x1a,
+  0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x4a, 0x00, 0x01, 0x23, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2,
+  0x00, 0x02, 0x92, 0x6c, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x4f, 0x83, 0xb0, 0x82, 0x68, 0x84, 0x46, 0x4f, 0xf4, 0x50, 0x50,
+  0xd2, 0xf8, 0x78, 0x71, 0x3b, 0x58, 0x00, 0x2b, 0x75, 0xd0, 0x8e, 0x46,
+  0x01, 0x29, 0x72, 0xdb, 0x45, 0xf2, 0x04, 0x40, 0xd2, 0xf8, 0xb0, 0x61,
+  0x4f, 0xf0, 0x00, 0x08, 0x43, 0xf2, 0x04, 0x49, 0x45, 0xf2, 0x04, 0x4a,
+  0x45, 0xf2, 0x06, 0x4b, 0x02, 0x92, 0x38, 0x44, 0x01, 0x90, 0x07, 0xf5,
+  0x50, 0x52, 0x00, 0x92, 0x01, 0x2b, 0x45, 0xdb, 0x00, 0x20, 0x00, 0x21,
+  0x0a, 0xeb, 0x80, 0x02, 0xb2, 0x42, 0x9c, 0xbf, 0x09, 0xeb, 0x81, 0x05,
+  0xb5, 0x42, 0x57, 0xd8, 0x84, 0x00, 0xba, 0x5a, 0x5c, 0x44, 0x7a, 0x53,
+  0xb4, 0x42, 0x9f, 0xbf, 0x8a, 0x00, 0x43, 0xf2, 0x06, 0x45, 0x2a, 0x44,
+  0xb2, 0x42, 0x4b, 0xd8, 0x3d, 0x5b, 0xbd, 0x52, 0x1a, 0x46, 0x11, 0xea,
+  0x62, 0x0f, 0x18, 0xd0, 0x81, 0xea, 0x62, 0x01, 0x11, 0xea, 0xa2, 0x0f,
+  0x19, 0xd0, 0x81, 0xea, 0xa2, 0x01, 0x11, 0xea, 0xe2, 0x0f, 0x1a, 0xd0,
+  0x81, 0xea, 0xe2, 0x05, 0x14, 0x11, 0x15, 0xea, 0x22, 0x1f, 0x85, 0xea,
+  0x22, 0x11, 0x22, 0x46, 0xe9, 0xd1, 0x29, 0x46, 0x01, 0x30, 0x21, 0x43,
+  0x98, 0x42, 0xcd, 0xd1, 0x10, 0xe0, 0x54, 0x10, 0x01, 0x30, 0x21, 0x43,
+  0x98, 0x42, 0xc7, 0xd1, 0x0a, 0xe0, 0x94, 0x10, 0x01, 0x30, 0x21, 0x43,
+  0x98, 0x42, 0xc1, 0xd1, 0x04, 0xe0, 0xd4, 0x10, 0x01, 0x30, 0x21, 0x43,
+  0x98, 0x42, 0xbb, 0xd1, 0x01, 0x22, 0x60, 0x46, 0x19, 0x46, 0x64, 0x46,
+  0x75, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0x98, 0x00, 0x9a, 0x90, 0xf8,
+  0x68, 0x00, 0x60, 0xb9, 0x08, 0xf1, 0x01, 0x08, 0x01, 0x99, 0xae, 0x46,
+  0x90, 0x88, 0xa8, 0x45, 0x08, 0x80, 0x04, 0xd0, 0xa4, 0x46, 0x13, 0x68,
+  0x01, 0x2b, 0xa1, 0xda, 0xe6, 0xe7, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x02, 0x21, 0x02, 0x98, 0x03, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+  0x00, 0x03, 0xd3, 0xf8, 0x4c, 0xc0, 0x01, 0xab, 0xb3, 0xeb, 0x0c, 0x0c,
+  0x03, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x1b, 0x69, 0x9c, 0x45, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x8c, 0xb0,
+  0x02, 0x29, 0x02, 0xda, 0x0c, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0xd0, 0xf8,
+  0x78, 0xc1, 0x57, 0x00, 0xd0, 0xf8, 0xb0, 0x31, 0x02, 0x26, 0x00, 0x2e,
+  0x00, 0xf0, 0x91, 0x80, 0x40, 0xf3, 0x82, 0x80, 0x07, 0x90, 0x72, 0x08,
+  0x91, 0xfb, 0xf6, 0xf0, 0x01, 0x24, 0x01, 0x2a, 0x4f, 0xea, 0x46, 0x02,
+  0x07, 0xfb, 0x00, 0xf0, 0x88, 0xbf, 0x74, 0x08, 0xb5, 0x00, 0x43, 0xf2,
+  0x06, 0x4a, 0xcd, 0xe9, 0x00, 0x75, 0x00, 0x27, 0x08, 0x90, 0x0c, 0xeb,
+  0x46, 0x00, 0x0a, 0x90, 0x04, 0x91, 0x09, 0x92, 0xcd, 0xe9, 0x02, 0x46,
+  0x48, 0xf6, 0x10, 0x45, 0x06, 0x97, 0xcd, 0xf8, 0x14, 0xa0, 0x02, 0xeb,
+  0x0a, 0x00, 0x02, 0x38, 0x40, 0xf0, 0x02, 0x09, 0x99, 0x45, 0x9c, 0xbf,
+  0x9d, 0x42, 0x98, 0x42, 0x5e, 0xd8, 0x05, 0xf5, 0x80, 0x60, 0x98, 0x42,
+  0x98, 0xbf, 0x9a, 0x45, 0x58, 0xd8, 0x0b, 0x94, 0x3c, 0xf9, 0x09, 0x10,
+  0x0a, 0x98, 0x0c, 0xeb, 0x05, 0x06, 0x00, 0xeb, 0x0a, 0x08, 0x3c, 0xf9,
+  0x05, 0x00, 0x4f, 0x10, 0xb6, 0xf9, 0x00, 0x14, 0x38, 0xf9, 0x02, 0x4c,
+  0x00, 0xfb, 0x07, 0xf2, 0xaa, 0xf1, 0x02, 0x0b, 0x66, 0x10, 0x3c, 0xf9,
+  0x0a, 0x40, 0x11, 0xfb, 0x06, 0x22, 0x9b, 0x45, 0x4f, 0xea, 0xe2, 0x3e,
+  0x0e, 0xeb, 0x64, 0x02, 0x02, 0xf3, 0x0f, 0x02, 0x2c, 0xf8, 0x0a, 0x20,
+  0x36, 0xd8, 0x0c, 0xeb, 0x0a, 0x02, 0x70, 0x43, 0x01, 0xfb, 0x17, 0x00,
+  0x67, 0x10, 0x32, 0xf9, 0x02, 0x1c, 0xa7, 0xeb, 0x0e, 0x07, 0xc0, 0x13,
+  0x0b, 0x9c, 0x07, 0xf3, 0x0f, 0x07, 0x01, 0x3c, 0x00, 0xeb, 0x61, 0x06,
+  0x0a, 0xf1, 0x04, 0x0a, 0xc0, 0xeb, 0x61, 0x00, 0x06, 0xf3, 0x0f, 0x06,
+  0x00, 0xf3, 0x0f, 0x00, 0x22, 0xf8, 0x02, 0x6c, 0x2c, 0xf8, 0x09, 0x70,
+  0x09, 0x9a, 0x28, 0xf8, 0x02, 0x0c, 0x08, 0x98, 0x05, 0x44, 0xaa, 0xd1,
+  0x03, 0x9e, 0x06, 0x9f, 0x37, 0x44, 0x04, 0x99, 0x01, 0x98, 0x8f, 0x42,
+  0xdd, 0xf8, 0x14, 0xa0, 0x02, 0x9c, 0x82, 0x44, 0x9a, 0xdb, 0x07, 0x98,
+  0x00, 0x9f, 0x00, 0xe0, 0x72, 0x00, 0x8a, 0x42, 0x16, 0x46, 0x7f, 0xf7,
+  0x74, 0xaf, 0x69, 0xe7, 0x02, 0x21, 0x07, 0x98, 0x0c, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x04, 0x21, 0x0c, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x09, 0x6d, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0xb0, 0xb5, 0xd0, 0xf8,
+  0x78, 0x31, 0x4f, 0xf4, 0x50, 0x51, 0x59, 0x58, 0xe1, 0xb3, 0x8a, 0x00,
+  0x49, 0xf6, 0xc5, 0x51, 0xc8, 0xf2, 0x1c, 0x11, 0x31, 0xd0, 0x03, 0xf5,
+  0x50, 0x53, 0x40, 0xf2, 0x93, 0x1c, 0xd0, 0xf8, 0xa8, 0xe1, 0xc0, 0xf2,
+  0x00, 0x1c, 0x05, 0x33, 0x43, 0xf2, 0x04, 0x44, 0x74, 0x45, 0x9c, 0xbf,
+  0x65, 0x1c, 0x75, 0x45, 0x23, 0xd8, 0xa5, 0x1c, 0x75, 0x45, 0x9c, 0xbf,
+  0xe5, 0x1c, 0x75, 0x45, 0x1d, 0xd8, 0x13, 0xf8, 0x01, 0x5c, 0x04, 0x3a,
+  0x04, 0xf1, 0x04, 0x04, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x04, 0x5b,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x03, 0x5c,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x13, 0xf8, 0x02, 0x5c,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1,
+  0xd8, 0xd1, 0x08, 0x46, 0xb0, 0xbd, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x00, 0x20, 0xb0, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6d, 0x9a, 0x1a, 0x06, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x01, 0x23, 0x0a, 0x46, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6d, 0x9a, 0x1a, 0x06, 0xd3, 0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x8f, 0xb0, 0x83, 0x68, 0x0a, 0x90, 0x4f, 0xf4, 0x50, 0x50, 0xd3, 0xf8,
+  0x78, 0x61, 0x34, 0x58, 0x00, 0x2c, 0x00, 0xf0, 0x10, 0x81, 0x01, 0x29,
+  0xc0, 0xf2, 0x0d, 0x81, 0x45, 0xf2, 0x04, 0x40, 0xd3, 0xf8, 0xb0, 0x91,
+  0x30, 0x44, 0x03, 0x90, 0x06, 0xf5, 0x50, 0x50, 0x04, 0x90, 0xb0, 0x1c,
+  0x43, 0xf2, 0x04, 0x4a, 0x45, 0xf2, 0x04, 0x4b, 0x43, 0xf2, 0x06, 0x47,
+  0x45, 0xf2, 0x06, 0x4c, 0x02, 0x90, 0x00, 0x20, 0x06, 0x90, 0x09, 0x93,
+  0x05, 0x91, 0x04, 0xeb, 0xd4, 0x71, 0x02, 0x2c, 0x4f, 0xea, 0x61, 0x01,
+  0x27, 0xda, 0x02, 0x22, 0x0a, 0x98, 0xff, 0xf7, 0xfe, 0xff, 0x09, 0x9b,
+  0x45, 0xf2, 0x06, 0x4c, 0x05, 0x99, 0x93, 0xf8, 0x68, 0x00, 0x00, 0x28,
+  0x40, 0xf0, 0xe3, 0x80, 0x04, 0x9d, 0xb5, 0xf9, 0x06, 0x00, 0x2c, 0x68,
+  0xb5, 0xf9, 0x04, 0x70, 0x04, 0x2c, 0xa7, 0xeb, 0x00, 0x02, 0x38, 0x44,
+  0x20, 0xf3, 0x4f, 0x00, 0x22, 0xf3, 0x4f, 0x02, 0xa8, 0x80, 0xea, 0x80,
+  0x50, 0xda, 0x06, 0x9a, 0x43, 0xf2, 0x06, 0x47, 0x01, 0x32, 0x06, 0x92,
+  0x8a, 0x42, 0x03, 0x9a, 0x10, 0x80, 0xd2, 0xd1, 0xc7, 0xe0, 0x00, 0x20,
+  0x00, 0x22, 0x0b, 0xeb, 0x80, 0x03, 0x4b, 0x45, 0x9c, 0xbf, 0x0a, 0xeb,
+  0x82, 0x04, 0x4c, 0x45, 0x00, 0xf2, 0xc0, 0x80, 0x85, 0x00, 0xf3, 0x5a,
+  0x65, 0x44, 0x33, 0x53, 0x4d, 0x45, 0x9e, 0xbf, 0x93, 0x00, 0x3b, 0x44,
+  0x4b, 0x45, 0x00, 0xf2, 0xb5, 0x80, 0x75, 0x5b, 0xf5, 0x52, 0x0b, 0x46,
+  0x12, 0xea, 0x63, 0x0f, 0x18, 0xd0, 0x82, 0xea, 0x63, 0x02, 0x12, 0xea,
+  0xa3, 0x0f, 0x19, 0xd0, 0x82, 0xea, 0xa3, 0x02, 0x12, 0xea, 0xe3, 0x0f,
+  0x1a, 0xd0, 0x82, 0xea, 0xe3, 0x04, 0x1d, 0x11, 0x14, 0xea, 0x23, 0x1f,
+  0x84, 0xea, 0x23, 0x12, 0x2b, 0x46, 0xe9, 0xd1, 0x22, 0x46, 0x01, 0x30,
+  0x2a, 0x43, 0x88, 0x42, 0xcd, 0xd1, 0xa2, 0xe7, 0x5d, 0x10, 0x01, 0x30,
+  0x2a, 0x43, 0x88, 0x42, 0xc7, 0xd1, 0x9c, 0xe7, 0x9d, 0x10, 0x01, 0x30,
+  0x2a, 0x43, 0x88, 0x42, 0xc1, 0xd1, 0x96, 0xe7, 0xdd, 0x10, 0x01, 0x30,
+  0x2a, 0x43, 0x88, 0x42, 0xbb, 0xd1, 0x90, 0xe7, 0xa1, 0x08, 0x4f, 0xf4,
+  0x50, 0x50, 0x01, 0x29, 0x4f, 0xf0, 0x01, 0x01, 0x88, 0xbf, 0xa1, 0x08,
+  0x01, 0x94, 0x00, 0xeb, 0x44, 0x02, 0x22, 0xf0, 0x02, 0x03, 0x02, 0x98,
+  0x00, 0x22, 0x18, 0x44, 0x48, 0xf6, 0x12, 0x48, 0x43, 0xf2, 0x08, 0x45,
+  0x0b, 0x93, 0x0d, 0x90, 0xa2, 0xeb, 0x81, 0x00, 0x07, 0x90, 0x0e, 0x96,
+  0xcd, 0xf8, 0x20, 0x90, 0x0b, 0x98, 0x81, 0x18, 0x88, 0x1c, 0x48, 0x45,
+  0x62, 0xd8, 0xa8, 0x1c, 0x48, 0x45, 0x9c, 0xbf, 0x08, 0xf5, 0x80, 0x60,
+  0x48, 0x45, 0x5b, 0xd8, 0x49, 0x45, 0x98, 0xbf, 0x4d, 0x45, 0x57, 0xd8,
+  0x71, 0x19, 0x0d, 0x9b, 0x9f, 0x18, 0x0c, 0x97, 0x98, 0x5e, 0xb1, 0xf9,
+  0x02, 0xa0, 0x06, 0xeb, 0x08, 0x0c, 0x37, 0xf9, 0x02, 0xec, 0x36, 0xf9,
+  0x05, 0xb0, 0x0e, 0x9c, 0x0a, 0xeb, 0x00, 0x09, 0xbc, 0xf9, 0x00, 0x64,
+  0x4f, 0xea, 0xa9, 0x03, 0xae, 0xeb, 0x0b, 0x0c, 0x34, 0xf9, 0x08, 0x70,
+  0x03, 0xfb, 0x06, 0xf9, 0x4f, 0xea, 0xac, 0x04, 0x08, 0xf1, 0x02, 0x08,
+  0x14, 0xfb, 0x07, 0x9c, 0xaa, 0xeb, 0x00, 0x09, 0x7b, 0x43, 0x43, 0xf2,
+  0x04, 0x4a, 0x4f, 0xea, 0xec, 0x30, 0x04, 0xfb, 0x16, 0x33, 0x00, 0xeb,
+  0xa9, 0x07, 0x0b, 0xeb, 0x0e, 0x06, 0xdc, 0x13, 0x45, 0xf2, 0x06, 0x4c,
+  0x07, 0xf3, 0x0f, 0x07, 0x45, 0xf2, 0x04, 0x4b, 0xa0, 0xeb, 0xa9, 0x00,
+  0x4f, 0x80, 0x04, 0xeb, 0xa6, 0x04, 0xdd, 0xf8, 0x20, 0x90, 0xb1, 0x10,
+  0x0e, 0x9e, 0xa1, 0xeb, 0xe3, 0x31, 0x0d, 0x9b, 0x04, 0xf3, 0x0f, 0x07,
+  0x00, 0xf3, 0x0f, 0x00, 0x77, 0x53, 0x98, 0x52, 0x04, 0x3a, 0x01, 0xf3,
+  0x0f, 0x00, 0x0c, 0x99, 0x04, 0x35, 0x21, 0xf8, 0x02, 0x0c, 0x07, 0x98,
+  0x90, 0x42, 0x9f, 0xd1, 0x04, 0x98, 0x05, 0x99, 0x01, 0x9c, 0x80, 0x88,
+  0x2d, 0xe7, 0x0f, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x09, 0x98,
+  0x0f, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01,
+  0xc9, 0x6d, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x41, 0x80, 0x46, 0xd0, 0xf8, 0x78, 0xc1, 0x4f, 0xf4,
+  0x50, 0x50, 0x5c, 0xf8, 0x00, 0x30, 0x00, 0x2b, 0x52, 0xd0, 0x49, 0xf6,
+  0xc5, 0x50, 0x5f, 0x00, 0xc8, 0xf2, 0x1c, 0x10, 0x4d, 0xd0, 0x39, 0x1f,
+  0x11, 0xf1, 0x04, 0x0f, 0xd8, 0xf8, 0xa8, 0x11, 0x37, 0xd8, 0x0c, 0xf5,
+  0x50, 0x55, 0x40, 0xf2, 0x93, 0x14, 0x27, 0xf0, 0x03, 0x0e, 0xc0, 0xf2,
+  0x00, 0x14, 0x05, 0x35, 0x43, 0xf2, 0x04, 0x46, 0x77, 0x46, 0x8e, 0x42,
+  0x9c, 0xbf, 0x72, 0x1c, 0x8a, 0x42, 0x31, 0xd8, 0xb2, 0x1c, 0x8a, 0x42,
+  0x9c, 0xbf, 0xf2, 0x1c, 0x8a, 0x42, 0x2b, 0xd8, 0x15, 0xf8, 0x01, 0x2c,
+  0x04, 0x3f, 0x06, 0xf1, 0x04, 0x06, 0x80, 0xea, 0x02, 0x00, 0x15, 0xf8,
+  0x04, 0x2b, 0x04, 0xfb, 0x00, 0xf0, 0x80, 0xea, 0x02, 0x00, 0x15, 0xf8,
+  0x03, 0x2c, 0x04, 0xfb, 0x00, 0xf0, 0x80, 0xea, 0x02, 0x00, 0x15, 0xf8,
+  0x02, 0x2c, 0x04, 0xfb, 0x00, 0xf0, 0x80, 0xea, 0x02, 0x00, 0x04, 0xfb,
+  0x00, 0xf0, 0xd8, 0xd1, 0x43, 0xf2, 0x04, 0x42, 0x0e, 0xeb, 0x02, 0x07,
+  0x01, 0xe0, 0x43, 0xf2, 0x04, 0x47, 0xda, 0x07, 0x08, 0xbf, 0xbd, 0xe8,
+  0xf0, 0x81, 0x8f, 0x42, 0x02, 0xd8, 0x7b, 0x1c, 0x8b, 0x42, 0x06, 0xd9,
+  0x02, 0x21, 0x40, 0x46, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8,
+  0xf0, 0x81, 0x1c, 0xf8, 0x07, 0x10, 0x1c, 0xf8, 0x03, 0x20, 0x48, 0x40,
+  0x40, 0xf2, 0x93, 0x11, 0xc0, 0xf2, 0x00, 0x11, 0x48, 0x43, 0x50, 0x40,
+  0x48, 0x43, 0xbd, 0xe8, 0xf0, 0x81, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xfe, 0x02, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x38, 0x11, 0x00, 0x00,
+  0x58, 0x15, 0x00, 0x00, 0x16, 0x16, 0x00, 0x00, 0x4c, 0x16, 0x00, 0x00,
+  0xaa, 0x17, 0x00, 0x00, 0xea, 0x1b, 0x00, 0x00, 0xa8, 0x1c, 0x00, 0x00,
+  0xde, 0x1c, 0x00, 0x00, 0x3e, 0x1e, 0x00, 0x00, 0x5e, 0x21, 0x00, 0x00,
+  0x1c, 0x22, 0x00, 0x00, 0x52, 0x22, 0x00, 0x00, 0x14, 0x25, 0x00, 0x00,
+  0xd2, 0x25, 0x00, 0x00, 0x08, 0x26, 0x00, 0x00, 0x4e, 0x27, 0x00, 0x00,
+  0xd2, 0x28, 0x00, 0x00, 0x90, 0x29, 0x00, 0x00, 0xc6, 0x29, 0x00, 0x00,
+  0x42, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x72, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x62,
+  0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x73, 0x75, 0x6d, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x73, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x66, 0x66, 0x74, 0x5f,
+  0x73, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e,
+  0x63, 0x68, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x72, 0x66, 0x66, 0x74, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35,
+  0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x0a, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00,
+  0x11, 0x00, 0x2e, 0x61, 0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x61, 0x6f,
+  0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x69, 0x64, 0x00,
+  0x0b, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x23, 0x33,
+  0x00, 0x00, 0x0c, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f,
+  0x69, 0x32, 0x64, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
+  0x69, 0x5f, 0x64, 0x6d, 0x75, 0x6c, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f,
+  0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x64, 0x69, 0x76, 0x00, 0x00,
+  0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x61,
+  0x64, 0x64, 0x00, 0x00, 0x0c, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62,
+  0x69, 0x5f, 0x64, 0x32, 0x66, 0x00, 0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65,
+  0x61, 0x62, 0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70, 0x67, 0x65, 0x00, 0x00,
+  0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x63,
+  0x6d, 0x70, 0x6c, 0x74, 0x00, 0x00, 0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65,
+  0x61, 0x62, 0x69, 0x5f, 0x64, 0x63, 0x6d, 0x70, 0x75, 0x6e, 0x00, 0x00,
+  0x0f, 0x00, 0x5f, 0x5f, 0x61, 0x65, 0x61, 0x62, 0x69, 0x5f, 0x64, 0x63,
+  0x6d, 0x70, 0x6c, 0x65, 0x00, 0x00, 0x0d, 0x00, 0x5f, 0x5f, 0x61, 0x65,
+  0x61, 0x62, 0x69, 0x5f, 0x64, 0x32, 0x69, 0x7a, 0x00, 0x00, 0x0b, 0x00,
+  0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x23, 0x38, 0x00, 0x00,
+  0x0c, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x23, 0x31,
+  0x32, 0x00, 0x0c, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63,
+  0x23, 0x31, 0x39, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x64, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00,
+  0x3c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x76, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x86, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9a, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xd2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xfe, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x2a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x3a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4e, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x56, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x66, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7a, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x82, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x92, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa6, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xae, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xd2, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xda, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x12, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x32, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x42, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x56, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x5e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x82, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x8a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x9a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xae, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xc6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xda, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xe2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2a, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x52, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x5a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x6a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x92, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa2, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xaa, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xb6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00,
+  0xcc, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xd4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf6, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
+  0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x16, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2a, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x36, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x46, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5a, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x62, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x72, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x86, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x8e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x9e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb2, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xba, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xca, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xde, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xe6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xf6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x22, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x36, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x4e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x6a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x8e, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x96, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xa2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb6, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xd2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe6, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xee, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xfe, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x1a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3e, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x46, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x56, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6a, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x72, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x82, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x9a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xaa, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xba, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xc2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xd2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe2, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xea, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x22, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x32, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x46, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x76, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x86, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xae, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0xe0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xfc, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x52, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x74, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x98, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xac, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xbe, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd4, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xe6, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xf4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xfc, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x42, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x42, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5c, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x62, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1a, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x50, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x56, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x72, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x60, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa6, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xae, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd6, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe2, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xee, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xa0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xac, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb2, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xce, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xda, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xe2, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xf4, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x42, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9e, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xae, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x6c, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x62, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x68, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x86, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x4e, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x56, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x78, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x10, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xca, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd6, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xdc, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf8, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x12, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x52, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x56, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xce, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfa, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x88, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x94, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb6, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xca, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x52, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x3e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
 };
-unsigned int fft_bench_aot_len = 5772;
+unsigned int fft_bench_aot_len = 21372;
@@ -0,0 +1,1225 @@
+unsigned char kernels_bench_aot[] = {
+  0x00, 0x61, 0x6f, 0x74, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x68, 0x75, 0x6d, 0x62, 0x76, 0x37, 0x65, 0x6d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+  0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+  0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+  0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+  0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+  0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+  0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+  0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+  0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+  0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+  0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+  0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+  0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+  0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+  0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+  0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+  0xb0, 0x54, 0xbb, 0x16, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x2e, 0x61,
+  0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x34, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x70, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2,
+  0x00, 0x01, 0x09, 0x68, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0xf0, 0xb5, 0xd0, 0xf8, 0x78, 0x21, 0x4a, 0xf2, 0xa6, 0x57, 0x4f, 0xf2,
+  0xf1, 0x0e, 0x02, 0xf5, 0x88, 0x53, 0x4f, 0xf2, 0xf1, 0x05, 0xc0, 0xf2,
+  0x25, 0x07, 0xc3, 0xf6, 0x70, 0x4e, 0xc3, 0xf6, 0x70, 0x35, 0x77, 0x44,
+  0xd0, 0xf8, 0xb8, 0x11, 0xdf, 0x66, 0x05, 0xf1, 0x80, 0x77, 0x1f, 0x67,
+  0x4f, 0xf4, 0x88, 0x57, 0xdd, 0x67, 0x4b, 0xf2, 0xb5, 0x44, 0xd5, 0x51,
+  0x49, 0xf2, 0x97, 0x65, 0xc3, 0xf6, 0x16, 0x55, 0x9d, 0x65, 0x5d, 0x62,
+  0x4a, 0xf2, 0xa6, 0x55, 0xc3, 0xf6, 0x25, 0x55, 0x5d, 0x65, 0x9d, 0x62,
+  0x4b, 0xf2, 0xb5, 0x45, 0x49, 0xf2, 0x97, 0x67, 0xc3, 0xf6, 0x34, 0x55,
+  0xc3, 0xf6, 0x96, 0x47, 0x1d, 0x65, 0xdd, 0x62, 0x4c, 0xf2, 0xc4, 0x35,
+  0x1f, 0x61, 0x4b, 0xf2, 0xb5, 0x47, 0xc3, 0xf6, 0x43, 0x55, 0xc3, 0xf6,
+  0xb4, 0x47, 0xdd, 0x64, 0xc3, 0xf6, 0x34, 0x44, 0x1d, 0x63, 0x4d, 0xf2,
+  0xd3, 0x25, 0x5f, 0x61, 0x4d, 0xf2, 0xd3, 0x27, 0xc3, 0xf6, 0x52, 0x55,
+  0xc3, 0xf6, 0xd2, 0x47, 0x04, 0xf5, 0x00, 0x06, 0x9d, 0x64, 0x5d, 0x63,
+  0x4e, 0xf2, 0xe2, 0x15, 0x5f, 0x66, 0x4f, 0xf2, 0xf1, 0x0c, 0x9f, 0x61,
+  0x4f, 0xf2, 0xf1, 0x07, 0x9e, 0x66, 0x4c, 0xf2, 0xc4, 0x36, 0xc3, 0xf6,
+  0x61, 0x55, 0xc3, 0xf6, 0xf0, 0x47, 0xc3, 0xf6, 0xf0, 0x3c, 0xc0, 0xf2,
+  0x43, 0x06, 0x5d, 0x64, 0xb1, 0xf5, 0x8c, 0x5f, 0x9d, 0x63, 0x4f, 0xf2,
+  0xf1, 0x05, 0x1f, 0x66, 0x66, 0x44, 0xdf, 0x61, 0x48, 0xf2, 0x88, 0x77,
+  0x5e, 0x67, 0xc3, 0xf6, 0x70, 0x55, 0xc3, 0xe9, 0x0f, 0x55, 0xc3, 0xf8,
+  0x78, 0xc0, 0xc3, 0xf6, 0x07, 0x57, 0xc3, 0xe9, 0x01, 0xc4, 0xc3, 0xf8,
+  0x0c, 0xe0, 0xdf, 0x65, 0x1f, 0x62, 0x3f, 0xd3, 0xbf, 0xee, 0x00, 0x0a,
+  0x4f, 0xf2, 0x5f, 0x3e, 0x46, 0xf2, 0x0d, 0x64, 0x45, 0xf6, 0x6c, 0x13,
+  0xc3, 0xf6, 0x6e, 0x4e, 0xc0, 0xf2, 0x19, 0x04, 0x02, 0xf5, 0x8c, 0x52,
+  0xc3, 0xf6, 0x88, 0x43, 0x9f, 0xed, 0x1a, 0x2a, 0x4f, 0xf4, 0x8c, 0x55,
+  0x41, 0xf2, 0xf8, 0x5c, 0x9f, 0xed, 0x18, 0x1a, 0x12, 0xee, 0x10, 0x6a,
+  0x65, 0x45, 0x16, 0x60, 0x27, 0xd0, 0x2e, 0x1d, 0x8e, 0x42, 0x1f, 0xd8,
+  0x03, 0xfb, 0x04, 0xe3, 0x08, 0x35, 0x8d, 0x42, 0x4f, 0xea, 0x13, 0x26,
+  0x03, 0xfb, 0x04, 0xe3, 0x02, 0xee, 0x10, 0x6a, 0x4f, 0xea, 0x13, 0x26,
+  0x03, 0xee, 0x10, 0x6a, 0xb8, 0xee, 0xc2, 0x2a, 0xb8, 0xee, 0xc3, 0x3a,
+  0x22, 0xee, 0x01, 0x2a, 0x23, 0xee, 0x01, 0x3a, 0x32, 0xee, 0x00, 0x2a,
+  0x12, 0xee, 0x10, 0x6a, 0x33, 0xee, 0x00, 0x2a, 0x56, 0x60, 0x02, 0xf1,
+  0x08, 0x02, 0xd7, 0xd9, 0x02, 0x21, 0xbd, 0xe8, 0xf0, 0x40, 0xff, 0xf7,
+  0xfe, 0xbf, 0xf0, 0xbd, 0x4e, 0xef, 0x06, 0xbf, 0x00, 0x00, 0x00, 0x34,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2,
+  0x00, 0x02, 0x52, 0x68, 0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0x2d, 0xed, 0x10, 0x8b, 0x8a, 0xb0,
+  0x01, 0x29, 0xc0, 0xf2, 0xbf, 0x82, 0xd0, 0xf8, 0x78, 0x21, 0x09, 0x92,
+  0x02, 0xf5, 0x88, 0x54, 0xd0, 0xf8, 0xb8, 0x31, 0x04, 0xf6, 0xfc, 0x07,
+  0x41, 0xf2, 0x84, 0x19, 0x94, 0xed, 0x18, 0x0a, 0x8d, 0xed, 0x08, 0x0a,
+  0x94, 0xed, 0x19, 0x0a, 0x8d, 0xed, 0x07, 0x0a, 0x94, 0xed, 0x1a, 0x0a,
+  0x8d, 0xed, 0x06, 0x0a, 0x94, 0xed, 0x1b, 0x0a, 0x8d, 0xed, 0x05, 0x0a,
+  0x03, 0x97, 0x00, 0x27, 0x94, 0xed, 0x1c, 0x4a, 0x94, 0xed, 0x1d, 0x5a,
+  0x94, 0xed, 0x1e, 0x6a, 0x94, 0xed, 0x1f, 0x7a, 0xd4, 0xed, 0x10, 0x0a,
+  0xd4, 0xed, 0x11, 0x1a, 0xd4, 0xed, 0x12, 0x2a, 0xd4, 0xed, 0x13, 0x3a,
+  0xd4, 0xed, 0x14, 0x4a, 0xd4, 0xed, 0x15, 0x5a, 0x04, 0x97, 0x41, 0xf2,
+  0x88, 0x1e, 0x41, 0xf2, 0x8c, 0x1a, 0x41, 0xf2, 0x90, 0x15, 0x41, 0xf2,
+  0x94, 0x12, 0x41, 0xf2, 0x98, 0x16, 0x41, 0xf2, 0x9c, 0x17, 0x41, 0xf2,
+  0xa4, 0x1b, 0xd4, 0xed, 0x16, 0x6a, 0xd4, 0xed, 0x17, 0x7a, 0x94, 0xed,
+  0x08, 0x8a, 0x94, 0xed, 0x09, 0x9a, 0x94, 0xed, 0x0a, 0xaa, 0x94, 0xed,
+  0x0b, 0xba, 0x94, 0xed, 0x0c, 0xca, 0x94, 0xed, 0x0d, 0xda, 0x94, 0xed,
+  0x0e, 0xea, 0x94, 0xed, 0x0f, 0xfa, 0xd4, 0xed, 0x00, 0x8a, 0xd4, 0xed,
+  0x01, 0x9a, 0xd4, 0xed, 0x02, 0xaa, 0xd4, 0xed, 0x03, 0xba, 0xd4, 0xed,
+  0x04, 0xca, 0xd4, 0xed, 0x05, 0xda, 0xd4, 0xed, 0x06, 0xea, 0xd4, 0xed,
+  0x07, 0xfa, 0x41, 0xf2, 0xa8, 0x18, 0x9f, 0xed, 0x02, 0x3a, 0x02, 0x91,
+  0x02, 0xe0, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf0, 0x00, 0x0c,
+  0x0c, 0xf5, 0x8c, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0x51, 0x82, 0x0c, 0xeb,
+  0x09, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x0c, 0xeb, 0x0e, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x48, 0x82, 0x0c, 0xeb, 0x0a, 0x04, 0x9c, 0x42, 0x9c, 0xbf,
+  0x0c, 0xeb, 0x05, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x3f, 0x82, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x0c, 0xeb, 0x06, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x36, 0x82, 0x0c, 0xeb, 0x07, 0x04, 0x9c, 0x42, 0x9c, 0xbf,
+  0x0c, 0xf5, 0x8d, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0x2d, 0x82, 0x0c, 0xeb,
+  0x0b, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x0c, 0xeb, 0x08, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x24, 0x82, 0x41, 0xf2, 0xac, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2, 0xb0, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x00, 0xf2, 0x17, 0x82, 0x41, 0xf2, 0xb4, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2, 0xb8, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x0a, 0x82, 0x41, 0xf2, 0xbc, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x0c, 0xf5, 0x8e, 0x54,
+  0x9c, 0x42, 0x00, 0xf2, 0xff, 0x81, 0x41, 0xf2, 0xc4, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2, 0xc8, 0x12, 0x0c, 0xeb,
+  0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xf2, 0x81, 0x41, 0xf2, 0xcc, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2, 0xd0, 0x12,
+  0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xe5, 0x81, 0x41, 0xf2,
+  0xd4, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2,
+  0xd8, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xd8, 0x81,
+  0x41, 0xf2, 0xdc, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9c, 0xbf,
+  0x0c, 0xf5, 0x8f, 0x54, 0x9c, 0x42, 0x00, 0xf2, 0xcd, 0x81, 0x41, 0xf2,
+  0xe4, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf, 0x41, 0xf2,
+  0xe8, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xc0, 0x81,
+  0x41, 0xf2, 0xec, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x9e, 0xbf,
+  0x41, 0xf2, 0xf0, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0xb3, 0x81, 0x41, 0xf2, 0xf4, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42,
+  0x9e, 0xbf, 0x41, 0xf2, 0xf8, 0x12, 0x0c, 0xeb, 0x02, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0xa6, 0x81, 0x41, 0xf2, 0xfc, 0x12, 0x0c, 0xeb, 0x02, 0x04,
+  0x9c, 0x42, 0x9c, 0xbf, 0x0c, 0xf5, 0xb0, 0x54, 0x9c, 0x42, 0x00, 0xf2,
+  0x9b, 0x81, 0x09, 0x9c, 0x41, 0xf2, 0x84, 0x18, 0x04, 0xeb, 0x0c, 0x0b,
+  0x4f, 0xf4, 0x8c, 0x54, 0x41, 0xf2, 0x88, 0x19, 0x41, 0xf2, 0x8c, 0x1e,
+  0x5b, 0xf8, 0x04, 0x40, 0x41, 0xf2, 0x90, 0x1a, 0x00, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x08, 0x40, 0x01, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x09, 0x40,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x0e, 0x40, 0x28, 0xee, 0x80, 0x0a,
+  0x41, 0xf2, 0x94, 0x12, 0x29, 0xee, 0x81, 0x1a, 0x41, 0xf2, 0x98, 0x16,
+  0x41, 0xf2, 0x9c, 0x17, 0x41, 0xf2, 0xa4, 0x15, 0x30, 0xee, 0x03, 0x0a,
+  0x41, 0xf2, 0xa8, 0x18, 0x0c, 0xf1, 0x04, 0x0c, 0x41, 0xf2, 0x84, 0x19,
+  0x41, 0xf2, 0x88, 0x1e, 0xbc, 0xf5, 0x80, 0x6f, 0x30, 0xee, 0x01, 0x0a,
+  0x2a, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x0a, 0x40,
+  0x41, 0xf2, 0x8c, 0x1a, 0x30, 0xee, 0x01, 0x0a, 0x2b, 0xee, 0x82, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xac, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x2c, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x06, 0x40, 0x41, 0xf2, 0x98, 0x16, 0x30, 0xee, 0x01, 0x0a,
+  0x2d, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x07, 0x40,
+  0x41, 0xf2, 0x9c, 0x17, 0x30, 0xee, 0x01, 0x0a, 0x2e, 0xee, 0x82, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x4f, 0xf4, 0x8d, 0x54, 0x5b, 0xf8, 0x04, 0x40,
+  0x30, 0xee, 0x01, 0x0a, 0x2f, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x05, 0x40, 0x41, 0xf2, 0x90, 0x15, 0x30, 0xee, 0x01, 0x0a,
+  0x28, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x08, 0x40,
+  0x30, 0xee, 0x01, 0x0a, 0x29, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xb0, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x2a, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0xb4, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x2b, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xb8, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x2c, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xbc, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x2d, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x4f, 0xf4, 0x8e, 0x52, 0x30, 0xee, 0x01, 0x0a, 0x2e, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xc4, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x2f, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xc8, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x20, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0xcc, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x21, 0xee, 0x82, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xd0, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x22, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xd4, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x23, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0xd8, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x24, 0xee, 0x82, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xdc, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x25, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x4f, 0xf4, 0x8f, 0x52, 0x30, 0xee, 0x01, 0x0a,
+  0x26, 0xee, 0x82, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0xe4, 0x12, 0x30, 0xee, 0x01, 0x0a, 0x27, 0xee, 0x82, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xe8, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x9d, 0xed, 0x08, 0x1a, 0x21, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xec, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x9d, 0xed, 0x07, 0x1a, 0x21, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xf0, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x9d, 0xed, 0x06, 0x1a, 0x21, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xf4, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x9d, 0xed, 0x05, 0x1a, 0x21, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xf8, 0x12,
+  0x30, 0xee, 0x01, 0x0a, 0x24, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a,
+  0x5b, 0xf8, 0x02, 0x40, 0x41, 0xf2, 0xfc, 0x12, 0x30, 0xee, 0x01, 0x0a,
+  0x25, 0xee, 0x02, 0x1a, 0x02, 0xee, 0x10, 0x4a, 0x5b, 0xf8, 0x02, 0x40,
+  0x4f, 0xf4, 0xb0, 0x52, 0x30, 0xee, 0x01, 0x0a, 0x26, 0xee, 0x02, 0x1a,
+  0x02, 0xee, 0x10, 0x4a, 0x30, 0xee, 0x01, 0x0a, 0x27, 0xee, 0x02, 0x1a,
+  0x30, 0xee, 0x01, 0x0a, 0x10, 0xee, 0x10, 0x4a, 0x4b, 0xf8, 0x02, 0x40,
+  0x41, 0xf2, 0x94, 0x12, 0x41, 0xf2, 0xa4, 0x1b, 0x7f, 0xf4, 0xde, 0xad,
+  0x03, 0x9c, 0xb6, 0xee, 0x00, 0x1a, 0xdd, 0xf8, 0x10, 0xb0, 0x09, 0x9a,
+  0x94, 0xed, 0x00, 0x0a, 0x41, 0xf2, 0xfc, 0x1c, 0x20, 0xee, 0x01, 0x0a,
+  0x01, 0x46, 0x5f, 0xfa, 0x8b, 0xf4, 0x0b, 0xf1, 0x01, 0x0b, 0x41, 0xf2,
+  0x90, 0x15, 0x41, 0xf2, 0x98, 0x16, 0x02, 0xeb, 0x84, 0x02, 0x01, 0x92,
+  0x10, 0xee, 0x10, 0x2a, 0x41, 0xf2, 0x9c, 0x17, 0x00, 0x92, 0x41, 0xf2,
+  0x94, 0x12, 0xcd, 0xf8, 0x10, 0xb0, 0xdd, 0xe9, 0x00, 0x84, 0x02, 0x98,
+  0x83, 0x45, 0x41, 0xf2, 0xa4, 0x1b, 0x44, 0xf8, 0x0c, 0x80, 0x41, 0xf2,
+  0xa8, 0x18, 0x08, 0x46, 0x7f, 0xf4, 0xae, 0xad, 0x0a, 0xb0, 0xbd, 0xec,
+  0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x0a, 0xb0,
+  0xbd, 0xec, 0x10, 0x8b, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7,
+  0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa,
+  0xc0, 0xf2, 0x00, 0x01, 0x89, 0x68, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20,
+  0x02, 0xb0, 0x80, 0xbd, 0xf0, 0xb5, 0x81, 0xb0, 0x40, 0xf2, 0x93, 0x12,
+  0x49, 0xf6, 0xc5, 0x5e, 0xc0, 0xf2, 0x00, 0x12, 0xd0, 0xf8, 0x78, 0xc1,
+  0xd0, 0xf8, 0xb8, 0x71, 0xc8, 0xf2, 0x1c, 0x1e, 0x4f, 0xf4, 0xb0, 0x51,
+  0xb9, 0x42, 0x9c, 0xbf, 0x0b, 0x1d, 0xbb, 0x42, 0x00, 0xf2, 0xcf, 0x80,
+  0x01, 0xf1, 0x08, 0x03, 0xbb, 0x42, 0x9c, 0xbf, 0x01, 0xf1, 0x0c, 0x03,
+  0xbb, 0x42, 0x00, 0xf2, 0xc6, 0x80, 0x01, 0xf1, 0x10, 0x03, 0xbb, 0x42,
+  0x9c, 0xbf, 0x01, 0xf1, 0x14, 0x03, 0xbb, 0x42, 0x00, 0xf2, 0xbd, 0x80,
+  0x01, 0xf1, 0x18, 0x03, 0xbb, 0x42, 0x9c, 0xbf, 0x01, 0xf1, 0x1c, 0x03,
+  0xbb, 0x42, 0x00, 0xf2, 0xb4, 0x80, 0x5c, 0xf8, 0x01, 0x50, 0xeb, 0xb2,
+  0x83, 0xea, 0x0e, 0x03, 0x53, 0x43, 0xc5, 0xf3, 0x07, 0x24, 0x63, 0x40,
+  0x53, 0x43, 0xc5, 0xf3, 0x07, 0x44, 0x63, 0x40, 0x03, 0xfb, 0x02, 0xf4,
+  0x0c, 0xeb, 0x01, 0x03, 0x20, 0x31, 0x84, 0xea, 0x15, 0x65, 0x5c, 0x68,
+  0x55, 0x43, 0xb1, 0xf5, 0xd0, 0x5f, 0xe6, 0xb2, 0x86, 0xea, 0x05, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc4, 0xf3, 0x07, 0x25, 0x86, 0xea, 0x05, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc4, 0xf3, 0x07, 0x45, 0x86, 0xea, 0x05, 0x06,
+  0x9d, 0x68, 0x02, 0xfb, 0x06, 0xf6, 0x86, 0xea, 0x14, 0x66, 0x02, 0xfb,
+  0x06, 0xf6, 0xec, 0xb2, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0xc5, 0xf3, 0x07, 0x24, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0xc5, 0xf3, 0x07, 0x44, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0x86, 0xea, 0x15, 0x66, 0xdd, 0x68, 0x02, 0xfb, 0x06, 0xf6, 0xec, 0xb2,
+  0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3, 0x07, 0x24,
+  0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3, 0x07, 0x44,
+  0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0x86, 0xea, 0x15, 0x66,
+  0x1d, 0x69, 0x02, 0xfb, 0x06, 0xf6, 0xec, 0xb2, 0x86, 0xea, 0x04, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3, 0x07, 0x24, 0x86, 0xea, 0x04, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3, 0x07, 0x44, 0x86, 0xea, 0x04, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0x86, 0xea, 0x15, 0x66, 0x5d, 0x69, 0x02, 0xfb,
+  0x06, 0xf6, 0xec, 0xb2, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0xc5, 0xf3, 0x07, 0x24, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0xc5, 0xf3, 0x07, 0x44, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6,
+  0x86, 0xea, 0x15, 0x66, 0x9d, 0x69, 0x02, 0xfb, 0x06, 0xf6, 0xdb, 0x69,
+  0xec, 0xb2, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3,
+  0x07, 0x24, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0xc5, 0xf3,
+  0x07, 0x44, 0x86, 0xea, 0x04, 0x06, 0x02, 0xfb, 0x06, 0xf6, 0x86, 0xea,
+  0x15, 0x66, 0x02, 0xfb, 0x06, 0xf6, 0xdd, 0xb2, 0x86, 0xea, 0x05, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc3, 0xf3, 0x07, 0x25, 0x86, 0xea, 0x05, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0xc3, 0xf3, 0x07, 0x45, 0x86, 0xea, 0x05, 0x06,
+  0x02, 0xfb, 0x06, 0xf6, 0x86, 0xea, 0x13, 0x63, 0x03, 0xfb, 0x02, 0xfe,
+  0x7f, 0xf4, 0x2c, 0xaf, 0x04, 0xe0, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x4f, 0xf0, 0x00, 0x0e, 0x70, 0x46, 0x01, 0xb0, 0xf0, 0xbd, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01,
+  0xc9, 0x68, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x00, 0xbf,
+  0x70, 0xb5, 0xd0, 0xf8, 0x78, 0x21, 0x4f, 0xf4, 0xd0, 0x54, 0x02, 0xf5,
+  0xd0, 0x53, 0xbf, 0xee, 0x00, 0x0a, 0x4f, 0xf2, 0x5f, 0x3c, 0x46, 0xf2,
+  0x0d, 0x6e, 0xd0, 0xf8, 0xb8, 0x11, 0x00, 0x25, 0x1d, 0x61, 0xc3, 0xf6,
+  0x6e, 0x4c, 0x15, 0x51, 0xc0, 0xf2, 0x19, 0x0e, 0x9d, 0x61, 0x02, 0xf5,
+  0xd3, 0x52, 0x1d, 0x62, 0x02, 0x24, 0x1d, 0x63, 0x9f, 0xed, 0x1a, 0x1a,
+  0x1d, 0x64, 0x9d, 0x64, 0x1d, 0x65, 0x4f, 0xf4, 0xd3, 0x53, 0x8b, 0x42,
+  0x27, 0xd8, 0x04, 0xfb, 0x0e, 0xc4, 0x1e, 0x1d, 0x8e, 0x42, 0x4f, 0xea,
+  0x14, 0x25, 0x02, 0xee, 0x10, 0x5a, 0xb8, 0xee, 0xc2, 0x2a, 0x22, 0xee,
+  0x01, 0x2a, 0x32, 0xee, 0x00, 0x2a, 0x12, 0xee, 0x10, 0x5a, 0x15, 0x60,
+  0x15, 0xd8, 0x04, 0xfb, 0x0e, 0xc4, 0x08, 0x33, 0xb3, 0xf5, 0xf3, 0x5f,
+  0x4f, 0xea, 0x14, 0x25, 0x02, 0xee, 0x10, 0x5a, 0xb8, 0xee, 0xc2, 0x2a,
+  0x22, 0xee, 0x01, 0x2a, 0x32, 0xee, 0x00, 0x2a, 0x12, 0xee, 0x10, 0x5a,
+  0x55, 0x60, 0x02, 0xf1, 0x08, 0x02, 0xd6, 0xd1, 0x70, 0xbd, 0x02, 0x21,
+  0xbd, 0xe8, 0x70, 0x40, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0x00, 0x00, 0x34,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2,
+  0x00, 0x02, 0x12, 0x69, 0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd,
+  0x2d, 0xe9, 0xf0, 0x41, 0x2d, 0xed, 0x0c, 0x8b, 0x01, 0x29, 0xc0, 0xf2,
+  0x8d, 0x80, 0xd0, 0xf8, 0x78, 0x31, 0x4f, 0xf0, 0x00, 0x0e, 0x03, 0xf5,
+  0xd0, 0x5c, 0xd0, 0xf8, 0xb8, 0x21, 0x4f, 0xf4, 0xd3, 0x58, 0x9f, 0xed,
+  0x47, 0x3a, 0x9c, 0xed, 0x14, 0x0a, 0x4f, 0xf4, 0xf3, 0x55, 0x9c, 0xed,
+  0x12, 0x2a, 0x9f, 0xed, 0x44, 0x5a, 0x9c, 0xed, 0x10, 0x1a, 0x9f, 0xed,
+  0x43, 0x7a, 0x9c, 0xed, 0x0c, 0x4a, 0xdf, 0xed, 0x42, 0x0a, 0xdc, 0xed,
+  0x00, 0x1a, 0xdc, 0xed, 0x04, 0x2a, 0xdc, 0xed, 0x06, 0x3a, 0x9c, 0xed,
+  0x08, 0x6a, 0x00, 0x26, 0x06, 0xf5, 0xd3, 0x57, 0x97, 0x42, 0x9c, 0xbf,
+  0x06, 0xf5, 0xf3, 0x57, 0x97, 0x42, 0x63, 0xd8, 0x9f, 0x19, 0x04, 0x36,
+  0xb6, 0xf5, 0x80, 0x6f, 0x57, 0xf8, 0x08, 0x40, 0x04, 0xee, 0x90, 0x4a,
+  0x64, 0xee, 0x83, 0x5a, 0x75, 0xee, 0xa1, 0x6a, 0x64, 0xee, 0x85, 0x1a,
+  0x66, 0xee, 0x83, 0x7a, 0x37, 0xee, 0xa3, 0x8a, 0x66, 0xee, 0x87, 0x3a,
+  0x68, 0xee, 0x03, 0x4a, 0x71, 0xee, 0xa3, 0x1a, 0x68, 0xee, 0x07, 0x3a,
+  0x34, 0xee, 0x84, 0x9a, 0x26, 0xee, 0x85, 0x4a, 0x72, 0xee, 0xa1, 0x1a,
+  0x29, 0xee, 0x03, 0xaa, 0x34, 0xee, 0x23, 0x4a, 0x29, 0xee, 0x07, 0xba,
+  0x7a, 0xee, 0x02, 0x2a, 0x28, 0xee, 0x05, 0x2a, 0x29, 0xee, 0x05, 0xca,
+  0x22, 0xee, 0x87, 0xda, 0x12, 0xee, 0x90, 0x4a, 0x76, 0xee, 0x04, 0x3a,
+  0x32, 0xee, 0x0b, 0x2a, 0x7c, 0x51, 0x3c, 0xee, 0x0d, 0x6a, 0x22, 0xee,
+  0xa0, 0xba, 0x31, 0xee, 0x02, 0x4a, 0x30, 0xee, 0x06, 0x2a, 0x29, 0xee,
+  0x20, 0x1a, 0x28, 0xee, 0x20, 0x6a, 0x66, 0xee, 0xa0, 0x6a, 0x3a, 0xee,
+  0x4b, 0x0a, 0x34, 0xee, 0xc1, 0x1a, 0x37, 0xee, 0xc6, 0x6a, 0x75, 0xee,
+  0xe6, 0x2a, 0xab, 0xd1, 0x0e, 0xf1, 0x01, 0x0e, 0x8e, 0x45, 0xa6, 0xd1,
+  0xcc, 0xed, 0x04, 0x2a, 0xcc, 0xed, 0x00, 0x1a, 0xcc, 0xed, 0x06, 0x3a,
+  0x8c, 0xed, 0x08, 0x6a, 0x8c, 0xed, 0x0c, 0x4a, 0x8c, 0xed, 0x10, 0x1a,
+  0x8c, 0xed, 0x12, 0x2a, 0x8c, 0xed, 0x14, 0x0a, 0xbd, 0xec, 0x0c, 0x8b,
+  0xbd, 0xe8, 0xf0, 0x81, 0x02, 0x21, 0xbd, 0xec, 0x0c, 0x8b, 0xbd, 0xe8,
+  0xf0, 0x41, 0xff, 0xf7, 0xfe, 0xbf, 0x00, 0xbf, 0xfd, 0x25, 0x8a, 0x3d,
+  0xfe, 0x25, 0x0a, 0x3e, 0x2f, 0x4d, 0x92, 0x3f, 0xbb, 0x5a, 0xd3, 0x3e,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2,
+  0x00, 0x01, 0x49, 0x69, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x41, 0x40, 0xf2, 0x93, 0x12, 0x49, 0xf6,
+  0xc5, 0x5e, 0xc0, 0xf2, 0x00, 0x12, 0xd0, 0xf8, 0x78, 0xc1, 0xd0, 0xf8,
+  0xb8, 0x31, 0xc8, 0xf2, 0x1c, 0x1e, 0x4f, 0xf4, 0xf3, 0x51, 0x42, 0xf2,
+  0x60, 0x28, 0x99, 0x42, 0x9c, 0xbf, 0x0c, 0x1d, 0x9c, 0x42, 0x00, 0xf2,
+  0xd0, 0x80, 0x01, 0xf1, 0x08, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x01, 0xf1,
+  0x0c, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xc7, 0x80, 0x01, 0xf1, 0x10, 0x04,
+  0x9c, 0x42, 0x9c, 0xbf, 0x01, 0xf1, 0x14, 0x04, 0x9c, 0x42, 0x00, 0xf2,
+  0xbe, 0x80, 0x01, 0xf1, 0x18, 0x04, 0x9c, 0x42, 0x9c, 0xbf, 0x01, 0xf1,
+  0x1c, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0xb5, 0x80, 0x5c, 0xf8, 0x01, 0x60,
+  0xf4, 0xb2, 0x84, 0xea, 0x0e, 0x04, 0x54, 0x43, 0xc6, 0xf3, 0x07, 0x25,
+  0x65, 0x40, 0x55, 0x43, 0xc6, 0xf3, 0x07, 0x44, 0x65, 0x40, 0x0c, 0xeb,
+  0x01, 0x04, 0x55, 0x43, 0x20, 0x31, 0x41, 0x45, 0x85, 0xea, 0x16, 0x66,
+  0x65, 0x68, 0x02, 0xfb, 0x06, 0xf6, 0xef, 0xb2, 0x87, 0xea, 0x06, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc5, 0xf3, 0x07, 0x26, 0x87, 0xea, 0x06, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc5, 0xf3, 0x07, 0x46, 0x87, 0xea, 0x06, 0x07,
+  0xa6, 0x68, 0x02, 0xfb, 0x07, 0xf7, 0x87, 0xea, 0x15, 0x67, 0x02, 0xfb,
+  0x07, 0xf7, 0xf5, 0xb2, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0xc6, 0xf3, 0x07, 0x25, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0xc6, 0xf3, 0x07, 0x45, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0x87, 0xea, 0x16, 0x67, 0xe6, 0x68, 0x02, 0xfb, 0x07, 0xf7, 0xf5, 0xb2,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x25,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x45,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0x87, 0xea, 0x16, 0x67,
+  0x26, 0x69, 0x02, 0xfb, 0x07, 0xf7, 0xf5, 0xb2, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x25, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x45, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0x87, 0xea, 0x16, 0x67, 0x66, 0x69, 0x02, 0xfb,
+  0x07, 0xf7, 0xf5, 0xb2, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0xc6, 0xf3, 0x07, 0x25, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0xc6, 0xf3, 0x07, 0x45, 0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7,
+  0x87, 0xea, 0x16, 0x67, 0xa6, 0x69, 0x02, 0xfb, 0x07, 0xf7, 0xf5, 0xb2,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x25,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x45,
+  0x87, 0xea, 0x05, 0x07, 0x02, 0xfb, 0x07, 0xf7, 0x87, 0xea, 0x16, 0x67,
+  0xe6, 0x69, 0x02, 0xfb, 0x07, 0xf7, 0xf5, 0xb2, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x25, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0xc6, 0xf3, 0x07, 0x45, 0x87, 0xea, 0x05, 0x07,
+  0x02, 0xfb, 0x07, 0xf7, 0x87, 0xea, 0x16, 0x67, 0x07, 0xfb, 0x02, 0xfe,
+  0x7f, 0xf4, 0x2d, 0xaf, 0x70, 0x46, 0xbd, 0xe8, 0xf0, 0x81, 0x02, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0xbd, 0xe8, 0xf0, 0x81, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01,
+  0x89, 0x69, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x4f, 0x83, 0xb0, 0xd0, 0xf8, 0x78, 0x11, 0x00, 0x90, 0xd0, 0xf8,
+  0xb8, 0x31, 0x42, 0xf6, 0x84, 0x20, 0x4f, 0xf2, 0x5f, 0x3c, 0x46, 0xf2,
+  0x0d, 0x6e, 0x42, 0xf2, 0x84, 0x24, 0x08, 0x44, 0xc3, 0xf6, 0x6e, 0x4c,
+  0xc0, 0xf2, 0x19, 0x0e, 0xcd, 0xe9, 0x01, 0x01, 0x0a, 0x19, 0x4f, 0xf0,
+  0x00, 0x08, 0x4f, 0xf0, 0x03, 0x09, 0x42, 0xf6, 0x60, 0x20, 0x4f, 0xf0,
+  0x00, 0x0b, 0x0b, 0xeb, 0x00, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x3f, 0x81,
+  0x42, 0xf6, 0x64, 0x20, 0x02, 0xeb, 0x0b, 0x0a, 0x0b, 0xeb, 0x00, 0x04,
+  0x9c, 0x42, 0xca, 0xf8, 0xdc, 0x87, 0x00, 0xf2, 0x34, 0x81, 0x42, 0xf6,
+  0x68, 0x20, 0xca, 0xf8, 0xe0, 0x87, 0x0b, 0xeb, 0x00, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x2b, 0x81, 0x42, 0xf6, 0x6c, 0x20, 0xca, 0xf8, 0xe4, 0x87,
+  0x0b, 0xeb, 0x00, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x22, 0x81, 0x42, 0xf6,
+  0x70, 0x20, 0xca, 0xf8, 0xe8, 0x87, 0x0b, 0xeb, 0x00, 0x04, 0x9c, 0x42,
+  0x00, 0xf2, 0x19, 0x81, 0x42, 0xf6, 0x74, 0x20, 0xca, 0xf8, 0xec, 0x87,
+  0x0b, 0xeb, 0x00, 0x04, 0x9c, 0x42, 0x00, 0xf2, 0x10, 0x81, 0x09, 0xfb,
+  0x0e, 0xc4, 0x42, 0xf6, 0x78, 0x20, 0xca, 0xf8, 0xf0, 0x87, 0x04, 0xfb,
+  0x0e, 0xc7, 0x24, 0x0d, 0x4a, 0xf8, 0x24, 0x4c, 0x07, 0xfb, 0x0e, 0xc5,
+  0x3f, 0x0d, 0xca, 0xf8, 0xdc, 0x73, 0x05, 0xfb, 0x0e, 0xc6, 0x2d, 0x0d,
+  0x4a, 0xf8, 0x20, 0x5c, 0x06, 0xfb, 0x0e, 0xc1, 0x35, 0x0d, 0xca, 0xf8,
+  0xe0, 0x53, 0x01, 0xfb, 0x0e, 0xc4, 0x09, 0x0d, 0x4a, 0xf8, 0x1c, 0x1c,
+  0x04, 0xfb, 0x0e, 0xc7, 0x21, 0x0d, 0xca, 0xf8, 0xe4, 0x13, 0x07, 0xfb,
+  0x0e, 0xc5, 0x39, 0x0d, 0x4a, 0xf8, 0x18, 0x1c, 0x05, 0xfb, 0x0e, 0xc4,
+  0x2d, 0x0d, 0xca, 0xf8, 0xe8, 0x53, 0x04, 0xfb, 0x0e, 0xc1, 0x24, 0x0d,
+  0x4a, 0xf8, 0x14, 0x4c, 0x01, 0xfb, 0x0e, 0xc5, 0x09, 0x0d, 0xca, 0xf8,
+  0xec, 0x13, 0x05, 0xfb, 0x0e, 0xc1, 0x2c, 0x0d, 0x4a, 0xf8, 0x10, 0x4c,
+  0x0c, 0x0d, 0x01, 0xfb, 0x0e, 0xc7, 0x0b, 0xeb, 0x00, 0x01, 0xca, 0xf8,
+  0xf0, 0x43, 0x99, 0x42, 0x4f, 0xea, 0x17, 0x51, 0x4a, 0xf8, 0x0c, 0x1c,
+  0x00, 0xf2, 0xc5, 0x80, 0x42, 0xf6, 0x7c, 0x20, 0xca, 0xf8, 0xf4, 0x87,
+  0x0b, 0xeb, 0x00, 0x01, 0x99, 0x42, 0x00, 0xf2, 0xbc, 0x80, 0x0b, 0xf5,
+  0x2a, 0x51, 0xca, 0xf8, 0xf8, 0x87, 0x99, 0x42, 0x00, 0xf2, 0xb5, 0x80,
+  0x02, 0x98, 0x00, 0xeb, 0x0b, 0x04, 0x42, 0xf6, 0x84, 0x20, 0x0b, 0xeb,
+  0x00, 0x01, 0x4f, 0xf4, 0x2a, 0x50, 0x99, 0x42, 0x44, 0xf8, 0x00, 0x80,
+  0x00, 0xf2, 0xa7, 0x80, 0x42, 0xf6, 0x88, 0x20, 0x0b, 0xeb, 0x00, 0x01,
+  0x01, 0x98, 0x99, 0x42, 0x40, 0xf8, 0x0b, 0x80, 0x00, 0xf2, 0x9d, 0x80,
+  0x42, 0xf6, 0x8c, 0x20, 0xca, 0xf8, 0x04, 0x88, 0x0b, 0xeb, 0x00, 0x01,
+  0x99, 0x42, 0x00, 0xf2, 0x94, 0x80, 0x07, 0xfb, 0x0e, 0xc9, 0x11, 0x46,
+  0x4f, 0xf4, 0x0a, 0x52, 0xca, 0xf8, 0x08, 0x88, 0x09, 0xfb, 0x0e, 0xc5,
+  0x05, 0xfb, 0x0e, 0xc6, 0x06, 0xfb, 0x0e, 0xc7, 0x07, 0xfb, 0x0e, 0xc0,
+  0x3f, 0x0d, 0xa7, 0x50, 0x0a, 0x46, 0x00, 0xfb, 0x0e, 0xc7, 0x4f, 0xf4,
+  0x1a, 0x51, 0x00, 0x0d, 0x60, 0x50, 0x4f, 0xea, 0x19, 0x50, 0x07, 0xfb,
+  0x0e, 0xc1, 0xca, 0xf8, 0xf4, 0x03, 0x28, 0x0d, 0x4a, 0xf8, 0x08, 0x0c,
+  0x01, 0xfb, 0x0e, 0xc0, 0x09, 0x0d, 0xca, 0xf8, 0x00, 0x14, 0x34, 0x0d,
+  0x00, 0xfb, 0x0e, 0xc5, 0x00, 0x0d, 0xca, 0xf8, 0xf8, 0x43, 0x3c, 0x0d,
+  0x05, 0xfb, 0x0e, 0xc1, 0xca, 0xf8, 0x04, 0x00, 0x42, 0xf8, 0x0b, 0x40,
+  0x2c, 0x0d, 0x01, 0xfb, 0x0e, 0xc0, 0xca, 0xf8, 0x04, 0x44, 0x09, 0x0d,
+  0xca, 0xf8, 0x08, 0x10, 0x00, 0xfb, 0x0e, 0xc4, 0x00, 0x0d, 0x42, 0xf6,
+  0x90, 0x21, 0xca, 0xf8, 0x08, 0x04, 0x20, 0x0d, 0x04, 0xfb, 0x0e, 0xc4,
+  0x59, 0x44, 0xca, 0xf8, 0x0c, 0x00, 0x99, 0x42, 0x4f, 0xea, 0x14, 0x50,
+  0xca, 0xf8, 0x0c, 0x04, 0x45, 0xd8, 0x42, 0xf6, 0x94, 0x20, 0xca, 0xf8,
+  0x0c, 0x88, 0x58, 0x44, 0x98, 0x42, 0x3e, 0xd8, 0x42, 0xf6, 0x98, 0x20,
+  0xca, 0xf8, 0x10, 0x88, 0x58, 0x44, 0x98, 0x42, 0x37, 0xd8, 0x42, 0xf6,
+  0x9c, 0x20, 0xca, 0xf8, 0x14, 0x88, 0x58, 0x44, 0x98, 0x42, 0x30, 0xd8,
+  0x04, 0xfb, 0x0e, 0xc0, 0x0b, 0xf1, 0x40, 0x0b, 0xbb, 0xf5, 0x80, 0x6f,
+  0xca, 0xf8, 0x18, 0x88, 0x00, 0xfb, 0x0e, 0xc1, 0x4f, 0xea, 0x10, 0x50,
+  0xca, 0xf8, 0x10, 0x00, 0x01, 0xfb, 0x0e, 0xc4, 0x4f, 0xea, 0x11, 0x50,
+  0xca, 0xf8, 0x10, 0x04, 0x04, 0xfb, 0x0e, 0xc1, 0x4f, 0xea, 0x14, 0x50,
+  0xca, 0xf8, 0x14, 0x00, 0x01, 0xfb, 0x0e, 0xc0, 0x4f, 0xea, 0x11, 0x51,
+  0xca, 0xf8, 0x14, 0x14, 0x00, 0xfb, 0x0e, 0xc9, 0x4f, 0xea, 0x10, 0x51,
+  0xca, 0xf8, 0x18, 0x10, 0x4f, 0xea, 0x19, 0x50, 0xca, 0xf8, 0x18, 0x04,
+  0x42, 0xf6, 0x60, 0x20, 0x7f, 0xf4, 0xbf, 0xae, 0x03, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x02, 0x21, 0x5d, 0xf8, 0x0c, 0x0b, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0xd2, 0x69, 0x9b, 0x1a, 0x02, 0x46,
+  0x80, 0x68, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x93, 0xb0, 0x01, 0x29,
+  0xc0, 0xf2, 0x71, 0x81, 0xd0, 0xf8, 0x78, 0x61, 0x42, 0xf6, 0x5c, 0x62,
+  0xd0, 0xf8, 0xb8, 0x71, 0x32, 0x44, 0x42, 0xf2, 0x9c, 0x25, 0x42, 0xf6,
+  0x20, 0x2e, 0x33, 0x46, 0x04, 0x96, 0x00, 0x92, 0x00, 0x22, 0x02, 0x92,
+  0x03, 0x90, 0x01, 0x91, 0x00, 0x20, 0x42, 0xf6, 0x60, 0x29, 0x42, 0xf6,
+  0x64, 0x21, 0x06, 0x91, 0x05, 0x90, 0x05, 0xeb, 0x80, 0x10, 0xb8, 0x42,
+  0x00, 0xf2, 0x56, 0x81, 0x05, 0x99, 0xdd, 0xf8, 0x10, 0xc0, 0x89, 0x01,
+  0x42, 0xf2, 0x64, 0x22, 0x61, 0x44, 0x5c, 0xf8, 0x00, 0x30, 0x42, 0xf2,
+  0x98, 0x20, 0x4f, 0xf0, 0x00, 0x0b, 0x08, 0x58, 0x12, 0x90, 0x42, 0xf2,
+  0x94, 0x20, 0x0d, 0x58, 0x42, 0xf2, 0x90, 0x20, 0x51, 0xf8, 0x00, 0x80,
+  0x42, 0xf2, 0x8c, 0x20, 0x51, 0xf8, 0x00, 0xa0, 0x42, 0xf2, 0x88, 0x20,
+  0x08, 0x58, 0x11, 0x90, 0x42, 0xf2, 0x84, 0x20, 0x08, 0x58, 0x10, 0x90,
+  0x4f, 0xf4, 0x0a, 0x50, 0x08, 0x58, 0x0f, 0x90, 0x42, 0xf2, 0x7c, 0x20,
+  0x08, 0x58, 0x0e, 0x90, 0x42, 0xf2, 0x78, 0x20, 0x08, 0x58, 0x0d, 0x90,
+  0x42, 0xf2, 0x74, 0x20, 0x08, 0x58, 0x0c, 0x90, 0x42, 0xf2, 0x70, 0x20,
+  0x08, 0x58, 0x0b, 0x90, 0x42, 0xf2, 0x6c, 0x20, 0x08, 0x58, 0x0a, 0x90,
+  0x42, 0xf2, 0x68, 0x20, 0x08, 0x58, 0x09, 0x90, 0x88, 0x58, 0x42, 0xf2,
+  0x60, 0x22, 0x08, 0x90, 0x88, 0x58, 0x07, 0x90, 0x0b, 0xeb, 0x0e, 0x04,
+  0xbc, 0x42, 0x9c, 0xbf, 0x09, 0xeb, 0x0b, 0x04, 0xbc, 0x42, 0x00, 0xf2,
+  0x09, 0x81, 0x42, 0xf2, 0xe0, 0x62, 0x12, 0x99, 0x11, 0x98, 0x5c, 0xf8,
+  0x02, 0x40, 0x42, 0xf6, 0x20, 0x22, 0x5c, 0xf8, 0x02, 0xe0, 0x42, 0xf6,
+  0xe0, 0x12, 0x5c, 0xf8, 0x02, 0x60, 0x0e, 0xfb, 0x03, 0xf2, 0x06, 0xfb,
+  0x01, 0x22, 0x42, 0xf6, 0xa0, 0x16, 0x06, 0x99, 0x42, 0xf6, 0x20, 0x2e,
+  0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x05, 0x22, 0x42, 0xf6, 0x60, 0x16,
+  0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x08, 0x22, 0x42, 0xf6, 0x20, 0x16,
+  0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x0a, 0x22, 0x42, 0xf6, 0xe0, 0x06,
+  0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x00, 0x22, 0x42, 0xf6, 0xa0, 0x06,
+  0x10, 0x98, 0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x00, 0x22, 0x42, 0xf6,
+  0x60, 0x06, 0x0f, 0x98, 0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x00, 0x22,
+  0x42, 0xf6, 0x20, 0x06, 0x0e, 0x98, 0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb,
+  0x00, 0x22, 0x42, 0xf2, 0xe0, 0x76, 0x0d, 0x98, 0x5c, 0xf8, 0x06, 0x60,
+  0x06, 0xfb, 0x00, 0x22, 0x42, 0xf2, 0xa0, 0x76, 0x0c, 0x98, 0x5c, 0xf8,
+  0x06, 0x60, 0x06, 0xfb, 0x00, 0x22, 0x42, 0xf2, 0x60, 0x76, 0x0b, 0x98,
+  0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x00, 0x22, 0x42, 0xf2, 0x20, 0x76,
+  0x0a, 0x98, 0x5c, 0xf8, 0x06, 0x60, 0x06, 0xfb, 0x00, 0x22, 0x42, 0xf2,
+  0xa0, 0x66, 0x09, 0x98, 0x04, 0xfb, 0x00, 0x22, 0x42, 0xf2, 0x60, 0x64,
+  0x5c, 0xf8, 0x06, 0x60, 0x08, 0x98, 0x5c, 0xf8, 0x04, 0x40, 0x06, 0xfb,
+  0x00, 0x22, 0x01, 0xeb, 0x0b, 0x06, 0x07, 0x98, 0x04, 0xfb, 0x00, 0x22,
+  0xbe, 0x42, 0x4c, 0xf8, 0x09, 0x20, 0x00, 0xf2, 0x93, 0x80, 0x42, 0xf6,
+  0x64, 0x01, 0x50, 0x46, 0x0c, 0xeb, 0x01, 0x02, 0xc2, 0x46, 0xdd, 0xf8,
+  0x48, 0x80, 0x0b, 0xf1, 0x08, 0x0b, 0xd2, 0xf8, 0xc0, 0x61, 0xbb, 0xf1,
+  0x40, 0x0f, 0xd2, 0xf8, 0x80, 0x41, 0x03, 0xfb, 0x06, 0xf6, 0x04, 0xfb,
+  0x08, 0x66, 0xd2, 0xf8, 0x40, 0x41, 0xd0, 0x46, 0x04, 0xfb, 0x05, 0x66,
+  0xd2, 0xf8, 0x00, 0x41, 0x82, 0x46, 0x04, 0xfb, 0x08, 0x66, 0xd2, 0xf8,
+  0xc0, 0x40, 0x04, 0xfb, 0x00, 0x66, 0xd2, 0xf8, 0x80, 0x40, 0x11, 0x98,
+  0x04, 0xfb, 0x00, 0x66, 0x14, 0x6c, 0x10, 0x98, 0x04, 0xfb, 0x00, 0x66,
+  0x5c, 0xf8, 0x01, 0x40, 0x0f, 0x98, 0x42, 0xf2, 0x64, 0x71, 0x04, 0xfb,
+  0x00, 0x66, 0x52, 0xf8, 0x40, 0x4c, 0x0e, 0x98, 0x04, 0xfb, 0x00, 0x66,
+  0x52, 0xf8, 0x80, 0x4c, 0x0d, 0x98, 0x52, 0xf8, 0xc0, 0x2c, 0x04, 0xfb,
+  0x00, 0x66, 0x5c, 0xf8, 0x01, 0x40, 0x42, 0xf2, 0x24, 0x71, 0x0c, 0x98,
+  0x02, 0xfb, 0x00, 0x62, 0x0b, 0x98, 0x5c, 0xf8, 0x01, 0x60, 0x42, 0xf2,
+  0xe4, 0x61, 0x04, 0xfb, 0x00, 0x22, 0x0a, 0x98, 0x5c, 0xf8, 0x01, 0x40,
+  0x42, 0xf2, 0xa4, 0x61, 0x06, 0xfb, 0x00, 0x22, 0x09, 0x98, 0x5c, 0xf8,
+  0x01, 0x60, 0x42, 0xf2, 0x64, 0x61, 0x04, 0xfb, 0x00, 0x22, 0x08, 0x98,
+  0x5c, 0xf8, 0x01, 0x40, 0x06, 0xfb, 0x00, 0x22, 0x0c, 0xeb, 0x09, 0x06,
+  0x07, 0x98, 0x04, 0xfb, 0x00, 0x22, 0x0c, 0xf1, 0x08, 0x0c, 0x72, 0x60,
+  0x7f, 0xf4, 0x18, 0xaf, 0x05, 0x98, 0x09, 0xf1, 0x40, 0x09, 0x01, 0x30,
+  0x06, 0x99, 0x10, 0x28, 0x42, 0xf2, 0x9c, 0x25, 0x01, 0xf1, 0x40, 0x01,
+  0x06, 0x91, 0x7f, 0xf4, 0xc1, 0xae, 0x02, 0x9e, 0x3c, 0x20, 0x00, 0xea,
+  0x96, 0x00, 0x04, 0x99, 0x66, 0xf3, 0x89, 0x10, 0x42, 0xf2, 0x60, 0x2c,
+  0x08, 0x44, 0x00, 0x99, 0x01, 0x36, 0x0a, 0x68, 0x01, 0x99, 0x50, 0xf8,
+  0x0c, 0x40, 0x8e, 0x42, 0x6f, 0xf3, 0x1f, 0x32, 0x02, 0x96, 0x82, 0xea,
+  0x04, 0x02, 0x40, 0xf8, 0x0c, 0x20, 0x7f, 0xf4, 0xa1, 0xae, 0x13, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x03, 0x98, 0x13, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x09, 0x6a, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f,
+  0x81, 0xb0, 0xd0, 0xf8, 0x78, 0x11, 0x42, 0xf6, 0x70, 0x2c, 0x40, 0xf2,
+  0x93, 0x12, 0x01, 0xeb, 0x0c, 0x0e, 0x49, 0xf6, 0xc5, 0x51, 0xc0, 0xf2,
+  0x00, 0x12, 0xd0, 0xf8, 0xb8, 0x31, 0xc8, 0xf2, 0x1c, 0x11, 0x00, 0x24,
+  0x42, 0xf6, 0x60, 0x25, 0x42, 0xf6, 0x64, 0x28, 0x42, 0xf6, 0x68, 0x2a,
+  0x67, 0x19, 0x9f, 0x42, 0x9c, 0xbf, 0x04, 0xeb, 0x08, 0x07, 0x9f, 0x42,
+  0x00, 0xf2, 0xc5, 0x80, 0x04, 0xeb, 0x0a, 0x07, 0x9f, 0x42, 0x9e, 0xbf,
+  0x42, 0xf6, 0x6c, 0x26, 0xa7, 0x19, 0x9f, 0x42, 0x00, 0xf2, 0xbb, 0x80,
+  0x04, 0xeb, 0x0c, 0x07, 0x9f, 0x42, 0x9e, 0xbf, 0x42, 0xf6, 0x74, 0x26,
+  0xa7, 0x19, 0x9f, 0x42, 0x00, 0xf2, 0xb1, 0x80, 0x42, 0xf6, 0x78, 0x26,
+  0xa7, 0x19, 0x9f, 0x42, 0x9e, 0xbf, 0x42, 0xf6, 0x7c, 0x26, 0xa7, 0x19,
+  0x9f, 0x42, 0x00, 0xf2, 0xa6, 0x80, 0x0e, 0xeb, 0x04, 0x0b, 0x5b, 0xf8,
+  0x10, 0x7c, 0x5f, 0xfa, 0x87, 0xf9, 0x81, 0xea, 0x09, 0x01, 0x51, 0x43,
+  0xc7, 0xf3, 0x07, 0x26, 0x71, 0x40, 0x51, 0x43, 0xc7, 0xf3, 0x07, 0x46,
+  0x71, 0x40, 0x5b, 0xf8, 0x0c, 0x6c, 0x51, 0x43, 0x81, 0xea, 0x17, 0x61,
+  0x51, 0x43, 0xf7, 0xb2, 0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x27,
+  0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x47, 0x79, 0x40, 0x51, 0x43,
+  0x81, 0xea, 0x16, 0x61, 0x5b, 0xf8, 0x08, 0x6c, 0x51, 0x43, 0xf7, 0xb2,
+  0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x27, 0x79, 0x40, 0x51, 0x43,
+  0xc6, 0xf3, 0x07, 0x47, 0x79, 0x40, 0x51, 0x43, 0x81, 0xea, 0x16, 0x61,
+  0x5b, 0xf8, 0x04, 0x6c, 0x51, 0x43, 0xf7, 0xb2, 0x79, 0x40, 0x51, 0x43,
+  0xc6, 0xf3, 0x07, 0x27, 0x79, 0x40, 0x51, 0x43, 0xc6, 0xf3, 0x07, 0x47,
+  0x79, 0x40, 0x51, 0x43, 0x81, 0xea, 0x16, 0x61, 0x5e, 0xf8, 0x04, 0x60,
+  0x51, 0x43, 0x20, 0x34, 0xf7, 0xb2, 0xb4, 0xf5, 0x80, 0x6f, 0x81, 0xea,
+  0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x27, 0x81, 0xea,
+  0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x47, 0x81, 0xea,
+  0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1, 0x81, 0xea, 0x16, 0x61, 0xdb, 0xf8,
+  0x04, 0x60, 0x02, 0xfb, 0x01, 0xf1, 0xf7, 0xb2, 0x81, 0xea, 0x07, 0x01,
+  0x02, 0xfb, 0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x27, 0x81, 0xea, 0x07, 0x01,
+  0x02, 0xfb, 0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x47, 0x81, 0xea, 0x07, 0x01,
+  0x02, 0xfb, 0x01, 0xf1, 0x81, 0xea, 0x16, 0x61, 0xdb, 0xf8, 0x08, 0x60,
+  0x02, 0xfb, 0x01, 0xf1, 0xf7, 0xb2, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb,
+  0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x27, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb,
+  0x01, 0xf1, 0xc6, 0xf3, 0x07, 0x47, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb,
+  0x01, 0xf1, 0x81, 0xea, 0x16, 0x61, 0xdb, 0xf8, 0x0c, 0x60, 0x02, 0xfb,
+  0x01, 0xf1, 0xf7, 0xb2, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1,
+  0xc6, 0xf3, 0x07, 0x27, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1,
+  0xc6, 0xf3, 0x07, 0x47, 0x81, 0xea, 0x07, 0x01, 0x02, 0xfb, 0x01, 0xf1,
+  0x81, 0xea, 0x16, 0x61, 0x02, 0xfb, 0x01, 0xf1, 0x7f, 0xf4, 0x34, 0xaf,
+  0x03, 0xe0, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x21, 0x08, 0x46,
+  0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x49, 0x6a, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x48, 0xf2,
+  0x20, 0x3b, 0xd0, 0xf8, 0x78, 0xc1, 0x42, 0xf6, 0x64, 0x61, 0x46, 0xf2,
+  0x58, 0x18, 0xce, 0xf6, 0xb8, 0x5b, 0xd0, 0xf8, 0xa8, 0xe1, 0xd0, 0xf8,
+  0xb8, 0x91, 0x0c, 0xeb, 0x01, 0x02, 0x42, 0xf6, 0x60, 0x6a, 0x6f, 0xf0,
+  0xff, 0x04, 0xc4, 0xf6, 0xb2, 0x58, 0x04, 0xf5, 0x80, 0x77, 0xbd, 0x07,
+  0x8b, 0xea, 0x97, 0x01, 0x58, 0xbf, 0xb9, 0x08, 0x8b, 0xea, 0x51, 0x06,
+  0xcb, 0x07, 0x08, 0xbf, 0x4e, 0x08, 0x8b, 0xea, 0x56, 0x01, 0xf3, 0x07,
+  0x08, 0xbf, 0x71, 0x08, 0x8b, 0xea, 0x51, 0x03, 0xce, 0x07, 0x08, 0xbf,
+  0x4b, 0x08, 0x8b, 0xea, 0x53, 0x01, 0xde, 0x07, 0x08, 0xbf, 0x59, 0x08,
+  0x8b, 0xea, 0x51, 0x06, 0xcb, 0x07, 0x08, 0xbf, 0x4e, 0x08, 0xca, 0x45,
+  0x7c, 0xd8, 0xf3, 0x07, 0x4f, 0xea, 0x56, 0x01, 0x43, 0x46, 0x18, 0xbf,
+  0x81, 0xea, 0x0b, 0x01, 0x00, 0x2d, 0x5c, 0xbf, 0x42, 0xf2, 0xc8, 0x03,
+  0xc3, 0xf6, 0x6e, 0x33, 0x83, 0xea, 0xd7, 0x03, 0x7d, 0x07, 0x48, 0xbf,
+  0x83, 0xea, 0x0b, 0x03, 0x8b, 0xea, 0x53, 0x05, 0xde, 0x07, 0x08, 0xbf,
+  0x5d, 0x08, 0x8b, 0xea, 0x55, 0x03, 0xee, 0x07, 0x08, 0xbf, 0x6b, 0x08,
+  0x8b, 0xea, 0x53, 0x06, 0xdd, 0x07, 0x08, 0xbf, 0x5e, 0x08, 0x8b, 0xea,
+  0x56, 0x07, 0x0a, 0xf1, 0x04, 0x05, 0xf3, 0x07, 0x08, 0xbf, 0x77, 0x08,
+  0x4d, 0x45, 0x42, 0xf8, 0x04, 0x1c, 0x4f, 0xd8, 0x79, 0x08, 0x05, 0xf1,
+  0x04, 0x0a, 0xfb, 0x07, 0x18, 0xbf, 0x81, 0xea, 0x0b, 0x01, 0x02, 0x34,
+  0x42, 0xf8, 0x08, 0x1b, 0xa5, 0xd1, 0x4f, 0xf2, 0x5f, 0x31, 0x46, 0xf2,
+  0x0d, 0x62, 0x43, 0xf2, 0x61, 0x2b, 0xc3, 0xf6, 0x6e, 0x41, 0xc0, 0xf2,
+  0x19, 0x02, 0x0c, 0xeb, 0x0b, 0x04, 0x04, 0x26, 0x00, 0x25, 0x43, 0xf2,
+  0x60, 0x2a, 0x43, 0xf2, 0x62, 0x29, 0x43, 0xf2, 0x63, 0x28, 0x05, 0xeb,
+  0x0a, 0x07, 0x77, 0x45, 0x2c, 0xd8, 0x06, 0xfb, 0x02, 0x16, 0x67, 0x19,
+  0x05, 0xeb, 0x0b, 0x03, 0x73, 0x45, 0x4f, 0xea, 0x16, 0x63, 0x07, 0xf8,
+  0x01, 0x3c, 0x21, 0xd8, 0x06, 0xfb, 0x02, 0x16, 0x05, 0xeb, 0x09, 0x03,
+  0x73, 0x45, 0x4f, 0xea, 0x16, 0x63, 0x63, 0x55, 0x18, 0xd8, 0x06, 0xfb,
+  0x02, 0x16, 0x05, 0xeb, 0x08, 0x03, 0x73, 0x45, 0x4f, 0xea, 0x16, 0x63,
+  0x7b, 0x70, 0x0f, 0xd8, 0x06, 0xfb, 0x02, 0x16, 0x04, 0x35, 0xb5, 0xf5,
+  0x80, 0x6f, 0x4f, 0xea, 0x16, 0x63, 0xbb, 0x70, 0xd5, 0xd1, 0x43, 0xf2,
+  0x60, 0x60, 0x00, 0x21, 0x4c, 0xf8, 0x00, 0x10, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x02, 0x21, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02,
+  0x92, 0x6a, 0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x12, 0x69,
+  0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x4f, 0x81, 0xb0, 0x01, 0x29, 0x4c, 0xdb, 0xd0, 0xf8, 0x78, 0xb1,
+  0x43, 0xf2, 0x61, 0x22, 0xd0, 0xf8, 0xa8, 0xe1, 0x0b, 0xeb, 0x02, 0x05,
+  0xd0, 0xf8, 0xb8, 0xc1, 0x4f, 0xf0, 0x00, 0x09, 0x42, 0xf6, 0x60, 0x6a,
+  0x00, 0x95, 0x4f, 0xf0, 0xff, 0x37, 0x4f, 0xf4, 0x80, 0x66, 0x43, 0xf2,
+  0x61, 0x24, 0x62, 0x1e, 0x72, 0x45, 0x9f, 0xbf, 0x15, 0xf8, 0x01, 0x2c,
+  0x5f, 0xfa, 0x87, 0xf8, 0x82, 0xea, 0x08, 0x02, 0x0a, 0xeb, 0x82, 0x02,
+  0x98, 0xbf, 0x62, 0x45, 0x2c, 0xd8, 0x74, 0x45, 0x9f, 0xbf, 0x5b, 0xf8,
+  0x02, 0x20, 0x82, 0xea, 0x17, 0x27, 0x2a, 0x78, 0xfb, 0xb2, 0x9e, 0xbf,
+  0x5a, 0x40, 0x0a, 0xeb, 0x82, 0x02, 0x62, 0x45, 0x1e, 0xd8, 0x5b, 0xf8,
+  0x02, 0x20, 0x02, 0x3e, 0x05, 0xf1, 0x02, 0x05, 0x04, 0xf1, 0x02, 0x04,
+  0x82, 0xea, 0x17, 0x27, 0xd9, 0xd1, 0x4a, 0x46, 0x43, 0xf2, 0x60, 0x23,
+  0x6f, 0xf3, 0x9f, 0x22, 0xd4, 0x18, 0x74, 0x45, 0x0c, 0xd8, 0x09, 0xf1,
+  0x01, 0x09, 0xfa, 0x43, 0x89, 0x45, 0x00, 0x9d, 0x0b, 0xf8, 0x04, 0x20,
+  0xc3, 0xd1, 0xc5, 0xf8, 0xff, 0x23, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f,
+  0x02, 0x21, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf,
+  0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2,
+  0x00, 0x01, 0xc9, 0x6a, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3,
+  0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0,
+  0x80, 0xbd, 0xd0, 0xf8, 0x78, 0x01, 0x43, 0xf2, 0x60, 0x61, 0x40, 0x58,
+  0x70, 0x47, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa,
+  0xc0, 0xf2, 0x00, 0x01, 0x09, 0x6b, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68,
+  0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0xd0, 0xf8, 0x78, 0xe1,
+  0x44, 0xf2, 0x40, 0x01, 0x40, 0xf2, 0x00, 0x17, 0x40, 0xf2, 0x04, 0x56,
+  0x0e, 0xeb, 0x01, 0x03, 0xc0, 0xf2, 0x02, 0x37, 0xc0, 0xf2, 0x06, 0x76,
+  0xd0, 0xf8, 0xa8, 0x21, 0x4e, 0xf8, 0x01, 0x70, 0x07, 0xf1, 0x08, 0x31,
+  0x06, 0xf1, 0x08, 0x37, 0x00, 0x90, 0x5e, 0x60, 0x01, 0x20, 0xc3, 0xe9,
+  0x02, 0x17, 0x0c, 0x27, 0x4f, 0xf0, 0x08, 0x0c, 0x44, 0xf2, 0x53, 0x01,
+  0x10, 0x26, 0x0c, 0x1f, 0x94, 0x42, 0x5e, 0xd8, 0x0e, 0xeb, 0x01, 0x05,
+  0x16, 0xf0, 0x0c, 0x0f, 0x15, 0xf8, 0x06, 0x8c, 0x15, 0xf8, 0x05, 0xac,
+  0x15, 0xf8, 0x04, 0xbc, 0x30, 0xd0, 0xa1, 0xf1, 0x13, 0x04, 0x94, 0x42,
+  0x9c, 0xbf, 0xcc, 0x1e, 0x94, 0x42, 0x4c, 0xd8, 0x15, 0xf8, 0x13, 0x4c,
+  0x8b, 0x1e, 0x93, 0x42, 0x87, 0xea, 0x04, 0x07, 0x05, 0xf8, 0x03, 0x7c,
+  0x43, 0xd8, 0x15, 0xf8, 0x12, 0x3c, 0x4c, 0x1e, 0x94, 0x42, 0x83, 0xea,
+  0x08, 0x03, 0x05, 0xf8, 0x02, 0x3c, 0x3a, 0xd8, 0x15, 0xf8, 0x11, 0x3c,
+  0x91, 0x42, 0x83, 0xea, 0x0a, 0x03, 0x05, 0xf8, 0x01, 0x3c, 0x32, 0xd8,
+  0x15, 0xf8, 0x10, 0x3c, 0x0c, 0xf1, 0x04, 0x0c, 0xbc, 0xf1, 0xa8, 0x0f,
+  0x06, 0xf1, 0x04, 0x06, 0x83, 0xea, 0x0b, 0x03, 0x0e, 0xf8, 0x01, 0x30,
+  0x01, 0xf1, 0x04, 0x01, 0xc1, 0xd3, 0x29, 0xe0, 0x08, 0xf5, 0x80, 0x59,
+  0x91, 0x45, 0x9c, 0xbf, 0x0b, 0xf5, 0x80, 0x54, 0x94, 0x42, 0x1a, 0xd8,
+  0x0a, 0xf5, 0x80, 0x58, 0x90, 0x45, 0x9e, 0xbf, 0x10, 0x23, 0x63, 0xf3,
+  0x1f, 0x27, 0x97, 0x42, 0x11, 0xd8, 0x1e, 0xf8, 0x09, 0x90, 0x1e, 0xf8,
+  0x07, 0xb0, 0x1b, 0x23, 0x1e, 0xf8, 0x04, 0xa0, 0x80, 0xea, 0x09, 0x07,
+  0x1e, 0xf8, 0x08, 0x80, 0x4f, 0xfa, 0x80, 0xf9, 0x03, 0xea, 0xd9, 0x14,
+  0x84, 0xea, 0x40, 0x00, 0xab, 0xe7, 0x02, 0x21, 0x5d, 0xf8, 0x04, 0x0b,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x43, 0xf2, 0x7f, 0x60,
+  0x00, 0x21, 0x70, 0x44, 0x00, 0x22, 0x02, 0xf1, 0x11, 0x07, 0x83, 0x18,
+  0x07, 0xf0, 0x0d, 0x07, 0x81, 0xf0, 0x33, 0x06, 0x03, 0xf8, 0x0c, 0x6c,
+  0x81, 0xf0, 0x22, 0x06, 0x47, 0xea, 0x07, 0x17, 0x03, 0xf8, 0x0d, 0x6c,
+  0x4f, 0x40, 0x03, 0xf8, 0x0e, 0x7c, 0x57, 0x1d, 0x81, 0xf0, 0x77, 0x06,
+  0x07, 0xf0, 0x0d, 0x07, 0x03, 0xf8, 0x08, 0x6c, 0x81, 0xf0, 0x66, 0x06,
+  0x03, 0xf8, 0x09, 0x6c, 0x47, 0xea, 0x07, 0x17, 0x02, 0xf1, 0x09, 0x06,
+  0x4f, 0x40, 0x03, 0xf8, 0x0a, 0x7c, 0x81, 0xf0, 0x44, 0x07, 0x03, 0xf8,
+  0x0b, 0x7c, 0x06, 0xf0, 0x0d, 0x07, 0x81, 0xf0, 0xbb, 0x06, 0x03, 0xf8,
+  0x04, 0x6c, 0x81, 0xf0, 0xaa, 0x06, 0x47, 0xea, 0x07, 0x17, 0x03, 0xf8,
+  0x05, 0x6c, 0x4f, 0x40, 0x03, 0xf8, 0x06, 0x7c, 0x81, 0xf0, 0x88, 0x07,
+  0x03, 0xf8, 0x07, 0x7c, 0x02, 0xf1, 0x0d, 0x07, 0xce, 0x43, 0x07, 0xf0,
+  0x0d, 0x07, 0x86, 0x54, 0x10, 0x32, 0x81, 0xf0, 0xee, 0x06, 0x47, 0xea,
+  0x07, 0x17, 0x03, 0xf8, 0x0f, 0x1c, 0x4f, 0x40, 0x03, 0xf8, 0x02, 0x7c,
+  0x81, 0xf0, 0xcc, 0x07, 0xb2, 0xf5, 0x80, 0x7f, 0x01, 0xf1, 0x01, 0x01,
+  0x03, 0xf8, 0x01, 0x6c, 0x03, 0xf8, 0x03, 0x7c, 0xa9, 0xd1, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x8f, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x52, 0x6b, 0x9b, 0x1a, 0x02, 0x46,
+  0x80, 0x68, 0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0xbd, 0xb0, 0x01, 0x29,
+  0xc0, 0xf2, 0x9e, 0x82, 0xd0, 0xf8, 0x78, 0x71, 0x44, 0xf2, 0x40, 0x02,
+  0x3a, 0x44, 0xd3, 0x7b, 0x21, 0x93, 0x93, 0x7b, 0x20, 0x93, 0x53, 0x7b,
+  0x1f, 0x93, 0x13, 0x7b, 0x1e, 0x93, 0xd3, 0x7a, 0x1d, 0x93, 0x93, 0x7a,
+  0x1c, 0x93, 0x53, 0x7a, 0x1b, 0x93, 0x13, 0x7a, 0x1a, 0x93, 0xd3, 0x79,
+  0x19, 0x93, 0x93, 0x79, 0x18, 0x93, 0x53, 0x79, 0x17, 0x93, 0x13, 0x79,
+  0x16, 0x93, 0x13, 0x78, 0x15, 0x93, 0x53, 0x78, 0x14, 0x93, 0x93, 0x78,
+  0xd2, 0x78, 0x13, 0x93, 0x12, 0x92, 0x44, 0xf2, 0x57, 0x02, 0x3a, 0x44,
+  0x2b, 0x97, 0x29, 0x92, 0xd0, 0xf8, 0xa8, 0x21, 0x2a, 0x92, 0x00, 0x22,
+  0x01, 0x92, 0x43, 0xf2, 0x7f, 0x62, 0x02, 0x90, 0x00, 0x91, 0x00, 0x20,
+  0x23, 0x90, 0x02, 0xeb, 0x00, 0x12, 0x2a, 0x98, 0x11, 0x46, 0x82, 0x42,
+  0x22, 0x92, 0x00, 0xf2, 0x64, 0x82, 0x23, 0x98, 0x43, 0xf2, 0x7e, 0x61,
+  0x00, 0x01, 0x2b, 0x9c, 0x42, 0x18, 0x43, 0xf2, 0x7d, 0x61, 0x47, 0x18,
+  0x43, 0xf2, 0x7c, 0x61, 0x46, 0x18, 0x22, 0x99, 0x11, 0x92, 0xa3, 0x5c,
+  0x61, 0x5c, 0x10, 0x97, 0x0f, 0x96, 0xe7, 0x5d, 0x21, 0x9a, 0xa6, 0x5d,
+  0x51, 0x40, 0x34, 0x91, 0x20, 0x99, 0x4f, 0xf0, 0x01, 0x0a, 0x59, 0x40,
+  0x33, 0x91, 0x1f, 0x99, 0x79, 0x40, 0x32, 0x91, 0x1e, 0x99, 0x71, 0x40,
+  0x38, 0x91, 0x43, 0xf2, 0x7b, 0x61, 0x42, 0x18, 0x43, 0xf2, 0x7a, 0x61,
+  0x43, 0x18, 0x43, 0xf2, 0x79, 0x61, 0x47, 0x18, 0x43, 0xf2, 0x78, 0x61,
+  0x46, 0x18, 0x0e, 0x92, 0xa1, 0x5c, 0x0d, 0x93, 0x0c, 0x97, 0xe3, 0x5c,
+  0x0b, 0x96, 0xe7, 0x5d, 0x1d, 0x9a, 0xa6, 0x5d, 0x81, 0xea, 0x02, 0x0c,
+  0x1c, 0x99, 0x59, 0x40, 0x31, 0x91, 0x1b, 0x99, 0x79, 0x40, 0x30, 0x91,
+  0x1a, 0x99, 0x71, 0x40, 0x39, 0x91, 0x43, 0xf2, 0x77, 0x61, 0x42, 0x18,
+  0x43, 0xf2, 0x76, 0x61, 0x43, 0x18, 0x43, 0xf2, 0x75, 0x61, 0x47, 0x18,
+  0x43, 0xf2, 0x74, 0x61, 0x46, 0x18, 0x0a, 0x92, 0xa1, 0x5c, 0x09, 0x93,
+  0x08, 0x97, 0xe3, 0x5c, 0x07, 0x96, 0xe7, 0x5d, 0x19, 0x9a, 0xa5, 0x5d,
+  0x51, 0x40, 0x18, 0x9a, 0x83, 0xea, 0x02, 0x0e, 0x17, 0x9a, 0x7a, 0x40,
+  0x2f, 0x92, 0x16, 0x9a, 0x55, 0x40, 0x43, 0xf2, 0x73, 0x62, 0x83, 0x18,
+  0x43, 0xf2, 0x72, 0x62, 0x87, 0x18, 0x43, 0xf2, 0x71, 0x62, 0x86, 0x18,
+  0x43, 0xf2, 0x70, 0x62, 0x02, 0x44, 0x06, 0x93, 0xe0, 0x5c, 0x05, 0x97,
+  0x04, 0x96, 0x14, 0xf8, 0x07, 0x80, 0x03, 0x92, 0xa7, 0x5d, 0x12, 0x9b,
+  0xa2, 0x5c, 0x80, 0xea, 0x03, 0x0b, 0x14, 0x9b, 0x13, 0x98, 0x5f, 0x40,
+  0x15, 0x9b, 0x80, 0xea, 0x08, 0x00, 0x82, 0xea, 0x03, 0x09, 0x00, 0x24,
+  0x2e, 0x94, 0xcd, 0xf8, 0xd4, 0xa0, 0xaa, 0x46, 0x2b, 0x9e, 0x56, 0xfa,
+  0x8c, 0xf4, 0x4f, 0xf4, 0x80, 0x5c, 0x56, 0xfa, 0x81, 0xf1, 0x14, 0xf8,
+  0x0c, 0x20, 0x2c, 0x92, 0x11, 0xf8, 0x0c, 0x10, 0x38, 0x9a, 0x2d, 0x91,
+  0x32, 0x99, 0x56, 0xfa, 0x8e, 0xf4, 0x56, 0xfa, 0x82, 0xf3, 0x56, 0xfa,
+  0x81, 0xf1, 0x14, 0xf8, 0x0c, 0x20, 0x56, 0xfa, 0x8b, 0xf5, 0x13, 0xf8,
+  0x0c, 0x40, 0x39, 0x9b, 0x11, 0xf8, 0x0c, 0xe0, 0x15, 0xf8, 0x0c, 0x10,
+  0x32, 0x91, 0x56, 0xfa, 0x80, 0xf0, 0x33, 0x99, 0x56, 0xfa, 0x83, 0xf3,
+  0x10, 0xf8, 0x0c, 0xb0, 0x13, 0xf8, 0x0c, 0x00, 0x56, 0xfa, 0x81, 0xf3,
+  0x30, 0x99, 0x56, 0xfa, 0x87, 0xf7, 0x56, 0xfa, 0x81, 0xf5, 0x34, 0x99,
+  0x17, 0xf8, 0x0c, 0x80, 0x13, 0xf8, 0x0c, 0x30, 0x56, 0xfa, 0x8a, 0xf7,
+  0x34, 0x93, 0x56, 0xfa, 0x81, 0xf1, 0x15, 0xf8, 0x0c, 0x30, 0x3c, 0x93,
+  0x17, 0xf8, 0x0c, 0x30, 0x11, 0xf8, 0x0c, 0x10, 0x3a, 0x93, 0x37, 0x91,
+  0x31, 0x99, 0x2f, 0x9b, 0x56, 0xfa, 0x81, 0xf1, 0x56, 0xfa, 0x89, 0xf5,
+  0x11, 0xf8, 0x0c, 0x10, 0x56, 0xfa, 0x83, 0xf7, 0x36, 0x91, 0x15, 0xf8,
+  0x0c, 0x10, 0x3b, 0x91, 0x17, 0xf8, 0x0c, 0x90, 0xdd, 0xf8, 0xd4, 0xa0,
+  0xba, 0xf1, 0x09, 0x0f, 0xcd, 0xe9, 0x38, 0x40, 0x00, 0xf2, 0xe8, 0x80,
+  0x2c, 0x9e, 0x84, 0xea, 0x08, 0x03, 0x84, 0xea, 0x06, 0x01, 0x83, 0xea,
+  0x02, 0x07, 0x1d, 0x46, 0x26, 0x93, 0x87, 0xea, 0x41, 0x03, 0x4f, 0xf0,
+  0x1b, 0x0a, 0x49, 0xb2, 0x82, 0xea, 0x06, 0x04, 0x0a, 0xea, 0xd1, 0x11,
+  0x84, 0x46, 0x60, 0xb2, 0xcd, 0xf8, 0xa0, 0x90, 0x59, 0x40, 0x0a, 0xea,
+  0xd0, 0x10, 0xdd, 0xf8, 0xe8, 0x90, 0x33, 0x91, 0x80, 0xea, 0x44, 0x00,
+  0x88, 0xea, 0x02, 0x01, 0x85, 0xea, 0x06, 0x03, 0x87, 0xea, 0x06, 0x02,
+  0x30, 0x92, 0x58, 0x40, 0x2f, 0x90, 0x88, 0xea, 0x41, 0x00, 0x49, 0xb2,
+  0x2d, 0x9e, 0x8c, 0xea, 0x06, 0x03, 0x8c, 0xea, 0x0e, 0x07, 0x0a, 0xea,
+  0xd1, 0x11, 0x87, 0xea, 0x0b, 0x0c, 0x48, 0x40, 0x31, 0x90, 0x59, 0xb2,
+  0x8c, 0xea, 0x43, 0x00, 0x0a, 0xea, 0xd1, 0x11, 0x8b, 0xea, 0x06, 0x03,
+  0x5c, 0xb2, 0x48, 0x40, 0x2c, 0x90, 0x0a, 0xea, 0xd4, 0x10, 0x80, 0xea,
+  0x43, 0x00, 0x8e, 0xea, 0x0b, 0x01, 0x87, 0xea, 0x06, 0x03, 0x8c, 0xea,
+  0x06, 0x02, 0x25, 0x92, 0x58, 0x40, 0x2d, 0x90, 0x8e, 0xea, 0x41, 0x0c,
+  0x49, 0xb2, 0x32, 0x98, 0x3c, 0x9a, 0x89, 0xea, 0x00, 0x04, 0x89, 0xea,
+  0x02, 0x08, 0x0a, 0xea, 0xd1, 0x11, 0x34, 0x9e, 0x81, 0xea, 0x0c, 0x01,
+  0x88, 0xea, 0x06, 0x03, 0x24, 0x91, 0x83, 0xea, 0x44, 0x0c, 0x86, 0xea,
+  0x00, 0x01, 0x64, 0xb2, 0xdd, 0xf8, 0xd8, 0xe0, 0x0a, 0xea, 0xd4, 0x19,
+  0x83, 0xea, 0x00, 0x0b, 0x4c, 0xb2, 0x8c, 0xea, 0x09, 0x05, 0x0a, 0xea,
+  0xd4, 0x14, 0x27, 0x95, 0x84, 0xea, 0x41, 0x01, 0x82, 0xea, 0x06, 0x04,
+  0x88, 0xea, 0x00, 0x06, 0x81, 0xea, 0x06, 0x00, 0x34, 0x90, 0x82, 0xea,
+  0x44, 0x0c, 0x37, 0x9a, 0x64, 0xb2, 0x3b, 0x99, 0x28, 0x98, 0x81, 0xea,
+  0x02, 0x06, 0x41, 0x40, 0x0a, 0xea, 0xd4, 0x14, 0x81, 0xea, 0x0e, 0x03,
+  0x8c, 0xea, 0x04, 0x05, 0x8e, 0xea, 0x02, 0x04, 0x83, 0xea, 0x46, 0x09,
+  0x76, 0xb2, 0x8e, 0xea, 0x00, 0x0e, 0x4f, 0xfa, 0x84, 0xfc, 0x0a, 0xea,
+  0xd6, 0x16, 0x0a, 0xea, 0xdc, 0x1c, 0x32, 0x95, 0x89, 0xea, 0x06, 0x05,
+  0x3c, 0x95, 0x8c, 0xea, 0x44, 0x09, 0x83, 0xea, 0x02, 0x0c, 0x80, 0xea,
+  0x4e, 0x04, 0x81, 0xea, 0x02, 0x06, 0x4f, 0xfa, 0x8e, 0xf0, 0x26, 0x9b,
+  0x0a, 0xea, 0xd0, 0x12, 0x38, 0x98, 0x89, 0xea, 0x06, 0x0e, 0x62, 0x40,
+  0x80, 0xea, 0x43, 0x06, 0x39, 0x98, 0x5d, 0xb2, 0x82, 0xea, 0x0c, 0x09,
+  0x0a, 0xea, 0xd5, 0x15, 0x6e, 0x40, 0x80, 0xea, 0x47, 0x05, 0xdd, 0xe9,
+  0x30, 0x30, 0x58, 0x40, 0x31, 0x90, 0x5e, 0x40, 0x38, 0x96, 0x7f, 0xb2,
+  0xdd, 0xe9, 0x24, 0x03, 0x0a, 0xea, 0xd7, 0x17, 0x58, 0x40, 0x30, 0x90,
+  0x6f, 0x40, 0x3a, 0x98, 0x5f, 0x40, 0x39, 0x97, 0x80, 0xea, 0x48, 0x06,
+  0x3b, 0x9b, 0x4f, 0xfa, 0x88, 0xf0, 0x0a, 0xea, 0xd0, 0x10, 0x70, 0x40,
+  0x83, 0xea, 0x41, 0x07, 0x49, 0xb2, 0x80, 0xea, 0x0b, 0x00, 0x0a, 0xea,
+  0xd1, 0x11, 0x32, 0x9b, 0x3a, 0x90, 0x87, 0xea, 0x01, 0x00, 0x80, 0xea,
+  0x0c, 0x00, 0x3b, 0x90, 0x83, 0xea, 0x0b, 0x05, 0xdd, 0xf8, 0xd4, 0xa0,
+  0x27, 0x9e, 0x3c, 0x98, 0x2f, 0x9a, 0xdd, 0xe9, 0x33, 0x3c, 0xdd, 0xe9,
+  0x2c, 0x7b, 0xcd, 0xe9, 0x36, 0xe0, 0x07, 0xe0, 0xcd, 0xe9, 0x30, 0xe8,
+  0x3c, 0x9d, 0x32, 0x9e, 0xdd, 0xf8, 0xd0, 0xc0, 0xdd, 0xe9, 0x2c, 0x37,
+  0x44, 0xf2, 0x5f, 0x00, 0x2e, 0x9c, 0x20, 0x44, 0x2a, 0x99, 0x88, 0x42,
+  0x00, 0xf2, 0x8b, 0x80, 0x3c, 0x95, 0xbe, 0x46, 0x29, 0x9d, 0xc8, 0x46,
+  0x2f, 0x19, 0xe1, 0x46, 0x0a, 0xf1, 0x01, 0x0a, 0x38, 0x7a, 0xf9, 0x79,
+  0x58, 0x40, 0x34, 0x90, 0x82, 0xea, 0x01, 0x00, 0x33, 0x90, 0xb8, 0x79,
+  0x31, 0x9a, 0x79, 0x79, 0x3b, 0x79, 0x50, 0x40, 0x32, 0x90, 0xf8, 0x78,
+  0x38, 0x9a, 0x51, 0x40, 0x38, 0x91, 0x80, 0xea, 0x0b, 0x00, 0x31, 0x90,
+  0xb8, 0x78, 0x8e, 0xea, 0x03, 0x0c, 0x30, 0x9b, 0x79, 0x78, 0x58, 0x40,
+  0x30, 0x90, 0x17, 0xf8, 0x01, 0x0c, 0x39, 0x9b, 0x2a, 0x5d, 0x59, 0x40,
+  0x39, 0x91, 0x89, 0xea, 0x00, 0x0e, 0x17, 0xf8, 0x02, 0x0c, 0x3c, 0x9d,
+  0x86, 0xea, 0x02, 0x01, 0x17, 0xf8, 0x03, 0x2c, 0x68, 0x40, 0x2f, 0x90,
+  0x17, 0xf8, 0x04, 0x3c, 0x3a, 0x9e, 0x17, 0xf8, 0x05, 0x0c, 0x86, 0xea,
+  0x02, 0x05, 0x37, 0x9a, 0x10, 0x34, 0x82, 0xea, 0x03, 0x0b, 0x36, 0x9a,
+  0x50, 0x40, 0x17, 0xf8, 0x06, 0x2c, 0x17, 0xf8, 0x07, 0x3c, 0xa0, 0x2c,
+  0x88, 0xea, 0x02, 0x07, 0x3b, 0x9a, 0x82, 0xea, 0x03, 0x09, 0x7f, 0xf4,
+  0x5b, 0xae, 0x22, 0x9a, 0x2b, 0x9c, 0x34, 0x9b, 0xa3, 0x54, 0x11, 0x9a,
+  0x33, 0x9b, 0xa3, 0x54, 0x10, 0x9a, 0x32, 0x9b, 0xa3, 0x54, 0x0f, 0x9a,
+  0x38, 0x9b, 0xa3, 0x54, 0x0e, 0x9a, 0x31, 0x9b, 0x04, 0xf8, 0x02, 0xc0,
+  0x0d, 0x9a, 0xa3, 0x54, 0x0c, 0x9a, 0x30, 0x9b, 0xa3, 0x54, 0x0b, 0x9a,
+  0x39, 0x9b, 0xa3, 0x54, 0x0a, 0x9a, 0xa1, 0x54, 0x09, 0x99, 0x2f, 0x9a,
+  0x04, 0xf8, 0x01, 0xe0, 0x08, 0x99, 0x62, 0x54, 0x07, 0x99, 0x43, 0xf2,
+  0x7f, 0x62, 0x65, 0x54, 0x06, 0x99, 0x04, 0xf8, 0x01, 0xb0, 0x05, 0x99,
+  0x60, 0x54, 0x04, 0x99, 0x23, 0x98, 0x01, 0x30, 0x67, 0x54, 0x03, 0x99,
+  0x10, 0x28, 0x04, 0xf8, 0x01, 0x90, 0x7f, 0xf4, 0x9d, 0xad, 0x01, 0x98,
+  0x00, 0x99, 0x01, 0x30, 0x01, 0x90, 0x88, 0x42, 0x7f, 0xf4, 0x95, 0xad,
+  0x3d, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x02, 0x98, 0x3d, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0,
+  0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x89, 0x6b,
+  0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42,
+  0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21,
+  0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9,
+  0xf0, 0x43, 0x81, 0xb0, 0xd0, 0xf8, 0x78, 0x11, 0x43, 0xf2, 0x71, 0x6c,
+  0x40, 0xf2, 0x93, 0x1e, 0x01, 0xeb, 0x0c, 0x02, 0x49, 0xf6, 0xc5, 0x51,
+  0xc0, 0xf2, 0x00, 0x1e, 0xd0, 0xf8, 0xa8, 0x31, 0xc8, 0xf2, 0x1c, 0x11,
+  0x00, 0x24, 0x43, 0xf2, 0x70, 0x65, 0x43, 0xf2, 0x72, 0x69, 0x43, 0xf2,
+  0x73, 0x68, 0x67, 0x19, 0x9f, 0x42, 0x9c, 0xbf, 0x04, 0xeb, 0x0c, 0x07,
+  0x9f, 0x42, 0x21, 0xd8, 0x04, 0xeb, 0x09, 0x07, 0x9f, 0x42, 0x9c, 0xbf,
+  0x04, 0xeb, 0x08, 0x07, 0x9f, 0x42, 0x19, 0xd8, 0x17, 0x19, 0x17, 0xf8,
+  0x01, 0x6c, 0x71, 0x40, 0x16, 0x5d, 0x01, 0xfb, 0x0e, 0xf1, 0x04, 0x34,
+  0xb4, 0xf5, 0x80, 0x7f, 0x81, 0xea, 0x06, 0x01, 0x7e, 0x78, 0x01, 0xfb,
+  0x0e, 0xf1, 0x81, 0xea, 0x06, 0x01, 0xbe, 0x78, 0x01, 0xfb, 0x0e, 0xf1,
+  0x81, 0xea, 0x06, 0x01, 0x01, 0xfb, 0x0e, 0xf1, 0xd7, 0xd1, 0x03, 0xe0,
+  0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0,
+  0xbd, 0xe8, 0xf0, 0x83, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01,
+  0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0xc9, 0x6b, 0x52, 0x1a, 0x01, 0x46,
+  0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff,
+  0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x82, 0xb0, 0xd0, 0xf8,
+  0x78, 0x71, 0x43, 0xf2, 0x70, 0x73, 0xd0, 0xf8, 0xc0, 0x21, 0x05, 0x21,
+  0xf9, 0x50, 0x00, 0x23, 0x43, 0xf2, 0x98, 0x7b, 0x43, 0xf2, 0xb8, 0x79,
+  0x43, 0xf6, 0x38, 0x0a, 0x43, 0xf6, 0x58, 0x08, 0x4f, 0xf0, 0x00, 0x0e,
+  0x43, 0xf2, 0xd8, 0x76, 0x00, 0x90, 0x01, 0x97, 0x0e, 0xeb, 0x0b, 0x07,
+  0x97, 0x42, 0x00, 0xf2, 0xdc, 0x80, 0x01, 0x98, 0x0e, 0xeb, 0x09, 0x0c,
+  0x00, 0xeb, 0x0e, 0x07, 0x43, 0xf2, 0x98, 0x70, 0x3c, 0x18, 0x43, 0xf2,
+  0x98, 0x7b, 0x3b, 0x50, 0x43, 0xf2, 0x90, 0x70, 0x63, 0x60, 0x3c, 0x18,
+  0x3b, 0x50, 0x43, 0xf2, 0x88, 0x70, 0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50,
+  0x4f, 0xf4, 0x5e, 0x50, 0x63, 0x60, 0x07, 0xf5, 0x5e, 0x54, 0x94, 0x45,
+  0x43, 0xf2, 0xf8, 0x71, 0x43, 0xf6, 0x18, 0x0c, 0x3b, 0x50, 0x63, 0x60,
+  0x00, 0xf2, 0xb9, 0x80, 0x43, 0xf2, 0xb8, 0x70, 0x43, 0xf2, 0xa0, 0x75,
+  0x3c, 0x18, 0x43, 0xf2, 0xb8, 0x79, 0x3b, 0x50, 0x43, 0xf2, 0xb0, 0x70,
+  0x63, 0x60, 0x3c, 0x18, 0x3b, 0x50, 0x43, 0xf2, 0xa8, 0x70, 0x63, 0x60,
+  0x3c, 0x18, 0x3b, 0x50, 0x0e, 0xeb, 0x06, 0x00, 0x63, 0x60, 0x7c, 0x19,
+  0x90, 0x42, 0x7b, 0x51, 0x63, 0x60, 0x00, 0xf2, 0x9e, 0x80, 0xb8, 0x19,
+  0x43, 0xf2, 0xd0, 0x75, 0x0e, 0xeb, 0x01, 0x04, 0xbb, 0x51, 0x43, 0x60,
+  0x78, 0x19, 0x7b, 0x51, 0x43, 0xf2, 0xc8, 0x75, 0x43, 0x60, 0x78, 0x19,
+  0x7b, 0x51, 0x4f, 0xf4, 0x5f, 0x55, 0x43, 0x60, 0x07, 0xf5, 0x5f, 0x50,
+  0x94, 0x42, 0x7b, 0x51, 0x43, 0x60, 0x00, 0xf2, 0x86, 0x80, 0x78, 0x18,
+  0x43, 0xf2, 0xf0, 0x75, 0x0e, 0xeb, 0x0c, 0x04, 0x7b, 0x50, 0x43, 0x60,
+  0x78, 0x19, 0x7b, 0x51, 0x43, 0xf2, 0xe8, 0x75, 0x43, 0x60, 0x78, 0x19,
+  0x7b, 0x51, 0x43, 0xf2, 0xe0, 0x75, 0x43, 0x60, 0x78, 0x19, 0x94, 0x42,
+  0x7b, 0x51, 0x43, 0x60, 0x6f, 0xd8, 0x07, 0xeb, 0x0c, 0x00, 0x43, 0xf6,
+  0x10, 0x05, 0x0e, 0xeb, 0x0a, 0x04, 0x47, 0xf8, 0x0c, 0x30, 0x43, 0x60,
+  0x78, 0x19, 0x7b, 0x51, 0x43, 0xf6, 0x08, 0x05, 0x43, 0x60, 0x78, 0x19,
+  0x7b, 0x51, 0x4f, 0xf4, 0x60, 0x55, 0x43, 0x60, 0x07, 0xf5, 0x60, 0x50,
+  0x94, 0x42, 0x7b, 0x51, 0x43, 0x60, 0x56, 0xd8, 0x43, 0xf6, 0x38, 0x05,
+  0x0e, 0xeb, 0x08, 0x04, 0x78, 0x19, 0x43, 0xf6, 0x38, 0x0a, 0x7b, 0x51,
+  0x43, 0xf6, 0x30, 0x05, 0x43, 0x60, 0x78, 0x19, 0x7b, 0x51, 0x43, 0xf6,
+  0x28, 0x05, 0x43, 0x60, 0x78, 0x19, 0x7b, 0x51, 0x43, 0xf6, 0x20, 0x05,
+  0x43, 0x60, 0x78, 0x19, 0x94, 0x42, 0x7b, 0x51, 0x43, 0x60, 0x3c, 0xd8,
+  0x43, 0xf6, 0x58, 0x05, 0x43, 0xf6, 0x50, 0x01, 0x78, 0x19, 0x43, 0xf6,
+  0x58, 0x08, 0x7b, 0x50, 0x43, 0x60, 0x78, 0x18, 0x43, 0xf6, 0x48, 0x01,
+  0x7b, 0x51, 0x43, 0x60, 0x78, 0x18, 0x7b, 0x50, 0x43, 0xf6, 0x78, 0x01,
+  0x43, 0x60, 0x07, 0xf5, 0x61, 0x50, 0x0e, 0xeb, 0x01, 0x04, 0x4f, 0xf4,
+  0x61, 0x51, 0x94, 0x42, 0x43, 0x60, 0x7b, 0x50, 0x1f, 0xd8, 0x43, 0xf6,
+  0x78, 0x01, 0x0e, 0xf5, 0x80, 0x7e, 0x78, 0x18, 0xbe, 0xf5, 0x80, 0x6f,
+  0x7b, 0x50, 0x43, 0xf6, 0x70, 0x01, 0x43, 0x60, 0x07, 0xeb, 0x01, 0x00,
+  0x7b, 0x50, 0x43, 0xf6, 0x68, 0x01, 0x43, 0x60, 0x07, 0xeb, 0x01, 0x00,
+  0x7b, 0x50, 0x43, 0xf6, 0x60, 0x01, 0x43, 0x60, 0x07, 0xeb, 0x01, 0x00,
+  0x7b, 0x50, 0x43, 0x60, 0x7f, 0xf4, 0x22, 0xaf, 0x02, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x02, 0x21, 0x5d, 0xf8, 0x08, 0x0b, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02,
+  0x01, 0xab, 0xc0, 0xf2, 0x00, 0x02, 0x12, 0x6c, 0x9a, 0x1a, 0x06, 0xd3,
+  0x03, 0x69, 0x9a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40,
+  0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x81, 0xb0, 0x01, 0x29, 0x4b, 0xdb,
+  0xd0, 0xf8, 0x08, 0xa0, 0x80, 0x46, 0x4f, 0xf2, 0x5f, 0x34, 0x46, 0xf2,
+  0x0d, 0x65, 0xda, 0xf8, 0x78, 0x71, 0x43, 0xf2, 0x70, 0x70, 0x89, 0x46,
+  0xda, 0xf8, 0xb8, 0x61, 0xc3, 0xf6, 0x6e, 0x44, 0xc0, 0xf2, 0x19, 0x05,
+  0x07, 0xeb, 0x00, 0x0c, 0x4f, 0xf0, 0x00, 0x0b, 0xdc, 0xf8, 0x00, 0x10,
+  0x4f, 0xf4, 0x5e, 0x50, 0xb0, 0x42, 0x32, 0xd8, 0x02, 0x1d, 0x01, 0xfb,
+  0x05, 0x41, 0xb2, 0x42, 0x39, 0x50, 0x2c, 0xd8, 0x3a, 0x18, 0x00, 0xf1,
+  0x08, 0x03, 0x01, 0xfb, 0x05, 0x41, 0xb3, 0x42, 0x51, 0x60, 0x24, 0xd8,
+  0x00, 0xf1, 0x0c, 0x03, 0x01, 0xfb, 0x05, 0x41, 0xb3, 0x42, 0x91, 0x60,
+  0x1d, 0xd8, 0x10, 0x30, 0x01, 0xfb, 0x05, 0x41, 0xb0, 0xf5, 0x6e, 0x5f,
+  0xd1, 0x60, 0xe1, 0xd1, 0xcc, 0xf8, 0x00, 0x10, 0x4f, 0xf4, 0x5e, 0x51,
+  0x4f, 0xf4, 0x80, 0x72, 0x40, 0x46, 0xcd, 0xf8, 0x00, 0xc0, 0xff, 0xf7,
+  0xfe, 0xff, 0x9a, 0xf8, 0x68, 0x00, 0xdd, 0xf8, 0x00, 0xc0, 0x18, 0xb9,
+  0x0b, 0xf1, 0x01, 0x0b, 0xcb, 0x45, 0xc9, 0xd1, 0x01, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x02, 0x21, 0x50, 0x46, 0x01, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f,
+  0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x03,
+  0xc0, 0xf2, 0x00, 0x03, 0xd3, 0xf8, 0x44, 0xc0, 0x01, 0xab, 0xb3, 0xeb,
+  0x0c, 0x0c, 0x06, 0xd3, 0x03, 0x69, 0x9c, 0x45, 0x03, 0xd3, 0x02, 0xb0,
+  0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x80, 0x68, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x89, 0xb0,
+  0x83, 0x68, 0x11, 0x2a, 0x08, 0x91, 0xd3, 0xf8, 0x78, 0xb1, 0x06, 0x93,
+  0xd3, 0xf8, 0xb8, 0x91, 0xcd, 0xf8, 0x1c, 0xb0, 0x07, 0xda, 0x90, 0x46,
+  0xb8, 0xf1, 0x02, 0x0f, 0x80, 0xf2, 0xed, 0x80, 0x09, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x8f, 0x03, 0x90, 0xab, 0xf1, 0x04, 0x00, 0x05, 0x90, 0xab, 0xf1,
+  0x08, 0x00, 0x04, 0x90, 0x6f, 0xf0, 0x02, 0x00, 0x08, 0x99, 0x00, 0xea,
+  0x42, 0x00, 0x08, 0x44, 0x48, 0x45, 0x00, 0xf2, 0x05, 0x81, 0xdd, 0xf8,
+  0x1c, 0xb0, 0xa2, 0xf1, 0x01, 0x0e, 0x00, 0x24, 0x5b, 0xf8, 0x00, 0x80,
+  0x05, 0x98, 0xa5, 0x00, 0x0b, 0xeb, 0x84, 0x01, 0x23, 0x46, 0x00, 0xeb,
+  0x84, 0x06, 0x08, 0x98, 0x44, 0x19, 0x4c, 0x45, 0x00, 0xf2, 0xf2, 0x80,
+  0x08, 0x98, 0x0f, 0x58, 0x47, 0x45, 0x23, 0xd2, 0x20, 0x1d, 0x48, 0x45,
+  0x00, 0xf2, 0xea, 0x80, 0x08, 0x98, 0x08, 0x44, 0x47, 0x68, 0x47, 0x45,
+  0x21, 0xd2, 0x04, 0xf1, 0x08, 0x07, 0x4f, 0x45, 0x00, 0xf2, 0xe0, 0x80,
+  0x87, 0x68, 0x47, 0x45, 0x1e, 0xd2, 0x04, 0xf1, 0x0c, 0x07, 0x4f, 0x45,
+  0x00, 0xf2, 0xd8, 0x80, 0xc7, 0x68, 0x10, 0x36, 0x10, 0x35, 0x47, 0x45,
+  0x01, 0xf1, 0x10, 0x01, 0x03, 0xf1, 0x04, 0x03, 0xd7, 0xd3, 0x58, 0x1e,
+  0x02, 0x90, 0x08, 0x98, 0x30, 0x44, 0x0f, 0xe0, 0x02, 0x93, 0x58, 0x1c,
+  0x08, 0x9b, 0x19, 0x44, 0x03, 0x46, 0x01, 0x91, 0x09, 0xe0, 0x59, 0x1c,
+  0x02, 0x91, 0x02, 0x33, 0x04, 0x30, 0x03, 0xe0, 0x99, 0x1c, 0x02, 0x91,
+  0x03, 0x33, 0x08, 0x30, 0x01, 0x90, 0x07, 0x98, 0x4f, 0xea, 0x8e, 0x0c,
+  0x05, 0x9c, 0x00, 0xeb, 0x8e, 0x05, 0x04, 0x98, 0x04, 0xeb, 0x8e, 0x0b,
+  0x00, 0xeb, 0x8e, 0x01, 0x0e, 0xf1, 0x01, 0x00, 0x86, 0x46, 0x08, 0x98,
+  0x60, 0x44, 0x48, 0x45, 0x00, 0xf2, 0xa6, 0x80, 0x08, 0x9c, 0x0b, 0xeb,
+  0x04, 0x0a, 0xda, 0xf8, 0x04, 0x60, 0x46, 0x45, 0x27, 0xd9, 0x04, 0x38,
+  0x48, 0x45, 0x00, 0xf2, 0x9b, 0x80, 0x08, 0x9c, 0x5b, 0xf8, 0x04, 0x60,
+  0x46, 0x45, 0x26, 0xd9, 0x04, 0x38, 0x48, 0x45, 0x00, 0xf2, 0x92, 0x80,
+  0x5a, 0xf8, 0x04, 0x6c, 0x46, 0x45, 0x23, 0xd9, 0x04, 0x38, 0x48, 0x45,
+  0x00, 0xf2, 0x8a, 0x80, 0x5a, 0xf8, 0x08, 0x6c, 0x10, 0x3d, 0x10, 0x39,
+  0xae, 0xf1, 0x04, 0x0e, 0x46, 0x45, 0xab, 0xf1, 0x10, 0x0b, 0xac, 0xf1,
+  0x10, 0x0c, 0xd2, 0xd8, 0x08, 0x98, 0xae, 0xf1, 0x01, 0x0c, 0x28, 0x44,
+  0x00, 0xf1, 0x04, 0x0a, 0x14, 0xe0, 0x08, 0x99, 0xae, 0xf1, 0x01, 0x00,
+  0xae, 0xf1, 0x02, 0x0c, 0x05, 0xeb, 0x01, 0x0a, 0x0b, 0xe0, 0xae, 0xf1,
+  0x02, 0x00, 0xae, 0xf1, 0x03, 0x0c, 0x06, 0xe0, 0x08, 0x9d, 0xae, 0xf1,
+  0x03, 0x00, 0xae, 0xf1, 0x04, 0x0c, 0x01, 0xeb, 0x05, 0x0a, 0x86, 0x46,
+  0x02, 0x9c, 0xdd, 0xf8, 0x1c, 0xb0, 0x74, 0x45, 0x05, 0xdc, 0x01, 0x98,
+  0xe6, 0x46, 0x1c, 0x46, 0x06, 0x60, 0xca, 0xf8, 0x00, 0x70, 0x74, 0x45,
+  0x7f, 0xf7, 0x56, 0xaf, 0x0e, 0xf1, 0x01, 0x08, 0x15, 0x1b, 0xa8, 0x45,
+  0x10, 0xda, 0x03, 0x98, 0x08, 0x99, 0x42, 0x46, 0xff, 0xf7, 0xfe, 0xff,
+  0x06, 0x98, 0x90, 0xf8, 0x68, 0x00, 0x00, 0x28, 0x7f, 0xf4, 0x2c, 0xaf,
+  0x08, 0x98, 0xa8, 0x46, 0x00, 0xeb, 0x84, 0x00, 0x08, 0x90, 0x0c, 0xe0,
+  0x08, 0x98, 0x2a, 0x46, 0x00, 0xeb, 0x84, 0x01, 0x03, 0x98, 0xff, 0xf7,
+  0xfe, 0xff, 0x06, 0x98, 0x90, 0xf8, 0x68, 0x00, 0x00, 0x28, 0x7f, 0xf4,
+  0x19, 0xaf, 0xb8, 0xf1, 0x10, 0x0f, 0x42, 0x46, 0x3f, 0xf7, 0x1e, 0xaf,
+  0x0e, 0xe7, 0x0b, 0xf1, 0x04, 0x00, 0x01, 0x21, 0x02, 0x25, 0x08, 0x9c,
+  0x08, 0x9a, 0x02, 0xeb, 0x81, 0x02, 0x4a, 0x45, 0x20, 0xd8, 0x07, 0x9b,
+  0x9e, 0x58, 0x2a, 0x46, 0x23, 0x46, 0x4b, 0x45, 0x1a, 0xd8, 0xc7, 0x18,
+  0x01, 0x3a, 0x57, 0xf8, 0x04, 0x7c, 0xb7, 0x42, 0x05, 0xd9, 0x01, 0x2a,
+  0xc7, 0x50, 0xa3, 0xf1, 0x04, 0x03, 0xf2, 0xdc, 0x00, 0x22, 0x08, 0x9b,
+  0x03, 0xeb, 0x82, 0x02, 0x4a, 0x45, 0x09, 0xd8, 0x01, 0x31, 0x07, 0x9b,
+  0x41, 0x45, 0x04, 0xf1, 0x04, 0x04, 0x05, 0xf1, 0x01, 0x05, 0x9e, 0x50,
+  0xda, 0xd1, 0xe7, 0xe6, 0x02, 0x21, 0x06, 0x98, 0x09, 0xb0, 0xbd, 0xe8,
+  0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0x89, 0x6c, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd, 0xf0, 0xb5, 0x81, 0xb0,
+  0xd0, 0xf8, 0x78, 0x71, 0x4f, 0xf4, 0x5e, 0x51, 0xd0, 0xf8, 0xb8, 0x21,
+  0x43, 0xf2, 0x84, 0x73, 0x57, 0xf8, 0x01, 0xe0, 0x43, 0xf2, 0x8c, 0x71,
+  0x39, 0x44, 0x74, 0x46, 0x93, 0x42, 0x00, 0xf2, 0xdd, 0x80, 0x51, 0xf8,
+  0x08, 0x5c, 0xac, 0x42, 0x00, 0xf2, 0xdf, 0x80, 0x1e, 0x1d, 0x96, 0x42,
+  0x00, 0xf2, 0xd4, 0x80, 0x51, 0xf8, 0x04, 0x4c, 0xa5, 0x42, 0x00, 0xf2,
+  0xd6, 0x80, 0x03, 0xf1, 0x08, 0x06, 0x96, 0x42, 0x00, 0xf2, 0xca, 0x80,
+  0x0d, 0x68, 0xac, 0x42, 0x00, 0xf2, 0xcd, 0x80, 0x03, 0xf1, 0x0c, 0x06,
+  0x96, 0x42, 0x00, 0xf2, 0xc1, 0x80, 0x4e, 0x68, 0xb5, 0x42, 0x00, 0xf2,
+  0xc4, 0x80, 0x03, 0xf1, 0x10, 0x05, 0x95, 0x42, 0x00, 0xf2, 0xb8, 0x80,
+  0x8c, 0x68, 0xa6, 0x42, 0x00, 0xf2, 0xbb, 0x80, 0x14, 0x33, 0x14, 0x31,
+  0xb3, 0xf5, 0x6e, 0x5f, 0xce, 0xd1, 0x49, 0xf6, 0xc5, 0x53, 0x40, 0xf2,
+  0x93, 0x1c, 0x5f, 0xfa, 0x8e, 0xf1, 0xc8, 0xf2, 0x1c, 0x13, 0xc0, 0xf2,
+  0x00, 0x1c, 0x59, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xce, 0xf3, 0x07, 0x23,
+  0x59, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xce, 0xf3, 0x07, 0x43, 0x59, 0x40,
+  0x43, 0xf2, 0x8c, 0x73, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x1e, 0x61,
+  0x07, 0xeb, 0x03, 0x0e, 0x01, 0xfb, 0x0c, 0xf1, 0x43, 0xf2, 0x84, 0x73,
+  0x93, 0x42, 0x00, 0xf2, 0x8b, 0x80, 0x1c, 0x1d, 0x94, 0x42, 0x9c, 0xbf,
+  0x03, 0xf1, 0x08, 0x04, 0x94, 0x42, 0x00, 0xf2, 0x83, 0x80, 0x03, 0xf1,
+  0x0c, 0x04, 0x94, 0x42, 0x9c, 0xbf, 0x03, 0xf1, 0x10, 0x04, 0x94, 0x42,
+  0x7a, 0xd8, 0x5e, 0xf8, 0x08, 0x4c, 0x14, 0x33, 0xe5, 0xb2, 0xb3, 0xf5,
+  0x6e, 0x5f, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3,
+  0x07, 0x25, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3,
+  0x07, 0x45, 0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea,
+  0x14, 0x61, 0x5e, 0xf8, 0x04, 0x4c, 0x01, 0xfb, 0x0c, 0xf1, 0xe5, 0xb2,
+  0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x25,
+  0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x45,
+  0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x14, 0x61,
+  0xde, 0xf8, 0x00, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xe5, 0xb2, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x25, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x45, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x14, 0x61, 0xde, 0xf8,
+  0x04, 0x40, 0x01, 0xfb, 0x0c, 0xf1, 0xe5, 0xb2, 0x81, 0xea, 0x05, 0x01,
+  0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x25, 0x81, 0xea, 0x05, 0x01,
+  0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x45, 0x81, 0xea, 0x05, 0x01,
+  0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x14, 0x61, 0xde, 0xf8, 0x08, 0x40,
+  0x01, 0xfb, 0x0c, 0xf1, 0x0e, 0xf1, 0x14, 0x0e, 0xe5, 0xb2, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x25, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xc4, 0xf3, 0x07, 0x45, 0x81, 0xea,
+  0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0x81, 0xea, 0x14, 0x61, 0x01, 0xfb,
+  0x0c, 0xf1, 0x7f, 0xf4, 0x73, 0xaf, 0x03, 0xe0, 0x02, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x00, 0x21, 0x08, 0x46, 0x01, 0xb0, 0xf0, 0xbd, 0x00, 0x21,
+  0x08, 0x46, 0x01, 0xb0, 0xf0, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2,
+  0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01, 0xc9, 0x6c, 0x52, 0x1a,
+  0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69, 0x8a, 0x42, 0x03, 0xd3,
+  0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7,
+  0xfe, 0xff, 0x02, 0xb0, 0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x47, 0xd0, 0xf8,
+  0x78, 0x21, 0x4f, 0xf4, 0x6e, 0x57, 0x02, 0xf5, 0x6e, 0x53, 0xd0, 0xf8,
+  0xb0, 0x11, 0x01, 0x26, 0xd6, 0x55, 0x43, 0xf6, 0x20, 0x47, 0x1e, 0x74,
+  0xb9, 0x42, 0x1e, 0x75, 0x83, 0xf8, 0x20, 0x60, 0x83, 0xf8, 0x28, 0x60,
+  0x83, 0xf8, 0x30, 0x60, 0x83, 0xf8, 0x34, 0x60, 0x83, 0xf8, 0x40, 0x60,
+  0x83, 0xf8, 0x50, 0x60, 0x83, 0xf8, 0x60, 0x60, 0x83, 0xf8, 0x64, 0x60,
+  0x83, 0xf8, 0x70, 0x60, 0x83, 0xf8, 0x78, 0x60, 0x83, 0xf8, 0x80, 0x60,
+  0x83, 0xf8, 0x84, 0x60, 0x83, 0xf8, 0x90, 0x60, 0x04, 0xd2, 0x02, 0x21,
+  0xbd, 0xe8, 0xf0, 0x47, 0xff, 0xf7, 0xfe, 0xbf, 0x4f, 0xf2, 0x5f, 0x3e,
+  0x46, 0xf2, 0x0d, 0x63, 0x43, 0xf6, 0x24, 0x4c, 0x45, 0xf2, 0xad, 0x76,
+  0xc3, 0xf6, 0x6e, 0x4e, 0xc0, 0xf2, 0x19, 0x03, 0x62, 0x44, 0xc3, 0xf6,
+  0x07, 0x56, 0x00, 0x24, 0x43, 0xf6, 0x22, 0x4a, 0x43, 0xf6, 0x26, 0x49,
+  0x43, 0xf6, 0x28, 0x48, 0x17, 0x19, 0x04, 0xeb, 0x0a, 0x05, 0x8d, 0x42,
+  0x4f, 0xea, 0x16, 0x45, 0x27, 0xf8, 0x04, 0x5c, 0xdb, 0xd8, 0x06, 0xfb,
+  0x03, 0xe6, 0x04, 0xeb, 0x0c, 0x05, 0x8d, 0x42, 0x4f, 0xea, 0x16, 0x45,
+  0x27, 0xf8, 0x02, 0x5c, 0xd1, 0xd8, 0x06, 0xfb, 0x03, 0xe6, 0xb4, 0xf5,
+  0x06, 0x7f, 0x4f, 0xea, 0x16, 0x45, 0x15, 0x53, 0x11, 0xd0, 0x04, 0xeb,
+  0x09, 0x05, 0x8d, 0x42, 0xc5, 0xd8, 0x06, 0xfb, 0x03, 0xe5, 0x04, 0xeb,
+  0x08, 0x06, 0x8e, 0x42, 0x04, 0xf1, 0x08, 0x04, 0x05, 0xfb, 0x03, 0xe6,
+  0x4f, 0xea, 0x15, 0x45, 0x7d, 0x80, 0xd3, 0xd9, 0xb7, 0xe7, 0xbd, 0xe8,
+  0xf0, 0x87, 0x80, 0xb5, 0x82, 0xb0, 0x40, 0xf2, 0x00, 0x02, 0x01, 0xab,
+  0xc0, 0xf2, 0x00, 0x02, 0x12, 0x6d, 0x9b, 0x1a, 0x02, 0x46, 0x80, 0x68,
+  0x06, 0xd3, 0x12, 0x69, 0x93, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8,
+  0x80, 0x40, 0x04, 0xe0, 0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x02, 0xb0,
+  0x80, 0xbd, 0x2d, 0xe9, 0xf0, 0x4f, 0x90, 0xb0, 0x01, 0x29, 0xc0, 0xf2,
+  0x02, 0x81, 0xd0, 0xf8, 0x78, 0x51, 0x02, 0x46, 0x05, 0xf5, 0x6e, 0x50,
+  0x0c, 0x46, 0x90, 0xf8, 0x90, 0x60, 0x90, 0xf8, 0x84, 0x10, 0x00, 0x2e,
+  0x18, 0xbf, 0x01, 0x26, 0x90, 0xf8, 0x80, 0x30, 0x00, 0x29, 0x18, 0xbf,
+  0x4f, 0xf4, 0x10, 0x61, 0x0f, 0x91, 0x00, 0x2b, 0x90, 0xf8, 0x78, 0x10,
+  0x18, 0xbf, 0x4f, 0xf4, 0x20, 0x63, 0x0e, 0x93, 0x90, 0xf8, 0x70, 0x30,
+  0x00, 0x29, 0x18, 0xbf, 0x4f, 0xf4, 0x30, 0x61, 0x0d, 0x91, 0x00, 0x2b,
+  0x90, 0xf8, 0x64, 0x10, 0x18, 0xbf, 0x4f, 0xf4, 0x40, 0x63, 0x0c, 0x93,
+  0x90, 0xf8, 0x60, 0x30, 0x00, 0x29, 0x18, 0xbf, 0x4f, 0xf4, 0x50, 0x61,
+  0x0b, 0x91, 0x00, 0x2b, 0x90, 0xf8, 0x50, 0x10, 0x18, 0xbf, 0x4f, 0xf4,
+  0x60, 0x63, 0x0a, 0x93, 0x90, 0xf8, 0x40, 0x30, 0x00, 0x29, 0x18, 0xbf,
+  0x4f, 0xf4, 0x70, 0x61, 0x09, 0x91, 0x00, 0x2b, 0x90, 0xf8, 0x34, 0x10,
+  0x18, 0xbf, 0x4f, 0xf4, 0x70, 0x63, 0x08, 0x93, 0x90, 0xf8, 0x30, 0x30,
+  0x00, 0x29, 0x18, 0xbf, 0x4f, 0xf4, 0x60, 0x61, 0x90, 0xf8, 0x28, 0xc0,
+  0x07, 0x91, 0x00, 0x2b, 0x43, 0xf6, 0x3e, 0x41, 0x18, 0xbf, 0x4f, 0xf4,
+  0x50, 0x63, 0x90, 0xf8, 0x20, 0x90, 0x06, 0x93, 0xbc, 0xf1, 0x00, 0x0f,
+  0x05, 0xeb, 0x01, 0x0b, 0x18, 0xbf, 0x4f, 0xf4, 0x40, 0x6c, 0x90, 0xf8,
+  0x14, 0x80, 0xb9, 0xf1, 0x00, 0x0f, 0x18, 0xbf, 0x4f, 0xf4, 0x30, 0x69,
+  0x90, 0xf8, 0x10, 0xe0, 0xb8, 0xf1, 0x00, 0x0f, 0x03, 0x78, 0x00, 0x90,
+  0x18, 0xbf, 0x4f, 0xf4, 0x20, 0x68, 0xbe, 0xf1, 0x00, 0x0f, 0x4f, 0xea,
+  0xc6, 0x20, 0x18, 0xbf, 0x4f, 0xf4, 0x10, 0x6e, 0x00, 0x2b, 0x05, 0x90,
+  0x18, 0xbf, 0x01, 0x23, 0xd8, 0x02, 0x04, 0x90, 0xd2, 0xf8, 0xb0, 0xa1,
+  0x28, 0x46, 0x00, 0x25, 0x47, 0xf6, 0xff, 0x76, 0x03, 0x92, 0x01, 0x94,
+  0x00, 0x27, 0x02, 0x95, 0x43, 0xf6, 0x3e, 0x41, 0x7b, 0x18, 0x53, 0x45,
+  0x7a, 0xd8, 0x0b, 0xeb, 0x07, 0x03, 0x3b, 0xf9, 0x07, 0x40, 0x0f, 0x9d,
+  0x33, 0xf9, 0x02, 0x2c, 0x05, 0x99, 0x6a, 0x43, 0x33, 0xf9, 0x04, 0x5c,
+  0x11, 0xfb, 0x04, 0x22, 0x33, 0xf9, 0x06, 0x4c, 0x0e, 0x99, 0x11, 0xfb,
+  0x05, 0x22, 0x33, 0xf9, 0x08, 0x5c, 0x0d, 0x99, 0x11, 0xfb, 0x04, 0x22,
+  0x33, 0xf9, 0x0a, 0x4c, 0x0c, 0x99, 0x11, 0xfb, 0x05, 0x22, 0x33, 0xf9,
+  0x0c, 0x5c, 0x0b, 0x99, 0x11, 0xfb, 0x04, 0x22, 0x33, 0xf9, 0x0e, 0x4c,
+  0x0a, 0x99, 0x11, 0xfb, 0x05, 0x22, 0x33, 0xf9, 0x10, 0x5c, 0x09, 0x99,
+  0x11, 0xfb, 0x04, 0x22, 0x33, 0xf9, 0x12, 0x4c, 0x08, 0x99, 0x11, 0xfb,
+  0x05, 0x22, 0x33, 0xf9, 0x14, 0x5c, 0x07, 0x99, 0x11, 0xfb, 0x04, 0x22,
+  0x33, 0xf9, 0x16, 0x4c, 0x06, 0x99, 0x11, 0xfb, 0x05, 0x22, 0x33, 0xf9,
+  0x18, 0x5c, 0x1c, 0xfb, 0x04, 0x22, 0x33, 0xf9, 0x1a, 0x4c, 0x19, 0xfb,
+  0x05, 0x22, 0x33, 0xf9, 0x1c, 0x5c, 0x18, 0xfb, 0x04, 0x22, 0x33, 0xf9,
+  0x1e, 0x3c, 0x1e, 0xfb, 0x05, 0x22, 0x04, 0x99, 0x11, 0xfb, 0x03, 0x22,
+  0x07, 0xf5, 0x79, 0x54, 0xd3, 0x13, 0x13, 0xf5, 0x00, 0x4f, 0x48, 0xf2,
+  0x00, 0x03, 0xcf, 0xf6, 0xff, 0x73, 0xc8, 0xbf, 0xd3, 0x13, 0x54, 0x45,
+  0x20, 0xd8, 0xb3, 0x42, 0x00, 0xeb, 0x07, 0x02, 0x07, 0xf1, 0x02, 0x07,
+  0x4f, 0xf4, 0x79, 0x51, 0xa8, 0xbf, 0x33, 0x46, 0xb7, 0xf5, 0x00, 0x7f,
+  0x53, 0x52, 0x93, 0xd1, 0x02, 0x9d, 0x01, 0x9c, 0xea, 0xb2, 0x00, 0x9b,
+  0x01, 0x35, 0x43, 0xf6, 0x3e, 0x41, 0x00, 0xeb, 0x42, 0x02, 0xb3, 0xf9,
+  0xbe, 0x34, 0xa5, 0x42, 0x4f, 0xea, 0x53, 0x03, 0x53, 0x52, 0x7f, 0xf4,
+  0x81, 0xaf, 0x10, 0xb0, 0xbd, 0xe8, 0xf0, 0x8f, 0x02, 0x21, 0x03, 0x98,
+  0x10, 0xb0, 0xbd, 0xe8, 0xf0, 0x4f, 0xff, 0xf7, 0xfe, 0xbf, 0x80, 0xb5,
+  0x82, 0xb0, 0x40, 0xf2, 0x00, 0x01, 0x01, 0xaa, 0xc0, 0xf2, 0x00, 0x01,
+  0x49, 0x6d, 0x52, 0x1a, 0x01, 0x46, 0x80, 0x68, 0x06, 0xd3, 0x09, 0x69,
+  0x8a, 0x42, 0x03, 0xd3, 0x02, 0xb0, 0xbd, 0xe8, 0x80, 0x40, 0x05, 0xe0,
+  0x0b, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x02, 0xb0, 0x80, 0xbd,
+  0x70, 0xb5, 0x40, 0xf2, 0x93, 0x1c, 0x49, 0xf6, 0xc5, 0x51, 0xc0, 0xf2,
+  0x00, 0x1c, 0xd0, 0xf8, 0x78, 0xe1, 0xd0, 0xf8, 0xa8, 0x21, 0xc8, 0xf2,
+  0x1c, 0x11, 0x4f, 0xf4, 0x79, 0x53, 0x44, 0xf2, 0x40, 0x04, 0x93, 0x42,
+  0x9c, 0xbf, 0x5d, 0x1c, 0x95, 0x42, 0x20, 0xd8, 0x9d, 0x1c, 0x95, 0x42,
+  0x9c, 0xbf, 0xdd, 0x1c, 0x95, 0x42, 0x1a, 0xd8, 0x1e, 0xf8, 0x03, 0x50,
+  0x0e, 0xeb, 0x03, 0x06, 0x04, 0x33, 0x69, 0x40, 0x75, 0x78, 0x01, 0xfb,
+  0x0c, 0xf1, 0xa3, 0x42, 0x81, 0xea, 0x05, 0x01, 0xb5, 0x78, 0x01, 0xfb,
+  0x0c, 0xf1, 0x81, 0xea, 0x05, 0x01, 0xf5, 0x78, 0x01, 0xfb, 0x0c, 0xf1,
+  0x81, 0xea, 0x05, 0x01, 0x01, 0xfb, 0x0c, 0xf1, 0xdb, 0xd1, 0x08, 0x46,
+  0x70, 0xbd, 0x02, 0x21, 0xff, 0xf7, 0xfe, 0xff, 0x00, 0x20, 0x70, 0xbd,
+  0x03, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbc, 0x01, 0x00, 0x00, 0x9a, 0x07, 0x00, 0x00, 0xa6, 0x09, 0x00, 0x00,
+  0x80, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00,
+  0x14, 0x11, 0x00, 0x00, 0x46, 0x14, 0x00, 0x00, 0x56, 0x16, 0x00, 0x00,
+  0xfe, 0x17, 0x00, 0x00, 0xe4, 0x18, 0x00, 0x00, 0x22, 0x19, 0x00, 0x00,
+  0x28, 0x1b, 0x00, 0x00, 0xb4, 0x20, 0x00, 0x00, 0x7c, 0x21, 0x00, 0x00,
+  0xb0, 0x23, 0x00, 0x00, 0x94, 0x24, 0x00, 0x00, 0x2a, 0x27, 0x00, 0x00,
+  0x52, 0x29, 0x00, 0x00, 0x6e, 0x2a, 0x00, 0x00, 0xc2, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x6d, 0x65, 0x6d, 0x6f,
+  0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x66, 0x69, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x66, 0x69, 0x72, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x66, 0x69, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x69, 0x69, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x69, 0x69, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x69, 0x69, 0x72, 0x5f,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x6d, 0x61, 0x74, 0x6d,
+  0x75, 0x6c, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x62,
+  0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x6d, 0x61, 0x74, 0x6d, 0x75, 0x6c, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x63, 0x72, 0x63, 0x33, 0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x63, 0x72, 0x63, 0x33,
+  0x32, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x61, 0x65, 0x73, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x61, 0x65, 0x73, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x61, 0x65, 0x73, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x73, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x73, 0x6f, 0x72, 0x74,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x73, 0x6f, 0x72, 0x74, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x71, 0x31, 0x35, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x71, 0x31, 0x35, 0x5f,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2e, 0x72,
+  0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x11, 0x00, 0x2e, 0x61,
+  0x6f, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x61, 0x6f, 0x74, 0x5f, 0x73, 0x65,
+  0x74, 0x5f, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+  0x77, 0x69, 0x74, 0x68, 0x5f, 0x69, 0x64, 0x00, 0x0c, 0x00, 0x61, 0x6f,
+  0x74, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x23, 0x31, 0x37, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xae, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x96, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9e, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xce, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x78, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x84, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xea, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x12, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x42, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4a, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x5a, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xfa, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x26, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xee, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x26, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x4a, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x32, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xdc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x86, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa4, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xac, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xb4, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xba, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd6, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6a, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x9c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbe, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xaa, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x34, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x52, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3e, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x56, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x5c, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xe0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x72, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x96, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xbe, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc6, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xcc, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xea, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
+};
+unsigned int kernels_bench_aot_len = 14664;
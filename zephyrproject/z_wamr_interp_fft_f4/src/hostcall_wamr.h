@@ -0,0 +1,140 @@
+#ifndef HOSTCALL_WAMR_H
+#define HOSTCALL_WAMR_H
+
+/*
+ * Import "env" di hostcall_bench.wasm per WAMR (linux_bench e app MCU).
+ * hc_* sono native normali: WAMR converte gli argomenti secondo la firma e
+ * valida da sé "$" (stringa) e "*~" (puntatore + lunghezza). hc_raw_* sono
+ * registrate con wasm_runtime_register_natives_raw e leggono gli argomenti
+ * dall'array uint64; hc_raw_str valida la stringa a mano.
+ *
+ *   hostcall_register_wamr()   dopo wasm_runtime_full_init e prima del load
+ */
+#include <string.h>
+
+#include "wasm_export.h"
+
+static void hc_wamr_void(wasm_exec_env_t env)
+{
+    (void)env;
+}
+
+static void hc_wamr_i32_1(wasm_exec_env_t env, int32_t a)
+{
+    (void)env; (void)a;
+}
+
+static void hc_wamr_i32_4(wasm_exec_env_t env, int32_t a, int32_t b, int32_t c, int32_t d)
+{
+    (void)env; (void)a; (void)b; (void)c; (void)d;
+}
+
+static void hc_wamr_i32_8(wasm_exec_env_t env, int32_t a, int32_t b, int32_t c, int32_t d,
+                          int32_t e, int32_t f, int32_t g, int32_t h)
+{
+    (void)env; (void)a; (void)b; (void)c; (void)d; (void)e; (void)f; (void)g; (void)h;
+}
+
+static void hc_wamr_i64_4(wasm_exec_env_t env, int64_t a, int64_t b, int64_t c, int64_t d)
+{
+    (void)env; (void)a; (void)b; (void)c; (void)d;
+}
+
+static void hc_wamr_f64_4(wasm_exec_env_t env, double a, double b, double c, double d)
+{
+    (void)env; (void)a; (void)b; (void)c; (void)d;
+}
+
+static void hc_wamr_mixed(wasm_exec_env_t env, int32_t a, int64_t b, float c, double d)
+{
+    (void)env; (void)a; (void)b; (void)c; (void)d;
+}
+
+static int32_t hc_wamr_ret(wasm_exec_env_t env, int32_t x)
+{
+    (void)env;
+    return x + 1;
+}
+
+static int32_t hc_wamr_str(wasm_exec_env_t env, const char *s)
+{
+    (void)env;
+    return (int32_t)strlen(s);
+}
+
+static int32_t hc_wamr_buf(wasm_exec_env_t env, const uint8_t *p, uint32_t len)
+{
+    (void)env; (void)p;
+    return (int32_t)len;
+}
+
+static void hc_wamr_raw_void(wasm_exec_env_t env, uint64_t *args)
+{
+    (void)env; (void)args;
+}
+
+static void hc_wamr_raw_i32_4(wasm_exec_env_t env, uint64_t *args)
+{
+    native_raw_get_arg(int32_t, a, args);
+    native_raw_get_arg(int32_t, b, args);
+    native_raw_get_arg(int32_t, c, args);
+    native_raw_get_arg(int32_t, d, args);
+    (void)env; (void)a; (void)b; (void)c; (void)d;
+}
+
+static void hc_wamr_raw_i32_8(wasm_exec_env_t env, uint64_t *args)
+{
+    native_raw_get_arg(int32_t, a, args);
+    native_raw_get_arg(int32_t, b, args);
+    native_raw_get_arg(int32_t, c, args);
+    native_raw_get_arg(int32_t, d, args);
+    native_raw_get_arg(int32_t, e, args);
+    native_raw_get_arg(int32_t, f, args);
+    native_raw_get_arg(int32_t, g, args);
+    native_raw_get_arg(int32_t, h, args);
+    (void)env; (void)a; (void)b; (void)c; (void)d; (void)e; (void)f; (void)g; (void)h;
+}
+
+/* se la validazione fallisce l'eccezione è già impostata: nessun risultato */
+static void hc_wamr_raw_str(wasm_exec_env_t env, uint64_t *args)
+{
+    wasm_module_inst_t module_inst = get_module_inst(env);
+    native_raw_return_type(int32_t, args);
+    native_raw_get_arg(uint32_t, offset, args);
+
+    if (!validate_app_str_addr(offset)) {
+        return;
+    }
+    native_raw_set_return((int32_t)strlen((const char *)addr_app_to_native(offset)));
+}
+
+/* WAMR ordina e tiene questi array: statici e non const */
+static NativeSymbol hostcall_natives[] = {
+    { "hc_void",  (void *)hc_wamr_void,  "()",         NULL },
+    { "hc_i32_1", (void *)hc_wamr_i32_1, "(i)",        NULL },
+    { "hc_i32_4", (void *)hc_wamr_i32_4, "(iiii)",     NULL },
+    { "hc_i32_8", (void *)hc_wamr_i32_8, "(iiiiiiii)", NULL },
+    { "hc_i64_4", (void *)hc_wamr_i64_4, "(IIII)",     NULL },
+    { "hc_f64_4", (void *)hc_wamr_f64_4, "(FFFF)",     NULL },
+    { "hc_mixed", (void *)hc_wamr_mixed, "(iIfF)",     NULL },
+    { "hc_ret",   (void *)hc_wamr_ret,   "(i)i",       NULL },
+    { "hc_str",   (void *)hc_wamr_str,   "($)i",       NULL },
+    { "hc_buf",   (void *)hc_wamr_buf,   "(*~)i",      NULL },
+};
+
+static NativeSymbol hostcall_natives_raw[] = {
+    { "hc_raw_void",  (void *)hc_wamr_raw_void,  "()",         NULL },
+    { "hc_raw_i32_4", (void *)hc_wamr_raw_i32_4, "(iiii)",     NULL },
+    { "hc_raw_i32_8", (void *)hc_wamr_raw_i32_8, "(iiiiiiii)", NULL },
+    { "hc_raw_str",   (void *)hc_wamr_raw_str,   "(i)i",       NULL },
+};
+
+static bool hostcall_register_wamr(void)
+{
+    return wasm_runtime_register_natives("env", hostcall_natives,
+                                         sizeof(hostcall_natives) / sizeof(NativeSymbol))
+        && wasm_runtime_register_natives_raw("env", hostcall_natives_raw,
+                                             sizeof(hostcall_natives_raw) / sizeof(NativeSymbol));
+}
+
+#endif /* HOSTCALL_WAMR_H */
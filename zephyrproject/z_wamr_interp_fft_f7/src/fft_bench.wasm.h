@@ -1,431 +1,1056 @@
 unsigned char fft_bench_wasm[] = {
-  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
-  0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x03, 0x03, 0x02, 0x00, 0x01, 0x04,
-  0x05, 0x01, 0x70, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01, 0x06,
-  0x08, 0x01, 0x7f, 0x01, 0x41, 0x80, 0xe8, 0x01, 0x0b, 0x07, 0x21, 0x03,
-  0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x02, 0x00, 0x08, 0x66, 0x66,
-  0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x09, 0x66, 0x66, 0x74,
-  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x01, 0x0a, 0xc6, 0x04, 0x02,
-  0x63, 0x02, 0x02, 0x7f, 0x02, 0x7d, 0x41, 0x00, 0x21, 0x00, 0x41, 0x80,
-  0xa8, 0x80, 0x80, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00,
-  0xb3, 0x22, 0x02, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x08, 0x6a, 0x20,
-  0x00, 0x41, 0x01, 0x6a, 0xb3, 0x22, 0x03, 0x38, 0x02, 0x00, 0x20, 0x01,
-  0x41, 0x04, 0x6a, 0x20, 0x02, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x38,
-  0x02, 0x00, 0x20, 0x01, 0x41, 0x0c, 0x6a, 0x20, 0x03, 0x43, 0x00, 0x00,
-  0x00, 0x3f, 0x94, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x10, 0x6a, 0x21,
-  0x01, 0x20, 0x00, 0x41, 0x02, 0x6a, 0x22, 0x00, 0x41, 0x80, 0x08, 0x47,
-  0x0d, 0x00, 0x0b, 0x0b, 0xdf, 0x03, 0x06, 0x04, 0x7f, 0x01, 0x7d, 0x02,
-  0x7f, 0x01, 0x7d, 0x08, 0x7f, 0x05, 0x7d, 0x02, 0x40, 0x20, 0x00, 0x41,
-  0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x41, 0x00,
-  0x21, 0x02, 0x41, 0x00, 0x21, 0x03, 0x03, 0x40, 0x02, 0x40, 0x20, 0x03,
-  0x20, 0x02, 0x4e, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x03, 0x74, 0x22, 0x04,
-  0x2a, 0x02, 0x80, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x05, 0x20, 0x04, 0x20,
-  0x02, 0x41, 0x03, 0x74, 0x22, 0x06, 0x41, 0x80, 0xa8, 0x80, 0x80, 0x00,
-  0x6a, 0x22, 0x07, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x80, 0xa8, 0x80, 0x80,
-  0x00, 0x20, 0x04, 0x2a, 0x02, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x08,
-  0x20, 0x04, 0x20, 0x06, 0x41, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x6a, 0x22,
-  0x06, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x20,
-  0x07, 0x20, 0x05, 0x38, 0x02, 0x00, 0x20, 0x06, 0x20, 0x08, 0x38, 0x02,
-  0x00, 0x0b, 0x41, 0x80, 0x04, 0x21, 0x06, 0x02, 0x40, 0x20, 0x02, 0x41,
-  0x80, 0x04, 0x71, 0x45, 0x0d, 0x00, 0x41, 0x80, 0x04, 0x21, 0x04, 0x03,
-  0x40, 0x20, 0x02, 0x20, 0x04, 0x73, 0x21, 0x02, 0x20, 0x04, 0x41, 0x01,
-  0x76, 0x22, 0x06, 0x21, 0x04, 0x20, 0x02, 0x20, 0x06, 0x71, 0x0d, 0x00,
-  0x0b, 0x0b, 0x20, 0x06, 0x20, 0x02, 0x72, 0x21, 0x02, 0x20, 0x03, 0x41,
-  0x01, 0x6a, 0x22, 0x03, 0x41, 0x80, 0x08, 0x47, 0x0d, 0x00, 0x0b, 0x41,
-  0x02, 0x21, 0x09, 0x03, 0x40, 0x02, 0x40, 0x20, 0x09, 0x41, 0x01, 0x75,
-  0x22, 0x0a, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x20, 0x09, 0x41, 0x03, 0x74,
-  0x21, 0x0b, 0x20, 0x0a, 0x41, 0x03, 0x74, 0x21, 0x0c, 0x41, 0x80, 0x08,
-  0x20, 0x09, 0x68, 0x76, 0x41, 0x02, 0x74, 0x21, 0x0d, 0x41, 0x00, 0x21,
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x17, 0x05, 0x60,
+  0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x60, 0x03, 0x7f, 0x7f, 0x7f, 0x00,
+  0x60, 0x00, 0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x00, 0x03, 0x19, 0x18,
+  0x00, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+  0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03,
+  0x04, 0x05, 0x01, 0x70, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01,
+  0x06, 0x08, 0x01, 0x7f, 0x01, 0x41, 0x90, 0xa8, 0x03, 0x0b, 0x07, 0xbe,
+  0x02, 0x15, 0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x02, 0x00, 0x08,
+  0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x09, 0x66,
+  0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x01, 0x0b, 0x66,
+  0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x02,
+  0x0c, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x00, 0x04, 0x0f, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x05, 0x0b, 0x66, 0x66,
+  0x74, 0x5f, 0x72, 0x34, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x06, 0x0c,
+  0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68,
+  0x00, 0x07, 0x0f, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x09, 0x0b, 0x66, 0x66, 0x74,
+  0x5f, 0x73, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x0a, 0x0c, 0x66,
+  0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00,
+  0x0b, 0x0f, 0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x0d, 0x09, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x0e, 0x0a, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x0f, 0x0d, 0x72, 0x66, 0x66,
+  0x74, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x10,
+  0x0c, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e, 0x69,
+  0x74, 0x00, 0x11, 0x0d, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x12, 0x10, 0x66, 0x66, 0x74, 0x5f,
+  0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x00, 0x14, 0x0d, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x15, 0x0e, 0x72, 0x66, 0x66, 0x74, 0x5f,
+  0x71, 0x31, 0x35, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x16, 0x11,
+  0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x75, 0x6d, 0x00, 0x17, 0x0a, 0x84, 0x3c, 0x18, 0x63,
+  0x02, 0x02, 0x7f, 0x02, 0x7d, 0x41, 0x00, 0x21, 0x00, 0x41, 0x80, 0xa8,
+  0x80, 0x80, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00, 0xb2,
+  0x22, 0x02, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x08, 0x6a, 0x20, 0x00,
+  0x41, 0x01, 0x6a, 0xb2, 0x22, 0x03, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41,
+  0x04, 0x6a, 0x20, 0x02, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x38, 0x02,
+  0x00, 0x20, 0x01, 0x41, 0x0c, 0x6a, 0x20, 0x03, 0x43, 0x00, 0x00, 0x00,
+  0x3f, 0x94, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x10, 0x6a, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x02, 0x6a, 0x22, 0x00, 0x41, 0x80, 0x08, 0x47, 0x0d,
+  0x00, 0x0b, 0x0b, 0xe7, 0x03, 0x06, 0x05, 0x7f, 0x01, 0x7d, 0x02, 0x7f,
+  0x01, 0x7d, 0x06, 0x7f, 0x05, 0x7d, 0x02, 0x40, 0x20, 0x00, 0x41, 0x01,
+  0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x41, 0x00, 0x21,
+  0x02, 0x41, 0x00, 0x21, 0x03, 0x03, 0x40, 0x02, 0x40, 0x20, 0x03, 0x20,
+  0x02, 0x4e, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x03, 0x74, 0x22, 0x04, 0x41,
+  0x80, 0xa8, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x05, 0x2a, 0x02, 0x00, 0x21,
+  0x06, 0x20, 0x05, 0x20, 0x02, 0x41, 0x03, 0x74, 0x22, 0x07, 0x41, 0x80,
+  0xa8, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x08, 0x2a, 0x02, 0x00, 0x38, 0x02,
+  0x00, 0x20, 0x04, 0x41, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x04,
+  0x2a, 0x02, 0x00, 0x21, 0x09, 0x20, 0x04, 0x20, 0x07, 0x41, 0x84, 0xa8,
+  0x80, 0x80, 0x00, 0x6a, 0x22, 0x05, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x00,
+  0x20, 0x08, 0x20, 0x06, 0x38, 0x02, 0x00, 0x20, 0x05, 0x20, 0x09, 0x38,
+  0x02, 0x00, 0x0b, 0x41, 0x80, 0x04, 0x21, 0x05, 0x02, 0x40, 0x20, 0x02,
+  0x41, 0x80, 0x04, 0x71, 0x45, 0x0d, 0x00, 0x41, 0x80, 0x04, 0x21, 0x04,
+  0x03, 0x40, 0x20, 0x02, 0x20, 0x04, 0x73, 0x21, 0x02, 0x20, 0x04, 0x41,
+  0x01, 0x76, 0x22, 0x05, 0x21, 0x04, 0x20, 0x02, 0x20, 0x05, 0x71, 0x0d,
+  0x00, 0x0b, 0x0b, 0x20, 0x05, 0x20, 0x02, 0x72, 0x21, 0x02, 0x20, 0x03,
+  0x41, 0x01, 0x6a, 0x22, 0x03, 0x41, 0x80, 0x08, 0x47, 0x0d, 0x00, 0x0b,
+  0x41, 0x02, 0x21, 0x0a, 0x03, 0x40, 0x20, 0x0a, 0x41, 0x01, 0x75, 0x22,
+  0x02, 0x41, 0x01, 0x20, 0x02, 0x41, 0x01, 0x4a, 0x1b, 0x21, 0x0b, 0x20,
+  0x0a, 0x41, 0x02, 0x74, 0x21, 0x08, 0x20, 0x0a, 0x41, 0x03, 0x74, 0x21,
+  0x0c, 0x41, 0x80, 0x08, 0x20, 0x0a, 0x6e, 0x21, 0x0d, 0x41, 0x00, 0x21,
   0x0e, 0x41, 0x80, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x0f, 0x03, 0x40, 0x20,
-  0x0f, 0x21, 0x02, 0x41, 0x00, 0x21, 0x04, 0x20, 0x0a, 0x21, 0x03, 0x03,
-  0x40, 0x20, 0x02, 0x41, 0x04, 0x6a, 0x22, 0x07, 0x20, 0x04, 0x41, 0x80,
-  0x88, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x05, 0x20, 0x02,
-  0x20, 0x0c, 0x6a, 0x22, 0x06, 0x41, 0x04, 0x6a, 0x22, 0x10, 0x2a, 0x02,
-  0x00, 0x22, 0x08, 0x94, 0x20, 0x04, 0x41, 0x80, 0x98, 0x80, 0x80, 0x00,
-  0x6a, 0x2a, 0x02, 0x00, 0x22, 0x11, 0x20, 0x06, 0x2a, 0x02, 0x00, 0x22,
-  0x12, 0x94, 0x92, 0x22, 0x13, 0x20, 0x07, 0x2a, 0x02, 0x00, 0x22, 0x14,
-  0x92, 0x38, 0x02, 0x00, 0x20, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x00, 0x22,
-  0x15, 0x20, 0x05, 0x20, 0x12, 0x94, 0x20, 0x11, 0x20, 0x08, 0x94, 0x93,
-  0x22, 0x05, 0x92, 0x38, 0x02, 0x00, 0x20, 0x10, 0x20, 0x14, 0x20, 0x13,
-  0x93, 0x38, 0x02, 0x00, 0x20, 0x06, 0x20, 0x15, 0x20, 0x05, 0x93, 0x38,
-  0x02, 0x00, 0x20, 0x02, 0x41, 0x08, 0x6a, 0x21, 0x02, 0x20, 0x04, 0x20,
-  0x0d, 0x6a, 0x21, 0x04, 0x20, 0x03, 0x41, 0x7f, 0x6a, 0x22, 0x03, 0x0d,
-  0x00, 0x0b, 0x20, 0x0f, 0x20, 0x0b, 0x6a, 0x21, 0x0f, 0x20, 0x0e, 0x20,
-  0x09, 0x6a, 0x22, 0x0e, 0x41, 0x80, 0x08, 0x49, 0x0d, 0x00, 0x0b, 0x0b,
-  0x20, 0x09, 0x41, 0x01, 0x74, 0x22, 0x09, 0x41, 0x81, 0x08, 0x48, 0x0d,
-  0x00, 0x0b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47,
-  0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x0b, 0x88, 0x20, 0x01, 0x00, 0x41, 0x80,
-  0x08, 0x0b, 0x80, 0x20, 0x00, 0x00, 0x80, 0x3f, 0xc4, 0xfe, 0x7f, 0x3f,
-  0x11, 0xfb, 0x7f, 0x3f, 0xe6, 0xf4, 0x7f, 0x3f, 0x43, 0xec, 0x7f, 0x3f,
-  0x29, 0xe1, 0x7f, 0x3f, 0x98, 0xd3, 0x7f, 0x3f, 0x8f, 0xc3, 0x7f, 0x3f,
-  0x0f, 0xb1, 0x7f, 0x3f, 0x18, 0x9c, 0x7f, 0x3f, 0xab, 0x84, 0x7f, 0x3f,
-  0xc7, 0x6a, 0x7f, 0x3f, 0x6d, 0x4e, 0x7f, 0x3f, 0x9d, 0x2f, 0x7f, 0x3f,
-  0x58, 0x0e, 0x7f, 0x3f, 0x9d, 0xea, 0x7e, 0x3f, 0x6d, 0xc4, 0x7e, 0x3f,
-  0xc9, 0x9b, 0x7e, 0x3f, 0xb0, 0x70, 0x7e, 0x3f, 0x23, 0x43, 0x7e, 0x3f,
-  0x24, 0x13, 0x7e, 0x3f, 0xb1, 0xe0, 0x7d, 0x3f, 0xcc, 0xab, 0x7d, 0x3f,
-  0x74, 0x74, 0x7d, 0x3f, 0xac, 0x3a, 0x7d, 0x3f, 0x73, 0xfe, 0x7c, 0x3f,
-  0xc9, 0xbf, 0x7c, 0x3f, 0xb0, 0x7e, 0x7c, 0x3f, 0x28, 0x3b, 0x7c, 0x3f,
-  0x31, 0xf5, 0x7b, 0x3f, 0xcd, 0xac, 0x7b, 0x3f, 0xfc, 0x61, 0x7b, 0x3f,
-  0xbe, 0x14, 0x7b, 0x3f, 0x16, 0xc5, 0x7a, 0x3f, 0x02, 0x73, 0x7a, 0x3f,
-  0x84, 0x1e, 0x7a, 0x3f, 0x9d, 0xc7, 0x79, 0x3f, 0x4e, 0x6e, 0x79, 0x3f,
-  0x98, 0x12, 0x79, 0x3f, 0x7b, 0xb4, 0x78, 0x3f, 0xf8, 0x53, 0x78, 0x3f,
-  0x10, 0xf1, 0x77, 0x3f, 0xc5, 0x8b, 0x77, 0x3f, 0x17, 0x24, 0x77, 0x3f,
-  0x07, 0xba, 0x76, 0x3f, 0x97, 0x4d, 0x76, 0x3f, 0xc6, 0xde, 0x75, 0x3f,
-  0x97, 0x6d, 0x75, 0x3f, 0x0b, 0xfa, 0x74, 0x3f, 0x22, 0x84, 0x74, 0x3f,
-  0xdd, 0x0b, 0x74, 0x3f, 0x3f, 0x91, 0x73, 0x3f, 0x47, 0x14, 0x73, 0x3f,
-  0xf8, 0x94, 0x72, 0x3f, 0x52, 0x13, 0x72, 0x3f, 0x57, 0x8f, 0x71, 0x3f,
-  0x08, 0x09, 0x71, 0x3f, 0x66, 0x80, 0x70, 0x3f, 0x73, 0xf5, 0x6f, 0x3f,
-  0x30, 0x68, 0x6f, 0x3f, 0x9e, 0xd8, 0x6e, 0x3f, 0xbe, 0x46, 0x6e, 0x3f,
-  0x93, 0xb2, 0x6d, 0x3f, 0x1d, 0x1c, 0x6d, 0x3f, 0x5e, 0x83, 0x6c, 0x3f,
-  0x58, 0xe8, 0x6b, 0x3f, 0x0c, 0x4b, 0x6b, 0x3f, 0x7b, 0xab, 0x6a, 0x3f,
-  0xa7, 0x09, 0x6a, 0x3f, 0x91, 0x65, 0x69, 0x3f, 0x3c, 0xbf, 0x68, 0x3f,
-  0xa8, 0x16, 0x68, 0x3f, 0xd8, 0x6b, 0x67, 0x3f, 0xcc, 0xbe, 0x66, 0x3f,
-  0x88, 0x0f, 0x66, 0x3f, 0x0b, 0x5e, 0x65, 0x3f, 0x59, 0xaa, 0x64, 0x3f,
-  0x73, 0xf4, 0x63, 0x3f, 0x5a, 0x3c, 0x63, 0x3f, 0x10, 0x82, 0x62, 0x3f,
-  0x98, 0xc5, 0x61, 0x3f, 0xf2, 0x06, 0x61, 0x3f, 0x21, 0x46, 0x60, 0x3f,
-  0x27, 0x83, 0x5f, 0x3f, 0x05, 0xbe, 0x5e, 0x3f, 0xbe, 0xf6, 0x5d, 0x3f,
-  0x53, 0x2d, 0x5d, 0x3f, 0xc7, 0x61, 0x5c, 0x3f, 0x1a, 0x94, 0x5b, 0x3f,
-  0x50, 0xc4, 0x5a, 0x3f, 0x6a, 0xf2, 0x59, 0x3f, 0x6a, 0x1e, 0x59, 0x3f,
-  0x53, 0x48, 0x58, 0x3f, 0x26, 0x70, 0x57, 0x3f, 0xe5, 0x95, 0x56, 0x3f,
-  0x93, 0xb9, 0x55, 0x3f, 0x31, 0xdb, 0x54, 0x3f, 0xc3, 0xfa, 0x53, 0x3f,
-  0x49, 0x18, 0x53, 0x3f, 0xc6, 0x33, 0x52, 0x3f, 0x3d, 0x4d, 0x51, 0x3f,
-  0xaf, 0x64, 0x50, 0x3f, 0x1f, 0x7a, 0x4f, 0x3f, 0x90, 0x8d, 0x4e, 0x3f,
-  0x02, 0x9f, 0x4d, 0x3f, 0x79, 0xae, 0x4c, 0x3f, 0xf8, 0xbb, 0x4b, 0x3f,
-  0x7f, 0xc7, 0x4a, 0x3f, 0x12, 0xd1, 0x49, 0x3f, 0xb3, 0xd8, 0x48, 0x3f,
-  0x65, 0xde, 0x47, 0x3f, 0x2a, 0xe2, 0x46, 0x3f, 0x03, 0xe4, 0x45, 0x3f,
-  0xf5, 0xe3, 0x44, 0x3f, 0x00, 0xe2, 0x43, 0x3f, 0x29, 0xde, 0x42, 0x3f,
-  0x70, 0xd8, 0x41, 0x3f, 0xda, 0xd0, 0x40, 0x3f, 0x67, 0xc7, 0x3f, 0x3f,
-  0x1b, 0xbc, 0x3e, 0x3f, 0xf9, 0xae, 0x3d, 0x3f, 0x03, 0xa0, 0x3c, 0x3f,
-  0x3b, 0x8f, 0x3b, 0x3f, 0xa4, 0x7c, 0x3a, 0x3f, 0x42, 0x68, 0x39, 0x3f,
-  0x16, 0x52, 0x38, 0x3f, 0x23, 0x3a, 0x37, 0x3f, 0x6c, 0x20, 0x36, 0x3f,
-  0xf3, 0x04, 0x35, 0x3f, 0xbc, 0xe7, 0x33, 0x3f, 0xc9, 0xc8, 0x32, 0x3f,
-  0x1d, 0xa8, 0x31, 0x3f, 0xbb, 0x85, 0x30, 0x3f, 0xa5, 0x61, 0x2f, 0x3f,
-  0xde, 0x3b, 0x2e, 0x3f, 0x69, 0x14, 0x2d, 0x3f, 0x4a, 0xeb, 0x2b, 0x3f,
-  0x82, 0xc0, 0x2a, 0x3f, 0x15, 0x94, 0x29, 0x3f, 0x05, 0x66, 0x28, 0x3f,
-  0x56, 0x36, 0x27, 0x3f, 0x0a, 0x05, 0x26, 0x3f, 0x25, 0xd2, 0x24, 0x3f,
-  0xa9, 0x9d, 0x23, 0x3f, 0x99, 0x67, 0x22, 0x3f, 0xf9, 0x2f, 0x21, 0x3f,
-  0xcb, 0xf6, 0x1f, 0x3f, 0x12, 0xbc, 0x1e, 0x3f, 0xd1, 0x7f, 0x1d, 0x3f,
-  0x0c, 0x42, 0x1c, 0x3f, 0xc6, 0x02, 0x1b, 0x3f, 0x00, 0xc2, 0x19, 0x3f,
-  0xc0, 0x7f, 0x18, 0x3f, 0x07, 0x3c, 0x17, 0x3f, 0xd9, 0xf6, 0x15, 0x3f,
-  0x39, 0xb0, 0x14, 0x3f, 0x2a, 0x68, 0x13, 0x3f, 0xb0, 0x1e, 0x12, 0x3f,
-  0xcd, 0xd3, 0x10, 0x3f, 0x84, 0x87, 0x0f, 0x3f, 0xda, 0x39, 0x0e, 0x3f,
-  0xd0, 0xea, 0x0c, 0x3f, 0x6b, 0x9a, 0x0b, 0x3f, 0xad, 0x48, 0x0a, 0x3f,
-  0x9b, 0xf5, 0x08, 0x3f, 0x36, 0xa1, 0x07, 0x3f, 0x82, 0x4b, 0x06, 0x3f,
-  0x84, 0xf4, 0x04, 0x3f, 0x3d, 0x9c, 0x03, 0x3f, 0xb1, 0x42, 0x02, 0x3f,
-  0xe4, 0xe7, 0x00, 0x3f, 0xb2, 0x17, 0xff, 0x3e, 0x27, 0x5d, 0xfc, 0x3e,
-  0x2d, 0xa0, 0xf9, 0x3e, 0xcb, 0xe0, 0xf6, 0x3e, 0x07, 0x1f, 0xf4, 0x3e,
-  0xea, 0x5a, 0xf1, 0x3e, 0x79, 0x94, 0xee, 0x3e, 0xbb, 0xcb, 0xeb, 0x3e,
-  0xb7, 0x00, 0xe9, 0x3e, 0x75, 0x33, 0xe6, 0x3e, 0xfa, 0x63, 0xe3, 0x3e,
-  0x4f, 0x92, 0xe0, 0x3e, 0x79, 0xbe, 0xdd, 0x3e, 0x80, 0xe8, 0xda, 0x3e,
-  0x6b, 0x10, 0xd8, 0x3e, 0x41, 0x36, 0xd5, 0x3e, 0x09, 0x5a, 0xd2, 0x3e,
-  0xca, 0x7b, 0xcf, 0x3e, 0x8b, 0x9b, 0xcc, 0x3e, 0x53, 0xb9, 0xc9, 0x3e,
-  0x29, 0xd5, 0xc6, 0x3e, 0x15, 0xef, 0xc3, 0x3e, 0x1e, 0x07, 0xc1, 0x3e,
-  0x4a, 0x1d, 0xbe, 0x3e, 0xa0, 0x31, 0xbb, 0x3e, 0x2a, 0x44, 0xb8, 0x3e,
-  0xec, 0x54, 0xb5, 0x3e, 0xef, 0x63, 0xb2, 0x3e, 0x3a, 0x71, 0xaf, 0x3e,
-  0xd4, 0x7c, 0xac, 0x3e, 0xc4, 0x86, 0xa9, 0x3e, 0x12, 0x8f, 0xa6, 0x3e,
-  0xc5, 0x95, 0xa3, 0x3e, 0xe5, 0x9a, 0xa0, 0x3e, 0x78, 0x9e, 0x9d, 0x3e,
-  0x86, 0xa0, 0x9a, 0x3e, 0x17, 0xa1, 0x97, 0x3e, 0x31, 0xa0, 0x94, 0x3e,
-  0xdd, 0x9d, 0x91, 0x3e, 0x22, 0x9a, 0x8e, 0x3e, 0x07, 0x95, 0x8b, 0x3e,
-  0x93, 0x8e, 0x88, 0x3e, 0xce, 0x86, 0x85, 0x3e, 0xc0, 0x7d, 0x82, 0x3e,
-  0xe1, 0xe6, 0x7e, 0x3e, 0xcc, 0xcf, 0x78, 0x3e, 0x51, 0xb6, 0x72, 0x3e,
-  0x7f, 0x9a, 0x6c, 0x3e, 0x66, 0x7c, 0x66, 0x3e, 0x13, 0x5c, 0x60, 0x3e,
-  0x97, 0x39, 0x5a, 0x3e, 0x01, 0x15, 0x54, 0x3e, 0x60, 0xee, 0x4d, 0x3e,
-  0xc2, 0xc5, 0x47, 0x3e, 0x37, 0x9b, 0x41, 0x3e, 0xcf, 0x6e, 0x3b, 0x3e,
-  0x98, 0x40, 0x35, 0x3e, 0xa2, 0x10, 0x2f, 0x3e, 0xfc, 0xde, 0x28, 0x3e,
-  0xb6, 0xab, 0x22, 0x3e, 0xde, 0x76, 0x1c, 0x3e, 0x83, 0x40, 0x16, 0x3e,
-  0xb7, 0x08, 0x10, 0x3e, 0x86, 0xcf, 0x09, 0x3e, 0x02, 0x95, 0x03, 0x3e,
-  0x73, 0xb2, 0xfa, 0x3d, 0x76, 0x38, 0xee, 0x3d, 0x2e, 0xbc, 0xe1, 0x3d,
-  0xb9, 0x3d, 0xd5, 0x3d, 0x36, 0xbd, 0xc8, 0x3d, 0xc3, 0x3a, 0xbc, 0x3d,
-  0x80, 0xb6, 0xaf, 0x3d, 0x8c, 0x30, 0xa3, 0x3d, 0x05, 0xa9, 0x96, 0x3d,
-  0x0a, 0x20, 0x8a, 0x3d, 0x74, 0x2b, 0x7b, 0x3d, 0x68, 0x14, 0x62, 0x3d,
-  0x2f, 0xfb, 0x48, 0x3d, 0x07, 0xe0, 0x2f, 0x3d, 0x2c, 0xc3, 0x16, 0x3d,
-  0xb9, 0x49, 0xfb, 0x3c, 0xb0, 0x0a, 0xc9, 0x3c, 0xb6, 0xc9, 0x96, 0x3c,
-  0x90, 0x0e, 0x49, 0x3c, 0x89, 0x0f, 0xc9, 0x3b, 0x00, 0x00, 0x00, 0x00,
-  0x89, 0x0f, 0xc9, 0xbb, 0x90, 0x0e, 0x49, 0xbc, 0xb6, 0xc9, 0x96, 0xbc,
-  0xb0, 0x0a, 0xc9, 0xbc, 0xb9, 0x49, 0xfb, 0xbc, 0x2c, 0xc3, 0x16, 0xbd,
-  0x07, 0xe0, 0x2f, 0xbd, 0x2f, 0xfb, 0x48, 0xbd, 0x68, 0x14, 0x62, 0xbd,
-  0x74, 0x2b, 0x7b, 0xbd, 0x0a, 0x20, 0x8a, 0xbd, 0x05, 0xa9, 0x96, 0xbd,
-  0x8c, 0x30, 0xa3, 0xbd, 0x80, 0xb6, 0xaf, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd,
-  0x36, 0xbd, 0xc8, 0xbd, 0xb9, 0x3d, 0xd5, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd,
-  0x76, 0x38, 0xee, 0xbd, 0x73, 0xb2, 0xfa, 0xbd, 0x02, 0x95, 0x03, 0xbe,
-  0x86, 0xcf, 0x09, 0xbe, 0xb7, 0x08, 0x10, 0xbe, 0x83, 0x40, 0x16, 0xbe,
-  0xde, 0x76, 0x1c, 0xbe, 0xb6, 0xab, 0x22, 0xbe, 0xfc, 0xde, 0x28, 0xbe,
-  0xa2, 0x10, 0x2f, 0xbe, 0x98, 0x40, 0x35, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe,
-  0x37, 0x9b, 0x41, 0xbe, 0xc2, 0xc5, 0x47, 0xbe, 0x60, 0xee, 0x4d, 0xbe,
-  0x01, 0x15, 0x54, 0xbe, 0x97, 0x39, 0x5a, 0xbe, 0x13, 0x5c, 0x60, 0xbe,
-  0x66, 0x7c, 0x66, 0xbe, 0x7f, 0x9a, 0x6c, 0xbe, 0x51, 0xb6, 0x72, 0xbe,
-  0xcc, 0xcf, 0x78, 0xbe, 0xe1, 0xe6, 0x7e, 0xbe, 0xc0, 0x7d, 0x82, 0xbe,
-  0xce, 0x86, 0x85, 0xbe, 0x93, 0x8e, 0x88, 0xbe, 0x07, 0x95, 0x8b, 0xbe,
-  0x22, 0x9a, 0x8e, 0xbe, 0xdd, 0x9d, 0x91, 0xbe, 0x31, 0xa0, 0x94, 0xbe,
-  0x17, 0xa1, 0x97, 0xbe, 0x86, 0xa0, 0x9a, 0xbe, 0x78, 0x9e, 0x9d, 0xbe,
-  0xe5, 0x9a, 0xa0, 0xbe, 0xc5, 0x95, 0xa3, 0xbe, 0x12, 0x8f, 0xa6, 0xbe,
-  0xc4, 0x86, 0xa9, 0xbe, 0xd4, 0x7c, 0xac, 0xbe, 0x3a, 0x71, 0xaf, 0xbe,
-  0xef, 0x63, 0xb2, 0xbe, 0xec, 0x54, 0xb5, 0xbe, 0x2a, 0x44, 0xb8, 0xbe,
-  0xa0, 0x31, 0xbb, 0xbe, 0x4a, 0x1d, 0xbe, 0xbe, 0x1e, 0x07, 0xc1, 0xbe,
-  0x15, 0xef, 0xc3, 0xbe, 0x29, 0xd5, 0xc6, 0xbe, 0x53, 0xb9, 0xc9, 0xbe,
-  0x8b, 0x9b, 0xcc, 0xbe, 0xca, 0x7b, 0xcf, 0xbe, 0x09, 0x5a, 0xd2, 0xbe,
-  0x41, 0x36, 0xd5, 0xbe, 0x6b, 0x10, 0xd8, 0xbe, 0x80, 0xe8, 0xda, 0xbe,
-  0x79, 0xbe, 0xdd, 0xbe, 0x4f, 0x92, 0xe0, 0xbe, 0xfa, 0x63, 0xe3, 0xbe,
-  0x75, 0x33, 0xe6, 0xbe, 0xb7, 0x00, 0xe9, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe,
-  0x79, 0x94, 0xee, 0xbe, 0xea, 0x5a, 0xf1, 0xbe, 0x07, 0x1f, 0xf4, 0xbe,
-  0xcb, 0xe0, 0xf6, 0xbe, 0x2d, 0xa0, 0xf9, 0xbe, 0x27, 0x5d, 0xfc, 0xbe,
-  0xb2, 0x17, 0xff, 0xbe, 0xe4, 0xe7, 0x00, 0xbf, 0xb1, 0x42, 0x02, 0xbf,
-  0x3d, 0x9c, 0x03, 0xbf, 0x84, 0xf4, 0x04, 0xbf, 0x82, 0x4b, 0x06, 0xbf,
-  0x36, 0xa1, 0x07, 0xbf, 0x9b, 0xf5, 0x08, 0xbf, 0xad, 0x48, 0x0a, 0xbf,
-  0x6b, 0x9a, 0x0b, 0xbf, 0xd0, 0xea, 0x0c, 0xbf, 0xda, 0x39, 0x0e, 0xbf,
-  0x84, 0x87, 0x0f, 0xbf, 0xcd, 0xd3, 0x10, 0xbf, 0xb0, 0x1e, 0x12, 0xbf,
-  0x2a, 0x68, 0x13, 0xbf, 0x39, 0xb0, 0x14, 0xbf, 0xd9, 0xf6, 0x15, 0xbf,
-  0x07, 0x3c, 0x17, 0xbf, 0xc0, 0x7f, 0x18, 0xbf, 0x00, 0xc2, 0x19, 0xbf,
-  0xc6, 0x02, 0x1b, 0xbf, 0x0c, 0x42, 0x1c, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf,
-  0x12, 0xbc, 0x1e, 0xbf, 0xcb, 0xf6, 0x1f, 0xbf, 0xf9, 0x2f, 0x21, 0xbf,
-  0x99, 0x67, 0x22, 0xbf, 0xa9, 0x9d, 0x23, 0xbf, 0x25, 0xd2, 0x24, 0xbf,
-  0x0a, 0x05, 0x26, 0xbf, 0x56, 0x36, 0x27, 0xbf, 0x05, 0x66, 0x28, 0xbf,
-  0x15, 0x94, 0x29, 0xbf, 0x82, 0xc0, 0x2a, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf,
-  0x69, 0x14, 0x2d, 0xbf, 0xde, 0x3b, 0x2e, 0xbf, 0xa5, 0x61, 0x2f, 0xbf,
-  0xbb, 0x85, 0x30, 0xbf, 0x1d, 0xa8, 0x31, 0xbf, 0xc9, 0xc8, 0x32, 0xbf,
-  0xbc, 0xe7, 0x33, 0xbf, 0xf3, 0x04, 0x35, 0xbf, 0x6c, 0x20, 0x36, 0xbf,
-  0x23, 0x3a, 0x37, 0xbf, 0x16, 0x52, 0x38, 0xbf, 0x42, 0x68, 0x39, 0xbf,
-  0xa4, 0x7c, 0x3a, 0xbf, 0x3b, 0x8f, 0x3b, 0xbf, 0x03, 0xa0, 0x3c, 0xbf,
-  0xf9, 0xae, 0x3d, 0xbf, 0x1b, 0xbc, 0x3e, 0xbf, 0x67, 0xc7, 0x3f, 0xbf,
-  0xda, 0xd0, 0x40, 0xbf, 0x70, 0xd8, 0x41, 0xbf, 0x29, 0xde, 0x42, 0xbf,
-  0x00, 0xe2, 0x43, 0xbf, 0xf5, 0xe3, 0x44, 0xbf, 0x03, 0xe4, 0x45, 0xbf,
-  0x2a, 0xe2, 0x46, 0xbf, 0x65, 0xde, 0x47, 0xbf, 0xb3, 0xd8, 0x48, 0xbf,
-  0x12, 0xd1, 0x49, 0xbf, 0x7f, 0xc7, 0x4a, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf,
-  0x79, 0xae, 0x4c, 0xbf, 0x02, 0x9f, 0x4d, 0xbf, 0x90, 0x8d, 0x4e, 0xbf,
-  0x1f, 0x7a, 0x4f, 0xbf, 0xaf, 0x64, 0x50, 0xbf, 0x3d, 0x4d, 0x51, 0xbf,
-  0xc6, 0x33, 0x52, 0xbf, 0x49, 0x18, 0x53, 0xbf, 0xc3, 0xfa, 0x53, 0xbf,
-  0x31, 0xdb, 0x54, 0xbf, 0x93, 0xb9, 0x55, 0xbf, 0xe5, 0x95, 0x56, 0xbf,
-  0x26, 0x70, 0x57, 0xbf, 0x53, 0x48, 0x58, 0xbf, 0x6a, 0x1e, 0x59, 0xbf,
-  0x6a, 0xf2, 0x59, 0xbf, 0x50, 0xc4, 0x5a, 0xbf, 0x1a, 0x94, 0x5b, 0xbf,
-  0xc7, 0x61, 0x5c, 0xbf, 0x53, 0x2d, 0x5d, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf,
-  0x05, 0xbe, 0x5e, 0xbf, 0x27, 0x83, 0x5f, 0xbf, 0x21, 0x46, 0x60, 0xbf,
-  0xf2, 0x06, 0x61, 0xbf, 0x98, 0xc5, 0x61, 0xbf, 0x10, 0x82, 0x62, 0xbf,
-  0x5a, 0x3c, 0x63, 0xbf, 0x73, 0xf4, 0x63, 0xbf, 0x59, 0xaa, 0x64, 0xbf,
-  0x0b, 0x5e, 0x65, 0xbf, 0x88, 0x0f, 0x66, 0xbf, 0xcc, 0xbe, 0x66, 0xbf,
-  0xd8, 0x6b, 0x67, 0xbf, 0xa8, 0x16, 0x68, 0xbf, 0x3c, 0xbf, 0x68, 0xbf,
-  0x91, 0x65, 0x69, 0xbf, 0xa7, 0x09, 0x6a, 0xbf, 0x7b, 0xab, 0x6a, 0xbf,
-  0x0c, 0x4b, 0x6b, 0xbf, 0x58, 0xe8, 0x6b, 0xbf, 0x5e, 0x83, 0x6c, 0xbf,
-  0x1d, 0x1c, 0x6d, 0xbf, 0x93, 0xb2, 0x6d, 0xbf, 0xbe, 0x46, 0x6e, 0xbf,
-  0x9e, 0xd8, 0x6e, 0xbf, 0x30, 0x68, 0x6f, 0xbf, 0x73, 0xf5, 0x6f, 0xbf,
-  0x66, 0x80, 0x70, 0xbf, 0x08, 0x09, 0x71, 0xbf, 0x57, 0x8f, 0x71, 0xbf,
-  0x52, 0x13, 0x72, 0xbf, 0xf8, 0x94, 0x72, 0xbf, 0x47, 0x14, 0x73, 0xbf,
-  0x3f, 0x91, 0x73, 0xbf, 0xdd, 0x0b, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf,
-  0x0b, 0xfa, 0x74, 0xbf, 0x97, 0x6d, 0x75, 0xbf, 0xc6, 0xde, 0x75, 0xbf,
-  0x97, 0x4d, 0x76, 0xbf, 0x07, 0xba, 0x76, 0xbf, 0x17, 0x24, 0x77, 0xbf,
-  0xc5, 0x8b, 0x77, 0xbf, 0x10, 0xf1, 0x77, 0xbf, 0xf8, 0x53, 0x78, 0xbf,
-  0x7b, 0xb4, 0x78, 0xbf, 0x98, 0x12, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf,
-  0x9d, 0xc7, 0x79, 0xbf, 0x84, 0x1e, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf,
-  0x16, 0xc5, 0x7a, 0xbf, 0xbe, 0x14, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf,
-  0xcd, 0xac, 0x7b, 0xbf, 0x31, 0xf5, 0x7b, 0xbf, 0x28, 0x3b, 0x7c, 0xbf,
-  0xb0, 0x7e, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c, 0xbf, 0x73, 0xfe, 0x7c, 0xbf,
-  0xac, 0x3a, 0x7d, 0xbf, 0x74, 0x74, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf,
-  0xb1, 0xe0, 0x7d, 0xbf, 0x24, 0x13, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf,
-  0xb0, 0x70, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf,
-  0x9d, 0xea, 0x7e, 0xbf, 0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf,
-  0x6d, 0x4e, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf,
-  0x18, 0x9c, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf,
-  0x98, 0xd3, 0x7f, 0xbf, 0x29, 0xe1, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf,
-  0xe6, 0xf4, 0x7f, 0xbf, 0x11, 0xfb, 0x7f, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf,
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x0f, 0xc9, 0xbb, 0x90, 0x0e, 0x49, 0xbc,
-  0xb6, 0xc9, 0x96, 0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb9, 0x49, 0xfb, 0xbc,
-  0x2c, 0xc3, 0x16, 0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2f, 0xfb, 0x48, 0xbd,
-  0x68, 0x14, 0x62, 0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x0a, 0x20, 0x8a, 0xbd,
-  0x05, 0xa9, 0x96, 0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x80, 0xb6, 0xaf, 0xbd,
-  0xc3, 0x3a, 0xbc, 0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xb9, 0x3d, 0xd5, 0xbd,
-  0x2e, 0xbc, 0xe1, 0xbd, 0x76, 0x38, 0xee, 0xbd, 0x73, 0xb2, 0xfa, 0xbd,
-  0x02, 0x95, 0x03, 0xbe, 0x86, 0xcf, 0x09, 0xbe, 0xb7, 0x08, 0x10, 0xbe,
-  0x83, 0x40, 0x16, 0xbe, 0xde, 0x76, 0x1c, 0xbe, 0xb6, 0xab, 0x22, 0xbe,
-  0xfc, 0xde, 0x28, 0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0x98, 0x40, 0x35, 0xbe,
-  0xcf, 0x6e, 0x3b, 0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xc2, 0xc5, 0x47, 0xbe,
-  0x60, 0xee, 0x4d, 0xbe, 0x01, 0x15, 0x54, 0xbe, 0x97, 0x39, 0x5a, 0xbe,
-  0x13, 0x5c, 0x60, 0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x7f, 0x9a, 0x6c, 0xbe,
-  0x51, 0xb6, 0x72, 0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0xe1, 0xe6, 0x7e, 0xbe,
-  0xc0, 0x7d, 0x82, 0xbe, 0xce, 0x86, 0x85, 0xbe, 0x93, 0x8e, 0x88, 0xbe,
-  0x07, 0x95, 0x8b, 0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0xdd, 0x9d, 0x91, 0xbe,
-  0x31, 0xa0, 0x94, 0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x86, 0xa0, 0x9a, 0xbe,
-  0x78, 0x9e, 0x9d, 0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0xc5, 0x95, 0xa3, 0xbe,
-  0x12, 0x8f, 0xa6, 0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0xd4, 0x7c, 0xac, 0xbe,
-  0x3a, 0x71, 0xaf, 0xbe, 0xef, 0x63, 0xb2, 0xbe, 0xec, 0x54, 0xb5, 0xbe,
-  0x2a, 0x44, 0xb8, 0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x4a, 0x1d, 0xbe, 0xbe,
-  0x1e, 0x07, 0xc1, 0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x29, 0xd5, 0xc6, 0xbe,
-  0x53, 0xb9, 0xc9, 0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0xca, 0x7b, 0xcf, 0xbe,
-  0x09, 0x5a, 0xd2, 0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x6b, 0x10, 0xd8, 0xbe,
-  0x80, 0xe8, 0xda, 0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x4f, 0x92, 0xe0, 0xbe,
-  0xfa, 0x63, 0xe3, 0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xb7, 0x00, 0xe9, 0xbe,
-  0xbb, 0xcb, 0xeb, 0xbe, 0x79, 0x94, 0xee, 0xbe, 0xea, 0x5a, 0xf1, 0xbe,
-  0x07, 0x1f, 0xf4, 0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x2d, 0xa0, 0xf9, 0xbe,
-  0x27, 0x5d, 0xfc, 0xbe, 0xb2, 0x17, 0xff, 0xbe, 0xe4, 0xe7, 0x00, 0xbf,
-  0xb1, 0x42, 0x02, 0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0x84, 0xf4, 0x04, 0xbf,
-  0x82, 0x4b, 0x06, 0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x9b, 0xf5, 0x08, 0xbf,
-  0xad, 0x48, 0x0a, 0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xd0, 0xea, 0x0c, 0xbf,
-  0xda, 0x39, 0x0e, 0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xcd, 0xd3, 0x10, 0xbf,
-  0xb0, 0x1e, 0x12, 0xbf, 0x2a, 0x68, 0x13, 0xbf, 0x39, 0xb0, 0x14, 0xbf,
-  0xd9, 0xf6, 0x15, 0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xc0, 0x7f, 0x18, 0xbf,
-  0x00, 0xc2, 0x19, 0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x0c, 0x42, 0x1c, 0xbf,
-  0xd1, 0x7f, 0x1d, 0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xcb, 0xf6, 0x1f, 0xbf,
-  0xf9, 0x2f, 0x21, 0xbf, 0x99, 0x67, 0x22, 0xbf, 0xa9, 0x9d, 0x23, 0xbf,
-  0x25, 0xd2, 0x24, 0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x56, 0x36, 0x27, 0xbf,
-  0x05, 0x66, 0x28, 0xbf, 0x15, 0x94, 0x29, 0xbf, 0x82, 0xc0, 0x2a, 0xbf,
-  0x4a, 0xeb, 0x2b, 0xbf, 0x69, 0x14, 0x2d, 0xbf, 0xde, 0x3b, 0x2e, 0xbf,
-  0xa5, 0x61, 0x2f, 0xbf, 0xbb, 0x85, 0x30, 0xbf, 0x1d, 0xa8, 0x31, 0xbf,
-  0xc9, 0xc8, 0x32, 0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xf3, 0x04, 0x35, 0xbf,
-  0x6c, 0x20, 0x36, 0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x16, 0x52, 0x38, 0xbf,
-  0x42, 0x68, 0x39, 0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x3b, 0x8f, 0x3b, 0xbf,
-  0x03, 0xa0, 0x3c, 0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x1b, 0xbc, 0x3e, 0xbf,
-  0x67, 0xc7, 0x3f, 0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x70, 0xd8, 0x41, 0xbf,
-  0x29, 0xde, 0x42, 0xbf, 0x00, 0xe2, 0x43, 0xbf, 0xf5, 0xe3, 0x44, 0xbf,
-  0x03, 0xe4, 0x45, 0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x65, 0xde, 0x47, 0xbf,
-  0xb3, 0xd8, 0x48, 0xbf, 0x12, 0xd1, 0x49, 0xbf, 0x7f, 0xc7, 0x4a, 0xbf,
-  0xf8, 0xbb, 0x4b, 0xbf, 0x79, 0xae, 0x4c, 0xbf, 0x02, 0x9f, 0x4d, 0xbf,
-  0x90, 0x8d, 0x4e, 0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0xaf, 0x64, 0x50, 0xbf,
-  0x3d, 0x4d, 0x51, 0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x49, 0x18, 0x53, 0xbf,
-  0xc3, 0xfa, 0x53, 0xbf, 0x31, 0xdb, 0x54, 0xbf, 0x93, 0xb9, 0x55, 0xbf,
-  0xe5, 0x95, 0x56, 0xbf, 0x26, 0x70, 0x57, 0xbf, 0x53, 0x48, 0x58, 0xbf,
-  0x6a, 0x1e, 0x59, 0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x50, 0xc4, 0x5a, 0xbf,
-  0x1a, 0x94, 0x5b, 0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x53, 0x2d, 0x5d, 0xbf,
-  0xbe, 0xf6, 0x5d, 0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0x27, 0x83, 0x5f, 0xbf,
-  0x21, 0x46, 0x60, 0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x98, 0xc5, 0x61, 0xbf,
-  0x10, 0x82, 0x62, 0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x73, 0xf4, 0x63, 0xbf,
-  0x59, 0xaa, 0x64, 0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x88, 0x0f, 0x66, 0xbf,
-  0xcc, 0xbe, 0x66, 0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xa8, 0x16, 0x68, 0xbf,
-  0x3c, 0xbf, 0x68, 0xbf, 0x91, 0x65, 0x69, 0xbf, 0xa7, 0x09, 0x6a, 0xbf,
-  0x7b, 0xab, 0x6a, 0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x58, 0xe8, 0x6b, 0xbf,
-  0x5e, 0x83, 0x6c, 0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x93, 0xb2, 0x6d, 0xbf,
-  0xbe, 0x46, 0x6e, 0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0x30, 0x68, 0x6f, 0xbf,
-  0x73, 0xf5, 0x6f, 0xbf, 0x66, 0x80, 0x70, 0xbf, 0x08, 0x09, 0x71, 0xbf,
-  0x57, 0x8f, 0x71, 0xbf, 0x52, 0x13, 0x72, 0xbf, 0xf8, 0x94, 0x72, 0xbf,
-  0x47, 0x14, 0x73, 0xbf, 0x3f, 0x91, 0x73, 0xbf, 0xdd, 0x0b, 0x74, 0xbf,
-  0x22, 0x84, 0x74, 0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x97, 0x6d, 0x75, 0xbf,
-  0xc6, 0xde, 0x75, 0xbf, 0x97, 0x4d, 0x76, 0xbf, 0x07, 0xba, 0x76, 0xbf,
-  0x17, 0x24, 0x77, 0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x10, 0xf1, 0x77, 0xbf,
-  0xf8, 0x53, 0x78, 0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0x98, 0x12, 0x79, 0xbf,
-  0x4e, 0x6e, 0x79, 0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x84, 0x1e, 0x7a, 0xbf,
-  0x02, 0x73, 0x7a, 0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0xbe, 0x14, 0x7b, 0xbf,
-  0xfc, 0x61, 0x7b, 0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0x31, 0xf5, 0x7b, 0xbf,
-  0x28, 0x3b, 0x7c, 0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c, 0xbf,
-  0x73, 0xfe, 0x7c, 0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x74, 0x74, 0x7d, 0xbf,
-  0xcc, 0xab, 0x7d, 0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0x24, 0x13, 0x7e, 0xbf,
-  0x23, 0x43, 0x7e, 0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e, 0xbf,
-  0x6d, 0xc4, 0x7e, 0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x58, 0x0e, 0x7f, 0xbf,
-  0x9d, 0x2f, 0x7f, 0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f, 0xbf,
-  0xab, 0x84, 0x7f, 0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f, 0xbf,
-  0x8f, 0xc3, 0x7f, 0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x29, 0xe1, 0x7f, 0xbf,
-  0x43, 0xec, 0x7f, 0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x11, 0xfb, 0x7f, 0xbf,
-  0xc4, 0xfe, 0x7f, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf,
-  0x11, 0xfb, 0x7f, 0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf,
-  0x29, 0xe1, 0x7f, 0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf,
-  0x0f, 0xb1, 0x7f, 0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf,
-  0xc7, 0x6a, 0x7f, 0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf,
-  0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf,
-  0xc9, 0x9b, 0x7e, 0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf,
-  0x24, 0x13, 0x7e, 0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf,
-  0x74, 0x74, 0x7d, 0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x73, 0xfe, 0x7c, 0xbf,
-  0xc9, 0xbf, 0x7c, 0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0x28, 0x3b, 0x7c, 0xbf,
-  0x31, 0xf5, 0x7b, 0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf,
-  0xbe, 0x14, 0x7b, 0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf,
-  0x84, 0x1e, 0x7a, 0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf,
-  0x98, 0x12, 0x79, 0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0xf8, 0x53, 0x78, 0xbf,
-  0x10, 0xf1, 0x77, 0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x17, 0x24, 0x77, 0xbf,
-  0x07, 0xba, 0x76, 0xbf, 0x97, 0x4d, 0x76, 0xbf, 0xc6, 0xde, 0x75, 0xbf,
-  0x97, 0x6d, 0x75, 0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf,
-  0xdd, 0x0b, 0x74, 0xbf, 0x3f, 0x91, 0x73, 0xbf, 0x47, 0x14, 0x73, 0xbf,
-  0xf8, 0x94, 0x72, 0xbf, 0x52, 0x13, 0x72, 0xbf, 0x57, 0x8f, 0x71, 0xbf,
-  0x08, 0x09, 0x71, 0xbf, 0x66, 0x80, 0x70, 0xbf, 0x73, 0xf5, 0x6f, 0xbf,
-  0x30, 0x68, 0x6f, 0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0xbe, 0x46, 0x6e, 0xbf,
-  0x93, 0xb2, 0x6d, 0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x5e, 0x83, 0x6c, 0xbf,
-  0x58, 0xe8, 0x6b, 0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x7b, 0xab, 0x6a, 0xbf,
-  0xa7, 0x09, 0x6a, 0xbf, 0x91, 0x65, 0x69, 0xbf, 0x3c, 0xbf, 0x68, 0xbf,
-  0xa8, 0x16, 0x68, 0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xcc, 0xbe, 0x66, 0xbf,
-  0x88, 0x0f, 0x66, 0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x59, 0xaa, 0x64, 0xbf,
-  0x73, 0xf4, 0x63, 0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x10, 0x82, 0x62, 0xbf,
-  0x98, 0xc5, 0x61, 0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x21, 0x46, 0x60, 0xbf,
-  0x27, 0x83, 0x5f, 0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf,
-  0x53, 0x2d, 0x5d, 0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x1a, 0x94, 0x5b, 0xbf,
-  0x50, 0xc4, 0x5a, 0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x6a, 0x1e, 0x59, 0xbf,
-  0x53, 0x48, 0x58, 0xbf, 0x26, 0x70, 0x57, 0xbf, 0xe5, 0x95, 0x56, 0xbf,
-  0x93, 0xb9, 0x55, 0xbf, 0x31, 0xdb, 0x54, 0xbf, 0xc3, 0xfa, 0x53, 0xbf,
-  0x49, 0x18, 0x53, 0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x3d, 0x4d, 0x51, 0xbf,
-  0xaf, 0x64, 0x50, 0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0x90, 0x8d, 0x4e, 0xbf,
-  0x02, 0x9f, 0x4d, 0xbf, 0x79, 0xae, 0x4c, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf,
-  0x7f, 0xc7, 0x4a, 0xbf, 0x12, 0xd1, 0x49, 0xbf, 0xb3, 0xd8, 0x48, 0xbf,
-  0x65, 0xde, 0x47, 0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x03, 0xe4, 0x45, 0xbf,
-  0xf5, 0xe3, 0x44, 0xbf, 0x00, 0xe2, 0x43, 0xbf, 0x29, 0xde, 0x42, 0xbf,
-  0x70, 0xd8, 0x41, 0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x67, 0xc7, 0x3f, 0xbf,
-  0x1b, 0xbc, 0x3e, 0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x03, 0xa0, 0x3c, 0xbf,
-  0x3b, 0x8f, 0x3b, 0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x42, 0x68, 0x39, 0xbf,
-  0x16, 0x52, 0x38, 0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x6c, 0x20, 0x36, 0xbf,
-  0xf3, 0x04, 0x35, 0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xc9, 0xc8, 0x32, 0xbf,
-  0x1d, 0xa8, 0x31, 0xbf, 0xbb, 0x85, 0x30, 0xbf, 0xa5, 0x61, 0x2f, 0xbf,
-  0xde, 0x3b, 0x2e, 0xbf, 0x69, 0x14, 0x2d, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf,
-  0x82, 0xc0, 0x2a, 0xbf, 0x15, 0x94, 0x29, 0xbf, 0x05, 0x66, 0x28, 0xbf,
-  0x56, 0x36, 0x27, 0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x25, 0xd2, 0x24, 0xbf,
-  0xa9, 0x9d, 0x23, 0xbf, 0x99, 0x67, 0x22, 0xbf, 0xf9, 0x2f, 0x21, 0xbf,
-  0xcb, 0xf6, 0x1f, 0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf,
-  0x0c, 0x42, 0x1c, 0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x00, 0xc2, 0x19, 0xbf,
-  0xc0, 0x7f, 0x18, 0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xd9, 0xf6, 0x15, 0xbf,
-  0x39, 0xb0, 0x14, 0xbf, 0x2a, 0x68, 0x13, 0xbf, 0xb0, 0x1e, 0x12, 0xbf,
-  0xcd, 0xd3, 0x10, 0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xda, 0x39, 0x0e, 0xbf,
-  0xd0, 0xea, 0x0c, 0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xad, 0x48, 0x0a, 0xbf,
-  0x9b, 0xf5, 0x08, 0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x82, 0x4b, 0x06, 0xbf,
-  0x84, 0xf4, 0x04, 0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0xb1, 0x42, 0x02, 0xbf,
-  0xe4, 0xe7, 0x00, 0xbf, 0xb2, 0x17, 0xff, 0xbe, 0x27, 0x5d, 0xfc, 0xbe,
-  0x2d, 0xa0, 0xf9, 0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x07, 0x1f, 0xf4, 0xbe,
-  0xea, 0x5a, 0xf1, 0xbe, 0x79, 0x94, 0xee, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe,
-  0xb7, 0x00, 0xe9, 0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xfa, 0x63, 0xe3, 0xbe,
-  0x4f, 0x92, 0xe0, 0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x80, 0xe8, 0xda, 0xbe,
-  0x6b, 0x10, 0xd8, 0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x09, 0x5a, 0xd2, 0xbe,
-  0xca, 0x7b, 0xcf, 0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0x53, 0xb9, 0xc9, 0xbe,
-  0x29, 0xd5, 0xc6, 0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x1e, 0x07, 0xc1, 0xbe,
-  0x4a, 0x1d, 0xbe, 0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x2a, 0x44, 0xb8, 0xbe,
-  0xec, 0x54, 0xb5, 0xbe, 0xef, 0x63, 0xb2, 0xbe, 0x3a, 0x71, 0xaf, 0xbe,
-  0xd4, 0x7c, 0xac, 0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0x12, 0x8f, 0xa6, 0xbe,
-  0xc5, 0x95, 0xa3, 0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0x78, 0x9e, 0x9d, 0xbe,
-  0x86, 0xa0, 0x9a, 0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x31, 0xa0, 0x94, 0xbe,
-  0xdd, 0x9d, 0x91, 0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0x07, 0x95, 0x8b, 0xbe,
-  0x93, 0x8e, 0x88, 0xbe, 0xce, 0x86, 0x85, 0xbe, 0xc0, 0x7d, 0x82, 0xbe,
-  0xe1, 0xe6, 0x7e, 0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0x51, 0xb6, 0x72, 0xbe,
-  0x7f, 0x9a, 0x6c, 0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x13, 0x5c, 0x60, 0xbe,
-  0x97, 0x39, 0x5a, 0xbe, 0x01, 0x15, 0x54, 0xbe, 0x60, 0xee, 0x4d, 0xbe,
-  0xc2, 0xc5, 0x47, 0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe,
-  0x98, 0x40, 0x35, 0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0xfc, 0xde, 0x28, 0xbe,
-  0xb6, 0xab, 0x22, 0xbe, 0xde, 0x76, 0x1c, 0xbe, 0x83, 0x40, 0x16, 0xbe,
-  0xb7, 0x08, 0x10, 0xbe, 0x86, 0xcf, 0x09, 0xbe, 0x02, 0x95, 0x03, 0xbe,
-  0x73, 0xb2, 0xfa, 0xbd, 0x76, 0x38, 0xee, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd,
-  0xb9, 0x3d, 0xd5, 0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd,
-  0x80, 0xb6, 0xaf, 0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x05, 0xa9, 0x96, 0xbd,
-  0x0a, 0x20, 0x8a, 0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x68, 0x14, 0x62, 0xbd,
-  0x2f, 0xfb, 0x48, 0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2c, 0xc3, 0x16, 0xbd,
-  0xb9, 0x49, 0xfb, 0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb6, 0xc9, 0x96, 0xbc,
-  0x90, 0x0e, 0x49, 0xbc, 0x89, 0x0f, 0xc9, 0xbb, 0x00, 0x4e, 0x04, 0x6e,
-  0x61, 0x6d, 0x65, 0x00, 0x0f, 0x0e, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65,
-  0x6e, 0x63, 0x68, 0x2e, 0x77, 0x61, 0x73, 0x6d, 0x01, 0x16, 0x02, 0x00,
-  0x08, 0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x01, 0x09, 0x66,
-  0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x07, 0x12, 0x01, 0x00,
-  0x0f, 0x5f, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x70, 0x6f, 0x69,
-  0x6e, 0x74, 0x65, 0x72, 0x09, 0x0a, 0x01, 0x00, 0x07, 0x2e, 0x72, 0x6f,
-  0x64, 0x61, 0x74, 0x61, 0x00, 0x7f, 0x09, 0x70, 0x72, 0x6f, 0x64, 0x75,
-  0x63, 0x65, 0x72, 0x73, 0x01, 0x0c, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
-  0x73, 0x65, 0x64, 0x2d, 0x62, 0x79, 0x01, 0x05, 0x63, 0x6c, 0x61, 0x6e,
-  0x67, 0x5f, 0x32, 0x31, 0x2e, 0x31, 0x2e, 0x34, 0x2d, 0x77, 0x61, 0x73,
-  0x69, 0x2d, 0x73, 0x64, 0x6b, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73,
-  0x3a, 0x2f, 0x2f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f,
-  0x6d, 0x2f, 0x6c, 0x6c, 0x76, 0x6d, 0x2f, 0x6c, 0x6c, 0x76, 0x6d, 0x2d,
-  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x32, 0x32, 0x32, 0x66,
-  0x63, 0x31, 0x31, 0x66, 0x32, 0x62, 0x38, 0x66, 0x32, 0x35, 0x66, 0x36,
-  0x61, 0x30, 0x66, 0x34, 0x39, 0x37, 0x36, 0x32, 0x37, 0x32, 0x65, 0x66,
-  0x31, 0x62, 0x62, 0x37, 0x62, 0x66, 0x34, 0x39, 0x35, 0x32, 0x31, 0x64,
-  0x29, 0x00, 0x94, 0x01, 0x0f, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f,
-  0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x73, 0x08, 0x2b, 0x0b, 0x62,
-  0x75, 0x6c, 0x6b, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2b, 0x0f,
-  0x62, 0x75, 0x6c, 0x6b, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2d,
-  0x6f, 0x70, 0x74, 0x2b, 0x16, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x69, 0x6e,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c,
-  0x6f, 0x6e, 0x67, 0x2b, 0x0a, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x76, 0x61,
-  0x6c, 0x75, 0x65, 0x2b, 0x0f, 0x6d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2b, 0x13, 0x6e, 0x6f,
-  0x6e, 0x74, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x70,
-  0x74, 0x6f, 0x69, 0x6e, 0x74, 0x2b, 0x0f, 0x72, 0x65, 0x66, 0x65, 0x72,
-  0x65, 0x6e, 0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2b, 0x08,
-  0x73, 0x69, 0x67, 0x6e, 0x2d, 0x65, 0x78, 0x74
+  0x0f, 0x21, 0x02, 0x20, 0x0b, 0x21, 0x03, 0x41, 0x00, 0x21, 0x04, 0x03,
+  0x40, 0x20, 0x02, 0x41, 0x04, 0x6a, 0x22, 0x05, 0x20, 0x05, 0x2a, 0x02,
+  0x00, 0x22, 0x06, 0x20, 0x04, 0x20, 0x0d, 0x6c, 0x41, 0x02, 0x74, 0x22,
+  0x07, 0x41, 0x80, 0x98, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22,
+  0x09, 0x20, 0x02, 0x20, 0x08, 0x6a, 0x22, 0x05, 0x2a, 0x02, 0x00, 0x22,
+  0x10, 0x94, 0x20, 0x07, 0x41, 0x80, 0x88, 0x80, 0x80, 0x00, 0x6a, 0x2a,
+  0x02, 0x00, 0x22, 0x11, 0x20, 0x05, 0x41, 0x04, 0x6a, 0x22, 0x07, 0x2a,
+  0x02, 0x00, 0x22, 0x12, 0x94, 0x92, 0x22, 0x13, 0x92, 0x38, 0x02, 0x00,
+  0x20, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x00, 0x22, 0x14, 0x20, 0x11, 0x20,
+  0x10, 0x94, 0x20, 0x09, 0x20, 0x12, 0x94, 0x93, 0x22, 0x09, 0x92, 0x38,
+  0x02, 0x00, 0x20, 0x07, 0x20, 0x06, 0x20, 0x13, 0x93, 0x38, 0x02, 0x00,
+  0x20, 0x05, 0x20, 0x14, 0x20, 0x09, 0x93, 0x38, 0x02, 0x00, 0x20, 0x02,
+  0x41, 0x08, 0x6a, 0x21, 0x02, 0x20, 0x04, 0x41, 0x01, 0x6a, 0x21, 0x04,
+  0x20, 0x03, 0x41, 0x7f, 0x6a, 0x22, 0x03, 0x0d, 0x00, 0x0b, 0x20, 0x0f,
+  0x20, 0x0c, 0x6a, 0x21, 0x0f, 0x20, 0x0e, 0x20, 0x0a, 0x6a, 0x22, 0x0e,
+  0x41, 0x80, 0x08, 0x49, 0x0d, 0x00, 0x0b, 0x20, 0x0a, 0x41, 0x01, 0x74,
+  0x22, 0x0a, 0x41, 0x81, 0x08, 0x48, 0x0d, 0x00, 0x0b, 0x20, 0x01, 0x41,
+  0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x0b,
+  0x11, 0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01, 0x74, 0x41, 0x00, 0x10,
+  0x83, 0x80, 0x80, 0x80, 0x00, 0x0b, 0xc9, 0x0d, 0x05, 0x04, 0x7f, 0x01,
+  0x7c, 0x03, 0x7f, 0x04, 0x7c, 0x01, 0x7d, 0x02, 0x40, 0x02, 0x40, 0x20,
+  0x00, 0x41, 0x40, 0x6a, 0x41, 0xc0, 0x07, 0x4b, 0x0d, 0x00, 0x20, 0x00,
+  0x69, 0x41, 0x02, 0x49, 0x0d, 0x01, 0x0b, 0x41, 0x00, 0x41, 0x00, 0x36,
+  0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x0f, 0x0b, 0x41, 0x00, 0x21, 0x03,
+  0x41, 0x00, 0x20, 0x00, 0x36, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x43, 0x00, 0x00, 0x80, 0x3f, 0x20, 0x00, 0xb2, 0x95, 0x38, 0x02,
+  0x84, 0xe8, 0x81, 0x80, 0x00, 0x20, 0x00, 0x41, 0x01, 0x76, 0x41, 0xff,
+  0xff, 0x01, 0x71, 0x21, 0x04, 0x20, 0x00, 0x41, 0x02, 0x76, 0x41, 0xff,
+  0xff, 0x00, 0x71, 0x21, 0x05, 0x20, 0x00, 0x41, 0x03, 0x6c, 0x41, 0x02,
+  0x76, 0x41, 0xff, 0xff, 0x00, 0x71, 0x21, 0x06, 0x20, 0x00, 0xb7, 0x21,
+  0x07, 0x41, 0x00, 0x21, 0x08, 0x41, 0x00, 0x21, 0x00, 0x03, 0x40, 0x20,
+  0x00, 0x20, 0x05, 0x6e, 0x22, 0x09, 0x41, 0x03, 0x71, 0x21, 0x0a, 0x02,
+  0x40, 0x02, 0x40, 0x20, 0x00, 0x20, 0x09, 0x20, 0x05, 0x6c, 0x6b, 0x22,
+  0x09, 0x41, 0x01, 0x74, 0x20, 0x05, 0x4b, 0x0d, 0x00, 0x20, 0x09, 0xb7,
+  0x44, 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40, 0xa2, 0x20, 0x07,
+  0xa3, 0x22, 0x0b, 0x20, 0x0b, 0x9a, 0xa2, 0x22, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0xa2, 0x22, 0x0d, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xa0, 0x20, 0x0d, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0xa3, 0xa2, 0x22, 0x0d,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40,
+  0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40,
+  0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x60, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66, 0x40,
+  0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x40,
+  0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0x77, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0xa0, 0x21,
+  0x0d, 0x20, 0x0b, 0x20, 0x0b, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x40, 0xa3, 0xa2, 0x22, 0x0e, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0xa3, 0x20, 0x0e, 0xa2,
+  0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x45, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40, 0xa3, 0x20, 0x0b, 0xa2,
+  0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x5b, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x63, 0x40, 0xa3, 0x20, 0x0b, 0xa2,
+  0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x6a, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x40, 0xa3, 0x20, 0x0b, 0xa2,
+  0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x75, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7a, 0x40, 0xa3, 0x20, 0x0b, 0xa2,
+  0xa0, 0x21, 0x0b, 0x0c, 0x01, 0x0b, 0x20, 0x05, 0x20, 0x09, 0x6b, 0xb7,
+  0x44, 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40, 0xa2, 0x20, 0x07,
+  0xa3, 0x22, 0x0d, 0x20, 0x0d, 0x9a, 0xa2, 0x22, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0xa2, 0x22, 0x0b, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xa0, 0x20, 0x0b, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0xa3, 0xa2, 0x22, 0x0b,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x40,
+  0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x40,
+  0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x60, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66, 0x40,
+  0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b,
+  0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x40,
+  0xa3, 0x20, 0x0b, 0xa2, 0x22, 0x0b, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0x77, 0x40, 0xa3, 0x20, 0x0b, 0xa2, 0xa0, 0x21,
+  0x0b, 0x20, 0x0d, 0x20, 0x0d, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x40, 0xa3, 0xa2, 0x22, 0x0e, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0xa3, 0x20, 0x0e, 0xa2,
+  0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x45, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x40, 0xa3, 0x20, 0x0d, 0xa2,
+  0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x5b, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x63, 0x40, 0xa3, 0x20, 0x0d, 0xa2,
+  0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x6a, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x40, 0xa3, 0x20, 0x0d, 0xa2,
+  0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x75, 0x40, 0xa3, 0x20, 0x0d, 0xa2, 0x22, 0x0d, 0xa0, 0x20, 0x0c, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7a, 0x40, 0xa3, 0x20, 0x0d, 0xa2,
+  0xa0, 0x21, 0x0d, 0x0b, 0x20, 0x0b, 0x21, 0x0c, 0x02, 0x40, 0x02, 0x40,
+  0x02, 0x40, 0x02, 0x40, 0x20, 0x0a, 0x0e, 0x03, 0x00, 0x01, 0x02, 0x03,
+  0x0b, 0x20, 0x0d, 0x21, 0x0c, 0x20, 0x0b, 0x9a, 0x21, 0x0d, 0x0c, 0x02,
+  0x0b, 0x20, 0x0d, 0x9a, 0x21, 0x0d, 0x20, 0x0b, 0x9a, 0x21, 0x0c, 0x0c,
+  0x01, 0x0b, 0x20, 0x0d, 0x9a, 0x21, 0x0c, 0x20, 0x0b, 0x21, 0x0d, 0x0b,
+  0x20, 0x08, 0x41, 0x90, 0x80, 0x82, 0x80, 0x00, 0x6a, 0x20, 0x0d, 0xb6,
+  0x38, 0x02, 0x00, 0x20, 0x08, 0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a,
+  0x20, 0x0c, 0xb6, 0x38, 0x02, 0x00, 0x02, 0x40, 0x20, 0x00, 0x20, 0x04,
+  0x4f, 0x0d, 0x00, 0x02, 0x40, 0x02, 0x40, 0x20, 0x0d, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0xff, 0xdf, 0x40, 0xa2, 0x22, 0x0d, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0xbf, 0x20, 0x0d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x1b, 0xa0, 0x22, 0x0d, 0x99, 0x44, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0x41, 0x63, 0x45, 0x0d, 0x00, 0x20, 0x0d, 0xaa,
+  0x21, 0x09, 0x0c, 0x01, 0x0b, 0x41, 0x80, 0x80, 0x80, 0x80, 0x78, 0x21,
+  0x09, 0x0b, 0x20, 0x03, 0x41, 0x90, 0xa0, 0x82, 0x80, 0x00, 0x6a, 0x20,
+  0x09, 0x3b, 0x01, 0x00, 0x02, 0x40, 0x02, 0x40, 0x20, 0x0c, 0x44, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0xff, 0xdf, 0x40, 0xa2, 0x22, 0x0c, 0x44, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0xbf, 0x20, 0x0c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x66, 0x1b, 0xa0, 0x22, 0x0c, 0x99, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x63, 0x45, 0x0d, 0x00, 0x20, 0x0c,
+  0xaa, 0x21, 0x09, 0x0c, 0x01, 0x0b, 0x41, 0x80, 0x80, 0x80, 0x80, 0x78,
+  0x21, 0x09, 0x0b, 0x20, 0x03, 0x41, 0x90, 0x98, 0x82, 0x80, 0x00, 0x6a,
+  0x20, 0x09, 0x3b, 0x01, 0x00, 0x0b, 0x20, 0x03, 0x41, 0x02, 0x6a, 0x21,
+  0x03, 0x20, 0x08, 0x41, 0x04, 0x6a, 0x21, 0x08, 0x20, 0x06, 0x20, 0x00,
+  0x41, 0x01, 0x6a, 0x22, 0x00, 0x47, 0x0d, 0x00, 0x0b, 0x02, 0x40, 0x20,
+  0x01, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40,
+  0x20, 0x02, 0x45, 0x0d, 0x00, 0x20, 0x01, 0x41, 0x03, 0x71, 0x21, 0x05,
+  0x20, 0x01, 0x41, 0x7f, 0x6a, 0x41, 0x03, 0x4f, 0x0d, 0x01, 0x41, 0x2a,
+  0x21, 0x08, 0x41, 0x00, 0x21, 0x03, 0x0c, 0x02, 0x0b, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x21, 0x09, 0x02, 0x40, 0x02, 0x40, 0x20, 0x01, 0x41, 0x01,
+  0x47, 0x0d, 0x00, 0x43, 0x00, 0x30, 0x81, 0x3e, 0x21, 0x0f, 0x41, 0x00,
+  0x21, 0x08, 0x0c, 0x01, 0x0b, 0x20, 0x01, 0x41, 0x7e, 0x71, 0x21, 0x03,
+  0x41, 0x2a, 0x21, 0x05, 0x41, 0x00, 0x21, 0x08, 0x41, 0x84, 0xa8, 0x81,
+  0x80, 0x00, 0x21, 0x00, 0x03, 0x40, 0x20, 0x00, 0x20, 0x05, 0x41, 0x8d,
+  0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22,
+  0x05, 0x41, 0x11, 0x75, 0xb2, 0x43, 0x00, 0x00, 0x00, 0x38, 0x94, 0x38,
+  0x02, 0x00, 0x20, 0x00, 0x41, 0x04, 0x6a, 0x20, 0x05, 0x41, 0x8d, 0xcc,
+  0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x05,
+  0x41, 0x11, 0x75, 0xb2, 0x43, 0x00, 0x00, 0x00, 0x38, 0x94, 0x38, 0x02,
+  0x00, 0x20, 0x00, 0x41, 0x08, 0x6a, 0x21, 0x00, 0x20, 0x03, 0x20, 0x08,
+  0x41, 0x02, 0x6a, 0x22, 0x08, 0x47, 0x0d, 0x00, 0x0b, 0x20, 0x05, 0x41,
+  0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a,
+  0x41, 0x11, 0x75, 0xb2, 0x43, 0x00, 0x00, 0x00, 0x38, 0x94, 0x21, 0x0f,
+  0x0b, 0x20, 0x09, 0x45, 0x0d, 0x02, 0x20, 0x08, 0x41, 0x02, 0x74, 0x41,
+  0x84, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x20, 0x0f, 0x38, 0x02, 0x00, 0x0f,
+  0x0b, 0x20, 0x01, 0x41, 0x7c, 0x71, 0x21, 0x09, 0x41, 0x2a, 0x21, 0x08,
+  0x41, 0x00, 0x21, 0x03, 0x41, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x21, 0x00,
+  0x03, 0x40, 0x20, 0x00, 0x20, 0x08, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c,
+  0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x08, 0x41, 0x11, 0x75,
+  0x3b, 0x01, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6a, 0x20, 0x08, 0x41, 0x8d,
+  0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22,
+  0x08, 0x41, 0x11, 0x75, 0x3b, 0x01, 0x00, 0x20, 0x00, 0x41, 0x04, 0x6a,
+  0x20, 0x08, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb,
+  0xe3, 0x03, 0x6a, 0x22, 0x08, 0x41, 0x11, 0x75, 0x3b, 0x01, 0x00, 0x20,
+  0x00, 0x41, 0x06, 0x6a, 0x20, 0x08, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c,
+  0x41, 0xdf, 0xe6, 0xbb, 0xe3, 0x03, 0x6a, 0x22, 0x08, 0x41, 0x11, 0x75,
+  0x3b, 0x01, 0x00, 0x20, 0x00, 0x41, 0x08, 0x6a, 0x21, 0x00, 0x20, 0x09,
+  0x20, 0x03, 0x41, 0x04, 0x6a, 0x22, 0x03, 0x47, 0x0d, 0x00, 0x0b, 0x0b,
+  0x20, 0x05, 0x45, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x01, 0x74, 0x41, 0x84,
+  0xa8, 0x81, 0x80, 0x00, 0x6a, 0x21, 0x00, 0x03, 0x40, 0x20, 0x00, 0x20,
+  0x08, 0x41, 0x8d, 0xcc, 0xe5, 0x00, 0x6c, 0x41, 0xdf, 0xe6, 0xbb, 0xe3,
+  0x03, 0x6a, 0x22, 0x08, 0x41, 0x11, 0x75, 0x3b, 0x01, 0x00, 0x20, 0x00,
+  0x41, 0x02, 0x6a, 0x21, 0x00, 0x20, 0x05, 0x41, 0x7f, 0x6a, 0x22, 0x05,
+  0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x9b, 0x05, 0x06, 0x01, 0x7f, 0x01, 0x7d,
+  0x0c, 0x7f, 0x04, 0x7d, 0x01, 0x7f, 0x03, 0x7d, 0x02, 0x40, 0x41, 0x00,
+  0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00,
+  0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x2a, 0x02, 0x84,
+  0xe8, 0x81, 0x80, 0x00, 0x21, 0x02, 0x02, 0x40, 0x02, 0x40, 0x20, 0x01,
+  0x41, 0x01, 0x48, 0x0d, 0x00, 0x02, 0x40, 0x20, 0x01, 0x41, 0x01, 0x46,
+  0x0d, 0x00, 0x41, 0x00, 0x21, 0x03, 0x03, 0x40, 0x41, 0x00, 0x21, 0x04,
+  0x41, 0x00, 0x21, 0x05, 0x03, 0x40, 0x20, 0x05, 0x41, 0x03, 0x74, 0x22,
+  0x06, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x04, 0x41, 0x03,
+  0x74, 0x22, 0x07, 0x41, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02,
+  0x00, 0x38, 0x02, 0x00, 0x20, 0x06, 0x41, 0x88, 0xe8, 0x80, 0x80, 0x00,
+  0x6a, 0x20, 0x07, 0x41, 0x88, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02,
+  0x00, 0x38, 0x02, 0x00, 0x20, 0x01, 0x21, 0x06, 0x03, 0x40, 0x20, 0x06,
+  0x41, 0x01, 0x75, 0x22, 0x06, 0x20, 0x05, 0x22, 0x07, 0x73, 0x21, 0x05,
+  0x20, 0x06, 0x20, 0x07, 0x71, 0x0d, 0x00, 0x0b, 0x20, 0x06, 0x20, 0x07,
+  0x72, 0x21, 0x05, 0x20, 0x04, 0x41, 0x01, 0x6a, 0x22, 0x04, 0x20, 0x01,
+  0x47, 0x0d, 0x00, 0x0b, 0x41, 0x02, 0x21, 0x08, 0x03, 0x40, 0x20, 0x01,
+  0x20, 0x08, 0x6d, 0x21, 0x05, 0x02, 0x40, 0x20, 0x08, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x20, 0x08, 0x41, 0x01, 0x75, 0x22, 0x06, 0x41, 0x01, 0x20,
+  0x06, 0x41, 0x01, 0x4a, 0x1b, 0x21, 0x09, 0x20, 0x06, 0x41, 0x03, 0x74,
+  0x21, 0x0a, 0x20, 0x08, 0x41, 0x03, 0x74, 0x21, 0x0b, 0x20, 0x05, 0x41,
+  0x02, 0x74, 0x21, 0x0c, 0x41, 0x00, 0x21, 0x0d, 0x41, 0x84, 0xe8, 0x80,
+  0x80, 0x00, 0x21, 0x0e, 0x03, 0x40, 0x20, 0x0e, 0x21, 0x06, 0x41, 0x00,
+  0x21, 0x05, 0x20, 0x09, 0x21, 0x04, 0x03, 0x40, 0x20, 0x06, 0x41, 0x04,
+  0x6a, 0x22, 0x07, 0x20, 0x07, 0x2a, 0x02, 0x00, 0x22, 0x0f, 0x20, 0x05,
+  0x41, 0x90, 0x80, 0x82, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x10,
+  0x20, 0x06, 0x20, 0x0a, 0x6a, 0x22, 0x07, 0x2a, 0x02, 0x00, 0x22, 0x11,
+  0x94, 0x20, 0x05, 0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02,
+  0x00, 0x22, 0x12, 0x20, 0x07, 0x41, 0x04, 0x6a, 0x22, 0x13, 0x2a, 0x02,
+  0x00, 0x22, 0x14, 0x94, 0x92, 0x22, 0x15, 0x92, 0x38, 0x02, 0x00, 0x20,
+  0x06, 0x20, 0x06, 0x2a, 0x02, 0x00, 0x22, 0x16, 0x20, 0x12, 0x20, 0x11,
+  0x94, 0x20, 0x10, 0x20, 0x14, 0x94, 0x93, 0x22, 0x10, 0x92, 0x38, 0x02,
+  0x00, 0x20, 0x13, 0x20, 0x0f, 0x20, 0x15, 0x93, 0x38, 0x02, 0x00, 0x20,
+  0x07, 0x20, 0x16, 0x20, 0x10, 0x93, 0x38, 0x02, 0x00, 0x20, 0x06, 0x41,
+  0x08, 0x6a, 0x21, 0x06, 0x20, 0x05, 0x20, 0x0c, 0x6a, 0x21, 0x05, 0x20,
+  0x04, 0x41, 0x7f, 0x6a, 0x22, 0x04, 0x0d, 0x00, 0x0b, 0x20, 0x0e, 0x20,
+  0x0b, 0x6a, 0x21, 0x0e, 0x20, 0x0d, 0x20, 0x08, 0x6a, 0x22, 0x0d, 0x20,
+  0x01, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x08, 0x41, 0x01, 0x74, 0x22,
+  0x08, 0x20, 0x01, 0x4c, 0x0d, 0x00, 0x0b, 0x41, 0x00, 0x41, 0x00, 0x2a,
+  0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x20, 0x02, 0x94, 0x38, 0x02, 0x84,
+  0xa8, 0x81, 0x80, 0x00, 0x20, 0x03, 0x41, 0x01, 0x6a, 0x22, 0x03, 0x20,
+  0x00, 0x47, 0x0d, 0x00, 0x0c, 0x04, 0x0b, 0x0b, 0x41, 0x00, 0x41, 0x00,
+  0x2a, 0x02, 0x88, 0xa8, 0x81, 0x80, 0x00, 0x38, 0x02, 0x88, 0xe8, 0x80,
+  0x80, 0x00, 0x20, 0x00, 0x41, 0x07, 0x71, 0x21, 0x06, 0x41, 0x00, 0x2a,
+  0x02, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x21, 0x0f, 0x02, 0x40, 0x02, 0x40,
+  0x20, 0x00, 0x41, 0x7f, 0x6a, 0x41, 0x07, 0x4f, 0x0d, 0x00, 0x0c, 0x01,
+  0x0b, 0x20, 0x00, 0x41, 0x78, 0x71, 0x21, 0x05, 0x03, 0x40, 0x20, 0x0f,
+  0x20, 0x02, 0x94, 0x20, 0x02, 0x94, 0x20, 0x02, 0x94, 0x20, 0x02, 0x94,
+  0x20, 0x02, 0x94, 0x20, 0x02, 0x94, 0x20, 0x02, 0x94, 0x22, 0x10, 0x20,
+  0x02, 0x94, 0x21, 0x0f, 0x20, 0x05, 0x41, 0x78, 0x6a, 0x22, 0x05, 0x0d,
+  0x00, 0x0b, 0x0b, 0x02, 0x40, 0x20, 0x06, 0x45, 0x0d, 0x00, 0x03, 0x40,
+  0x20, 0x0f, 0x22, 0x10, 0x20, 0x02, 0x94, 0x21, 0x0f, 0x20, 0x06, 0x41,
+  0x7f, 0x6a, 0x22, 0x06, 0x0d, 0x00, 0x0b, 0x0b, 0x41, 0x00, 0x20, 0x10,
+  0x38, 0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x0c, 0x01, 0x0b, 0x41, 0x00,
+  0x2a, 0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x20, 0x02, 0x94, 0x21, 0x0f,
+  0x0b, 0x41, 0x00, 0x20, 0x0f, 0x38, 0x02, 0x84, 0xa8, 0x81, 0x80, 0x00,
+  0x0b, 0x0b, 0x90, 0x01, 0x01, 0x03, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x02,
+  0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01,
+  0x45, 0x0d, 0x00, 0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x20,
+  0x01, 0x41, 0x03, 0x74, 0x22, 0x02, 0x45, 0x0d, 0x00, 0x41, 0x00, 0x21,
+  0x01, 0x03, 0x40, 0x20, 0x00, 0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80,
+  0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c,
+  0x20, 0x01, 0x41, 0x85, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8,
+  0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80,
+  0x08, 0x6c, 0x20, 0x01, 0x41, 0x87, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20,
+  0x02, 0x20, 0x01, 0x41, 0x04, 0x6a, 0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b,
+  0x0b, 0x20, 0x00, 0x0b, 0x11, 0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01,
+  0x74, 0x41, 0x00, 0x10, 0x83, 0x80, 0x80, 0x80, 0x00, 0x0b, 0xe0, 0x01,
+  0x01, 0x06, 0x7f, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80,
+  0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00, 0x20, 0x00, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x41, 0x00, 0x21, 0x02, 0x03, 0x40, 0x02, 0x40, 0x20, 0x01,
+  0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x03, 0x41, 0x00, 0x21,
+  0x04, 0x03, 0x40, 0x20, 0x04, 0x41, 0x03, 0x74, 0x22, 0x05, 0x41, 0x84,
+  0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x03, 0x41, 0x03, 0x74, 0x22, 0x06,
+  0x41, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02,
+  0x00, 0x20, 0x05, 0x41, 0x88, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x06,
+  0x41, 0x88, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02,
+  0x00, 0x20, 0x01, 0x21, 0x05, 0x03, 0x40, 0x20, 0x05, 0x41, 0x01, 0x75,
+  0x22, 0x05, 0x20, 0x04, 0x22, 0x06, 0x73, 0x21, 0x04, 0x20, 0x05, 0x20,
+  0x06, 0x71, 0x0d, 0x00, 0x0b, 0x20, 0x05, 0x20, 0x06, 0x72, 0x21, 0x04,
+  0x20, 0x03, 0x41, 0x01, 0x6a, 0x22, 0x03, 0x20, 0x01, 0x47, 0x0d, 0x00,
+  0x0b, 0x0b, 0x20, 0x01, 0x41, 0x01, 0x10, 0x88, 0x80, 0x80, 0x80, 0x00,
+  0x41, 0x00, 0x41, 0x00, 0x2a, 0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x2a, 0x02, 0x84, 0xe8, 0x81, 0x80, 0x00, 0x94, 0x38, 0x02, 0x84,
+  0xa8, 0x81, 0x80, 0x00, 0x20, 0x02, 0x41, 0x01, 0x6a, 0x22, 0x02, 0x20,
+  0x00, 0x46, 0x0d, 0x01, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80,
+  0x00, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b, 0xe9, 0x05, 0x0a, 0x05,
+  0x7f, 0x04, 0x7d, 0x0f, 0x7f, 0x04, 0x7d, 0x02, 0x7f, 0x05, 0x7d, 0x02,
+  0x7f, 0x05, 0x7d, 0x01, 0x7f, 0x01, 0x7d, 0x41, 0x7f, 0x21, 0x02, 0x03,
+  0x40, 0x41, 0x01, 0x20, 0x02, 0x41, 0x01, 0x6a, 0x22, 0x02, 0x74, 0x20,
+  0x00, 0x48, 0x0d, 0x00, 0x0b, 0x41, 0x01, 0x21, 0x03, 0x02, 0x40, 0x20,
+  0x02, 0x41, 0x01, 0x71, 0x45, 0x0d, 0x00, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x4e, 0x0d, 0x00, 0x41, 0x02, 0x21, 0x03, 0x0c, 0x01, 0x0b, 0x41,
+  0x00, 0x21, 0x04, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x21, 0x02, 0x03,
+  0x40, 0x20, 0x02, 0x41, 0x0c, 0x6a, 0x22, 0x05, 0x20, 0x02, 0x41, 0x04,
+  0x6a, 0x22, 0x06, 0x2a, 0x02, 0x00, 0x22, 0x07, 0x20, 0x05, 0x2a, 0x02,
+  0x00, 0x22, 0x08, 0x93, 0x38, 0x02, 0x00, 0x20, 0x02, 0x41, 0x08, 0x6a,
+  0x22, 0x05, 0x20, 0x02, 0x2a, 0x02, 0x00, 0x22, 0x09, 0x20, 0x05, 0x2a,
+  0x02, 0x00, 0x22, 0x0a, 0x93, 0x38, 0x02, 0x00, 0x20, 0x06, 0x20, 0x07,
+  0x20, 0x08, 0x92, 0x38, 0x02, 0x00, 0x20, 0x02, 0x20, 0x09, 0x20, 0x0a,
+  0x92, 0x38, 0x02, 0x00, 0x20, 0x02, 0x41, 0x10, 0x6a, 0x21, 0x02, 0x41,
+  0x02, 0x21, 0x03, 0x20, 0x04, 0x41, 0x02, 0x6a, 0x22, 0x04, 0x20, 0x00,
+  0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x02, 0x40, 0x20, 0x03, 0x41, 0x02, 0x74,
+  0x22, 0x02, 0x20, 0x00, 0x4a, 0x0d, 0x00, 0x20, 0x00, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x20, 0x01, 0x41, 0x02, 0x74, 0x21, 0x0b, 0x20, 0x01, 0x41,
+  0x03, 0x74, 0x21, 0x0c, 0x20, 0x01, 0x41, 0x0c, 0x6c, 0x21, 0x0d, 0x03,
+  0x40, 0x20, 0x00, 0x20, 0x02, 0x22, 0x0e, 0x6d, 0x21, 0x02, 0x02, 0x40,
+  0x20, 0x03, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x18, 0x6c,
+  0x21, 0x0f, 0x20, 0x03, 0x41, 0x04, 0x74, 0x21, 0x10, 0x20, 0x03, 0x41,
+  0x03, 0x74, 0x21, 0x11, 0x20, 0x0e, 0x41, 0x03, 0x74, 0x21, 0x12, 0x20,
+  0x0b, 0x20, 0x02, 0x6c, 0x21, 0x13, 0x20, 0x0c, 0x20, 0x02, 0x6c, 0x21,
+  0x14, 0x20, 0x0d, 0x20, 0x02, 0x6c, 0x21, 0x15, 0x41, 0x00, 0x21, 0x16,
+  0x41, 0x88, 0xe8, 0x80, 0x80, 0x00, 0x21, 0x17, 0x03, 0x40, 0x20, 0x17,
+  0x21, 0x02, 0x41, 0x00, 0x21, 0x04, 0x41, 0x00, 0x21, 0x05, 0x41, 0x00,
+  0x21, 0x06, 0x20, 0x03, 0x21, 0x18, 0x03, 0x40, 0x20, 0x02, 0x20, 0x02,
+  0x2a, 0x02, 0x00, 0x22, 0x07, 0x20, 0x05, 0x41, 0x90, 0x80, 0x82, 0x80,
+  0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x08, 0x20, 0x02, 0x20, 0x11, 0x6a,
+  0x22, 0x01, 0x41, 0x7c, 0x6a, 0x22, 0x19, 0x2a, 0x02, 0x00, 0x22, 0x09,
+  0x94, 0x20, 0x05, 0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02,
+  0x00, 0x22, 0x0a, 0x20, 0x01, 0x2a, 0x02, 0x00, 0x22, 0x1a, 0x94, 0x92,
+  0x22, 0x1b, 0x92, 0x22, 0x1c, 0x20, 0x04, 0x41, 0x90, 0x80, 0x82, 0x80,
+  0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x1d, 0x20, 0x02, 0x20, 0x10, 0x6a,
+  0x22, 0x1e, 0x41, 0x7c, 0x6a, 0x22, 0x1f, 0x2a, 0x02, 0x00, 0x22, 0x20,
+  0x94, 0x20, 0x04, 0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02,
+  0x00, 0x22, 0x21, 0x20, 0x1e, 0x2a, 0x02, 0x00, 0x22, 0x22, 0x94, 0x92,
+  0x22, 0x23, 0x20, 0x06, 0x41, 0x90, 0x80, 0x82, 0x80, 0x00, 0x6a, 0x2a,
+  0x02, 0x00, 0x22, 0x24, 0x20, 0x02, 0x20, 0x0f, 0x6a, 0x22, 0x25, 0x41,
+  0x7c, 0x6a, 0x22, 0x26, 0x2a, 0x02, 0x00, 0x22, 0x27, 0x94, 0x20, 0x06,
+  0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x28,
+  0x20, 0x25, 0x2a, 0x02, 0x00, 0x22, 0x29, 0x94, 0x92, 0x22, 0x2a, 0x92,
+  0x22, 0x2b, 0x92, 0x38, 0x02, 0x00, 0x20, 0x02, 0x41, 0x7c, 0x6a, 0x22,
+  0x2c, 0x20, 0x2c, 0x2a, 0x02, 0x00, 0x22, 0x2d, 0x20, 0x0a, 0x20, 0x09,
+  0x94, 0x20, 0x08, 0x20, 0x1a, 0x94, 0x93, 0x22, 0x08, 0x92, 0x22, 0x09,
+  0x20, 0x21, 0x20, 0x20, 0x94, 0x20, 0x1d, 0x20, 0x22, 0x94, 0x93, 0x22,
+  0x0a, 0x20, 0x28, 0x20, 0x27, 0x94, 0x20, 0x24, 0x20, 0x29, 0x94, 0x93,
+  0x22, 0x1a, 0x92, 0x22, 0x1d, 0x92, 0x38, 0x02, 0x00, 0x20, 0x1e, 0x20,
+  0x1c, 0x20, 0x2b, 0x93, 0x38, 0x02, 0x00, 0x20, 0x1f, 0x20, 0x09, 0x20,
+  0x1d, 0x93, 0x38, 0x02, 0x00, 0x20, 0x01, 0x20, 0x07, 0x20, 0x1b, 0x93,
+  0x22, 0x07, 0x20, 0x0a, 0x20, 0x1a, 0x93, 0x22, 0x09, 0x93, 0x38, 0x02,
+  0x00, 0x20, 0x19, 0x20, 0x2d, 0x20, 0x08, 0x93, 0x22, 0x08, 0x20, 0x23,
+  0x20, 0x2a, 0x93, 0x22, 0x0a, 0x92, 0x38, 0x02, 0x00, 0x20, 0x25, 0x20,
+  0x07, 0x20, 0x09, 0x92, 0x38, 0x02, 0x00, 0x20, 0x26, 0x20, 0x08, 0x20,
+  0x0a, 0x93, 0x38, 0x02, 0x00, 0x20, 0x02, 0x41, 0x08, 0x6a, 0x21, 0x02,
+  0x20, 0x04, 0x20, 0x13, 0x6a, 0x21, 0x04, 0x20, 0x05, 0x20, 0x14, 0x6a,
+  0x21, 0x05, 0x20, 0x06, 0x20, 0x15, 0x6a, 0x21, 0x06, 0x20, 0x18, 0x41,
+  0x7f, 0x6a, 0x22, 0x18, 0x0d, 0x00, 0x0b, 0x20, 0x17, 0x20, 0x12, 0x6a,
+  0x21, 0x17, 0x20, 0x16, 0x20, 0x0e, 0x6a, 0x22, 0x16, 0x20, 0x00, 0x48,
+  0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x0e, 0x21, 0x03, 0x20, 0x0e, 0x41, 0x02,
+  0x74, 0x22, 0x02, 0x20, 0x00, 0x4c, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x90,
+  0x01, 0x01, 0x03, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x02, 0x40, 0x41, 0x00,
+  0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00,
+  0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x20, 0x01, 0x41, 0x03,
+  0x74, 0x22, 0x02, 0x45, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40,
+  0x20, 0x00, 0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41,
+  0x85, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93,
+  0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20,
+  0x01, 0x41, 0x87, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x02, 0x20, 0x01,
+  0x41, 0x04, 0x6a, 0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x00,
+  0x0b, 0x11, 0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01, 0x74, 0x41, 0x00,
+  0x10, 0x83, 0x80, 0x80, 0x80, 0x00, 0x0b, 0xe6, 0x01, 0x01, 0x06, 0x7f,
+  0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22,
+  0x01, 0x45, 0x0d, 0x00, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41,
+  0x00, 0x21, 0x02, 0x03, 0x40, 0x02, 0x40, 0x20, 0x01, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x41, 0x00, 0x21, 0x03, 0x41, 0x00, 0x21, 0x04, 0x03, 0x40,
+  0x20, 0x04, 0x41, 0x03, 0x74, 0x22, 0x05, 0x41, 0x84, 0xe8, 0x80, 0x80,
+  0x00, 0x6a, 0x20, 0x03, 0x41, 0x03, 0x74, 0x22, 0x06, 0x41, 0x84, 0xa8,
+  0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x00, 0x20, 0x05,
+  0x41, 0x88, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x06, 0x41, 0x88, 0xa8,
+  0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x00, 0x20, 0x01,
+  0x21, 0x05, 0x03, 0x40, 0x20, 0x05, 0x41, 0x01, 0x75, 0x22, 0x05, 0x20,
+  0x04, 0x22, 0x06, 0x73, 0x21, 0x04, 0x20, 0x05, 0x20, 0x06, 0x71, 0x0d,
+  0x00, 0x0b, 0x20, 0x05, 0x20, 0x06, 0x72, 0x21, 0x04, 0x20, 0x03, 0x41,
+  0x01, 0x6a, 0x22, 0x03, 0x20, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x41,
+  0x84, 0xe8, 0x80, 0x80, 0x00, 0x20, 0x01, 0x41, 0x01, 0x10, 0x8c, 0x80,
+  0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x00, 0x2a, 0x02, 0x84, 0xe8, 0x80,
+  0x80, 0x00, 0x41, 0x00, 0x2a, 0x02, 0x84, 0xe8, 0x81, 0x80, 0x00, 0x94,
+  0x38, 0x02, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x20, 0x02, 0x41, 0x01, 0x6a,
+  0x22, 0x02, 0x20, 0x00, 0x46, 0x0d, 0x01, 0x41, 0x00, 0x28, 0x02, 0x80,
+  0xe8, 0x80, 0x80, 0x00, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b, 0x8e,
+  0x04, 0x09, 0x04, 0x7d, 0x09, 0x7f, 0x02, 0x7d, 0x01, 0x7f, 0x03, 0x7d,
+  0x01, 0x7f, 0x02, 0x7d, 0x01, 0x7f, 0x04, 0x7d, 0x02, 0x40, 0x20, 0x01,
+  0x41, 0x02, 0x48, 0x0d, 0x00, 0x02, 0x40, 0x20, 0x01, 0x41, 0x02, 0x47,
+  0x0d, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2a, 0x02, 0x00, 0x22, 0x03, 0x20,
+  0x00, 0x2a, 0x02, 0x08, 0x22, 0x04, 0x92, 0x38, 0x02, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x2a, 0x02, 0x04, 0x22, 0x05, 0x20, 0x00, 0x2a, 0x02, 0x0c,
+  0x22, 0x06, 0x93, 0x38, 0x02, 0x0c, 0x20, 0x00, 0x20, 0x03, 0x20, 0x04,
+  0x93, 0x38, 0x02, 0x08, 0x20, 0x00, 0x20, 0x05, 0x20, 0x06, 0x92, 0x38,
+  0x02, 0x04, 0x0f, 0x0b, 0x20, 0x00, 0x20, 0x01, 0x41, 0x01, 0x76, 0x20,
+  0x02, 0x41, 0x01, 0x74, 0x10, 0x8c, 0x80, 0x80, 0x80, 0x00, 0x20, 0x00,
+  0x20, 0x01, 0x41, 0xfc, 0xff, 0xff, 0xff, 0x03, 0x71, 0x41, 0x02, 0x74,
+  0x6a, 0x20, 0x01, 0x41, 0x02, 0x76, 0x22, 0x07, 0x20, 0x02, 0x41, 0x02,
+  0x74, 0x22, 0x08, 0x10, 0x8c, 0x80, 0x80, 0x80, 0x00, 0x20, 0x00, 0x20,
+  0x07, 0x41, 0x18, 0x6c, 0x22, 0x09, 0x6a, 0x20, 0x07, 0x20, 0x08, 0x10,
+  0x8c, 0x80, 0x80, 0x80, 0x00, 0x20, 0x01, 0x41, 0x04, 0x49, 0x0d, 0x00,
+  0x20, 0x07, 0x41, 0x01, 0x20, 0x07, 0x41, 0x01, 0x4b, 0x1b, 0x21, 0x0a,
+  0x20, 0x02, 0x41, 0x0c, 0x6c, 0x21, 0x0b, 0x20, 0x07, 0x41, 0x04, 0x74,
+  0x21, 0x0c, 0x20, 0x07, 0x41, 0x03, 0x74, 0x21, 0x0d, 0x41, 0x00, 0x21,
+  0x01, 0x41, 0x00, 0x21, 0x02, 0x03, 0x40, 0x20, 0x00, 0x20, 0x0d, 0x6a,
+  0x22, 0x07, 0x41, 0x04, 0x6a, 0x22, 0x0e, 0x2a, 0x02, 0x00, 0x21, 0x03,
+  0x20, 0x00, 0x41, 0x04, 0x6a, 0x22, 0x0f, 0x20, 0x0f, 0x2a, 0x02, 0x00,
+  0x22, 0x05, 0x20, 0x01, 0x41, 0x90, 0x80, 0x82, 0x80, 0x00, 0x6a, 0x2a,
+  0x02, 0x00, 0x22, 0x06, 0x20, 0x00, 0x20, 0x0c, 0x6a, 0x22, 0x0f, 0x2a,
+  0x02, 0x00, 0x22, 0x10, 0x94, 0x20, 0x01, 0x41, 0x90, 0xe8, 0x81, 0x80,
+  0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x11, 0x20, 0x0f, 0x41, 0x04, 0x6a,
+  0x22, 0x12, 0x2a, 0x02, 0x00, 0x22, 0x13, 0x94, 0x92, 0x22, 0x14, 0x20,
+  0x02, 0x41, 0x90, 0x80, 0x82, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22,
+  0x15, 0x20, 0x00, 0x20, 0x09, 0x6a, 0x22, 0x16, 0x2a, 0x02, 0x00, 0x22,
+  0x17, 0x94, 0x20, 0x02, 0x41, 0x90, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a,
+  0x02, 0x00, 0x22, 0x18, 0x20, 0x16, 0x41, 0x04, 0x6a, 0x22, 0x19, 0x2a,
+  0x02, 0x00, 0x22, 0x1a, 0x94, 0x92, 0x22, 0x1b, 0x92, 0x22, 0x1c, 0x92,
+  0x38, 0x02, 0x00, 0x20, 0x07, 0x2a, 0x02, 0x00, 0x21, 0x04, 0x20, 0x00,
+  0x20, 0x00, 0x2a, 0x02, 0x00, 0x22, 0x1d, 0x20, 0x11, 0x20, 0x10, 0x94,
+  0x20, 0x06, 0x20, 0x13, 0x94, 0x93, 0x22, 0x06, 0x20, 0x18, 0x20, 0x17,
+  0x94, 0x20, 0x15, 0x20, 0x1a, 0x94, 0x93, 0x22, 0x10, 0x92, 0x22, 0x11,
+  0x92, 0x38, 0x02, 0x00, 0x20, 0x12, 0x20, 0x05, 0x20, 0x1c, 0x93, 0x38,
+  0x02, 0x00, 0x20, 0x0f, 0x20, 0x1d, 0x20, 0x11, 0x93, 0x38, 0x02, 0x00,
+  0x20, 0x0e, 0x20, 0x03, 0x20, 0x06, 0x20, 0x10, 0x93, 0x22, 0x05, 0x93,
+  0x38, 0x02, 0x00, 0x20, 0x07, 0x20, 0x04, 0x20, 0x14, 0x20, 0x1b, 0x93,
+  0x22, 0x06, 0x92, 0x38, 0x02, 0x00, 0x20, 0x19, 0x20, 0x05, 0x20, 0x03,
+  0x92, 0x38, 0x02, 0x00, 0x20, 0x16, 0x20, 0x04, 0x20, 0x06, 0x93, 0x38,
+  0x02, 0x00, 0x20, 0x01, 0x20, 0x08, 0x6a, 0x21, 0x01, 0x20, 0x02, 0x20,
+  0x0b, 0x6a, 0x21, 0x02, 0x20, 0x00, 0x41, 0x08, 0x6a, 0x21, 0x00, 0x20,
+  0x0a, 0x41, 0x7f, 0x6a, 0x22, 0x0a, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x90,
+  0x01, 0x01, 0x03, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x02, 0x40, 0x41, 0x00,
+  0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00,
+  0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x20, 0x01, 0x41, 0x03,
+  0x74, 0x22, 0x02, 0x45, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40,
+  0x20, 0x00, 0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41,
+  0x85, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93,
+  0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20,
+  0x01, 0x41, 0x87, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x02, 0x20, 0x01,
+  0x41, 0x04, 0x6a, 0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x00,
+  0x0b, 0x0e, 0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x00, 0x10, 0x83, 0x80,
+  0x80, 0x80, 0x00, 0x0b, 0x97, 0x04, 0x04, 0x07, 0x7f, 0x02, 0x7d, 0x01,
+  0x7f, 0x06, 0x7d, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80,
+  0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00, 0x20, 0x00, 0x41, 0x01, 0x48,
+  0x0d, 0x00, 0x41, 0x00, 0x21, 0x02, 0x03, 0x40, 0x20, 0x01, 0x41, 0x02,
+  0x6d, 0x21, 0x03, 0x02, 0x40, 0x20, 0x01, 0x41, 0x02, 0x48, 0x0d, 0x00,
+  0x41, 0x00, 0x21, 0x04, 0x41, 0x00, 0x21, 0x05, 0x03, 0x40, 0x20, 0x05,
+  0x41, 0x03, 0x74, 0x22, 0x06, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a,
+  0x20, 0x04, 0x41, 0x03, 0x74, 0x22, 0x07, 0x41, 0x84, 0xa8, 0x81, 0x80,
+  0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x00, 0x20, 0x06, 0x41, 0x88,
+  0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x07, 0x41, 0x88, 0xa8, 0x81, 0x80,
+  0x00, 0x6a, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x00, 0x20, 0x03, 0x21, 0x06,
+  0x03, 0x40, 0x20, 0x06, 0x41, 0x01, 0x75, 0x22, 0x06, 0x20, 0x05, 0x22,
+  0x07, 0x73, 0x21, 0x05, 0x20, 0x06, 0x20, 0x07, 0x71, 0x0d, 0x00, 0x0b,
+  0x20, 0x06, 0x20, 0x07, 0x72, 0x21, 0x05, 0x20, 0x04, 0x41, 0x01, 0x6a,
+  0x22, 0x04, 0x20, 0x03, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x03, 0x41,
+  0x02, 0x10, 0x88, 0x80, 0x80, 0x80, 0x00, 0x41, 0x00, 0x41, 0x00, 0x2a,
+  0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x08, 0x41, 0x00, 0x2a, 0x02,
+  0x88, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x09, 0x93, 0x38, 0x02, 0x88, 0xe8,
+  0x80, 0x80, 0x00, 0x41, 0x00, 0x20, 0x08, 0x20, 0x09, 0x92, 0x22, 0x08,
+  0x38, 0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x02, 0x40, 0x41, 0x00, 0x28,
+  0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x41, 0x04, 0x48, 0x0d,
+  0x00, 0x20, 0x01, 0x41, 0x01, 0x75, 0x22, 0x06, 0x41, 0x02, 0x6d, 0x22,
+  0x05, 0x41, 0x01, 0x20, 0x05, 0x41, 0x01, 0x4a, 0x1b, 0x41, 0x02, 0x74,
+  0x21, 0x0a, 0x20, 0x06, 0x41, 0x03, 0x74, 0x41, 0xfc, 0xe7, 0x80, 0x80,
+  0x00, 0x6a, 0x21, 0x06, 0x41, 0x00, 0x21, 0x07, 0x41, 0x90, 0xe8, 0x80,
+  0x80, 0x00, 0x21, 0x05, 0x03, 0x40, 0x20, 0x05, 0x20, 0x05, 0x2a, 0x02,
+  0x00, 0x22, 0x08, 0x20, 0x06, 0x41, 0x04, 0x6a, 0x22, 0x04, 0x2a, 0x02,
+  0x00, 0x22, 0x09, 0x93, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x22, 0x0b,
+  0x20, 0x07, 0x41, 0x94, 0xe8, 0x81, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00,
+  0x22, 0x0c, 0x20, 0x06, 0x2a, 0x02, 0x00, 0x22, 0x0d, 0x20, 0x05, 0x41,
+  0x7c, 0x6a, 0x22, 0x03, 0x2a, 0x02, 0x00, 0x22, 0x0e, 0x93, 0x43, 0x00,
+  0x00, 0x00, 0x3f, 0x94, 0x22, 0x0f, 0x94, 0x20, 0x07, 0x41, 0x94, 0x80,
+  0x82, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x10, 0x20, 0x08, 0x20,
+  0x09, 0x92, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x22, 0x08, 0x94, 0x92,
+  0x22, 0x09, 0x92, 0x38, 0x02, 0x00, 0x20, 0x03, 0x20, 0x0e, 0x20, 0x0d,
+  0x92, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x22, 0x0d, 0x20, 0x0c, 0x20,
+  0x08, 0x94, 0x20, 0x0f, 0x20, 0x10, 0x94, 0x93, 0x22, 0x08, 0x92, 0x38,
+  0x02, 0x00, 0x20, 0x06, 0x20, 0x0d, 0x20, 0x08, 0x93, 0x38, 0x02, 0x00,
+  0x20, 0x04, 0x20, 0x09, 0x20, 0x0b, 0x93, 0x38, 0x02, 0x00, 0x20, 0x06,
+  0x41, 0x78, 0x6a, 0x21, 0x06, 0x20, 0x05, 0x41, 0x08, 0x6a, 0x21, 0x05,
+  0x20, 0x0a, 0x20, 0x07, 0x41, 0x04, 0x6a, 0x22, 0x07, 0x47, 0x0d, 0x00,
+  0x0b, 0x41, 0x00, 0x2a, 0x02, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x21, 0x08,
+  0x0b, 0x41, 0x00, 0x20, 0x08, 0x41, 0x00, 0x2a, 0x02, 0x84, 0xe8, 0x81,
+  0x80, 0x00, 0x94, 0x38, 0x02, 0x84, 0xa8, 0x81, 0x80, 0x00, 0x20, 0x02,
+  0x41, 0x01, 0x6a, 0x22, 0x02, 0x20, 0x00, 0x47, 0x0d, 0x00, 0x0b, 0x0b,
+  0x0b, 0x90, 0x01, 0x01, 0x03, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x02, 0x40,
+  0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45,
+  0x0d, 0x00, 0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x20, 0x01,
+  0x41, 0x02, 0x74, 0x22, 0x02, 0x45, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01,
+  0x03, 0x40, 0x20, 0x00, 0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00,
+  0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20,
+  0x01, 0x41, 0x85, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8, 0x80,
+  0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08,
+  0x6c, 0x20, 0x01, 0x41, 0x87, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x02,
+  0x20, 0x01, 0x41, 0x04, 0x6a, 0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b,
+  0x20, 0x00, 0x0b, 0x11, 0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01, 0x74,
+  0x41, 0x01, 0x10, 0x83, 0x80, 0x80, 0x80, 0x00, 0x0b, 0xd6, 0x01, 0x01,
+  0x06, 0x7f, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80,
+  0x00, 0x22, 0x01, 0x45, 0x0d, 0x00, 0x20, 0x00, 0x41, 0x01, 0x48, 0x0d,
+  0x00, 0x41, 0x00, 0x21, 0x02, 0x03, 0x40, 0x02, 0x40, 0x20, 0x01, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x03, 0x41, 0x00, 0x21, 0x04,
+  0x03, 0x40, 0x20, 0x04, 0x41, 0x02, 0x74, 0x22, 0x05, 0x41, 0x84, 0xe8,
+  0x80, 0x80, 0x00, 0x6a, 0x20, 0x03, 0x41, 0x02, 0x74, 0x22, 0x06, 0x41,
+  0x84, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2f, 0x01, 0x00, 0x3b, 0x01, 0x00,
+  0x20, 0x05, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x06, 0x41,
+  0x86, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2f, 0x01, 0x00, 0x3b, 0x01, 0x00,
+  0x20, 0x01, 0x21, 0x05, 0x03, 0x40, 0x20, 0x05, 0x41, 0x01, 0x75, 0x22,
+  0x05, 0x20, 0x04, 0x22, 0x06, 0x73, 0x21, 0x04, 0x20, 0x05, 0x20, 0x06,
+  0x71, 0x0d, 0x00, 0x0b, 0x20, 0x05, 0x20, 0x06, 0x72, 0x21, 0x04, 0x20,
+  0x03, 0x41, 0x01, 0x6a, 0x22, 0x03, 0x20, 0x01, 0x47, 0x0d, 0x00, 0x0b,
+  0x0b, 0x20, 0x01, 0x41, 0x01, 0x10, 0x93, 0x80, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x41, 0x00, 0x2f, 0x01, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x3b, 0x01,
+  0x84, 0xa8, 0x81, 0x80, 0x00, 0x20, 0x02, 0x41, 0x01, 0x6a, 0x22, 0x02,
+  0x20, 0x00, 0x46, 0x0d, 0x01, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80,
+  0x80, 0x00, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b, 0xa2, 0x03, 0x01,
+  0x13, 0x7f, 0x02, 0x40, 0x20, 0x00, 0x41, 0x02, 0x48, 0x0d, 0x00, 0x20,
+  0x01, 0x41, 0x01, 0x74, 0x21, 0x02, 0x41, 0x02, 0x21, 0x03, 0x03, 0x40,
+  0x20, 0x00, 0x20, 0x03, 0x6d, 0x21, 0x04, 0x02, 0x40, 0x20, 0x03, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x01, 0x75, 0x22, 0x01, 0x41,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x4a, 0x1b, 0x21, 0x05, 0x20, 0x01, 0x41,
+  0x02, 0x74, 0x21, 0x06, 0x20, 0x03, 0x41, 0x02, 0x74, 0x21, 0x07, 0x20,
+  0x02, 0x20, 0x04, 0x6c, 0x21, 0x08, 0x41, 0x00, 0x21, 0x09, 0x41, 0x84,
+  0xe8, 0x80, 0x80, 0x00, 0x21, 0x0a, 0x03, 0x40, 0x20, 0x0a, 0x21, 0x01,
+  0x41, 0x00, 0x21, 0x04, 0x20, 0x05, 0x21, 0x0b, 0x03, 0x40, 0x20, 0x01,
+  0x41, 0x02, 0x6a, 0x22, 0x0c, 0x20, 0x01, 0x20, 0x06, 0x6a, 0x22, 0x0d,
+  0x41, 0x02, 0x6a, 0x22, 0x0e, 0x2e, 0x01, 0x00, 0x41, 0x01, 0x75, 0x22,
+  0x0f, 0x20, 0x04, 0x41, 0x90, 0x98, 0x82, 0x80, 0x00, 0x6a, 0x2e, 0x01,
+  0x00, 0x22, 0x10, 0x6c, 0x20, 0x0d, 0x2e, 0x01, 0x00, 0x41, 0x01, 0x75,
+  0x22, 0x11, 0x20, 0x04, 0x41, 0x90, 0xa0, 0x82, 0x80, 0x00, 0x6a, 0x2e,
+  0x01, 0x00, 0x22, 0x12, 0x6c, 0x6a, 0x41, 0x0f, 0x75, 0x22, 0x13, 0x20,
+  0x0c, 0x2e, 0x01, 0x00, 0x41, 0x01, 0x75, 0x22, 0x0c, 0x6a, 0x22, 0x14,
+  0x41, 0x80, 0x80, 0x7e, 0x20, 0x14, 0x41, 0x80, 0x80, 0x7e, 0x4a, 0x1b,
+  0x22, 0x14, 0x41, 0xff, 0xff, 0x01, 0x20, 0x14, 0x41, 0xff, 0xff, 0x01,
+  0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x01, 0x20, 0x11, 0x20, 0x10, 0x6c,
+  0x20, 0x0f, 0x20, 0x12, 0x6c, 0x6b, 0x41, 0x0f, 0x75, 0x22, 0x0f, 0x20,
+  0x01, 0x2e, 0x01, 0x00, 0x41, 0x01, 0x75, 0x22, 0x10, 0x6a, 0x22, 0x11,
+  0x41, 0x80, 0x80, 0x7e, 0x20, 0x11, 0x41, 0x80, 0x80, 0x7e, 0x4a, 0x1b,
+  0x22, 0x11, 0x41, 0xff, 0xff, 0x01, 0x20, 0x11, 0x41, 0xff, 0xff, 0x01,
+  0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x0e, 0x20, 0x0c, 0x20, 0x13, 0x6b,
+  0x22, 0x0c, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x0c, 0x41, 0x80, 0x80, 0x7e,
+  0x4a, 0x1b, 0x22, 0x0c, 0x41, 0xff, 0xff, 0x01, 0x20, 0x0c, 0x41, 0xff,
+  0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x0d, 0x20, 0x10, 0x20,
+  0x0f, 0x6b, 0x22, 0x0c, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x0c, 0x41, 0x80,
+  0x80, 0x7e, 0x4a, 0x1b, 0x22, 0x0c, 0x41, 0xff, 0xff, 0x01, 0x20, 0x0c,
+  0x41, 0xff, 0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x01, 0x41,
+  0x04, 0x6a, 0x21, 0x01, 0x20, 0x04, 0x20, 0x08, 0x6a, 0x21, 0x04, 0x20,
+  0x0b, 0x41, 0x7f, 0x6a, 0x22, 0x0b, 0x0d, 0x00, 0x0b, 0x20, 0x0a, 0x20,
+  0x07, 0x6a, 0x21, 0x0a, 0x20, 0x09, 0x20, 0x03, 0x6a, 0x22, 0x09, 0x20,
+  0x00, 0x48, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x03, 0x41, 0x01, 0x74, 0x22,
+  0x03, 0x20, 0x00, 0x4c, 0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x90, 0x01, 0x01,
+  0x03, 0x7f, 0x41, 0x00, 0x21, 0x00, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02,
+  0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00, 0x41, 0xc5,
+  0xbb, 0xf2, 0x88, 0x78, 0x21, 0x00, 0x20, 0x01, 0x41, 0x02, 0x74, 0x22,
+  0x02, 0x45, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x00,
+  0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x85, 0xe8,
+  0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80,
+  0x08, 0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d,
+  0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41,
+  0x87, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93,
+  0x83, 0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x02, 0x20, 0x01, 0x41, 0x04,
+  0x6a, 0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x00, 0x0b, 0x0e,
+  0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01, 0x10, 0x83, 0x80, 0x80, 0x80,
+  0x00, 0x0b, 0xb8, 0x05, 0x01, 0x11, 0x7f, 0x02, 0x40, 0x41, 0x00, 0x28,
+  0x02, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x01, 0x45, 0x0d, 0x00, 0x20,
+  0x00, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x02, 0x03, 0x40,
+  0x20, 0x01, 0x41, 0x02, 0x6d, 0x21, 0x03, 0x02, 0x40, 0x20, 0x01, 0x41,
+  0x02, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x04, 0x41, 0x00, 0x21, 0x05,
+  0x03, 0x40, 0x20, 0x05, 0x41, 0x02, 0x74, 0x22, 0x06, 0x41, 0x84, 0xe8,
+  0x80, 0x80, 0x00, 0x6a, 0x20, 0x04, 0x41, 0x02, 0x74, 0x22, 0x07, 0x41,
+  0x84, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2f, 0x01, 0x00, 0x3b, 0x01, 0x00,
+  0x20, 0x06, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x20, 0x07, 0x41,
+  0x86, 0xa8, 0x81, 0x80, 0x00, 0x6a, 0x2f, 0x01, 0x00, 0x3b, 0x01, 0x00,
+  0x20, 0x03, 0x21, 0x06, 0x03, 0x40, 0x20, 0x06, 0x41, 0x01, 0x75, 0x22,
+  0x06, 0x20, 0x05, 0x22, 0x07, 0x73, 0x21, 0x05, 0x20, 0x06, 0x20, 0x07,
+  0x71, 0x0d, 0x00, 0x0b, 0x20, 0x06, 0x20, 0x07, 0x72, 0x21, 0x05, 0x20,
+  0x04, 0x41, 0x01, 0x6a, 0x22, 0x04, 0x20, 0x03, 0x47, 0x0d, 0x00, 0x0b,
+  0x0b, 0x20, 0x03, 0x41, 0x02, 0x10, 0x93, 0x80, 0x80, 0x80, 0x00, 0x41,
+  0x00, 0x41, 0x00, 0x2e, 0x01, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x06,
+  0x41, 0x00, 0x2e, 0x01, 0x86, 0xe8, 0x80, 0x80, 0x00, 0x22, 0x05, 0x6b,
+  0x41, 0x01, 0x75, 0x22, 0x07, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x07, 0x41,
+  0x80, 0x80, 0x7e, 0x4a, 0x1b, 0x22, 0x07, 0x41, 0xff, 0xff, 0x01, 0x20,
+  0x07, 0x41, 0xff, 0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x86, 0xe8, 0x80,
+  0x80, 0x00, 0x41, 0x00, 0x20, 0x05, 0x20, 0x06, 0x6a, 0x41, 0x01, 0x75,
+  0x22, 0x06, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x06, 0x41, 0x80, 0x80, 0x7e,
+  0x4a, 0x1b, 0x22, 0x06, 0x41, 0xff, 0xff, 0x01, 0x20, 0x06, 0x41, 0xff,
+  0xff, 0x01, 0x48, 0x1b, 0x22, 0x06, 0x3b, 0x01, 0x84, 0xe8, 0x80, 0x80,
+  0x00, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00,
+  0x22, 0x01, 0x41, 0x04, 0x48, 0x0d, 0x00, 0x41, 0x02, 0x21, 0x05, 0x20,
+  0x01, 0x41, 0x01, 0x75, 0x22, 0x06, 0x41, 0x02, 0x6d, 0x22, 0x07, 0x41,
+  0x01, 0x20, 0x07, 0x41, 0x01, 0x4a, 0x1b, 0x41, 0x02, 0x74, 0x21, 0x08,
+  0x20, 0x06, 0x41, 0x02, 0x74, 0x41, 0x80, 0xe8, 0x80, 0x80, 0x00, 0x6a,
+  0x21, 0x06, 0x41, 0x00, 0x21, 0x07, 0x03, 0x40, 0x20, 0x07, 0x41, 0x8a,
+  0xe8, 0x80, 0x80, 0x00, 0x6a, 0x22, 0x04, 0x20, 0x06, 0x41, 0x02, 0x6a,
+  0x22, 0x03, 0x2e, 0x01, 0x00, 0x22, 0x09, 0x20, 0x04, 0x2e, 0x01, 0x00,
+  0x22, 0x04, 0x6a, 0x41, 0x02, 0x75, 0x22, 0x0a, 0x20, 0x05, 0x41, 0x90,
+  0xa0, 0x82, 0x80, 0x00, 0x6a, 0x2e, 0x01, 0x00, 0x22, 0x0b, 0x6c, 0x20,
+  0x06, 0x2e, 0x01, 0x00, 0x22, 0x0c, 0x20, 0x07, 0x41, 0x88, 0xe8, 0x80,
+  0x80, 0x00, 0x6a, 0x22, 0x0d, 0x2e, 0x01, 0x00, 0x22, 0x0e, 0x6b, 0x41,
+  0x02, 0x75, 0x22, 0x0f, 0x20, 0x05, 0x41, 0x90, 0x98, 0x82, 0x80, 0x00,
+  0x6a, 0x2e, 0x01, 0x00, 0x22, 0x10, 0x6c, 0x6a, 0x41, 0x0f, 0x75, 0x22,
+  0x11, 0x20, 0x04, 0x20, 0x09, 0x6b, 0x41, 0x02, 0x75, 0x22, 0x04, 0x6a,
+  0x22, 0x09, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x09, 0x41, 0x80, 0x80, 0x7e,
+  0x4a, 0x1b, 0x22, 0x09, 0x41, 0xff, 0xff, 0x01, 0x20, 0x09, 0x41, 0xff,
+  0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x0d, 0x20, 0x0a, 0x20,
+  0x10, 0x6c, 0x20, 0x0f, 0x20, 0x0b, 0x6c, 0x6b, 0x41, 0x0f, 0x75, 0x22,
+  0x09, 0x20, 0x0c, 0x20, 0x0e, 0x6a, 0x41, 0x02, 0x75, 0x22, 0x0a, 0x6a,
+  0x22, 0x0b, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x0b, 0x41, 0x80, 0x80, 0x7e,
+  0x4a, 0x1b, 0x22, 0x0b, 0x41, 0xff, 0xff, 0x01, 0x20, 0x0b, 0x41, 0xff,
+  0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x03, 0x20, 0x11, 0x20,
+  0x04, 0x6b, 0x22, 0x04, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x04, 0x41, 0x80,
+  0x80, 0x7e, 0x4a, 0x1b, 0x22, 0x04, 0x41, 0xff, 0xff, 0x01, 0x20, 0x04,
+  0x41, 0xff, 0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20, 0x06, 0x20,
+  0x0a, 0x20, 0x09, 0x6b, 0x22, 0x04, 0x41, 0x80, 0x80, 0x7e, 0x20, 0x04,
+  0x41, 0x80, 0x80, 0x7e, 0x4a, 0x1b, 0x22, 0x04, 0x41, 0xff, 0xff, 0x01,
+  0x20, 0x04, 0x41, 0xff, 0xff, 0x01, 0x48, 0x1b, 0x3b, 0x01, 0x00, 0x20,
+  0x06, 0x41, 0x7c, 0x6a, 0x21, 0x06, 0x20, 0x05, 0x41, 0x02, 0x6a, 0x21,
+  0x05, 0x20, 0x08, 0x20, 0x07, 0x41, 0x04, 0x6a, 0x22, 0x07, 0x47, 0x0d,
+  0x00, 0x0b, 0x41, 0x00, 0x2f, 0x01, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x21,
+  0x06, 0x0b, 0x41, 0x00, 0x20, 0x06, 0x3b, 0x01, 0x84, 0xa8, 0x81, 0x80,
+  0x00, 0x20, 0x02, 0x41, 0x01, 0x6a, 0x22, 0x02, 0x20, 0x00, 0x47, 0x0d,
+  0x00, 0x0b, 0x0b, 0x0b, 0xf8, 0x01, 0x01, 0x04, 0x7f, 0x41, 0x00, 0x21,
+  0x00, 0x02, 0x40, 0x41, 0x00, 0x28, 0x02, 0x80, 0xe8, 0x80, 0x80, 0x00,
+  0x22, 0x01, 0x45, 0x0d, 0x00, 0x02, 0x40, 0x20, 0x01, 0x41, 0x01, 0x74,
+  0x22, 0x01, 0x0d, 0x00, 0x41, 0xc5, 0xbb, 0xf2, 0x88, 0x78, 0x0f, 0x0b,
+  0x20, 0x01, 0x41, 0x02, 0x71, 0x21, 0x02, 0x02, 0x40, 0x02, 0x40, 0x20,
+  0x01, 0x41, 0x7f, 0x6a, 0x41, 0x03, 0x4f, 0x0d, 0x00, 0x41, 0xc5, 0xbb,
+  0xf2, 0x88, 0x78, 0x21, 0x00, 0x41, 0x00, 0x21, 0x01, 0x0c, 0x01, 0x0b,
+  0x20, 0x01, 0x41, 0x7c, 0x71, 0x21, 0x03, 0x41, 0xc5, 0xbb, 0xf2, 0x88,
+  0x78, 0x21, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x00, 0x20,
+  0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73,
+  0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x85, 0xe8, 0x80,
+  0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08,
+  0x6c, 0x20, 0x01, 0x41, 0x86, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00,
+  0x00, 0x73, 0x41, 0x93, 0x83, 0x80, 0x08, 0x6c, 0x20, 0x01, 0x41, 0x87,
+  0xe8, 0x80, 0x80, 0x00, 0x6a, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83,
+  0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x03, 0x20, 0x01, 0x41, 0x04, 0x6a,
+  0x22, 0x01, 0x47, 0x0d, 0x00, 0x0b, 0x0b, 0x20, 0x02, 0x45, 0x0d, 0x00,
+  0x20, 0x01, 0x41, 0x84, 0xe8, 0x80, 0x80, 0x00, 0x6a, 0x21, 0x01, 0x03,
+  0x40, 0x20, 0x00, 0x20, 0x01, 0x2d, 0x00, 0x00, 0x73, 0x41, 0x93, 0x83,
+  0x80, 0x08, 0x6c, 0x21, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01,
+  0x20, 0x02, 0x41, 0x7f, 0x6a, 0x22, 0x02, 0x0d, 0x00, 0x0b, 0x0b, 0x20,
+  0x00, 0x0b, 0x0b, 0x88, 0x20, 0x01, 0x00, 0x41, 0x80, 0x08, 0x0b, 0x80,
+  0x20, 0x00, 0x00, 0x80, 0x3f, 0xc4, 0xfe, 0x7f, 0x3f, 0x11, 0xfb, 0x7f,
+  0x3f, 0xe6, 0xf4, 0x7f, 0x3f, 0x43, 0xec, 0x7f, 0x3f, 0x29, 0xe1, 0x7f,
+  0x3f, 0x98, 0xd3, 0x7f, 0x3f, 0x8f, 0xc3, 0x7f, 0x3f, 0x0f, 0xb1, 0x7f,
+  0x3f, 0x18, 0x9c, 0x7f, 0x3f, 0xab, 0x84, 0x7f, 0x3f, 0xc7, 0x6a, 0x7f,
+  0x3f, 0x6d, 0x4e, 0x7f, 0x3f, 0x9d, 0x2f, 0x7f, 0x3f, 0x58, 0x0e, 0x7f,
+  0x3f, 0x9d, 0xea, 0x7e, 0x3f, 0x6d, 0xc4, 0x7e, 0x3f, 0xc9, 0x9b, 0x7e,
+  0x3f, 0xb0, 0x70, 0x7e, 0x3f, 0x23, 0x43, 0x7e, 0x3f, 0x24, 0x13, 0x7e,
+  0x3f, 0xb1, 0xe0, 0x7d, 0x3f, 0xcc, 0xab, 0x7d, 0x3f, 0x74, 0x74, 0x7d,
+  0x3f, 0xac, 0x3a, 0x7d, 0x3f, 0x73, 0xfe, 0x7c, 0x3f, 0xc9, 0xbf, 0x7c,
+  0x3f, 0xb0, 0x7e, 0x7c, 0x3f, 0x28, 0x3b, 0x7c, 0x3f, 0x31, 0xf5, 0x7b,
+  0x3f, 0xcd, 0xac, 0x7b, 0x3f, 0xfc, 0x61, 0x7b, 0x3f, 0xbe, 0x14, 0x7b,
+  0x3f, 0x16, 0xc5, 0x7a, 0x3f, 0x02, 0x73, 0x7a, 0x3f, 0x84, 0x1e, 0x7a,
+  0x3f, 0x9d, 0xc7, 0x79, 0x3f, 0x4e, 0x6e, 0x79, 0x3f, 0x98, 0x12, 0x79,
+  0x3f, 0x7b, 0xb4, 0x78, 0x3f, 0xf8, 0x53, 0x78, 0x3f, 0x10, 0xf1, 0x77,
+  0x3f, 0xc5, 0x8b, 0x77, 0x3f, 0x17, 0x24, 0x77, 0x3f, 0x07, 0xba, 0x76,
+  0x3f, 0x97, 0x4d, 0x76, 0x3f, 0xc6, 0xde, 0x75, 0x3f, 0x97, 0x6d, 0x75,
+  0x3f, 0x0b, 0xfa, 0x74, 0x3f, 0x22, 0x84, 0x74, 0x3f, 0xdd, 0x0b, 0x74,
+  0x3f, 0x3f, 0x91, 0x73, 0x3f, 0x47, 0x14, 0x73, 0x3f, 0xf8, 0x94, 0x72,
+  0x3f, 0x52, 0x13, 0x72, 0x3f, 0x57, 0x8f, 0x71, 0x3f, 0x08, 0x09, 0x71,
+  0x3f, 0x66, 0x80, 0x70, 0x3f, 0x73, 0xf5, 0x6f, 0x3f, 0x30, 0x68, 0x6f,
+  0x3f, 0x9e, 0xd8, 0x6e, 0x3f, 0xbe, 0x46, 0x6e, 0x3f, 0x93, 0xb2, 0x6d,
+  0x3f, 0x1d, 0x1c, 0x6d, 0x3f, 0x5e, 0x83, 0x6c, 0x3f, 0x58, 0xe8, 0x6b,
+  0x3f, 0x0c, 0x4b, 0x6b, 0x3f, 0x7b, 0xab, 0x6a, 0x3f, 0xa7, 0x09, 0x6a,
+  0x3f, 0x91, 0x65, 0x69, 0x3f, 0x3c, 0xbf, 0x68, 0x3f, 0xa8, 0x16, 0x68,
+  0x3f, 0xd8, 0x6b, 0x67, 0x3f, 0xcc, 0xbe, 0x66, 0x3f, 0x88, 0x0f, 0x66,
+  0x3f, 0x0b, 0x5e, 0x65, 0x3f, 0x59, 0xaa, 0x64, 0x3f, 0x73, 0xf4, 0x63,
+  0x3f, 0x5a, 0x3c, 0x63, 0x3f, 0x10, 0x82, 0x62, 0x3f, 0x98, 0xc5, 0x61,
+  0x3f, 0xf2, 0x06, 0x61, 0x3f, 0x21, 0x46, 0x60, 0x3f, 0x27, 0x83, 0x5f,
+  0x3f, 0x05, 0xbe, 0x5e, 0x3f, 0xbe, 0xf6, 0x5d, 0x3f, 0x53, 0x2d, 0x5d,
+  0x3f, 0xc7, 0x61, 0x5c, 0x3f, 0x1a, 0x94, 0x5b, 0x3f, 0x50, 0xc4, 0x5a,
+  0x3f, 0x6a, 0xf2, 0x59, 0x3f, 0x6a, 0x1e, 0x59, 0x3f, 0x53, 0x48, 0x58,
+  0x3f, 0x26, 0x70, 0x57, 0x3f, 0xe5, 0x95, 0x56, 0x3f, 0x93, 0xb9, 0x55,
+  0x3f, 0x31, 0xdb, 0x54, 0x3f, 0xc3, 0xfa, 0x53, 0x3f, 0x49, 0x18, 0x53,
+  0x3f, 0xc6, 0x33, 0x52, 0x3f, 0x3d, 0x4d, 0x51, 0x3f, 0xaf, 0x64, 0x50,
+  0x3f, 0x1f, 0x7a, 0x4f, 0x3f, 0x90, 0x8d, 0x4e, 0x3f, 0x02, 0x9f, 0x4d,
+  0x3f, 0x79, 0xae, 0x4c, 0x3f, 0xf8, 0xbb, 0x4b, 0x3f, 0x7f, 0xc7, 0x4a,
+  0x3f, 0x12, 0xd1, 0x49, 0x3f, 0xb3, 0xd8, 0x48, 0x3f, 0x65, 0xde, 0x47,
+  0x3f, 0x2a, 0xe2, 0x46, 0x3f, 0x03, 0xe4, 0x45, 0x3f, 0xf5, 0xe3, 0x44,
+  0x3f, 0x00, 0xe2, 0x43, 0x3f, 0x29, 0xde, 0x42, 0x3f, 0x70, 0xd8, 0x41,
+  0x3f, 0xda, 0xd0, 0x40, 0x3f, 0x67, 0xc7, 0x3f, 0x3f, 0x1b, 0xbc, 0x3e,
+  0x3f, 0xf9, 0xae, 0x3d, 0x3f, 0x03, 0xa0, 0x3c, 0x3f, 0x3b, 0x8f, 0x3b,
+  0x3f, 0xa4, 0x7c, 0x3a, 0x3f, 0x42, 0x68, 0x39, 0x3f, 0x16, 0x52, 0x38,
+  0x3f, 0x23, 0x3a, 0x37, 0x3f, 0x6c, 0x20, 0x36, 0x3f, 0xf3, 0x04, 0x35,
+  0x3f, 0xbc, 0xe7, 0x33, 0x3f, 0xc9, 0xc8, 0x32, 0x3f, 0x1d, 0xa8, 0x31,
+  0x3f, 0xbb, 0x85, 0x30, 0x3f, 0xa5, 0x61, 0x2f, 0x3f, 0xde, 0x3b, 0x2e,
+  0x3f, 0x69, 0x14, 0x2d, 0x3f, 0x4a, 0xeb, 0x2b, 0x3f, 0x82, 0xc0, 0x2a,
+  0x3f, 0x15, 0x94, 0x29, 0x3f, 0x05, 0x66, 0x28, 0x3f, 0x56, 0x36, 0x27,
+  0x3f, 0x0a, 0x05, 0x26, 0x3f, 0x25, 0xd2, 0x24, 0x3f, 0xa9, 0x9d, 0x23,
+  0x3f, 0x99, 0x67, 0x22, 0x3f, 0xf9, 0x2f, 0x21, 0x3f, 0xcb, 0xf6, 0x1f,
+  0x3f, 0x12, 0xbc, 0x1e, 0x3f, 0xd1, 0x7f, 0x1d, 0x3f, 0x0c, 0x42, 0x1c,
+  0x3f, 0xc6, 0x02, 0x1b, 0x3f, 0x00, 0xc2, 0x19, 0x3f, 0xc0, 0x7f, 0x18,
+  0x3f, 0x07, 0x3c, 0x17, 0x3f, 0xd9, 0xf6, 0x15, 0x3f, 0x39, 0xb0, 0x14,
+  0x3f, 0x2a, 0x68, 0x13, 0x3f, 0xb0, 0x1e, 0x12, 0x3f, 0xcd, 0xd3, 0x10,
+  0x3f, 0x84, 0x87, 0x0f, 0x3f, 0xda, 0x39, 0x0e, 0x3f, 0xd0, 0xea, 0x0c,
+  0x3f, 0x6b, 0x9a, 0x0b, 0x3f, 0xad, 0x48, 0x0a, 0x3f, 0x9b, 0xf5, 0x08,
+  0x3f, 0x36, 0xa1, 0x07, 0x3f, 0x82, 0x4b, 0x06, 0x3f, 0x84, 0xf4, 0x04,
+  0x3f, 0x3d, 0x9c, 0x03, 0x3f, 0xb1, 0x42, 0x02, 0x3f, 0xe4, 0xe7, 0x00,
+  0x3f, 0xb2, 0x17, 0xff, 0x3e, 0x27, 0x5d, 0xfc, 0x3e, 0x2d, 0xa0, 0xf9,
+  0x3e, 0xcb, 0xe0, 0xf6, 0x3e, 0x07, 0x1f, 0xf4, 0x3e, 0xea, 0x5a, 0xf1,
+  0x3e, 0x79, 0x94, 0xee, 0x3e, 0xbb, 0xcb, 0xeb, 0x3e, 0xb7, 0x00, 0xe9,
+  0x3e, 0x75, 0x33, 0xe6, 0x3e, 0xfa, 0x63, 0xe3, 0x3e, 0x4f, 0x92, 0xe0,
+  0x3e, 0x79, 0xbe, 0xdd, 0x3e, 0x80, 0xe8, 0xda, 0x3e, 0x6b, 0x10, 0xd8,
+  0x3e, 0x41, 0x36, 0xd5, 0x3e, 0x09, 0x5a, 0xd2, 0x3e, 0xca, 0x7b, 0xcf,
+  0x3e, 0x8b, 0x9b, 0xcc, 0x3e, 0x53, 0xb9, 0xc9, 0x3e, 0x29, 0xd5, 0xc6,
+  0x3e, 0x15, 0xef, 0xc3, 0x3e, 0x1e, 0x07, 0xc1, 0x3e, 0x4a, 0x1d, 0xbe,
+  0x3e, 0xa0, 0x31, 0xbb, 0x3e, 0x2a, 0x44, 0xb8, 0x3e, 0xec, 0x54, 0xb5,
+  0x3e, 0xef, 0x63, 0xb2, 0x3e, 0x3a, 0x71, 0xaf, 0x3e, 0xd4, 0x7c, 0xac,
+  0x3e, 0xc4, 0x86, 0xa9, 0x3e, 0x12, 0x8f, 0xa6, 0x3e, 0xc5, 0x95, 0xa3,
+  0x3e, 0xe5, 0x9a, 0xa0, 0x3e, 0x78, 0x9e, 0x9d, 0x3e, 0x86, 0xa0, 0x9a,
+  0x3e, 0x17, 0xa1, 0x97, 0x3e, 0x31, 0xa0, 0x94, 0x3e, 0xdd, 0x9d, 0x91,
+  0x3e, 0x22, 0x9a, 0x8e, 0x3e, 0x07, 0x95, 0x8b, 0x3e, 0x93, 0x8e, 0x88,
+  0x3e, 0xce, 0x86, 0x85, 0x3e, 0xc0, 0x7d, 0x82, 0x3e, 0xe1, 0xe6, 0x7e,
+  0x3e, 0xcc, 0xcf, 0x78, 0x3e, 0x51, 0xb6, 0x72, 0x3e, 0x7f, 0x9a, 0x6c,
+  0x3e, 0x66, 0x7c, 0x66, 0x3e, 0x13, 0x5c, 0x60, 0x3e, 0x97, 0x39, 0x5a,
+  0x3e, 0x01, 0x15, 0x54, 0x3e, 0x60, 0xee, 0x4d, 0x3e, 0xc2, 0xc5, 0x47,
+  0x3e, 0x37, 0x9b, 0x41, 0x3e, 0xcf, 0x6e, 0x3b, 0x3e, 0x98, 0x40, 0x35,
+  0x3e, 0xa2, 0x10, 0x2f, 0x3e, 0xfc, 0xde, 0x28, 0x3e, 0xb6, 0xab, 0x22,
+  0x3e, 0xde, 0x76, 0x1c, 0x3e, 0x83, 0x40, 0x16, 0x3e, 0xb7, 0x08, 0x10,
+  0x3e, 0x86, 0xcf, 0x09, 0x3e, 0x02, 0x95, 0x03, 0x3e, 0x73, 0xb2, 0xfa,
+  0x3d, 0x76, 0x38, 0xee, 0x3d, 0x2e, 0xbc, 0xe1, 0x3d, 0xb9, 0x3d, 0xd5,
+  0x3d, 0x36, 0xbd, 0xc8, 0x3d, 0xc3, 0x3a, 0xbc, 0x3d, 0x80, 0xb6, 0xaf,
+  0x3d, 0x8c, 0x30, 0xa3, 0x3d, 0x05, 0xa9, 0x96, 0x3d, 0x0a, 0x20, 0x8a,
+  0x3d, 0x74, 0x2b, 0x7b, 0x3d, 0x68, 0x14, 0x62, 0x3d, 0x2f, 0xfb, 0x48,
+  0x3d, 0x07, 0xe0, 0x2f, 0x3d, 0x2c, 0xc3, 0x16, 0x3d, 0xb9, 0x49, 0xfb,
+  0x3c, 0xb0, 0x0a, 0xc9, 0x3c, 0xb6, 0xc9, 0x96, 0x3c, 0x90, 0x0e, 0x49,
+  0x3c, 0x89, 0x0f, 0xc9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x89, 0x0f, 0xc9,
+  0xbb, 0x90, 0x0e, 0x49, 0xbc, 0xb6, 0xc9, 0x96, 0xbc, 0xb0, 0x0a, 0xc9,
+  0xbc, 0xb9, 0x49, 0xfb, 0xbc, 0x2c, 0xc3, 0x16, 0xbd, 0x07, 0xe0, 0x2f,
+  0xbd, 0x2f, 0xfb, 0x48, 0xbd, 0x68, 0x14, 0x62, 0xbd, 0x74, 0x2b, 0x7b,
+  0xbd, 0x0a, 0x20, 0x8a, 0xbd, 0x05, 0xa9, 0x96, 0xbd, 0x8c, 0x30, 0xa3,
+  0xbd, 0x80, 0xb6, 0xaf, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd, 0x36, 0xbd, 0xc8,
+  0xbd, 0xb9, 0x3d, 0xd5, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd, 0x76, 0x38, 0xee,
+  0xbd, 0x73, 0xb2, 0xfa, 0xbd, 0x02, 0x95, 0x03, 0xbe, 0x86, 0xcf, 0x09,
+  0xbe, 0xb7, 0x08, 0x10, 0xbe, 0x83, 0x40, 0x16, 0xbe, 0xde, 0x76, 0x1c,
+  0xbe, 0xb6, 0xab, 0x22, 0xbe, 0xfc, 0xde, 0x28, 0xbe, 0xa2, 0x10, 0x2f,
+  0xbe, 0x98, 0x40, 0x35, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe, 0x37, 0x9b, 0x41,
+  0xbe, 0xc2, 0xc5, 0x47, 0xbe, 0x60, 0xee, 0x4d, 0xbe, 0x01, 0x15, 0x54,
+  0xbe, 0x97, 0x39, 0x5a, 0xbe, 0x13, 0x5c, 0x60, 0xbe, 0x66, 0x7c, 0x66,
+  0xbe, 0x7f, 0x9a, 0x6c, 0xbe, 0x51, 0xb6, 0x72, 0xbe, 0xcc, 0xcf, 0x78,
+  0xbe, 0xe1, 0xe6, 0x7e, 0xbe, 0xc0, 0x7d, 0x82, 0xbe, 0xce, 0x86, 0x85,
+  0xbe, 0x93, 0x8e, 0x88, 0xbe, 0x07, 0x95, 0x8b, 0xbe, 0x22, 0x9a, 0x8e,
+  0xbe, 0xdd, 0x9d, 0x91, 0xbe, 0x31, 0xa0, 0x94, 0xbe, 0x17, 0xa1, 0x97,
+  0xbe, 0x86, 0xa0, 0x9a, 0xbe, 0x78, 0x9e, 0x9d, 0xbe, 0xe5, 0x9a, 0xa0,
+  0xbe, 0xc5, 0x95, 0xa3, 0xbe, 0x12, 0x8f, 0xa6, 0xbe, 0xc4, 0x86, 0xa9,
+  0xbe, 0xd4, 0x7c, 0xac, 0xbe, 0x3a, 0x71, 0xaf, 0xbe, 0xef, 0x63, 0xb2,
+  0xbe, 0xec, 0x54, 0xb5, 0xbe, 0x2a, 0x44, 0xb8, 0xbe, 0xa0, 0x31, 0xbb,
+  0xbe, 0x4a, 0x1d, 0xbe, 0xbe, 0x1e, 0x07, 0xc1, 0xbe, 0x15, 0xef, 0xc3,
+  0xbe, 0x29, 0xd5, 0xc6, 0xbe, 0x53, 0xb9, 0xc9, 0xbe, 0x8b, 0x9b, 0xcc,
+  0xbe, 0xca, 0x7b, 0xcf, 0xbe, 0x09, 0x5a, 0xd2, 0xbe, 0x41, 0x36, 0xd5,
+  0xbe, 0x6b, 0x10, 0xd8, 0xbe, 0x80, 0xe8, 0xda, 0xbe, 0x79, 0xbe, 0xdd,
+  0xbe, 0x4f, 0x92, 0xe0, 0xbe, 0xfa, 0x63, 0xe3, 0xbe, 0x75, 0x33, 0xe6,
+  0xbe, 0xb7, 0x00, 0xe9, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe, 0x79, 0x94, 0xee,
+  0xbe, 0xea, 0x5a, 0xf1, 0xbe, 0x07, 0x1f, 0xf4, 0xbe, 0xcb, 0xe0, 0xf6,
+  0xbe, 0x2d, 0xa0, 0xf9, 0xbe, 0x27, 0x5d, 0xfc, 0xbe, 0xb2, 0x17, 0xff,
+  0xbe, 0xe4, 0xe7, 0x00, 0xbf, 0xb1, 0x42, 0x02, 0xbf, 0x3d, 0x9c, 0x03,
+  0xbf, 0x84, 0xf4, 0x04, 0xbf, 0x82, 0x4b, 0x06, 0xbf, 0x36, 0xa1, 0x07,
+  0xbf, 0x9b, 0xf5, 0x08, 0xbf, 0xad, 0x48, 0x0a, 0xbf, 0x6b, 0x9a, 0x0b,
+  0xbf, 0xd0, 0xea, 0x0c, 0xbf, 0xda, 0x39, 0x0e, 0xbf, 0x84, 0x87, 0x0f,
+  0xbf, 0xcd, 0xd3, 0x10, 0xbf, 0xb0, 0x1e, 0x12, 0xbf, 0x2a, 0x68, 0x13,
+  0xbf, 0x39, 0xb0, 0x14, 0xbf, 0xd9, 0xf6, 0x15, 0xbf, 0x07, 0x3c, 0x17,
+  0xbf, 0xc0, 0x7f, 0x18, 0xbf, 0x00, 0xc2, 0x19, 0xbf, 0xc6, 0x02, 0x1b,
+  0xbf, 0x0c, 0x42, 0x1c, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf, 0x12, 0xbc, 0x1e,
+  0xbf, 0xcb, 0xf6, 0x1f, 0xbf, 0xf9, 0x2f, 0x21, 0xbf, 0x99, 0x67, 0x22,
+  0xbf, 0xa9, 0x9d, 0x23, 0xbf, 0x25, 0xd2, 0x24, 0xbf, 0x0a, 0x05, 0x26,
+  0xbf, 0x56, 0x36, 0x27, 0xbf, 0x05, 0x66, 0x28, 0xbf, 0x15, 0x94, 0x29,
+  0xbf, 0x82, 0xc0, 0x2a, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf, 0x69, 0x14, 0x2d,
+  0xbf, 0xde, 0x3b, 0x2e, 0xbf, 0xa5, 0x61, 0x2f, 0xbf, 0xbb, 0x85, 0x30,
+  0xbf, 0x1d, 0xa8, 0x31, 0xbf, 0xc9, 0xc8, 0x32, 0xbf, 0xbc, 0xe7, 0x33,
+  0xbf, 0xf3, 0x04, 0x35, 0xbf, 0x6c, 0x20, 0x36, 0xbf, 0x23, 0x3a, 0x37,
+  0xbf, 0x16, 0x52, 0x38, 0xbf, 0x42, 0x68, 0x39, 0xbf, 0xa4, 0x7c, 0x3a,
+  0xbf, 0x3b, 0x8f, 0x3b, 0xbf, 0x03, 0xa0, 0x3c, 0xbf, 0xf9, 0xae, 0x3d,
+  0xbf, 0x1b, 0xbc, 0x3e, 0xbf, 0x67, 0xc7, 0x3f, 0xbf, 0xda, 0xd0, 0x40,
+  0xbf, 0x70, 0xd8, 0x41, 0xbf, 0x29, 0xde, 0x42, 0xbf, 0x00, 0xe2, 0x43,
+  0xbf, 0xf5, 0xe3, 0x44, 0xbf, 0x03, 0xe4, 0x45, 0xbf, 0x2a, 0xe2, 0x46,
+  0xbf, 0x65, 0xde, 0x47, 0xbf, 0xb3, 0xd8, 0x48, 0xbf, 0x12, 0xd1, 0x49,
+  0xbf, 0x7f, 0xc7, 0x4a, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf, 0x79, 0xae, 0x4c,
+  0xbf, 0x02, 0x9f, 0x4d, 0xbf, 0x90, 0x8d, 0x4e, 0xbf, 0x1f, 0x7a, 0x4f,
+  0xbf, 0xaf, 0x64, 0x50, 0xbf, 0x3d, 0x4d, 0x51, 0xbf, 0xc6, 0x33, 0x52,
+  0xbf, 0x49, 0x18, 0x53, 0xbf, 0xc3, 0xfa, 0x53, 0xbf, 0x31, 0xdb, 0x54,
+  0xbf, 0x93, 0xb9, 0x55, 0xbf, 0xe5, 0x95, 0x56, 0xbf, 0x26, 0x70, 0x57,
+  0xbf, 0x53, 0x48, 0x58, 0xbf, 0x6a, 0x1e, 0x59, 0xbf, 0x6a, 0xf2, 0x59,
+  0xbf, 0x50, 0xc4, 0x5a, 0xbf, 0x1a, 0x94, 0x5b, 0xbf, 0xc7, 0x61, 0x5c,
+  0xbf, 0x53, 0x2d, 0x5d, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf, 0x05, 0xbe, 0x5e,
+  0xbf, 0x27, 0x83, 0x5f, 0xbf, 0x21, 0x46, 0x60, 0xbf, 0xf2, 0x06, 0x61,
+  0xbf, 0x98, 0xc5, 0x61, 0xbf, 0x10, 0x82, 0x62, 0xbf, 0x5a, 0x3c, 0x63,
+  0xbf, 0x73, 0xf4, 0x63, 0xbf, 0x59, 0xaa, 0x64, 0xbf, 0x0b, 0x5e, 0x65,
+  0xbf, 0x88, 0x0f, 0x66, 0xbf, 0xcc, 0xbe, 0x66, 0xbf, 0xd8, 0x6b, 0x67,
+  0xbf, 0xa8, 0x16, 0x68, 0xbf, 0x3c, 0xbf, 0x68, 0xbf, 0x91, 0x65, 0x69,
+  0xbf, 0xa7, 0x09, 0x6a, 0xbf, 0x7b, 0xab, 0x6a, 0xbf, 0x0c, 0x4b, 0x6b,
+  0xbf, 0x58, 0xe8, 0x6b, 0xbf, 0x5e, 0x83, 0x6c, 0xbf, 0x1d, 0x1c, 0x6d,
+  0xbf, 0x93, 0xb2, 0x6d, 0xbf, 0xbe, 0x46, 0x6e, 0xbf, 0x9e, 0xd8, 0x6e,
+  0xbf, 0x30, 0x68, 0x6f, 0xbf, 0x73, 0xf5, 0x6f, 0xbf, 0x66, 0x80, 0x70,
+  0xbf, 0x08, 0x09, 0x71, 0xbf, 0x57, 0x8f, 0x71, 0xbf, 0x52, 0x13, 0x72,
+  0xbf, 0xf8, 0x94, 0x72, 0xbf, 0x47, 0x14, 0x73, 0xbf, 0x3f, 0x91, 0x73,
+  0xbf, 0xdd, 0x0b, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf, 0x0b, 0xfa, 0x74,
+  0xbf, 0x97, 0x6d, 0x75, 0xbf, 0xc6, 0xde, 0x75, 0xbf, 0x97, 0x4d, 0x76,
+  0xbf, 0x07, 0xba, 0x76, 0xbf, 0x17, 0x24, 0x77, 0xbf, 0xc5, 0x8b, 0x77,
+  0xbf, 0x10, 0xf1, 0x77, 0xbf, 0xf8, 0x53, 0x78, 0xbf, 0x7b, 0xb4, 0x78,
+  0xbf, 0x98, 0x12, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf, 0x9d, 0xc7, 0x79,
+  0xbf, 0x84, 0x1e, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf, 0x16, 0xc5, 0x7a,
+  0xbf, 0xbe, 0x14, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf, 0xcd, 0xac, 0x7b,
+  0xbf, 0x31, 0xf5, 0x7b, 0xbf, 0x28, 0x3b, 0x7c, 0xbf, 0xb0, 0x7e, 0x7c,
+  0xbf, 0xc9, 0xbf, 0x7c, 0xbf, 0x73, 0xfe, 0x7c, 0xbf, 0xac, 0x3a, 0x7d,
+  0xbf, 0x74, 0x74, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf, 0xb1, 0xe0, 0x7d,
+  0xbf, 0x24, 0x13, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf, 0xb0, 0x70, 0x7e,
+  0xbf, 0xc9, 0x9b, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf, 0x9d, 0xea, 0x7e,
+  0xbf, 0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf, 0x6d, 0x4e, 0x7f,
+  0xbf, 0xc7, 0x6a, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf, 0x18, 0x9c, 0x7f,
+  0xbf, 0x0f, 0xb1, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf, 0x98, 0xd3, 0x7f,
+  0xbf, 0x29, 0xe1, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf, 0xe6, 0xf4, 0x7f,
+  0xbf, 0x11, 0xfb, 0x7f, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf, 0x00, 0x00, 0x00,
+  0x00, 0x89, 0x0f, 0xc9, 0xbb, 0x90, 0x0e, 0x49, 0xbc, 0xb6, 0xc9, 0x96,
+  0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb9, 0x49, 0xfb, 0xbc, 0x2c, 0xc3, 0x16,
+  0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2f, 0xfb, 0x48, 0xbd, 0x68, 0x14, 0x62,
+  0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x0a, 0x20, 0x8a, 0xbd, 0x05, 0xa9, 0x96,
+  0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x80, 0xb6, 0xaf, 0xbd, 0xc3, 0x3a, 0xbc,
+  0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xb9, 0x3d, 0xd5, 0xbd, 0x2e, 0xbc, 0xe1,
+  0xbd, 0x76, 0x38, 0xee, 0xbd, 0x73, 0xb2, 0xfa, 0xbd, 0x02, 0x95, 0x03,
+  0xbe, 0x86, 0xcf, 0x09, 0xbe, 0xb7, 0x08, 0x10, 0xbe, 0x83, 0x40, 0x16,
+  0xbe, 0xde, 0x76, 0x1c, 0xbe, 0xb6, 0xab, 0x22, 0xbe, 0xfc, 0xde, 0x28,
+  0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0x98, 0x40, 0x35, 0xbe, 0xcf, 0x6e, 0x3b,
+  0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xc2, 0xc5, 0x47, 0xbe, 0x60, 0xee, 0x4d,
+  0xbe, 0x01, 0x15, 0x54, 0xbe, 0x97, 0x39, 0x5a, 0xbe, 0x13, 0x5c, 0x60,
+  0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x7f, 0x9a, 0x6c, 0xbe, 0x51, 0xb6, 0x72,
+  0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0xe1, 0xe6, 0x7e, 0xbe, 0xc0, 0x7d, 0x82,
+  0xbe, 0xce, 0x86, 0x85, 0xbe, 0x93, 0x8e, 0x88, 0xbe, 0x07, 0x95, 0x8b,
+  0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0xdd, 0x9d, 0x91, 0xbe, 0x31, 0xa0, 0x94,
+  0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x86, 0xa0, 0x9a, 0xbe, 0x78, 0x9e, 0x9d,
+  0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0xc5, 0x95, 0xa3, 0xbe, 0x12, 0x8f, 0xa6,
+  0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0xd4, 0x7c, 0xac, 0xbe, 0x3a, 0x71, 0xaf,
+  0xbe, 0xef, 0x63, 0xb2, 0xbe, 0xec, 0x54, 0xb5, 0xbe, 0x2a, 0x44, 0xb8,
+  0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x4a, 0x1d, 0xbe, 0xbe, 0x1e, 0x07, 0xc1,
+  0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x29, 0xd5, 0xc6, 0xbe, 0x53, 0xb9, 0xc9,
+  0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0xca, 0x7b, 0xcf, 0xbe, 0x09, 0x5a, 0xd2,
+  0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x6b, 0x10, 0xd8, 0xbe, 0x80, 0xe8, 0xda,
+  0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x4f, 0x92, 0xe0, 0xbe, 0xfa, 0x63, 0xe3,
+  0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xb7, 0x00, 0xe9, 0xbe, 0xbb, 0xcb, 0xeb,
+  0xbe, 0x79, 0x94, 0xee, 0xbe, 0xea, 0x5a, 0xf1, 0xbe, 0x07, 0x1f, 0xf4,
+  0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x2d, 0xa0, 0xf9, 0xbe, 0x27, 0x5d, 0xfc,
+  0xbe, 0xb2, 0x17, 0xff, 0xbe, 0xe4, 0xe7, 0x00, 0xbf, 0xb1, 0x42, 0x02,
+  0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0x84, 0xf4, 0x04, 0xbf, 0x82, 0x4b, 0x06,
+  0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x9b, 0xf5, 0x08, 0xbf, 0xad, 0x48, 0x0a,
+  0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xd0, 0xea, 0x0c, 0xbf, 0xda, 0x39, 0x0e,
+  0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xcd, 0xd3, 0x10, 0xbf, 0xb0, 0x1e, 0x12,
+  0xbf, 0x2a, 0x68, 0x13, 0xbf, 0x39, 0xb0, 0x14, 0xbf, 0xd9, 0xf6, 0x15,
+  0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xc0, 0x7f, 0x18, 0xbf, 0x00, 0xc2, 0x19,
+  0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x0c, 0x42, 0x1c, 0xbf, 0xd1, 0x7f, 0x1d,
+  0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xcb, 0xf6, 0x1f, 0xbf, 0xf9, 0x2f, 0x21,
+  0xbf, 0x99, 0x67, 0x22, 0xbf, 0xa9, 0x9d, 0x23, 0xbf, 0x25, 0xd2, 0x24,
+  0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x56, 0x36, 0x27, 0xbf, 0x05, 0x66, 0x28,
+  0xbf, 0x15, 0x94, 0x29, 0xbf, 0x82, 0xc0, 0x2a, 0xbf, 0x4a, 0xeb, 0x2b,
+  0xbf, 0x69, 0x14, 0x2d, 0xbf, 0xde, 0x3b, 0x2e, 0xbf, 0xa5, 0x61, 0x2f,
+  0xbf, 0xbb, 0x85, 0x30, 0xbf, 0x1d, 0xa8, 0x31, 0xbf, 0xc9, 0xc8, 0x32,
+  0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xf3, 0x04, 0x35, 0xbf, 0x6c, 0x20, 0x36,
+  0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x16, 0x52, 0x38, 0xbf, 0x42, 0x68, 0x39,
+  0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x3b, 0x8f, 0x3b, 0xbf, 0x03, 0xa0, 0x3c,
+  0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x1b, 0xbc, 0x3e, 0xbf, 0x67, 0xc7, 0x3f,
+  0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x70, 0xd8, 0x41, 0xbf, 0x29, 0xde, 0x42,
+  0xbf, 0x00, 0xe2, 0x43, 0xbf, 0xf5, 0xe3, 0x44, 0xbf, 0x03, 0xe4, 0x45,
+  0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x65, 0xde, 0x47, 0xbf, 0xb3, 0xd8, 0x48,
+  0xbf, 0x12, 0xd1, 0x49, 0xbf, 0x7f, 0xc7, 0x4a, 0xbf, 0xf8, 0xbb, 0x4b,
+  0xbf, 0x79, 0xae, 0x4c, 0xbf, 0x02, 0x9f, 0x4d, 0xbf, 0x90, 0x8d, 0x4e,
+  0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0xaf, 0x64, 0x50, 0xbf, 0x3d, 0x4d, 0x51,
+  0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x49, 0x18, 0x53, 0xbf, 0xc3, 0xfa, 0x53,
+  0xbf, 0x31, 0xdb, 0x54, 0xbf, 0x93, 0xb9, 0x55, 0xbf, 0xe5, 0x95, 0x56,
+  0xbf, 0x26, 0x70, 0x57, 0xbf, 0x53, 0x48, 0x58, 0xbf, 0x6a, 0x1e, 0x59,
+  0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x50, 0xc4, 0x5a, 0xbf, 0x1a, 0x94, 0x5b,
+  0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x53, 0x2d, 0x5d, 0xbf, 0xbe, 0xf6, 0x5d,
+  0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0x27, 0x83, 0x5f, 0xbf, 0x21, 0x46, 0x60,
+  0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x98, 0xc5, 0x61, 0xbf, 0x10, 0x82, 0x62,
+  0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x73, 0xf4, 0x63, 0xbf, 0x59, 0xaa, 0x64,
+  0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x88, 0x0f, 0x66, 0xbf, 0xcc, 0xbe, 0x66,
+  0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xa8, 0x16, 0x68, 0xbf, 0x3c, 0xbf, 0x68,
+  0xbf, 0x91, 0x65, 0x69, 0xbf, 0xa7, 0x09, 0x6a, 0xbf, 0x7b, 0xab, 0x6a,
+  0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x58, 0xe8, 0x6b, 0xbf, 0x5e, 0x83, 0x6c,
+  0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x93, 0xb2, 0x6d, 0xbf, 0xbe, 0x46, 0x6e,
+  0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0x30, 0x68, 0x6f, 0xbf, 0x73, 0xf5, 0x6f,
+  0xbf, 0x66, 0x80, 0x70, 0xbf, 0x08, 0x09, 0x71, 0xbf, 0x57, 0x8f, 0x71,
+  0xbf, 0x52, 0x13, 0x72, 0xbf, 0xf8, 0x94, 0x72, 0xbf, 0x47, 0x14, 0x73,
+  0xbf, 0x3f, 0x91, 0x73, 0xbf, 0xdd, 0x0b, 0x74, 0xbf, 0x22, 0x84, 0x74,
+  0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x97, 0x6d, 0x75, 0xbf, 0xc6, 0xde, 0x75,
+  0xbf, 0x97, 0x4d, 0x76, 0xbf, 0x07, 0xba, 0x76, 0xbf, 0x17, 0x24, 0x77,
+  0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x10, 0xf1, 0x77, 0xbf, 0xf8, 0x53, 0x78,
+  0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0x98, 0x12, 0x79, 0xbf, 0x4e, 0x6e, 0x79,
+  0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x84, 0x1e, 0x7a, 0xbf, 0x02, 0x73, 0x7a,
+  0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0xbe, 0x14, 0x7b, 0xbf, 0xfc, 0x61, 0x7b,
+  0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0x31, 0xf5, 0x7b, 0xbf, 0x28, 0x3b, 0x7c,
+  0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c, 0xbf, 0x73, 0xfe, 0x7c,
+  0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x74, 0x74, 0x7d, 0xbf, 0xcc, 0xab, 0x7d,
+  0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0x24, 0x13, 0x7e, 0xbf, 0x23, 0x43, 0x7e,
+  0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e,
+  0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f,
+  0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f, 0xbf, 0xab, 0x84, 0x7f,
+  0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f,
+  0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x29, 0xe1, 0x7f, 0xbf, 0x43, 0xec, 0x7f,
+  0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x11, 0xfb, 0x7f, 0xbf, 0xc4, 0xfe, 0x7f,
+  0xbf, 0x00, 0x00, 0x80, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf, 0x11, 0xfb, 0x7f,
+  0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf, 0x29, 0xe1, 0x7f,
+  0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f,
+  0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f,
+  0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf, 0x58, 0x0e, 0x7f,
+  0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e,
+  0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf, 0x24, 0x13, 0x7e,
+  0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf, 0x74, 0x74, 0x7d,
+  0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x73, 0xfe, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c,
+  0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0x28, 0x3b, 0x7c, 0xbf, 0x31, 0xf5, 0x7b,
+  0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf, 0xbe, 0x14, 0x7b,
+  0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf, 0x84, 0x1e, 0x7a,
+  0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf, 0x98, 0x12, 0x79,
+  0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0xf8, 0x53, 0x78, 0xbf, 0x10, 0xf1, 0x77,
+  0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x17, 0x24, 0x77, 0xbf, 0x07, 0xba, 0x76,
+  0xbf, 0x97, 0x4d, 0x76, 0xbf, 0xc6, 0xde, 0x75, 0xbf, 0x97, 0x6d, 0x75,
+  0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf, 0xdd, 0x0b, 0x74,
+  0xbf, 0x3f, 0x91, 0x73, 0xbf, 0x47, 0x14, 0x73, 0xbf, 0xf8, 0x94, 0x72,
+  0xbf, 0x52, 0x13, 0x72, 0xbf, 0x57, 0x8f, 0x71, 0xbf, 0x08, 0x09, 0x71,
+  0xbf, 0x66, 0x80, 0x70, 0xbf, 0x73, 0xf5, 0x6f, 0xbf, 0x30, 0x68, 0x6f,
+  0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0xbe, 0x46, 0x6e, 0xbf, 0x93, 0xb2, 0x6d,
+  0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x5e, 0x83, 0x6c, 0xbf, 0x58, 0xe8, 0x6b,
+  0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x7b, 0xab, 0x6a, 0xbf, 0xa7, 0x09, 0x6a,
+  0xbf, 0x91, 0x65, 0x69, 0xbf, 0x3c, 0xbf, 0x68, 0xbf, 0xa8, 0x16, 0x68,
+  0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xcc, 0xbe, 0x66, 0xbf, 0x88, 0x0f, 0x66,
+  0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x59, 0xaa, 0x64, 0xbf, 0x73, 0xf4, 0x63,
+  0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x10, 0x82, 0x62, 0xbf, 0x98, 0xc5, 0x61,
+  0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x21, 0x46, 0x60, 0xbf, 0x27, 0x83, 0x5f,
+  0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf, 0x53, 0x2d, 0x5d,
+  0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x1a, 0x94, 0x5b, 0xbf, 0x50, 0xc4, 0x5a,
+  0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x6a, 0x1e, 0x59, 0xbf, 0x53, 0x48, 0x58,
+  0xbf, 0x26, 0x70, 0x57, 0xbf, 0xe5, 0x95, 0x56, 0xbf, 0x93, 0xb9, 0x55,
+  0xbf, 0x31, 0xdb, 0x54, 0xbf, 0xc3, 0xfa, 0x53, 0xbf, 0x49, 0x18, 0x53,
+  0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x3d, 0x4d, 0x51, 0xbf, 0xaf, 0x64, 0x50,
+  0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0x90, 0x8d, 0x4e, 0xbf, 0x02, 0x9f, 0x4d,
+  0xbf, 0x79, 0xae, 0x4c, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf, 0x7f, 0xc7, 0x4a,
+  0xbf, 0x12, 0xd1, 0x49, 0xbf, 0xb3, 0xd8, 0x48, 0xbf, 0x65, 0xde, 0x47,
+  0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x03, 0xe4, 0x45, 0xbf, 0xf5, 0xe3, 0x44,
+  0xbf, 0x00, 0xe2, 0x43, 0xbf, 0x29, 0xde, 0x42, 0xbf, 0x70, 0xd8, 0x41,
+  0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x67, 0xc7, 0x3f, 0xbf, 0x1b, 0xbc, 0x3e,
+  0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x03, 0xa0, 0x3c, 0xbf, 0x3b, 0x8f, 0x3b,
+  0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x42, 0x68, 0x39, 0xbf, 0x16, 0x52, 0x38,
+  0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x6c, 0x20, 0x36, 0xbf, 0xf3, 0x04, 0x35,
+  0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xc9, 0xc8, 0x32, 0xbf, 0x1d, 0xa8, 0x31,
+  0xbf, 0xbb, 0x85, 0x30, 0xbf, 0xa5, 0x61, 0x2f, 0xbf, 0xde, 0x3b, 0x2e,
+  0xbf, 0x69, 0x14, 0x2d, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf, 0x82, 0xc0, 0x2a,
+  0xbf, 0x15, 0x94, 0x29, 0xbf, 0x05, 0x66, 0x28, 0xbf, 0x56, 0x36, 0x27,
+  0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x25, 0xd2, 0x24, 0xbf, 0xa9, 0x9d, 0x23,
+  0xbf, 0x99, 0x67, 0x22, 0xbf, 0xf9, 0x2f, 0x21, 0xbf, 0xcb, 0xf6, 0x1f,
+  0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf, 0x0c, 0x42, 0x1c,
+  0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x00, 0xc2, 0x19, 0xbf, 0xc0, 0x7f, 0x18,
+  0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xd9, 0xf6, 0x15, 0xbf, 0x39, 0xb0, 0x14,
+  0xbf, 0x2a, 0x68, 0x13, 0xbf, 0xb0, 0x1e, 0x12, 0xbf, 0xcd, 0xd3, 0x10,
+  0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xda, 0x39, 0x0e, 0xbf, 0xd0, 0xea, 0x0c,
+  0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xad, 0x48, 0x0a, 0xbf, 0x9b, 0xf5, 0x08,
+  0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x82, 0x4b, 0x06, 0xbf, 0x84, 0xf4, 0x04,
+  0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0xb1, 0x42, 0x02, 0xbf, 0xe4, 0xe7, 0x00,
+  0xbf, 0xb2, 0x17, 0xff, 0xbe, 0x27, 0x5d, 0xfc, 0xbe, 0x2d, 0xa0, 0xf9,
+  0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x07, 0x1f, 0xf4, 0xbe, 0xea, 0x5a, 0xf1,
+  0xbe, 0x79, 0x94, 0xee, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe, 0xb7, 0x00, 0xe9,
+  0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xfa, 0x63, 0xe3, 0xbe, 0x4f, 0x92, 0xe0,
+  0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x80, 0xe8, 0xda, 0xbe, 0x6b, 0x10, 0xd8,
+  0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x09, 0x5a, 0xd2, 0xbe, 0xca, 0x7b, 0xcf,
+  0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0x53, 0xb9, 0xc9, 0xbe, 0x29, 0xd5, 0xc6,
+  0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x1e, 0x07, 0xc1, 0xbe, 0x4a, 0x1d, 0xbe,
+  0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x2a, 0x44, 0xb8, 0xbe, 0xec, 0x54, 0xb5,
+  0xbe, 0xef, 0x63, 0xb2, 0xbe, 0x3a, 0x71, 0xaf, 0xbe, 0xd4, 0x7c, 0xac,
+  0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0x12, 0x8f, 0xa6, 0xbe, 0xc5, 0x95, 0xa3,
+  0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0x78, 0x9e, 0x9d, 0xbe, 0x86, 0xa0, 0x9a,
+  0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x31, 0xa0, 0x94, 0xbe, 0xdd, 0x9d, 0x91,
+  0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0x07, 0x95, 0x8b, 0xbe, 0x93, 0x8e, 0x88,
+  0xbe, 0xce, 0x86, 0x85, 0xbe, 0xc0, 0x7d, 0x82, 0xbe, 0xe1, 0xe6, 0x7e,
+  0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0x51, 0xb6, 0x72, 0xbe, 0x7f, 0x9a, 0x6c,
+  0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x13, 0x5c, 0x60, 0xbe, 0x97, 0x39, 0x5a,
+  0xbe, 0x01, 0x15, 0x54, 0xbe, 0x60, 0xee, 0x4d, 0xbe, 0xc2, 0xc5, 0x47,
+  0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe, 0x98, 0x40, 0x35,
+  0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0xfc, 0xde, 0x28, 0xbe, 0xb6, 0xab, 0x22,
+  0xbe, 0xde, 0x76, 0x1c, 0xbe, 0x83, 0x40, 0x16, 0xbe, 0xb7, 0x08, 0x10,
+  0xbe, 0x86, 0xcf, 0x09, 0xbe, 0x02, 0x95, 0x03, 0xbe, 0x73, 0xb2, 0xfa,
+  0xbd, 0x76, 0x38, 0xee, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd, 0xb9, 0x3d, 0xd5,
+  0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd, 0x80, 0xb6, 0xaf,
+  0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x05, 0xa9, 0x96, 0xbd, 0x0a, 0x20, 0x8a,
+  0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x68, 0x14, 0x62, 0xbd, 0x2f, 0xfb, 0x48,
+  0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2c, 0xc3, 0x16, 0xbd, 0xb9, 0x49, 0xfb,
+  0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb6, 0xc9, 0x96, 0xbc, 0x90, 0x0e, 0x49,
+  0xbc, 0x89, 0x0f, 0xc9, 0xbb, 0x00, 0x81, 0x03, 0x04, 0x6e, 0x61, 0x6d,
+  0x65, 0x00, 0x0f, 0x0e, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63,
+  0x68, 0x2e, 0x77, 0x61, 0x73, 0x6d, 0x01, 0xc8, 0x02, 0x18, 0x00, 0x08,
+  0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x01, 0x09, 0x66, 0x66,
+  0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x02, 0x0b, 0x66, 0x66, 0x74,
+  0x5f, 0x72, 0x32, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x03, 0x09, 0x66, 0x66,
+  0x74, 0x5f, 0x73, 0x65, 0x74, 0x75, 0x70, 0x04, 0x0c, 0x66, 0x66, 0x74,
+  0x5f, 0x72, 0x32, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x05, 0x0f, 0x66,
+  0x66, 0x74, 0x5f, 0x72, 0x32, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+  0x75, 0x6d, 0x06, 0x0b, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x07, 0x0c, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f,
+  0x62, 0x65, 0x6e, 0x63, 0x68, 0x08, 0x07, 0x63, 0x66, 0x66, 0x74, 0x5f,
+  0x72, 0x34, 0x09, 0x0f, 0x66, 0x66, 0x74, 0x5f, 0x72, 0x34, 0x5f, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x0a, 0x0b, 0x66, 0x66, 0x74,
+  0x5f, 0x73, 0x72, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x0b, 0x0c, 0x66, 0x66,
+  0x74, 0x5f, 0x73, 0x72, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x0c, 0x07,
+  0x63, 0x66, 0x66, 0x74, 0x5f, 0x73, 0x72, 0x0d, 0x0f, 0x66, 0x66, 0x74,
+  0x5f, 0x73, 0x72, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+  0x0e, 0x09, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x0f,
+  0x0a, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x10,
+  0x0d, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+  0x75, 0x6d, 0x11, 0x0c, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x12, 0x0d, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31,
+  0x35, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x13, 0x08, 0x63, 0x66, 0x66,
+  0x74, 0x5f, 0x71, 0x31, 0x35, 0x14, 0x10, 0x66, 0x66, 0x74, 0x5f, 0x71,
+  0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x15,
+  0x0d, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x16, 0x0e, 0x72, 0x66, 0x66, 0x74, 0x5f, 0x71, 0x31, 0x35,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x17, 0x11, 0x72, 0x66, 0x66, 0x74,
+  0x5f, 0x71, 0x31, 0x35, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+  0x6d, 0x07, 0x12, 0x01, 0x00, 0x0f, 0x5f, 0x5f, 0x73, 0x74, 0x61, 0x63,
+  0x6b, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x09, 0x0a, 0x01,
+  0x00, 0x07, 0x2e, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2d, 0x09,
+  0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x72, 0x73, 0x01, 0x0c, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2d, 0x62, 0x79, 0x01,
+  0x0c, 0x44, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x6e,
+  0x67, 0x06, 0x31, 0x34, 0x2e, 0x30, 0x2e, 0x36
 };
-unsigned int fft_bench_wasm_len = 5132;
+unsigned int fft_bench_wasm_len = 12632;
@@ -1,6 +1,11 @@
+#ifdef CONFIG_SOC_FAMILY_STM32
 #include <stm32f7xx.h>
+#else
+#include <cmsis_core.h>   /* board emulate: mps2/an500 */
+#endif
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -12,15 +17,45 @@
 #include "bh_log.h"
 #include "wasm_export.h"
 
+#define BENCH_STATS_PRINTF printk   /* report su UART (console Zephyr) */
+#define BENCH_STATS_EOL    "\n"
+#include "bench_stats.h"
+
 #include "fft_bench.wasm.h"   // generato da xxd -i
+#include "fft_bench.h"        // varianti e taglie del modulo FFT
+#if __has_include("kernels_bench.wasm.h")
+#include "kernels_bench.wasm.h"   // generato da wasm/kernels/build.sh
+#define HAVE_KERNELS_SUITE 1
+#endif
+#include "kernels_bench.h"
+#if __has_include("hostcall_bench.wasm.h")
+#include "hostcall_bench.wasm.h"   // generato da wasm/hostcall/build.sh
+#include "hostcall_bench.h"
+#include "hostcall_wamr.h"
+#define HAVE_HOSTCALL_SUITE 1
+#endif
+#if __has_include("suites_bench.wasm.h")
+#include "suites_bench.wasm.h"   // generato da wasm/suites/build.sh
+#include "suites_bench.h"
+#define HAVE_SUITES 1
+#endif
+#if __has_include("startup_modules.h")
+#include "startup_modules.h"   // generato da wasm/startup/build.sh
+#define HAVE_STARTUP_MODULES 1
+#endif
 
 /* Config WAMR */
 #define CONFIG_GLOBAL_HEAP_BUF_SIZE WASM_GLOBAL_HEAP_SIZE
 #define CONFIG_APP_STACK_SIZE       8192
+#ifndef CONFIG_APP_HEAP_SIZE   /* ridefinito da -DWAMR_DEFS (bench_sweep.py wamr) */
 #define CONFIG_APP_HEAP_SIZE        8192
+#endif
 #define CONFIG_MAIN_THREAD_STACK_SIZE 8192
 
-#define NUM_ITER  100
+#define NUM_ITER  10       /* FFT per round */
+#define WARMUP_ROUNDS   2   /* round scartati */
+#define NUM_ROUNDS      20  /* round misurati */
+#define MAX_CV_PERMILLE 20  /* oltre il 2% di CV la misura non vale */
 
 static int app_argc;
 static char **app_argv;
@@ -28,6 +63,9 @@ static char **app_argv;
 /* Risultati benchmark */
 static volatile uint32_t total_cycles = 0;
 static volatile uint32_t avg_cycles   = 0;
+/* cicli di ogni round misurato e statistiche */
+static uint64_t round_cycles[NUM_ROUNDS];
+static bench_stats_t stats;
 
 void enable_caches(void) {
     SCB_EnableICache();
@@ -35,8 +73,69 @@ void enable_caches(void) {
 }
 
 void enable_prefetch(void) {
+#ifdef CONFIG_SOC_FAMILY_STM32
     __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+#endif
+}
+
+#ifdef BENCH_OPCODE_PROFILE
+/*
+ * Profilo degli opcode dell'interprete (west build ... -- -DOPCODE_PROFILE=ON):
+ * dopo i round misurati di ogni kernel una riga "opprof {json}" con le
+ * esecuzioni di ogni opcode e di ogni coppia consecutiva, lo stesso record
+ * di linux_bench --opcode-profile (bench_opprof.py). I cicli di questa
+ * build non sono confrontabili con quelli normali.
+ */
+#if WASM_ENABLE_FAST_INTERP != 0
+#define OPPROF_RUNTIME "wamr-fast-interp"
+#else
+#define OPPROF_RUNTIME "wamr-interp"
+#endif
+
+typedef struct {
+    bool pairs;
+    bool first;
+    uint64_t total;
+} opprof_ctx_t;
+
+static void
+opprof_entry(void *arg, const char *op, const char *next, uint64_t count)
+{
+    opprof_ctx_t *ctx = arg;
+
+    if (next && !ctx->pairs) {
+        printk("},\"pairs\":{");
+        ctx->pairs = true;
+        ctx->first = true;
+    }
+    printk("%s\"%s%s%s\":%llu", ctx->first ? "" : ",", op, next ? " " : "",
+           next ? next : "", (unsigned long long)count);
+    ctx->first = false;
+    if (!next)
+        ctx->total += count;
+}
+
+/* module NULL: un modulo di suite, il kernel basta a riconoscerlo */
+static void
+opprof_dump(const char *module, const char *kernel, uint32_t iters)
+{
+    opprof_ctx_t ctx = { .first = true };
+
+    printk("opprof {\"source\":\"zephyr\",\"target\":\"%s\",\"runtime\":\"%s\","
+           "\"kernel\":\"%s\",\"module\":%s%s%s,\"size\":null,"
+           "\"iterations\":%u,\"reps\":%u,\"ops\":{",
+           CONFIG_BOARD, OPPROF_RUNTIME, kernel, module ? "\"" : "",
+           module ? module : "null", module ? "\"" : "", (unsigned)iters,
+           (unsigned)NUM_ROUNDS);
+    uint64_t dropped = wasm_runtime_get_opcode_counters(opprof_entry, &ctx);
+    printk("%s},\"total\":%llu,\"dropped\":%llu}\n", ctx.pairs ? "" : "},\"pairs\":{",
+           (unsigned long long)ctx.total, (unsigned long long)dropped);
 }
+#define opprof_reset() wasm_runtime_reset_opcode_counters()
+#else
+#define opprof_reset()             ((void)0)
+#define opprof_dump(m, k, iters)   ((void)0)
+#endif
 
 /* ===== Esegue init_buffer + bench(NUM_ITER) nel modulo Wasm e misura i cicli ===== */
 static void
@@ -68,44 +167,411 @@ run_fft_bench(wasm_module_inst_t module_inst)
         return;
     }
 
-    /* inizializza il buffer lato Wasm (non misurato) */
-    if (!wasm_runtime_call_wasm(exec_env, fn_init, 0, NULL)) {
-        exception = wasm_runtime_get_exception(module_inst);
-        printk("Exception in init_buffer: %s\n", exception ? exception : "<none>");
-        goto out;
-    }
-
     /* prepara DWT e disabilita SysTick/IRQ per una misura comparabile agli altri test */
     //DWT_Init();
     //SysTick->CTRL = 0;       /* disabilita SysTick */
-    //__disable_irq();
 
-    uint32_t start = k_cycle_get_32();
+    for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+        /* inizializza il buffer lato Wasm (non misurato, stesso input a ogni round) */
+        if (!wasm_runtime_call_wasm(exec_env, fn_init, 0, NULL)) {
+            exception = wasm_runtime_get_exception(module_inst);
+            printk("Exception in init_buffer: %s\n", exception ? exception : "<none>");
+            goto out;
+        }
+
+        /* profilo dal primo round misurato (conta anche i fft_init successivi) */
+        if (i == WARMUP_ROUNDS)
+            opprof_reset();
+
+        //__disable_irq();
+
+        uint32_t start = k_cycle_get_32();
+
+        /* bench(NUM_ITER) */
+        argv[0] = (uint32)NUM_ITER;
+        if (!wasm_runtime_call_wasm(exec_env, fn_bench, 1, argv)) {
+            //__enable_irq();
+            exception = wasm_runtime_get_exception(module_inst);
+            printk("Exception in bench: %s\n", exception ? exception : "<none>");
+            goto out;
+        }
+
+        uint32_t end = k_cycle_get_32();
 
-    /* bench(NUM_ITER) */
-    argv[0] = (uint32)NUM_ITER;
-    if (!wasm_runtime_call_wasm(exec_env, fn_bench, 1, argv)) {
         //__enable_irq();
-        exception = wasm_runtime_get_exception(module_inst);
-        printk("Exception in bench: %s\n", exception ? exception : "<none>");
-        goto out;
+
+        if (i >= WARMUP_ROUNDS) {
+            round_cycles[i - WARMUP_ROUNDS] = end - start;
+        }
     }
 
-    uint32_t end = k_cycle_get_32();
+    bench_stats_compute(round_cycles, NUM_ROUNDS, &stats);
+    total_cycles = (uint32_t)stats.median;
+    avg_cycles   = (uint32_t)(stats.median / NUM_ITER);
 
-    //__enable_irq();
+    printk("Zephyr + WAMR\n");
+    bench_stats_print("cycles per FFT", &stats, NUM_ITER);
+    bench_stats_check(&stats, MAX_CV_PERMILLE);
+    opprof_dump("fft_bench", "fft", NUM_ITER);
 
-    total_cycles = end - start;
-    avg_cycles   = total_cycles / NUM_ITER;
+out:
+    wasm_runtime_destroy_exec_env(exec_env);
+}
 
-    printk("Zephyr + WAMR\n");
-    printk("Total cycles: %lu\n", (unsigned long)total_cycles);
-    printk("Avg cycles per FFT: %lu\n", (unsigned long)avg_cycles);
+/* ===== Suite di kernel (wasm/kernels, wasm/hostcall): un altro modulo, stessi round della FFT ===== */
+static uint64_t suite_cycles[NUM_ROUNDS];
 
+static wasm_function_inst_t
+lookup_kernel_fn(wasm_module_inst_t module_inst, const char *kernel, const char *suffix)
+{
+    char fname[32];
+    wasm_function_inst_t fn;
+
+    snprintf(fname, sizeof(fname), "%s_%s", kernel, suffix);
+    fn = wasm_runtime_lookup_function(module_inst, fname);
+    if (!fn) {
+        printk("Failed to find %s\n", fname);
+    }
+    return fn;
+}
+
+/* init una sola volta per kernel (per taglia), iters per round: il checksum
+ * finale coincide con quello nativo e di linux_bench a parità di round.
+ * sizes NULL: init senza argomenti; altrimenti una riga "kernel@n" per
+ * taglia, con init(n) che riparte dallo stesso input (varianti FFT) */
+static void
+run_suite_inst(wasm_module_inst_t module_inst, const char *const *names, int num,
+               const uint32 *sizes, int num_sizes, uint32 iters)
+{
+    const char *exception;
+    wasm_exec_env_t exec_env;
+    bench_stats_t st;
+    uint32 argv[1];
+    char row[32];
+
+    if (!(exec_env = wasm_runtime_create_exec_env(module_inst, CONFIG_APP_STACK_SIZE))) {
+        printk("Create exec env failed\n");
+        return;
+    }
+
+    for (int k = 0; k < num; k++) {
+        wasm_function_inst_t fn_init     = lookup_kernel_fn(module_inst, names[k], "init");
+        wasm_function_inst_t fn_bench    = lookup_kernel_fn(module_inst, names[k], "bench");
+        wasm_function_inst_t fn_checksum = lookup_kernel_fn(module_inst, names[k], "checksum");
+
+        if (!fn_init || !fn_bench || !fn_checksum) {
+            goto fail;
+        }
+
+        for (int s = 0; s < (sizes ? num_sizes : 1); s++) {
+            if (sizes) {
+                snprintf(row, sizeof(row), "%s@%u", names[k], (unsigned)sizes[s]);
+                argv[0] = sizes[s];
+            } else {
+                snprintf(row, sizeof(row), "%s", names[k]);
+            }
+            if (!wasm_runtime_call_wasm(exec_env, fn_init, sizes ? 1 : 0, argv)) {
+                goto fail;
+            }
+
+            for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+                if (i == WARMUP_ROUNDS)
+                    opprof_reset();
+                argv[0] = iters;
+                uint32_t start = k_cycle_get_32();
+                bool ok = wasm_runtime_call_wasm(exec_env, fn_bench, 1, argv);
+                uint32_t end = k_cycle_get_32();
+
+                if (!ok) {
+                    goto fail;
+                }
+                if (i >= WARMUP_ROUNDS) {
+                    suite_cycles[i - WARMUP_ROUNDS] = end - start;
+                }
+            }
+
+            opprof_dump(NULL, row, iters);
+            /* il risultato di <kernel>_checksum torna in argv[0] */
+            if (!wasm_runtime_call_wasm(exec_env, fn_checksum, 0, argv)) {
+                goto fail;
+            }
+
+            bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+            bench_stats_print_row(row, &st, iters, argv[0]);
+        }
+    }
+    goto out;
+
+fail:
+    exception = wasm_runtime_get_exception(module_inst);
+    printk("Exception in kernels suite: %s\n", exception ? exception : "<none>");
 out:
     wasm_runtime_destroy_exec_env(exec_env);
 }
 
+#if defined(HAVE_KERNELS_SUITE) || defined(HAVE_HOSTCALL_SUITE) || defined(HAVE_SUITES)
+static void
+run_suite(const uint8 *data, uint32 data_len, const char *const *names, int num, uint32 iters)
+{
+    wasm_module_t module;
+    wasm_module_inst_t module_inst;
+    char error_buf[128];
+
+    if (!(module = wasm_runtime_load((uint8 *)data, data_len,
+                                     error_buf, sizeof(error_buf)))) {
+        printk("Load suite module failed: %s\n", error_buf);
+        return;
+    }
+    if (!(module_inst = wasm_runtime_instantiate(
+              module, CONFIG_APP_STACK_SIZE, CONFIG_APP_HEAP_SIZE,
+              error_buf, sizeof(error_buf)))) {
+        printk("Instantiate suite failed: %s\n", error_buf);
+        goto unload;
+    }
+    run_suite_inst(module_inst, names, num, NULL, 0, iters);
+    wasm_runtime_deinstantiate(module_inst);
+unload:
+    wasm_runtime_unload(module);
+}
+#endif
+
+#ifdef HAVE_KERNELS_SUITE
+static void
+run_kernels_suite(void)
+{
+    static const char *const names[KERNELS_SUITE_LEN] = { KERNELS_SUITE_NAMES };
+    run_suite(kernels_bench_wasm, kernels_bench_wasm_len, names, KERNELS_SUITE_LEN, NUM_ITER);
+}
+#endif
+
+#ifdef HAVE_HOSTCALL_SUITE
+/* ===== Costo delle chiamate host (wasm/hostcall): cicli per chiamata ===== */
+/* una chiamata a un import no-op per iterazione; hc_loop è il ciclo vuoto */
+static void
+run_hostcall_suite(void)
+{
+    static const char *const names[HOSTCALL_SUITE_LEN] = { HOSTCALL_SUITE_NAMES };
+    printk("host call: cicli per chiamata\n");
+    run_suite(hostcall_bench_wasm, hostcall_bench_wasm_len, names, HOSTCALL_SUITE_LEN, HOSTCALL_MCU_ITERS);
+}
+#endif
+
+#ifdef HAVE_SUITES
+/* ===== Suite di WAMR (wasm/suites): CoreMark, Dhrystone, PolyBench MINI ===== */
+static void
+run_suites_bench(void)
+{
+    static const char *const names[SUITES_LEN] = { SUITES_NAMES };
+    run_suite(suites_bench_wasm, suites_bench_wasm_len, names, SUITES_LEN, NUM_ITER);
+}
+#endif
+
+
+/* ===== Allocatore di WAMR con contatori (benchmark di avvio) =====
+ * Un'intestazione di 16 byte tiene la dimensione per free/realloc. Su Zephyr
+ * anche la memoria lineare passa di qui (os_mmap usa BH_MALLOC). */
+#define HEAP_HEADER 16
+
+static size_t heap_live, heap_peak;
+
+static void
+heap_add(size_t size)
+{
+    heap_live += size;
+    if (heap_live > heap_peak) {
+        heap_peak = heap_live;
+    }
+}
+
+static void *
+heap_malloc(unsigned int size)
+{
+    uint8 *block = malloc(size + HEAP_HEADER);
+    if (!block) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    heap_add(size);
+    return block + HEAP_HEADER;
+}
+
+static void
+heap_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    uint8 *block = (uint8 *)ptr - HEAP_HEADER;
+    heap_live -= *(size_t *)block;
+    free(block);
+}
+
+static void *
+heap_realloc(void *ptr, unsigned int size)
+{
+    if (!ptr) {
+        return heap_malloc(size);
+    }
+    uint8 *block = (uint8 *)ptr - HEAP_HEADER;
+    size_t old = *(size_t *)block;
+    block = realloc(block, size + HEAP_HEADER);
+    if (!block) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    heap_live -= old;
+    heap_add(size);
+    return block + HEAP_HEADER;
+}
+
+/* Impronta a runtime per bench_footprint.py: picco dell'allocatore di WAMR
+ * dall'avvio (runtime, modulo FFT, istanza ed exec_env) e stack massimo
+ * usato dal thread iwasm_main, dal watermark di CONFIG_INIT_STACKS. Con
+ * Alloc_With_Allocator wasm_runtime_get_mem_alloc_info non ha dati (li ha
+ * solo il pool, vedi STATUS nel firmware): contano heap_live/heap_peak. */
+static void
+print_footprint(void)
+{
+    size_t unused = 0;
+    k_tid_t self = k_current_get();
+
+    (void)k_thread_stack_space_get(self, &unused);
+    printk("Footprint: heap_live=%u heap_peak=%u stack_used=%u stack_size=%u\n",
+           (unsigned)heap_live, (unsigned)heap_peak,
+           (unsigned)(self->stack_info.size - unused), (unsigned)self->stack_info.size);
+}
+
+#ifdef HAVE_STARTUP_MODULES
+/* ===== Benchmark di avvio (wasm/startup) ===== */
+#define STARTUP_ROUNDS  10  /* avvii misurati per modulo, dopo uno scartato */
+#define STARTUP_PHASES  4
+#define STARTUP_CYCLES() k_cycle_get_32()
+
+static uint64_t startup_cycles[STARTUP_PHASES][STARTUP_ROUNDS];
+
+/* Fasi come linux_bench --startup: load (parse + validazione),
+ * instantiate (memoria lineare compresa), exec_env e first_call (lookup +
+ * prima chiamata). I byte sono il picco dell'allocatore in ogni fase
+ * rispetto a prima dell'avvio. */
+#define STARTUP_PHASE(p, stmt) do { \
+        heap_peak = heap_live; \
+        uint32_t t0_ = STARTUP_CYCLES(); \
+        stmt; \
+        uint32_t t1_ = STARTUP_CYCLES(); \
+        cyc[p] = t1_ - t0_; \
+        peak[p] = heap_peak - base; \
+    } while (0)
+
+/* Un avvio completo da una copia in RAM del modulo (il loader la modifica;
+ * la copia è fuori misura), poi libera tutto. Ritorna il numero di fasi,
+ * 0 se qualcosa fallisce. */
+static int
+startup_once(const startup_module_t *sm, uint32_t *cyc, size_t *peak)
+{
+    wasm_module_t module = NULL;
+    wasm_module_inst_t module_inst = NULL;
+    wasm_exec_env_t exec_env = NULL;
+    wasm_function_inst_t fn = NULL;
+    const char *exception;
+    uint32 argv[2];
+    char error_buf[128];
+    bool ok = false;
+    size_t base;
+    int n = 0;
+
+    uint8 *buf = malloc(sm->len);
+    if (!buf) {
+        printk("startup %s: OOM\n", sm->name);
+        return 0;
+    }
+    memcpy(buf, sm->data, sm->len);
+    base = heap_live;
+
+    STARTUP_PHASE(n, module = wasm_runtime_load(buf, sm->len, error_buf, sizeof(error_buf)));
+    n++;
+    if (!module) {
+        printk("startup %s: load failed: %s\n", sm->name, error_buf);
+        goto out;
+    }
+
+    STARTUP_PHASE(n, module_inst = wasm_runtime_instantiate(
+                         module, CONFIG_APP_STACK_SIZE, CONFIG_APP_HEAP_SIZE,
+                         error_buf, sizeof(error_buf)));
+    n++;
+    if (!module_inst) {
+        printk("startup %s: instantiate failed: %s\n", sm->name, error_buf);
+        goto out;
+    }
+
+    STARTUP_PHASE(n, exec_env = wasm_runtime_create_exec_env(module_inst, CONFIG_APP_STACK_SIZE));
+    n++;
+    if (!exec_env) {
+        printk("startup %s: create exec env failed\n", sm->name);
+        goto out;
+    }
+
+    if (sm->func) {
+        STARTUP_PHASE(n, fn = wasm_runtime_lookup_function(module_inst, sm->func);
+                         memcpy(argv, sm->argv, sizeof(argv));
+                         ok = fn && wasm_runtime_call_wasm(exec_env, fn, sm->argc, argv));
+        n++;
+        if (!ok) {
+            exception = wasm_runtime_get_exception(module_inst);
+            printk("startup %s: %s failed: %s\n", sm->name, sm->func,
+                   exception ? exception : "<none>");
+            goto out;
+        }
+    }
+    ok = true;
+
+out:
+    if (exec_env) {
+        wasm_runtime_destroy_exec_env(exec_env);
+    }
+    if (module_inst) {
+        wasm_runtime_deinstantiate(module_inst);
+    }
+    if (module) {
+        wasm_runtime_unload(module);
+    }
+    free(buf);
+    return ok ? n : 0;
+}
+
+static void
+run_startup_bench(void)
+{
+    static const char *const names[STARTUP_PHASES] = {
+        "load", "instantiate", "exec_env", "first_call"
+    };
+    uint32_t cyc[STARTUP_PHASES];
+    size_t peak[STARTUP_PHASES];
+    bench_stats_t st;
+
+    printk("startup: cicli per fase, picco heap WAMR in byte\n");
+    for (unsigned m = 0; m < STARTUP_MODULES_LEN; m++) {
+        const startup_module_t *sm = &startup_modules[m];
+        int n = 0;
+
+        for (int i = 0; i < 1 + STARTUP_ROUNDS; i++) {
+            n = startup_once(sm, cyc, peak);
+            if (n == 0) {
+                break;
+            }
+            for (int p = 0; i > 0 && p < n; p++) {
+                startup_cycles[p][i - 1] = cyc[p];
+            }
+        }
+        for (int p = 0; p < n; p++) {
+            bench_stats_compute(startup_cycles[p], STARTUP_ROUNDS, &st);
+            printk("%-10s %-11s median %lu  MAD %lu  min %lu  peak %lu B  (%u B)\n",
+                   sm->name, names[p], (unsigned long)st.median, (unsigned long)st.mad,
+                   (unsigned long)st.min, (unsigned long)peak[p], sm->len);
+        }
+    }
+}
+#endif
+
 
 /* ===== Thread che inizializza WAMR e lancia il benchmark ===== */
 void
@@ -128,7 +594,10 @@ iwasm_main(void *arg1, void *arg2, void *arg3)
 
 memset(&init_args, 0, sizeof(RuntimeInitArgs));
 
-init_args.mem_alloc_type = Alloc_With_System_Allocator;
+init_args.mem_alloc_type = Alloc_With_Allocator;
+init_args.mem_alloc_option.allocator.malloc_func  = (void *)heap_malloc;
+init_args.mem_alloc_option.allocator.realloc_func = (void *)heap_realloc;
+init_args.mem_alloc_option.allocator.free_func    = (void *)heap_free;
 
     /* nessun modulo nativo necessario per fft_bench.wasm */
     init_args.native_module_name  = NULL;
@@ -144,6 +613,14 @@ init_args.mem_alloc_type = Alloc_With_System_Allocator;
     bh_log_set_verbose_level(log_verbose_level);
 #endif
 
+#ifdef HAVE_HOSTCALL_SUITE
+    /* import di hostcall_bench: vanno registrati prima del load */
+    if (!hostcall_register_wamr()) {
+        printk("wasm_runtime_register_natives FAIL\n");
+        goto fail1;
+    }
+#endif
+
     /* usa il blob incluso fft_bench.wasm */
     wasm_file_buf  = (uint8 *)fft_bench_wasm;
     wasm_file_size = (uint32)fft_bench_wasm_len;
@@ -163,14 +640,47 @@ init_args.mem_alloc_type = Alloc_With_System_Allocator;
 
     /* esegue il benchmark FFT-like */
     run_fft_bench(wasm_module_inst);
+    print_footprint();
+
+    /* varianti alle taglie MCU sulla stessa istanza: wasm_runtime_load può
+     * riscrivere il buffer, quindi non lo si ricarica */
+    {
+        static const char *const names[FFT_VARIANT_LEN] = { FFT_VARIANT_NAMES };
+        static const uint32 sizes[FFT_MCU_SIZES_LEN] = { FFT_MCU_SIZES };
+        run_suite_inst(wasm_module_inst, names, FFT_VARIANT_LEN,
+                       sizes, FFT_MCU_SIZES_LEN, NUM_ITER);
+    }
 
     wasm_runtime_deinstantiate(wasm_module_inst);
 
 fail2:
     wasm_runtime_unload(wasm_module);
 
+#ifdef HAVE_KERNELS_SUITE
+    run_kernels_suite();
+#else
+    printk("kernels suite: manca kernels_bench.wasm.h (wasm/kernels/build.sh)\n");
+#endif
+
+#ifdef HAVE_HOSTCALL_SUITE
+    run_hostcall_suite();
+#else
+    printk("host call: manca hostcall_bench.wasm.h (wasm/hostcall/build.sh)\n");
+#endif
+#ifdef HAVE_SUITES
+    run_suites_bench();
+#else
+    printk("suites: manca suites_bench.wasm.h (wasm/suites/build.sh)\n");
+#endif
+#ifdef HAVE_STARTUP_MODULES
+    run_startup_bench();
+#else
+    printk("startup: manca startup_modules.h (wasm/startup/build.sh)\n");
+#endif
+
 fail1:
     wasm_runtime_destroy();
+    printk("BENCH DONE\n");
 
     /* puoi mettere un loop vuoto per fermare il thread */
     while (1) {
@@ -206,6 +716,9 @@ void
 main(void)
 {
     /* qui niente GPIO toggle, solo benchmark WAMR */
+#ifdef BENCH_EMU
+    printk("Clock: %u Hz\n", sys_clock_hw_cycles_per_sec());   /* per bench_emu.py */
+#endif
     enable_caches();
     enable_prefetch();
     (void)iwasm_init();
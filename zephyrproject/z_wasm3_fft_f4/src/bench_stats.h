@@ -0,0 +1,206 @@
+#ifndef BENCH_STATS_H
+#define BENCH_STATS_H
+
+#include <stdint.h>
+
+/*
+ * Statistiche sui round di misura di un benchmark: mediana, MAD, minimo e
+ * intervallo di confidenza al 95% della media. Solo header e solo
+ * aritmetica intera (più qualche double, niente libm), così la stessa copia
+ * compila su Linux e sugli MCU (Cube, Zephyr) senza cambiare link.
+ *
+ * Gli outlier sono i campioni con |x - mediana| > 3 * 1.4826 * MAD
+ * (3 deviazioni standard robuste): escono da media, deviazione standard,
+ * CI e CV, mentre mediana, MAD e minimo sono calcolati su tutti i campioni.
+ *
+ * Per stampare il report definire prima dell'include BENCH_STATS_PRINTF
+ * (default printf) e BENCH_STATS_EOL (default "\r\n", UART).
+ */
+
+typedef struct {
+    uint32_t n;             /* campioni misurati */
+    uint32_t outliers;      /* scartati per media/CI/CV */
+    uint64_t min;
+    uint64_t median;
+    uint64_t mad;
+    uint64_t mean;          /* sui campioni tenuti */
+    uint64_t stddev;
+    uint64_t ci95;          /* semiampiezza: mean +- ci95 */
+    uint32_t cv_permille;   /* stddev / mean, in per mille */
+} bench_stats_t;
+
+/* sqrt intera (floor) */
+static inline uint64_t bench_stats_isqrt(uint64_t v)
+{
+    uint64_t r = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+/* t di Student a due code, 95%, x1000, per df = 1..30 */
+static inline uint32_t bench_stats_t95_x1000(uint32_t df)
+{
+    static const uint16_t t95[30] = {
+        12706, 4303, 3182, 2776, 2571, 2447, 2365, 2306, 2262, 2228,
+         2201, 2179, 2160, 2145, 2131, 2120, 2110, 2101, 2093, 2086,
+         2080, 2074, 2069, 2064, 2060, 2056, 2052, 2048, 2045, 2042,
+    };
+    if (df == 0)   return 0;
+    if (df <= 30)  return t95[df - 1];
+    if (df <= 60)  return 2000;
+    if (df <= 120) return 1980;
+    return 1960;
+}
+
+/* i round sono pochi: insertion sort basta e non richiede memoria */
+static inline void bench_stats_sort(uint64_t *s, uint32_t n)
+{
+    for (uint32_t i = 1; i < n; i++) {
+        uint64_t v = s[i];
+        uint32_t j = i;
+        while (j > 0 && s[j - 1] > v) {
+            s[j] = s[j - 1];
+            j--;
+        }
+        s[j] = v;
+    }
+}
+
+/*
+ * MAD senza buffer di appoggio: con s ordinato, le distanze dalla mediana
+ * crescono sia scendendo a sinistra sia salendo a destra, quindi basta
+ * fonderle come due liste ordinate fino all'elemento centrale.
+ */
+static inline uint64_t bench_stats_mad(const uint64_t *s, uint32_t n, uint64_t med)
+{
+    int32_t l = -1;
+    uint32_t r;
+    uint64_t prev = 0, cur = 0;
+
+    while ((uint32_t)(l + 1) < n && s[l + 1] <= med) l++;
+    r = (uint32_t)(l + 1);
+
+    for (uint32_t k = 0; k <= n / 2; k++) {
+        uint64_t dl = l >= 0 ? med - s[l] : UINT64_MAX;
+        uint64_t dr = r < n ? s[r] - med : UINT64_MAX;
+        prev = cur;
+        if (dl <= dr) {
+            cur = dl;
+            l--;
+        } else {
+            cur = dr;
+            r++;
+        }
+    }
+    return (n & 1) ? cur : (prev + cur) / 2;
+}
+
+/* ordina s sul posto e riempie st; n == 0 lascia st azzerato */
+static inline void bench_stats_compute(uint64_t *s, uint32_t n, bench_stats_t *st)
+{
+    uint64_t lo, hi, band;
+    uint32_t kept = 0;
+    double sum = 0.0, ss = 0.0, mean;
+
+    *st = (bench_stats_t){ .n = n };
+    if (n == 0) return;
+
+    bench_stats_sort(s, n);
+    st->min    = s[0];
+    st->median = (n & 1) ? s[n / 2] : (s[n / 2 - 1] + s[n / 2]) / 2;
+    st->mad    = bench_stats_mad(s, n, st->median);
+
+    /* MAD nulla (misure identiche): nessuno scarto */
+    band = st->mad ? (st->mad * 4448u + 500u) / 1000u : UINT64_MAX;
+    lo = st->median > band ? st->median - band : 0;
+    hi = UINT64_MAX - st->median > band ? st->median + band : UINT64_MAX;
+
+    for (uint32_t i = 0; i < n; i++) {
+        if (s[i] < lo || s[i] > hi) continue;
+        sum += (double)s[i];
+        kept++;
+    }
+    st->outliers = n - kept;
+    mean = sum / kept;
+    st->mean = (uint64_t)(mean + 0.5);
+
+    if (kept < 2) return;
+    for (uint32_t i = 0; i < n; i++) {
+        if (s[i] < lo || s[i] > hi) continue;
+        ss += ((double)s[i] - mean) * ((double)s[i] - mean);
+    }
+    st->stddev = bench_stats_isqrt((uint64_t)(ss / (kept - 1) + 0.5));
+    /* t * s / sqrt(n), con sqrt(n) in millesimi */
+    st->ci95 = ((double)bench_stats_t95_x1000(kept - 1) * (double)st->stddev)
+               / (double)bench_stats_isqrt((uint64_t)kept * 1000000u) + 0.5;
+    st->cv_permille = st->mean ? (uint32_t)((st->stddev * 1000u + st->mean / 2) / st->mean) : 0;
+}
+
+#ifdef BENCH_STATS_PRINTF
+
+#ifndef BENCH_STATS_EOL
+#define BENCH_STATS_EOL "\r\n"
+#endif
+
+/*
+ * Report leggibile da UART; i valori sono divisi per div (es. cicli per
+ * round -> cicli per FFT) e stampati come unsigned long perché newlib-nano
+ * e printk minimale non gestiscono %llu.
+ */
+static inline void bench_stats_print(const char *unit, const bench_stats_t *st, uint32_t div)
+{
+    if (div == 0) div = 1;
+    BENCH_STATS_PRINTF("Rounds: %lu (outliers %lu)" BENCH_STATS_EOL,
+                       (unsigned long)st->n, (unsigned long)st->outliers);
+    BENCH_STATS_PRINTF("Median %s: %lu" BENCH_STATS_EOL, unit,
+                       (unsigned long)(st->median / div));
+    BENCH_STATS_PRINTF("MAD: %lu  Min: %lu" BENCH_STATS_EOL,
+                       (unsigned long)(st->mad / div), (unsigned long)(st->min / div));
+    BENCH_STATS_PRINTF("Mean: %lu +- %lu (95%% CI)" BENCH_STATS_EOL,
+                       (unsigned long)(st->mean / div), (unsigned long)(st->ci95 / div));
+    BENCH_STATS_PRINTF("CV: %lu.%lu%%" BENCH_STATS_EOL,
+                       (unsigned long)(st->cv_permille / 10),
+                       (unsigned long)(st->cv_permille % 10));
+}
+
+/* report compatto su una riga, per le suite con molti kernel */
+static inline void bench_stats_print_row(const char *name, const bench_stats_t *st,
+                                         uint32_t div, uint32_t checksum)
+{
+    if (div == 0) div = 1;
+    BENCH_STATS_PRINTF("%-8s median %lu  MAD %lu  min %lu  CV %lu.%lu%%  checksum 0x%08lx"
+                       BENCH_STATS_EOL, name,
+                       (unsigned long)(st->median / div), (unsigned long)(st->mad / div),
+                       (unsigned long)(st->min / div),
+                       (unsigned long)(st->cv_permille / 10),
+                       (unsigned long)(st->cv_permille % 10),
+                       (unsigned long)checksum);
+}
+
+/* ultima riga del report: RESULT: OK / RESULT: FAIL, per chi legge la UART */
+static inline int bench_stats_check(const bench_stats_t *st, uint32_t max_cv_permille)
+{
+    if (st->cv_permille > max_cv_permille) {
+        BENCH_STATS_PRINTF("RESULT: FAIL (CV > %lu.%lu%%)" BENCH_STATS_EOL,
+                           (unsigned long)(max_cv_permille / 10),
+                           (unsigned long)(max_cv_permille % 10));
+        return 0;
+    }
+    BENCH_STATS_PRINTF("RESULT: OK" BENCH_STATS_EOL);
+    return 1;
+}
+
+#endif /* BENCH_STATS_PRINTF */
+
+#endif /* BENCH_STATS_H */
@@ -1,5 +1,27 @@
 #include <zephyr/kernel.h>
+#ifdef CONFIG_SOC_FAMILY_STM32
 #include <stm32f4xx.h>
+#else
+#include <cmsis_core.h>   /* board emulate: mps2/an385, qemu_cortex_m3 */
+#endif
+
+/*
+ * BENCH_EMU (target emulati, vedi zephyrproject/bench_emu): il DWT manca
+ * (QEMU) o non conta i cicli (Renode), quindi si misura con k_cycle_get_32,
+ * che con QEMU -icount e con Renode avanza con le istruzioni eseguite.
+ * SysTick e IRQ restano attivi: k_cycle_get_32 ne ha bisogno.
+ */
+#ifdef BENCH_EMU
+#define BENCH_CYCLES()      k_cycle_get_32()
+#define BENCH_SYSTICK_OFF() ((void)0)
+#define BENCH_IRQ_OFF()     ((void)0)
+#define BENCH_IRQ_ON()      ((void)0)
+#else
+#define BENCH_CYCLES()      DWT->CYCCNT
+#define BENCH_SYSTICK_OFF() (SysTick->CTRL = 0)
+#define BENCH_IRQ_OFF()     __disable_irq()
+#define BENCH_IRQ_ON()      __enable_irq()
+#endif
 
 #if __has_include(<wasm3.h>)
 #include <wasm3.h>
@@ -18,20 +40,54 @@
 #endif
 
 #include "fft_bench.wasm.h"
+#include "fft_bench.h"        // varianti e taglie del modulo FFT
+#if __has_include("kernels_bench.wasm.h")
+#include "kernels_bench.wasm.h"   // generato da wasm/kernels/build.sh
+#define HAVE_KERNELS_SUITE 1
+#endif
+#include "kernels_bench.h"
+#if __has_include("hostcall_bench.wasm.h")
+#include "hostcall_bench.wasm.h"   // generato da wasm/hostcall/build.sh
+#include "hostcall_bench.h"
+#include "hostcall_wasm3.h"
+#define HAVE_HOSTCALL_SUITE 1
+#endif
+#if __has_include("suites_bench.wasm.h")
+#include "suites_bench.wasm.h"   // generato da wasm/suites/build.sh
+#include "suites_bench.h"
+#define HAVE_SUITES 1
+#endif
+#if __has_include("startup_modules.h")
+#include "startup_modules.h"   // generato da wasm/startup/build.sh
+#define HAVE_STARTUP_MODULES 1
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define BENCH_STATS_PRINTF printk   // report su UART (console Zephyr)
+#include "bench_stats.h"
 
-#define NUM_ITER  100
+#define NUM_ITER  10       // FFT per round
+#define WARMUP_ROUNDS   2   // round scartati
+#define NUM_ROUNDS      20  // round misurati
+#define MAX_CV_PERMILLE 20  // oltre il 2% di CV la misura non vale
 
 volatile uint32_t total_cycles_wasm = 0;
 volatile uint32_t avg_cycles_wasm   = 0;
+// Cicli di ogni round misurato e statistiche
+static uint64_t round_cycles[NUM_ROUNDS];
+static bench_stats_t stats;
 
 
     
    
 
 static void DWT_Init(void) {
+#ifndef BENCH_EMU
 	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // abilita DWT
 	DWT->CYCCNT = 0;
 	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 }
 
 static void wasm_panic(const char* where, M3Result r) {
@@ -42,6 +98,65 @@ static void wasm_panic(const char* where, M3Result r) {
     while (1) {}
 }
 
+// Impronta a runtime per bench_footprint.py: picco di m3_Malloc dall'avvio
+// (runtime + modulo FFT caricato e compilato) e stack massimo usato dal
+// thread main, dal watermark di CONFIG_INIT_STACKS.
+static void print_footprint(void) {
+	size_t live, peak, unused = 0;
+	k_tid_t self = k_current_get();
+
+	m3_GetHeapStats(&live, &peak);
+	(void)k_thread_stack_space_get(self, &unused);
+	printk("Footprint: heap_live=%u heap_peak=%u stack_used=%u stack_size=%u\r\n",
+	       (unsigned)live, (unsigned)peak,
+	       (unsigned)(self->stack_info.size - unused), (unsigned)self->stack_info.size);
+}
+
+#ifdef BENCH_OPCODE_PROFILE
+// Profilo delle operazioni di wasm3 (west build ... -- -DOPCODE_PROFILE=ON):
+// dopo i round misurati di ogni kernel una riga "opprof {json}" con le
+// esecuzioni di ogni operazione e di ogni coppia consecutiva, lo stesso
+// record di linux_bench --opcode-profile (bench_opprof.py). I cicli di
+// questa build non sono confrontabili con quelli normali.
+typedef struct {
+	bool pairs;
+	bool first;
+	uint64_t total;
+} opprof_ctx_t;
+
+static void opprof_entry(void *arg, const char *op, const char *next, uint64_t count) {
+	opprof_ctx_t *ctx = arg;
+
+	if (next && !ctx->pairs) {
+		printk("},\"pairs\":{");
+		ctx->pairs = true;
+		ctx->first = true;
+	}
+	printk("%s\"%s%s%s\":%llu", ctx->first ? "" : ",", op, next ? " " : "",
+	       next ? next : "", (unsigned long long)count);
+	ctx->first = false;
+	if (!next) ctx->total += count;
+}
+
+static void opprof_dump(const char *module, const char *kernel, uint32_t iters) {
+	opprof_ctx_t ctx = { .first = true };
+
+	// module NULL: un modulo di suite, il kernel basta a riconoscerlo
+	printk("opprof {\"source\":\"zephyr\",\"target\":\"%s\",\"runtime\":\"wasm3\","
+	       "\"kernel\":\"%s\",\"module\":%s%s%s,\"size\":null,"
+	       "\"iterations\":%u,\"reps\":%u,\"ops\":{",
+	       CONFIG_BOARD, kernel, module ? "\"" : "", module ? module : "null",
+	       module ? "\"" : "", (unsigned)iters, (unsigned)NUM_ROUNDS);
+	uint64_t dropped = m3_ForEachProfilerCount(opprof_entry, &ctx);
+	printk("%s},\"total\":%llu,\"dropped\":%llu}\r\n", ctx.pairs ? "" : "},\"pairs\":{",
+	       (unsigned long long)ctx.total, (unsigned long long)dropped);
+}
+#define opprof_reset() m3_ResetProfilerInfo()
+#else
+#define opprof_reset()             ((void)0)
+#define opprof_dump(m, k, iters)   ((void)0)
+#endif
+
 static void run_wasm_fft_benchmark(void) {
 	M3Result r;
 
@@ -76,32 +191,44 @@ static void run_wasm_fft_benchmark(void) {
 
 	// Inizializzazione DWT e disabilitazione SysTick/IRQ per confronto pulito
 	DWT_Init();
-	SysTick->CTRL = 0;    // disabilita SysTick (come nei test nativi)
+	BENCH_SYSTICK_OFF();    // disabilita SysTick (come nei test nativi)
 
-	// Inizializza il buffer dentro il modulo Wasm
-	r = m3_CallV(fn_init);
-	if (r) wasm_panic("m3_CallV(init_buffer)", r);
+	for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+		// Inizializza il buffer dentro il modulo Wasm (stesso input a ogni round)
+		r = m3_CallV(fn_init);
+		if (r) wasm_panic("m3_CallV(init_buffer)", r);
 
-	__disable_irq();
+		// profilo dal primo round misurato (conta anche i fft_init successivi)
+		if (i == WARMUP_ROUNDS) opprof_reset();
 
-	uint32_t start = DWT->CYCCNT;
+		BENCH_IRQ_OFF();
 
-	// bench(NUM_ITER) dentro Wasm
-	r = m3_CallV(fn_bench, (uint32_t)NUM_ITER);
-	if (r) {
-		__enable_irq();
-		wasm_panic("m3_CallV(bench)", r);
-	}
+		uint32_t start = BENCH_CYCLES();
 
-	uint32_t end = DWT->CYCCNT;
+		// bench(NUM_ITER) dentro Wasm
+		r = m3_CallV(fn_bench, (uint32_t)NUM_ITER);
+		if (r) {
+			BENCH_IRQ_ON();
+			wasm_panic("m3_CallV(bench)", r);
+		}
 
-	__enable_irq();
+		uint32_t end = BENCH_CYCLES();
 
-	total_cycles_wasm = end - start;
-	avg_cycles_wasm   = total_cycles_wasm / NUM_ITER;
+		BENCH_IRQ_ON();
+
+		if (i >= WARMUP_ROUNDS) {
+			round_cycles[i - WARMUP_ROUNDS] = end - start;
+		}
+	}
+
+	bench_stats_compute(round_cycles, NUM_ROUNDS, &stats);
+	total_cycles_wasm = (uint32_t)stats.median;
+	avg_cycles_wasm   = (uint32_t)(stats.median / NUM_ITER);
 	printk("Zephyr + wasm3\r\n");
-	printk("Total cycles: %lu\r\n", (unsigned long)total_cycles_wasm);
-	printk("Avg cycles per FFT: %lu\r\n", (unsigned long)avg_cycles_wasm);
+	bench_stats_print("cycles per FFT", &stats, NUM_ITER);
+	bench_stats_check(&stats, MAX_CV_PERMILLE);
+	print_footprint();
+	opprof_dump("fft_bench", "fft", NUM_ITER);
 
 	
 	// cleanup opzionale (tanto poi non usciamo da main)
@@ -109,9 +236,272 @@ static void run_wasm_fft_benchmark(void) {
 	m3_FreeEnvironment(env);
 }
 
+//------------------------------
+// Suite di kernel (wasm/kernels)
+//------------------------------
+static uint64_t suite_cycles[NUM_ROUNDS];
+
+static IM3Function find_kernel_fn(IM3Runtime rt, const char *kernel, const char *suffix) {
+	char fname[32];
+	IM3Function fn = NULL;
+
+	snprintf(fname, sizeof(fname), "%s_%s", kernel, suffix);
+	M3Result r = m3_FindFunction(&fn, rt, fname);
+	if (r || !fn) wasm_panic(fname, r);
+	return fn;
+}
+
+// Un modulo di suite (kernels_bench, hostcall_bench, suites_bench): stessi
+// round della FFT, iters per round; init una sola volta, così il checksum
+// finale coincide con quello nativo e di linux_bench a parità di round.
+// sizes: NULL se init non ha argomenti, altrimenti una riga "kernel@n" per
+// taglia, con init(n) che riparte dallo stesso input (varianti FFT).
+// stack: byte dello stack di wasm3 (CoreMark e PolyBench non stanno in 1 KB).
+static void run_wasm_suite(const uint8_t *wasm, uint32_t wasm_len,
+		const char *const *names, int num, const uint32_t *sizes, int num_sizes,
+		uint32_t iters, uint32_t stack) {
+	M3Result r;
+	bench_stats_t st;
+
+	IM3Environment env = m3_NewEnvironment();
+	if (!env) wasm_panic("m3_NewEnvironment", "OOM");
+	IM3Runtime rt = m3_NewRuntime(env, stack, NULL);
+	if (!rt) wasm_panic("m3_NewRuntime", "OOM");
+
+	IM3Module mod = NULL;
+	r = m3_ParseModule(env, &mod,
+			wasm, wasm_len);
+	if (r) wasm_panic("m3_ParseModule(suite)", r);
+	r = m3_LoadModule(rt, mod);
+	if (r) wasm_panic("m3_LoadModule(suite)", r);
+#ifdef HAVE_HOSTCALL_SUITE
+	// import di hostcall_bench; gli altri moduli non li hanno
+	r = hostcall_link_wasm3(mod);
+	if (r) wasm_panic("m3_LinkRawFunction(hostcall)", r);
+#endif
+
+	for (int k = 0; k < num; k++) {
+		IM3Function fn_init     = find_kernel_fn(rt, names[k], "init");
+		IM3Function fn_bench    = find_kernel_fn(rt, names[k], "bench");
+		IM3Function fn_checksum = find_kernel_fn(rt, names[k], "checksum");
+
+		for (int s = 0; s < (sizes ? num_sizes : 1); s++) {
+			char row[32];
+			uint32_t checksum = 0;
+
+			if (sizes) {
+				snprintf(row, sizeof(row), "%s@%lu", names[k], (unsigned long)sizes[s]);
+				r = m3_CallV(fn_init, sizes[s]);
+			} else {
+				snprintf(row, sizeof(row), "%s", names[k]);
+				r = m3_CallV(fn_init);
+			}
+			if (r) wasm_panic("m3_CallV(kernel init)", r);
+
+			for (int i = 0; i < WARMUP_ROUNDS + NUM_ROUNDS; i++) {
+				if (i == WARMUP_ROUNDS) opprof_reset();
+				BENCH_IRQ_OFF();
+				uint32_t start = BENCH_CYCLES();
+				r = m3_CallV(fn_bench, iters);
+				uint32_t end = BENCH_CYCLES();
+				BENCH_IRQ_ON();
+				if (r) wasm_panic("m3_CallV(kernel bench)", r);
+
+				if (i >= WARMUP_ROUNDS) {
+					suite_cycles[i - WARMUP_ROUNDS] = end - start;
+				}
+			}
+
+			opprof_dump(NULL, row, iters);
+			r = m3_CallV(fn_checksum);
+			if (!r) r = m3_GetResultsV(fn_checksum, &checksum);
+			if (r) wasm_panic("m3_CallV(kernel checksum)", r);
+
+			bench_stats_compute(suite_cycles, NUM_ROUNDS, &st);
+			bench_stats_print_row(row, &st, iters, checksum);
+		}
+	}
+
+	m3_FreeRuntime(rt);
+	m3_FreeEnvironment(env);
+}
+
+#ifdef HAVE_KERNELS_SUITE
+static void run_wasm_kernels_suite(void) {
+	static const char *const names[KERNELS_SUITE_LEN] = { KERNELS_SUITE_NAMES };
+	run_wasm_suite(kernels_bench_wasm, kernels_bench_wasm_len,
+			names, KERNELS_SUITE_LEN, NULL, 0, NUM_ITER, 1024);
+}
+#endif
+
+// Varianti del modulo FFT alle taglie MCU (fft_bench.h): righe "fft_r2@256"
+// ecc.; lo split-radix ricorsivo non sta nello stack da 1 KB di fft_bench.
+static void run_wasm_fft_variants(void) {
+	static const char *const names[FFT_VARIANT_LEN] = { FFT_VARIANT_NAMES };
+	static const uint32_t sizes[FFT_MCU_SIZES_LEN] = { FFT_MCU_SIZES };
+	run_wasm_suite(fft_bench_wasm, fft_bench_wasm_len,
+			names, FFT_VARIANT_LEN, sizes, FFT_MCU_SIZES_LEN, NUM_ITER, 4096);
+}
+
+//------------------------------
+// Costo delle chiamate host (wasm/hostcall)
+//------------------------------
+#ifdef HAVE_HOSTCALL_SUITE
+// Una chiamata a un import no-op per iterazione: cicli per chiamata, senza
+// oscilloscopio; hc_loop è il ciclo vuoto da sottrarre.
+static void run_wasm_hostcall_suite(void) {
+	static const char *const names[HOSTCALL_SUITE_LEN] = { HOSTCALL_SUITE_NAMES };
+	printk("host call: cicli per chiamata\r\n");
+	run_wasm_suite(hostcall_bench_wasm, hostcall_bench_wasm_len,
+			names, HOSTCALL_SUITE_LEN, NULL, 0, HOSTCALL_MCU_ITERS, 1024);
+}
+#endif
+
+//------------------------------
+// Suite di WAMR (wasm/suites)
+//------------------------------
+#ifdef HAVE_SUITES
+// CoreMark, Dhrystone e PolyBench MINI con l'interfaccia dei kernel
+static void run_suites_bench(void) {
+	static const char *const names[SUITES_LEN] = { SUITES_NAMES };
+	run_wasm_suite(suites_bench_wasm, suites_bench_wasm_len,
+			names, SUITES_LEN, NULL, 0, NUM_ITER, 4096);
+}
+#endif
+
+//------------------------------
+// Benchmark di avvio (wasm/startup)
+//------------------------------
+#ifdef HAVE_STARTUP_MODULES
+#define STARTUP_ROUNDS  10  // avvii misurati per modulo, dopo uno scartato
+#define STARTUP_PHASES  5
+// IRQ abilitate: malloc usa un mutex
+#define STARTUP_CYCLES() BENCH_CYCLES()
+
+static uint64_t startup_cycles[STARTUP_PHASES][STARTUP_ROUNDS];
+
+// Fasi come linux_bench --startup: runtime (m3_NewEnvironment/NewRuntime),
+// parse, load, compile (m3_FindFunction) e first_call, che compila in modo
+// lazy le funzioni raggiunte. I byte sono quelli di m3_Malloc (d_m3HeapStats):
+// picco di ogni fase rispetto a prima dell'avvio.
+#define STARTUP_PHASE(p, stmt) do { \
+		size_t live_, peak_; \
+		m3_ResetHeapPeak(); \
+		uint32_t t0_ = STARTUP_CYCLES(); \
+		stmt; \
+		uint32_t t1_ = STARTUP_CYCLES(); \
+		m3_GetHeapStats(&live_, &peak_); \
+		cyc[p] = t1_ - t0_; \
+		peak[p] = peak_ - base; \
+	} while (0)
+
+// Un avvio completo da una copia in RAM del modulo (la copia è fuori misura),
+// poi libera tutto. Ritorna il numero di fasi, 0 se qualcosa fallisce.
+static int wasm_startup_once(const startup_module_t *sm, uint32_t *cyc, size_t *peak) {
+	IM3Environment env = NULL;
+	IM3Runtime rt = NULL;
+	IM3Module mod = NULL;
+	IM3Function fn = NULL;
+	M3Result r = m3Err_none;
+	const void *argptrs[2] = { &sm->argv[0], &sm->argv[1] };
+	size_t base, unused;
+	int n = 0;
+
+	uint8_t *buf = malloc(sm->len);
+	if (!buf) {
+		printk("startup %s: OOM\r\n", sm->name);
+		return 0;
+	}
+	memcpy(buf, sm->data, sm->len);
+	m3_GetHeapStats(&base, &unused);
+
+	STARTUP_PHASE(n, env = m3_NewEnvironment(); rt = env ? m3_NewRuntime(env, 1024, NULL) : NULL);
+	n++;
+	if (!rt) { r = "m3_NewRuntime: OOM"; goto out; }
+
+	STARTUP_PHASE(n, r = m3_ParseModule(env, &mod, buf, sm->len));
+	n++;
+	if (r) goto out;
+
+	STARTUP_PHASE(n, r = m3_LoadModule(rt, mod));
+	n++;
+	if (r) { m3_FreeModule(mod); goto out; }
+
+	if (sm->func) {
+		STARTUP_PHASE(n, r = m3_FindFunction(&fn, rt, sm->func));
+		n++;
+		if (r) goto out;
+
+		STARTUP_PHASE(n, r = m3_Call(fn, sm->argc, argptrs));
+		n++;
+	}
+
+out:
+	if (r) printk("startup %s: %s\r\n", sm->name, r);
+	if (rt) m3_FreeRuntime(rt);
+	if (env) m3_FreeEnvironment(env);
+	free(buf);
+	return r ? 0 : n;
+}
+
+static void run_wasm_startup_bench(void) {
+	static const char *const names[STARTUP_PHASES] = {
+		"runtime", "parse", "load", "compile", "first_call"
+	};
+	uint32_t cyc[STARTUP_PHASES];
+	size_t peak[STARTUP_PHASES];
+	bench_stats_t st;
+
+	printk("startup: cicli per fase, picco heap wasm3 in byte\r\n");
+	for (unsigned m = 0; m < STARTUP_MODULES_LEN; m++) {
+		const startup_module_t *sm = &startup_modules[m];
+		int n = 0;
+
+		for (int i = 0; i < 1 + STARTUP_ROUNDS; i++) {
+			n = wasm_startup_once(sm, cyc, peak);
+			if (n == 0) break;
+			for (int p = 0; i > 0 && p < n; p++) {
+				startup_cycles[p][i - 1] = cyc[p];
+			}
+		}
+		for (int p = 0; p < n; p++) {
+			bench_stats_compute(startup_cycles[p], STARTUP_ROUNDS, &st);
+			printk("%-10s %-10s median %lu  MAD %lu  min %lu  peak %lu B  (%u B)\r\n",
+			       sm->name, names[p], (unsigned long)st.median, (unsigned long)st.mad,
+			       (unsigned long)st.min, (unsigned long)peak[p], sm->len);
+		}
+	}
+}
+#endif
+
 void main(void) {
+#ifdef BENCH_EMU
+    printk("Clock: %u Hz\r\n", sys_clock_hw_cycles_per_sec());   /* per bench_emu.py */
+#endif
     
     run_wasm_fft_benchmark(); 
+    run_wasm_fft_variants();
+#ifdef HAVE_KERNELS_SUITE
+    run_wasm_kernels_suite();
+#else
+    printk("kernels suite: manca kernels_bench.wasm.h (wasm/kernels/build.sh)\r\n");
+#endif
+#ifdef HAVE_HOSTCALL_SUITE
+    run_wasm_hostcall_suite();
+#else
+    printk("host call: manca hostcall_bench.wasm.h (wasm/hostcall/build.sh)\r\n");
+#endif
+#ifdef HAVE_SUITES
+    run_suites_bench();
+#else
+    printk("suites: manca suites_bench.wasm.h (wasm/suites/build.sh)\r\n");
+#endif
+#ifdef HAVE_STARTUP_MODULES
+    run_wasm_startup_bench();
+#else
+    printk("startup: manca startup_modules.h (wasm/startup/build.sh)\r\n");
+#endif
+    printk("BENCH DONE\r\n");
     
     while (1) {
         __NOP();
@@ -0,0 +1,2287 @@
+/* generato da wasm/startup/build.sh: moduli del benchmark di avvio */
+#ifndef STARTUP_MODULES_H
+#define STARTUP_MODULES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    const char          *name;
+    const unsigned char *data;
+    unsigned int         len;
+    const char          *func;   /* NULL: nessuna prima chiamata */
+    uint32_t             argc;
+    uint32_t             argv[2];
+} startup_module_t;
+
+static const unsigned char toggle_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x60,
+  0x00, 0x00, 0x02, 0x13, 0x01, 0x03, 0x65, 0x6e, 0x76, 0x0b, 0x67, 0x70,
+  0x69, 0x6f, 0x5f, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x00, 0x00, 0x03,
+  0x02, 0x01, 0x00, 0x07, 0x12, 0x01, 0x0e, 0x74, 0x6f, 0x67, 0x67, 0x6c,
+  0x65, 0x5f, 0x66, 0x6f, 0x72, 0x65, 0x76, 0x65, 0x72, 0x00, 0x01, 0x0a,
+  0x0b, 0x01, 0x09, 0x00, 0x03, 0x40, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x0b
+};
+static const unsigned int toggle_wasm_len = 72;
+
+static const unsigned char math_ops_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x02, 0x60,
+  0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x03,
+  0x02, 0x00, 0x01, 0x04, 0x05, 0x01, 0x70, 0x01, 0x01, 0x01, 0x05, 0x04,
+  0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x01, 0x7f, 0x01, 0x41, 0x80, 0x18,
+  0x0b, 0x07, 0x1b, 0x03, 0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x02,
+  0x00, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00, 0x08, 0x73, 0x75, 0x6d, 0x5f,
+  0x74, 0x6f, 0x5f, 0x6e, 0x00, 0x01, 0x0a, 0x27, 0x02, 0x07, 0x00, 0x20,
+  0x01, 0x20, 0x00, 0x6a, 0x0b, 0x1d, 0x00, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x4e, 0x0d, 0x00, 0x41, 0x00, 0x0f, 0x0b, 0x20, 0x00, 0xad, 0x20,
+  0x00, 0x41, 0x01, 0x6a, 0xad, 0x7e, 0x42, 0x01, 0x88, 0xa7, 0x0b, 0x00,
+  0x3b, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x0e, 0x0d, 0x6d, 0x61, 0x74,
+  0x68, 0x5f, 0x6f, 0x70, 0x73, 0x2e, 0x77, 0x61, 0x73, 0x6d, 0x01, 0x10,
+  0x02, 0x00, 0x03, 0x61, 0x64, 0x64, 0x01, 0x08, 0x73, 0x75, 0x6d, 0x5f,
+  0x74, 0x6f, 0x5f, 0x6e, 0x07, 0x12, 0x01, 0x00, 0x0f, 0x5f, 0x5f, 0x73,
+  0x74, 0x61, 0x63, 0x6b, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72,
+  0x00, 0x7f, 0x09, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x72, 0x73,
+  0x01, 0x0c, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2d,
+  0x62, 0x79, 0x01, 0x05, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x5f, 0x32, 0x31,
+  0x2e, 0x31, 0x2e, 0x34, 0x2d, 0x77, 0x61, 0x73, 0x69, 0x2d, 0x73, 0x64,
+  0x6b, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x67,
+  0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x6c, 0x6c,
+  0x76, 0x6d, 0x2f, 0x6c, 0x6c, 0x76, 0x6d, 0x2d, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x20, 0x32, 0x32, 0x32, 0x66, 0x63, 0x31, 0x31, 0x66,
+  0x32, 0x62, 0x38, 0x66, 0x32, 0x35, 0x66, 0x36, 0x61, 0x30, 0x66, 0x34,
+  0x39, 0x37, 0x36, 0x32, 0x37, 0x32, 0x65, 0x66, 0x31, 0x62, 0x62, 0x37,
+  0x62, 0x66, 0x34, 0x39, 0x35, 0x32, 0x31, 0x64, 0x29, 0x00, 0x94, 0x01,
+  0x0f, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x65, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x73, 0x08, 0x2b, 0x0b, 0x62, 0x75, 0x6c, 0x6b, 0x2d,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2b, 0x0f, 0x62, 0x75, 0x6c, 0x6b,
+  0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2d, 0x6f, 0x70, 0x74, 0x2b,
+  0x16, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x69, 0x6e, 0x64, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x6f, 0x6e, 0x67, 0x2b,
+  0x0a, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2b,
+  0x0f, 0x6d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2d, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x73, 0x2b, 0x13, 0x6e, 0x6f, 0x6e, 0x74, 0x72, 0x61,
+  0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x70, 0x74, 0x6f, 0x69, 0x6e,
+  0x74, 0x2b, 0x0f, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65,
+  0x2d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2b, 0x08, 0x73, 0x69, 0x67, 0x6e,
+  0x2d, 0x65, 0x78, 0x74
+};
+static const unsigned int math_ops_wasm_len = 460;
+
+static const unsigned char fft_bench_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
+  0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x03, 0x03, 0x02, 0x00, 0x01, 0x04,
+  0x05, 0x01, 0x70, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01, 0x06,
+  0x08, 0x01, 0x7f, 0x01, 0x41, 0x80, 0xe8, 0x01, 0x0b, 0x07, 0x21, 0x03,
+  0x06, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x02, 0x00, 0x08, 0x66, 0x66,
+  0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x09, 0x66, 0x66, 0x74,
+  0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x01, 0x0a, 0xc6, 0x04, 0x02,
+  0x63, 0x02, 0x02, 0x7f, 0x02, 0x7d, 0x41, 0x00, 0x21, 0x00, 0x41, 0x80,
+  0xa8, 0x80, 0x80, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00,
+  0xb3, 0x22, 0x02, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x08, 0x6a, 0x20,
+  0x00, 0x41, 0x01, 0x6a, 0xb3, 0x22, 0x03, 0x38, 0x02, 0x00, 0x20, 0x01,
+  0x41, 0x04, 0x6a, 0x20, 0x02, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x94, 0x38,
+  0x02, 0x00, 0x20, 0x01, 0x41, 0x0c, 0x6a, 0x20, 0x03, 0x43, 0x00, 0x00,
+  0x00, 0x3f, 0x94, 0x38, 0x02, 0x00, 0x20, 0x01, 0x41, 0x10, 0x6a, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x02, 0x6a, 0x22, 0x00, 0x41, 0x80, 0x08, 0x47,
+  0x0d, 0x00, 0x0b, 0x0b, 0xdf, 0x03, 0x06, 0x04, 0x7f, 0x01, 0x7d, 0x02,
+  0x7f, 0x01, 0x7d, 0x08, 0x7f, 0x05, 0x7d, 0x02, 0x40, 0x20, 0x00, 0x41,
+  0x01, 0x48, 0x0d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x41, 0x00,
+  0x21, 0x02, 0x41, 0x00, 0x21, 0x03, 0x03, 0x40, 0x02, 0x40, 0x20, 0x03,
+  0x20, 0x02, 0x4e, 0x0d, 0x00, 0x20, 0x03, 0x41, 0x03, 0x74, 0x22, 0x04,
+  0x2a, 0x02, 0x80, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x05, 0x20, 0x04, 0x20,
+  0x02, 0x41, 0x03, 0x74, 0x22, 0x06, 0x41, 0x80, 0xa8, 0x80, 0x80, 0x00,
+  0x6a, 0x22, 0x07, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x80, 0xa8, 0x80, 0x80,
+  0x00, 0x20, 0x04, 0x2a, 0x02, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x08,
+  0x20, 0x04, 0x20, 0x06, 0x41, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x6a, 0x22,
+  0x06, 0x2a, 0x02, 0x00, 0x38, 0x02, 0x84, 0xa8, 0x80, 0x80, 0x00, 0x20,
+  0x07, 0x20, 0x05, 0x38, 0x02, 0x00, 0x20, 0x06, 0x20, 0x08, 0x38, 0x02,
+  0x00, 0x0b, 0x41, 0x80, 0x04, 0x21, 0x06, 0x02, 0x40, 0x20, 0x02, 0x41,
+  0x80, 0x04, 0x71, 0x45, 0x0d, 0x00, 0x41, 0x80, 0x04, 0x21, 0x04, 0x03,
+  0x40, 0x20, 0x02, 0x20, 0x04, 0x73, 0x21, 0x02, 0x20, 0x04, 0x41, 0x01,
+  0x76, 0x22, 0x06, 0x21, 0x04, 0x20, 0x02, 0x20, 0x06, 0x71, 0x0d, 0x00,
+  0x0b, 0x0b, 0x20, 0x06, 0x20, 0x02, 0x72, 0x21, 0x02, 0x20, 0x03, 0x41,
+  0x01, 0x6a, 0x22, 0x03, 0x41, 0x80, 0x08, 0x47, 0x0d, 0x00, 0x0b, 0x41,
+  0x02, 0x21, 0x09, 0x03, 0x40, 0x02, 0x40, 0x20, 0x09, 0x41, 0x01, 0x75,
+  0x22, 0x0a, 0x41, 0x01, 0x48, 0x0d, 0x00, 0x20, 0x09, 0x41, 0x03, 0x74,
+  0x21, 0x0b, 0x20, 0x0a, 0x41, 0x03, 0x74, 0x21, 0x0c, 0x41, 0x80, 0x08,
+  0x20, 0x09, 0x68, 0x76, 0x41, 0x02, 0x74, 0x21, 0x0d, 0x41, 0x00, 0x21,
+  0x0e, 0x41, 0x80, 0xa8, 0x80, 0x80, 0x00, 0x21, 0x0f, 0x03, 0x40, 0x20,
+  0x0f, 0x21, 0x02, 0x41, 0x00, 0x21, 0x04, 0x20, 0x0a, 0x21, 0x03, 0x03,
+  0x40, 0x20, 0x02, 0x41, 0x04, 0x6a, 0x22, 0x07, 0x20, 0x04, 0x41, 0x80,
+  0x88, 0x80, 0x80, 0x00, 0x6a, 0x2a, 0x02, 0x00, 0x22, 0x05, 0x20, 0x02,
+  0x20, 0x0c, 0x6a, 0x22, 0x06, 0x41, 0x04, 0x6a, 0x22, 0x10, 0x2a, 0x02,
+  0x00, 0x22, 0x08, 0x94, 0x20, 0x04, 0x41, 0x80, 0x98, 0x80, 0x80, 0x00,
+  0x6a, 0x2a, 0x02, 0x00, 0x22, 0x11, 0x20, 0x06, 0x2a, 0x02, 0x00, 0x22,
+  0x12, 0x94, 0x92, 0x22, 0x13, 0x20, 0x07, 0x2a, 0x02, 0x00, 0x22, 0x14,
+  0x92, 0x38, 0x02, 0x00, 0x20, 0x02, 0x20, 0x02, 0x2a, 0x02, 0x00, 0x22,
+  0x15, 0x20, 0x05, 0x20, 0x12, 0x94, 0x20, 0x11, 0x20, 0x08, 0x94, 0x93,
+  0x22, 0x05, 0x92, 0x38, 0x02, 0x00, 0x20, 0x10, 0x20, 0x14, 0x20, 0x13,
+  0x93, 0x38, 0x02, 0x00, 0x20, 0x06, 0x20, 0x15, 0x20, 0x05, 0x93, 0x38,
+  0x02, 0x00, 0x20, 0x02, 0x41, 0x08, 0x6a, 0x21, 0x02, 0x20, 0x04, 0x20,
+  0x0d, 0x6a, 0x21, 0x04, 0x20, 0x03, 0x41, 0x7f, 0x6a, 0x22, 0x03, 0x0d,
+  0x00, 0x0b, 0x20, 0x0f, 0x20, 0x0b, 0x6a, 0x21, 0x0f, 0x20, 0x0e, 0x20,
+  0x09, 0x6a, 0x22, 0x0e, 0x41, 0x80, 0x08, 0x49, 0x0d, 0x00, 0x0b, 0x0b,
+  0x20, 0x09, 0x41, 0x01, 0x74, 0x22, 0x09, 0x41, 0x81, 0x08, 0x48, 0x0d,
+  0x00, 0x0b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01, 0x20, 0x00, 0x47,
+  0x0d, 0x00, 0x0b, 0x0b, 0x0b, 0x0b, 0x88, 0x20, 0x01, 0x00, 0x41, 0x80,
+  0x08, 0x0b, 0x80, 0x20, 0x00, 0x00, 0x80, 0x3f, 0xc4, 0xfe, 0x7f, 0x3f,
+  0x11, 0xfb, 0x7f, 0x3f, 0xe6, 0xf4, 0x7f, 0x3f, 0x43, 0xec, 0x7f, 0x3f,
+  0x29, 0xe1, 0x7f, 0x3f, 0x98, 0xd3, 0x7f, 0x3f, 0x8f, 0xc3, 0x7f, 0x3f,
+  0x0f, 0xb1, 0x7f, 0x3f, 0x18, 0x9c, 0x7f, 0x3f, 0xab, 0x84, 0x7f, 0x3f,
+  0xc7, 0x6a, 0x7f, 0x3f, 0x6d, 0x4e, 0x7f, 0x3f, 0x9d, 0x2f, 0x7f, 0x3f,
+  0x58, 0x0e, 0x7f, 0x3f, 0x9d, 0xea, 0x7e, 0x3f, 0x6d, 0xc4, 0x7e, 0x3f,
+  0xc9, 0x9b, 0x7e, 0x3f, 0xb0, 0x70, 0x7e, 0x3f, 0x23, 0x43, 0x7e, 0x3f,
+  0x24, 0x13, 0x7e, 0x3f, 0xb1, 0xe0, 0x7d, 0x3f, 0xcc, 0xab, 0x7d, 0x3f,
+  0x74, 0x74, 0x7d, 0x3f, 0xac, 0x3a, 0x7d, 0x3f, 0x73, 0xfe, 0x7c, 0x3f,
+  0xc9, 0xbf, 0x7c, 0x3f, 0xb0, 0x7e, 0x7c, 0x3f, 0x28, 0x3b, 0x7c, 0x3f,
+  0x31, 0xf5, 0x7b, 0x3f, 0xcd, 0xac, 0x7b, 0x3f, 0xfc, 0x61, 0x7b, 0x3f,
+  0xbe, 0x14, 0x7b, 0x3f, 0x16, 0xc5, 0x7a, 0x3f, 0x02, 0x73, 0x7a, 0x3f,
+  0x84, 0x1e, 0x7a, 0x3f, 0x9d, 0xc7, 0x79, 0x3f, 0x4e, 0x6e, 0x79, 0x3f,
+  0x98, 0x12, 0x79, 0x3f, 0x7b, 0xb4, 0x78, 0x3f, 0xf8, 0x53, 0x78, 0x3f,
+  0x10, 0xf1, 0x77, 0x3f, 0xc5, 0x8b, 0x77, 0x3f, 0x17, 0x24, 0x77, 0x3f,
+  0x07, 0xba, 0x76, 0x3f, 0x97, 0x4d, 0x76, 0x3f, 0xc6, 0xde, 0x75, 0x3f,
+  0x97, 0x6d, 0x75, 0x3f, 0x0b, 0xfa, 0x74, 0x3f, 0x22, 0x84, 0x74, 0x3f,
+  0xdd, 0x0b, 0x74, 0x3f, 0x3f, 0x91, 0x73, 0x3f, 0x47, 0x14, 0x73, 0x3f,
+  0xf8, 0x94, 0x72, 0x3f, 0x52, 0x13, 0x72, 0x3f, 0x57, 0x8f, 0x71, 0x3f,
+  0x08, 0x09, 0x71, 0x3f, 0x66, 0x80, 0x70, 0x3f, 0x73, 0xf5, 0x6f, 0x3f,
+  0x30, 0x68, 0x6f, 0x3f, 0x9e, 0xd8, 0x6e, 0x3f, 0xbe, 0x46, 0x6e, 0x3f,
+  0x93, 0xb2, 0x6d, 0x3f, 0x1d, 0x1c, 0x6d, 0x3f, 0x5e, 0x83, 0x6c, 0x3f,
+  0x58, 0xe8, 0x6b, 0x3f, 0x0c, 0x4b, 0x6b, 0x3f, 0x7b, 0xab, 0x6a, 0x3f,
+  0xa7, 0x09, 0x6a, 0x3f, 0x91, 0x65, 0x69, 0x3f, 0x3c, 0xbf, 0x68, 0x3f,
+  0xa8, 0x16, 0x68, 0x3f, 0xd8, 0x6b, 0x67, 0x3f, 0xcc, 0xbe, 0x66, 0x3f,
+  0x88, 0x0f, 0x66, 0x3f, 0x0b, 0x5e, 0x65, 0x3f, 0x59, 0xaa, 0x64, 0x3f,
+  0x73, 0xf4, 0x63, 0x3f, 0x5a, 0x3c, 0x63, 0x3f, 0x10, 0x82, 0x62, 0x3f,
+  0x98, 0xc5, 0x61, 0x3f, 0xf2, 0x06, 0x61, 0x3f, 0x21, 0x46, 0x60, 0x3f,
+  0x27, 0x83, 0x5f, 0x3f, 0x05, 0xbe, 0x5e, 0x3f, 0xbe, 0xf6, 0x5d, 0x3f,
+  0x53, 0x2d, 0x5d, 0x3f, 0xc7, 0x61, 0x5c, 0x3f, 0x1a, 0x94, 0x5b, 0x3f,
+  0x50, 0xc4, 0x5a, 0x3f, 0x6a, 0xf2, 0x59, 0x3f, 0x6a, 0x1e, 0x59, 0x3f,
+  0x53, 0x48, 0x58, 0x3f, 0x26, 0x70, 0x57, 0x3f, 0xe5, 0x95, 0x56, 0x3f,
+  0x93, 0xb9, 0x55, 0x3f, 0x31, 0xdb, 0x54, 0x3f, 0xc3, 0xfa, 0x53, 0x3f,
+  0x49, 0x18, 0x53, 0x3f, 0xc6, 0x33, 0x52, 0x3f, 0x3d, 0x4d, 0x51, 0x3f,
+  0xaf, 0x64, 0x50, 0x3f, 0x1f, 0x7a, 0x4f, 0x3f, 0x90, 0x8d, 0x4e, 0x3f,
+  0x02, 0x9f, 0x4d, 0x3f, 0x79, 0xae, 0x4c, 0x3f, 0xf8, 0xbb, 0x4b, 0x3f,
+  0x7f, 0xc7, 0x4a, 0x3f, 0x12, 0xd1, 0x49, 0x3f, 0xb3, 0xd8, 0x48, 0x3f,
+  0x65, 0xde, 0x47, 0x3f, 0x2a, 0xe2, 0x46, 0x3f, 0x03, 0xe4, 0x45, 0x3f,
+  0xf5, 0xe3, 0x44, 0x3f, 0x00, 0xe2, 0x43, 0x3f, 0x29, 0xde, 0x42, 0x3f,
+  0x70, 0xd8, 0x41, 0x3f, 0xda, 0xd0, 0x40, 0x3f, 0x67, 0xc7, 0x3f, 0x3f,
+  0x1b, 0xbc, 0x3e, 0x3f, 0xf9, 0xae, 0x3d, 0x3f, 0x03, 0xa0, 0x3c, 0x3f,
+  0x3b, 0x8f, 0x3b, 0x3f, 0xa4, 0x7c, 0x3a, 0x3f, 0x42, 0x68, 0x39, 0x3f,
+  0x16, 0x52, 0x38, 0x3f, 0x23, 0x3a, 0x37, 0x3f, 0x6c, 0x20, 0x36, 0x3f,
+  0xf3, 0x04, 0x35, 0x3f, 0xbc, 0xe7, 0x33, 0x3f, 0xc9, 0xc8, 0x32, 0x3f,
+  0x1d, 0xa8, 0x31, 0x3f, 0xbb, 0x85, 0x30, 0x3f, 0xa5, 0x61, 0x2f, 0x3f,
+  0xde, 0x3b, 0x2e, 0x3f, 0x69, 0x14, 0x2d, 0x3f, 0x4a, 0xeb, 0x2b, 0x3f,
+  0x82, 0xc0, 0x2a, 0x3f, 0x15, 0x94, 0x29, 0x3f, 0x05, 0x66, 0x28, 0x3f,
+  0x56, 0x36, 0x27, 0x3f, 0x0a, 0x05, 0x26, 0x3f, 0x25, 0xd2, 0x24, 0x3f,
+  0xa9, 0x9d, 0x23, 0x3f, 0x99, 0x67, 0x22, 0x3f, 0xf9, 0x2f, 0x21, 0x3f,
+  0xcb, 0xf6, 0x1f, 0x3f, 0x12, 0xbc, 0x1e, 0x3f, 0xd1, 0x7f, 0x1d, 0x3f,
+  0x0c, 0x42, 0x1c, 0x3f, 0xc6, 0x02, 0x1b, 0x3f, 0x00, 0xc2, 0x19, 0x3f,
+  0xc0, 0x7f, 0x18, 0x3f, 0x07, 0x3c, 0x17, 0x3f, 0xd9, 0xf6, 0x15, 0x3f,
+  0x39, 0xb0, 0x14, 0x3f, 0x2a, 0x68, 0x13, 0x3f, 0xb0, 0x1e, 0x12, 0x3f,
+  0xcd, 0xd3, 0x10, 0x3f, 0x84, 0x87, 0x0f, 0x3f, 0xda, 0x39, 0x0e, 0x3f,
+  0xd0, 0xea, 0x0c, 0x3f, 0x6b, 0x9a, 0x0b, 0x3f, 0xad, 0x48, 0x0a, 0x3f,
+  0x9b, 0xf5, 0x08, 0x3f, 0x36, 0xa1, 0x07, 0x3f, 0x82, 0x4b, 0x06, 0x3f,
+  0x84, 0xf4, 0x04, 0x3f, 0x3d, 0x9c, 0x03, 0x3f, 0xb1, 0x42, 0x02, 0x3f,
+  0xe4, 0xe7, 0x00, 0x3f, 0xb2, 0x17, 0xff, 0x3e, 0x27, 0x5d, 0xfc, 0x3e,
+  0x2d, 0xa0, 0xf9, 0x3e, 0xcb, 0xe0, 0xf6, 0x3e, 0x07, 0x1f, 0xf4, 0x3e,
+  0xea, 0x5a, 0xf1, 0x3e, 0x79, 0x94, 0xee, 0x3e, 0xbb, 0xcb, 0xeb, 0x3e,
+  0xb7, 0x00, 0xe9, 0x3e, 0x75, 0x33, 0xe6, 0x3e, 0xfa, 0x63, 0xe3, 0x3e,
+  0x4f, 0x92, 0xe0, 0x3e, 0x79, 0xbe, 0xdd, 0x3e, 0x80, 0xe8, 0xda, 0x3e,
+  0x6b, 0x10, 0xd8, 0x3e, 0x41, 0x36, 0xd5, 0x3e, 0x09, 0x5a, 0xd2, 0x3e,
+  0xca, 0x7b, 0xcf, 0x3e, 0x8b, 0x9b, 0xcc, 0x3e, 0x53, 0xb9, 0xc9, 0x3e,
+  0x29, 0xd5, 0xc6, 0x3e, 0x15, 0xef, 0xc3, 0x3e, 0x1e, 0x07, 0xc1, 0x3e,
+  0x4a, 0x1d, 0xbe, 0x3e, 0xa0, 0x31, 0xbb, 0x3e, 0x2a, 0x44, 0xb8, 0x3e,
+  0xec, 0x54, 0xb5, 0x3e, 0xef, 0x63, 0xb2, 0x3e, 0x3a, 0x71, 0xaf, 0x3e,
+  0xd4, 0x7c, 0xac, 0x3e, 0xc4, 0x86, 0xa9, 0x3e, 0x12, 0x8f, 0xa6, 0x3e,
+  0xc5, 0x95, 0xa3, 0x3e, 0xe5, 0x9a, 0xa0, 0x3e, 0x78, 0x9e, 0x9d, 0x3e,
+  0x86, 0xa0, 0x9a, 0x3e, 0x17, 0xa1, 0x97, 0x3e, 0x31, 0xa0, 0x94, 0x3e,
+  0xdd, 0x9d, 0x91, 0x3e, 0x22, 0x9a, 0x8e, 0x3e, 0x07, 0x95, 0x8b, 0x3e,
+  0x93, 0x8e, 0x88, 0x3e, 0xce, 0x86, 0x85, 0x3e, 0xc0, 0x7d, 0x82, 0x3e,
+  0xe1, 0xe6, 0x7e, 0x3e, 0xcc, 0xcf, 0x78, 0x3e, 0x51, 0xb6, 0x72, 0x3e,
+  0x7f, 0x9a, 0x6c, 0x3e, 0x66, 0x7c, 0x66, 0x3e, 0x13, 0x5c, 0x60, 0x3e,
+  0x97, 0x39, 0x5a, 0x3e, 0x01, 0x15, 0x54, 0x3e, 0x60, 0xee, 0x4d, 0x3e,
+  0xc2, 0xc5, 0x47, 0x3e, 0x37, 0x9b, 0x41, 0x3e, 0xcf, 0x6e, 0x3b, 0x3e,
+  0x98, 0x40, 0x35, 0x3e, 0xa2, 0x10, 0x2f, 0x3e, 0xfc, 0xde, 0x28, 0x3e,
+  0xb6, 0xab, 0x22, 0x3e, 0xde, 0x76, 0x1c, 0x3e, 0x83, 0x40, 0x16, 0x3e,
+  0xb7, 0x08, 0x10, 0x3e, 0x86, 0xcf, 0x09, 0x3e, 0x02, 0x95, 0x03, 0x3e,
+  0x73, 0xb2, 0xfa, 0x3d, 0x76, 0x38, 0xee, 0x3d, 0x2e, 0xbc, 0xe1, 0x3d,
+  0xb9, 0x3d, 0xd5, 0x3d, 0x36, 0xbd, 0xc8, 0x3d, 0xc3, 0x3a, 0xbc, 0x3d,
+  0x80, 0xb6, 0xaf, 0x3d, 0x8c, 0x30, 0xa3, 0x3d, 0x05, 0xa9, 0x96, 0x3d,
+  0x0a, 0x20, 0x8a, 0x3d, 0x74, 0x2b, 0x7b, 0x3d, 0x68, 0x14, 0x62, 0x3d,
+  0x2f, 0xfb, 0x48, 0x3d, 0x07, 0xe0, 0x2f, 0x3d, 0x2c, 0xc3, 0x16, 0x3d,
+  0xb9, 0x49, 0xfb, 0x3c, 0xb0, 0x0a, 0xc9, 0x3c, 0xb6, 0xc9, 0x96, 0x3c,
+  0x90, 0x0e, 0x49, 0x3c, 0x89, 0x0f, 0xc9, 0x3b, 0x00, 0x00, 0x00, 0x00,
+  0x89, 0x0f, 0xc9, 0xbb, 0x90, 0x0e, 0x49, 0xbc, 0xb6, 0xc9, 0x96, 0xbc,
+  0xb0, 0x0a, 0xc9, 0xbc, 0xb9, 0x49, 0xfb, 0xbc, 0x2c, 0xc3, 0x16, 0xbd,
+  0x07, 0xe0, 0x2f, 0xbd, 0x2f, 0xfb, 0x48, 0xbd, 0x68, 0x14, 0x62, 0xbd,
+  0x74, 0x2b, 0x7b, 0xbd, 0x0a, 0x20, 0x8a, 0xbd, 0x05, 0xa9, 0x96, 0xbd,
+  0x8c, 0x30, 0xa3, 0xbd, 0x80, 0xb6, 0xaf, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd,
+  0x36, 0xbd, 0xc8, 0xbd, 0xb9, 0x3d, 0xd5, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd,
+  0x76, 0x38, 0xee, 0xbd, 0x73, 0xb2, 0xfa, 0xbd, 0x02, 0x95, 0x03, 0xbe,
+  0x86, 0xcf, 0x09, 0xbe, 0xb7, 0x08, 0x10, 0xbe, 0x83, 0x40, 0x16, 0xbe,
+  0xde, 0x76, 0x1c, 0xbe, 0xb6, 0xab, 0x22, 0xbe, 0xfc, 0xde, 0x28, 0xbe,
+  0xa2, 0x10, 0x2f, 0xbe, 0x98, 0x40, 0x35, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe,
+  0x37, 0x9b, 0x41, 0xbe, 0xc2, 0xc5, 0x47, 0xbe, 0x60, 0xee, 0x4d, 0xbe,
+  0x01, 0x15, 0x54, 0xbe, 0x97, 0x39, 0x5a, 0xbe, 0x13, 0x5c, 0x60, 0xbe,
+  0x66, 0x7c, 0x66, 0xbe, 0x7f, 0x9a, 0x6c, 0xbe, 0x51, 0xb6, 0x72, 0xbe,
+  0xcc, 0xcf, 0x78, 0xbe, 0xe1, 0xe6, 0x7e, 0xbe, 0xc0, 0x7d, 0x82, 0xbe,
+  0xce, 0x86, 0x85, 0xbe, 0x93, 0x8e, 0x88, 0xbe, 0x07, 0x95, 0x8b, 0xbe,
+  0x22, 0x9a, 0x8e, 0xbe, 0xdd, 0x9d, 0x91, 0xbe, 0x31, 0xa0, 0x94, 0xbe,
+  0x17, 0xa1, 0x97, 0xbe, 0x86, 0xa0, 0x9a, 0xbe, 0x78, 0x9e, 0x9d, 0xbe,
+  0xe5, 0x9a, 0xa0, 0xbe, 0xc5, 0x95, 0xa3, 0xbe, 0x12, 0x8f, 0xa6, 0xbe,
+  0xc4, 0x86, 0xa9, 0xbe, 0xd4, 0x7c, 0xac, 0xbe, 0x3a, 0x71, 0xaf, 0xbe,
+  0xef, 0x63, 0xb2, 0xbe, 0xec, 0x54, 0xb5, 0xbe, 0x2a, 0x44, 0xb8, 0xbe,
+  0xa0, 0x31, 0xbb, 0xbe, 0x4a, 0x1d, 0xbe, 0xbe, 0x1e, 0x07, 0xc1, 0xbe,
+  0x15, 0xef, 0xc3, 0xbe, 0x29, 0xd5, 0xc6, 0xbe, 0x53, 0xb9, 0xc9, 0xbe,
+  0x8b, 0x9b, 0xcc, 0xbe, 0xca, 0x7b, 0xcf, 0xbe, 0x09, 0x5a, 0xd2, 0xbe,
+  0x41, 0x36, 0xd5, 0xbe, 0x6b, 0x10, 0xd8, 0xbe, 0x80, 0xe8, 0xda, 0xbe,
+  0x79, 0xbe, 0xdd, 0xbe, 0x4f, 0x92, 0xe0, 0xbe, 0xfa, 0x63, 0xe3, 0xbe,
+  0x75, 0x33, 0xe6, 0xbe, 0xb7, 0x00, 0xe9, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe,
+  0x79, 0x94, 0xee, 0xbe, 0xea, 0x5a, 0xf1, 0xbe, 0x07, 0x1f, 0xf4, 0xbe,
+  0xcb, 0xe0, 0xf6, 0xbe, 0x2d, 0xa0, 0xf9, 0xbe, 0x27, 0x5d, 0xfc, 0xbe,
+  0xb2, 0x17, 0xff, 0xbe, 0xe4, 0xe7, 0x00, 0xbf, 0xb1, 0x42, 0x02, 0xbf,
+  0x3d, 0x9c, 0x03, 0xbf, 0x84, 0xf4, 0x04, 0xbf, 0x82, 0x4b, 0x06, 0xbf,
+  0x36, 0xa1, 0x07, 0xbf, 0x9b, 0xf5, 0x08, 0xbf, 0xad, 0x48, 0x0a, 0xbf,
+  0x6b, 0x9a, 0x0b, 0xbf, 0xd0, 0xea, 0x0c, 0xbf, 0xda, 0x39, 0x0e, 0xbf,
+  0x84, 0x87, 0x0f, 0xbf, 0xcd, 0xd3, 0x10, 0xbf, 0xb0, 0x1e, 0x12, 0xbf,
+  0x2a, 0x68, 0x13, 0xbf, 0x39, 0xb0, 0x14, 0xbf, 0xd9, 0xf6, 0x15, 0xbf,
+  0x07, 0x3c, 0x17, 0xbf, 0xc0, 0x7f, 0x18, 0xbf, 0x00, 0xc2, 0x19, 0xbf,
+  0xc6, 0x02, 0x1b, 0xbf, 0x0c, 0x42, 0x1c, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf,
+  0x12, 0xbc, 0x1e, 0xbf, 0xcb, 0xf6, 0x1f, 0xbf, 0xf9, 0x2f, 0x21, 0xbf,
+  0x99, 0x67, 0x22, 0xbf, 0xa9, 0x9d, 0x23, 0xbf, 0x25, 0xd2, 0x24, 0xbf,
+  0x0a, 0x05, 0x26, 0xbf, 0x56, 0x36, 0x27, 0xbf, 0x05, 0x66, 0x28, 0xbf,
+  0x15, 0x94, 0x29, 0xbf, 0x82, 0xc0, 0x2a, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf,
+  0x69, 0x14, 0x2d, 0xbf, 0xde, 0x3b, 0x2e, 0xbf, 0xa5, 0x61, 0x2f, 0xbf,
+  0xbb, 0x85, 0x30, 0xbf, 0x1d, 0xa8, 0x31, 0xbf, 0xc9, 0xc8, 0x32, 0xbf,
+  0xbc, 0xe7, 0x33, 0xbf, 0xf3, 0x04, 0x35, 0xbf, 0x6c, 0x20, 0x36, 0xbf,
+  0x23, 0x3a, 0x37, 0xbf, 0x16, 0x52, 0x38, 0xbf, 0x42, 0x68, 0x39, 0xbf,
+  0xa4, 0x7c, 0x3a, 0xbf, 0x3b, 0x8f, 0x3b, 0xbf, 0x03, 0xa0, 0x3c, 0xbf,
+  0xf9, 0xae, 0x3d, 0xbf, 0x1b, 0xbc, 0x3e, 0xbf, 0x67, 0xc7, 0x3f, 0xbf,
+  0xda, 0xd0, 0x40, 0xbf, 0x70, 0xd8, 0x41, 0xbf, 0x29, 0xde, 0x42, 0xbf,
+  0x00, 0xe2, 0x43, 0xbf, 0xf5, 0xe3, 0x44, 0xbf, 0x03, 0xe4, 0x45, 0xbf,
+  0x2a, 0xe2, 0x46, 0xbf, 0x65, 0xde, 0x47, 0xbf, 0xb3, 0xd8, 0x48, 0xbf,
+  0x12, 0xd1, 0x49, 0xbf, 0x7f, 0xc7, 0x4a, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf,
+  0x79, 0xae, 0x4c, 0xbf, 0x02, 0x9f, 0x4d, 0xbf, 0x90, 0x8d, 0x4e, 0xbf,
+  0x1f, 0x7a, 0x4f, 0xbf, 0xaf, 0x64, 0x50, 0xbf, 0x3d, 0x4d, 0x51, 0xbf,
+  0xc6, 0x33, 0x52, 0xbf, 0x49, 0x18, 0x53, 0xbf, 0xc3, 0xfa, 0x53, 0xbf,
+  0x31, 0xdb, 0x54, 0xbf, 0x93, 0xb9, 0x55, 0xbf, 0xe5, 0x95, 0x56, 0xbf,
+  0x26, 0x70, 0x57, 0xbf, 0x53, 0x48, 0x58, 0xbf, 0x6a, 0x1e, 0x59, 0xbf,
+  0x6a, 0xf2, 0x59, 0xbf, 0x50, 0xc4, 0x5a, 0xbf, 0x1a, 0x94, 0x5b, 0xbf,
+  0xc7, 0x61, 0x5c, 0xbf, 0x53, 0x2d, 0x5d, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf,
+  0x05, 0xbe, 0x5e, 0xbf, 0x27, 0x83, 0x5f, 0xbf, 0x21, 0x46, 0x60, 0xbf,
+  0xf2, 0x06, 0x61, 0xbf, 0x98, 0xc5, 0x61, 0xbf, 0x10, 0x82, 0x62, 0xbf,
+  0x5a, 0x3c, 0x63, 0xbf, 0x73, 0xf4, 0x63, 0xbf, 0x59, 0xaa, 0x64, 0xbf,
+  0x0b, 0x5e, 0x65, 0xbf, 0x88, 0x0f, 0x66, 0xbf, 0xcc, 0xbe, 0x66, 0xbf,
+  0xd8, 0x6b, 0x67, 0xbf, 0xa8, 0x16, 0x68, 0xbf, 0x3c, 0xbf, 0x68, 0xbf,
+  0x91, 0x65, 0x69, 0xbf, 0xa7, 0x09, 0x6a, 0xbf, 0x7b, 0xab, 0x6a, 0xbf,
+  0x0c, 0x4b, 0x6b, 0xbf, 0x58, 0xe8, 0x6b, 0xbf, 0x5e, 0x83, 0x6c, 0xbf,
+  0x1d, 0x1c, 0x6d, 0xbf, 0x93, 0xb2, 0x6d, 0xbf, 0xbe, 0x46, 0x6e, 0xbf,
+  0x9e, 0xd8, 0x6e, 0xbf, 0x30, 0x68, 0x6f, 0xbf, 0x73, 0xf5, 0x6f, 0xbf,
+  0x66, 0x80, 0x70, 0xbf, 0x08, 0x09, 0x71, 0xbf, 0x57, 0x8f, 0x71, 0xbf,
+  0x52, 0x13, 0x72, 0xbf, 0xf8, 0x94, 0x72, 0xbf, 0x47, 0x14, 0x73, 0xbf,
+  0x3f, 0x91, 0x73, 0xbf, 0xdd, 0x0b, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf,
+  0x0b, 0xfa, 0x74, 0xbf, 0x97, 0x6d, 0x75, 0xbf, 0xc6, 0xde, 0x75, 0xbf,
+  0x97, 0x4d, 0x76, 0xbf, 0x07, 0xba, 0x76, 0xbf, 0x17, 0x24, 0x77, 0xbf,
+  0xc5, 0x8b, 0x77, 0xbf, 0x10, 0xf1, 0x77, 0xbf, 0xf8, 0x53, 0x78, 0xbf,
+  0x7b, 0xb4, 0x78, 0xbf, 0x98, 0x12, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf,
+  0x9d, 0xc7, 0x79, 0xbf, 0x84, 0x1e, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf,
+  0x16, 0xc5, 0x7a, 0xbf, 0xbe, 0x14, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf,
+  0xcd, 0xac, 0x7b, 0xbf, 0x31, 0xf5, 0x7b, 0xbf, 0x28, 0x3b, 0x7c, 0xbf,
+  0xb0, 0x7e, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c, 0xbf, 0x73, 0xfe, 0x7c, 0xbf,
+  0xac, 0x3a, 0x7d, 0xbf, 0x74, 0x74, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf,
+  0xb1, 0xe0, 0x7d, 0xbf, 0x24, 0x13, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf,
+  0xb0, 0x70, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf,
+  0x9d, 0xea, 0x7e, 0xbf, 0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf,
+  0x6d, 0x4e, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf,
+  0x18, 0x9c, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf,
+  0x98, 0xd3, 0x7f, 0xbf, 0x29, 0xe1, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf,
+  0xe6, 0xf4, 0x7f, 0xbf, 0x11, 0xfb, 0x7f, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x89, 0x0f, 0xc9, 0xbb, 0x90, 0x0e, 0x49, 0xbc,
+  0xb6, 0xc9, 0x96, 0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb9, 0x49, 0xfb, 0xbc,
+  0x2c, 0xc3, 0x16, 0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2f, 0xfb, 0x48, 0xbd,
+  0x68, 0x14, 0x62, 0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x0a, 0x20, 0x8a, 0xbd,
+  0x05, 0xa9, 0x96, 0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x80, 0xb6, 0xaf, 0xbd,
+  0xc3, 0x3a, 0xbc, 0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xb9, 0x3d, 0xd5, 0xbd,
+  0x2e, 0xbc, 0xe1, 0xbd, 0x76, 0x38, 0xee, 0xbd, 0x73, 0xb2, 0xfa, 0xbd,
+  0x02, 0x95, 0x03, 0xbe, 0x86, 0xcf, 0x09, 0xbe, 0xb7, 0x08, 0x10, 0xbe,
+  0x83, 0x40, 0x16, 0xbe, 0xde, 0x76, 0x1c, 0xbe, 0xb6, 0xab, 0x22, 0xbe,
+  0xfc, 0xde, 0x28, 0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0x98, 0x40, 0x35, 0xbe,
+  0xcf, 0x6e, 0x3b, 0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xc2, 0xc5, 0x47, 0xbe,
+  0x60, 0xee, 0x4d, 0xbe, 0x01, 0x15, 0x54, 0xbe, 0x97, 0x39, 0x5a, 0xbe,
+  0x13, 0x5c, 0x60, 0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x7f, 0x9a, 0x6c, 0xbe,
+  0x51, 0xb6, 0x72, 0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0xe1, 0xe6, 0x7e, 0xbe,
+  0xc0, 0x7d, 0x82, 0xbe, 0xce, 0x86, 0x85, 0xbe, 0x93, 0x8e, 0x88, 0xbe,
+  0x07, 0x95, 0x8b, 0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0xdd, 0x9d, 0x91, 0xbe,
+  0x31, 0xa0, 0x94, 0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x86, 0xa0, 0x9a, 0xbe,
+  0x78, 0x9e, 0x9d, 0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0xc5, 0x95, 0xa3, 0xbe,
+  0x12, 0x8f, 0xa6, 0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0xd4, 0x7c, 0xac, 0xbe,
+  0x3a, 0x71, 0xaf, 0xbe, 0xef, 0x63, 0xb2, 0xbe, 0xec, 0x54, 0xb5, 0xbe,
+  0x2a, 0x44, 0xb8, 0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x4a, 0x1d, 0xbe, 0xbe,
+  0x1e, 0x07, 0xc1, 0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x29, 0xd5, 0xc6, 0xbe,
+  0x53, 0xb9, 0xc9, 0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0xca, 0x7b, 0xcf, 0xbe,
+  0x09, 0x5a, 0xd2, 0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x6b, 0x10, 0xd8, 0xbe,
+  0x80, 0xe8, 0xda, 0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x4f, 0x92, 0xe0, 0xbe,
+  0xfa, 0x63, 0xe3, 0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xb7, 0x00, 0xe9, 0xbe,
+  0xbb, 0xcb, 0xeb, 0xbe, 0x79, 0x94, 0xee, 0xbe, 0xea, 0x5a, 0xf1, 0xbe,
+  0x07, 0x1f, 0xf4, 0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x2d, 0xa0, 0xf9, 0xbe,
+  0x27, 0x5d, 0xfc, 0xbe, 0xb2, 0x17, 0xff, 0xbe, 0xe4, 0xe7, 0x00, 0xbf,
+  0xb1, 0x42, 0x02, 0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0x84, 0xf4, 0x04, 0xbf,
+  0x82, 0x4b, 0x06, 0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x9b, 0xf5, 0x08, 0xbf,
+  0xad, 0x48, 0x0a, 0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xd0, 0xea, 0x0c, 0xbf,
+  0xda, 0x39, 0x0e, 0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xcd, 0xd3, 0x10, 0xbf,
+  0xb0, 0x1e, 0x12, 0xbf, 0x2a, 0x68, 0x13, 0xbf, 0x39, 0xb0, 0x14, 0xbf,
+  0xd9, 0xf6, 0x15, 0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xc0, 0x7f, 0x18, 0xbf,
+  0x00, 0xc2, 0x19, 0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x0c, 0x42, 0x1c, 0xbf,
+  0xd1, 0x7f, 0x1d, 0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xcb, 0xf6, 0x1f, 0xbf,
+  0xf9, 0x2f, 0x21, 0xbf, 0x99, 0x67, 0x22, 0xbf, 0xa9, 0x9d, 0x23, 0xbf,
+  0x25, 0xd2, 0x24, 0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x56, 0x36, 0x27, 0xbf,
+  0x05, 0x66, 0x28, 0xbf, 0x15, 0x94, 0x29, 0xbf, 0x82, 0xc0, 0x2a, 0xbf,
+  0x4a, 0xeb, 0x2b, 0xbf, 0x69, 0x14, 0x2d, 0xbf, 0xde, 0x3b, 0x2e, 0xbf,
+  0xa5, 0x61, 0x2f, 0xbf, 0xbb, 0x85, 0x30, 0xbf, 0x1d, 0xa8, 0x31, 0xbf,
+  0xc9, 0xc8, 0x32, 0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xf3, 0x04, 0x35, 0xbf,
+  0x6c, 0x20, 0x36, 0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x16, 0x52, 0x38, 0xbf,
+  0x42, 0x68, 0x39, 0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x3b, 0x8f, 0x3b, 0xbf,
+  0x03, 0xa0, 0x3c, 0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x1b, 0xbc, 0x3e, 0xbf,
+  0x67, 0xc7, 0x3f, 0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x70, 0xd8, 0x41, 0xbf,
+  0x29, 0xde, 0x42, 0xbf, 0x00, 0xe2, 0x43, 0xbf, 0xf5, 0xe3, 0x44, 0xbf,
+  0x03, 0xe4, 0x45, 0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x65, 0xde, 0x47, 0xbf,
+  0xb3, 0xd8, 0x48, 0xbf, 0x12, 0xd1, 0x49, 0xbf, 0x7f, 0xc7, 0x4a, 0xbf,
+  0xf8, 0xbb, 0x4b, 0xbf, 0x79, 0xae, 0x4c, 0xbf, 0x02, 0x9f, 0x4d, 0xbf,
+  0x90, 0x8d, 0x4e, 0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0xaf, 0x64, 0x50, 0xbf,
+  0x3d, 0x4d, 0x51, 0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x49, 0x18, 0x53, 0xbf,
+  0xc3, 0xfa, 0x53, 0xbf, 0x31, 0xdb, 0x54, 0xbf, 0x93, 0xb9, 0x55, 0xbf,
+  0xe5, 0x95, 0x56, 0xbf, 0x26, 0x70, 0x57, 0xbf, 0x53, 0x48, 0x58, 0xbf,
+  0x6a, 0x1e, 0x59, 0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x50, 0xc4, 0x5a, 0xbf,
+  0x1a, 0x94, 0x5b, 0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x53, 0x2d, 0x5d, 0xbf,
+  0xbe, 0xf6, 0x5d, 0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0x27, 0x83, 0x5f, 0xbf,
+  0x21, 0x46, 0x60, 0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x98, 0xc5, 0x61, 0xbf,
+  0x10, 0x82, 0x62, 0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x73, 0xf4, 0x63, 0xbf,
+  0x59, 0xaa, 0x64, 0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x88, 0x0f, 0x66, 0xbf,
+  0xcc, 0xbe, 0x66, 0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xa8, 0x16, 0x68, 0xbf,
+  0x3c, 0xbf, 0x68, 0xbf, 0x91, 0x65, 0x69, 0xbf, 0xa7, 0x09, 0x6a, 0xbf,
+  0x7b, 0xab, 0x6a, 0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x58, 0xe8, 0x6b, 0xbf,
+  0x5e, 0x83, 0x6c, 0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x93, 0xb2, 0x6d, 0xbf,
+  0xbe, 0x46, 0x6e, 0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0x30, 0x68, 0x6f, 0xbf,
+  0x73, 0xf5, 0x6f, 0xbf, 0x66, 0x80, 0x70, 0xbf, 0x08, 0x09, 0x71, 0xbf,
+  0x57, 0x8f, 0x71, 0xbf, 0x52, 0x13, 0x72, 0xbf, 0xf8, 0x94, 0x72, 0xbf,
+  0x47, 0x14, 0x73, 0xbf, 0x3f, 0x91, 0x73, 0xbf, 0xdd, 0x0b, 0x74, 0xbf,
+  0x22, 0x84, 0x74, 0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x97, 0x6d, 0x75, 0xbf,
+  0xc6, 0xde, 0x75, 0xbf, 0x97, 0x4d, 0x76, 0xbf, 0x07, 0xba, 0x76, 0xbf,
+  0x17, 0x24, 0x77, 0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x10, 0xf1, 0x77, 0xbf,
+  0xf8, 0x53, 0x78, 0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0x98, 0x12, 0x79, 0xbf,
+  0x4e, 0x6e, 0x79, 0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x84, 0x1e, 0x7a, 0xbf,
+  0x02, 0x73, 0x7a, 0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0xbe, 0x14, 0x7b, 0xbf,
+  0xfc, 0x61, 0x7b, 0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0x31, 0xf5, 0x7b, 0xbf,
+  0x28, 0x3b, 0x7c, 0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0xc9, 0xbf, 0x7c, 0xbf,
+  0x73, 0xfe, 0x7c, 0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x74, 0x74, 0x7d, 0xbf,
+  0xcc, 0xab, 0x7d, 0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0x24, 0x13, 0x7e, 0xbf,
+  0x23, 0x43, 0x7e, 0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0xc9, 0x9b, 0x7e, 0xbf,
+  0x6d, 0xc4, 0x7e, 0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x58, 0x0e, 0x7f, 0xbf,
+  0x9d, 0x2f, 0x7f, 0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0xc7, 0x6a, 0x7f, 0xbf,
+  0xab, 0x84, 0x7f, 0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0x0f, 0xb1, 0x7f, 0xbf,
+  0x8f, 0xc3, 0x7f, 0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x29, 0xe1, 0x7f, 0xbf,
+  0x43, 0xec, 0x7f, 0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x11, 0xfb, 0x7f, 0xbf,
+  0xc4, 0xfe, 0x7f, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0xc4, 0xfe, 0x7f, 0xbf,
+  0x11, 0xfb, 0x7f, 0xbf, 0xe6, 0xf4, 0x7f, 0xbf, 0x43, 0xec, 0x7f, 0xbf,
+  0x29, 0xe1, 0x7f, 0xbf, 0x98, 0xd3, 0x7f, 0xbf, 0x8f, 0xc3, 0x7f, 0xbf,
+  0x0f, 0xb1, 0x7f, 0xbf, 0x18, 0x9c, 0x7f, 0xbf, 0xab, 0x84, 0x7f, 0xbf,
+  0xc7, 0x6a, 0x7f, 0xbf, 0x6d, 0x4e, 0x7f, 0xbf, 0x9d, 0x2f, 0x7f, 0xbf,
+  0x58, 0x0e, 0x7f, 0xbf, 0x9d, 0xea, 0x7e, 0xbf, 0x6d, 0xc4, 0x7e, 0xbf,
+  0xc9, 0x9b, 0x7e, 0xbf, 0xb0, 0x70, 0x7e, 0xbf, 0x23, 0x43, 0x7e, 0xbf,
+  0x24, 0x13, 0x7e, 0xbf, 0xb1, 0xe0, 0x7d, 0xbf, 0xcc, 0xab, 0x7d, 0xbf,
+  0x74, 0x74, 0x7d, 0xbf, 0xac, 0x3a, 0x7d, 0xbf, 0x73, 0xfe, 0x7c, 0xbf,
+  0xc9, 0xbf, 0x7c, 0xbf, 0xb0, 0x7e, 0x7c, 0xbf, 0x28, 0x3b, 0x7c, 0xbf,
+  0x31, 0xf5, 0x7b, 0xbf, 0xcd, 0xac, 0x7b, 0xbf, 0xfc, 0x61, 0x7b, 0xbf,
+  0xbe, 0x14, 0x7b, 0xbf, 0x16, 0xc5, 0x7a, 0xbf, 0x02, 0x73, 0x7a, 0xbf,
+  0x84, 0x1e, 0x7a, 0xbf, 0x9d, 0xc7, 0x79, 0xbf, 0x4e, 0x6e, 0x79, 0xbf,
+  0x98, 0x12, 0x79, 0xbf, 0x7b, 0xb4, 0x78, 0xbf, 0xf8, 0x53, 0x78, 0xbf,
+  0x10, 0xf1, 0x77, 0xbf, 0xc5, 0x8b, 0x77, 0xbf, 0x17, 0x24, 0x77, 0xbf,
+  0x07, 0xba, 0x76, 0xbf, 0x97, 0x4d, 0x76, 0xbf, 0xc6, 0xde, 0x75, 0xbf,
+  0x97, 0x6d, 0x75, 0xbf, 0x0b, 0xfa, 0x74, 0xbf, 0x22, 0x84, 0x74, 0xbf,
+  0xdd, 0x0b, 0x74, 0xbf, 0x3f, 0x91, 0x73, 0xbf, 0x47, 0x14, 0x73, 0xbf,
+  0xf8, 0x94, 0x72, 0xbf, 0x52, 0x13, 0x72, 0xbf, 0x57, 0x8f, 0x71, 0xbf,
+  0x08, 0x09, 0x71, 0xbf, 0x66, 0x80, 0x70, 0xbf, 0x73, 0xf5, 0x6f, 0xbf,
+  0x30, 0x68, 0x6f, 0xbf, 0x9e, 0xd8, 0x6e, 0xbf, 0xbe, 0x46, 0x6e, 0xbf,
+  0x93, 0xb2, 0x6d, 0xbf, 0x1d, 0x1c, 0x6d, 0xbf, 0x5e, 0x83, 0x6c, 0xbf,
+  0x58, 0xe8, 0x6b, 0xbf, 0x0c, 0x4b, 0x6b, 0xbf, 0x7b, 0xab, 0x6a, 0xbf,
+  0xa7, 0x09, 0x6a, 0xbf, 0x91, 0x65, 0x69, 0xbf, 0x3c, 0xbf, 0x68, 0xbf,
+  0xa8, 0x16, 0x68, 0xbf, 0xd8, 0x6b, 0x67, 0xbf, 0xcc, 0xbe, 0x66, 0xbf,
+  0x88, 0x0f, 0x66, 0xbf, 0x0b, 0x5e, 0x65, 0xbf, 0x59, 0xaa, 0x64, 0xbf,
+  0x73, 0xf4, 0x63, 0xbf, 0x5a, 0x3c, 0x63, 0xbf, 0x10, 0x82, 0x62, 0xbf,
+  0x98, 0xc5, 0x61, 0xbf, 0xf2, 0x06, 0x61, 0xbf, 0x21, 0x46, 0x60, 0xbf,
+  0x27, 0x83, 0x5f, 0xbf, 0x05, 0xbe, 0x5e, 0xbf, 0xbe, 0xf6, 0x5d, 0xbf,
+  0x53, 0x2d, 0x5d, 0xbf, 0xc7, 0x61, 0x5c, 0xbf, 0x1a, 0x94, 0x5b, 0xbf,
+  0x50, 0xc4, 0x5a, 0xbf, 0x6a, 0xf2, 0x59, 0xbf, 0x6a, 0x1e, 0x59, 0xbf,
+  0x53, 0x48, 0x58, 0xbf, 0x26, 0x70, 0x57, 0xbf, 0xe5, 0x95, 0x56, 0xbf,
+  0x93, 0xb9, 0x55, 0xbf, 0x31, 0xdb, 0x54, 0xbf, 0xc3, 0xfa, 0x53, 0xbf,
+  0x49, 0x18, 0x53, 0xbf, 0xc6, 0x33, 0x52, 0xbf, 0x3d, 0x4d, 0x51, 0xbf,
+  0xaf, 0x64, 0x50, 0xbf, 0x1f, 0x7a, 0x4f, 0xbf, 0x90, 0x8d, 0x4e, 0xbf,
+  0x02, 0x9f, 0x4d, 0xbf, 0x79, 0xae, 0x4c, 0xbf, 0xf8, 0xbb, 0x4b, 0xbf,
+  0x7f, 0xc7, 0x4a, 0xbf, 0x12, 0xd1, 0x49, 0xbf, 0xb3, 0xd8, 0x48, 0xbf,
+  0x65, 0xde, 0x47, 0xbf, 0x2a, 0xe2, 0x46, 0xbf, 0x03, 0xe4, 0x45, 0xbf,
+  0xf5, 0xe3, 0x44, 0xbf, 0x00, 0xe2, 0x43, 0xbf, 0x29, 0xde, 0x42, 0xbf,
+  0x70, 0xd8, 0x41, 0xbf, 0xda, 0xd0, 0x40, 0xbf, 0x67, 0xc7, 0x3f, 0xbf,
+  0x1b, 0xbc, 0x3e, 0xbf, 0xf9, 0xae, 0x3d, 0xbf, 0x03, 0xa0, 0x3c, 0xbf,
+  0x3b, 0x8f, 0x3b, 0xbf, 0xa4, 0x7c, 0x3a, 0xbf, 0x42, 0x68, 0x39, 0xbf,
+  0x16, 0x52, 0x38, 0xbf, 0x23, 0x3a, 0x37, 0xbf, 0x6c, 0x20, 0x36, 0xbf,
+  0xf3, 0x04, 0x35, 0xbf, 0xbc, 0xe7, 0x33, 0xbf, 0xc9, 0xc8, 0x32, 0xbf,
+  0x1d, 0xa8, 0x31, 0xbf, 0xbb, 0x85, 0x30, 0xbf, 0xa5, 0x61, 0x2f, 0xbf,
+  0xde, 0x3b, 0x2e, 0xbf, 0x69, 0x14, 0x2d, 0xbf, 0x4a, 0xeb, 0x2b, 0xbf,
+  0x82, 0xc0, 0x2a, 0xbf, 0x15, 0x94, 0x29, 0xbf, 0x05, 0x66, 0x28, 0xbf,
+  0x56, 0x36, 0x27, 0xbf, 0x0a, 0x05, 0x26, 0xbf, 0x25, 0xd2, 0x24, 0xbf,
+  0xa9, 0x9d, 0x23, 0xbf, 0x99, 0x67, 0x22, 0xbf, 0xf9, 0x2f, 0x21, 0xbf,
+  0xcb, 0xf6, 0x1f, 0xbf, 0x12, 0xbc, 0x1e, 0xbf, 0xd1, 0x7f, 0x1d, 0xbf,
+  0x0c, 0x42, 0x1c, 0xbf, 0xc6, 0x02, 0x1b, 0xbf, 0x00, 0xc2, 0x19, 0xbf,
+  0xc0, 0x7f, 0x18, 0xbf, 0x07, 0x3c, 0x17, 0xbf, 0xd9, 0xf6, 0x15, 0xbf,
+  0x39, 0xb0, 0x14, 0xbf, 0x2a, 0x68, 0x13, 0xbf, 0xb0, 0x1e, 0x12, 0xbf,
+  0xcd, 0xd3, 0x10, 0xbf, 0x84, 0x87, 0x0f, 0xbf, 0xda, 0x39, 0x0e, 0xbf,
+  0xd0, 0xea, 0x0c, 0xbf, 0x6b, 0x9a, 0x0b, 0xbf, 0xad, 0x48, 0x0a, 0xbf,
+  0x9b, 0xf5, 0x08, 0xbf, 0x36, 0xa1, 0x07, 0xbf, 0x82, 0x4b, 0x06, 0xbf,
+  0x84, 0xf4, 0x04, 0xbf, 0x3d, 0x9c, 0x03, 0xbf, 0xb1, 0x42, 0x02, 0xbf,
+  0xe4, 0xe7, 0x00, 0xbf, 0xb2, 0x17, 0xff, 0xbe, 0x27, 0x5d, 0xfc, 0xbe,
+  0x2d, 0xa0, 0xf9, 0xbe, 0xcb, 0xe0, 0xf6, 0xbe, 0x07, 0x1f, 0xf4, 0xbe,
+  0xea, 0x5a, 0xf1, 0xbe, 0x79, 0x94, 0xee, 0xbe, 0xbb, 0xcb, 0xeb, 0xbe,
+  0xb7, 0x00, 0xe9, 0xbe, 0x75, 0x33, 0xe6, 0xbe, 0xfa, 0x63, 0xe3, 0xbe,
+  0x4f, 0x92, 0xe0, 0xbe, 0x79, 0xbe, 0xdd, 0xbe, 0x80, 0xe8, 0xda, 0xbe,
+  0x6b, 0x10, 0xd8, 0xbe, 0x41, 0x36, 0xd5, 0xbe, 0x09, 0x5a, 0xd2, 0xbe,
+  0xca, 0x7b, 0xcf, 0xbe, 0x8b, 0x9b, 0xcc, 0xbe, 0x53, 0xb9, 0xc9, 0xbe,
+  0x29, 0xd5, 0xc6, 0xbe, 0x15, 0xef, 0xc3, 0xbe, 0x1e, 0x07, 0xc1, 0xbe,
+  0x4a, 0x1d, 0xbe, 0xbe, 0xa0, 0x31, 0xbb, 0xbe, 0x2a, 0x44, 0xb8, 0xbe,
+  0xec, 0x54, 0xb5, 0xbe, 0xef, 0x63, 0xb2, 0xbe, 0x3a, 0x71, 0xaf, 0xbe,
+  0xd4, 0x7c, 0xac, 0xbe, 0xc4, 0x86, 0xa9, 0xbe, 0x12, 0x8f, 0xa6, 0xbe,
+  0xc5, 0x95, 0xa3, 0xbe, 0xe5, 0x9a, 0xa0, 0xbe, 0x78, 0x9e, 0x9d, 0xbe,
+  0x86, 0xa0, 0x9a, 0xbe, 0x17, 0xa1, 0x97, 0xbe, 0x31, 0xa0, 0x94, 0xbe,
+  0xdd, 0x9d, 0x91, 0xbe, 0x22, 0x9a, 0x8e, 0xbe, 0x07, 0x95, 0x8b, 0xbe,
+  0x93, 0x8e, 0x88, 0xbe, 0xce, 0x86, 0x85, 0xbe, 0xc0, 0x7d, 0x82, 0xbe,
+  0xe1, 0xe6, 0x7e, 0xbe, 0xcc, 0xcf, 0x78, 0xbe, 0x51, 0xb6, 0x72, 0xbe,
+  0x7f, 0x9a, 0x6c, 0xbe, 0x66, 0x7c, 0x66, 0xbe, 0x13, 0x5c, 0x60, 0xbe,
+  0x97, 0x39, 0x5a, 0xbe, 0x01, 0x15, 0x54, 0xbe, 0x60, 0xee, 0x4d, 0xbe,
+  0xc2, 0xc5, 0x47, 0xbe, 0x37, 0x9b, 0x41, 0xbe, 0xcf, 0x6e, 0x3b, 0xbe,
+  0x98, 0x40, 0x35, 0xbe, 0xa2, 0x10, 0x2f, 0xbe, 0xfc, 0xde, 0x28, 0xbe,
+  0xb6, 0xab, 0x22, 0xbe, 0xde, 0x76, 0x1c, 0xbe, 0x83, 0x40, 0x16, 0xbe,
+  0xb7, 0x08, 0x10, 0xbe, 0x86, 0xcf, 0x09, 0xbe, 0x02, 0x95, 0x03, 0xbe,
+  0x73, 0xb2, 0xfa, 0xbd, 0x76, 0x38, 0xee, 0xbd, 0x2e, 0xbc, 0xe1, 0xbd,
+  0xb9, 0x3d, 0xd5, 0xbd, 0x36, 0xbd, 0xc8, 0xbd, 0xc3, 0x3a, 0xbc, 0xbd,
+  0x80, 0xb6, 0xaf, 0xbd, 0x8c, 0x30, 0xa3, 0xbd, 0x05, 0xa9, 0x96, 0xbd,
+  0x0a, 0x20, 0x8a, 0xbd, 0x74, 0x2b, 0x7b, 0xbd, 0x68, 0x14, 0x62, 0xbd,
+  0x2f, 0xfb, 0x48, 0xbd, 0x07, 0xe0, 0x2f, 0xbd, 0x2c, 0xc3, 0x16, 0xbd,
+  0xb9, 0x49, 0xfb, 0xbc, 0xb0, 0x0a, 0xc9, 0xbc, 0xb6, 0xc9, 0x96, 0xbc,
+  0x90, 0x0e, 0x49, 0xbc, 0x89, 0x0f, 0xc9, 0xbb, 0x00, 0x4e, 0x04, 0x6e,
+  0x61, 0x6d, 0x65, 0x00, 0x0f, 0x0e, 0x66, 0x66, 0x74, 0x5f, 0x62, 0x65,
+  0x6e, 0x63, 0x68, 0x2e, 0x77, 0x61, 0x73, 0x6d, 0x01, 0x16, 0x02, 0x00,
+  0x08, 0x66, 0x66, 0x74, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x01, 0x09, 0x66,
+  0x66, 0x74, 0x5f, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x07, 0x12, 0x01, 0x00,
+  0x0f, 0x5f, 0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x09, 0x0a, 0x01, 0x00, 0x07, 0x2e, 0x72, 0x6f,
+  0x64, 0x61, 0x74, 0x61, 0x00, 0x7f, 0x09, 0x70, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x65, 0x72, 0x73, 0x01, 0x0c, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+  0x73, 0x65, 0x64, 0x2d, 0x62, 0x79, 0x01, 0x05, 0x63, 0x6c, 0x61, 0x6e,
+  0x67, 0x5f, 0x32, 0x31, 0x2e, 0x31, 0x2e, 0x34, 0x2d, 0x77, 0x61, 0x73,
+  0x69, 0x2d, 0x73, 0x64, 0x6b, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73,
+  0x3a, 0x2f, 0x2f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f,
+  0x6d, 0x2f, 0x6c, 0x6c, 0x76, 0x6d, 0x2f, 0x6c, 0x6c, 0x76, 0x6d, 0x2d,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x32, 0x32, 0x32, 0x66,
+  0x63, 0x31, 0x31, 0x66, 0x32, 0x62, 0x38, 0x66, 0x32, 0x35, 0x66, 0x36,
+  0x61, 0x30, 0x66, 0x34, 0x39, 0x37, 0x36, 0x32, 0x37, 0x32, 0x65, 0x66,
+  0x31, 0x62, 0x62, 0x37, 0x62, 0x66, 0x34, 0x39, 0x35, 0x32, 0x31, 0x64,
+  0x29, 0x00, 0x94, 0x01, 0x0f, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f,
+  0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x73, 0x08, 0x2b, 0x0b, 0x62,
+  0x75, 0x6c, 0x6b, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2b, 0x0f,
+  0x62, 0x75, 0x6c, 0x6b, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2d,
+  0x6f, 0x70, 0x74, 0x2b, 0x16, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x69, 0x6e,
+  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c,
+  0x6f, 0x6e, 0x67, 0x2b, 0x0a, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2b, 0x0f, 0x6d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2b, 0x13, 0x6e, 0x6f,
+  0x6e, 0x74, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x70,
+  0x74, 0x6f, 0x69, 0x6e, 0x74, 0x2b, 0x0f, 0x72, 0x65, 0x66, 0x65, 0x72,
+  0x65, 0x6e, 0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2b, 0x08,
+  0x73, 0x69, 0x67, 0x6e, 0x2d, 0x65, 0x78, 0x74
+};
+static const unsigned int fft_bench_wasm_len = 5132;
+
+static const unsigned char synth_4k_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+  0x01, 0x7f, 0x01, 0x7f, 0x03, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07, 0x09, 0x01, 0x05, 0x65, 0x6e,
+  0x74, 0x72, 0x79, 0x00, 0x05, 0x0a, 0xc3, 0x21, 0x06, 0xcd, 0x06, 0x01,
+  0x01, 0x7f, 0x20, 0x00, 0x41, 0x9b, 0x9c, 0xa4, 0xd4, 0x04, 0x6c, 0x41,
+  0xb8, 0xd7, 0xa5, 0x94, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xe9, 0xd7, 0x9b, 0x06, 0x6c, 0x41,
+  0xf7, 0xe1, 0x81, 0xb1, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x83, 0xb4, 0xab, 0x03, 0x6c, 0x41,
+  0x82, 0xd5, 0x91, 0xbc, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xf3, 0x87, 0xdc, 0x05, 0x6c, 0x41,
+  0xc9, 0xdb, 0xd3, 0xba, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0x8f, 0xba, 0xbf, 0x04, 0x6c, 0x41,
+  0xfc, 0xc5, 0xd3, 0xfe, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0x8f, 0xc3, 0xf1, 0x00, 0x6c, 0x41,
+  0x8b, 0xe8, 0x96, 0xa2, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0x9a, 0xde, 0xbd, 0x01, 0x6c, 0x41,
+  0xa6, 0x8f, 0x8e, 0xaf, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x95, 0xab, 0xd2, 0x86, 0x01, 0x6c, 0x41,
+  0xbd, 0xf0, 0xbb, 0xa4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0x83, 0xb3, 0xba, 0xa3, 0x03, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41,
+  0x81, 0xee, 0xbd, 0x21, 0x6c, 0x41, 0xb9, 0xb6, 0xdf, 0xc3, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf,
+  0x95, 0xdd, 0x97, 0x01, 0x6c, 0x41, 0xac, 0x86, 0xd4, 0x9c, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b,
+  0xb7, 0xeb, 0xcd, 0x03, 0x6c, 0x41, 0xfb, 0xeb, 0xbe, 0xd1, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf1,
+  0xf0, 0xf2, 0x9d, 0x06, 0x6c, 0x41, 0xd6, 0xcc, 0xcc, 0xff, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5,
+  0x97, 0xca, 0x90, 0x05, 0x6c, 0x41, 0xad, 0xd5, 0xcd, 0xb0, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3,
+  0xd2, 0xe3, 0xdb, 0x00, 0x6c, 0x41, 0xb0, 0xc0, 0xba, 0xdc, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xaf,
+  0xd4, 0xe2, 0xe0, 0x00, 0x6c, 0x41, 0xcf, 0xd3, 0xba, 0xbf, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe5,
+  0x84, 0x91, 0xcf, 0x06, 0x6c, 0x41, 0xba, 0xf6, 0xa4, 0x8c, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc8, 0x8a, 0xe9, 0x8b, 0x01, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xe1, 0xbf, 0xee, 0xfe, 0x00, 0x6c,
+  0x41, 0x86, 0xa2, 0xff, 0xa1, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xdb, 0xc9, 0xbc, 0x03, 0x6c,
+  0x41, 0x9d, 0xb2, 0xc5, 0xac, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xaa, 0xbc, 0xd3, 0x02, 0x6c,
+  0x41, 0xe0, 0xea, 0x89, 0xbb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xf5, 0xe7, 0xe4, 0x02, 0x6c,
+  0x41, 0xbf, 0xc9, 0xce, 0xed, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x9d, 0x8e, 0x94, 0x04, 0x6c,
+  0x41, 0xea, 0xcd, 0x9b, 0xaa, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0xa0, 0xb6, 0xc7, 0x00, 0x6c,
+  0x41, 0xd1, 0x86, 0xed, 0x9f, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xd9, 0xad, 0xbd, 0x07, 0x6c,
+  0x41, 0xa4, 0xf8, 0x9c, 0xdd, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xd2, 0xa5, 0xe3, 0x03, 0x6c,
+  0x41, 0xd3, 0xba, 0x80, 0x10, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0x89, 0x97, 0xc8, 0xe0, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41,
+  0x8f, 0xaf, 0xa3, 0xc1, 0x07, 0x6c, 0x41, 0xaf, 0xf7, 0x94, 0x87, 0x06,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc5, 0xae, 0x9b, 0xd4, 0x05, 0x6c, 0x41, 0x9a, 0xbd, 0xfb, 0xaa, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa9, 0x8f, 0x88, 0xd9, 0x04, 0x6c, 0x41, 0xc1, 0xc5, 0x8a, 0xfe, 0x06,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa7, 0xe3, 0xeb, 0x05, 0x6c, 0x41, 0xd4, 0xec, 0x8f, 0x9b, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3,
+  0xcd, 0xca, 0x99, 0x07, 0x6c, 0x41, 0xc3, 0x82, 0xec, 0xe4, 0x00, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9,
+  0xd1, 0xdf, 0x84, 0x05, 0x6c, 0x41, 0xbe, 0x80, 0x81, 0x1a, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xed, 0xf7,
+  0xde, 0x98, 0x07, 0x6c, 0x41, 0xb5, 0xb7, 0x94, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0xab, 0xa5,
+  0xb8, 0x03, 0x6c, 0x41, 0xd8, 0xd5, 0xea, 0x85, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0x96, 0xb2, 0x88, 0xbf, 0x04, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x01, 0x0b, 0xd0, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41,
+  0x97, 0xa5, 0xb6, 0xdf, 0x07, 0x6c, 0x41, 0x84, 0xb9, 0xee, 0xf4, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa3, 0xe1, 0xfa, 0x8a, 0x05, 0x6c, 0x41, 0xb3, 0x82, 0xbb, 0xf3, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xe9, 0x84, 0xa0, 0xbe, 0x07, 0x6c, 0x41, 0xee, 0xe9, 0xec, 0xb8, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x9d, 0xf0, 0xdf, 0xb3, 0x06, 0x6c, 0x41, 0xa5, 0xb8, 0xd5, 0x82, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xab, 0xc7, 0xdc, 0xcd, 0x05, 0x6c, 0x41, 0x88, 0xf4, 0xe9, 0x08, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc7,
+  0xe7, 0xc3, 0xf1, 0x07, 0x6c, 0x41, 0x87, 0x9f, 0x89, 0xb2, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdd,
+  0xd5, 0xcf, 0xd2, 0x05, 0x6c, 0x41, 0xd2, 0x8c, 0xe2, 0xd9, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa1,
+  0x84, 0xf2, 0x95, 0x05, 0x6c, 0x41, 0xd9, 0xaf, 0xa5, 0xf5, 0x06, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xff, 0xd0, 0xee, 0xfb, 0x01, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xcd, 0xc0, 0xde, 0xb1, 0x02, 0x6c,
+  0x41, 0x95, 0xb1, 0xba, 0xfa, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x9b, 0xb1, 0xd9, 0x04, 0x6c,
+  0x41, 0xb8, 0xea, 0x91, 0x93, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xb4, 0x8f, 0xd8, 0x03, 0x6c,
+  0x41, 0xf7, 0xd0, 0xe0, 0xd3, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x8a, 0xa9, 0x86, 0x06, 0x6c,
+  0x41, 0x82, 0xd0, 0xac, 0xee, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xe6, 0x92, 0xbc, 0x07, 0x6c,
+  0x41, 0xc9, 0xd2, 0x8b, 0x90, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xde, 0xd6, 0xcc, 0x02, 0x6c,
+  0x41, 0xfc, 0xe8, 0xa6, 0xf8, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0xea, 0x86, 0x9f, 0x02, 0x6c,
+  0x41, 0x8b, 0xa7, 0xdf, 0xcf, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0xf1, 0xe5, 0x9d, 0x05, 0x6c,
+  0x41, 0xa6, 0x9a, 0xd7, 0xeb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0x94, 0xae, 0x88, 0xa5, 0x06, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xbd, 0xb7, 0x90, 0xcc, 0x02, 0x6c, 0x41, 0xb2, 0xab, 0x86, 0xf7,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x81, 0xa1, 0xce, 0x88, 0x01, 0x6c, 0x41, 0xb9, 0xed, 0xee, 0xf2,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xdf, 0xa4, 0xdd, 0xb3, 0x02, 0x6c, 0x41, 0xac, 0xe9, 0x84, 0x83,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x8b, 0xd2, 0x88, 0x92, 0x03, 0x6c, 0x41, 0xfb, 0xea, 0xa2, 0xb3,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf1, 0x87, 0xc2, 0xfe, 0x04, 0x6c, 0x41, 0xd6, 0x97, 0x87, 0x8b,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc5, 0xda, 0x8d, 0x98, 0x02, 0x6c, 0x41, 0xad, 0xdc, 0xe1, 0xd2,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf3, 0xb1, 0x89, 0xb7, 0x04, 0x6c, 0x41, 0xb0, 0xb3, 0xb0, 0xa3,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xaf, 0xff, 0x99, 0xe8, 0x06, 0x6c, 0x41, 0xcf, 0xa2, 0xfe, 0xa9,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xe5, 0xeb, 0xd8, 0xd2,
+  0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xbb, 0xd1, 0xfb, 0xf9,
+  0x00, 0x6c, 0x41, 0xeb, 0xe6, 0xb7, 0x94, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0x96, 0xe5, 0xa1,
+  0x04, 0x6c, 0x41, 0x86, 0xad, 0x8b, 0xfb, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xde, 0xfa, 0xa9,
+  0x04, 0x6c, 0x41, 0x9d, 0xf9, 0xf8, 0xe6, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xc9, 0xcd, 0x86,
+  0x05, 0x6c, 0x41, 0xe0, 0x9d, 0xc5, 0xea, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xe0, 0xa0, 0xeb,
+  0x04, 0x6c, 0x41, 0xbf, 0xd8, 0xb5, 0xd6, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0xc4, 0xe5, 0x18,
+  0x6c, 0x41, 0xea, 0xe8, 0x8b, 0x84, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0xb3, 0xb8, 0xfd, 0x07,
+  0x6c, 0x41, 0xd1, 0x9d, 0xeb, 0xb6, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xc8, 0x9a, 0xb2, 0x07,
+  0x6c, 0x41, 0xa4, 0xbb, 0x9b, 0xdd, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x01, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xc2, 0xcd, 0xa6, 0xb3, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x01, 0x0b, 0xcc, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0xd3, 0x99,
+  0xdd, 0xbe, 0x03, 0x6c, 0x41, 0x90, 0xe0, 0x98, 0xf2, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8f, 0xda,
+  0xbd, 0x8d, 0x04, 0x6c, 0x41, 0xaf, 0xc6, 0xff, 0x8d, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5, 0x95,
+  0xe2, 0xdf, 0x02, 0x6c, 0x41, 0x9a, 0x98, 0xe5, 0xe3, 0x04, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa9, 0xe2,
+  0xdf, 0x2e, 0x6c, 0x41, 0xc1, 0x9c, 0xf0, 0xaa, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0x92, 0xcc,
+  0xf2, 0x01, 0x6c, 0x41, 0xd4, 0xef, 0xbb, 0x8a, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3, 0x88, 0xf5,
+  0xd3, 0x00, 0x6c, 0x41, 0xc3, 0xa1, 0xf4, 0x22, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0x88, 0x8d, 0xdc,
+  0x07, 0x6c, 0x41, 0xbe, 0xeb, 0xdc, 0xa2, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xed, 0xda, 0xc5, 0x81,
+  0x05, 0x6c, 0x41, 0xb5, 0xde, 0xaa, 0x8f, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xbb, 0xaa, 0xb7, 0xa0, 0x01, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xd9, 0xe8, 0xf7, 0xbb, 0x02, 0x6c, 0x41, 0xb1, 0x93,
+  0x90, 0x29, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x97, 0x94, 0xea, 0x8b, 0x06, 0x6c, 0x41, 0x84, 0xfc, 0xa7,
+  0xe0, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa3, 0xdc, 0xae, 0xea, 0x07, 0x6c, 0x41, 0xb3, 0xe1, 0xce,
+  0xc4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xe9, 0xfb, 0x84, 0xc0, 0x05, 0x6c, 0x41, 0xee, 0x94, 0xea,
+  0xa4, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9d, 0x93, 0x84, 0x21, 0x6c, 0x41, 0xa5, 0x9f, 0x9b, 0xed,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xab, 0x86, 0xea, 0x34, 0x6c, 0x41, 0x88, 0xc7, 0x8c, 0x90, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc7, 0xf2, 0xd5, 0xb4, 0x05, 0x6c, 0x41, 0x87, 0xce, 0xf0, 0xd5, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xdd, 0x9c, 0xc1, 0xd7, 0x05, 0x6c, 0x41, 0xd2, 0xc7, 0xff, 0xc8, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa0, 0xb7, 0x83, 0xff, 0x02,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd9, 0xe6, 0xa1, 0x9b, 0x06,
+  0x6c, 0x41, 0x9e, 0xd6, 0xd1, 0xb3, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0xa3, 0xa0, 0xb8, 0x07,
+  0x6c, 0x41, 0x95, 0xd8, 0x8f, 0x9d, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x9a, 0x9a, 0xeb, 0x06,
+  0x6c, 0x41, 0xb8, 0xfd, 0xa9, 0x8c, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xff, 0xd2, 0xb2, 0x03,
+  0x6c, 0x41, 0xf7, 0xbf, 0xdb, 0x96, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x91, 0x9a, 0xc8, 0x00,
+  0x6c, 0x41, 0x82, 0xcb, 0x93, 0x88, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xd9, 0xc9, 0x89, 0x02,
+  0x6c, 0x41, 0xc9, 0xc9, 0xff, 0xc3, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xad, 0x8f, 0xc9, 0x04,
+  0x6c, 0x41, 0xfc, 0x8b, 0xe6, 0xdc, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0xc5, 0x96, 0x8f, 0x02,
+  0x6c, 0x41, 0x8b, 0xe6, 0x83, 0xa8, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x08, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0x81, 0xc8, 0xa9, 0xb3, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xa7, 0xa5, 0xac, 0xfc, 0x07, 0x6c, 0x41, 0xe7, 0xe9, 0xa6,
+  0x82, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xbd, 0xfe, 0xe0, 0x88, 0x01, 0x6c, 0x41, 0xb2, 0xe6, 0x96,
+  0x86, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x81, 0xd4, 0x8a, 0xe3, 0x06, 0x6c, 0x41, 0xb9, 0xa4, 0xba,
+  0x8e, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xdf, 0xb3, 0xf9, 0xfc, 0x03, 0x6c, 0x41, 0xac, 0xcc, 0xa1,
+  0xba, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x8b, 0xed, 0xf1, 0xee, 0x04, 0x6c, 0x41, 0xfb, 0xe9, 0xe2,
+  0xdd, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xf1, 0x9e, 0xcd, 0xe2, 0x07, 0x6c, 0x41, 0xd6, 0xe2, 0xcd,
+  0xa0, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xc5, 0x9d, 0xbd, 0x33, 0x6c, 0x41, 0xad, 0xe3, 0xf1, 0xb7,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf3, 0x90, 0x8b, 0xba, 0x06, 0x6c, 0x41, 0xb0, 0xa6, 0xd2, 0xe3,
+  0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xae, 0xaa, 0xdd, 0xa4,
+  0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06, 0x01, 0x01,
+  0x7f, 0x20, 0x00, 0x41, 0xcf, 0xf1, 0xdd, 0xff, 0x06, 0x6c, 0x41, 0xdc,
+  0xe4, 0x9e, 0x92, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xbb, 0xac, 0x9e, 0xd6, 0x00, 0x6c, 0x41, 0xeb,
+  0xa5, 0xf3, 0x8c, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xe1, 0xed, 0x97, 0x96, 0x03, 0x6c, 0x41, 0x86,
+  0xb8, 0xa3, 0x14, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xf5, 0xe1, 0x97, 0xd1, 0x07, 0x6c, 0x41, 0x9d, 0xc0,
+  0xa8, 0x92, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xe3, 0xe8, 0xba, 0x3f, 0x6c, 0x41, 0xe0, 0xd0, 0xac,
+  0x99, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xdf, 0xcb, 0xe5, 0x9c, 0x02, 0x6c, 0x41, 0xbf, 0xe7, 0xb8,
+  0xe8, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xd5, 0xeb, 0xb8, 0xb5, 0x03, 0x6c, 0x41, 0xea, 0x83, 0xc8,
+  0xa2, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xf9, 0xc6, 0xe6, 0xc5, 0x00, 0x6c, 0x41, 0xd1, 0xb4, 0xa5,
+  0xed, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xb7, 0xb7, 0xa3,
+  0xbf, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xa5, 0xfe, 0x85,
+  0xbd, 0x06, 0x6c, 0x41, 0x8d, 0x95, 0xe1, 0xf2, 0x04, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3, 0xf8, 0x95,
+  0xd1, 0x01, 0x6c, 0x41, 0x90, 0xd3, 0xa5, 0xc8, 0x04, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8f, 0x85, 0xe4,
+  0xfa, 0x05, 0x6c, 0x41, 0xaf, 0x95, 0x86, 0xfc, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5, 0xfc, 0xa4,
+  0xf1, 0x02, 0x6c, 0x41, 0x9a, 0xf3, 0x9a, 0xb7, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa9, 0xb5, 0xe3,
+  0xdc, 0x07, 0x6c, 0x41, 0xc1, 0xf3, 0x91, 0xc5, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xc1, 0xc8,
+  0xf5, 0x00, 0x6c, 0x41, 0xd4, 0xf2, 0xd3, 0xff, 0x02, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3, 0xc3, 0xeb,
+  0xe3, 0x04, 0x6c, 0x41, 0xc3, 0xc0, 0xd8, 0xa2, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0xbf, 0xf6,
+  0xd7, 0x04, 0x6c, 0x41, 0xbe, 0xd6, 0xc4, 0xc2, 0x02, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0xec, 0xbd, 0x98, 0xd3, 0x00, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x00, 0x41, 0xb5, 0x85, 0xbd, 0x8b, 0x06, 0x6c, 0x41, 0xca,
+  0xfa, 0xc2, 0xfd, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd9, 0xfb, 0xb0, 0x90, 0x05, 0x6c, 0x41, 0xb1,
+  0xaa, 0xf9, 0xb8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x97, 0x83, 0xba, 0xcc, 0x05, 0x6c, 0x41, 0x84,
+  0xbf, 0xcd, 0xf7, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xa3, 0xd7, 0xae, 0xb5, 0x06, 0x6c, 0x41, 0xb3,
+  0xc0, 0xbe, 0xb5, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xe9, 0xf2, 0xa5, 0xf4, 0x01, 0x6c, 0x41, 0xee,
+  0xbf, 0xf3, 0x9d, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x9d, 0xb6, 0x94, 0xdd, 0x07, 0x6c, 0x41, 0xa5,
+  0x86, 0xdd, 0x39, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xab, 0xc5, 0xd3, 0xfa, 0x00, 0x6c, 0x41, 0x88, 0x9a,
+  0xdb, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xc7, 0xfd, 0xf3, 0x0f, 0x6c, 0x41, 0x87, 0xfd, 0xf3,
+  0x8b, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xdd, 0xe3, 0xae,
+  0x85, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd3, 0x82, 0xe9,
+  0x39, 0x6c, 0x41, 0xa3, 0xf8, 0x83, 0xd9, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0x9d, 0xda, 0x81,
+  0x07, 0x6c, 0x41, 0x9e, 0xc1, 0xdc, 0xdc, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x86, 0xce, 0xf3,
+  0x04, 0x6c, 0x41, 0x95, 0xff, 0xe0, 0x8f, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x99, 0xdf, 0xf9,
+  0x00, 0x6c, 0x41, 0xb8, 0x90, 0xee, 0xaf, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xca, 0xa2, 0xdb,
+  0x04, 0x6c, 0x41, 0xf7, 0xae, 0xf2, 0xe9, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x98, 0x87, 0xe1,
+  0x01, 0x6c, 0x41, 0x82, 0xc6, 0xc6, 0xb9, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xcc, 0xac, 0xf4,
+  0x01, 0x6c, 0x41, 0xc9, 0xc0, 0xaf, 0xc6, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xfc, 0xe3, 0xa4,
+  0x02, 0x6c, 0x41, 0xfc, 0xae, 0x91, 0xdc, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xda, 0xa0, 0xf2, 0xf1, 0x01, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x01, 0x0b, 0xce, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0x8b,
+  0xa5, 0x84, 0x9b, 0x05, 0x6c, 0x41, 0xe8, 0xde, 0xf5, 0xb3, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7,
+  0xb0, 0x8d, 0x91, 0x07, 0x6c, 0x41, 0xe7, 0x98, 0xb1, 0x8a, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbd,
+  0xc5, 0xad, 0xca, 0x05, 0x6c, 0x41, 0xb2, 0xa1, 0xf3, 0xc2, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81,
+  0x87, 0xf3, 0xe0, 0x05, 0x6c, 0x41, 0xb9, 0xdb, 0xc1, 0x86, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf,
+  0xc2, 0xb1, 0xe3, 0x05, 0x6c, 0x41, 0xac, 0xaf, 0xaa, 0xf2, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b,
+  0x88, 0xa7, 0x94, 0x02, 0x6c, 0x41, 0xfb, 0xe8, 0xfe, 0xc0, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf1,
+  0xb5, 0x94, 0xba, 0x07, 0x6c, 0x41, 0xd6, 0xad, 0xa0, 0xf0, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5,
+  0xe0, 0xd8, 0x92, 0x06, 0x6c, 0x41, 0xad, 0xea, 0xfd, 0xcf, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf3, 0xef, 0xe8, 0xd4, 0x00, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xb1, 0x99, 0xa0, 0xcd, 0x07, 0x6c,
+  0x41, 0xa9, 0xee, 0xac, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0xc0, 0xd9, 0xb0, 0x04, 0x6c, 0x41,
+  0xdc, 0x87, 0xe5, 0xa7, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0x87, 0x8d, 0xd1, 0x02, 0x6c, 0x41,
+  0xeb, 0xe4, 0x8a, 0xdc, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xc4, 0x86, 0xcc, 0x06, 0x6c, 0x41,
+  0x86, 0xc3, 0xc7, 0x9d, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xe4, 0xa0, 0xe2, 0x03, 0x6c, 0x41,
+  0x9d, 0x87, 0xd4, 0x9e, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0x87, 0x84, 0xee, 0x06, 0x6c, 0x41,
+  0xe0, 0x83, 0xc0, 0xf7, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xb6, 0xb6, 0xa9, 0x06, 0x6c, 0x41,
+  0xbf, 0xf6, 0xd7, 0x13, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd5, 0x92, 0x88, 0xda, 0x00, 0x6c, 0x41, 0xea,
+  0x9e, 0xd0, 0xb5, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf8,
+  0xd9, 0xc0, 0xd0, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd1,
+  0xcb, 0x9b, 0xb3, 0x01, 0x6c, 0x41, 0xb6, 0xf0, 0xee, 0xa3, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5,
+  0xc1, 0xdc, 0xac, 0x04, 0x6c, 0x41, 0x8d, 0x9c, 0x8c, 0x81, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3,
+  0xd7, 0xaa, 0xb7, 0x04, 0x6c, 0x41, 0x90, 0xc6, 0xde, 0xd3, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8f,
+  0xb0, 0x96, 0x39, 0x6c, 0x41, 0xaf, 0xe4, 0xa8, 0xc1, 0x02, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5, 0xe3,
+  0xe3, 0xf8, 0x00, 0x6c, 0x41, 0x9a, 0xce, 0x9c, 0xd5, 0x00, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa9, 0x88,
+  0x93, 0x93, 0x03, 0x6c, 0x41, 0xc1, 0xca, 0xef, 0x3c, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xf0, 0xe0,
+  0xfe, 0x00, 0x6c, 0x41, 0xd4, 0xf5, 0xd7, 0xaa, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3, 0xfe, 0xad,
+  0xf9, 0x00, 0x6c, 0x41, 0xc3, 0xdf, 0x98, 0xd4, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0xf9, 0xf6, 0x9b, 0xe8, 0x00, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x00, 0x41, 0xbf, 0xc1, 0xb8, 0xa9, 0x06, 0x6c, 0x41, 0x9f,
+  0x8a, 0xc8, 0x9c, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xb5, 0xac, 0xcb, 0xeb, 0x00, 0x6c, 0x41, 0xca,
+  0x95, 0x9e, 0xc9, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd9, 0x8e, 0x96, 0xb3, 0x01, 0x6c, 0x41, 0xb1,
+  0xc1, 0x9e, 0xf4, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x97, 0xf2, 0xa5, 0x91, 0x02, 0x6c, 0x41, 0x84,
+  0x82, 0xdf, 0xea, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xa3, 0xd2, 0xfa, 0x9b, 0x06, 0x6c, 0x41, 0xb3,
+  0x9f, 0x8a, 0xb6, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xe9, 0xe9, 0x82, 0xcb, 0x01, 0x6c, 0x41, 0xee,
+  0xea, 0x88, 0xd4, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x9d, 0xd9, 0x90, 0x98, 0x07, 0x6c, 0x41, 0xa5,
+  0xed, 0x9a, 0xd8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xab, 0x84, 0x99, 0x8f, 0x05, 0x6c, 0x41, 0x88,
+  0xed, 0xd5, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc6,
+  0x88, 0x9e, 0xb3, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0x33,
+  0x01, 0x01, 0x7f, 0x20, 0x00, 0x10, 0x00, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x00, 0x10, 0x01, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x02, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x03, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x04, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x01, 0x0b, 0x0b, 0x88, 0x02, 0x01, 0x00, 0x41, 0x80, 0x08, 0x0b,
+  0x80, 0x02, 0x07, 0x34, 0x5d, 0xd2, 0xa3, 0xa0, 0x59, 0x1e, 0xff, 0xcc,
+  0x15, 0x2a, 0x1b, 0xb8, 0x91, 0xf6, 0xf7, 0x64, 0xcd, 0x82, 0x93, 0xd0,
+  0xc9, 0xce, 0xef, 0xfc, 0x85, 0xda, 0x0b, 0xe8, 0x01, 0xa6, 0xe7, 0x94,
+  0x3d, 0x32, 0x83, 0x00, 0x39, 0x7e, 0xdf, 0x2c, 0xf5, 0x8a, 0xfb, 0x18,
+  0x71, 0x56, 0xd7, 0xc4, 0xad, 0xe2, 0x73, 0x30, 0xa9, 0x2e, 0xcf, 0x5c,
+  0x65, 0x3a, 0xeb, 0x48, 0xe1, 0x06, 0xc7, 0xf4, 0x1d, 0x92, 0x63, 0x60,
+  0x19, 0xde, 0xbf, 0x8c, 0xd5, 0xea, 0xdb, 0x78, 0x51, 0xb6, 0xb7, 0x24,
+  0x8d, 0x42, 0x53, 0x90, 0x89, 0x8e, 0xaf, 0xbc, 0x45, 0x9a, 0xcb, 0xa8,
+  0xc1, 0x66, 0xa7, 0x54, 0xfd, 0xf2, 0x43, 0xc0, 0xf9, 0x3e, 0x9f, 0xec,
+  0xb5, 0x4a, 0xbb, 0xd8, 0x31, 0x16, 0x97, 0x84, 0x6d, 0xa2, 0x33, 0xf0,
+  0x69, 0xee, 0x8f, 0x1c, 0x25, 0xfa, 0xab, 0x08, 0xa1, 0xc6, 0x87, 0xb4,
+  0xdd, 0x52, 0x23, 0x20, 0xd9, 0x9e, 0x7f, 0x4c, 0x95, 0xaa, 0x9b, 0x38,
+  0x11, 0x76, 0x77, 0xe4, 0x4d, 0x02, 0x13, 0x50, 0x49, 0x4e, 0x6f, 0x7c,
+  0x05, 0x5a, 0x8b, 0x68, 0x81, 0x26, 0x67, 0x14, 0xbd, 0xb2, 0x03, 0x80,
+  0xb9, 0xfe, 0x5f, 0xac, 0x75, 0x0a, 0x7b, 0x98, 0xf1, 0xd6, 0x57, 0x44,
+  0x2d, 0x62, 0xf3, 0xb0, 0x29, 0xae, 0x4f, 0xdc, 0xe5, 0xba, 0x6b, 0xc8,
+  0x61, 0x86, 0x47, 0x74, 0x9d, 0x12, 0xe3, 0xe0, 0x99, 0x5e, 0x3f, 0x0c,
+  0x55, 0x6a, 0x5b, 0xf8, 0xd1, 0x36, 0x37, 0xa4, 0x0d, 0xc2, 0xd3, 0x10,
+  0x09, 0x0e, 0x2f, 0x3c, 0xc5, 0x1a, 0x4b, 0x28, 0x41, 0xe6, 0x27, 0xd4,
+  0x7d, 0x72, 0xc3, 0x40, 0x79, 0xbe, 0x1f, 0x6c, 0x35, 0xca, 0x3b, 0x58,
+  0xb1, 0x96, 0x17, 0x04, 0xed, 0x22, 0xb3, 0x70, 0xe9, 0x6e, 0x0f, 0x9c,
+  0xa5, 0x7a, 0x2b, 0x88, 0x21, 0x46
+};
+static const unsigned int synth_4k_wasm_len = 4602;
+
+static const unsigned char synth_16k_wasm[] = {
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+  0x01, 0x7f, 0x01, 0x7f, 0x03, 0x15, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07, 0x09, 0x01, 0x05,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x13, 0x0a, 0x98, 0x7f, 0x14, 0xcd,
+  0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0x9b, 0x9c, 0xa4, 0xd4, 0x04,
+  0x6c, 0x41, 0xb8, 0xd7, 0xa5, 0x94, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xe9, 0xd7, 0x9b, 0x06,
+  0x6c, 0x41, 0xf7, 0xe1, 0x81, 0xb1, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x83, 0xb4, 0xab, 0x03,
+  0x6c, 0x41, 0x82, 0xd5, 0x91, 0xbc, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xf3, 0x87, 0xdc, 0x05,
+  0x6c, 0x41, 0xc9, 0xdb, 0xd3, 0xba, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0x8f, 0xba, 0xbf, 0x04,
+  0x6c, 0x41, 0xfc, 0xc5, 0xd3, 0xfe, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0x8f, 0xc3, 0xf1, 0x00,
+  0x6c, 0x41, 0x8b, 0xe8, 0x96, 0xa2, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0x9a, 0xde, 0xbd, 0x01,
+  0x6c, 0x41, 0xa6, 0x8f, 0x8e, 0xaf, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x95, 0xab, 0xd2, 0x86, 0x01,
+  0x6c, 0x41, 0xbd, 0xf0, 0xbb, 0xa4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0x83, 0xb3, 0xba, 0xa3, 0x03, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0x81, 0xee, 0xbd, 0x21, 0x6c, 0x41, 0xb9, 0xb6, 0xdf, 0xc3,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xdf, 0x95, 0xdd, 0x97, 0x01, 0x6c, 0x41, 0xac, 0x86, 0xd4, 0x9c,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x8b, 0xb7, 0xeb, 0xcd, 0x03, 0x6c, 0x41, 0xfb, 0xeb, 0xbe, 0xd1,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf1, 0xf0, 0xf2, 0x9d, 0x06, 0x6c, 0x41, 0xd6, 0xcc, 0xcc, 0xff,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc5, 0x97, 0xca, 0x90, 0x05, 0x6c, 0x41, 0xad, 0xd5, 0xcd, 0xb0,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf3, 0xd2, 0xe3, 0xdb, 0x00, 0x6c, 0x41, 0xb0, 0xc0, 0xba, 0xdc,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xaf, 0xd4, 0xe2, 0xe0, 0x00, 0x6c, 0x41, 0xcf, 0xd3, 0xba, 0xbf,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xe5, 0x84, 0x91, 0xcf, 0x06, 0x6c, 0x41, 0xba, 0xf6, 0xa4, 0x8c,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc8, 0x8a, 0xe9, 0x8b,
+  0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xe1, 0xbf, 0xee, 0xfe,
+  0x00, 0x6c, 0x41, 0x86, 0xa2, 0xff, 0xa1, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xdb, 0xc9, 0xbc,
+  0x03, 0x6c, 0x41, 0x9d, 0xb2, 0xc5, 0xac, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xaa, 0xbc, 0xd3,
+  0x02, 0x6c, 0x41, 0xe0, 0xea, 0x89, 0xbb, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xf5, 0xe7, 0xe4,
+  0x02, 0x6c, 0x41, 0xbf, 0xc9, 0xce, 0xed, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x9d, 0x8e, 0x94,
+  0x04, 0x6c, 0x41, 0xea, 0xcd, 0x9b, 0xaa, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0xa0, 0xb6, 0xc7,
+  0x00, 0x6c, 0x41, 0xd1, 0x86, 0xed, 0x9f, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xd9, 0xad, 0xbd,
+  0x07, 0x6c, 0x41, 0xa4, 0xf8, 0x9c, 0xdd, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xd2, 0xa5, 0xe3,
+  0x03, 0x6c, 0x41, 0xd3, 0xba, 0x80, 0x10, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x14, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0x89, 0x97, 0xc8, 0xe0, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0x8f, 0xaf, 0xa3, 0xc1, 0x07, 0x6c, 0x41, 0xaf, 0xf7, 0x94,
+  0x87, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xc5, 0xae, 0x9b, 0xd4, 0x05, 0x6c, 0x41, 0x9a, 0xbd, 0xfb,
+  0xaa, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa9, 0x8f, 0x88, 0xd9, 0x04, 0x6c, 0x41, 0xc1, 0xc5, 0x8a,
+  0xfe, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa7, 0xe3, 0xeb, 0x05, 0x6c, 0x41, 0xd4, 0xec, 0x8f, 0x9b,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf3, 0xcd, 0xca, 0x99, 0x07, 0x6c, 0x41, 0xc3, 0x82, 0xec, 0xe4,
+  0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf9, 0xd1, 0xdf, 0x84, 0x05, 0x6c, 0x41, 0xbe, 0x80, 0x81, 0x1a,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xed, 0xf7, 0xde, 0x98, 0x07, 0x6c, 0x41, 0xb5, 0xb7, 0x94, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb,
+  0xab, 0xa5, 0xb8, 0x03, 0x6c, 0x41, 0xd8, 0xd5, 0xea, 0x85, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x96, 0xb2, 0x88, 0xbf, 0x04, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xd0, 0x06, 0x01, 0x01, 0x7f, 0x20,
+  0x00, 0x41, 0x97, 0xa5, 0xb6, 0xdf, 0x07, 0x6c, 0x41, 0x84, 0xb9, 0xee,
+  0xf4, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa3, 0xe1, 0xfa, 0x8a, 0x05, 0x6c, 0x41, 0xb3, 0x82, 0xbb,
+  0xf3, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xe9, 0x84, 0xa0, 0xbe, 0x07, 0x6c, 0x41, 0xee, 0xe9, 0xec,
+  0xb8, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9d, 0xf0, 0xdf, 0xb3, 0x06, 0x6c, 0x41, 0xa5, 0xb8, 0xd5,
+  0x82, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xab, 0xc7, 0xdc, 0xcd, 0x05, 0x6c, 0x41, 0x88, 0xf4, 0xe9,
+  0x08, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc7, 0xe7, 0xc3, 0xf1, 0x07, 0x6c, 0x41, 0x87, 0x9f, 0x89, 0xb2,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xdd, 0xd5, 0xcf, 0xd2, 0x05, 0x6c, 0x41, 0xd2, 0x8c, 0xe2, 0xd9,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa1, 0x84, 0xf2, 0x95, 0x05, 0x6c, 0x41, 0xd9, 0xaf, 0xa5, 0xf5,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xff, 0xd0, 0xee, 0xfb,
+  0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xcd, 0xc0, 0xde, 0xb1,
+  0x02, 0x6c, 0x41, 0x95, 0xb1, 0xba, 0xfa, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x9b, 0xb1, 0xd9,
+  0x04, 0x6c, 0x41, 0xb8, 0xea, 0x91, 0x93, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xb4, 0x8f, 0xd8,
+  0x03, 0x6c, 0x41, 0xf7, 0xd0, 0xe0, 0xd3, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x8a, 0xa9, 0x86,
+  0x06, 0x6c, 0x41, 0x82, 0xd0, 0xac, 0xee, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xe6, 0x92, 0xbc,
+  0x07, 0x6c, 0x41, 0xc9, 0xd2, 0x8b, 0x90, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xde, 0xd6, 0xcc,
+  0x02, 0x6c, 0x41, 0xfc, 0xe8, 0xa6, 0xf8, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0xea, 0x86, 0x9f,
+  0x02, 0x6c, 0x41, 0x8b, 0xa7, 0xdf, 0xcf, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0xf1, 0xe5, 0x9d,
+  0x05, 0x6c, 0x41, 0xa6, 0x9a, 0xd7, 0xeb, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0x94, 0xae, 0x88, 0xa5, 0x06, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xbd, 0xb7, 0x90, 0xcc, 0x02, 0x6c, 0x41, 0xb2, 0xab,
+  0x86, 0xf7, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x81, 0xa1, 0xce, 0x88, 0x01, 0x6c, 0x41, 0xb9, 0xed,
+  0xee, 0xf2, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xdf, 0xa4, 0xdd, 0xb3, 0x02, 0x6c, 0x41, 0xac, 0xe9,
+  0x84, 0x83, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x8b, 0xd2, 0x88, 0x92, 0x03, 0x6c, 0x41, 0xfb, 0xea,
+  0xa2, 0xb3, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xf1, 0x87, 0xc2, 0xfe, 0x04, 0x6c, 0x41, 0xd6, 0x97,
+  0x87, 0x8b, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xc5, 0xda, 0x8d, 0x98, 0x02, 0x6c, 0x41, 0xad, 0xdc,
+  0xe1, 0xd2, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xf3, 0xb1, 0x89, 0xb7, 0x04, 0x6c, 0x41, 0xb0, 0xb3,
+  0xb0, 0xa3, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xaf, 0xff, 0x99, 0xe8, 0x06, 0x6c, 0x41, 0xcf, 0xa2,
+  0xfe, 0xa9, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01,
+  0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xe5, 0xeb,
+  0xd8, 0xd2, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xbb, 0xd1,
+  0xfb, 0xf9, 0x00, 0x6c, 0x41, 0xeb, 0xe6, 0xb7, 0x94, 0x06, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0x96,
+  0xe5, 0xa1, 0x04, 0x6c, 0x41, 0x86, 0xad, 0x8b, 0xfb, 0x06, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xde,
+  0xfa, 0xa9, 0x04, 0x6c, 0x41, 0x9d, 0xf9, 0xf8, 0xe6, 0x03, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xc9,
+  0xcd, 0x86, 0x05, 0x6c, 0x41, 0xe0, 0x9d, 0xc5, 0xea, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xe0,
+  0xa0, 0xeb, 0x04, 0x6c, 0x41, 0xbf, 0xd8, 0xb5, 0xd6, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0xc4,
+  0xe5, 0x18, 0x6c, 0x41, 0xea, 0xe8, 0x8b, 0x84, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0xb3, 0xb8,
+  0xfd, 0x07, 0x6c, 0x41, 0xd1, 0x9d, 0xeb, 0xb6, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xc8, 0x9a,
+  0xb2, 0x07, 0x6c, 0x41, 0xa4, 0xbb, 0x9b, 0xdd, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0xc2, 0xcd, 0xa6, 0xb3, 0x05, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x01, 0x0b, 0xcc, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41,
+  0xd3, 0x99, 0xdd, 0xbe, 0x03, 0x6c, 0x41, 0x90, 0xe0, 0x98, 0xf2, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x8f, 0xda, 0xbd, 0x8d, 0x04, 0x6c, 0x41, 0xaf, 0xc6, 0xff, 0x8d, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc5, 0x95, 0xe2, 0xdf, 0x02, 0x6c, 0x41, 0x9a, 0x98, 0xe5, 0xe3, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa9, 0xe2, 0xdf, 0x2e, 0x6c, 0x41, 0xc1, 0x9c, 0xf0, 0xaa, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7,
+  0x92, 0xcc, 0xf2, 0x01, 0x6c, 0x41, 0xd4, 0xef, 0xbb, 0x8a, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3,
+  0x88, 0xf5, 0xd3, 0x00, 0x6c, 0x41, 0xc3, 0xa1, 0xf4, 0x22, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9, 0x88,
+  0x8d, 0xdc, 0x07, 0x6c, 0x41, 0xbe, 0xeb, 0xdc, 0xa2, 0x04, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xed, 0xda,
+  0xc5, 0x81, 0x05, 0x6c, 0x41, 0xb5, 0xde, 0xaa, 0x8f, 0x04, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71,
+  0x04, 0x40, 0x20, 0x01, 0x41, 0xbb, 0xaa, 0xb7, 0xa0, 0x01, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x00, 0x41, 0xd9, 0xe8, 0xf7, 0xbb, 0x02, 0x6c, 0x41,
+  0xb1, 0x93, 0x90, 0x29, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x97, 0x94, 0xea, 0x8b, 0x06, 0x6c, 0x41, 0x84,
+  0xfc, 0xa7, 0xe0, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xa3, 0xdc, 0xae, 0xea, 0x07, 0x6c, 0x41, 0xb3,
+  0xe1, 0xce, 0xc4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xe9, 0xfb, 0x84, 0xc0, 0x05, 0x6c, 0x41, 0xee,
+  0x94, 0xea, 0xa4, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x9d, 0x93, 0x84, 0x21, 0x6c, 0x41, 0xa5, 0x9f,
+  0x9b, 0xed, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xab, 0x86, 0xea, 0x34, 0x6c, 0x41, 0x88, 0xc7, 0x8c,
+  0x90, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xc7, 0xf2, 0xd5, 0xb4, 0x05, 0x6c, 0x41, 0x87, 0xce, 0xf0,
+  0xd5, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xdd, 0x9c, 0xc1, 0xd7, 0x05, 0x6c, 0x41, 0xd2, 0xc7, 0xff,
+  0xc8, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa0, 0xb7, 0x83,
+  0xff, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd9, 0xe6, 0xa1,
+  0x9b, 0x06, 0x6c, 0x41, 0x9e, 0xd6, 0xd1, 0xb3, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0xa3, 0xa0,
+  0xb8, 0x07, 0x6c, 0x41, 0x95, 0xd8, 0x8f, 0x9d, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x9a, 0x9a,
+  0xeb, 0x06, 0x6c, 0x41, 0xb8, 0xfd, 0xa9, 0x8c, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xff, 0xd2,
+  0xb2, 0x03, 0x6c, 0x41, 0xf7, 0xbf, 0xdb, 0x96, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x91, 0x9a,
+  0xc8, 0x00, 0x6c, 0x41, 0x82, 0xcb, 0x93, 0x88, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xd9, 0xc9,
+  0x89, 0x02, 0x6c, 0x41, 0xc9, 0xc9, 0xff, 0xc3, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xad, 0x8f,
+  0xc9, 0x04, 0x6c, 0x41, 0xfc, 0x8b, 0xe6, 0xdc, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0xc5, 0x96,
+  0x8f, 0x02, 0x6c, 0x41, 0x8b, 0xe6, 0x83, 0xa8, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0x81, 0xc8, 0xa9, 0xb3, 0x04, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x00, 0x41, 0xa7, 0xa5, 0xac, 0xfc, 0x07, 0x6c, 0x41, 0xe7,
+  0xe9, 0xa6, 0x82, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xbd, 0xfe, 0xe0, 0x88, 0x01, 0x6c, 0x41, 0xb2,
+  0xe6, 0x96, 0x86, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x81, 0xd4, 0x8a, 0xe3, 0x06, 0x6c, 0x41, 0xb9,
+  0xa4, 0xba, 0x8e, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xdf, 0xb3, 0xf9, 0xfc, 0x03, 0x6c, 0x41, 0xac,
+  0xcc, 0xa1, 0xba, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x8b, 0xed, 0xf1, 0xee, 0x04, 0x6c, 0x41, 0xfb,
+  0xe9, 0xe2, 0xdd, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xf1, 0x9e, 0xcd, 0xe2, 0x07, 0x6c, 0x41, 0xd6,
+  0xe2, 0xcd, 0xa0, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xc5, 0x9d, 0xbd, 0x33, 0x6c, 0x41, 0xad, 0xe3,
+  0xf1, 0xb7, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xf3, 0x90, 0x8b, 0xba, 0x06, 0x6c, 0x41, 0xb0, 0xa6,
+  0xd2, 0xe3, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01,
+  0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xae, 0xaa,
+  0xdd, 0xa4, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06,
+  0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0xcf, 0xf1, 0xdd, 0xff, 0x06, 0x6c,
+  0x41, 0xdc, 0xe4, 0x9e, 0x92, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0xac, 0x9e, 0xd6, 0x00, 0x6c,
+  0x41, 0xeb, 0xa5, 0xf3, 0x8c, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xed, 0x97, 0x96, 0x03, 0x6c,
+  0x41, 0x86, 0xb8, 0xa3, 0x14, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xe1, 0x97, 0xd1, 0x07, 0x6c, 0x41,
+  0x9d, 0xc0, 0xa8, 0x92, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xe8, 0xba, 0x3f, 0x6c, 0x41, 0xe0,
+  0xd0, 0xac, 0x99, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xdf, 0xcb, 0xe5, 0x9c, 0x02, 0x6c, 0x41, 0xbf,
+  0xe7, 0xb8, 0xe8, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd5, 0xeb, 0xb8, 0xb5, 0x03, 0x6c, 0x41, 0xea,
+  0x83, 0xc8, 0xa2, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xf9, 0xc6, 0xe6, 0xc5, 0x00, 0x6c, 0x41, 0xd1,
+  0xb4, 0xa5, 0xed, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xb7,
+  0xb7, 0xa3, 0xbf, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xa5,
+  0xfe, 0x85, 0xbd, 0x06, 0x6c, 0x41, 0x8d, 0x95, 0xe1, 0xf2, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3,
+  0xf8, 0x95, 0xd1, 0x01, 0x6c, 0x41, 0x90, 0xd3, 0xa5, 0xc8, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8f,
+  0x85, 0xe4, 0xfa, 0x05, 0x6c, 0x41, 0xaf, 0x95, 0x86, 0xfc, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc5,
+  0xfc, 0xa4, 0xf1, 0x02, 0x6c, 0x41, 0x9a, 0xf3, 0x9a, 0xb7, 0x06, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa9,
+  0xb5, 0xe3, 0xdc, 0x07, 0x6c, 0x41, 0xc1, 0xf3, 0x91, 0xc5, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7,
+  0xc1, 0xc8, 0xf5, 0x00, 0x6c, 0x41, 0xd4, 0xf2, 0xd3, 0xff, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3,
+  0xc3, 0xeb, 0xe3, 0x04, 0x6c, 0x41, 0xc3, 0xc0, 0xd8, 0xa2, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf9,
+  0xbf, 0xf6, 0xd7, 0x04, 0x6c, 0x41, 0xbe, 0xd6, 0xc4, 0xc2, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xec, 0xbd, 0x98, 0xd3, 0x00, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xb5, 0x85, 0xbd, 0x8b, 0x06, 0x6c,
+  0x41, 0xca, 0xfa, 0xc2, 0xfd, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xfb, 0xb0, 0x90, 0x05, 0x6c,
+  0x41, 0xb1, 0xaa, 0xf9, 0xb8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0x83, 0xba, 0xcc, 0x05, 0x6c,
+  0x41, 0x84, 0xbf, 0xcd, 0xf7, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xd7, 0xae, 0xb5, 0x06, 0x6c,
+  0x41, 0xb3, 0xc0, 0xbe, 0xb5, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xf2, 0xa5, 0xf4, 0x01, 0x6c,
+  0x41, 0xee, 0xbf, 0xf3, 0x9d, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9d, 0xb6, 0x94, 0xdd, 0x07, 0x6c,
+  0x41, 0xa5, 0x86, 0xdd, 0x39, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xab, 0xc5, 0xd3, 0xfa, 0x00, 0x6c, 0x41,
+  0x88, 0x9a, 0xdb, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xc7, 0xfd, 0xf3, 0x0f, 0x6c, 0x41, 0x87,
+  0xfd, 0xf3, 0x8b, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xdd,
+  0xe3, 0xae, 0x85, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd3,
+  0x82, 0xe9, 0x39, 0x6c, 0x41, 0xa3, 0xf8, 0x83, 0xd9, 0x02, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0x9d,
+  0xda, 0x81, 0x07, 0x6c, 0x41, 0x9e, 0xc1, 0xdc, 0xdc, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x86,
+  0xce, 0xf3, 0x04, 0x6c, 0x41, 0x95, 0xff, 0xe0, 0x8f, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x99,
+  0xdf, 0xf9, 0x00, 0x6c, 0x41, 0xb8, 0x90, 0xee, 0xaf, 0x01, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xca,
+  0xa2, 0xdb, 0x04, 0x6c, 0x41, 0xf7, 0xae, 0xf2, 0xe9, 0x06, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x98,
+  0x87, 0xe1, 0x01, 0x6c, 0x41, 0x82, 0xc6, 0xc6, 0xb9, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xcc,
+  0xac, 0xf4, 0x01, 0x6c, 0x41, 0xc9, 0xc0, 0xaf, 0xc6, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xfc,
+  0xe3, 0xa4, 0x02, 0x6c, 0x41, 0xfc, 0xae, 0x91, 0xdc, 0x02, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71,
+  0x04, 0x40, 0x20, 0x01, 0x41, 0xda, 0xa0, 0xf2, 0xf1, 0x01, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x01, 0x0b, 0xce, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00,
+  0x41, 0x8b, 0xa5, 0x84, 0x9b, 0x05, 0x6c, 0x41, 0xe8, 0xde, 0xf5, 0xb3,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa7, 0xb0, 0x8d, 0x91, 0x07, 0x6c, 0x41, 0xe7, 0x98, 0xb1, 0x8a,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xbd, 0xc5, 0xad, 0xca, 0x05, 0x6c, 0x41, 0xb2, 0xa1, 0xf3, 0xc2,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x81, 0x87, 0xf3, 0xe0, 0x05, 0x6c, 0x41, 0xb9, 0xdb, 0xc1, 0x86,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xdf, 0xc2, 0xb1, 0xe3, 0x05, 0x6c, 0x41, 0xac, 0xaf, 0xaa, 0xf2,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x8b, 0x88, 0xa7, 0x94, 0x02, 0x6c, 0x41, 0xfb, 0xe8, 0xfe, 0xc0,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf1, 0xb5, 0x94, 0xba, 0x07, 0x6c, 0x41, 0xd6, 0xad, 0xa0, 0xf0,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc5, 0xe0, 0xd8, 0x92, 0x06, 0x6c, 0x41, 0xad, 0xea, 0xfd, 0xcf,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf3, 0xef, 0xe8, 0xd4,
+  0x00, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xb1, 0x99, 0xa0, 0xcd,
+  0x07, 0x6c, 0x41, 0xa9, 0xee, 0xac, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0xc0, 0xd9, 0xb0, 0x04,
+  0x6c, 0x41, 0xdc, 0x87, 0xe5, 0xa7, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0x87, 0x8d, 0xd1, 0x02,
+  0x6c, 0x41, 0xeb, 0xe4, 0x8a, 0xdc, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xc4, 0x86, 0xcc, 0x06,
+  0x6c, 0x41, 0x86, 0xc3, 0xc7, 0x9d, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xe4, 0xa0, 0xe2, 0x03,
+  0x6c, 0x41, 0x9d, 0x87, 0xd4, 0x9e, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0x87, 0x84, 0xee, 0x06,
+  0x6c, 0x41, 0xe0, 0x83, 0xc0, 0xf7, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xb6, 0xb6, 0xa9, 0x06,
+  0x6c, 0x41, 0xbf, 0xf6, 0xd7, 0x13, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x92, 0x88, 0xda, 0x00, 0x6c,
+  0x41, 0xea, 0x9e, 0xd0, 0xb5, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0xf8, 0xd9, 0xc0, 0xd0, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xd1, 0xcb, 0x9b, 0xb3, 0x01, 0x6c, 0x41, 0xb6, 0xf0, 0xee, 0xa3,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa5, 0xc1, 0xdc, 0xac, 0x04, 0x6c, 0x41, 0x8d, 0x9c, 0x8c, 0x81,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xd3, 0xd7, 0xaa, 0xb7, 0x04, 0x6c, 0x41, 0x90, 0xc6, 0xde, 0xd3,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x8f, 0xb0, 0x96, 0x39, 0x6c, 0x41, 0xaf, 0xe4, 0xa8, 0xc1, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc5, 0xe3, 0xe3, 0xf8, 0x00, 0x6c, 0x41, 0x9a, 0xce, 0x9c, 0xd5, 0x00,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa9, 0x88, 0x93, 0x93, 0x03, 0x6c, 0x41, 0xc1, 0xca, 0xef, 0x3c, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7,
+  0xf0, 0xe0, 0xfe, 0x00, 0x6c, 0x41, 0xd4, 0xf5, 0xd7, 0xaa, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf3,
+  0xfe, 0xad, 0xf9, 0x00, 0x6c, 0x41, 0xc3, 0xdf, 0x98, 0xd4, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf9, 0xf6, 0x9b, 0xe8, 0x00, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xbf, 0xc1, 0xb8, 0xa9, 0x06, 0x6c,
+  0x41, 0x9f, 0x8a, 0xc8, 0x9c, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0xac, 0xcb, 0xeb, 0x00, 0x6c,
+  0x41, 0xca, 0x95, 0x9e, 0xc9, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0x8e, 0x96, 0xb3, 0x01, 0x6c,
+  0x41, 0xb1, 0xc1, 0x9e, 0xf4, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0xf2, 0xa5, 0x91, 0x02, 0x6c,
+  0x41, 0x84, 0x82, 0xdf, 0xea, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xd2, 0xfa, 0x9b, 0x06, 0x6c,
+  0x41, 0xb3, 0x9f, 0x8a, 0xb6, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xe9, 0x82, 0xcb, 0x01, 0x6c,
+  0x41, 0xee, 0xea, 0x88, 0xd4, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9d, 0xd9, 0x90, 0x98, 0x07, 0x6c,
+  0x41, 0xa5, 0xed, 0x9a, 0xd8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xab, 0x84, 0x99, 0x8f, 0x05, 0x6c,
+  0x41, 0x88, 0xed, 0xd5, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0xc6, 0x88, 0x9e, 0xb3, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01,
+  0x0b, 0xcf, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0x87, 0xac, 0x93,
+  0xc4, 0x00, 0x6c, 0x41, 0xb4, 0xe6, 0xbd, 0xd1, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3, 0xbd, 0x9e,
+  0xdc, 0x03, 0x6c, 0x41, 0xa3, 0x97, 0xbb, 0x9c, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xd4, 0xce,
+  0x98, 0x06, 0x6c, 0x41, 0x9e, 0xac, 0xf3, 0x38, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0xe9, 0xe7, 0x93,
+  0x05, 0x6c, 0x41, 0x95, 0xa6, 0xae, 0xc2, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x98, 0x80, 0xf5,
+  0x00, 0x6c, 0x41, 0xb8, 0xa3, 0xde, 0xad, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0x95, 0xfe, 0x81,
+  0x07, 0x6c, 0x41, 0xf7, 0x9d, 0xa5, 0xbd, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd, 0x9f, 0xf0, 0xc0,
+  0x00, 0x6c, 0x41, 0x82, 0xc1, 0xc5, 0xb2, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xbf, 0xbb, 0xac,
+  0x03, 0x6c, 0x41, 0xc9, 0xb7, 0x9b, 0x87, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xef, 0xcb, 0xd4, 0xcf, 0x03, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xfd, 0xd1, 0xa8, 0xa6, 0x06, 0x6c, 0x41, 0x85, 0xd7,
+  0xe1, 0x8b, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x8b, 0xe4, 0xe0, 0x98, 0x06, 0x6c, 0x41, 0xe8, 0xb1,
+  0xbb, 0x80, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xa7, 0xbb, 0xfa, 0xd9, 0x06, 0x6c, 0x41, 0xe7, 0xc7,
+  0xd7, 0x90, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xbd, 0x8c, 0xf6, 0x80, 0x07, 0x6c, 0x41, 0xb2, 0xdc,
+  0x9b, 0xdd, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x81, 0xba, 0x87, 0xb2, 0x02, 0x6c, 0x41, 0xb9, 0x92,
+  0x85, 0xcb, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xdf, 0xd1, 0x85, 0xd7, 0x07, 0x6c, 0x41, 0xac, 0x92,
+  0x9f, 0xdb, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x8b, 0xa3, 0xa8, 0xb2, 0x04, 0x6c, 0x41, 0xfb, 0xe7,
+  0xf6, 0xcc, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xf1, 0xcc, 0x97, 0xf5, 0x04, 0x6c, 0x41, 0xd6, 0xf8,
+  0xfe, 0xa9, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01,
+  0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc4, 0xa3,
+  0xe0, 0xe5, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xad, 0xf1,
+  0x85, 0x8b, 0x05, 0x6c, 0x41, 0xe2, 0x8f, 0xcd, 0xe0, 0x01, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0x8c,
+  0x9a, 0x90, 0x03, 0x6c, 0x41, 0xa9, 0xe5, 0xa7, 0x96, 0x04, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0x8f,
+  0xf1, 0xac, 0x05, 0x6c, 0x41, 0xdc, 0xaa, 0x97, 0xd4, 0x02, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0xe2,
+  0xc7, 0x1a, 0x6c, 0x41, 0xeb, 0xa3, 0xfe, 0xf1, 0x02, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0x9b, 0xb1,
+  0xb3, 0x07, 0x6c, 0x41, 0x86, 0xce, 0xf7, 0xc6, 0x04, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xe7, 0x95,
+  0x8d, 0x07, 0x6c, 0x41, 0x9d, 0xce, 0xfb, 0xfb, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe3, 0xa6, 0xa9,
+  0x82, 0x02, 0x6c, 0x41, 0xe0, 0xb6, 0xff, 0x34, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xa1, 0x93, 0xc1,
+  0x04, 0x6c, 0x41, 0xbf, 0x85, 0x93, 0xc8, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xd5, 0xb9, 0xd3, 0xf6, 0x02, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xeb, 0xb9, 0xa4, 0xed, 0x02, 0x6c, 0x41, 0xdb, 0x97,
+  0xb3, 0xf6, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd1, 0xe2, 0xcd, 0xf8, 0x03, 0x6c, 0x41, 0xb6, 0xbb,
+  0xd0, 0xeb, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xa5, 0x84, 0x9f, 0xdc, 0x05, 0x6c, 0x41, 0x8d, 0xa3,
+  0xb3, 0x8e, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd3, 0xb6, 0x9b, 0xe1, 0x05, 0x6c, 0x41, 0x90, 0xb9,
+  0xc3, 0xc4, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x8f, 0xdb, 0xd4, 0xf8, 0x06, 0x6c, 0x41, 0xaf, 0xb3,
+  0xe7, 0xcd, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xc5, 0xca, 0x9e, 0xe6, 0x07, 0x6c, 0x41, 0x9a, 0xa9,
+  0xea, 0xed, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xa9, 0xdb, 0xee, 0x81, 0x03, 0x6c, 0x41, 0xc1, 0xa1,
+  0x89, 0x82, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xa7, 0x9f, 0x95, 0xfe, 0x05, 0x6c, 0x41, 0xd4, 0xf8,
+  0xc7, 0xbb, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01,
+  0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf2, 0xb9,
+  0xbc, 0xc4, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xce, 0x06,
+  0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0xc3, 0xfe, 0xb4, 0xa7, 0x03, 0x6c,
+  0x41, 0xc0, 0x93, 0xf2, 0x98, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xac, 0xb8, 0x87, 0x03, 0x6c,
+  0x41, 0x9f, 0x99, 0xea, 0x90, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0xd3, 0xd5, 0x9f, 0x07, 0x6c,
+  0x41, 0xca, 0xb0, 0xc5, 0xe5, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xa1, 0xa7, 0xd4, 0x07, 0x6c,
+  0x41, 0xb1, 0xd8, 0xff, 0xca, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0xe1, 0xad, 0xca, 0x07, 0x6c,
+  0x41, 0x84, 0xc5, 0xdc, 0xe9, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xcd, 0x92, 0xce, 0x04, 0x6c,
+  0x41, 0xb3, 0xfe, 0xb1, 0xb6, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xe0, 0x9b, 0xb4, 0x01, 0x6c,
+  0x41, 0xee, 0x95, 0xaa, 0xf7, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9d, 0xfc, 0xf8, 0x81, 0x01, 0x6c,
+  0x41, 0xa5, 0xd4, 0xd4, 0x38, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0xab, 0xc3, 0xba, 0xe2, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41,
+  0x89, 0xc0, 0xfc, 0xbf, 0x04, 0x6c, 0x41, 0xa1, 0x87, 0xcd, 0x8c, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x87, 0xdb, 0xce, 0xee, 0x00, 0x6c, 0x41, 0xb4, 0xe9, 0xa8, 0xfb, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd3, 0xf8, 0x9f, 0xe0, 0x01, 0x6c, 0x41, 0xa3, 0xb6, 0xce, 0xbd, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd9, 0x8b, 0xff, 0xcf, 0x00, 0x6c, 0x41, 0x9e, 0x97, 0x96, 0xf8, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xcd, 0xcc, 0xed, 0xc8, 0x02, 0x6c, 0x41, 0x95, 0xcd, 0xf7, 0xa4, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x9b, 0x97, 0xfd, 0xcc, 0x04, 0x6c, 0x41, 0xb8, 0xb6, 0xfa, 0xb5, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xf7, 0xe0, 0xe5, 0xd6, 0x01, 0x6c, 0x41, 0xf7, 0x8c, 0xf4, 0x80, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xcd, 0xa6, 0xd5, 0xd7, 0x03, 0x6c, 0x41, 0x82, 0xbc, 0x90, 0xa3, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xd0, 0xb2, 0xf6, 0xe1, 0x02,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xc9, 0xae, 0xc3, 0xf6, 0x07,
+  0x6c, 0x41, 0xce, 0xb0, 0xe8, 0xdf, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfd, 0xf4, 0xab, 0xeb, 0x04,
+  0x6c, 0x41, 0x85, 0xbe, 0x9a, 0xb6, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xa3, 0x99, 0x91, 0x04,
+  0x6c, 0x41, 0xe8, 0x84, 0xad, 0x9d, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xc6, 0xf3, 0x86, 0x06,
+  0x6c, 0x41, 0xe7, 0xf6, 0x99, 0x85, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbd, 0xd3, 0xba, 0x9c, 0x04,
+  0x6c, 0x41, 0xb2, 0x97, 0x90, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0xed, 0xc7, 0x86, 0x01, 0x6c,
+  0x41, 0xb9, 0xc9, 0x84, 0xcc, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xe0, 0xf5, 0xc7, 0x01, 0x6c,
+  0x41, 0xac, 0xf5, 0xff, 0xa4, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xbe, 0xf5, 0xf8, 0x04, 0x6c,
+  0x41, 0xfb, 0xe6, 0xca, 0xf1, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0xf1, 0xe3, 0xd6, 0x83, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xd7, 0xc3, 0xe9, 0xfd, 0x02, 0x6c, 0x41, 0xd7, 0x98, 0xbc, 0xed,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xad, 0xf8, 0x89, 0xd9, 0x00, 0x6c, 0x41, 0xe2, 0x8a, 0xcb, 0xba,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xb1, 0xff, 0xbf, 0xdc, 0x07, 0x6c, 0x41, 0xa9, 0xdc, 0xde, 0xf2,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xcf, 0xde, 0xa4, 0xe4, 0x01, 0x6c, 0x41, 0xdc, 0xcd, 0xb5, 0xc7,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xbb, 0xbd, 0xce, 0xe2, 0x02, 0x6c, 0x41, 0xeb, 0xe2, 0xcd, 0xbe,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xe1, 0xf2, 0x97, 0xbc, 0x06, 0x6c, 0x41, 0x86, 0xd9, 0xb3, 0xc0,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf5, 0xea, 0xf6, 0x01, 0x6c, 0x41, 0x9d, 0x95, 0x9f, 0x9a, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xe3, 0xc5, 0xaa, 0xec, 0x03, 0x6c, 0x41, 0xe0, 0xe9, 0xea, 0x81, 0x01,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xde, 0x8c, 0xfc, 0x13, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06, 0x01, 0x01, 0x7f, 0x20,
+  0x00, 0x41, 0xbf, 0x94, 0xea, 0xf5, 0x00, 0x6c, 0x41, 0x8c, 0xfe, 0x98,
+  0x3a, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xeb, 0xd4, 0xc4, 0xf9, 0x00, 0x6c, 0x41, 0xdb, 0x96, 0xde, 0xd6,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xd1, 0xf9, 0xbb, 0xad, 0x03, 0x6c, 0x41, 0xb6, 0x86, 0xbe, 0xb9,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa5, 0xc7, 0xcd, 0xfb, 0x00, 0x6c, 0x41, 0x8d, 0xaa, 0xd6, 0x8a,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xd3, 0x95, 0xe8, 0xbe, 0x07, 0x6c, 0x41, 0x90, 0xac, 0xd4, 0xca,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x8f, 0x86, 0x9f, 0xe9, 0x04, 0x6c, 0x41, 0xaf, 0x82, 0xc2, 0x91,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc5, 0xb1, 0xd5, 0xa9, 0x02, 0x6c, 0x41, 0x9a, 0x84, 0x84, 0xb1,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa9, 0xae, 0xf6, 0xd8, 0x07, 0x6c, 0x41, 0xc1, 0xf8, 0xde, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa7, 0xce, 0xe5, 0xe3, 0x03,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xd5, 0xfb, 0xa3, 0xe2, 0x06,
+  0x6c, 0x41, 0xfd, 0xb6, 0x8b, 0xf3, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0x9d, 0xad, 0x8c, 0x04,
+  0x6c, 0x41, 0xc0, 0xc6, 0x88, 0xc1, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0x97, 0xc4, 0x8c, 0x04,
+  0x6c, 0x41, 0x9f, 0xa8, 0xa8, 0xfa, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0xfa, 0xdb, 0x97, 0x04,
+  0x6c, 0x41, 0xca, 0xcb, 0xb8, 0x82, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xb4, 0xe4, 0x23, 0x6c,
+  0x41, 0xb1, 0xef, 0x9c, 0x2d, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0xd0, 0xd1, 0xe7, 0x01, 0x6c, 0x41,
+  0x84, 0x88, 0xc6, 0xa4, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xc8, 0xf6, 0xfb, 0x06, 0x6c, 0x41,
+  0xb3, 0xdd, 0xb5, 0xa6, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xd7, 0xf0, 0x9f, 0x06, 0x6c, 0x41,
+  0xee, 0xc0, 0xd7, 0x37, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x9c,
+  0x9f, 0xcd, 0xca, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xa5,
+  0xbb, 0x8a, 0xcb, 0x03, 0x6c, 0x41, 0xfa, 0xaa, 0x8e, 0xed, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x89,
+  0x93, 0xcf, 0xf8, 0x01, 0x6c, 0x41, 0xa1, 0xde, 0x91, 0xd0, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x87,
+  0x8a, 0xa6, 0xfb, 0x00, 0x6c, 0x41, 0xb4, 0xec, 0xff, 0x86, 0x06, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3,
+  0xb3, 0xed, 0xf5, 0x07, 0x6c, 0x41, 0xa3, 0xd5, 0xbd, 0xac, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9,
+  0xc2, 0xeb, 0x97, 0x03, 0x6c, 0x41, 0x9e, 0x82, 0xc5, 0xca, 0x00, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcd,
+  0xaf, 0xdf, 0xc2, 0x07, 0x6c, 0x41, 0x95, 0xf4, 0xbc, 0xa7, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b,
+  0x96, 0xd6, 0xf1, 0x01, 0x6c, 0x41, 0xb8, 0xc9, 0xc2, 0xf8, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7,
+  0xab, 0xd9, 0x89, 0x04, 0x6c, 0x41, 0xf7, 0xfb, 0xde, 0xa4, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xcd, 0xad, 0xb6, 0x95, 0x02, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x83, 0xb7, 0xa7, 0xbb, 0x05, 0x6c,
+  0x41, 0x93, 0x85, 0x81, 0x8c, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc9, 0xa5, 0xa7, 0x84, 0x06, 0x6c,
+  0x41, 0xce, 0xdb, 0xf8, 0xca, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfd, 0x97, 0x9b, 0xdb, 0x00, 0x6c,
+  0x41, 0x85, 0xa5, 0xcf, 0xee, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xe2, 0xad, 0xf4, 0x04, 0x6c,
+  0x41, 0xe8, 0xd7, 0xca, 0xba, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xd1, 0xf8, 0xc7, 0x04, 0x6c,
+  0x41, 0xe7, 0xa5, 0xf8, 0xd7, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbd, 0x9a, 0xfb, 0x8c, 0x04, 0x6c,
+  0x41, 0xb2, 0xd2, 0xd0, 0xea, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x81, 0xa0, 0xb4, 0x8e, 0x06, 0x6c,
+  0x41, 0xb9, 0x80, 0xc0, 0xf9, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdf, 0xef, 0x81, 0xa6, 0x03, 0x6c,
+  0x41, 0xac, 0xd8, 0xcc, 0xff, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0x8a, 0xd9, 0x8e, 0x98, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01,
+  0x0b, 0xce, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0xfb, 0xe5, 0xfa,
+  0x9e, 0x07, 0x6c, 0x41, 0x98, 0xbe, 0xf3, 0xcb, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd7, 0x8e, 0xe0,
+  0x1b, 0x6c, 0x41, 0xd7, 0x87, 0xee, 0xf6, 0x00, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0xff, 0x89, 0xaa,
+  0x05, 0x6c, 0x41, 0xe2, 0x85, 0x95, 0xe8, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0xf2, 0x91, 0xe2,
+  0x01, 0x6c, 0x41, 0xa9, 0xd3, 0xd1, 0x89, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0xad, 0xf4, 0xc6,
+  0x01, 0x6c, 0x41, 0xdc, 0xf0, 0xbf, 0xb1, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0x98, 0xa1, 0xd9,
+  0x03, 0x6c, 0x41, 0xeb, 0xa1, 0xf9, 0xb1, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xc9, 0xba, 0xd6,
+  0x04, 0x6c, 0x41, 0x86, 0xe4, 0xfb, 0xb9, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf5, 0xed, 0xc3, 0xf0,
+  0x04, 0x6c, 0x41, 0x9d, 0xdc, 0xbe, 0xe9, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xe3, 0xe4, 0x87, 0x9c, 0x06, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xe1, 0x9c, 0x82, 0x8e, 0x01, 0x6c, 0x41, 0x99, 0x9e,
+  0xf8, 0xc4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xbf, 0xa3, 0xdd, 0x8c, 0x02, 0x6c, 0x41, 0x8c, 0xe1,
+  0xc0, 0x88, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xeb, 0xef, 0xb0, 0x8a, 0x07, 0x6c, 0x41, 0xdb, 0x95,
+  0xe5, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd1, 0x90, 0xe6, 0xc1, 0x00, 0x6c, 0x41, 0xb6, 0xd1,
+  0xb7, 0x3d, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa5, 0x8a, 0xe8, 0xba, 0x04, 0x6c, 0x41, 0x8d, 0xb1, 0xf5,
+  0xe5, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xd3, 0xf4, 0x90, 0xc0, 0x03, 0x6c, 0x41, 0x90, 0x9f, 0x91,
+  0x96, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x8f, 0xb1, 0xf5, 0xba, 0x05, 0x6c, 0x41, 0xaf, 0xd1, 0xb8,
+  0xfc, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xc5, 0x98, 0x88, 0xb3, 0x03, 0x6c, 0x41, 0x9a, 0xdf, 0xe9,
+  0xce, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa8, 0x81, 0xaa,
+  0xc8, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xc1, 0xcf, 0xf0,
+  0x34, 0x6c, 0x41, 0xe6, 0xd6, 0xff, 0xa6, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0xfe, 0xeb, 0xce,
+  0x06, 0x6c, 0x41, 0xfd, 0xfd, 0x89, 0xd8, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xbc, 0x81, 0xf3,
+  0x07, 0x6c, 0x41, 0xc0, 0xf9, 0xca, 0xb4, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0x82, 0xdc, 0xe8,
+  0x04, 0x6c, 0x41, 0x9f, 0xb7, 0x82, 0xc9, 0x00, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0xa1, 0xde, 0xc3,
+  0x02, 0x6c, 0x41, 0xca, 0xe6, 0xf7, 0xcf, 0x00, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xc7, 0xcd, 0xd1,
+  0x03, 0x6c, 0x41, 0xb1, 0x86, 0xf6, 0x0a, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0xbf, 0x91, 0xd9, 0x04,
+  0x6c, 0x41, 0x84, 0xcb, 0x9b, 0xcb, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xc3, 0xa6, 0xd5, 0x02,
+  0x6c, 0x41, 0xb3, 0xbc, 0x95, 0xf6, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1d, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xe9, 0xce, 0x81, 0xfe, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xef, 0xeb, 0x90, 0xc5, 0x03, 0x6c, 0x41, 0x8f, 0xd5, 0xb6,
+  0xd3, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa5, 0xa2, 0xbc, 0xff, 0x01, 0x6c, 0x41, 0xfa, 0x85, 0x87,
+  0xbd, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x89, 0xe6, 0xcd, 0xd5, 0x02, 0x6c, 0x41, 0xa1, 0xb5, 0x92,
+  0xdd, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x87, 0xb9, 0x99, 0xda, 0x04, 0x6c, 0x41, 0xb4, 0xef, 0xc2,
+  0xa4, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xd3, 0xee, 0x86, 0xcd, 0x03, 0x6c, 0x41, 0xa3, 0xf4, 0x88,
+  0xd9, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xd9, 0xf9, 0x93, 0xe0, 0x02, 0x6c, 0x41, 0x9e, 0xed, 0xff,
+  0xdf, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xcd, 0x92, 0xbd, 0xb1, 0x06, 0x6c, 0x41, 0x95, 0x9b, 0xfe,
+  0xb9, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9b, 0x95, 0x8b, 0xd3, 0x06, 0x6c, 0x41, 0xb8, 0xdc, 0xb6,
+  0xa5, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xf6, 0xf6, 0xd8,
+  0xca, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06, 0x01,
+  0x01, 0x7f, 0x20, 0x00, 0x41, 0xf7, 0xea, 0xe5, 0x98, 0x04, 0x6c, 0x41,
+  0xe4, 0xeb, 0xad, 0xa5, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x83, 0xb2, 0x8a, 0xab, 0x02, 0x6c, 0x41,
+  0x93, 0xe4, 0x97, 0xf9, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xc9, 0x9c, 0xc7, 0xa0, 0x03, 0x6c, 0x41,
+  0xce, 0x86, 0x95, 0xef, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xfd, 0xba, 0xf6, 0xa5, 0x04, 0x6c, 0x41,
+  0x85, 0x8c, 0x80, 0xa5, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xa1, 0x9e, 0xb2, 0x06, 0x6c, 0x41,
+  0xe8, 0xaa, 0x94, 0x88, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xdc, 0x89, 0xcd, 0x01, 0x6c, 0x41,
+  0xe7, 0xd4, 0xf2, 0xf8, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xbd, 0xe1, 0xb7, 0xc2, 0x05, 0x6c, 0x41,
+  0xb2, 0x8d, 0xdd, 0x3d, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x81, 0xd3, 0xcc, 0xf9, 0x05, 0x6c, 0x41, 0xb9,
+  0xb7, 0xb7, 0xc3, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xdf,
+  0xfe, 0xa9, 0xe1, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xad,
+  0xbb, 0x85, 0x1b, 0x6c, 0x41, 0xf5, 0xf4, 0x9d, 0xd0, 0x03, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfb, 0xe4,
+  0x86, 0xc5, 0x04, 0x6c, 0x41, 0x98, 0xd1, 0xf2, 0xba, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd7, 0xd9,
+  0xe2, 0xb3, 0x06, 0x6c, 0x41, 0xd7, 0xf6, 0xbb, 0xcc, 0x06, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0x86,
+  0x86, 0xee, 0x01, 0x6c, 0x41, 0xe2, 0x80, 0xab, 0x19, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0xe5, 0x8f,
+  0xd1, 0x05, 0x6c, 0x41, 0xa9, 0xca, 0x80, 0xcb, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0xfc, 0xdf,
+  0xc4, 0x04, 0x6c, 0x41, 0xdc, 0x93, 0xb6, 0xc2, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbb, 0xf3, 0xbf,
+  0xae, 0x04, 0x6c, 0x41, 0xeb, 0xe0, 0x80, 0xbc, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xa0, 0x99,
+  0xf2, 0x02, 0x6c, 0x41, 0x86, 0xef, 0xcf, 0xe3, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0xf4, 0xf0, 0xfc, 0x88, 0x04, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x00, 0x41, 0x9d, 0xa3, 0xda, 0xd9, 0x05, 0x6c, 0x41, 0x92,
+  0x8c, 0xa0, 0x98, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xe1, 0xcf, 0xc5, 0x89, 0x05, 0x6c, 0x41, 0x99,
+  0xd5, 0xbe, 0xb7, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xbf, 0xb2, 0xec, 0xfc, 0x00, 0x6c, 0x41, 0x8c,
+  0xc4, 0xd4, 0xe3, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xeb, 0x8a, 0xe9, 0xcf, 0x06, 0x6c, 0x41, 0xdb,
+  0x94, 0xc8, 0xd5, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd1, 0xa7, 0xcc, 0xa5, 0x04, 0x6c, 0x41, 0xb6,
+  0x9c, 0xbd, 0xa7, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xa5, 0xcd, 0xee, 0xc9, 0x06, 0x6c, 0x41, 0x8d,
+  0xb8, 0x90, 0x10, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd3, 0xd3, 0x95, 0xd5, 0x03, 0x6c, 0x41, 0x90, 0x92,
+  0xfa, 0xd6, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x8f, 0xdc, 0xd7, 0x9d, 0x04, 0x6c, 0x41, 0xaf, 0xa0,
+  0xcb, 0xfe, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01,
+  0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc5, 0xff,
+  0xb6, 0xf2, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x9b, 0xba,
+  0x9b, 0xf7, 0x02, 0x6c, 0x41, 0xcb, 0x80, 0x99, 0xde, 0x06, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc1, 0xa6,
+  0xbe, 0x82, 0x05, 0x6c, 0x41, 0xe6, 0xe1, 0x96, 0xb0, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x81,
+  0xa0, 0xb1, 0x04, 0x6c, 0x41, 0xfd, 0xc4, 0x84, 0x3a, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xdb, 0xb1,
+  0xcb, 0x00, 0x6c, 0x41, 0xc0, 0xac, 0xb9, 0xa3, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xed, 0xff,
+  0xcb, 0x00, 0x6c, 0x41, 0x9f, 0xc6, 0xf8, 0xec, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0xc8, 0xdc,
+  0x93, 0x05, 0x6c, 0x41, 0xca, 0x81, 0x83, 0xfe, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xda, 0xe2,
+  0x8d, 0x02, 0x6c, 0x41, 0xb1, 0x9d, 0x8b, 0xd4, 0x00, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x97, 0xae, 0xed,
+  0x8e, 0x04, 0x6c, 0x41, 0x84, 0x8e, 0xdd, 0x8d, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0xa2, 0xbe, 0xa2, 0x8a, 0x05, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x01, 0x0b, 0xd2, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41,
+  0xb3, 0x9b, 0xd1, 0x95, 0x07, 0x6c, 0x41, 0xf0, 0x9e, 0x8f, 0x8f, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xef, 0x96, 0xd6, 0xcf, 0x01, 0x6c, 0x41, 0x8f, 0xa4, 0xf0, 0x98, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa5, 0x89, 0xea, 0xc5, 0x06, 0x6c, 0x41, 0xfa, 0xe0, 0xcb, 0xc3, 0x06,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x89, 0xb9, 0xf8, 0x86, 0x07, 0x6c, 0x41, 0xa1, 0x8c, 0xcf, 0xa3, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x87, 0xe8, 0xa8, 0xfb, 0x07, 0x6c, 0x41, 0xb4, 0xf2, 0xf1, 0x83, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd3, 0xa9, 0xec, 0x95, 0x02, 0x6c, 0x41, 0xa3, 0x93, 0xb0, 0xb3, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd9, 0xb0, 0xf8, 0x98, 0x04, 0x6c, 0x41, 0x9e, 0xd8, 0xc6, 0xe8, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xcd, 0xf5, 0x86, 0xc5, 0x01, 0x6c, 0x41, 0x95, 0xc2, 0xbb, 0xcc, 0x00,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x9b, 0x94, 0x9c, 0xe1, 0x00,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xb9, 0xef, 0xd6, 0xec, 0x03,
+  0x6c, 0x41, 0x91, 0xf3, 0xa5, 0xb8, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xd9, 0x88, 0xcd, 0x05,
+  0x6c, 0x41, 0xe4, 0xae, 0xaa, 0x8e, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x83, 0xad, 0xb9, 0xa2, 0x01,
+  0x6c, 0x41, 0x93, 0xc3, 0x8a, 0xf2, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc9, 0x93, 0xa3, 0xbb, 0x04,
+  0x6c, 0x41, 0xce, 0xb1, 0xbd, 0xfc, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfd, 0xdd, 0xbd, 0xfb, 0x01,
+  0x6c, 0x41, 0x85, 0xf3, 0xac, 0xc9, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xe0, 0xea, 0xba, 0x06,
+  0x6c, 0x41, 0xe8, 0xfd, 0x89, 0xb6, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7, 0xe7, 0xa6, 0xc6, 0x04,
+  0x6c, 0x41, 0xe7, 0x83, 0x89, 0xd8, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbd, 0xa8, 0xf0, 0xac, 0x07,
+  0x6c, 0x41, 0xb2, 0xc8, 0xb5, 0xae, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1e, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0x80, 0x86, 0x91, 0xf8, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xb9, 0xee, 0xea, 0x99, 0x04, 0x6c, 0x41, 0xfe, 0xa2, 0xa6,
+  0x97, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xad, 0x9e, 0xaa, 0xa7, 0x04, 0x6c, 0x41, 0xf5, 0x9b, 0x9a,
+  0xbc, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xfb, 0xe3, 0xee, 0xd3, 0x00, 0x6c, 0x41, 0x98, 0xe4, 0x9d,
+  0xd0, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xd7, 0xa4, 0xf1, 0xf5, 0x04, 0x6c, 0x41, 0xd7, 0xe5, 0xa5,
+  0xde, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xad, 0x8d, 0xfe, 0x94, 0x05, 0x6c, 0x41, 0xe2, 0xfb, 0x8c,
+  0xfe, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xb1, 0xd8, 0xb9, 0xd9, 0x07, 0x6c, 0x41, 0xa9, 0xc1, 0xeb,
+  0xa6, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xcf, 0xcb, 0xe7, 0xcd, 0x02, 0x6c, 0x41, 0xdc, 0xb6, 0x98,
+  0xaa, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xbb, 0xce, 0xaa, 0x92, 0x06, 0x6c, 0x41, 0xeb, 0x9f, 0xe4,
+  0xcc, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xe1, 0xf7, 0xb3,
+  0xff, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x87, 0xfa, 0xaf,
+  0xed, 0x03, 0x6c, 0x41, 0xc7, 0xff, 0xda, 0x8f, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9d, 0xea, 0xf1,
+  0xda, 0x01, 0x6c, 0x41, 0x92, 0xc7, 0xeb, 0x9b, 0x04, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0x82, 0xb5,
+  0xa4, 0x01, 0x6c, 0x41, 0x99, 0x8c, 0xc1, 0xd2, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xc1, 0x97,
+  0xb6, 0x05, 0x6c, 0x41, 0x8c, 0xa7, 0xd4, 0xfb, 0x00, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xeb, 0xa5, 0xed,
+  0xf9, 0x00, 0x6c, 0x41, 0xdb, 0x93, 0x87, 0xd4, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xbe, 0xee,
+  0xc8, 0x07, 0x6c, 0x41, 0xb6, 0xe7, 0xce, 0xa7, 0x04, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5, 0x90, 0xe1,
+  0xd8, 0x05, 0x6c, 0x41, 0x8d, 0xbf, 0xa7, 0xf9, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3, 0xb2, 0xf6,
+  0xed, 0x01, 0x6c, 0x41, 0x90, 0x85, 0x8f, 0xbd, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04,
+  0x40, 0x20, 0x01, 0x41, 0x8e, 0x87, 0xc6, 0xc1, 0x04, 0x73, 0x21, 0x01,
+  0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41,
+  0xaf, 0xef, 0xf9, 0x87, 0x02, 0x6c, 0x41, 0xbc, 0xef, 0xa9, 0xa9, 0x01,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x9b, 0x95, 0x99, 0xda, 0x04, 0x6c, 0x41, 0xcb, 0xbf, 0x93, 0xa6, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc1, 0xfd, 0xc7, 0xdd, 0x06, 0x6c, 0x41, 0xe6, 0xec, 0xb9, 0x85, 0x02,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd5, 0x84, 0xc0, 0xb9, 0x06, 0x6c, 0x41, 0xfd, 0x8b, 0xfb, 0x88, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc3, 0xfa, 0xbd, 0x05, 0x6c, 0x41, 0xc0, 0xdf, 0xd3, 0xbd, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf,
+  0xd8, 0xaf, 0xe6, 0x02, 0x6c, 0x41, 0x9f, 0xd5, 0x8a, 0xd6, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5,
+  0xef, 0xd6, 0xf7, 0x06, 0x6c, 0x41, 0xca, 0x9c, 0xda, 0xbc, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9,
+  0xed, 0xa3, 0x88, 0x04, 0x6c, 0x41, 0xb1, 0xb4, 0xdc, 0xf8, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x97, 0x9d, 0xe5, 0xf8, 0x03, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x85, 0xd1, 0x8a, 0x9c, 0x03, 0x6c,
+  0x41, 0xed, 0xd0, 0xc8, 0xc0, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0xfa, 0xe8, 0xf4, 0x04, 0x6c,
+  0x41, 0xf0, 0x91, 0x8f, 0xf6, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xc1, 0xa7, 0x87, 0x06, 0x6c,
+  0x41, 0x8f, 0xf3, 0xc5, 0xe1, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5, 0xf0, 0x93, 0x8e, 0x04, 0x6c,
+  0x41, 0xfa, 0xbb, 0xdc, 0xb0, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x89, 0x8c, 0xcf, 0xbc, 0x07, 0x6c,
+  0x41, 0xa1, 0xe3, 0xc7, 0x93, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x87, 0x97, 0xd4, 0xce, 0x06, 0x6c,
+  0x41, 0xb4, 0xf5, 0x8c, 0xd5, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd3, 0xe4, 0x9d, 0x80, 0x01, 0x6c,
+  0x41, 0xa3, 0xb2, 0xb3, 0xab, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd9, 0xe7, 0x98, 0xb2, 0x04, 0x6c,
+  0x41, 0x9e, 0xc3, 0x99, 0x14, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0xcc, 0xd8, 0xbc, 0xad, 0x03, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41,
+  0x95, 0xe9, 0xf4, 0xce, 0x04, 0x6c, 0x41, 0xaa, 0xf3, 0xcb, 0xcb, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xb9, 0x82, 0xa3, 0xfe, 0x07, 0x6c, 0x41, 0x91, 0x8a, 0xa6, 0xe5, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xf7, 0xc8, 0xc7, 0xb1, 0x04, 0x6c, 0x41, 0xe4, 0xf1, 0x92, 0x0f, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x83,
+  0xa8, 0xb4, 0xd1, 0x07, 0x6c, 0x41, 0x93, 0xa2, 0xd9, 0xe6, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc9,
+  0x8a, 0xbb, 0xc4, 0x06, 0x6c, 0x41, 0xce, 0xdc, 0xf1, 0xa2, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfd,
+  0x80, 0xf1, 0x8b, 0x04, 0x6c, 0x41, 0x85, 0xda, 0xd5, 0xcb, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b,
+  0x9f, 0x93, 0xfe, 0x02, 0x6c, 0x41, 0xe8, 0xd0, 0xab, 0xf4, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa7,
+  0xf2, 0xcf, 0xe3, 0x04, 0x6c, 0x41, 0xe7, 0xb2, 0xbb, 0xe5, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xbd, 0xef, 0xa4, 0x3c, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x00, 0x41, 0xb3, 0x83, 0xda, 0xec, 0x01, 0x6c, 0x41,
+  0x83, 0xca, 0x96, 0xb2, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0xa5, 0xda, 0xec, 0x06, 0x6c, 0x41,
+  0xfe, 0x8d, 0x9c, 0xef, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0x81, 0xbb, 0xd4, 0x05, 0x6c, 0x41,
+  0xf5, 0xc2, 0x92, 0xf4, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xfb, 0xe2, 0xb2, 0xbb, 0x01, 0x6c, 0x41,
+  0x98, 0xf7, 0xf4, 0xbb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xd7, 0xef, 0x8b, 0x92, 0x03, 0x6c, 0x41,
+  0xd7, 0xd4, 0xab, 0x9c, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0x94, 0xf2, 0x8e, 0x06, 0x6c, 0x41,
+  0xe2, 0xf6, 0xba, 0xc6, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0xcb, 0x8f, 0xab, 0x04, 0x6c, 0x41,
+  0xa9, 0xb8, 0x92, 0x8d, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0x9a, 0x8b, 0xd2, 0x03, 0x6c, 0x41,
+  0xdc, 0xd9, 0xe6, 0x18, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xba,
+  0xa9, 0xe1, 0xb4, 0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcc,
+  0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0xeb, 0xde, 0xa3, 0xd4, 0x01,
+  0x6c, 0x41, 0xc8, 0xf5, 0x8a, 0xe8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x87, 0x85, 0x9c, 0x87, 0x06,
+  0x6c, 0x41, 0xc7, 0xae, 0x94, 0xf6, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9d, 0xb1, 0x85, 0xdd, 0x00,
+  0x6c, 0x41, 0x92, 0x82, 0x83, 0x19, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe1, 0xb5, 0xd0, 0x8e, 0x02, 0x6c,
+  0x41, 0x99, 0xc3, 0xff, 0x85, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xd0, 0xde, 0xa8, 0x07, 0x6c,
+  0x41, 0x8c, 0x8a, 0xc0, 0x80, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xeb, 0xc0, 0xbd, 0xb8, 0x07, 0x6c,
+  0x41, 0xdb, 0x92, 0xa2, 0xe7, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd1, 0xd5, 0xcc, 0x9b, 0x03, 0x6c,
+  0x41, 0xb6, 0xb2, 0xec, 0xed, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5, 0xd3, 0xbf, 0x17, 0x6c, 0x41,
+  0x8d, 0xc6, 0xba, 0x91, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0xd3, 0x91, 0xb3, 0xfa, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41,
+  0x91, 0xf8, 0xcf, 0xf8, 0x07, 0x6c, 0x41, 0x89, 0xc6, 0xbd, 0xb5, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xaf, 0xbe, 0xc4, 0x88, 0x04, 0x6c, 0x41, 0xbc, 0x92, 0x93, 0xc9, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x9b, 0xf0, 0xe2, 0xa7, 0x07, 0x6c, 0x41, 0xcb, 0xfe, 0xe9, 0xa0, 0x01,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xc1, 0xd4, 0x8d, 0xb6, 0x06, 0x6c, 0x41, 0xe6, 0xf7, 0xe8, 0xd6, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xd5, 0x87, 0xcc, 0x97, 0x03, 0x6c, 0x41, 0xfd, 0xd2, 0xed, 0x34, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3,
+  0x99, 0xa6, 0x11, 0x6c, 0x41, 0xc0, 0x92, 0x9a, 0xb3, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xc3,
+  0xeb, 0xe7, 0x06, 0x6c, 0x41, 0x9f, 0xe4, 0xb8, 0xf4, 0x02, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0x96,
+  0xcd, 0xdf, 0x02, 0x6c, 0x41, 0xca, 0xb7, 0xfd, 0xbb, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71,
+  0x04, 0x40, 0x20, 0x01, 0x41, 0xd8, 0x80, 0x91, 0xf1, 0x01, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x00, 0x41, 0xb1, 0xcb, 0xe9, 0xe8, 0x07, 0x6c, 0x41,
+  0x96, 0xd5, 0xfd, 0xb8, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x85, 0x94, 0xa4, 0xa6, 0x02, 0x6c, 0x41,
+  0xed, 0xd7, 0xfa, 0xed, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0xd9, 0xdc, 0x83, 0x03, 0x6c, 0x41,
+  0xf0, 0x84, 0xbb, 0xbe, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xec, 0x84, 0x9c, 0x04, 0x6c, 0x41,
+  0x8f, 0xc2, 0xb7, 0x9d, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xa5, 0xd7, 0xb9, 0xc8, 0x05, 0x6c, 0x41,
+  0xfa, 0x96, 0xb9, 0xb4, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x89, 0xdf, 0xd1, 0xa6, 0x04, 0x6c, 0x41,
+  0xa1, 0xba, 0xfc, 0x9c, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x87, 0xc6, 0x9b, 0xc4, 0x04, 0x6c, 0x41,
+  0xb4, 0xf8, 0x93, 0xc8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xd3, 0x9f, 0x9b, 0xbc, 0x05, 0x6c, 0x41,
+  0xa3, 0xd1, 0x92, 0xb1, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0xd9, 0x9e, 0xf5, 0x1b, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x9f,
+  0xae, 0xf8, 0x92, 0x02, 0x6c, 0x41, 0xff, 0xd7, 0xbc, 0xe2, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x95,
+  0x90, 0xaa, 0xb1, 0x05, 0x6c, 0x41, 0xaa, 0x8e, 0xc2, 0xd6, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9,
+  0x95, 0x9b, 0x8a, 0x04, 0x6c, 0x41, 0x91, 0xa1, 0xe2, 0xf9, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7,
+  0xb7, 0xa2, 0xb6, 0x04, 0x6c, 0x41, 0xe4, 0xb4, 0xe7, 0xd7, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x83,
+  0xa3, 0xfb, 0xe7, 0x02, 0x6c, 0x41, 0x93, 0x81, 0x84, 0xc7, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc9,
+  0x81, 0x8f, 0xac, 0x06, 0x6c, 0x41, 0xce, 0x87, 0xb2, 0x12, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfd, 0xa3,
+  0x90, 0x87, 0x05, 0x6c, 0x41, 0x85, 0xc1, 0xfa, 0x9b, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8b, 0xde,
+  0x97, 0xec, 0x01, 0x6c, 0x41, 0xe8, 0xa3, 0xf9, 0xf2, 0x00, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71,
+  0x04, 0x40, 0x20, 0x01, 0x41, 0xa6, 0xfd, 0x84, 0xd5, 0x01, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x01, 0x0b, 0xc8, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00,
+  0x41, 0xe7, 0xe1, 0x89, 0x91, 0x01, 0x6c, 0x41, 0x94, 0xc9, 0xea, 0x85,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xb3, 0xbe, 0xca, 0xa8, 0x06, 0x6c, 0x41, 0x83, 0xe9, 0xec, 0xc0,
+  0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xb9, 0xdc, 0x85, 0x2c, 0x6c, 0x41, 0xfe, 0xf8, 0x9d, 0x06, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad,
+  0xe4, 0xb7, 0xd2, 0x06, 0x6c, 0x41, 0xf5, 0xe9, 0x86, 0xe8, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfb,
+  0xe1, 0xd2, 0xeb, 0x04, 0x6c, 0x41, 0x98, 0x8a, 0xf8, 0xad, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd7,
+  0xba, 0xb2, 0x38, 0x6c, 0x41, 0xd7, 0xc3, 0xcd, 0xf6, 0x05, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0x9b,
+  0xe2, 0xcb, 0x03, 0x6c, 0x41, 0xe2, 0xf1, 0xb4, 0xa2, 0x03, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0xbe,
+  0x91, 0xf6, 0x07, 0x6c, 0x41, 0xa9, 0xaf, 0xf5, 0xed, 0x01, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71,
+  0x04, 0x40, 0x20, 0x01, 0x41, 0xcf, 0xe9, 0xca, 0xc1, 0x07, 0x73, 0x21,
+  0x01, 0x0b, 0x20, 0x00, 0x41, 0xdd, 0xfc, 0xa0, 0x3e, 0x6c, 0x41, 0xe5,
+  0x8a, 0xab, 0xd3, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xeb, 0x9d, 0xbf, 0xc2, 0x02, 0x6c, 0x41, 0xc8,
+  0xc8, 0xa3, 0xfe, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x87, 0x90, 0x94, 0xe1, 0x04, 0x6c, 0x41, 0xc7,
+  0xdd, 0xe9, 0xf6, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0x9d, 0xf8, 0x94, 0xd0, 0x01, 0x6c, 0x41, 0x92,
+  0xbd, 0xe6, 0x3f, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xe1, 0xe8, 0x97, 0xf8, 0x03, 0x6c, 0x41, 0x99, 0xfa,
+  0xf9, 0xc1, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xbf, 0xdf, 0xc1, 0xc4, 0x06, 0x6c, 0x41, 0x8c, 0xed,
+  0x97, 0xa2, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xeb, 0xdb, 0xd9, 0xbb, 0x03, 0x6c, 0x41, 0xdb, 0x91,
+  0x99, 0xff, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd1, 0xec, 0xe6, 0x0d, 0x6c, 0x41, 0xb6, 0xfd, 0x95,
+  0xaa, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa4, 0x96, 0x8a,
+  0xb6, 0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x8d, 0xcd, 0xc9,
+  0xc8, 0x02, 0x6c, 0x41, 0xc2, 0xa0, 0x8b, 0xb1, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x91, 0xeb, 0xbc,
+  0xb9, 0x04, 0x6c, 0x41, 0x89, 0xbd, 0xaf, 0xf6, 0x02, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xaf, 0x8d, 0xab,
+  0xf0, 0x04, 0x6c, 0x41, 0xbc, 0xb5, 0xe8, 0xeb, 0x01, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0xcb, 0xf8,
+  0x8f, 0x04, 0x6c, 0x41, 0xcb, 0xbd, 0x9c, 0xbe, 0x03, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc1, 0xab, 0x8f,
+  0xfc, 0x04, 0x6c, 0x41, 0xe6, 0x82, 0xa4, 0xd4, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x8a, 0xc4,
+  0xfb, 0x00, 0x6c, 0x41, 0xfd, 0x99, 0xdc, 0xad, 0x07, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xb8, 0xea,
+  0xde, 0x02, 0x6c, 0x41, 0xc0, 0xc5, 0x8c, 0xb4, 0x02, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xbf, 0xae, 0x33,
+  0x6c, 0x41, 0x9f, 0xf3, 0x82, 0xb8, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1e, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xb5, 0xbd, 0xbf, 0xbb, 0x03, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xcb, 0xd2, 0xec, 0xab, 0x06, 0x6c, 0x41, 0xbb, 0xa1, 0x85,
+  0xaa, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xb1, 0xe2, 0xb2, 0x14, 0x6c, 0x41, 0x96, 0xa0, 0xaa, 0x86,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x85, 0xd7, 0xa9, 0xdc, 0x04, 0x6c, 0x41, 0xed, 0xde, 0xa8, 0x16,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xb3, 0xb8, 0xac, 0xb2, 0x03, 0x6c, 0x41, 0xf0, 0xf7, 0x92, 0x98, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xef, 0x97, 0xee, 0xbd, 0x07, 0x6c, 0x41, 0x8f, 0x91, 0xc5, 0xbc, 0x04,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xa5, 0xbe, 0xdb, 0xe4, 0x05, 0x6c, 0x41, 0xfa, 0xf1, 0xe1, 0xfe, 0x05,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x89, 0xb2, 0x80, 0xf5, 0x05, 0x6c, 0x41, 0xa1, 0x91, 0xed, 0xaf, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x87, 0xf5, 0xfe, 0xcb, 0x05, 0x6c, 0x41, 0xb4, 0xfb, 0x86, 0x8d, 0x01,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xd2, 0xda, 0xe4, 0xf9, 0x04,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcd, 0x06, 0x01, 0x01, 0x7f,
+  0x20, 0x00, 0x41, 0xa3, 0xf0, 0xcd, 0x34, 0x6c, 0x41, 0xa0, 0x82, 0xdc,
+  0xcb, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9f, 0x99, 0xe3, 0x94, 0x04, 0x6c, 0x41, 0xff, 0xe6, 0xed,
+  0xcc, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x95, 0xb7, 0xdb, 0xe3, 0x05, 0x6c, 0x41, 0xaa, 0xa9, 0x84,
+  0xfe, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xb9, 0xa8, 0xbf, 0xc0, 0x00, 0x6c, 0x41, 0x91, 0xb8, 0xda,
+  0xe5, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xf7, 0xa6, 0x99, 0xcb, 0x01, 0x6c, 0x41, 0xe4, 0xf7, 0xa7,
+  0x98, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x83, 0x9e, 0x8e, 0x16, 0x6c, 0x41, 0x93, 0xe0, 0x8a, 0x83,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc9, 0xf8, 0x9e, 0xe2, 0x00, 0x6c, 0x41, 0xce, 0xb2, 0xfe, 0xfa,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xfd, 0xc6, 0x9b, 0x9d, 0x07, 0x6c, 0x41, 0x85, 0xa8, 0x9b, 0x2a,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x8b, 0x9d, 0xf8, 0xf4, 0x00,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xe9, 0xf6, 0xf2, 0xe1, 0x06,
+  0x6c, 0x41, 0x81, 0xd7, 0x96, 0x8b, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe7, 0x90, 0xf4, 0xca, 0x04,
+  0x6c, 0x41, 0x94, 0xcc, 0xd8, 0xde, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0xf9, 0x86, 0x92, 0x07,
+  0x6c, 0x41, 0x83, 0x88, 0x9f, 0x89, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0x93, 0xed, 0xc7, 0x05,
+  0x6c, 0x41, 0xfe, 0xe3, 0xab, 0x8c, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0xc7, 0xa0, 0xd1, 0x01,
+  0x6c, 0x41, 0xf5, 0x90, 0xf7, 0x87, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfb, 0xe0, 0xce, 0xd4, 0x00,
+  0x6c, 0x41, 0x98, 0x9d, 0xa7, 0xd6, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd7, 0x85, 0xe5, 0x98, 0x04,
+  0x6c, 0x41, 0xd7, 0xb2, 0x8b, 0xdd, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0xa2, 0xce, 0xbb, 0x04,
+  0x6c, 0x41, 0xe2, 0xec, 0xfa, 0xc1, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x15, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xb0, 0xb1, 0xbf, 0xea, 0x06, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xa9, 0xa6, 0x94, 0xb9, 0x02, 0x6c, 0x41, 0xae, 0xad, 0xd7,
+  0x8a, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xdd, 0x9f, 0xc7, 0xca, 0x06, 0x6c, 0x41, 0xe5, 0xf1, 0xca,
+  0xaa, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xeb, 0xdc, 0xb6, 0x87, 0x03, 0x6c, 0x41, 0xc8, 0x9b, 0xe8,
+  0x90, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x87, 0x9b, 0x98, 0xab, 0x07, 0x6c, 0x41, 0xc7, 0x8c, 0xdb,
+  0x81, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9d, 0xbf, 0xa0, 0xa4, 0x03, 0x6c, 0x41, 0x92, 0xf8, 0x95,
+  0xc0, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xe1, 0x9b, 0x8b, 0x91, 0x03, 0x6c, 0x41, 0x99, 0xb1, 0xb0,
+  0xf6, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0d, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xbf, 0xee, 0xc0, 0xf9, 0x02, 0x6c, 0x41, 0x8c, 0xd0, 0xdb,
+  0x10, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xeb, 0xf6, 0xc1, 0xb3, 0x06, 0x6c, 0x41, 0xdb, 0x90, 0xec, 0x8b,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xd1, 0x83, 0xbd, 0x8f,
+  0x07, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xb7, 0xc8, 0xcb, 0x8c,
+  0x06, 0x6c, 0x41, 0xb7, 0x9e, 0xdf, 0x26, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8d, 0xd4, 0xd4, 0x8e, 0x07,
+  0x6c, 0x41, 0xc2, 0x9b, 0x84, 0xed, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x91, 0xde, 0xd5, 0xaf, 0x03,
+  0x6c, 0x41, 0x89, 0xb4, 0xdd, 0xbd, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x15, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xaf, 0xdc, 0xad, 0xaf, 0x04,
+  0x6c, 0x41, 0xbc, 0xd8, 0xa9, 0xc1, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0xa6, 0xda, 0xc2, 0x04,
+  0x6c, 0x41, 0xcb, 0xfc, 0xaa, 0xee, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x04, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc1, 0x82, 0xcd, 0x9f, 0x03,
+  0x6c, 0x41, 0xe6, 0x8d, 0xeb, 0xad, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd5, 0x8d, 0xa8, 0x95, 0x06,
+  0x6c, 0x41, 0xfd, 0xe0, 0xc6, 0xe3, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc3, 0xd7, 0x8a, 0xde, 0x01,
+  0x6c, 0x41, 0xc0, 0xf8, 0xaa, 0xf0, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x04, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xbe, 0x99, 0x87, 0xe0, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x01, 0x0b, 0xcd, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0x9f, 0x82,
+  0xe9, 0x90, 0x01, 0x6c, 0x41, 0xec, 0xb8, 0xfd, 0x8f, 0x07, 0x6a, 0x20,
+  0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcb, 0xed,
+  0xa7, 0x3c, 0x6c, 0x41, 0xbb, 0xa0, 0xaf, 0xc9, 0x06, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1, 0xf9, 0xb7,
+  0xeb, 0x04, 0x6c, 0x41, 0x96, 0xeb, 0xe2, 0xe5, 0x05, 0x6a, 0x20, 0x01,
+  0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x85, 0x9a, 0x9b,
+  0xee, 0x00, 0x6c, 0x41, 0xed, 0xe5, 0xd2, 0x29, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0x97, 0xd8, 0xf0,
+  0x07, 0x6c, 0x41, 0xf0, 0xea, 0x96, 0xb3, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef, 0xc2, 0xe3, 0x9c,
+  0x03, 0x6c, 0x41, 0x8f, 0xe0, 0xee, 0xae, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5, 0xa5, 0xf9, 0xd2,
+  0x07, 0x6c, 0x41, 0xfa, 0xcc, 0xd6, 0xbf, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x89, 0x85, 0xdb, 0xd7,
+  0x04, 0x6c, 0x41, 0xa1, 0xe8, 0x99, 0xbc, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0x87, 0xa4, 0xfe, 0xd5, 0x05, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0xb5, 0xfe, 0xe5, 0xd3, 0x03, 0x6c, 0x41, 0xdd, 0xe2,
+  0xd4, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa3, 0x8f, 0xe5, 0xa5, 0x05, 0x6c, 0x41, 0xa0, 0xb5, 0xa5,
+  0x8e, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9f, 0x84, 0xda, 0xc9, 0x01, 0x6c, 0x41, 0xff, 0xf5, 0xba,
+  0xc8, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x95, 0xde, 0x88, 0xd6, 0x00, 0x6c, 0x41, 0xaa, 0xc4, 0x92,
+  0xf2, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xb9, 0xbb, 0x8f, 0xd1, 0x05, 0x6c, 0x41, 0x91, 0xcf, 0x8e,
+  0x19, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xf7, 0x95, 0xac, 0xe0, 0x07, 0x6c, 0x41, 0xe4, 0xba, 0xd4, 0x80,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x83, 0x99, 0xed, 0x8b, 0x05, 0x6c, 0x41, 0x93, 0xbf, 0xed, 0x8a,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x15, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc9, 0xef, 0xea, 0xd6, 0x02, 0x6c, 0x41, 0xce, 0xdd, 0xd6, 0x8c,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xfc, 0xe9, 0x92, 0xfe,
+  0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x85, 0x8f, 0xb8, 0xe6,
+  0x05, 0x6c, 0x41, 0xda, 0xd3, 0x87, 0xff, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xc9, 0x98, 0xf1,
+  0x03, 0x6c, 0x41, 0x81, 0xae, 0xb2, 0xc7, 0x00, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe7, 0xbf, 0xfa, 0x82,
+  0x02, 0x6c, 0x41, 0x94, 0xcf, 0xb2, 0x85, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0xb4, 0x8f, 0xd9,
+  0x01, 0x6c, 0x41, 0x83, 0xa7, 0xad, 0xfb, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x09, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0xca, 0x90, 0xb0,
+  0x03, 0x6c, 0x41, 0xfe, 0xce, 0xc5, 0x31, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0xaa, 0xf5, 0x80, 0x01,
+  0x6c, 0x41, 0xf5, 0xb7, 0xe3, 0xc3, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfb, 0xdf, 0xa6, 0xe6, 0x02,
+  0x6c, 0x41, 0x98, 0xb0, 0x82, 0xe5, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x08, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xd7, 0xd0, 0xa3, 0xe3, 0x05,
+  0x6c, 0x41, 0xd7, 0xa1, 0xe5, 0xbf, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xad, 0xa9, 0xb6, 0xce, 0x07, 0x73, 0x21, 0x01, 0x0b, 0x20,
+  0x00, 0x41, 0xe3, 0xe7, 0x8c, 0xd5, 0x06, 0x6c, 0x41, 0xf3, 0xc6, 0xe0,
+  0xa0, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xa9, 0x9d, 0xef, 0xde, 0x03, 0x6c, 0x41, 0xae, 0xd8, 0x92,
+  0xaa, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xdd, 0xc2, 0xd9, 0xed, 0x04, 0x6c, 0x41, 0xe5, 0xd8, 0xe6,
+  0x8b, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xeb, 0x9b, 0x8a, 0x93, 0x01, 0x6c, 0x41, 0xc8, 0xee, 0xd8,
+  0xcf, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x87, 0xa6, 0xa8, 0x95, 0x05, 0x6c, 0x41, 0xc7, 0xbb, 0xe8,
+  0x86, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9d, 0x86, 0xa8, 0xc9, 0x04, 0x6c, 0x41, 0x92, 0xb3, 0x91,
+  0xca, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xe1, 0xce, 0xaa, 0x89, 0x04, 0x6c, 0x41, 0x99, 0xe8, 0xa2,
+  0x93, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0xbf, 0xfd, 0xdb, 0xb7, 0x04, 0x6c, 0x41, 0x8c, 0xb3, 0x8b,
+  0xfc, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20,
+  0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xea, 0x91, 0xf6,
+  0xcf, 0x01, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcf, 0x06, 0x01,
+  0x01, 0x7f, 0x20, 0x00, 0x41, 0xdb, 0x8f, 0x9b, 0xfd, 0x01, 0x6c, 0x41,
+  0xf8, 0x84, 0xa8, 0xca, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0x93, 0x8d, 0xc5, 0x01, 0x6c, 0x41,
+  0xb7, 0x8d, 0x80, 0xb6, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1e, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x8d, 0xdb, 0xdb, 0xd3, 0x07, 0x6c, 0x41,
+  0xc2, 0x96, 0xc9, 0xc8, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1d, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x91, 0xd1, 0x9a, 0x8b, 0x01, 0x6c, 0x41,
+  0x89, 0xab, 0xc7, 0xfb, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xaf, 0xab, 0xcc, 0xb5, 0x02, 0x6c, 0x41,
+  0xbc, 0xfb, 0xd6, 0xf9, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0x81, 0x88, 0xf0, 0x01, 0x6c, 0x41,
+  0xcb, 0xbb, 0x95, 0xa1, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xc1, 0xd9, 0xc6, 0x90, 0x02, 0x6c, 0x41,
+  0xe6, 0x98, 0xbe, 0x13, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21,
+  0x01, 0x20, 0x00, 0x41, 0xd5, 0x90, 0xf8, 0x94, 0x01, 0x6c, 0x41, 0xfd,
+  0xa7, 0xad, 0xc6, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77, 0x21,
+  0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xc3,
+  0xf6, 0x86, 0xff, 0x06, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xc1,
+  0xab, 0xf5, 0x97, 0x04, 0x6c, 0x41, 0xf9, 0xe5, 0xf8, 0xc3, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9f,
+  0x91, 0xeb, 0xee, 0x06, 0x6c, 0x41, 0xec, 0x9b, 0x88, 0xca, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcb,
+  0x88, 0xaf, 0x9d, 0x07, 0x6c, 0x41, 0xbb, 0x9f, 0xb5, 0x89, 0x03, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb1,
+  0x90, 0xf9, 0xdd, 0x06, 0x6c, 0x41, 0x96, 0xb6, 0xa7, 0x87, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x85,
+  0xdd, 0xf8, 0x8b, 0x05, 0x6c, 0x41, 0xed, 0xec, 0xf8, 0x97, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3,
+  0xf6, 0xdf, 0xae, 0x02, 0x6c, 0x41, 0xf0, 0xdd, 0xc6, 0xbf, 0x02, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xef,
+  0xed, 0xe4, 0xe8, 0x02, 0x6c, 0x41, 0x8f, 0xaf, 0xb4, 0xe4, 0x04, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa5,
+  0x8c, 0x93, 0x83, 0x06, 0x6c, 0x41, 0xfa, 0xa7, 0x97, 0xa7, 0x06, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0x88, 0xd8, 0xe1, 0xfe, 0x00, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xa1, 0xbf, 0x82, 0xb2, 0x04, 0x6c,
+  0x41, 0xc6, 0xeb, 0xb4, 0x8d, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0x81, 0xb1, 0xcc, 0x03, 0x6c,
+  0x41, 0xdd, 0xa9, 0x9a, 0xdd, 0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xae, 0xd8, 0xf4, 0x06, 0x6c,
+  0x41, 0xa0, 0xe8, 0x9a, 0xc8, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x14,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9f, 0xef, 0xdc, 0xe1, 0x05, 0x6c,
+  0x41, 0xff, 0x84, 0xa4, 0xc5, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x95, 0x85, 0xb2, 0xf8, 0x00, 0x6c,
+  0x41, 0xaa, 0xdf, 0xec, 0xe2, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0xce, 0x8b, 0xec, 0x03, 0x6c,
+  0x41, 0x91, 0xe6, 0xfe, 0x83, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0x84, 0xdb, 0xe5, 0x02, 0x6c,
+  0x41, 0xe4, 0xfd, 0xec, 0xc0, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x83, 0x94, 0x98, 0xf9, 0x06, 0x6c,
+  0x41, 0x93, 0x9e, 0xac, 0xce, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0xc9, 0xe6, 0xf2, 0xf9, 0x00, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xcf, 0x88, 0xbb, 0xf7, 0x02, 0x6c, 0x41, 0xef, 0x92, 0xb6, 0xee,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x85, 0xf6, 0xd0, 0xc0, 0x00, 0x6c, 0x41, 0xda, 0xae, 0xdb, 0x2b,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xe9, 0x9c, 0xea, 0xd0, 0x00, 0x6c, 0x41, 0x81, 0x85, 0x8a, 0x89, 0x07,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xe7, 0xee, 0x9c, 0xa9, 0x05, 0x6c, 0x41, 0x94, 0xd2, 0xf8, 0xa9, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x18, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xb3, 0xef, 0xe3, 0xad, 0x03, 0x6c, 0x41, 0x83, 0xc6, 0x97, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9,
+  0x81, 0xf0, 0xd4, 0x06, 0x6c, 0x41, 0xfe, 0xb9, 0xeb, 0xa5, 0x07, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad,
+  0x8d, 0xb6, 0x91, 0x07, 0x6c, 0x41, 0xf5, 0xde, 0xcb, 0x8b, 0x05, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xfb,
+  0xde, 0xda, 0x90, 0x01, 0x6c, 0x41, 0x98, 0xc3, 0x89, 0x8a, 0x01, 0x6a,
+  0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01,
+  0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xd6, 0x9b, 0xee, 0xc7, 0x04, 0x73,
+  0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xcc, 0x06, 0x01, 0x01, 0x7f, 0x20,
+  0x00, 0x41, 0xd7, 0x90, 0xdb, 0x8e, 0x04, 0x6c, 0x41, 0xc4, 0xfe, 0x9f,
+  0x1e, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xe3, 0xe2, 0xea, 0x8b, 0x04, 0x6c, 0x41, 0xf3, 0xa5, 0xd6, 0xb8,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xa9, 0x94, 0x86, 0xcf, 0x02, 0x6c, 0x41, 0xae, 0x83, 0xda, 0x8e,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xdd, 0xe5, 0xd7, 0xd7, 0x05, 0x6c, 0x41, 0xe5, 0xbf, 0xfe, 0xe6,
+  0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xeb, 0xda, 0xb9, 0xd5, 0x02, 0x6c, 0x41, 0xc8, 0xc1, 0xf5, 0xea,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1b, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x87, 0xb1, 0xc4, 0xcf, 0x05, 0x6c, 0x41, 0xc7, 0xea, 0x91, 0xf6,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x9d, 0xcd, 0xab, 0xaf, 0x04, 0x6c, 0x41, 0x92, 0xee, 0xd8, 0x8d,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x07, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xe1, 0x81, 0xf6, 0x90, 0x03, 0x6c, 0x41, 0x99, 0x9f, 0xd1, 0x88,
+  0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xbf, 0x8c, 0x93, 0xef,
+  0x02, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x8d, 0x96, 0xa7, 0x94,
+  0x01, 0x6c, 0x41, 0xd5, 0x98, 0xc5, 0xbe, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0x8e, 0xa6, 0xc3,
+  0x01, 0x6c, 0x41, 0xf8, 0x97, 0xba, 0xbc, 0x05, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x19, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xde, 0xda, 0x03,
+  0x6c, 0x41, 0xb7, 0xfc, 0xbc, 0xad, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8d, 0xe2, 0xde, 0x87, 0x03,
+  0x6c, 0x41, 0xc2, 0x91, 0xda, 0xf3, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x91, 0xc4, 0x8b, 0xfc, 0x01,
+  0x6c, 0x41, 0x89, 0xa2, 0xed, 0x9f, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x14, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xaf, 0xfa, 0x86, 0xf3, 0x06,
+  0x6c, 0x41, 0xbc, 0x9e, 0xf0, 0xc4, 0x00, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0xdc, 0x81, 0xc8, 0x05,
+  0x6c, 0x41, 0xcb, 0xfa, 0xdb, 0xc6, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x06, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xc1, 0xb0, 0xfc, 0xbe, 0x02,
+  0x6c, 0x41, 0xe6, 0xa3, 0x9d, 0xb5, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41,
+  0x18, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20,
+  0x01, 0x41, 0xd4, 0x93, 0xb4, 0x2a, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xfd, 0xee, 0x8f, 0xc6, 0x02, 0x6c, 0x41, 0xf2, 0xcc, 0x9a, 0xc4,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc1, 0xde, 0xeb, 0xda, 0x03, 0x6c, 0x41, 0xf9, 0x9c, 0xf6, 0xb0,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x9f, 0xa0, 0x89, 0xc2, 0x03, 0x6c, 0x41, 0xec, 0xfe, 0xfe, 0xfc,
+  0x07, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xcb, 0xa3, 0x82, 0xff, 0x03, 0x6c, 0x41, 0xbb, 0x9e, 0x97, 0xda,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x08, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xb1, 0xa7, 0xf6, 0xdb, 0x06, 0x6c, 0x41, 0x96, 0x81, 0xf8, 0x9a,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x85, 0xa0, 0xc2, 0xe5, 0x07, 0x6c, 0x41, 0xed, 0xf3, 0x9a, 0xd1,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xb3, 0xd5, 0xc3, 0xdc, 0x04, 0x6c, 0x41, 0xf0, 0xd0, 0xa2, 0xed,
+  0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xef, 0x98, 0xf2, 0xd1, 0x01, 0x6c, 0x41, 0x8f, 0xfe, 0x95, 0xcd,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0c, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xa5, 0xf3, 0xa8, 0xe5,
+  0x03, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0xfb, 0x82, 0xa4, 0xe5,
+  0x02, 0x6c, 0x41, 0xab, 0xfa, 0x93, 0x86, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x13, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa1, 0x96, 0xa7, 0x81,
+  0x01, 0x6c, 0x41, 0xc6, 0xf6, 0xd6, 0xd1, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb5, 0x84, 0xe8, 0xa6,
+  0x07, 0x6c, 0x41, 0xdd, 0xf0, 0xdb, 0xad, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xa3, 0xcd, 0xa7, 0x91,
+  0x07, 0x6c, 0x41, 0xa0, 0x9b, 0xbc, 0xa9, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9f, 0xda, 0xeb, 0x8c,
+  0x04, 0x6c, 0x41, 0xff, 0x93, 0xa9, 0xb3, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x95, 0xac, 0xd7, 0xba,
+  0x01, 0x6c, 0x41, 0xaa, 0xfa, 0x12, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0xe1, 0xb3, 0xc1, 0x03, 0x6c,
+  0x41, 0x91, 0xfd, 0xaa, 0x16, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09, 0x77,
+  0x21, 0x01, 0x20, 0x00, 0x41, 0xf7, 0xf3, 0xa5, 0xcb, 0x06, 0x6c, 0x41,
+  0xe4, 0xc0, 0xf1, 0x88, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x16, 0x77,
+  0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41,
+  0x82, 0x8f, 0x8f, 0x8e, 0x03, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b,
+  0xcd, 0x06, 0x01, 0x01, 0x7f, 0x20, 0x00, 0x41, 0x93, 0xfd, 0xc6, 0xbd,
+  0x02, 0x6c, 0x41, 0xd0, 0xbd, 0xc4, 0xbb, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xcf, 0xb3, 0xab, 0xeb,
+  0x04, 0x6c, 0x41, 0xef, 0xe1, 0xbe, 0xc1, 0x04, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x85, 0xdd, 0xe5, 0xa8,
+  0x03, 0x6c, 0x41, 0xda, 0x89, 0xfb, 0xda, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x01, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe9, 0xef, 0xe7, 0xb0,
+  0x05, 0x6c, 0x41, 0x81, 0xdc, 0x9d, 0xc0, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x0d, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xe7, 0x9d, 0xdb, 0xad,
+  0x02, 0x6c, 0x41, 0x94, 0xd5, 0xaa, 0xfc, 0x06, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb3, 0xaa, 0x84, 0xc0,
+  0x01, 0x6c, 0x41, 0x83, 0xe5, 0xdd, 0x9c, 0x02, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x17, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb9, 0xb8, 0x8b, 0xa6,
+  0x04, 0x6c, 0x41, 0xfe, 0xa4, 0x9d, 0x99, 0x07, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xad, 0xf0, 0xe2, 0xb2,
+  0x06, 0x6c, 0x41, 0xf5, 0x85, 0xb0, 0xcf, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x10, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40,
+  0x20, 0x01, 0x41, 0xfb, 0xdd, 0xea, 0xc3, 0x01, 0x73, 0x21, 0x01, 0x0b,
+  0x20, 0x00, 0x41, 0x99, 0xd6, 0xbc, 0xf5, 0x05, 0x6c, 0x41, 0xf1, 0xb2,
+  0x9b, 0xe2, 0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xd7, 0xff, 0xec, 0xb9, 0x04, 0x6c, 0x41, 0xc4, 0xc1,
+  0xdf, 0xc7, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0b, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xe3, 0xdd, 0x94, 0x96, 0x03, 0x6c, 0x41, 0xf3, 0x84,
+  0xa8, 0xb8, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xa9, 0x8b, 0xd9, 0xf9, 0x03, 0x6c, 0x41, 0xae, 0xae,
+  0xad, 0xe8, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x12, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xdd, 0x88, 0xc2, 0xb8, 0x03, 0x6c, 0x41, 0xe5, 0xa6,
+  0x92, 0xac, 0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x01, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0xeb, 0x99, 0xc5, 0xbe, 0x05, 0x6c, 0x41, 0xc8, 0x94,
+  0xbe, 0x92, 0x05, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x06, 0x77, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x87, 0xbc, 0xec, 0x09, 0x6c, 0x41, 0xc7, 0x99, 0xd7,
+  0xbf, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x05, 0x77, 0x21, 0x01, 0x20,
+  0x00, 0x41, 0x9d, 0x94, 0xab, 0xc6, 0x01, 0x6c, 0x41, 0x92, 0xa9, 0xec,
+  0x3a, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x01,
+  0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xe0, 0xb4, 0xed, 0xd7,
+  0x04, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00, 0x41, 0x99, 0xd6, 0xbb, 0xc6,
+  0x04, 0x6c, 0x41, 0xde, 0xcf, 0xc7, 0xd0, 0x03, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8d, 0xf9, 0xae, 0x89,
+  0x06, 0x6c, 0x41, 0xd5, 0xbf, 0xe8, 0x9a, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x16, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xdb, 0x8d, 0x8d, 0xce,
+  0x00, 0x6c, 0x41, 0xf8, 0xaa, 0xf8, 0x80, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x11, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xb7, 0xa9, 0xb4, 0xf8,
+  0x00, 0x6c, 0x41, 0xb7, 0xeb, 0x95, 0xfd, 0x01, 0x6a, 0x20, 0x01, 0x73,
+  0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x8d, 0xe9, 0xdd, 0x1a,
+  0x6c, 0x41, 0xc2, 0x8c, 0xb7, 0x1e, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x91, 0xb7, 0xa8, 0xb2, 0x02, 0x6c,
+  0x41, 0x89, 0x99, 0xcf, 0x9a, 0x04, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x17,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0xaf, 0xc9, 0xdd, 0xd7, 0x01, 0x6c,
+  0x41, 0xbc, 0xc1, 0xf5, 0xd2, 0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x09,
+  0x77, 0x21, 0x01, 0x20, 0x00, 0x41, 0x9b, 0xb7, 0xc7, 0xfa, 0x00, 0x6c,
+  0x41, 0xcb, 0xb9, 0xfe, 0xce, 0x06, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1f,
+  0x77, 0x21, 0x01, 0x20, 0x01, 0x41, 0x01, 0x71, 0x04, 0x40, 0x20, 0x01,
+  0x41, 0xc1, 0x87, 0xee, 0x9a, 0x05, 0x73, 0x21, 0x01, 0x0b, 0x20, 0x00,
+  0x41, 0xe7, 0xae, 0x88, 0xc3, 0x04, 0x6c, 0x41, 0xa7, 0xf5, 0xa4, 0x9e,
+  0x03, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x1c, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xfd, 0xb5, 0xee, 0xd2, 0x04, 0x6c, 0x41, 0xf2, 0x87, 0xa1, 0xf7,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xc1, 0x91, 0x8e, 0xe9, 0x02, 0x6c, 0x41, 0xf9, 0xd3, 0xaf, 0x82,
+  0x01, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x0e, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0x9f, 0xaf, 0xc3, 0xfa, 0x06, 0x6c, 0x41, 0xec, 0xe1, 0xe1, 0xd8,
+  0x02, 0x6a, 0x20, 0x01, 0x73, 0x41, 0x04, 0x77, 0x21, 0x01, 0x20, 0x00,
+  0x41, 0xcb, 0xbe, 0xa1, 0x11, 0x6c, 0x41, 0xbb, 0x9d, 0xd5, 0xab, 0x03,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x02, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xb1, 0xbe, 0xaf, 0xd5, 0x05, 0x6c, 0x41, 0x96, 0xcc, 0xd4, 0xd0, 0x00,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x1a, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0x85, 0xe3, 0xf7, 0xaa, 0x07, 0x6c, 0x41, 0xed, 0xfa, 0xb8, 0xc5, 0x06,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x0f, 0x77, 0x21, 0x01, 0x20, 0x00, 0x41,
+  0xb3, 0xb4, 0x83, 0xea, 0x00, 0x6c, 0x41, 0xf0, 0xc3, 0xaa, 0xec, 0x01,
+  0x6a, 0x20, 0x01, 0x73, 0x41, 0x03, 0x77, 0x21, 0x01, 0x20, 0x01, 0x41,
+  0x01, 0x71, 0x04, 0x40, 0x20, 0x01, 0x41, 0xee, 0xc3, 0x8b, 0x88, 0x03,
+  0x73, 0x21, 0x01, 0x0b, 0x20, 0x01, 0x0b, 0xb1, 0x01, 0x01, 0x01, 0x7f,
+  0x20, 0x00, 0x10, 0x00, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x01, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x02, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x03, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x00, 0x10, 0x04, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x05, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x06, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x07, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x00, 0x10, 0x08, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x09, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x0a, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x0b, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x00, 0x10, 0x0c, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x0d, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x0e, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x0f, 0x20, 0x01, 0x73, 0x21, 0x01,
+  0x20, 0x00, 0x10, 0x10, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10,
+  0x11, 0x20, 0x01, 0x73, 0x21, 0x01, 0x20, 0x00, 0x10, 0x12, 0x20, 0x01,
+  0x73, 0x21, 0x01, 0x20, 0x01, 0x0b, 0x0b, 0x88, 0x02, 0x01, 0x00, 0x41,
+  0x80, 0x08, 0x0b, 0x80, 0x02, 0x8f, 0x1c, 0x25, 0xfa, 0xab, 0x08, 0xa1,
+  0xc6, 0x87, 0xb4, 0xdd, 0x52, 0x23, 0x20, 0xd9, 0x9e, 0x7f, 0x4c, 0x95,
+  0xaa, 0x9b, 0x38, 0x11, 0x76, 0x77, 0xe4, 0x4d, 0x02, 0x13, 0x50, 0x49,
+  0x4e, 0x6f, 0x7c, 0x05, 0x5a, 0x8b, 0x68, 0x81, 0x26, 0x67, 0x14, 0xbd,
+  0xb2, 0x03, 0x80, 0xb9, 0xfe, 0x5f, 0xac, 0x75, 0x0a, 0x7b, 0x98, 0xf1,
+  0xd6, 0x57, 0x44, 0x2d, 0x62, 0xf3, 0xb0, 0x29, 0xae, 0x4f, 0xdc, 0xe5,
+  0xba, 0x6b, 0xc8, 0x61, 0x86, 0x47, 0x74, 0x9d, 0x12, 0xe3, 0xe0, 0x99,
+  0x5e, 0x3f, 0x0c, 0x55, 0x6a, 0x5b, 0xf8, 0xd1, 0x36, 0x37, 0xa4, 0x0d,
+  0xc2, 0xd3, 0x10, 0x09, 0x0e, 0x2f, 0x3c, 0xc5, 0x1a, 0x4b, 0x28, 0x41,
+  0xe6, 0x27, 0xd4, 0x7d, 0x72, 0xc3, 0x40, 0x79, 0xbe, 0x1f, 0x6c, 0x35,
+  0xca, 0x3b, 0x58, 0xb1, 0x96, 0x17, 0x04, 0xed, 0x22, 0xb3, 0x70, 0xe9,
+  0x6e, 0x0f, 0x9c, 0xa5, 0x7a, 0x2b, 0x88, 0x21, 0x46, 0x07, 0x34, 0x5d,
+  0xd2, 0xa3, 0xa0, 0x59, 0x1e, 0xff, 0xcc, 0x15, 0x2a, 0x1b, 0xb8, 0x91,
+  0xf6, 0xf7, 0x64, 0xcd, 0x82, 0x93, 0xd0, 0xc9, 0xce, 0xef, 0xfc, 0x85,
+  0xda, 0x0b, 0xe8, 0x01, 0xa6, 0xe7, 0x94, 0x3d, 0x32, 0x83, 0x00, 0x39,
+  0x7e, 0xdf, 0x2c, 0xf5, 0x8a, 0xfb, 0x18, 0x71, 0x56, 0xd7, 0xc4, 0xad,
+  0xe2, 0x73, 0x30, 0xa9, 0x2e, 0xcf, 0x5c, 0x65, 0x3a, 0xeb, 0x48, 0xe1,
+  0x06, 0xc7, 0xf4, 0x1d, 0x92, 0x63, 0x60, 0x19, 0xde, 0xbf, 0x8c, 0xd5,
+  0xea, 0xdb, 0x78, 0x51, 0xb6, 0xb7, 0x24, 0x8d, 0x42, 0x53, 0x90, 0x89,
+  0x8e, 0xaf, 0xbc, 0x45, 0x9a, 0xcb, 0xa8, 0xc1, 0x66, 0xa7, 0x54, 0xfd,
+  0xf2, 0x43, 0xc0, 0xf9, 0x3e, 0x9f, 0xec, 0xb5, 0x4a, 0xbb, 0xd8, 0x31,
+  0x16, 0x97, 0x84, 0x6d, 0xa2, 0x33, 0xf0, 0x69, 0xee
+};
+static const unsigned int synth_16k_wasm_len = 16605;
+
+static const startup_module_t startup_modules[] = {
+    { "toggle", toggle_wasm, sizeof(toggle_wasm), NULL, 0, { 0 } },
+    { "math_ops", math_ops_wasm, sizeof(math_ops_wasm), "add", 2, { 1, 2 } },
+    { "fft_bench", fft_bench_wasm, sizeof(fft_bench_wasm), "fft_init", 0, { 0 } },
+    { "synth_4k", synth_4k_wasm, sizeof(synth_4k_wasm), "entry", 1, { 1 } },
+    { "synth_16k", synth_16k_wasm, sizeof(synth_16k_wasm), "entry", 1, { 1 } },
+};
+#define STARTUP_MODULES_LEN (sizeof(startup_modules) / sizeof(startup_modules[0]))
+
+#endif /* STARTUP_MODULES_H */
@@ -0,0 +1,74 @@
+#ifndef HOSTCALL_BENCH_H
+#define HOSTCALL_BENCH_H
+
+#include <stdint.h>
+
+/*
+ * Costo di una chiamata wasm -> host (import "env" no-op), senza oscilloscopio.
+ * Il modulo wasm è scritto da hostcall_gen.py; la baseline nativa
+ * (hostcall_bench.c) chiama funzioni C non inline tramite puntatore.
+ *
+ * Ogni kernel K esporta K_init(), K_bench(iterations) e K_checksum(): una
+ * iterazione è una chiamata, quindi ns/cicli per iterazione = per chiamata.
+ * hc_loop è il ciclo vuoto e hc_local una chiamata a una funzione del
+ * modulo stesso, da sottrarre/confrontare con gli altri.
+ *
+ *   kernel        import            firma WAMR   host
+ *   hc_void       hc_void           ()           no-op
+ *   hc_i32_1      hc_i32_1          (i)          no-op
+ *   hc_i32_4      hc_i32_4          (iiii)       no-op
+ *   hc_i32_8      hc_i32_8          (iiiiiiii)   no-op
+ *   hc_i64_4      hc_i64_4          (IIII)       no-op
+ *   hc_f64_4      hc_f64_4          (FFFF)       no-op
+ *   hc_mixed      hc_mixed          (iIfF)       no-op
+ *   hc_ret        hc_ret            (i)i         x + 1
+ *   hc_str        hc_str            ($)i         strlen (WAMR valida la stringa)
+ *   hc_buf        hc_buf            (*~)i        len (WAMR valida ptr + len)
+ *   hc_raw_*      hc_raw_*          come sopra   registrate con
+ *                                                wasm_runtime_register_natives_raw;
+ *                                                hc_raw_str chiama
+ *                                                wasm_runtime_validate_app_str_addr
+ *
+ * Checksum (acc a fine misura, dipende solo da quante chiamate sono state
+ * fatte): acc += 1 per gli import void, acc += risultato per gli altri,
+ * con hc_ret(i) e hc_local(i) sull'indice di iterazione.
+ * wasm3 ha solo funzioni "raw": hc_raw_* usano le stesse funzioni host.
+ */
+
+/* nomi nell'ordine della suite */
+#define HOSTCALL_SUITE_NAMES \
+    "hc_loop", "hc_local", "hc_void", "hc_i32_1", "hc_i32_4", "hc_i32_8", \
+    "hc_i64_4", "hc_f64_4", "hc_mixed", "hc_ret", "hc_str", "hc_buf", \
+    "hc_raw_void", "hc_raw_i32_4", "hc_raw_i32_8", "hc_raw_str"
+#define HOSTCALL_SUITE_LEN 16
+
+/* gli stessi nomi come X-macro, per le dichiarazioni della baseline nativa */
+#define HOSTCALL_FOREACH(X) \
+    X(hc_loop) X(hc_local) X(hc_void) X(hc_i32_1) X(hc_i32_4) X(hc_i32_8) \
+    X(hc_i64_4) X(hc_f64_4) X(hc_mixed) X(hc_ret) X(hc_str) X(hc_buf) \
+    X(hc_raw_void) X(hc_raw_i32_4) X(hc_raw_i32_8) X(hc_raw_str)
+
+#define HOSTCALL_DECLARE(K) \
+    void K##_init(void); void K##_bench(int32_t iterations); uint32_t K##_checksum(void);
+HOSTCALL_FOREACH(HOSTCALL_DECLARE)
+
+/* tabella per i runner nativi (MCU): stesso ordine di HOSTCALL_SUITE_NAMES */
+typedef struct {
+    const char *name;
+    void     (*init)(void);
+    void     (*bench)(int32_t iterations);
+    uint32_t (*checksum)(void);
+} hostcall_desc_t;
+
+extern const hostcall_desc_t hostcall_suite[HOSTCALL_SUITE_LEN];
+
+/* dati passati a hc_str / hc_buf (segmento dati del modulo) */
+#define HOSTCALL_STR      "hostcall"
+#define HOSTCALL_STR_ADDR 16
+#define HOSTCALL_BUF_ADDR 64
+#define HOSTCALL_BUF_LEN  64
+
+/* chiamate per round sugli MCU (le FFT usano NUM_ITER) */
+#define HOSTCALL_MCU_ITERS 1000
+
+#endif /* HOSTCALL_BENCH_H */
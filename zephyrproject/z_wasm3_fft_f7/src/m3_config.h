@@ -57,6 +57,10 @@
 #   define d_m3FixedHeapAlign                   16
 # endif
 
+# ifndef d_m3HeapStats
+#   define d_m3HeapStats                        0       // live/peak bytes of m3_Malloc, see m3_GetHeapStats ()
+# endif
+
 # ifndef d_m3Use32BitSlots
 #   define d_m3Use32BitSlots                    1
 # endif
@@ -65,6 +69,10 @@
 #   define d_m3ProfilerSlotMask                 0xFFFF
 # endif
 
+# ifndef d_m3ProfilerPairSlotMask
+#   define d_m3ProfilerPairSlotMask             0xFFFF  // pairs of consecutive operations, see m3_ForEachProfilerCount ()
+# endif
+
 # ifndef d_m3RecordBacktraces
 #   define d_m3RecordBacktraces                 0
 # endif
@@ -74,12 +82,54 @@
 # endif
 
 
+// superinstructions ----------------------------------------------------------
+// one operation for a pair the compiler emits back to back (see c_fusedOps in m3_compile.c).
+// off by default: each family changes code generation and costs flash, so a project
+// opts in with -Dd_m3EnableSuperinstructions=1 or one family at a time
+
+# ifndef d_m3EnableSuperinstructions
+#   define d_m3EnableSuperinstructions          0
+# endif
+
+# ifndef d_m3FuseSetSlot
+#   define d_m3FuseSetSlot                      d_m3EnableSuperinstructions     // i32/f32/f64 arithmetic or load + SetSlot (local.set/tee, spills)
+# endif
+
+# ifndef d_m3FuseLoadAddress
+#   define d_m3FuseLoadAddress                  d_m3EnableSuperinstructions     // i32.add + load from the sum
+# endif
+
+# ifndef d_m3FuseCompareBranch
+#   define d_m3FuseCompareBranch                d_m3EnableSuperinstructions     // i32 compare + br_if
+# endif
+
+
+// second registers -----------------------------------------------------------
+// _r1 and _fp1 next to _r0 and _fp0 in the operation signature. a value moved out of the way of the next
+// one (PreserveRegisterIfOccupied) stays in a register when an operation on both follows: the binary
+// operations get an _rr variant, and the superinstructions that set a slot one that sets the second
+// register. flash for speed, and only where the extra argument is passed in a register: on 32-bit Arm
+// (AAPCS) _r1, like _r0, goes on the stack, while _fp1 is in d1 with a hard-float ABI
+
+# ifndef d_m3HasReg1
+#   define d_m3HasReg1                          0       // second integer register, _r1
+# endif
+
+# ifndef d_m3HasFp1
+#   define d_m3HasFp1                           0       // second floating point register, _fp1
+# endif
+
+
 // profiling and tracing ------------------------------------------------------
 
 # ifndef d_m3EnableOpProfiling
 #   define d_m3EnableOpProfiling                0       // opcode usage counters
 # endif
 
+# ifndef d_m3ProfilerPrintOnFree
+#   define d_m3ProfilerPrintOnFree              1       // m3_FreeRuntime () prints the op counters to stderr
+# endif
+
 # ifndef d_m3EnableOpTracing
 #   define d_m3EnableOpTracing                  0       // only works with DEBUG
 # endif
@@ -136,6 +186,11 @@
 #   define d_m3NoFloatDynamic                   1       // if no floats, do not fail until flops are actually executed
 #endif
 
+#if !d_m3HasFloat
+#   undef  d_m3HasFp1
+#   define d_m3HasFp1                           0
+#endif
+
 # ifndef d_m3SkipStackCheck
 #   define d_m3SkipStackCheck                   0       // skip stack overrun checks
 # endif
@@ -16,11 +16,19 @@ d_m3BeginExternC
 # define m3MemRuntime(mem)              (((M3MemoryHeader*)(mem))->runtime)
 # define m3MemInfo(mem)                 (&(((M3MemoryHeader*)(mem))->runtime->memory))
 
-# define d_m3BaseOpSig                  pc_t _pc, m3stack_t _sp, M3MemoryHeader * _mem, m3reg_t _r0
-# define d_m3BaseOpArgs                 _sp, _mem, _r0
-# define d_m3BaseOpAllArgs              _pc, _sp, _mem, _r0
-# define d_m3BaseOpDefaultArgs          0
-# define d_m3BaseClearRegisters         _r0 = 0;
+# if d_m3HasReg1
+#   define d_m3BaseOpSig                pc_t _pc, m3stack_t _sp, M3MemoryHeader * _mem, m3reg_t _r0, m3reg_t _r1
+#   define d_m3BaseOpArgs               _sp, _mem, _r0, _r1
+#   define d_m3BaseOpAllArgs            _pc, _sp, _mem, _r0, _r1
+#   define d_m3BaseOpDefaultArgs        0, 0
+#   define d_m3BaseClearRegisters       _r0 = 0; _r1 = 0;
+# else
+#   define d_m3BaseOpSig                pc_t _pc, m3stack_t _sp, M3MemoryHeader * _mem, m3reg_t _r0
+#   define d_m3BaseOpArgs               _sp, _mem, _r0
+#   define d_m3BaseOpAllArgs            _pc, _sp, _mem, _r0
+#   define d_m3BaseOpDefaultArgs        0
+#   define d_m3BaseClearRegisters       _r0 = 0;
+# endif
 
 # define d_m3ExpOpSig(...)              d_m3BaseOpSig, __VA_ARGS__
 # define d_m3ExpOpArgs(...)             d_m3BaseOpArgs, __VA_ARGS__
@@ -28,7 +36,13 @@ d_m3BeginExternC
 # define d_m3ExpOpDefaultArgs(...)      d_m3BaseOpDefaultArgs, __VA_ARGS__
 # define d_m3ExpClearRegisters(...)     d_m3BaseClearRegisters; __VA_ARGS__
 
-# if d_m3HasFloat
+# if d_m3HasFp1
+#   define d_m3OpSig                d_m3ExpOpSig            (f64 _fp0, f64 _fp1)
+#   define d_m3OpArgs               d_m3ExpOpArgs           (_fp0, _fp1)
+#   define d_m3OpAllArgs            d_m3ExpOpAllArgs        (_fp0, _fp1)
+#   define d_m3OpDefaultArgs        d_m3ExpOpDefaultArgs    (0., 0.)
+#   define d_m3ClearRegisters       d_m3ExpClearRegisters   (_fp0 = 0.; _fp1 = 0.;)
+# elif d_m3HasFloat
 #   define d_m3OpSig                d_m3ExpOpSig            (f64 _fp0)
 #   define d_m3OpArgs               d_m3ExpOpArgs           (_fp0)
 #   define d_m3OpAllArgs            d_m3ExpOpAllArgs        (_fp0)